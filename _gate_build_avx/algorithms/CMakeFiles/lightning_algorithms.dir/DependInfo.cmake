@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/pennylane_lightning/src/algorithms/AdjointDiff.cpp" "algorithms/CMakeFiles/lightning_algorithms.dir/AdjointDiff.cpp.o" "gcc" "algorithms/CMakeFiles/lightning_algorithms.dir/AdjointDiff.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/algorithms/AdjointDiffFixedWeight.cpp" "algorithms/CMakeFiles/lightning_algorithms.dir/AdjointDiffFixedWeight.cpp.o" "gcc" "algorithms/CMakeFiles/lightning_algorithms.dir/AdjointDiffFixedWeight.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/algorithms/BatchedCircuit.cpp" "algorithms/CMakeFiles/lightning_algorithms.dir/BatchedCircuit.cpp.o" "gcc" "algorithms/CMakeFiles/lightning_algorithms.dir/BatchedCircuit.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/algorithms/JacobianProd.cpp" "algorithms/CMakeFiles/lightning_algorithms.dir/JacobianProd.cpp.o" "gcc" "algorithms/CMakeFiles/lightning_algorithms.dir/JacobianProd.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/algorithms/ParameterShift.cpp" "algorithms/CMakeFiles/lightning_algorithms.dir/ParameterShift.cpp.o" "gcc" "algorithms/CMakeFiles/lightning_algorithms.dir/ParameterShift.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/algorithms/QuantumTrajectories.cpp" "algorithms/CMakeFiles/lightning_algorithms.dir/QuantumTrajectories.cpp.o" "gcc" "algorithms/CMakeFiles/lightning_algorithms.dir/QuantumTrajectories.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/algorithms/TapeExecutor.cpp" "algorithms/CMakeFiles/lightning_algorithms.dir/TapeExecutor.cpp.o" "gcc" "algorithms/CMakeFiles/lightning_algorithms.dir/TapeExecutor.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_avx/gates/CMakeFiles/lightning_gates.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_avx/simulator/CMakeFiles/lightning_simulator.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_avx/util/CMakeFiles/lightning_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
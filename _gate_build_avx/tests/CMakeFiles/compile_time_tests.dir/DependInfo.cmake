@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/pennylane_lightning/src/tests/compile_time_tests.cpp" "tests/CMakeFiles/compile_time_tests.dir/compile_time_tests.cpp.o" "gcc" "tests/CMakeFiles/compile_time_tests.dir/compile_time_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_avx/gates/CMakeFiles/lightning_gates.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_avx/util/CMakeFiles/lightning_utils.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_avx/simulator/CMakeFiles/lightning_simulator.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
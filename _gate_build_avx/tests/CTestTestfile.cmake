@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/pennylane_lightning/src/tests
+# Build directory: /root/repo/_gate_build_avx/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_gate_build_avx/tests/runner_include-b12d07c.cmake")
+subdirs("../_deps/catch2-build")
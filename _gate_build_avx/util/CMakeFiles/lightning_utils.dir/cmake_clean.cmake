@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lightning_utils.dir/RuntimeInfo.cpp.o"
+  "CMakeFiles/lightning_utils.dir/RuntimeInfo.cpp.o.d"
+  "liblightning_utils.a"
+  "liblightning_utils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lightning_utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
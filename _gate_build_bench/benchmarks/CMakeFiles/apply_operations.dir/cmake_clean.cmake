@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/apply_operations.dir/Bench_ApplyOperations.cpp.o"
+  "CMakeFiles/apply_operations.dir/Bench_ApplyOperations.cpp.o.d"
+  "apply_operations"
+  "apply_operations.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/apply_operations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
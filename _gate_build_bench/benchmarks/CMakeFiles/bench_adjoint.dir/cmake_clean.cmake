@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_adjoint.dir/Bench_AdjointJacobian.cpp.o"
+  "CMakeFiles/bench_adjoint.dir/Bench_AdjointJacobian.cpp.o.d"
+  "bench_adjoint"
+  "bench_adjoint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_adjoint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
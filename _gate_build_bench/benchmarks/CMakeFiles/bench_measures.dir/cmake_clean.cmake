@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_measures.dir/Bench_Measures.cpp.o"
+  "CMakeFiles/bench_measures.dir/Bench_Measures.cpp.o.d"
+  "bench_measures"
+  "bench_measures.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_measures.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils.dir/Bench_BitUtil.cpp.o"
+  "CMakeFiles/utils.dir/Bench_BitUtil.cpp.o.d"
+  "CMakeFiles/utils.dir/Bench_LinearAlgebra.cpp.o"
+  "CMakeFiles/utils.dir/Bench_LinearAlgebra.cpp.o.d"
+  "utils"
+  "utils.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
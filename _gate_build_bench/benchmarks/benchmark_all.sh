@@ -0,0 +1 @@
+/root/repo/pennylane_lightning/src/benchmarks/benchmark_all.sh
\ No newline at end of file
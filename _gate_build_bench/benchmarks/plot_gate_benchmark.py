@@ -0,0 +1 @@
+/root/repo/pennylane_lightning/src/benchmarks/plot_gate_benchmark.py
\ No newline at end of file
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lightning_gates.dir/DynamicDispatcher.cpp.o"
+  "CMakeFiles/lightning_gates.dir/DynamicDispatcher.cpp.o.d"
+  "CMakeFiles/lightning_gates.dir/GateFusion.cpp.o"
+  "CMakeFiles/lightning_gates.dir/GateFusion.cpp.o.d"
+  "CMakeFiles/lightning_gates.dir/GateUtil.cpp.o"
+  "CMakeFiles/lightning_gates.dir/GateUtil.cpp.o.d"
+  "liblightning_gates.a"
+  "liblightning_gates.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lightning_gates.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
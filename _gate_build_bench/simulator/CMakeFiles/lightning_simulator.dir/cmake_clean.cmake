@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lightning_simulator.dir/KernelMap.cpp.o"
+  "CMakeFiles/lightning_simulator.dir/KernelMap.cpp.o.d"
+  "CMakeFiles/lightning_simulator.dir/Measures.cpp.o"
+  "CMakeFiles/lightning_simulator.dir/Measures.cpp.o.d"
+  "CMakeFiles/lightning_simulator.dir/StateVectorManagedCPU.cpp.o"
+  "CMakeFiles/lightning_simulator.dir/StateVectorManagedCPU.cpp.o.d"
+  "CMakeFiles/lightning_simulator.dir/StateVectorRawCPU.cpp.o"
+  "CMakeFiles/lightning_simulator.dir/StateVectorRawCPU.cpp.o.d"
+  "liblightning_simulator.a"
+  "liblightning_simulator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lightning_simulator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
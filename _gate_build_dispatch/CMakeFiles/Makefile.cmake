@@ -0,0 +1,113 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/catch2src/CMakeLists.txt"
+  "/root/catch2src/contrib/Catch.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/process_options.cmake"
+  "/root/repo/pennylane_lightning/src/CMakeLists.txt"
+  "/root/repo/pennylane_lightning/src/algorithms/CMakeLists.txt"
+  "/root/repo/pennylane_lightning/src/gates/CMakeLists.txt"
+  "/root/repo/pennylane_lightning/src/simulator/CMakeLists.txt"
+  "/root/repo/pennylane_lightning/src/tests/CMakeLists.txt"
+  "/root/repo/pennylane_lightning/src/util/CMakeLists.txt"
+  "/usr/lib/cmake/Catch2/Catch2Config.cmake"
+  "/usr/lib/cmake/Catch2/Catch2ConfigVersion.cmake"
+  "/usr/lib/cmake/Catch2/Catch2Targets-none.cmake"
+  "/usr/lib/cmake/Catch2/Catch2Targets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "algorithms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "gates/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "simulator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/DartConfiguration.tcl"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/catch2-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "algorithms/CMakeFiles/lightning_algorithms.dir/DependInfo.cmake"
+  "gates/CMakeFiles/lightning_gates.dir/DependInfo.cmake"
+  "simulator/CMakeFiles/lightning_simulator.dir/DependInfo.cmake"
+  "util/CMakeFiles/lightning_utils.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "tests/CMakeFiles/compile_time_tests.dir/DependInfo.cmake"
+  "tests/CMakeFiles/runner.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,68 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/pennylane_lightning/src/tests/CreateAllWires.cpp" "tests/CMakeFiles/runner.dir/CreateAllWires.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/CreateAllWires.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_AdjDiff.cpp" "tests/CMakeFiles/runner.dir/Test_AdjDiff.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_AdjDiff.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_BatchedCircuit.cpp" "tests/CMakeFiles/runner.dir/Test_BatchedCircuit.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_BatchedCircuit.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_CompilerSupport.cpp" "tests/CMakeFiles/runner.dir/Test_CompilerSupport.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_CompilerSupport.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_DynamicDispatcher.cpp" "tests/CMakeFiles/runner.dir/Test_DynamicDispatcher.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_DynamicDispatcher.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_Error.cpp" "tests/CMakeFiles/runner.dir/Test_Error.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_Error.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_GateFusion.cpp" "tests/CMakeFiles/runner.dir/Test_GateFusion.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_GateFusion.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_GateImplementations_CompareKernels.cpp" "tests/CMakeFiles/runner.dir/Test_GateImplementations_CompareKernels.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_GateImplementations_CompareKernels.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_GateImplementations_Generator.cpp" "tests/CMakeFiles/runner.dir/Test_GateImplementations_Generator.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_GateImplementations_Generator.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_GateImplementations_Inverse.cpp" "tests/CMakeFiles/runner.dir/Test_GateImplementations_Inverse.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_GateImplementations_Inverse.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_GateImplementations_Matrix.cpp" "tests/CMakeFiles/runner.dir/Test_GateImplementations_Matrix.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_GateImplementations_Matrix.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_GateImplementations_Nonparam.cpp" "tests/CMakeFiles/runner.dir/Test_GateImplementations_Nonparam.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_GateImplementations_Nonparam.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_GateImplementations_Param.cpp" "tests/CMakeFiles/runner.dir/Test_GateImplementations_Param.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_GateImplementations_Param.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_GateUtil.cpp" "tests/CMakeFiles/runner.dir/Test_GateUtil.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_GateUtil.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_Internal.cpp" "tests/CMakeFiles/runner.dir/Test_Internal.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_Internal.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_KernelMap.cpp" "tests/CMakeFiles/runner.dir/Test_KernelMap.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_KernelMap.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_KernelProfile.cpp" "tests/CMakeFiles/runner.dir/Test_KernelProfile.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_KernelProfile.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_KernelTuner.cpp" "tests/CMakeFiles/runner.dir/Test_KernelTuner.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_KernelTuner.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_Kokkos_Sparse.cpp" "tests/CMakeFiles/runner.dir/Test_Kokkos_Sparse.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_Kokkos_Sparse.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_LinearAlgebra.cpp" "tests/CMakeFiles/runner.dir/Test_LinearAlgebra.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_LinearAlgebra.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_MatrixProductState.cpp" "tests/CMakeFiles/runner.dir/Test_MatrixProductState.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_MatrixProductState.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_Measures.cpp" "tests/CMakeFiles/runner.dir/Test_Measures.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_Measures.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_Measures_Sparse.cpp" "tests/CMakeFiles/runner.dir/Test_Measures_Sparse.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_Measures_Sparse.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_OpToMemberFuncPtr.cpp" "tests/CMakeFiles/runner.dir/Test_OpToMemberFuncPtr.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_OpToMemberFuncPtr.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_ParameterShift.cpp" "tests/CMakeFiles/runner.dir/Test_ParameterShift.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_ParameterShift.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_QuantumTrajectories.cpp" "tests/CMakeFiles/runner.dir/Test_QuantumTrajectories.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_QuantumTrajectories.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_RuntimeInfo.cpp" "tests/CMakeFiles/runner.dir/Test_RuntimeInfo.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_RuntimeInfo.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_SparseLinearAlgebra.cpp" "tests/CMakeFiles/runner.dir/Test_SparseLinearAlgebra.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_SparseLinearAlgebra.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StabilizerTableau.cpp" "tests/CMakeFiles/runner.dir/Test_StabilizerTableau.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StabilizerTableau.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StateVectorBatchMajor.cpp" "tests/CMakeFiles/runner.dir/Test_StateVectorBatchMajor.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StateVectorBatchMajor.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StateVectorCompressedCPU.cpp" "tests/CMakeFiles/runner.dir/Test_StateVectorCompressedCPU.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StateVectorCompressedCPU.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StateVectorFixedWeightCPU.cpp" "tests/CMakeFiles/runner.dir/Test_StateVectorFixedWeightCPU.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StateVectorFixedWeightCPU.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StateVectorIO.cpp" "tests/CMakeFiles/runner.dir/Test_StateVectorIO.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StateVectorIO.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StateVectorKokkos.cpp" "tests/CMakeFiles/runner.dir/Test_StateVectorKokkos.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StateVectorKokkos.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StateVectorManagedCPU.cpp" "tests/CMakeFiles/runner.dir/Test_StateVectorManagedCPU.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StateVectorManagedCPU.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StateVectorOutOfCoreCPU.cpp" "tests/CMakeFiles/runner.dir/Test_StateVectorOutOfCoreCPU.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StateVectorOutOfCoreCPU.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StateVectorRawCPU.cpp" "tests/CMakeFiles/runner.dir/Test_StateVectorRawCPU.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StateVectorRawCPU.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StateVectorSparseCPU.cpp" "tests/CMakeFiles/runner.dir/Test_StateVectorSparseCPU.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StateVectorSparseCPU.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_StateVectorSplitCPU.cpp" "tests/CMakeFiles/runner.dir/Test_StateVectorSplitCPU.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_StateVectorSplitCPU.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_TapeExecutor.cpp" "tests/CMakeFiles/runner.dir/Test_TapeExecutor.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_TapeExecutor.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_Threading.cpp" "tests/CMakeFiles/runner.dir/Test_Threading.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_Threading.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_Trace.cpp" "tests/CMakeFiles/runner.dir/Test_Trace.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_Trace.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_TrotterEvolution.cpp" "tests/CMakeFiles/runner.dir/Test_TrotterEvolution.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_TrotterEvolution.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_Util.cpp" "tests/CMakeFiles/runner.dir/Test_Util.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_Util.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/Test_VectorJacobianProduct.cpp" "tests/CMakeFiles/runner.dir/Test_VectorJacobianProduct.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/Test_VectorJacobianProduct.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/tests/runner_main.cpp" "tests/CMakeFiles/runner.dir/runner_main.cpp.o" "gcc" "tests/CMakeFiles/runner.dir/runner_main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_dispatch/algorithms/CMakeFiles/lightning_algorithms.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_dispatch/simulator/CMakeFiles/lightning_simulator.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_dispatch/gates/CMakeFiles/lightning_gates.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_dispatch/util/CMakeFiles/lightning_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,102 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runner.dir/CreateAllWires.cpp.o"
+  "CMakeFiles/runner.dir/CreateAllWires.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_AdjDiff.cpp.o"
+  "CMakeFiles/runner.dir/Test_AdjDiff.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_BatchedCircuit.cpp.o"
+  "CMakeFiles/runner.dir/Test_BatchedCircuit.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_CompilerSupport.cpp.o"
+  "CMakeFiles/runner.dir/Test_CompilerSupport.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_DynamicDispatcher.cpp.o"
+  "CMakeFiles/runner.dir/Test_DynamicDispatcher.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_Error.cpp.o"
+  "CMakeFiles/runner.dir/Test_Error.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_GateFusion.cpp.o"
+  "CMakeFiles/runner.dir/Test_GateFusion.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_GateImplementations_CompareKernels.cpp.o"
+  "CMakeFiles/runner.dir/Test_GateImplementations_CompareKernels.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_GateImplementations_Generator.cpp.o"
+  "CMakeFiles/runner.dir/Test_GateImplementations_Generator.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_GateImplementations_Inverse.cpp.o"
+  "CMakeFiles/runner.dir/Test_GateImplementations_Inverse.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_GateImplementations_Matrix.cpp.o"
+  "CMakeFiles/runner.dir/Test_GateImplementations_Matrix.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_GateImplementations_Nonparam.cpp.o"
+  "CMakeFiles/runner.dir/Test_GateImplementations_Nonparam.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_GateImplementations_Param.cpp.o"
+  "CMakeFiles/runner.dir/Test_GateImplementations_Param.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_GateUtil.cpp.o"
+  "CMakeFiles/runner.dir/Test_GateUtil.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_Internal.cpp.o"
+  "CMakeFiles/runner.dir/Test_Internal.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_KernelMap.cpp.o"
+  "CMakeFiles/runner.dir/Test_KernelMap.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_KernelProfile.cpp.o"
+  "CMakeFiles/runner.dir/Test_KernelProfile.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_KernelTuner.cpp.o"
+  "CMakeFiles/runner.dir/Test_KernelTuner.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_Kokkos_Sparse.cpp.o"
+  "CMakeFiles/runner.dir/Test_Kokkos_Sparse.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_LinearAlgebra.cpp.o"
+  "CMakeFiles/runner.dir/Test_LinearAlgebra.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_MatrixProductState.cpp.o"
+  "CMakeFiles/runner.dir/Test_MatrixProductState.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_Measures.cpp.o"
+  "CMakeFiles/runner.dir/Test_Measures.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_Measures_Sparse.cpp.o"
+  "CMakeFiles/runner.dir/Test_Measures_Sparse.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_OpToMemberFuncPtr.cpp.o"
+  "CMakeFiles/runner.dir/Test_OpToMemberFuncPtr.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_ParameterShift.cpp.o"
+  "CMakeFiles/runner.dir/Test_ParameterShift.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_QuantumTrajectories.cpp.o"
+  "CMakeFiles/runner.dir/Test_QuantumTrajectories.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_RuntimeInfo.cpp.o"
+  "CMakeFiles/runner.dir/Test_RuntimeInfo.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_SparseLinearAlgebra.cpp.o"
+  "CMakeFiles/runner.dir/Test_SparseLinearAlgebra.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StabilizerTableau.cpp.o"
+  "CMakeFiles/runner.dir/Test_StabilizerTableau.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StateVectorBatchMajor.cpp.o"
+  "CMakeFiles/runner.dir/Test_StateVectorBatchMajor.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StateVectorCompressedCPU.cpp.o"
+  "CMakeFiles/runner.dir/Test_StateVectorCompressedCPU.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StateVectorFixedWeightCPU.cpp.o"
+  "CMakeFiles/runner.dir/Test_StateVectorFixedWeightCPU.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StateVectorIO.cpp.o"
+  "CMakeFiles/runner.dir/Test_StateVectorIO.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StateVectorKokkos.cpp.o"
+  "CMakeFiles/runner.dir/Test_StateVectorKokkos.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StateVectorManagedCPU.cpp.o"
+  "CMakeFiles/runner.dir/Test_StateVectorManagedCPU.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StateVectorOutOfCoreCPU.cpp.o"
+  "CMakeFiles/runner.dir/Test_StateVectorOutOfCoreCPU.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StateVectorRawCPU.cpp.o"
+  "CMakeFiles/runner.dir/Test_StateVectorRawCPU.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StateVectorSparseCPU.cpp.o"
+  "CMakeFiles/runner.dir/Test_StateVectorSparseCPU.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_StateVectorSplitCPU.cpp.o"
+  "CMakeFiles/runner.dir/Test_StateVectorSplitCPU.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_TapeExecutor.cpp.o"
+  "CMakeFiles/runner.dir/Test_TapeExecutor.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_Threading.cpp.o"
+  "CMakeFiles/runner.dir/Test_Threading.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_Trace.cpp.o"
+  "CMakeFiles/runner.dir/Test_Trace.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_TrotterEvolution.cpp.o"
+  "CMakeFiles/runner.dir/Test_TrotterEvolution.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_Util.cpp.o"
+  "CMakeFiles/runner.dir/Test_Util.cpp.o.d"
+  "CMakeFiles/runner.dir/Test_VectorJacobianProduct.cpp.o"
+  "CMakeFiles/runner.dir/Test_VectorJacobianProduct.cpp.o.d"
+  "CMakeFiles/runner.dir/runner_main.cpp.o"
+  "CMakeFiles/runner.dir/runner_main.cpp.o.d"
+  "runner"
+  "runner.pdb"
+  "runner_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
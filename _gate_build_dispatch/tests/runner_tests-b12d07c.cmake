@@ -0,0 +1,749 @@
+add_test( [==[AdjointJacobian::AdjointJacobian - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::AdjointJacobian - float]==]  )
+set_tests_properties( [==[AdjointJacobian::AdjointJacobian - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::AdjointJacobian - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::AdjointJacobian - double]==]  )
+set_tests_properties( [==[AdjointJacobian::AdjointJacobian - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[CompiledOps::apply - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[CompiledOps::apply - float]==]  )
+set_tests_properties( [==[CompiledOps::apply - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[CompiledOps::apply - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[CompiledOps::apply - double]==]  )
+set_tests_properties( [==[CompiledOps::apply - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=RX, Obs=Z]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=RX\, Obs=Z]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=RX, Obs=Z]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=RY, Obs=X]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=RY\, Obs=X]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=RY, Obs=X]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=RX, Obs=[Z,Z]]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=RX\, Obs=\[Z\,Z\]]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=RX, Obs=[Z,Z]]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=[RX,RX,RX], Obs=[Z,Z,Z]]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=\[RX\,RX\,RX\]\, Obs=\[Z\,Z\,Z\]]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=[RX,RX,RX], Obs=[Z,Z,Z]]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=[RX,RX,RX], Obs=[Z,Z,Z], TParams=[0,2]]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=\[RX\,RX\,RX\]\, Obs=\[Z\,Z\,Z\]\, TParams=\[0\,2\]]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=[RX,RX,RX], Obs=[Z,Z,Z], TParams=[0,2]]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=[RX,RX,RX], Obs=[ZZZ]]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=\[RX\,RX\,RX\]\, Obs=\[ZZZ\]]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=[RX,RX,RX], Obs=[ZZZ]]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=Mixed, Obs=[XXX]]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=Mixed\, Obs=\[XXX\]]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=Mixed, Obs=[XXX]]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Decomposed Rot gate, non computational basis state]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Decomposed Rot gate\, non computational basis state]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Decomposed Rot gate, non computational basis state]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Rot and CRot gates - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Rot and CRot gates - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Rot and CRot gates - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Rot and CRot gates - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Rot and CRot gates - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Rot and CRot gates - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian matrix operations - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian matrix operations - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian matrix operations - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian matrix operations - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian matrix operations - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian matrix operations - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Mixed Ops, Obs and TParams]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Mixed Ops\, Obs and TParams]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Mixed Ops, Obs and TParams]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=CostLayer - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=CostLayer - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=CostLayer - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=CostLayer - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=CostLayer - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=CostLayer - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=PauliRot - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=PauliRot - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=PauliRot - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Op=PauliRot - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Op=PauliRot - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Op=PauliRot - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::applyObservable visitor checks]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::applyObservable visitor checks]==]  )
+set_tests_properties( [==[AdjointJacobian::applyObservable visitor checks]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::applyObservable fused tensor products - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::applyObservable fused tensor products - float]==]  )
+set_tests_properties( [==[AdjointJacobian::applyObservable fused tensor products - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::applyObservable fused tensor products - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::applyObservable fused tensor products - double]==]  )
+set_tests_properties( [==[AdjointJacobian::applyObservable fused tensor products - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Obs=PauliSum - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Obs=PauliSum - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Obs=PauliSum - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Obs=PauliSum - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Obs=PauliSum - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Obs=PauliSum - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Obs=SparseHamiltonian - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Obs=SparseHamiltonian - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Obs=SparseHamiltonian - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian Obs=SparseHamiltonian - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian Obs=SparseHamiltonian - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian Obs=SparseHamiltonian - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian with a memory budget - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian with a memory budget - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian with a memory budget - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian with a memory budget - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian with a memory budget - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian with a memory budget - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian with a forward state - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian with a forward state - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian with a forward state - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian with a forward state - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian with a forward state - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian with a forward state - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian with checkpoints - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian with checkpoints - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian with checkpoints - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian with checkpoints - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian with checkpoints - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian with checkpoints - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian with a buffer pool - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian with a buffer pool - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian with a buffer pool - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian with a buffer pool - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian with a buffer pool - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian with a buffer pool - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::computeExpvals - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::computeExpvals - float]==]  )
+set_tests_properties( [==[AdjointJacobian::computeExpvals - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::computeExpvals - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::computeExpvals - double]==]  )
+set_tests_properties( [==[AdjointJacobian::computeExpvals - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::execute - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::execute - float]==]  )
+set_tests_properties( [==[AdjointJacobian::execute - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::execute - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::execute - double]==]  )
+set_tests_properties( [==[AdjointJacobian::execute - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian parallelism - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian parallelism - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian parallelism - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointJacobian parallelism - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointJacobian parallelism - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointJacobian parallelism - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointVJP - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointVJP - float]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointVJP - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::adjointVJP - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::adjointVJP - double]==]  )
+set_tests_properties( [==[AdjointJacobian::adjointVJP - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::hessianVectorProduct - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::hessianVectorProduct - float]==]  )
+set_tests_properties( [==[AdjointJacobian::hessianVectorProduct - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::hessianVectorProduct - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::hessianVectorProduct - double]==]  )
+set_tests_properties( [==[AdjointJacobian::hessianVectorProduct - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::metricTensor - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::metricTensor - float]==]  )
+set_tests_properties( [==[AdjointJacobian::metricTensor - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobian::metricTensor - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobian::metricTensor - double]==]  )
+set_tests_properties( [==[AdjointJacobian::metricTensor - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[BatchedCircuit::BatchedCircuit - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[BatchedCircuit::BatchedCircuit - float]==]  )
+set_tests_properties( [==[BatchedCircuit::BatchedCircuit - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[BatchedCircuit::BatchedCircuit - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[BatchedCircuit::BatchedCircuit - double]==]  )
+set_tests_properties( [==[BatchedCircuit::BatchedCircuit - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[BatchedCircuit::execute - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[BatchedCircuit::execute - float]==]  )
+set_tests_properties( [==[BatchedCircuit::execute - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[BatchedCircuit::execute - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[BatchedCircuit::execute - double]==]  )
+set_tests_properties( [==[BatchedCircuit::execute - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test exception in a constexpr constructor]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test exception in a constexpr constructor]==]  )
+set_tests_properties( [==[Test exception in a constexpr constructor]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test assert in a constexpr function]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test assert in a constexpr function]==]  )
+set_tests_properties( [==[Test assert in a constexpr function]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::applyOperation - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::applyOperation - float]==]  )
+set_tests_properties( [==[DynamicDispatcher::applyOperation - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::applyOperation - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::applyOperation - double]==]  )
+set_tests_properties( [==[DynamicDispatcher::applyOperation - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::SIMD kernels - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::SIMD kernels - float]==]  )
+set_tests_properties( [==[DynamicDispatcher::SIMD kernels - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::SIMD kernels - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::SIMD kernels - double]==]  )
+set_tests_properties( [==[DynamicDispatcher::SIMD kernels - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::applyOperationBatch - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::applyOperationBatch - float]==]  )
+set_tests_properties( [==[DynamicDispatcher::applyOperationBatch - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::applyOperationBatch - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::applyOperationBatch - double]==]  )
+set_tests_properties( [==[DynamicDispatcher::applyOperationBatch - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::getGateFunc - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::getGateFunc - float]==]  )
+set_tests_properties( [==[DynamicDispatcher::getGateFunc - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::getGateFunc - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::getGateFunc - double]==]  )
+set_tests_properties( [==[DynamicDispatcher::getGateFunc - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::strToGateOp - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::strToGateOp - float]==]  )
+set_tests_properties( [==[DynamicDispatcher::strToGateOp - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::strToGateOp - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::strToGateOp - double]==]  )
+set_tests_properties( [==[DynamicDispatcher::strToGateOp - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::applyGenerator - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::applyGenerator - float]==]  )
+set_tests_properties( [==[DynamicDispatcher::applyGenerator - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::applyGenerator - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::applyGenerator - double]==]  )
+set_tests_properties( [==[DynamicDispatcher::applyGenerator - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::applyMatrix - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::applyMatrix - float]==]  )
+set_tests_properties( [==[DynamicDispatcher::applyMatrix - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher::applyMatrix - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher::applyMatrix - double]==]  )
+set_tests_properties( [==[DynamicDispatcher::applyMatrix - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher profiling - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher profiling - float]==]  )
+set_tests_properties( [==[DynamicDispatcher profiling - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[DynamicDispatcher profiling - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[DynamicDispatcher profiling - double]==]  )
+set_tests_properties( [==[DynamicDispatcher profiling - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( Error.hpp /root/repo/_gate_build_dispatch/tests/runner Error.hpp  )
+set_tests_properties( Error.hpp PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( partitionForFusion /root/repo/_gate_build_dispatch/tests/runner partitionForFusion  )
+set_tests_properties( partitionForFusion PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( partitionIntoLayers /root/repo/_gate_build_dispatch/tests/runner partitionIntoLayers  )
+set_tests_properties( partitionIntoLayers PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( partitionForProducts /root/repo/_gate_build_dispatch/tests/runner partitionForProducts  )
+set_tests_properties( partitionForProducts PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( getFusedMatrix /root/repo/_gate_build_dispatch/tests/runner getFusedMatrix  )
+set_tests_properties( getFusedMatrix PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( getFusedDiagonal /root/repo/_gate_build_dispatch/tests/runner getFusedDiagonal  )
+set_tests_properties( getFusedDiagonal PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVector::applyOperations with gate fusion - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVector::applyOperations with gate fusion - float]==]  )
+set_tests_properties( [==[StateVector::applyOperations with gate fusion - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVector::applyOperations with gate fusion - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVector::applyOperations with gate fusion - double]==]  )
+set_tests_properties( [==[StateVector::applyOperations with gate fusion - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVector::applyOperations with layer scheduling - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVector::applyOperations with layer scheduling - float]==]  )
+set_tests_properties( [==[StateVector::applyOperations with layer scheduling - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVector::applyOperations with layer scheduling - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVector::applyOperations with layer scheduling - double]==]  )
+set_tests_properties( [==[StateVector::applyOperations with layer scheduling - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test all kernels give the same results for gates - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test all kernels give the same results for gates - float]==]  )
+set_tests_properties( [==[Test all kernels give the same results for gates - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test all kernels give the same results for gates - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test all kernels give the same results for gates - double]==]  )
+set_tests_properties( [==[Test all kernels give the same results for gates - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test all kernels give the same results for matrices - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test all kernels give the same results for matrices - float]==]  )
+set_tests_properties( [==[Test all kernels give the same results for matrices - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test all kernels give the same results for matrices - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test all kernels give the same results for matrices - double]==]  )
+set_tests_properties( [==[Test all kernels give the same results for matrices - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test all generators of all kernels - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test all generators of all kernels - float]==]  )
+set_tests_properties( [==[Test all generators of all kernels - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test all generators of all kernels - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test all generators of all kernels - double]==]  )
+set_tests_properties( [==[Test all generators of all kernels - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[pauliGeneratorOverlap matches the generator kernels - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[pauliGeneratorOverlap matches the generator kernels - float]==]  )
+set_tests_properties( [==[pauliGeneratorOverlap matches the generator kernels - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[pauliGeneratorOverlap matches the generator kernels - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[pauliGeneratorOverlap matches the generator kernels - double]==]  )
+set_tests_properties( [==[pauliGeneratorOverlap matches the generator kernels - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test inverse of gate implementations - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test inverse of gate implementations - float]==]  )
+set_tests_properties( [==[Test inverse of gate implementations - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test inverse of gate implementations - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test inverse of gate implementations - double]==]  )
+set_tests_properties( [==[Test inverse of gate implementations - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyMatrix, inverse = false - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyMatrix\, inverse = false - float]==]  )
+set_tests_properties( [==[GateImplementation::applyMatrix, inverse = false - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyMatrix, inverse = false - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyMatrix\, inverse = false - double]==]  )
+set_tests_properties( [==[GateImplementation::applyMatrix, inverse = false - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyMatrix, inverse = true - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyMatrix\, inverse = true - float]==]  )
+set_tests_properties( [==[GateImplementation::applyMatrix, inverse = true - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyMatrix, inverse = true - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyMatrix\, inverse = true - double]==]  )
+set_tests_properties( [==[GateImplementation::applyMatrix, inverse = true - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementationsLM::applyControlledMatrix - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementationsLM::applyControlledMatrix - float]==]  )
+set_tests_properties( [==[GateImplementationsLM::applyControlledMatrix - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementationsLM::applyControlledMatrix - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementationsLM::applyControlledMatrix - double]==]  )
+set_tests_properties( [==[GateImplementationsLM::applyControlledMatrix - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementationsLM::applyDiagonal - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementationsLM::applyDiagonal - float]==]  )
+set_tests_properties( [==[GateImplementationsLM::applyDiagonal - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementationsLM::applyDiagonal - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementationsLM::applyDiagonal - double]==]  )
+set_tests_properties( [==[GateImplementationsLM::applyDiagonal - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyIdentity - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyIdentity - float]==]  )
+set_tests_properties( [==[GateImplementation::applyIdentity - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyIdentity - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyIdentity - double]==]  )
+set_tests_properties( [==[GateImplementation::applyIdentity - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyPauliX - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyPauliX - float]==]  )
+set_tests_properties( [==[GateImplementation::applyPauliX - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyPauliX - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyPauliX - double]==]  )
+set_tests_properties( [==[GateImplementation::applyPauliX - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyPauliY - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyPauliY - float]==]  )
+set_tests_properties( [==[GateImplementation::applyPauliY - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyPauliY - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyPauliY - double]==]  )
+set_tests_properties( [==[GateImplementation::applyPauliY - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyPauliZ - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyPauliZ - float]==]  )
+set_tests_properties( [==[GateImplementation::applyPauliZ - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyPauliZ - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyPauliZ - double]==]  )
+set_tests_properties( [==[GateImplementation::applyPauliZ - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyHadamard - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyHadamard - float]==]  )
+set_tests_properties( [==[GateImplementation::applyHadamard - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyHadamard - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyHadamard - double]==]  )
+set_tests_properties( [==[GateImplementation::applyHadamard - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyS - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyS - float]==]  )
+set_tests_properties( [==[GateImplementation::applyS - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyS - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyS - double]==]  )
+set_tests_properties( [==[GateImplementation::applyS - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyT - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyT - float]==]  )
+set_tests_properties( [==[GateImplementation::applyT - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyT - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyT - double]==]  )
+set_tests_properties( [==[GateImplementation::applyT - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCNOT - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCNOT - float]==]  )
+set_tests_properties( [==[GateImplementation::applyCNOT - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCNOT - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCNOT - double]==]  )
+set_tests_properties( [==[GateImplementation::applyCNOT - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCY - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCY - float]==]  )
+set_tests_properties( [==[GateImplementation::applyCY - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCY - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCY - double]==]  )
+set_tests_properties( [==[GateImplementation::applyCY - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCZ - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCZ - float]==]  )
+set_tests_properties( [==[GateImplementation::applyCZ - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCZ - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCZ - double]==]  )
+set_tests_properties( [==[GateImplementation::applyCZ - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applySWAP - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applySWAP - float]==]  )
+set_tests_properties( [==[GateImplementation::applySWAP - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applySWAP - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applySWAP - double]==]  )
+set_tests_properties( [==[GateImplementation::applySWAP - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyToffoli - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyToffoli - float]==]  )
+set_tests_properties( [==[GateImplementation::applyToffoli - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyToffoli - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyToffoli - double]==]  )
+set_tests_properties( [==[GateImplementation::applyToffoli - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCSWAP - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCSWAP - float]==]  )
+set_tests_properties( [==[GateImplementation::applyCSWAP - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCSWAP - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCSWAP - double]==]  )
+set_tests_properties( [==[GateImplementation::applyCSWAP - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyPhaseShift - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyPhaseShift - float]==]  )
+set_tests_properties( [==[GateImplementation::applyPhaseShift - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyPhaseShift - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyPhaseShift - double]==]  )
+set_tests_properties( [==[GateImplementation::applyPhaseShift - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyRX - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyRX - float]==]  )
+set_tests_properties( [==[GateImplementation::applyRX - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyRX - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyRX - double]==]  )
+set_tests_properties( [==[GateImplementation::applyRX - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyRY - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyRY - float]==]  )
+set_tests_properties( [==[GateImplementation::applyRY - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyRY - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyRY - double]==]  )
+set_tests_properties( [==[GateImplementation::applyRY - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyRZ - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyRZ - float]==]  )
+set_tests_properties( [==[GateImplementation::applyRZ - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyRZ - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyRZ - double]==]  )
+set_tests_properties( [==[GateImplementation::applyRZ - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyRot - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyRot - float]==]  )
+set_tests_properties( [==[GateImplementation::applyRot - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyRot - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyRot - double]==]  )
+set_tests_properties( [==[GateImplementation::applyRot - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyIsingXX - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyIsingXX - float]==]  )
+set_tests_properties( [==[GateImplementation::applyIsingXX - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyIsingXX - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyIsingXX - double]==]  )
+set_tests_properties( [==[GateImplementation::applyIsingXX - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyIsingXY - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyIsingXY - float]==]  )
+set_tests_properties( [==[GateImplementation::applyIsingXY - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyIsingXY - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyIsingXY - double]==]  )
+set_tests_properties( [==[GateImplementation::applyIsingXY - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyIsingYY - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyIsingYY - float]==]  )
+set_tests_properties( [==[GateImplementation::applyIsingYY - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyIsingYY - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyIsingYY - double]==]  )
+set_tests_properties( [==[GateImplementation::applyIsingYY - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyIsingZZ - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyIsingZZ - float]==]  )
+set_tests_properties( [==[GateImplementation::applyIsingZZ - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyIsingZZ - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyIsingZZ - double]==]  )
+set_tests_properties( [==[GateImplementation::applyIsingZZ - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyControlledPhaseShift - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyControlledPhaseShift - float]==]  )
+set_tests_properties( [==[GateImplementation::applyControlledPhaseShift - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyControlledPhaseShift - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyControlledPhaseShift - double]==]  )
+set_tests_properties( [==[GateImplementation::applyControlledPhaseShift - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCRX - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCRX - float]==]  )
+set_tests_properties( [==[GateImplementation::applyCRX - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCRX - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCRX - double]==]  )
+set_tests_properties( [==[GateImplementation::applyCRX - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCRY - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCRY - float]==]  )
+set_tests_properties( [==[GateImplementation::applyCRY - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCRY - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCRY - double]==]  )
+set_tests_properties( [==[GateImplementation::applyCRY - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCRZ - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCRZ - float]==]  )
+set_tests_properties( [==[GateImplementation::applyCRZ - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCRZ - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCRZ - double]==]  )
+set_tests_properties( [==[GateImplementation::applyCRZ - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCRot - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCRot - float]==]  )
+set_tests_properties( [==[GateImplementation::applyCRot - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyCRot - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyCRot - double]==]  )
+set_tests_properties( [==[GateImplementation::applyCRot - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applySingleExcitation - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applySingleExcitation - float]==]  )
+set_tests_properties( [==[GateImplementation::applySingleExcitation - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applySingleExcitation - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applySingleExcitation - double]==]  )
+set_tests_properties( [==[GateImplementation::applySingleExcitation - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applySingleExcitationMinus - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applySingleExcitationMinus - float]==]  )
+set_tests_properties( [==[GateImplementation::applySingleExcitationMinus - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applySingleExcitationMinus - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applySingleExcitationMinus - double]==]  )
+set_tests_properties( [==[GateImplementation::applySingleExcitationMinus - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applySingleExcitationPlus - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applySingleExcitationPlus - float]==]  )
+set_tests_properties( [==[GateImplementation::applySingleExcitationPlus - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applySingleExcitationPlus - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applySingleExcitationPlus - double]==]  )
+set_tests_properties( [==[GateImplementation::applySingleExcitationPlus - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyDoubleExcitation - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyDoubleExcitation - float]==]  )
+set_tests_properties( [==[GateImplementation::applyDoubleExcitation - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyDoubleExcitation - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyDoubleExcitation - double]==]  )
+set_tests_properties( [==[GateImplementation::applyDoubleExcitation - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyDoubleExcitationMinus - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyDoubleExcitationMinus - float]==]  )
+set_tests_properties( [==[GateImplementation::applyDoubleExcitationMinus - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyDoubleExcitationMinus - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyDoubleExcitationMinus - double]==]  )
+set_tests_properties( [==[GateImplementation::applyDoubleExcitationMinus - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyDoubleExcitationPlus - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyDoubleExcitationPlus - float]==]  )
+set_tests_properties( [==[GateImplementation::applyDoubleExcitationPlus - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyDoubleExcitationPlus - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyDoubleExcitationPlus - double]==]  )
+set_tests_properties( [==[GateImplementation::applyDoubleExcitationPlus - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyMultiRZ - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyMultiRZ - float]==]  )
+set_tests_properties( [==[GateImplementation::applyMultiRZ - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateImplementation::applyMultiRZ - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateImplementation::applyMultiRZ - double]==]  )
+set_tests_properties( [==[GateImplementation::applyMultiRZ - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( generateBitPatterns /root/repo/_gate_build_dispatch/tests/runner generateBitPatterns  )
+set_tests_properties( generateBitPatterns PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( getIndicesAfterExclusion /root/repo/_gate_build_dispatch/tests/runner getIndicesAfterExclusion  )
+set_tests_properties( getIndicesAfterExclusion PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( ExternalIndices /root/repo/_gate_build_dispatch/tests/runner ExternalIndices  )
+set_tests_properties( ExternalIndices PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( cachedGateIndices /root/repo/_gate_build_dispatch/tests/runner cachedGateIndices  )
+set_tests_properties( cachedGateIndices PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( implementedGatesForKernel /root/repo/_gate_build_dispatch/tests/runner implementedGatesForKernel  )
+set_tests_properties( implementedGatesForKernel PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Approx - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Approx - float]==]  )
+set_tests_properties( [==[Approx - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Approx - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Approx - double]==]  )
+set_tests_properties( [==[Approx - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[createProductState - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[createProductState - float]==]  )
+set_tests_properties( [==[createProductState - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[createProductState - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[createProductState - double]==]  )
+set_tests_properties( [==[createProductState - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( createAllWires /root/repo/_gate_build_dispatch/tests/runner createAllWires  )
+set_tests_properties( createAllWires PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test PriorityDispatchSet]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test PriorityDispatchSet]==]  )
+set_tests_properties( [==[Test PriorityDispatchSet]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test default kernels for gates are well defined]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test default kernels for gates are well defined]==]  )
+set_tests_properties( [==[Test default kernels for gates are well defined]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test default kernels for generators are well defined]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test default kernels for generators are well defined]==]  )
+set_tests_properties( [==[Test default kernels for generators are well defined]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test default kernels for matrix operation are well defined]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test default kernels for matrix operation are well defined]==]  )
+set_tests_properties( [==[Test default kernels for matrix operation are well defined]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test unallowed kernel]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test unallowed kernel]==]  )
+set_tests_properties( [==[Test unallowed kernel]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test several limiting cases of default kernels]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test several limiting cases of default kernels]==]  )
+set_tests_properties( [==[Test several limiting cases of default kernels]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test default kernels for aligned memory models]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test default kernels for aligned memory models]==]  )
+set_tests_properties( [==[Test default kernels for aligned memory models]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test KernelMap functionalities]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test KernelMap functionalities]==]  )
+set_tests_properties( [==[Test KernelMap functionalities]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test concurrent KernelMap lookups]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test concurrent KernelMap lookups]==]  )
+set_tests_properties( [==[Test concurrent KernelMap lookups]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( readKernelProfile /root/repo/_gate_build_dispatch/tests/runner readKernelProfile  )
+set_tests_properties( readKernelProfile PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( filterAvailableKernels /root/repo/_gate_build_dispatch/tests/runner filterAvailableKernels  )
+set_tests_properties( filterAvailableKernels PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( loadKernelProfile /root/repo/_gate_build_dispatch/tests/runner loadKernelProfile  )
+set_tests_properties( loadKernelProfile PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( KernelTuner::tune /root/repo/_gate_build_dispatch/tests/runner KernelTuner::tune  )
+set_tests_properties( KernelTuner::tune PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( KernelTuner::timeKernel /root/repo/_gate_build_dispatch/tests/runner KernelTuner::timeKernel  )
+set_tests_properties( KernelTuner::timeKernel PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Assign, write, and read tuned kernels]==] /root/repo/_gate_build_dispatch/tests/runner [==[Assign\, write\, and read tuned kernels]==]  )
+set_tests_properties( [==[Assign, write, and read tuned kernels]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test linear algebra functions - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test linear algebra functions - float]==]  )
+set_tests_properties( [==[Test linear algebra functions - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test linear algebra functions - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test linear algebra functions - double]==]  )
+set_tests_properties( [==[Test linear algebra functions - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Util::svd - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Util::svd - float]==]  )
+set_tests_properties( [==[Util::svd - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Util::svd - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Util::svd - double]==]  )
+set_tests_properties( [==[Util::svd - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Reductions over single precision data accumulate in double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Reductions over single precision data accumulate in double]==]  )
+set_tests_properties( [==[Reductions over single precision data accumulate in double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[MatrixProductState::applyOperations - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[MatrixProductState::applyOperations - float]==]  )
+set_tests_properties( [==[MatrixProductState::applyOperations - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[MatrixProductState::applyOperations - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[MatrixProductState::applyOperations - double]==]  )
+set_tests_properties( [==[MatrixProductState::applyOperations - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[MatrixProductState::truncation - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[MatrixProductState::truncation - float]==]  )
+set_tests_properties( [==[MatrixProductState::truncation - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[MatrixProductState::truncation - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[MatrixProductState::truncation - double]==]  )
+set_tests_properties( [==[MatrixProductState::truncation - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( Probabilities /root/repo/_gate_build_dispatch/tests/runner Probabilities  )
+set_tests_properties( Probabilities PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Probabilities for a subset of wires - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Probabilities for a subset of wires - float]==]  )
+set_tests_properties( [==[Probabilities for a subset of wires - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Probabilities for a subset of wires - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Probabilities for a subset of wires - double]==]  )
+set_tests_properties( [==[Probabilities for a subset of wires - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Expected Values - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Expected Values - float]==]  )
+set_tests_properties( [==[Expected Values - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Expected Values - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Expected Values - double]==]  )
+set_tests_properties( [==[Expected Values - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Expected Values without copying the statevector - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Expected Values without copying the statevector - float]==]  )
+set_tests_properties( [==[Expected Values without copying the statevector - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Expected Values without copying the statevector - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Expected Values without copying the statevector - double]==]  )
+set_tests_properties( [==[Expected Values without copying the statevector - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Expected value of a PauliSum - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Expected value of a PauliSum - float]==]  )
+set_tests_properties( [==[Expected value of a PauliSum - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Expected value of a PauliSum - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Expected value of a PauliSum - double]==]  )
+set_tests_properties( [==[Expected value of a PauliSum - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Qubit-wise commuting groups - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Qubit-wise commuting groups - float]==]  )
+set_tests_properties( [==[Qubit-wise commuting groups - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Qubit-wise commuting groups - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Qubit-wise commuting groups - double]==]  )
+set_tests_properties( [==[Qubit-wise commuting groups - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Sample - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Sample - float]==]  )
+set_tests_properties( [==[Sample - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Sample - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Sample - double]==]  )
+set_tests_properties( [==[Sample - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Sample with a seed - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Sample with a seed - float]==]  )
+set_tests_properties( [==[Sample with a seed - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Sample with a seed - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Sample with a seed - double]==]  )
+set_tests_properties( [==[Sample with a seed - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Sample indices and counts - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Sample indices and counts - float]==]  )
+set_tests_properties( [==[Sample indices and counts - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Sample indices and counts - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Sample indices and counts - double]==]  )
+set_tests_properties( [==[Sample indices and counts - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Packed samples of a subset of wires - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Packed samples of a subset of wires - float]==]  )
+set_tests_properties( [==[Packed samples of a subset of wires - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Packed samples of a subset of wires - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Packed samples of a subset of wires - double]==]  )
+set_tests_properties( [==[Packed samples of a subset of wires - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Classical shadow samples - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Classical shadow samples - float]==]  )
+set_tests_properties( [==[Classical shadow samples - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Classical shadow samples - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Classical shadow samples - double]==]  )
+set_tests_properties( [==[Classical shadow samples - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Cached probabilities - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Cached probabilities - float]==]  )
+set_tests_properties( [==[Cached probabilities - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Cached probabilities - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Cached probabilities - double]==]  )
+set_tests_properties( [==[Cached probabilities - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Variances - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Variances - float]==]  )
+set_tests_properties( [==[Variances - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Variances - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Variances - double]==]  )
+set_tests_properties( [==[Variances - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Fused expected values and variances - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Fused expected values and variances - float]==]  )
+set_tests_properties( [==[Fused expected values and variances - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Fused expected values and variances - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Fused expected values and variances - double]==]  )
+set_tests_properties( [==[Fused expected values and variances - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Diagonal observables - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Diagonal observables - float]==]  )
+set_tests_properties( [==[Diagonal observables - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Diagonal observables - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Diagonal observables - double]==]  )
+set_tests_properties( [==[Diagonal observables - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Z correlators - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Z correlators - float]==]  )
+set_tests_properties( [==[Z correlators - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Z correlators - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Z correlators - double]==]  )
+set_tests_properties( [==[Z correlators - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Reduced density matrices - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Reduced density matrices - float]==]  )
+set_tests_properties( [==[Reduced density matrices - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Reduced density matrices - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Reduced density matrices - double]==]  )
+set_tests_properties( [==[Reduced density matrices - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Measurements on relabelled wires - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Measurements on relabelled wires - float]==]  )
+set_tests_properties( [==[Measurements on relabelled wires - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Measurements on relabelled wires - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Measurements on relabelled wires - double]==]  )
+set_tests_properties( [==[Measurements on relabelled wires - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[apply_Sparse_Matrix_Kokkos - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[apply_Sparse_Matrix_Kokkos - float]==]  )
+set_tests_properties( [==[apply_Sparse_Matrix_Kokkos - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[apply_Sparse_Matrix_Kokkos - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[apply_Sparse_Matrix_Kokkos - double]==]  )
+set_tests_properties( [==[apply_Sparse_Matrix_Kokkos - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[apply_Sparse_Matrix - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[apply_Sparse_Matrix - float]==]  )
+set_tests_properties( [==[apply_Sparse_Matrix - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[apply_Sparse_Matrix - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[apply_Sparse_Matrix - double]==]  )
+set_tests_properties( [==[apply_Sparse_Matrix - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Expected Values - Sparse Hamiltonian - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Expected Values - Sparse Hamiltonian - float]==]  )
+set_tests_properties( [==[Expected Values - Sparse Hamiltonian - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Expected Values - Sparse Hamiltonian - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Expected Values - Sparse Hamiltonian - double]==]  )
+set_tests_properties( [==[Expected Values - Sparse Hamiltonian - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateOpToMemberFuncPtr - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateOpToMemberFuncPtr - float]==]  )
+set_tests_properties( [==[GateOpToMemberFuncPtr - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GateOpToMemberFuncPtr - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GateOpToMemberFuncPtr - double]==]  )
+set_tests_properties( [==[GateOpToMemberFuncPtr - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GeneratorOpToMemberFuncPtr - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[GeneratorOpToMemberFuncPtr - float]==]  )
+set_tests_properties( [==[GeneratorOpToMemberFuncPtr - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[GeneratorOpToMemberFuncPtr - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[GeneratorOpToMemberFuncPtr - double]==]  )
+set_tests_properties( [==[GeneratorOpToMemberFuncPtr - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[ParameterShift::parameterShift - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[ParameterShift::parameterShift - float]==]  )
+set_tests_properties( [==[ParameterShift::parameterShift - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[ParameterShift::parameterShift - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[ParameterShift::parameterShift - double]==]  )
+set_tests_properties( [==[ParameterShift::parameterShift - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[ParameterShift::parameterShift without adjoint support - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[ParameterShift::parameterShift without adjoint support - float]==]  )
+set_tests_properties( [==[ParameterShift::parameterShift without adjoint support - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[ParameterShift::parameterShift without adjoint support - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[ParameterShift::parameterShift without adjoint support - double]==]  )
+set_tests_properties( [==[ParameterShift::parameterShift without adjoint support - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[ParameterShift::parameterShift errors - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[ParameterShift::parameterShift errors - float]==]  )
+set_tests_properties( [==[ParameterShift::parameterShift errors - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[ParameterShift::parameterShift errors - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[ParameterShift::parameterShift errors - double]==]  )
+set_tests_properties( [==[ParameterShift::parameterShift errors - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[KrausChannel::branchProbs - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[KrausChannel::branchProbs - float]==]  )
+set_tests_properties( [==[KrausChannel::branchProbs - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[KrausChannel::branchProbs - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[KrausChannel::branchProbs - double]==]  )
+set_tests_properties( [==[KrausChannel::branchProbs - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[QuantumTrajectories::execute - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[QuantumTrajectories::execute - float]==]  )
+set_tests_properties( [==[QuantumTrajectories::execute - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[QuantumTrajectories::execute - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[QuantumTrajectories::execute - double]==]  )
+set_tests_properties( [==[QuantumTrajectories::execute - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Runtime information is correct]==] /root/repo/_gate_build_dispatch/tests/runner [==[Runtime information is correct]==]  )
+set_tests_properties( [==[Runtime information is correct]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[apply_Sparse_Matrix_CSR - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[apply_Sparse_Matrix_CSR - float]==]  )
+set_tests_properties( [==[apply_Sparse_Matrix_CSR - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[apply_Sparse_Matrix_CSR - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[apply_Sparse_Matrix_CSR - double]==]  )
+set_tests_properties( [==[apply_Sparse_Matrix_CSR - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StabilizerTableau::writeState - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StabilizerTableau::writeState - float]==]  )
+set_tests_properties( [==[StabilizerTableau::writeState - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StabilizerTableau::writeState - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StabilizerTableau::writeState - double]==]  )
+set_tests_properties( [==[StabilizerTableau::writeState - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StabilizerTableau::GHZ state of many qubits]==] /root/repo/_gate_build_dispatch/tests/runner [==[StabilizerTableau::GHZ state of many qubits]==]  )
+set_tests_properties( [==[StabilizerTableau::GHZ state of many qubits]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StabilizerTableau::invalid arguments]==] /root/repo/_gate_build_dispatch/tests/runner [==[StabilizerTableau::invalid arguments]==]  )
+set_tests_properties( [==[StabilizerTableau::invalid arguments]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::Clifford prefix - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::Clifford prefix - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::Clifford prefix - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::Clifford prefix - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::Clifford prefix - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::Clifford prefix - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorBatchMajor::applyOperation - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorBatchMajor::applyOperation - float]==]  )
+set_tests_properties( [==[StateVectorBatchMajor::applyOperation - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorBatchMajor::applyOperation - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorBatchMajor::applyOperation - double]==]  )
+set_tests_properties( [==[StateVectorBatchMajor::applyOperation - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorBatchMajor::Data - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorBatchMajor::Data - float]==]  )
+set_tests_properties( [==[StateVectorBatchMajor::Data - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorBatchMajor::Data - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorBatchMajor::Data - double]==]  )
+set_tests_properties( [==[StateVectorBatchMajor::Data - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorCompressedCPU::applyOperations - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorCompressedCPU::applyOperations - float]==]  )
+set_tests_properties( [==[StateVectorCompressedCPU::applyOperations - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorCompressedCPU::applyOperations - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorCompressedCPU::applyOperations - double]==]  )
+set_tests_properties( [==[StateVectorCompressedCPU::applyOperations - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorCompressedCPU compression - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorCompressedCPU compression - float]==]  )
+set_tests_properties( [==[StateVectorCompressedCPU compression - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorCompressedCPU compression - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorCompressedCPU compression - double]==]  )
+set_tests_properties( [==[StateVectorCompressedCPU compression - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorFixedWeightCPU indexing - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorFixedWeightCPU indexing - float]==]  )
+set_tests_properties( [==[StateVectorFixedWeightCPU indexing - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorFixedWeightCPU indexing - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorFixedWeightCPU indexing - double]==]  )
+set_tests_properties( [==[StateVectorFixedWeightCPU indexing - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorFixedWeightCPU::applyOperation - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorFixedWeightCPU::applyOperation - float]==]  )
+set_tests_properties( [==[StateVectorFixedWeightCPU::applyOperation - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorFixedWeightCPU::applyOperation - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorFixedWeightCPU::applyOperation - double]==]  )
+set_tests_properties( [==[StateVectorFixedWeightCPU::applyOperation - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobianFixedWeight::adjointJacobian - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobianFixedWeight::adjointJacobian - float]==]  )
+set_tests_properties( [==[AdjointJacobianFixedWeight::adjointJacobian - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[AdjointJacobianFixedWeight::adjointJacobian - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[AdjointJacobianFixedWeight::adjointJacobian - double]==]  )
+set_tests_properties( [==[AdjointJacobianFixedWeight::adjointJacobian - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[saveStateVector and loadStateVector - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[saveStateVector and loadStateVector - float]==]  )
+set_tests_properties( [==[saveStateVector and loadStateVector - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[saveStateVector and loadStateVector - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[saveStateVector and loadStateVector - double]==]  )
+set_tests_properties( [==[saveStateVector and loadStateVector - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::StateVectorManagedCPU - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::StateVectorManagedCPU - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::StateVectorManagedCPU - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::StateVectorManagedCPU - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::StateVectorManagedCPU - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::StateVectorManagedCPU - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyMatrix with std::vector - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyMatrix with std::vector - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyMatrix with std::vector - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyMatrix with std::vector - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyMatrix with std::vector - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyMatrix with std::vector - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyMatrix with a pointer - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyMatrix with a pointer - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyMatrix with a pointer - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyMatrix with a pointer - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyMatrix with a pointer - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyMatrix with a pointer - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applySparseMatrix - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applySparseMatrix - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applySparseMatrix - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applySparseMatrix - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applySparseMatrix - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applySparseMatrix - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyControlledMatrix - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyControlledMatrix - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyControlledMatrix - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyControlledMatrix - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyControlledMatrix - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyControlledMatrix - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyCostLayer - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyCostLayer - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyCostLayer - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyCostLayer - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyCostLayer - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyCostLayer - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyPauliRot - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyPauliRot - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyPauliRot - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyPauliRot - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyPauliRot - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyPauliRot - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyOperations - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyOperations - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyOperations - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyOperations - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyOperations - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyOperations - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyOperations with cache blocking - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyOperations with cache blocking - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyOperations with cache blocking - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::applyOperations with cache blocking - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::applyOperations with cache blocking - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::applyOperations with cache blocking - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::lazy SWAP gates - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::lazy SWAP gates - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::lazy SWAP gates - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::lazy SWAP gates - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::lazy SWAP gates - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::lazy SWAP gates - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::deferred execution - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::deferred execution - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::deferred execution - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::deferred execution - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::deferred execution - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::deferred execution - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::mid-circuit measurements - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::mid-circuit measurements - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::mid-circuit measurements - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::mid-circuit measurements - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::mid-circuit measurements - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::mid-circuit measurements - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::state preparation - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::state preparation - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::state preparation - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::state preparation - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::state preparation - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::state preparation - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::amplitudes and overlaps - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::amplitudes and overlaps - float]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::amplitudes and overlaps - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorManagedCPU::amplitudes and overlaps - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorManagedCPU::amplitudes and overlaps - double]==]  )
+set_tests_properties( [==[StateVectorManagedCPU::amplitudes and overlaps - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorOutOfCoreCPU::applyOperations - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorOutOfCoreCPU::applyOperations - float]==]  )
+set_tests_properties( [==[StateVectorOutOfCoreCPU::applyOperations - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorOutOfCoreCPU::applyOperations - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorOutOfCoreCPU::applyOperations - double]==]  )
+set_tests_properties( [==[StateVectorOutOfCoreCPU::applyOperations - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorRawCPU::StateVectorRawCPU - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorRawCPU::StateVectorRawCPU - float]==]  )
+set_tests_properties( [==[StateVectorRawCPU::StateVectorRawCPU - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorRawCPU::StateVectorRawCPU - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorRawCPU::StateVectorRawCPU - double]==]  )
+set_tests_properties( [==[StateVectorRawCPU::StateVectorRawCPU - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorRawCPU::setData - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorRawCPU::setData - float]==]  )
+set_tests_properties( [==[StateVectorRawCPU::setData - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorRawCPU::setData - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorRawCPU::setData - double]==]  )
+set_tests_properties( [==[StateVectorRawCPU::setData - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorRawCPU from a mapped region - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorRawCPU from a mapped region - float]==]  )
+set_tests_properties( [==[StateVectorRawCPU from a mapped region - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorRawCPU from a mapped region - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorRawCPU from a mapped region - double]==]  )
+set_tests_properties( [==[StateVectorRawCPU from a mapped region - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSparseCPU::applyOperation - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSparseCPU::applyOperation - float]==]  )
+set_tests_properties( [==[StateVectorSparseCPU::applyOperation - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSparseCPU::applyOperation - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSparseCPU::applyOperation - double]==]  )
+set_tests_properties( [==[StateVectorSparseCPU::applyOperation - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSparseCPU reversible circuits - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSparseCPU reversible circuits - float]==]  )
+set_tests_properties( [==[StateVectorSparseCPU reversible circuits - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSparseCPU reversible circuits - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSparseCPU reversible circuits - double]==]  )
+set_tests_properties( [==[StateVectorSparseCPU reversible circuits - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSparseCPU::convertToDense - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSparseCPU::convertToDense - float]==]  )
+set_tests_properties( [==[StateVectorSparseCPU::convertToDense - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSparseCPU::convertToDense - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSparseCPU::convertToDense - double]==]  )
+set_tests_properties( [==[StateVectorSparseCPU::convertToDense - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSparseCPU::applyMatrix - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSparseCPU::applyMatrix - float]==]  )
+set_tests_properties( [==[StateVectorSparseCPU::applyMatrix - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSparseCPU::applyMatrix - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSparseCPU::applyMatrix - double]==]  )
+set_tests_properties( [==[StateVectorSparseCPU::applyMatrix - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSplitCPU::applyOperation - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSplitCPU::applyOperation - float]==]  )
+set_tests_properties( [==[StateVectorSplitCPU::applyOperation - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSplitCPU::applyOperation - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSplitCPU::applyOperation - double]==]  )
+set_tests_properties( [==[StateVectorSplitCPU::applyOperation - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSplitCPU::applyMatrix - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSplitCPU::applyMatrix - float]==]  )
+set_tests_properties( [==[StateVectorSplitCPU::applyMatrix - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSplitCPU::applyMatrix - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSplitCPU::applyMatrix - double]==]  )
+set_tests_properties( [==[StateVectorSplitCPU::applyMatrix - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSplitCPU::Data - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSplitCPU::Data - float]==]  )
+set_tests_properties( [==[StateVectorSplitCPU::Data - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[StateVectorSplitCPU::Data - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[StateVectorSplitCPU::Data - double]==]  )
+set_tests_properties( [==[StateVectorSplitCPU::Data - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[TapeExecutor::runConcurrently - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[TapeExecutor::runConcurrently - float]==]  )
+set_tests_properties( [==[TapeExecutor::runConcurrently - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[TapeExecutor::runConcurrently - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[TapeExecutor::runConcurrently - double]==]  )
+set_tests_properties( [==[TapeExecutor::runConcurrently - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[TapeExecutor::execute - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[TapeExecutor::execute - float]==]  )
+set_tests_properties( [==[TapeExecutor::execute - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[TapeExecutor::execute - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[TapeExecutor::execute - double]==]  )
+set_tests_properties( [==[TapeExecutor::execute - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( ThreadingConfig::numThreads /root/repo/_gate_build_dispatch/tests/runner ThreadingConfig::numThreads  )
+set_tests_properties( ThreadingConfig::numThreads PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( ThreadingScope /root/repo/_gate_build_dispatch/tests/runner ThreadingScope  )
+set_tests_properties( ThreadingScope PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[ThreadingConfig::honoured - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[ThreadingConfig::honoured - float]==]  )
+set_tests_properties( [==[ThreadingConfig::honoured - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[ThreadingConfig::honoured - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[ThreadingConfig::honoured - double]==]  )
+set_tests_properties( [==[ThreadingConfig::honoured - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( TraceRecorder /root/repo/_gate_build_dispatch/tests/runner TraceRecorder  )
+set_tests_properties( TraceRecorder PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[TrotterEvolution::evolve - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[TrotterEvolution::evolve - float]==]  )
+set_tests_properties( [==[TrotterEvolution::evolve - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[TrotterEvolution::evolve - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[TrotterEvolution::evolve - double]==]  )
+set_tests_properties( [==[TrotterEvolution::evolve - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Util::ConstMult - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Util::ConstMult - float]==]  )
+set_tests_properties( [==[Util::ConstMult - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Util::ConstMult - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Util::ConstMult - double]==]  )
+set_tests_properties( [==[Util::ConstMult - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Constant values - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Constant values - float]==]  )
+set_tests_properties( [==[Constant values - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Constant values - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Constant values - double]==]  )
+set_tests_properties( [==[Constant values - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Utility math functions - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[Utility math functions - float]==]  )
+set_tests_properties( [==[Utility math functions - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Utility math functions - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[Utility math functions - double]==]  )
+set_tests_properties( [==[Utility math functions - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Utility bit operations]==] /root/repo/_gate_build_dispatch/tests/runner [==[Utility bit operations]==]  )
+set_tests_properties( [==[Utility bit operations]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Utility array and tuples]==] /root/repo/_gate_build_dispatch/tests/runner [==[Utility array and tuples]==]  )
+set_tests_properties( [==[Utility array and tuples]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( transpose_state_tensor /root/repo/_gate_build_dispatch/tests/runner transpose_state_tensor  )
+set_tests_properties( transpose_state_tensor PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[randomUnitary - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[randomUnitary - float]==]  )
+set_tests_properties( [==[randomUnitary - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[randomUnitary - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[randomUnitary - double]==]  )
+set_tests_properties( [==[randomUnitary - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test utility functions for constants]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test utility functions for constants]==]  )
+set_tests_properties( [==[Test utility functions for constants]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[Test AlignedAllocator]==] /root/repo/_gate_build_dispatch/tests/runner [==[Test AlignedAllocator]==]  )
+set_tests_properties( [==[Test AlignedAllocator]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( WorkerPool /root/repo/_gate_build_dispatch/tests/runner WorkerPool  )
+set_tests_properties( WorkerPool PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( Philox4x32 /root/repo/_gate_build_dispatch/tests/runner Philox4x32  )
+set_tests_properties( Philox4x32 PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::VectorJacobianProduct - float]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::VectorJacobianProduct - float]==]  )
+set_tests_properties( [==[VectorJacobianProduct::VectorJacobianProduct - float]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::VectorJacobianProduct - double]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::VectorJacobianProduct - double]==]  )
+set_tests_properties( [==[VectorJacobianProduct::VectorJacobianProduct - double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( VectorJacobianProduct::computeVJP /root/repo/_gate_build_dispatch/tests/runner VectorJacobianProduct::computeVJP  )
+set_tests_properties( VectorJacobianProduct::computeVJP PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct without trainable-params]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct without trainable-params]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct without trainable-params]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=Z dy={0}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Op=RX\, Obs=Z dy={0}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=Z dy={0}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=Z dy={1}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Op=RX\, Obs=Z dy={1}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=Z dy={1}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=Z dy={0.4}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Op=RX\, Obs=Z dy={0.4}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=Z dy={0.4}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Op=RY, Obs=X dy={0.4}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Op=RY\, Obs=X dy={0.4}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Op=RY, Obs=X dy={0.4}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=[Z,Z] dy={1}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Op=RX\, Obs=\[Z\,Z\] dy={1}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=[Z,Z] dy={1}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Op=[RX,RX,RX], Obs=[Z,Z,Z], dy={0.4}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Op=\[RX\,RX\,RX\]\, Obs=\[Z\,Z\,Z\]\, dy={0.4}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Op=[RX,RX,RX], Obs=[Z,Z,Z], dy={0.4}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Op=[RX,RX,RX], Obs=[Z,Z,Z], TParams=[0,2], dy={1}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Op=\[RX\,RX\,RX\]\, Obs=\[Z\,Z\,Z\]\, TParams=\[0\,2\]\, dy={1}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Op=[RX,RX,RX], Obs=[Z,Z,Z], TParams=[0,2], dy={1}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Op=[RX,RX,RX], Obs=[ZZZ], dy={0.4}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Op=\[RX\,RX\,RX\]\, Obs=\[ZZZ\]\, dy={0.4}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Op=[RX,RX,RX], Obs=[ZZZ], dy={0.4}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Op=Mixed, Obs=[XXX], dy={1}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Op=Mixed\, Obs=\[XXX\]\, dy={1}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Op=Mixed, Obs=[XXX], dy={1}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Op=Mixed, Obs=[XXX], dy={-0.2}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Op=Mixed\, Obs=\[XXX\]\, dy={-0.2}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Op=Mixed, Obs=[XXX], dy={-0.2}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Decomposed Rot gate, non computational basis state]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Decomposed Rot gate\, non computational basis state]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Decomposed Rot gate, non computational basis state]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Mixed Ops, Obs and TParams]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Mixed Ops\, Obs and TParams]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Mixed Ops, Obs and TParams]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct::vectorJacobianProduct Mixed Ops, Obs and TParams, dy={-0.5}]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct::vectorJacobianProduct Mixed Ops\, Obs and TParams\, dy={-0.5}]==]  )
+set_tests_properties( [==[VectorJacobianProduct::vectorJacobianProduct Mixed Ops, Obs and TParams, dy={-0.5}]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+add_test( [==[VectorJacobianProduct of probabilities and of the state]==] /root/repo/_gate_build_dispatch/tests/runner [==[VectorJacobianProduct of probabilities and of the state]==]  )
+set_tests_properties( [==[VectorJacobianProduct of probabilities and of the state]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_dispatch/tests)
+set( runner_TESTS [==[AdjointJacobian::AdjointJacobian - float]==] [==[AdjointJacobian::AdjointJacobian - double]==] [==[CompiledOps::apply - float]==] [==[CompiledOps::apply - double]==] [==[AdjointJacobian::adjointJacobian Op=RX, Obs=Z]==] [==[AdjointJacobian::adjointJacobian Op=RY, Obs=X]==] [==[AdjointJacobian::adjointJacobian Op=RX, Obs=[Z,Z]]==] [==[AdjointJacobian::adjointJacobian Op=[RX,RX,RX], Obs=[Z,Z,Z]]==] [==[AdjointJacobian::adjointJacobian Op=[RX,RX,RX], Obs=[Z,Z,Z], TParams=[0,2]]==] [==[AdjointJacobian::adjointJacobian Op=[RX,RX,RX], Obs=[ZZZ]]==] [==[AdjointJacobian::adjointJacobian Op=Mixed, Obs=[XXX]]==] [==[AdjointJacobian::adjointJacobian Decomposed Rot gate, non computational basis state]==] [==[AdjointJacobian::adjointJacobian Rot and CRot gates - float]==] [==[AdjointJacobian::adjointJacobian Rot and CRot gates - double]==] [==[AdjointJacobian::adjointJacobian matrix operations - float]==] [==[AdjointJacobian::adjointJacobian matrix operations - double]==] [==[AdjointJacobian::adjointJacobian Mixed Ops, Obs and TParams]==] [==[AdjointJacobian::adjointJacobian Op=CostLayer - float]==] [==[AdjointJacobian::adjointJacobian Op=CostLayer - double]==] [==[AdjointJacobian::adjointJacobian Op=PauliRot - float]==] [==[AdjointJacobian::adjointJacobian Op=PauliRot - double]==] [==[AdjointJacobian::applyObservable visitor checks]==] [==[AdjointJacobian::applyObservable fused tensor products - float]==] [==[AdjointJacobian::applyObservable fused tensor products - double]==] [==[AdjointJacobian::adjointJacobian Obs=PauliSum - float]==] [==[AdjointJacobian::adjointJacobian Obs=PauliSum - double]==] [==[AdjointJacobian::adjointJacobian Obs=SparseHamiltonian - float]==] [==[AdjointJacobian::adjointJacobian Obs=SparseHamiltonian - double]==] [==[AdjointJacobian::adjointJacobian with a memory budget - float]==] [==[AdjointJacobian::adjointJacobian with a memory budget - double]==] [==[AdjointJacobian::adjointJacobian with a forward state - float]==] [==[AdjointJacobian::adjointJacobian with a forward state - double]==] [==[AdjointJacobian::adjointJacobian with checkpoints - float]==] [==[AdjointJacobian::adjointJacobian with checkpoints - double]==] [==[AdjointJacobian::adjointJacobian with a buffer pool - float]==] [==[AdjointJacobian::adjointJacobian with a buffer pool - double]==] [==[AdjointJacobian::computeExpvals - float]==] [==[AdjointJacobian::computeExpvals - double]==] [==[AdjointJacobian::execute - float]==] [==[AdjointJacobian::execute - double]==] [==[AdjointJacobian::adjointJacobian parallelism - float]==] [==[AdjointJacobian::adjointJacobian parallelism - double]==] [==[AdjointJacobian::adjointVJP - float]==] [==[AdjointJacobian::adjointVJP - double]==] [==[AdjointJacobian::hessianVectorProduct - float]==] [==[AdjointJacobian::hessianVectorProduct - double]==] [==[AdjointJacobian::metricTensor - float]==] [==[AdjointJacobian::metricTensor - double]==] [==[BatchedCircuit::BatchedCircuit - float]==] [==[BatchedCircuit::BatchedCircuit - double]==] [==[BatchedCircuit::execute - float]==] [==[BatchedCircuit::execute - double]==] [==[Test exception in a constexpr constructor]==] [==[Test assert in a constexpr function]==] [==[DynamicDispatcher::applyOperation - float]==] [==[DynamicDispatcher::applyOperation - double]==] [==[DynamicDispatcher::SIMD kernels - float]==] [==[DynamicDispatcher::SIMD kernels - double]==] [==[DynamicDispatcher::applyOperationBatch - float]==] [==[DynamicDispatcher::applyOperationBatch - double]==] [==[DynamicDispatcher::getGateFunc - float]==] [==[DynamicDispatcher::getGateFunc - double]==] [==[DynamicDispatcher::strToGateOp - float]==] [==[DynamicDispatcher::strToGateOp - double]==] [==[DynamicDispatcher::applyGenerator - float]==] [==[DynamicDispatcher::applyGenerator - double]==] [==[DynamicDispatcher::applyMatrix - float]==] [==[DynamicDispatcher::applyMatrix - double]==] [==[DynamicDispatcher profiling - float]==] [==[DynamicDispatcher profiling - double]==] Error.hpp partitionForFusion partitionIntoLayers partitionForProducts getFusedMatrix getFusedDiagonal [==[StateVector::applyOperations with gate fusion - float]==] [==[StateVector::applyOperations with gate fusion - double]==] [==[StateVector::applyOperations with layer scheduling - float]==] [==[StateVector::applyOperations with layer scheduling - double]==] [==[Test all kernels give the same results for gates - float]==] [==[Test all kernels give the same results for gates - double]==] [==[Test all kernels give the same results for matrices - float]==] [==[Test all kernels give the same results for matrices - double]==] [==[Test all generators of all kernels - float]==] [==[Test all generators of all kernels - double]==] [==[pauliGeneratorOverlap matches the generator kernels - float]==] [==[pauliGeneratorOverlap matches the generator kernels - double]==] [==[Test inverse of gate implementations - float]==] [==[Test inverse of gate implementations - double]==] [==[GateImplementation::applyMatrix, inverse = false - float]==] [==[GateImplementation::applyMatrix, inverse = false - double]==] [==[GateImplementation::applyMatrix, inverse = true - float]==] [==[GateImplementation::applyMatrix, inverse = true - double]==] [==[GateImplementationsLM::applyControlledMatrix - float]==] [==[GateImplementationsLM::applyControlledMatrix - double]==] [==[GateImplementationsLM::applyDiagonal - float]==] [==[GateImplementationsLM::applyDiagonal - double]==] [==[GateImplementation::applyIdentity - float]==] [==[GateImplementation::applyIdentity - double]==] [==[GateImplementation::applyPauliX - float]==] [==[GateImplementation::applyPauliX - double]==] [==[GateImplementation::applyPauliY - float]==] [==[GateImplementation::applyPauliY - double]==] [==[GateImplementation::applyPauliZ - float]==] [==[GateImplementation::applyPauliZ - double]==] [==[GateImplementation::applyHadamard - float]==] [==[GateImplementation::applyHadamard - double]==] [==[GateImplementation::applyS - float]==] [==[GateImplementation::applyS - double]==] [==[GateImplementation::applyT - float]==] [==[GateImplementation::applyT - double]==] [==[GateImplementation::applyCNOT - float]==] [==[GateImplementation::applyCNOT - double]==] [==[GateImplementation::applyCY - float]==] [==[GateImplementation::applyCY - double]==] [==[GateImplementation::applyCZ - float]==] [==[GateImplementation::applyCZ - double]==] [==[GateImplementation::applySWAP - float]==] [==[GateImplementation::applySWAP - double]==] [==[GateImplementation::applyToffoli - float]==] [==[GateImplementation::applyToffoli - double]==] [==[GateImplementation::applyCSWAP - float]==] [==[GateImplementation::applyCSWAP - double]==] [==[GateImplementation::applyPhaseShift - float]==] [==[GateImplementation::applyPhaseShift - double]==] [==[GateImplementation::applyRX - float]==] [==[GateImplementation::applyRX - double]==] [==[GateImplementation::applyRY - float]==] [==[GateImplementation::applyRY - double]==] [==[GateImplementation::applyRZ - float]==] [==[GateImplementation::applyRZ - double]==] [==[GateImplementation::applyRot - float]==] [==[GateImplementation::applyRot - double]==] [==[GateImplementation::applyIsingXX - float]==] [==[GateImplementation::applyIsingXX - double]==] [==[GateImplementation::applyIsingXY - float]==] [==[GateImplementation::applyIsingXY - double]==] [==[GateImplementation::applyIsingYY - float]==] [==[GateImplementation::applyIsingYY - double]==] [==[GateImplementation::applyIsingZZ - float]==] [==[GateImplementation::applyIsingZZ - double]==] [==[GateImplementation::applyControlledPhaseShift - float]==] [==[GateImplementation::applyControlledPhaseShift - double]==] [==[GateImplementation::applyCRX - float]==] [==[GateImplementation::applyCRX - double]==] [==[GateImplementation::applyCRY - float]==] [==[GateImplementation::applyCRY - double]==] [==[GateImplementation::applyCRZ - float]==] [==[GateImplementation::applyCRZ - double]==] [==[GateImplementation::applyCRot - float]==] [==[GateImplementation::applyCRot - double]==] [==[GateImplementation::applySingleExcitation - float]==] [==[GateImplementation::applySingleExcitation - double]==] [==[GateImplementation::applySingleExcitationMinus - float]==] [==[GateImplementation::applySingleExcitationMinus - double]==] [==[GateImplementation::applySingleExcitationPlus - float]==] [==[GateImplementation::applySingleExcitationPlus - double]==] [==[GateImplementation::applyDoubleExcitation - float]==] [==[GateImplementation::applyDoubleExcitation - double]==] [==[GateImplementation::applyDoubleExcitationMinus - float]==] [==[GateImplementation::applyDoubleExcitationMinus - double]==] [==[GateImplementation::applyDoubleExcitationPlus - float]==] [==[GateImplementation::applyDoubleExcitationPlus - double]==] [==[GateImplementation::applyMultiRZ - float]==] [==[GateImplementation::applyMultiRZ - double]==] generateBitPatterns getIndicesAfterExclusion ExternalIndices cachedGateIndices implementedGatesForKernel [==[Approx - float]==] [==[Approx - double]==] [==[createProductState - float]==] [==[createProductState - double]==] createAllWires [==[Test PriorityDispatchSet]==] [==[Test default kernels for gates are well defined]==] [==[Test default kernels for generators are well defined]==] [==[Test default kernels for matrix operation are well defined]==] [==[Test unallowed kernel]==] [==[Test several limiting cases of default kernels]==] [==[Test default kernels for aligned memory models]==] [==[Test KernelMap functionalities]==] [==[Test concurrent KernelMap lookups]==] readKernelProfile filterAvailableKernels loadKernelProfile KernelTuner::tune KernelTuner::timeKernel [==[Assign, write, and read tuned kernels]==] [==[Test linear algebra functions - float]==] [==[Test linear algebra functions - double]==] [==[Util::svd - float]==] [==[Util::svd - double]==] [==[Reductions over single precision data accumulate in double]==] [==[MatrixProductState::applyOperations - float]==] [==[MatrixProductState::applyOperations - double]==] [==[MatrixProductState::truncation - float]==] [==[MatrixProductState::truncation - double]==] Probabilities [==[Probabilities for a subset of wires - float]==] [==[Probabilities for a subset of wires - double]==] [==[Expected Values - float]==] [==[Expected Values - double]==] [==[Expected Values without copying the statevector - float]==] [==[Expected Values without copying the statevector - double]==] [==[Expected value of a PauliSum - float]==] [==[Expected value of a PauliSum - double]==] [==[Qubit-wise commuting groups - float]==] [==[Qubit-wise commuting groups - double]==] [==[Sample - float]==] [==[Sample - double]==] [==[Sample with a seed - float]==] [==[Sample with a seed - double]==] [==[Sample indices and counts - float]==] [==[Sample indices and counts - double]==] [==[Packed samples of a subset of wires - float]==] [==[Packed samples of a subset of wires - double]==] [==[Classical shadow samples - float]==] [==[Classical shadow samples - double]==] [==[Cached probabilities - float]==] [==[Cached probabilities - double]==] [==[Variances - float]==] [==[Variances - double]==] [==[Fused expected values and variances - float]==] [==[Fused expected values and variances - double]==] [==[Diagonal observables - float]==] [==[Diagonal observables - double]==] [==[Z correlators - float]==] [==[Z correlators - double]==] [==[Reduced density matrices - float]==] [==[Reduced density matrices - double]==] [==[Measurements on relabelled wires - float]==] [==[Measurements on relabelled wires - double]==] [==[apply_Sparse_Matrix_Kokkos - float]==] [==[apply_Sparse_Matrix_Kokkos - double]==] [==[apply_Sparse_Matrix - float]==] [==[apply_Sparse_Matrix - double]==] [==[Expected Values - Sparse Hamiltonian - float]==] [==[Expected Values - Sparse Hamiltonian - double]==] [==[GateOpToMemberFuncPtr - float]==] [==[GateOpToMemberFuncPtr - double]==] [==[GeneratorOpToMemberFuncPtr - float]==] [==[GeneratorOpToMemberFuncPtr - double]==] [==[ParameterShift::parameterShift - float]==] [==[ParameterShift::parameterShift - double]==] [==[ParameterShift::parameterShift without adjoint support - float]==] [==[ParameterShift::parameterShift without adjoint support - double]==] [==[ParameterShift::parameterShift errors - float]==] [==[ParameterShift::parameterShift errors - double]==] [==[KrausChannel::branchProbs - float]==] [==[KrausChannel::branchProbs - double]==] [==[QuantumTrajectories::execute - float]==] [==[QuantumTrajectories::execute - double]==] [==[Runtime information is correct]==] [==[apply_Sparse_Matrix_CSR - float]==] [==[apply_Sparse_Matrix_CSR - double]==] [==[StabilizerTableau::writeState - float]==] [==[StabilizerTableau::writeState - double]==] [==[StabilizerTableau::GHZ state of many qubits]==] [==[StabilizerTableau::invalid arguments]==] [==[StateVectorManagedCPU::Clifford prefix - float]==] [==[StateVectorManagedCPU::Clifford prefix - double]==] [==[StateVectorBatchMajor::applyOperation - float]==] [==[StateVectorBatchMajor::applyOperation - double]==] [==[StateVectorBatchMajor::Data - float]==] [==[StateVectorBatchMajor::Data - double]==] [==[StateVectorCompressedCPU::applyOperations - float]==] [==[StateVectorCompressedCPU::applyOperations - double]==] [==[StateVectorCompressedCPU compression - float]==] [==[StateVectorCompressedCPU compression - double]==] [==[StateVectorFixedWeightCPU indexing - float]==] [==[StateVectorFixedWeightCPU indexing - double]==] [==[StateVectorFixedWeightCPU::applyOperation - float]==] [==[StateVectorFixedWeightCPU::applyOperation - double]==] [==[AdjointJacobianFixedWeight::adjointJacobian - float]==] [==[AdjointJacobianFixedWeight::adjointJacobian - double]==] [==[saveStateVector and loadStateVector - float]==] [==[saveStateVector and loadStateVector - double]==] [==[StateVectorManagedCPU::StateVectorManagedCPU - float]==] [==[StateVectorManagedCPU::StateVectorManagedCPU - double]==] [==[StateVectorManagedCPU::applyMatrix with std::vector - float]==] [==[StateVectorManagedCPU::applyMatrix with std::vector - double]==] [==[StateVectorManagedCPU::applyMatrix with a pointer - float]==] [==[StateVectorManagedCPU::applyMatrix with a pointer - double]==] [==[StateVectorManagedCPU::applySparseMatrix - float]==] [==[StateVectorManagedCPU::applySparseMatrix - double]==] [==[StateVectorManagedCPU::applyControlledMatrix - float]==] [==[StateVectorManagedCPU::applyControlledMatrix - double]==] [==[StateVectorManagedCPU::applyCostLayer - float]==] [==[StateVectorManagedCPU::applyCostLayer - double]==] [==[StateVectorManagedCPU::applyPauliRot - float]==] [==[StateVectorManagedCPU::applyPauliRot - double]==] [==[StateVectorManagedCPU::applyOperations - float]==] [==[StateVectorManagedCPU::applyOperations - double]==] [==[StateVectorManagedCPU::applyOperations with cache blocking - float]==] [==[StateVectorManagedCPU::applyOperations with cache blocking - double]==] [==[StateVectorManagedCPU::lazy SWAP gates - float]==] [==[StateVectorManagedCPU::lazy SWAP gates - double]==] [==[StateVectorManagedCPU::deferred execution - float]==] [==[StateVectorManagedCPU::deferred execution - double]==] [==[StateVectorManagedCPU::mid-circuit measurements - float]==] [==[StateVectorManagedCPU::mid-circuit measurements - double]==] [==[StateVectorManagedCPU::state preparation - float]==] [==[StateVectorManagedCPU::state preparation - double]==] [==[StateVectorManagedCPU::amplitudes and overlaps - float]==] [==[StateVectorManagedCPU::amplitudes and overlaps - double]==] [==[StateVectorOutOfCoreCPU::applyOperations - float]==] [==[StateVectorOutOfCoreCPU::applyOperations - double]==] [==[StateVectorRawCPU::StateVectorRawCPU - float]==] [==[StateVectorRawCPU::StateVectorRawCPU - double]==] [==[StateVectorRawCPU::setData - float]==] [==[StateVectorRawCPU::setData - double]==] [==[StateVectorRawCPU from a mapped region - float]==] [==[StateVectorRawCPU from a mapped region - double]==] [==[StateVectorSparseCPU::applyOperation - float]==] [==[StateVectorSparseCPU::applyOperation - double]==] [==[StateVectorSparseCPU reversible circuits - float]==] [==[StateVectorSparseCPU reversible circuits - double]==] [==[StateVectorSparseCPU::convertToDense - float]==] [==[StateVectorSparseCPU::convertToDense - double]==] [==[StateVectorSparseCPU::applyMatrix - float]==] [==[StateVectorSparseCPU::applyMatrix - double]==] [==[StateVectorSplitCPU::applyOperation - float]==] [==[StateVectorSplitCPU::applyOperation - double]==] [==[StateVectorSplitCPU::applyMatrix - float]==] [==[StateVectorSplitCPU::applyMatrix - double]==] [==[StateVectorSplitCPU::Data - float]==] [==[StateVectorSplitCPU::Data - double]==] [==[TapeExecutor::runConcurrently - float]==] [==[TapeExecutor::runConcurrently - double]==] [==[TapeExecutor::execute - float]==] [==[TapeExecutor::execute - double]==] ThreadingConfig::numThreads ThreadingScope [==[ThreadingConfig::honoured - float]==] [==[ThreadingConfig::honoured - double]==] TraceRecorder [==[TrotterEvolution::evolve - float]==] [==[TrotterEvolution::evolve - double]==] [==[Util::ConstMult - float]==] [==[Util::ConstMult - double]==] [==[Constant values - float]==] [==[Constant values - double]==] [==[Utility math functions - float]==] [==[Utility math functions - double]==] [==[Utility bit operations]==] [==[Utility array and tuples]==] transpose_state_tensor [==[randomUnitary - float]==] [==[randomUnitary - double]==] [==[Test utility functions for constants]==] [==[Test AlignedAllocator]==] WorkerPool Philox4x32 [==[VectorJacobianProduct::VectorJacobianProduct - float]==] [==[VectorJacobianProduct::VectorJacobianProduct - double]==] VectorJacobianProduct::computeVJP [==[VectorJacobianProduct::vectorJacobianProduct without trainable-params]==] [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=Z dy={0}]==] [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=Z dy={1}]==] [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=Z dy={0.4}]==] [==[VectorJacobianProduct::vectorJacobianProduct Op=RY, Obs=X dy={0.4}]==] [==[VectorJacobianProduct::vectorJacobianProduct Op=RX, Obs=[Z,Z] dy={1}]==] [==[VectorJacobianProduct::vectorJacobianProduct Op=[RX,RX,RX], Obs=[Z,Z,Z], dy={0.4}]==] [==[VectorJacobianProduct::vectorJacobianProduct Op=[RX,RX,RX], Obs=[Z,Z,Z], TParams=[0,2], dy={1}]==] [==[VectorJacobianProduct::vectorJacobianProduct Op=[RX,RX,RX], Obs=[ZZZ], dy={0.4}]==] [==[VectorJacobianProduct::vectorJacobianProduct Op=Mixed, Obs=[XXX], dy={1}]==] [==[VectorJacobianProduct::vectorJacobianProduct Op=Mixed, Obs=[XXX], dy={-0.2}]==] [==[VectorJacobianProduct::vectorJacobianProduct Decomposed Rot gate, non computational basis state]==] [==[VectorJacobianProduct::vectorJacobianProduct Mixed Ops, Obs and TParams]==] [==[VectorJacobianProduct::vectorJacobianProduct Mixed Ops, Obs and TParams, dy={-0.5}]==] [==[VectorJacobianProduct of probabilities and of the state]==])
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/pennylane_lightning/src
+# Build directory: /root/repo/_gate_build_mpi
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("algorithms")
+subdirs("gates")
+subdirs("simulator")
+subdirs("util")
+subdirs("tests")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/catch2src
+# Build directory: /root/repo/_gate_build_mpi/_deps/catch2-build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
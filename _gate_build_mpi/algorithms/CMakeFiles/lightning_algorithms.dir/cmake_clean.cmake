@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lightning_algorithms.dir/AdjointDiff.cpp.o"
+  "CMakeFiles/lightning_algorithms.dir/AdjointDiff.cpp.o.d"
+  "CMakeFiles/lightning_algorithms.dir/BatchedCircuit.cpp.o"
+  "CMakeFiles/lightning_algorithms.dir/BatchedCircuit.cpp.o.d"
+  "CMakeFiles/lightning_algorithms.dir/JacobianProd.cpp.o"
+  "CMakeFiles/lightning_algorithms.dir/JacobianProd.cpp.o.d"
+  "CMakeFiles/lightning_algorithms.dir/ParameterShift.cpp.o"
+  "CMakeFiles/lightning_algorithms.dir/ParameterShift.cpp.o.d"
+  "liblightning_algorithms.a"
+  "liblightning_algorithms.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lightning_algorithms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
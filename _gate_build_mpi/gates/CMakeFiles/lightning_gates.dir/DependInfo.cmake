@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/pennylane_lightning/src/gates/DynamicDispatcher.cpp" "gates/CMakeFiles/lightning_gates.dir/DynamicDispatcher.cpp.o" "gcc" "gates/CMakeFiles/lightning_gates.dir/DynamicDispatcher.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/gates/GateFusion.cpp" "gates/CMakeFiles/lightning_gates.dir/GateFusion.cpp.o" "gcc" "gates/CMakeFiles/lightning_gates.dir/GateFusion.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/gates/GateUtil.cpp" "gates/CMakeFiles/lightning_gates.dir/GateUtil.cpp.o" "gcc" "gates/CMakeFiles/lightning_gates.dir/GateUtil.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_mpi/util/CMakeFiles/lightning_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/pennylane_lightning/src/simulator/KernelMap.cpp" "simulator/CMakeFiles/lightning_simulator.dir/KernelMap.cpp.o" "gcc" "simulator/CMakeFiles/lightning_simulator.dir/KernelMap.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/simulator/Measures.cpp" "simulator/CMakeFiles/lightning_simulator.dir/Measures.cpp.o" "gcc" "simulator/CMakeFiles/lightning_simulator.dir/Measures.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/simulator/StateVectorManagedCPU.cpp" "simulator/CMakeFiles/lightning_simulator.dir/StateVectorManagedCPU.cpp.o" "gcc" "simulator/CMakeFiles/lightning_simulator.dir/StateVectorManagedCPU.cpp.o.d"
+  "/root/repo/pennylane_lightning/src/simulator/StateVectorRawCPU.cpp" "simulator/CMakeFiles/lightning_simulator.dir/StateVectorRawCPU.cpp.o" "gcc" "simulator/CMakeFiles/lightning_simulator.dir/StateVectorRawCPU.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_mpi/gates/CMakeFiles/lightning_gates.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_mpi/util/CMakeFiles/lightning_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
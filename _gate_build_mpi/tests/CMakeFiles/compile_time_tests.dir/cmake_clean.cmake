@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compile_time_tests.dir/compile_time_tests.cpp.o"
+  "CMakeFiles/compile_time_tests.dir/compile_time_tests.cpp.o.d"
+  "compile_time_tests"
+  "compile_time_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compile_time_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
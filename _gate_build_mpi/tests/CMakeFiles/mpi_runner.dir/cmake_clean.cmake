@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mpi_runner.dir/Test_AdjDiffMPI.cpp.o"
+  "CMakeFiles/mpi_runner.dir/Test_AdjDiffMPI.cpp.o.d"
+  "CMakeFiles/mpi_runner.dir/Test_StateVectorMPI.cpp.o"
+  "CMakeFiles/mpi_runner.dir/Test_StateVectorMPI.cpp.o.d"
+  "CMakeFiles/mpi_runner.dir/runner_main_mpi.cpp.o"
+  "CMakeFiles/mpi_runner.dir/runner_main_mpi.cpp.o.d"
+  "mpi_runner"
+  "mpi_runner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpi_runner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
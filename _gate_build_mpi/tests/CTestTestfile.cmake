@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/pennylane_lightning/src/tests
+# Build directory: /root/repo/_gate_build_mpi/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_gate_build_mpi/tests/runner_include-b12d07c.cmake")
+add_test(mpi_runner_1 "/usr/bin/mpiexec" "-n" "1" "--oversubscribe" "/root/repo/_gate_build_mpi/tests/mpi_runner")
+set_tests_properties(mpi_runner_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/pennylane_lightning/src/tests/CMakeLists.txt;127;add_test;/root/repo/pennylane_lightning/src/tests/CMakeLists.txt;0;")
+add_test(mpi_runner_2 "/usr/bin/mpiexec" "-n" "2" "--oversubscribe" "/root/repo/_gate_build_mpi/tests/mpi_runner")
+set_tests_properties(mpi_runner_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/pennylane_lightning/src/tests/CMakeLists.txt;127;add_test;/root/repo/pennylane_lightning/src/tests/CMakeLists.txt;0;")
+add_test(mpi_runner_4 "/usr/bin/mpiexec" "-n" "4" "--oversubscribe" "/root/repo/_gate_build_mpi/tests/mpi_runner")
+set_tests_properties(mpi_runner_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/pennylane_lightning/src/tests/CMakeLists.txt;127;add_test;/root/repo/pennylane_lightning/src/tests/CMakeLists.txt;0;")
+subdirs("../_deps/catch2-build")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_build_mpi/tests/runner_tests-b12d07c.cmake")
+  include("/root/repo/_gate_build_mpi/tests/runner_tests-b12d07c.cmake")
+else()
+  add_test(runner_NOT_BUILT-b12d07c runner_NOT_BUILT-b12d07c)
+endif()
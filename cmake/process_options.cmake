@@ -1,6 +1,7 @@
 ##############################################################################
-# This file processes ENABLE_WARNINGS, ENABLE_NATIVE, ENABLE_AVX, 
-# ENABLE_OPENMP, ENABLE_KOKKOS, and ENABLE_BLAS 
+# This file processes ENABLE_WARNINGS, ENABLE_NATIVE, ENABLE_AVX,
+# ENABLE_RUNTIME_DISPATCH, ENABLE_OPENMP, ENABLE_KOKKOS, ENABLE_BLAS,
+# ENABLE_ZLIB, and ENABLE_MPI
 # options and produces interface libraries
 # lightning_compile_options and lightning_external_libs.
 ##############################################################################
@@ -101,6 +102,19 @@ else()
     message(STATUS "ENABLE_AVX512 is OFF")
 endif()
 
+if(ENABLE_RUNTIME_DISPATCH)
+    if(NOT CMAKE_SYSTEM_PROCESSOR MATCHES "(x86_64)|(AMD64)|(amd64)")
+        message(FATAL_ERROR "ENABLE_RUNTIME_DISPATCH is only supported on x86_64.")
+    endif()
+    if(NOT CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+        message(FATAL_ERROR "ENABLE_RUNTIME_DISPATCH requires GCC or Clang.")
+    endif()
+    message(STATUS "ENABLE_RUNTIME_DISPATCH is ON.")
+    target_compile_options(lightning_compile_options INTERFACE "-D_ENABLE_RUNTIME_DISPATCH=1")
+else()
+    message(STATUS "ENABLE_RUNTIME_DISPATCH is OFF.")
+endif()
+
 if(ENABLE_OPENMP)
     message(STATUS "ENABLE_OPENMP is ON.")
     find_package(OpenMP)
@@ -136,8 +150,52 @@ else()
     message(STATUS "ENABLE_BLAS is OFF.")
 endif()
 
+if(ENABLE_ZLIB)
+    message(STATUS "ENABLE_ZLIB is ON.")
+    find_package(ZLIB)
+
+    if(NOT ZLIB_FOUND)
+        message(FATAL_ERROR "zlib is enabled but not found.")
+    endif()
+
+    target_link_libraries(lightning_external_libs INTERFACE ZLIB::ZLIB)
+    target_compile_options(lightning_compile_options INTERFACE "-D_ENABLE_ZLIB=1")
+else()
+    message(STATUS "ENABLE_ZLIB is OFF.")
+endif()
+
+if(ENABLE_MPI)
+    message(STATUS "ENABLE_MPI is ON.")
+    find_package(MPI COMPONENTS CXX)
+
+    if(NOT MPI_CXX_FOUND)
+        message(FATAL_ERROR "MPI is enabled but not found.")
+    endif()
+
+    target_link_libraries(lightning_external_libs INTERFACE MPI::MPI_CXX)
+    target_compile_options(lightning_compile_options INTERFACE "-D_ENABLE_MPI=1")
+else()
+    message(STATUS "ENABLE_MPI is OFF.")
+endif()
+
+if(ENABLE_DISPATCH_PROFILING)
+    message(STATUS "ENABLE_DISPATCH_PROFILING is ON.")
+    target_compile_options(lightning_compile_options INTERFACE "-D_ENABLE_DISPATCH_PROFILING=1")
+else()
+    message(STATUS "ENABLE_DISPATCH_PROFILING is OFF.")
+endif()
+
+if(ENABLE_TRACING)
+    message(STATUS "ENABLE_TRACING is ON.")
+    target_compile_options(lightning_compile_options INTERFACE "-D_ENABLE_TRACING=1")
+else()
+    message(STATUS "ENABLE_TRACING is OFF.")
+endif()
+
 if(ENABLE_KOKKOS)
-    # Setting the Serial device for all cases.
+    # Setting the Serial device for all cases. StateVectorKokkos runs in the
+    # default execution space, chosen by passing e.g. -DKokkos_ENABLE_CUDA=ON,
+    # -DKokkos_ENABLE_HIP=ON or -DKokkos_ENABLE_OPENMP=ON.
     option(Kokkos_ENABLE_SERIAL  "Enable Kokkos SERIAL device" ON)
     message(STATUS "KOKKOS SERIAL DEVICE ENABLED.")
 
@@ -14,7 +14,8 @@
 r"""
 Helper functions for serializing quantum tapes.
 """
-from typing import List, Tuple
+import copy
+from typing import List, Optional, Tuple
 
 import numpy as np
 from pennylane import (
@@ -22,10 +23,9 @@ from pennylane import (
     Hadamard,
     Projector,
     QubitStateVector,
-    Rot,
 )
 from pennylane.grouping import is_pauli_word
-from pennylane.operation import Observable, Tensor
+from pennylane.operation import GeneratorUndefinedError, Observable, Operation, Tensor
 from pennylane.tape import QuantumTape
 
 # Remove after the next release of PL
@@ -61,6 +61,71 @@ def _obs_has_kernel(obs: Observable) -> bool:
     return False
 
 
+def _op_has_kernel(op: Operation) -> bool:
+    """Returns True if the input operation has a supported kernel in the C++ backend.
+
+    Args:
+        op (Operation): the input operation
+
+    Returns:
+        bool: indicating whether ``op`` has a dedicated kernel in the backend
+    """
+    name = op.name if not op.inverse else op.name[:-4]
+    return hasattr(StateVectorC128, name)
+
+
+def _op_generator(op: Operation) -> Optional[np.ndarray]:
+    """Returns the generator matrix of an operation without a dedicated kernel which has a single
+    scalar parameter.
+
+    The operation is :math:`U(\\theta) = e^{i \\theta G}` without its inversion, so that the
+    backend can apply and differentiate it as a matrix.
+
+    Args:
+        op (Operation): the input operation
+
+    Returns:
+        array or None: the matrix of :math:`G`, or ``None`` if ``op`` has a kernel or no generator
+    """
+    if _op_has_kernel(op) or op.num_params != 1 or np.ndim(op.parameters[0]) != 0:
+        return None
+    base = copy.copy(op)
+    base.inverse = False
+    try:
+        generator = base.generator()
+    except (GeneratorUndefinedError, NotImplementedError):
+        return None
+    return qml.matrix(generator, wire_order=base.wires)
+
+
+def _serialize_trainable_params(tape: QuantumTape) -> List[int]:
+    """Maps the trainable parameters of an input tape to the parameters of the operations
+    serialized by ``_serialize_ops``.
+
+    State preparations and operations applied by their matrix without a generator are serialized
+    without parameters, so that their parameters are skipped.
+
+    Args:
+        tape (QuantumTape): the input quantum tape
+
+    Returns:
+        list[int]: the indices of the trainable parameters that are serialized
+    """
+    serialized = {}
+    tape_idx = 0
+    ser_idx = 0
+    for o in tape.operations:
+        num_params = len(o.parameters)
+        if not isinstance(o, (BasisState, QubitStateVector)) and (
+            _op_has_kernel(o) or _op_generator(o) is not None
+        ):
+            for k in range(num_params):
+                serialized[tape_idx + k] = ser_idx + k
+            ser_idx += num_params
+        tape_idx += num_params
+    return [serialized[i] for i in sorted(tape.trainable_params) if i in serialized]
+
+
 def _serialize_obs(tape: QuantumTape, wires_map: dict, use_csingle: bool = False) -> List:
     """Serializes the observables of an input tape.
 
@@ -118,7 +183,15 @@ def _serialize_obs(tape: QuantumTape, wires_map: dict, use_csingle: bool = False
 
 def _serialize_ops(
     tape: QuantumTape, wires_map: dict
-) -> Tuple[List[List[str]], List[np.ndarray], List[List[int]], List[bool], List[np.ndarray]]:
+) -> Tuple[
+    List[List[str]],
+    List[np.ndarray],
+    List[List[int]],
+    List[bool],
+    List[np.ndarray],
+    List[np.ndarray],
+    List[str],
+]:
     """Serializes the operations of an input tape.
 
     The state preparation operations are not included.
@@ -128,15 +201,19 @@ def _serialize_ops(
         wires_map (dict): a dictionary mapping input wires to the device's backend wires
 
     Returns:
-        Tuple[list, list, list, list, list]: A serialization of the operations, containing a list
-        of operation names, a list of operation parameters, a list of observable wires, a list of
-        inverses, and a list of matrices for the operations that do not have a dedicated kernel.
+        Tuple[list, list, list, list, list, list, list]: A serialization of the operations,
+        containing a list of operation names, a list of operation parameters, a list of observable
+        wires, a list of inverses, a list of matrices for the operations that do not have a
+        dedicated kernel, a list of generator matrices for those of them with a single parameter,
+        and a list of Pauli words for the Pauli rotations.
     """
     names = []
     params = []
     wires = []
     inverses = []
     mats = []
+    generators = []
+    pauli_words = []
 
     uses_stateprep = False
 
@@ -144,29 +221,42 @@ def _serialize_ops(
         if isinstance(o, (BasisState, QubitStateVector)):
             uses_stateprep = True
             continue
-        elif isinstance(o, Rot):
-            op_list = o.expand().operations
-        else:
-            op_list = [o]
-
-        for single_op in op_list:
-            is_inverse = single_op.inverse
-
-            name = single_op.name if not is_inverse else single_op.name[:-4]
-            names.append(name)
 
-            if not hasattr(StateVectorC128, name):
-                params.append([])
-                mats.append(qml.matrix(single_op))
-
-                if is_inverse:
-                    is_inverse = False
-            else:
-                params.append(single_op.parameters)
-                mats.append([])
+        is_inverse = o.inverse
+
+        name = o.name if not is_inverse else o.name[:-4]
+        names.append(name)
+
+        generator = _op_generator(o)
+        if generator is not None:
+            # Differentiable matrix operation, inverted by the backend
+            base = copy.copy(o)
+            base.inverse = False
+            params.append(o.parameters)
+            mats.append(qml.matrix(base))
+            generators.append(generator)
+            pauli_words.append("")
+        elif not _op_has_kernel(o):
+            params.append([])
+            mats.append(qml.matrix(o))
+            generators.append([])
+            pauli_words.append("")
+
+            if is_inverse:
+                is_inverse = False
+        elif name == "PauliRot":
+            params.append(o.parameters)
+            mats.append([])
+            generators.append([])
+            pauli_words.append(o.hyperparameters["pauli_word"])
+        else:
+            params.append(o.parameters)
+            mats.append([])
+            generators.append([])
+            pauli_words.append("")
 
-            wires_list = single_op.wires.tolist()
-            wires.append([wires_map[w] for w in wires_list])
-            inverses.append(is_inverse)
+        wires_list = o.wires.tolist()
+        wires.append([wires_map[w] for w in wires_list])
+        inverses.append(is_inverse)
 
-    return (names, params, wires, inverses, mats), uses_stateprep
+    return (names, params, wires, inverses, mats, generators, pauli_words), uses_stateprep
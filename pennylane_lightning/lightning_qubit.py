@@ -30,6 +30,7 @@ from pennylane import (
     Projector,
     Hermitian,
     Rot,
+    CRot,
     QuantumFunctionError,
     DeviceError,
 )
@@ -47,20 +48,29 @@ from ._version import __version__
 try:
     from .lightning_qubit_ops import (
         MeasuresC64,
+        SparseHamiltonianC64,
         StateVectorC64,
         AdjointJacobianC64,
         VectorJacobianProductC64,
         MeasuresC128,
+        SparseHamiltonianC128,
         StateVectorC128,
         AdjointJacobianC128,
         VectorJacobianProductC128,
+        ThreadingConfig,
         allocate_aligned_array,
         get_alignment,
         best_alignment,
         Kokkos_info,
     )
 
-    from ._serialize import _serialize_obs, _serialize_ops
+    from ._serialize import (
+        _op_generator,
+        _op_has_kernel,
+        _serialize_obs,
+        _serialize_ops,
+        _serialize_trainable_params,
+    )
 
     CPP_BINARY_AVAILABLE = True
 except ModuleNotFoundError:
@@ -95,6 +105,16 @@ class LightningQubit(DefaultQubit):
             to ``None`` results in computing statistics like expectation values and
             variances analytically.
         c_dtype: Datatypes for statevector representation. Must be one of ``np.complex64`` or ``np.complex128``.
+        num_threads (int): Number of threads of the kernels, measurements and gradients. Defaults
+            to ``None``, which uses ``OMP_NUM_THREADS``.
+        cpu_set (Sequence[int]): CPUs the threads are pinned to, one per thread in turn. Defaults
+            to ``None``, which leaves the affinity of the threads untouched.
+        sequential_below_num_qubits (int): Circuits with fewer wires are simulated by a single
+            thread. Defaults to ``0``.
+        clifford_prefix (bool): Whether a leading Clifford section of a circuit starting from a
+            computational basis state is simulated by a stabilizer tableau. Worth enabling for
+            circuits starting with long Clifford sections, as checking for a basis state takes a
+            pass over the statevector. Defaults to ``False``.
     """
 
     name = "Lightning Qubit PennyLane plugin"
@@ -105,7 +125,18 @@ class LightningQubit(DefaultQubit):
     _CPP_BINARY_AVAILABLE = True
     operations = _remove_snapshot_from_operations(DefaultQubit.operations)
 
-    def __init__(self, wires, *, c_dtype=np.complex128, shots=None, batch_obs=False):
+    def __init__(
+        self,
+        wires,
+        *,
+        c_dtype=np.complex128,
+        shots=None,
+        batch_obs=False,
+        num_threads=None,
+        cpu_set=None,
+        sequential_below_num_qubits=0,
+        clifford_prefix=False,
+    ):
         if c_dtype is np.complex64:
             r_dtype = np.float32
             self.use_csingle = True
@@ -116,6 +147,22 @@ class LightningQubit(DefaultQubit):
             raise TypeError(f"Unsupported complex Type: {c_dtype}")
         super().__init__(wires, r_dtype=r_dtype, c_dtype=c_dtype, shots=shots)
         self._batch_obs = batch_obs
+        self._clifford_prefix = clifford_prefix
+        self._threading_config = ThreadingConfig(
+            num_threads=num_threads or 0,
+            cpu_set=list(cpu_set or []),
+            sequential_below_num_qubits=sequential_below_num_qubits,
+        )
+        # Sparse matrix of the last measured SparseHamiltonian and its prebuilt operator,
+        # reused while the same matrix object is measured
+        self._sparse_hamiltonian_cache = (None, None)
+
+    def _state_vector(self, data):
+        """Create a statevector over the given data with the threading configuration of the
+        device."""
+        sim = StateVectorC64(data) if self.use_csingle else StateVectorC128(data)
+        sim.setThreadingConfig(self._threading_config)
+        return sim
 
     @staticmethod
     def _asarray(arr, dtype=None):
@@ -145,8 +192,56 @@ class LightningQubit(DefaultQubit):
         capabilities.pop("passthru_devices", None)
         return capabilities
 
+    def _apply_state_vector(self, state, device_wires):
+        """Initialize the internal state vector in a specified state.
+
+        The state is written in place by a C++ kernel, scattering the amplitudes of a
+        sub-register without building a full-size temporary.
+
+        Args:
+            state (array[complex]): normalized input state of length ``2**len(wires)``
+            device_wires (Wires): wires that get initialized in the state
+        """
+        device_wires = self.map_wires(device_wires)
+        state = self._asarray(state, dtype=self.C_DTYPE)
+
+        if len(state.shape) != 1 or state.shape[0] != 2 ** len(device_wires):
+            raise ValueError("State vector must be of length 2**wires.")
+        if not np.allclose(np.linalg.norm(state, ord=2), 1.0, atol=1e-6):
+            raise ValueError("Sum of amplitudes-squared does not equal one.")
+
+        state_vector = np.ravel(self._state)
+        sim = self._state_vector(state_vector)
+        sim.setStateVector(state, device_wires.tolist())
+
+    def _apply_basis_state(self, state, wires):
+        """Initialize the internal state vector in a specified computational basis state.
+
+        The state is written in place by a C++ kernel instead of allocating a new array.
+
+        Args:
+            state (array[int]): computational basis state of shape ``(wires,)``
+                consisting of 0s and 1s.
+            wires (Wires): wires that the provided computational state should be initialized on
+        """
+        device_wires = self.map_wires(wires)
+        state = np.asarray(state)
+
+        if not set(state.tolist()).issubset({0, 1}):
+            raise ValueError("BasisState parameter must consist of 0 or 1 integers.")
+        if len(state) != len(device_wires):
+            raise ValueError("BasisState parameter and wires must be of equal length.")
+
+        # The index of the basis state, wire 0 being the most significant bit
+        basis_states = 2 ** (self.num_wires - 1 - np.array(device_wires))
+        num = int(np.dot(state, basis_states))
+
+        state_vector = np.ravel(self._state)
+        sim = self._state_vector(state_vector)
+        sim.setBasisState(num)
+
     def apply(self, operations, rotations=None, **kwargs):
-        # State preparation is currently done in Python
+        # State preparation overwrites the state in place
         if operations:  # make sure operations[0] exists
             if isinstance(operations[0], QubitStateVector):
                 self._apply_state_vector(operations[0].parameters[0].copy(), operations[0].wires)
@@ -189,12 +284,15 @@ class LightningQubit(DefaultQubit):
         """
         state_vector = np.ravel(state)
 
-        if self.use_csingle:
-            # use_csingle
-            sim = StateVectorC64(state_vector)
-        else:
-            # self.C_DTYPE is np.complex128 by default
-            sim = StateVectorC128(state_vector)
+        sim = self._state_vector(state_vector)
+
+        # SWAP gates only relabel the wires until the loop is over. Gates are
+        # applied as they arrive, so invalid gates are reported at once. If
+        # enabled, a leading Clifford section starting from a basis state is
+        # simulated by a stabilizer tableau
+        sim.setLazySwaps(True)
+        if self._clifford_prefix:
+            sim.beginCliffordPrefix()
 
         # Skip over identity operations instead of performing
         # matrix multiplication with the identity.
@@ -219,8 +317,12 @@ class LightningQubit(DefaultQubit):
             else:
                 inv = o.inverse
                 param = o.parameters
-                method(wires, inv, param)
+                if name == "PauliRot":
+                    method(wires, inv, param, o.hyperparameters["pauli_word"])
+                else:
+                    method(wires, inv, param)
 
+        sim.canonicalizeWires()
         return np.reshape(state_vector, state.shape)
 
     def adjoint_diff_support_check(self, tape):
@@ -257,12 +359,28 @@ class LightningQubit(DefaultQubit):
                         "Lightning adjoint differentiation method does not currently support the Hermitian observable"
                     )
 
+        trainable_params = set(tape.trainable_params)
+        param_idx = 0
         for op in tape.operations:
-            if op.num_params > 1 and not isinstance(op, Rot):
+            if op.num_params > 1 and not isinstance(op, (Rot, CRot)):
                 raise QuantumFunctionError(
                     f"The {op.name} operation is not supported using "
                     'the "adjoint" differentiation method'
                 )
+            # Matrix operations without a generator can only be undone
+            op_params = range(param_idx, param_idx + op.num_params)
+            param_idx += op.num_params
+            if isinstance(op, (BasisState, QubitStateVector)):
+                continue
+            if (
+                not _op_has_kernel(op)
+                and _op_generator(op) is None
+                and trainable_params.intersection(op_params)
+            ):
+                raise QuantumFunctionError(
+                    f"The trainable {op.name} operation is not supported using "
+                    'the "adjoint" differentiation method'
+                )
 
     def adjoint_jacobian(self, tape, starting_state=None, use_device_state=False):
         if self.shots is not None:
@@ -280,7 +398,8 @@ class LightningQubit(DefaultQubit):
 
         # Initialization of state
         if starting_state is not None:
-            ket = np.ravel(starting_state)
+            # The statevector wraps the array without conversion
+            ket = self._asarray(np.ravel(starting_state), dtype=self.C_DTYPE)
         else:
             if not use_device_state:
                 self.reset()
@@ -291,25 +410,23 @@ class LightningQubit(DefaultQubit):
             adj = AdjointJacobianC64()
         else:
             adj = AdjointJacobianC128()
+        adj.set_threading_config(self._threading_config)
 
         obs_serialized = _serialize_obs(tape, self.wire_map, use_csingle=self.use_csingle)
-        ops_serialized, use_sp = _serialize_ops(tape, self.wire_map)
+        ops_serialized, _ = _serialize_ops(tape, self.wire_map)
 
         ops_serialized = adj.create_ops_list(*ops_serialized)
 
-        trainable_params = sorted(tape.trainable_params)
-        first_elem = 1 if trainable_params[0] == 0 else 0
-
-        tp_shift = (
-            trainable_params if not use_sp else [i - 1 for i in trainable_params[first_elem:]]
-        )  # exclude first index if explicitly setting sv
+        tp_shift = _serialize_trainable_params(tape)
 
-        state_vector = StateVectorC64(ket) if self.use_csingle else StateVectorC128(ket)
+        state_vector = self._state_vector(ket)
 
         # If requested batching over observables, chunk into OMP_NUM_THREADS sized chunks.
         # This will allow use of Lightning with adjoint for large-qubit numbers AND large
         # numbers of observables, enabling choice between compute time and memory use.
-        requested_threads = int(getenv("OMP_NUM_THREADS", "1"))
+        requested_threads = self._threading_config.num_threads or int(
+            getenv("OMP_NUM_THREADS", "1")
+        )
 
         if self._batch_obs and requested_threads > 1:
             obs_partitions = _chunk_iterable(obs_serialized, requested_threads)
@@ -420,7 +537,7 @@ class LightningQubit(DefaultQubit):
 
             # Initialization of state
             if starting_state is not None:
-                ket = np.ravel(starting_state)
+                ket = self._asarray(np.ravel(starting_state), dtype=self.C_DTYPE)
             else:
                 if not use_device_state:
                     self.reset()
@@ -428,18 +545,13 @@ class LightningQubit(DefaultQubit):
                 ket = np.ravel(self._pre_rotated_state)
 
             obs_serialized = _serialize_obs(tape, self.wire_map, use_csingle=self.use_csingle)
-            ops_serialized, use_sp = _serialize_ops(tape, self.wire_map)
+            ops_serialized, _ = _serialize_ops(tape, self.wire_map)
 
             ops_serialized = V.create_ops_list(*ops_serialized)
 
-            trainable_params = sorted(tape.trainable_params)
-            first_elem = 1 if trainable_params[0] == 0 else 0
-
-            tp_shift = (
-                trainable_params if not use_sp else [i - 1 for i in trainable_params[first_elem:]]
-            )  # exclude first index if explicitly setting sv
+            tp_shift = _serialize_trainable_params(tape)
 
-            state_vector = StateVectorC64(ket) if self.use_csingle else StateVectorC128(ket)
+            state_vector = self._state_vector(ket)
 
             return fn(state_vector, obs_serialized, ops_serialized, tp_shift)
 
@@ -527,11 +639,32 @@ class LightningQubit(DefaultQubit):
         dtype = self._state.dtype
         ket = np.ravel(self._state)
 
-        state_vector = StateVectorC64(ket) if self.use_csingle else StateVectorC128(ket)
+        state_vector = self._state_vector(ket)
         M = MeasuresC64(state_vector) if self.use_csingle else MeasuresC128(state_vector)
 
         return M.probs(device_wires)
 
+    def density_matrix(self, wires):
+        """Returns the reduced density matrix over the given wires.
+
+        The other wires are traced out in C++, without copying or reshaping
+        the state in Python.
+
+        Args:
+            wires (Wires): wires of the reduced system
+
+        Returns:
+            array[complex]: complex array of shape ``(2 ** len(wires), 2 ** len(wires))``
+            representing the reduced density matrix of the state prior to measurement.
+        """
+        device_wires = self.map_wires(Wires(wires))
+        ket = np.ravel(self._state)
+
+        state_vector = self._state_vector(ket)
+        M = MeasuresC64(state_vector) if self.use_csingle else MeasuresC128(state_vector)
+
+        return M.density_matrix(device_wires)
+
     def generate_samples(self):
         """Generate samples
 
@@ -542,7 +675,7 @@ class LightningQubit(DefaultQubit):
         # Initialization of state
         ket = np.ravel(self._state)
 
-        state_vector = StateVectorC64(ket) if self.use_csingle else StateVectorC128(ket)
+        state_vector = self._state_vector(ket)
         M = MeasuresC64(state_vector) if self.use_csingle else MeasuresC128(state_vector)
 
         return M.generate_samples(len(self.wires), self.shots).astype(int)
@@ -578,24 +711,38 @@ class LightningQubit(DefaultQubit):
         # Initialization of state
         ket = np.ravel(self._pre_rotated_state)
 
-        state_vector = StateVectorC64(ket) if self.use_csingle else StateVectorC128(ket)
+        state_vector = self._state_vector(ket)
         M = MeasuresC64(state_vector) if self.use_csingle else MeasuresC128(state_vector)
         if observable.name == "SparseHamiltonian":
-            if Kokkos_info()["USE_KOKKOS"] == True:
-                # converting COO to CSR sparse representation.
-                CSR_SparseHamiltonian = observable.data[0].tocsr(copy=False)
-                return M.expval(
-                    CSR_SparseHamiltonian.indptr,
-                    CSR_SparseHamiltonian.indices,
-                    CSR_SparseHamiltonian.data,
-                )
-            return super().expval(observable, shot_range=shot_range, bin_size=bin_size)
+            return M.expval(self._sparse_hamiltonian(observable.data[0]))
 
         # translate to wire labels used by device
         observable_wires = self.map_wires(observable.wires)
 
         return M.expval(observable.name, observable_wires)
 
+    def _sparse_hamiltonian(self, matrix):
+        """Return the prebuilt operator of a sparse matrix, building it only when the matrix is
+        not the one measured last. A matrix modified in place requires a call to
+        :meth:`clear_sparse_hamiltonian_cache`."""
+        cached_matrix, hamiltonian = self._sparse_hamiltonian_cache
+        if cached_matrix is not matrix:
+            # converting COO to CSR sparse representation. Neither step copies a CSR matrix
+            # of the device precision.
+            csr_matrix = matrix.tocsr(copy=False)
+            data = csr_matrix.data
+            if data.dtype != self.C_DTYPE:
+                data = data.astype(self.C_DTYPE)
+            sparse_type = SparseHamiltonianC64 if self.use_csingle else SparseHamiltonianC128
+            hamiltonian = sparse_type(csr_matrix.indptr, csr_matrix.indices, data)
+            self._sparse_hamiltonian_cache = (matrix, hamiltonian)
+        return hamiltonian
+
+    def clear_sparse_hamiltonian_cache(self):
+        """Discard the operator prebuilt for the last measured ``SparseHamiltonian``, so that
+        it is rebuilt from its matrix by the next measurement."""
+        self._sparse_hamiltonian_cache = (None, None)
+
     def var(self, observable, shot_range=None, bin_size=None):
         """Variance of the supplied observable.
 
@@ -626,7 +773,7 @@ class LightningQubit(DefaultQubit):
         # Initialization of state
         ket = np.ravel(self._pre_rotated_state)
 
-        state_vector = StateVectorC64(ket) if self.use_csingle else StateVectorC128(ket)
+        state_vector = self._state_vector(ket)
         M = MeasuresC64(state_vector) if self.use_csingle else MeasuresC128(state_vector)
 
         # translate to wire labels used by device
@@ -13,10 +13,16 @@
 // limitations under the License.
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <complex>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -25,11 +31,20 @@
 #include "DynamicDispatcher.hpp"
 #include "Error.hpp"
 #include "JacobianTape.hpp"
+#include "KernelMap.hpp"
 #include "LinearAlgebra.hpp"
+#include "Measures.hpp"
 #include "StateVectorManagedCPU.hpp"
+#include "Threading.hpp"
+#include "Trace.hpp"
+#include "TypeTraits.hpp"
 
 #include <iostream>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 /// @cond DEV
 namespace {
 
@@ -40,6 +55,32 @@ using namespace Pennylane::Util;
 /// @endcond
 
 namespace Pennylane::Algorithms {
+/**
+ * @brief Parallelisation strategy of the adjoint Jacobian.
+ */
+enum class AdjointParallelism : uint8_t {
+    Auto, /**< Choose based on the number of observables, qubits, and threads */
+    Observables, /**< Distribute observables over threads. Each gate is
+                    applied using a single thread. */
+    Elements,    /**< Process observables one by one. Each gate is applied
+                    using all threads. */
+    Nested,      /**< Distribute observables over teams of threads. Each gate
+                    is applied using the threads of a team. */
+};
+
+/**
+ * @brief Results of AdjointJacobian::execute.
+ *
+ * @tparam T Floating-point precision.
+ */
+template <class T> struct ExecutionResults {
+    std::vector<T> expvals;   /**< One per observable */
+    std::vector<T> variances; /**< One per observable, if requested */
+    std::vector<T> probs;     /**< Probabilities of the requested wires */
+    std::vector<T> jacobian;  /**< Row-major Jacobian, if the tape has
+                                 trainable parameters */
+};
+
 /**
  * @brief Represent the logic for the adjoint Jacobian method of
  * arXiV:2009.02823
@@ -52,6 +93,180 @@ template <class T = double> class AdjointJacobian {
                                    const std::vector<size_t> &,
                                    const bool); // function pointer type
 
+    /**
+     * @brief Number of threads used at each level of the backward pass.
+     */
+    struct Schedule {
+        size_t num_obs_threads{1};  /**< Threads distributing observables */
+        size_t num_elem_threads{1}; /**< Threads applying each gate */
+
+        [[nodiscard]] auto threading() const -> Threading {
+            return (num_elem_threads > 1) ? Threading::MultiThread
+                                          : Threading::SingleThread;
+        }
+    };
+
+    /**
+     * @brief Single-parameter gate of the decomposition of a
+     * multi-parameter operation, on the wires of the operation.
+     */
+    struct ParamGate {
+        Gates::GateOperation gate_op;
+        Gates::GeneratorOperation gntr_op;
+        size_t param_idx; /**< Parameter of the operation used by the gate */
+    };
+
+    /**
+     * @brief Get the decomposition of a multi-parameter operation into
+     * single-parameter gates, in the order they are applied.
+     *
+     * @param op_name Name of the operation.
+     * @return The gates, or std::nullopt if the operation is not supported.
+     */
+    static auto paramGates(const std::string &op_name)
+        -> std::optional<std::array<ParamGate, 3>> {
+        using Gates::GateOperation;
+        using Gates::GeneratorOperation;
+        // Rot(phi, theta, omega) = RZ(omega) RY(theta) RZ(phi)
+        if (op_name == "Rot") {
+            return std::array<ParamGate, 3>{
+                ParamGate{GateOperation::RZ, GeneratorOperation::RZ, 0},
+                ParamGate{GateOperation::RY, GeneratorOperation::RY, 1},
+                ParamGate{GateOperation::RZ, GeneratorOperation::RZ, 2}};
+        }
+        if (op_name == "CRot") {
+            return std::array<ParamGate, 3>{
+                ParamGate{GateOperation::CRZ, GeneratorOperation::CRZ, 0},
+                ParamGate{GateOperation::CRY, GeneratorOperation::CRY, 1},
+                ParamGate{GateOperation::CRZ, GeneratorOperation::CRZ, 2}};
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Enable nested parallel regions with the given number of inner
+     * threads for the lifetime of the object.
+     */
+    class NestedThreadsGuard {
+      private:
+#if defined(_OPENMP)
+        int max_threads_;
+        int max_active_levels_;
+#endif
+
+      public:
+        explicit NestedThreadsGuard(
+            [[maybe_unused]] size_t num_inner_threads) {
+#if defined(_OPENMP)
+            max_threads_ = omp_get_max_threads();
+            max_active_levels_ = omp_get_max_active_levels();
+            // Nested regions inherit the thread count of the enclosing task.
+            omp_set_num_threads(static_cast<int>(num_inner_threads));
+            omp_set_max_active_levels(std::max(max_active_levels_, 2));
+#endif
+        }
+        NestedThreadsGuard(const NestedThreadsGuard &) = delete;
+        NestedThreadsGuard(NestedThreadsGuard &&) = delete;
+        NestedThreadsGuard &operator=(const NestedThreadsGuard &) = delete;
+        NestedThreadsGuard &operator=(NestedThreadsGuard &&) = delete;
+        ~NestedThreadsGuard() {
+#if defined(_OPENMP)
+            omp_set_max_active_levels(max_active_levels_);
+            omp_set_num_threads(max_threads_);
+#endif
+        }
+    };
+
+    /**
+     * @brief States stored during the forward pass, from which the states
+     * of the backward pass are recomputed instead of applying inverse
+     * operations.
+     *
+     * The pool holds the state before every `interval`-th operation,
+     * followed by a buffer for the states within the segment of `interval`
+     * operations currently swept by the backward pass. It is local to a
+     * call and takes its data from the buffer pool of the temporary
+     * statevectors.
+     */
+    struct Checkpoints {
+        using Pool = std::vector<std::complex<T>,
+                                 Util::AlignedAllocator<std::complex<T>>>;
+        size_t interval; /**< Number of operations between checkpoints */
+        size_t num_ops;  /**< Number of operations of the tape */
+        size_t length;   /**< Length of each state */
+        size_t segment;  /**< Segment whose states are in the buffer */
+        Pool pool;
+
+        [[nodiscard]] auto numSegments() const -> size_t {
+            return (num_ops + interval - 1) / interval;
+        }
+    };
+
+    AdjointParallelism parallelism_{AdjointParallelism::Auto};
+    size_t checkpoint_interval_{0};
+    Util::BufferPool *buffer_pool_{&Util::BufferPool::global()};
+    ThreadingConfig threading_config_;
+
+    /**
+     * @brief Apply the threading configuration for the statevector of the
+     * given data until the returned scope is destroyed.
+     */
+    [[nodiscard]] auto threadingScope(const JacobianData<T> &jd) const
+        -> ThreadingScope {
+        return {threading_config_, Util::log2(jd.getSizeStateVec())};
+    }
+
+    /**
+     * @brief Create a temporary statevector in the |0...0> state, whose data
+     * is taken from and returned to the buffer pool.
+     *
+     * @param num_qubits Number of qubits.
+     * @param threading Threading of the statevector.
+     */
+    auto makeTemporaryState(size_t num_qubits, Threading threading) const
+        -> StateVectorManagedCPU<T> {
+        return {num_qubits, threading, bestCPUMemoryModel(),
+                bestNUMAPolicy(threading), Util::HugePagePolicy::Disabled,
+                buffer_pool_};
+    }
+
+    /**
+     * @brief Get the number of threads available to the adjoint method.
+     */
+    static auto getMaxNumThreads() -> size_t {
+#if defined(_OPENMP)
+        return static_cast<size_t>(omp_get_max_threads());
+#else
+        return 1;
+#endif
+    }
+
+    /**
+     * @brief Compute the thread counts of the backward pass.
+     *
+     * @param num_qubits Number of qubits.
+     * @param num_observables Number of observables processed together.
+     */
+    [[nodiscard]] auto getSchedule(size_t num_qubits,
+                                   size_t num_observables) const -> Schedule {
+        const size_t num_threads = getMaxNumThreads();
+        const AdjointParallelism parallelism =
+            (parallelism_ == AdjointParallelism::Auto)
+                ? chooseParallelism(num_qubits, num_observables, num_threads)
+                : parallelism_;
+        switch (parallelism) {
+        case AdjointParallelism::Elements:
+            return {1, num_threads};
+        case AdjointParallelism::Nested: {
+            const size_t num_obs_threads =
+                std::clamp<size_t>(num_observables, 1, num_threads);
+            return {num_obs_threads, num_threads / num_obs_threads};
+        }
+        default:
+            return {num_threads, 1};
+        }
+    }
+
     /**
      * @brief Utility method to update the Jacobian at a given index by
      * calculating the overlap between two given states.
@@ -84,28 +299,97 @@ template <class T = double> class AdjointJacobian {
     inline void applyOperations(StateVectorManagedCPU<T> &state,
                                 const OpsData<T> &operations,
                                 bool adj = false) {
-        for (size_t op_idx = 0; op_idx < operations.getOpsName().size();
-             op_idx++) {
-            state.applyOperation(operations.getOpsName()[op_idx],
-                                 operations.getOpsWires()[op_idx],
-                                 operations.getOpsInverses()[op_idx] ^ adj,
-                                 operations.getOpsParams()[op_idx]);
+        const CompiledOps<T> compiled(operations, state);
+        for (size_t op_idx = 0; op_idx < operations.getSize(); op_idx++) {
+            compiled.apply(state, op_idx, adj);
         }
     }
     /**
-     * @brief Utility method to apply the adjoint indexed operation from
-     * `%OpsData<T>` object to `%StateVectorManagedCPU<T>`.
+     * @brief Apply all operations, storing the state before every
+     * `checkpoint_interval_`-th operation.
      *
      * @param state Statevector to be updated.
      * @param operations Operations to apply.
+     * @param checkpoints Storage of the checkpoints.
+     */
+    void applyOperationsWithCheckpoints(
+        StateVectorManagedCPU<T> &state, const OpsData<T> &operations,
+        std::optional<Checkpoints> &checkpoints) {
+        const size_t num_ops = operations.getOpsName().size();
+        const size_t length = state.getLength();
+        Checkpoints &ckpt = checkpoints.emplace(Checkpoints{
+            checkpoint_interval_, num_ops, length, 0,
+            typename Checkpoints::Pool(
+                getNumCheckpointStates(num_ops, checkpoint_interval_) * length,
+                getAllocator<std::complex<T>>(
+                    state.memoryModel(), bestNUMAPolicy(state.threading()),
+                    Util::HugePagePolicy::Disabled, buffer_pool_))});
+
+        const CompiledOps<T> compiled(operations, state);
+        for (size_t op_idx = 0; op_idx < ckpt.num_ops; op_idx++) {
+            if (op_idx % ckpt.interval == 0) {
+                const std::complex<T> *data = state.getData();
+                std::copy(data, data + ckpt.length,
+                          ckpt.pool.data() +
+                              (op_idx / ckpt.interval) * ckpt.length);
+            }
+            compiled.apply(state, op_idx);
+        }
+    }
+
+    /**
+     * @brief Set the statevector to the state before the indexed operation
+     * using the checkpoints.
+     *
+     * Operations are visited in decreasing order by the backward pass. On
+     * entering a segment, its states are recomputed from its checkpoint
+     * into the buffer, so each operation is applied at most once more than
+     * in the forward pass.
+     *
+     * @param state Statevector to be updated.
+     * @param operations Operations of the tape, compiled for the state.
+     * @param op_idx Operation index.
+     * @param ckpt Checkpoints of the forward pass.
+     */
+    static void restoreCheckpoint(StateVectorManagedCPU<T> &state,
+                                  const CompiledOps<T> &operations,
+                                  size_t op_idx, Checkpoints &ckpt) {
+        const size_t num_segments = ckpt.numSegments();
+        const size_t segment = op_idx / ckpt.interval;
+        const size_t seg_begin = segment * ckpt.interval;
+        const auto slot = [&](size_t idx) {
+            const size_t pos = (idx == seg_begin)
+                                   ? segment
+                                   : num_segments + idx - seg_begin - 1;
+            return ckpt.pool.data() + pos * ckpt.length;
+        };
+
+        std::complex<T> *data = state.getData();
+        if (segment != ckpt.segment) {
+            const size_t seg_end =
+                std::min(seg_begin + ckpt.interval, ckpt.num_ops);
+            std::copy(slot(seg_begin), slot(seg_begin) + ckpt.length, data);
+            for (size_t idx = seg_begin + 1; idx < seg_end; idx++) {
+                operations.apply(state, idx - 1);
+                std::copy(data, data + ckpt.length, slot(idx));
+            }
+            ckpt.segment = segment;
+        }
+        std::copy(slot(op_idx), slot(op_idx) + ckpt.length, data);
+    }
+
+    /**
+     * @brief Utility method to apply the adjoint indexed operation from
+     * `%CompiledOps<T>` object to `%StateVectorManagedCPU<T>`.
+     *
+     * @param state Statevector to be updated.
+     * @param operations Operations to apply, compiled for the state.
      * @param op_idx Adjointed operation index to apply.
      */
     inline void applyOperationAdj(StateVectorManagedCPU<T> &state,
-                                  const OpsData<T> &operations, size_t op_idx) {
-        state.applyOperation(operations.getOpsName()[op_idx],
-                             operations.getOpsWires()[op_idx],
-                             !operations.getOpsInverses()[op_idx],
-                             operations.getOpsParams()[op_idx]);
+                                  const CompiledOps<T> &operations,
+                                  size_t op_idx) {
+        operations.apply(state, op_idx, true);
     }
 
     /**
@@ -117,36 +401,21 @@ template <class T = double> class AdjointJacobian {
      */
     inline void applyObservable(StateVectorManagedCPU<T> &state,
                                 const ObsDatum<T> &observable) {
-        using namespace Pennylane::Util;
-        for (size_t j = 0; j < observable.getSize(); j++) {
-            if (!observable.getObsParams().empty()) {
-                std::visit(
-                    [&](const auto &param) {
-                        using p_t = std::decay_t<decltype(param)>;
-                        // Apply supported gate with given params
-                        if constexpr (std::is_same_v<p_t, std::vector<T>>) {
-                            state.applyOperation(observable.getObsName()[j],
-                                                 observable.getObsWires()[j],
-                                                 false, param);
-                        }
-                        // Apply provided matrix
-                        else if constexpr (std::is_same_v<
-                                               p_t,
-                                               std::vector<std::complex<T>>>) {
-                            state.applyMatrix(
-                                param, observable.getObsWires()[j], false);
-                        } else {
-                            state.applyOperation(observable.getObsName()[j],
-                                                 observable.getObsWires()[j],
-                                                 false);
-                        }
-                    },
-                    observable.getObsParams()[j]);
-            } else { // Offload to SV dispatcher if no parameters provided
-                state.applyOperation(observable.getObsName()[j],
-                                     observable.getObsWires()[j], false);
-            }
-        }
+        Algorithms::applyObservable(state, observable);
+    }
+
+    /**
+     * @brief Utility method to apply a given observable to a statevector,
+     * writing the result to another statevector.
+     *
+     * @param state Statevector to which the observable is applied.
+     * @param out Statevector receiving the result.
+     * @param observable Observable to apply.
+     */
+    inline void applyObservable(const StateVectorManagedCPU<T> &state,
+                                StateVectorManagedCPU<T> &out,
+                                const ObsDatum<T> &observable) {
+        Algorithms::applyObservable(state, out, observable);
     }
 
     /**
@@ -156,11 +425,14 @@ template <class T = double> class AdjointJacobian {
      * @param states Vector of statevector copies, one per observable.
      * @param reference_state Reference statevector
      * @param observables Vector of observables to apply to each statevector.
+     * @param num_threads Number of threads distributing the observables.
      */
     inline void
     applyObservables(std::vector<StateVectorManagedCPU<T>> &states,
                      const StateVectorManagedCPU<T> &reference_state,
-                     const std::vector<ObsDatum<T>> &observables) {
+                     const std::vector<ObsDatum<T>> &observables,
+                     [[maybe_unused]] size_t num_threads) {
+        PL_TRACE_SCOPE("observables", "adjoint");
         // clang-format off
         // Globally scoped exception value to be captured within OpenMP block.
         // See the following for OpenMP design decisions:
@@ -168,15 +440,16 @@ template <class T = double> class AdjointJacobian {
         std::exception_ptr ex = nullptr;
         size_t num_observables = observables.size();
         #if defined(_OPENMP)
-            #pragma omp parallel default(none)                                 \
+            #pragma omp parallel default(none) num_threads(num_threads)        \
             shared(states, reference_state, observables, ex, num_observables)
         {
             #pragma omp for
         #endif
             for (size_t h_i = 0; h_i < num_observables; h_i++) {
                 try {
-                    states[h_i].updateData(reference_state.getDataVector());
-                    applyObservable(states[h_i], observables[h_i]);
+                    PL_TRACE_SCOPE("observable", "adjoint");
+                    applyObservable(reference_state, states[h_i],
+                                    observables[h_i]);
                 } catch (...) {
                     #if defined(_OPENMP)
                         #pragma omp critical
@@ -203,14 +476,23 @@ template <class T = double> class AdjointJacobian {
      * @brief OpenMP accelerated application of adjoint operations to
      * statevectors.
      *
+     * Gates are applied to all statevectors by a single dispatcher call.
+     *
      * @param states Vector of all statevectors; 1 per observable
-     * @param operations Operations list.
+     * @param operations Operations list, compiled for the statevectors.
      * @param op_idx Index of given operation within operations list to take
      * adjoint of.
+     * @param num_threads Number of threads distributing the statevectors.
      */
     inline void
     applyOperationsAdj(std::vector<StateVectorManagedCPU<T>> &states,
-                       const OpsData<T> &operations, size_t op_idx) {
+                       const CompiledOps<T> &operations, size_t op_idx,
+                       [[maybe_unused]] size_t num_threads) {
+        if (operations.isGate(op_idx)) {
+            PL_TRACE_SCOPE("adjoint operation", "adjoint");
+            operations.applyBatch(states, op_idx, true, num_threads);
+            return;
+        }
         // clang-format off
         // Globally scoped exception value to be captured within OpenMP block.
         // See the following for OpenMP design decisions:
@@ -218,13 +500,14 @@ template <class T = double> class AdjointJacobian {
         std::exception_ptr ex = nullptr;
         size_t num_states = states.size();
         #if defined(_OPENMP)
-            #pragma omp parallel default(none)                                 \
+            #pragma omp parallel default(none) num_threads(num_threads)        \
                 shared(states, operations, op_idx, ex, num_states)
         {
             #pragma omp for
         #endif
             for (size_t obs_idx = 0; obs_idx < num_states; obs_idx++) {
                 try {
+                    PL_TRACE_SCOPE("adjoint operation", "adjoint");
                     applyOperationAdj(states[obs_idx], operations, op_idx);
                 } catch (...) {
                     #if defined(_OPENMP)
@@ -274,89 +557,218 @@ template <class T = double> class AdjointJacobian {
     }
 
     /**
-     * @brief Applies the gate generator for a given parameteric gate. Returns
-     * the associated scaling coefficient.
+     * @brief Get the data pointers of the statevectors.
+     */
+    static auto
+    dataPointers(const std::vector<StateVectorManagedCPU<T>> &states)
+        -> std::vector<const std::complex<T> *> {
+        std::vector<const std::complex<T> *> ptrs;
+        ptrs.reserve(states.size());
+        for (const auto &state : states) {
+            ptrs.emplace_back(state.getData());
+        }
+        return ptrs;
+    }
+
+    /**
+     * @brief Store @f$-2 s \mathrm{Im}\langle H_\lambda | \mu \rangle@f$
+     * for each observable, where @f$|\mu\rangle@f$ is lambda with the
+     * generator applied to it.
      *
-     * @param sv Statevector data to operate upon.
-     * @param op_name Name of parametric gate.
-     * @param wires Wires to operate upon.
-     * @param adj Indicate whether to take the adjoint of the operation.
-     * @return T Generator scaling coefficient.
+     * All inner products are computed in one blocked pass, so that mu is
+     * read once rather than once per observable.
+     *
+     * @param jac Jacobian receiving the values.
+     * @param row_idx Index of the result of the first observable.
+     * @param obs_stride Distance between the results of consecutive
+     * observables.
+     * @param H_lambda Observables applied to lambda.
+     * @param mu Generator applied to lambda.
+     * @param scaling_factor Scaling factor @f$s@f$ of the generator.
+     * @param num_threads Number of threads to use.
      */
-    template <class SVType>
-    inline auto applyGenerator(StateVectorBase<T, SVType> &sv,
-                               const std::string &op_name,
-                               const std::vector<size_t> &wires, const bool adj)
-        -> T {
-        return sv.applyGenerator(op_name, wires, adj);
+    static void
+    updateJacobianState(std::vector<T> &jac, size_t row_idx,
+                        size_t obs_stride,
+                        const std::vector<StateVectorManagedCPU<T>> &H_lambda,
+                        const StateVectorManagedCPU<T> &mu, T scaling_factor,
+                        size_t num_threads) {
+        const auto H_ptrs = dataPointers(H_lambda);
+        std::vector<std::complex<T>> prods(H_lambda.size());
+        innerProdsC(H_ptrs.data(), H_ptrs.size(), mu.getData(),
+                    mu.getLength(), prods.data(), num_threads);
+        for (size_t obs_idx = 0; obs_idx < prods.size(); obs_idx++) {
+            jac[row_idx + obs_idx * obs_stride] =
+                -2 * scaling_factor * std::imag(prods[obs_idx]);
+        }
     }
 
-  public:
-    AdjointJacobian() = default;
+    /**
+     * @brief Store the same values as updateJacobianState() for a generator
+     * which is a controlled Pauli string, reading lambda in place of a copy
+     * with the generator applied.
+     *
+     * @param jac Jacobian receiving the values.
+     * @param row_idx Index of the result of the first observable.
+     * @param obs_stride Distance between the results of consecutive
+     * observables.
+     * @param H_lambda Observables applied to lambda.
+     * @param lambda State the generator acts on.
+     * @param term Generator of the operation.
+     * @param inverse Whether the operation is inverted.
+     * @param num_threads Number of threads to use.
+     */
+    static void
+    updateJacobianPauli(std::vector<T> &jac, size_t row_idx,
+                        size_t obs_stride,
+                        const std::vector<StateVectorManagedCPU<T>> &H_lambda,
+                        const StateVectorManagedCPU<T> &lambda,
+                        const Gates::PauliGeneratorTerm<T> &term, bool inverse,
+                        size_t num_threads) {
+        const auto H_ptrs = dataPointers(H_lambda);
+        std::vector<std::complex<T>> overlaps(H_lambda.size());
+        Gates::pauliGeneratorOverlaps(H_ptrs.data(), H_ptrs.size(),
+                                      lambda.getData(), lambda.getNumQubits(),
+                                      term, overlaps.data(), num_threads);
+        const T scaling_factor = inverse ? -term.scale : term.scale;
+        for (size_t obs_idx = 0; obs_idx < overlaps.size(); obs_idx++) {
+            jac[row_idx + obs_idx * obs_stride] =
+                -2 * scaling_factor * std::imag(overlaps[obs_idx]);
+        }
+    }
 
     /**
-     * @brief Calculates the Jacobian for the statevector for the selected set
-     * of parametric gates.
+     * @brief Run the backward step of a multi-parameter operation.
      *
-     * For the statevector data associated with `psi` of length `num_elements`,
-     * we make internal copies to a `%StateVectorManagedCPU<T>` object, with one
-     * per required observable. The `operations` will be applied to the internal
-     * statevector copies, with the operation indices participating in the
-     * gradient calculations given in `trainableParams`, and the overall number
-     * of parameters for the gradient calculation provided within `num_params`.
-     * The resulting row-major ordered `jac` matrix representation will be of
-     * size `jd.getSizeStateVec() * jd.getObservables().size()`. OpenMP is used
-     * to enable independent operations to be offloaded to threads.
+     * The single-parameter gates of the operation are undone one by one,
+     * and the derivative with respect to the parameter of each gate is
+     * taken from the overlap of its generator on lambda just before the gate
+     * is undone. This needs no decomposition of the operation in the tape,
+     * nor any copy of lambda.
+     *
+     * @param jac Jacobian receiving the values.
+     * @param ops Operations of the tape.
+     * @param op_idx Index of the operation.
+     * @param rows Index of the result of the first observable for each
+     * trainable parameter of the operation, std::nullopt for the others.
+     * @param obs_stride Distance between the results of consecutive
+     * observables.
+     * @param lambda State after the operation. Modified in place.
+     * @param H_lambda Observables applied to lambda. Modified in place.
+     * @param num_obs_threads Number of threads distributing the states.
+     * @param num_threads Number of threads of the overlaps.
+     */
+    static void
+    multiParamStep(std::vector<T> &jac, const OpsData<T> &ops, size_t op_idx,
+                   const std::vector<std::optional<size_t>> &rows,
+                   size_t obs_stride, StateVectorManagedCPU<T> &lambda,
+                   std::vector<StateVectorManagedCPU<T>> &H_lambda,
+                   size_t num_obs_threads, size_t num_threads) {
+        const auto gates = paramGates(ops.getOpsName()[op_idx]);
+        PL_ABORT_IF_NOT(gates && rows.size() == gates->size(),
+                        "The operation is not supported using the adjoint "
+                        "differentiation method");
+        const auto &dispatcher = DynamicDispatcher<T>::getInstance();
+        const auto &wires = ops.getOpsWires()[op_idx];
+        const auto &params = ops.getOpsParams()[op_idx];
+        const bool inverse = ops.getOpsInverses()[op_idx];
+        const size_t num_qubits = lambda.getNumQubits();
+
+        std::vector<std::complex<T> *> H_ptrs;
+        H_ptrs.reserve(H_lambda.size());
+        for (auto &state : H_lambda) {
+            H_ptrs.emplace_back(state.getData());
+        }
+        std::complex<T> *lambda_ptr = lambda.getData();
+
+        for (size_t step = 0; step < gates->size(); step++) {
+            // The inverse of the operation applies the inverse gates in
+            // the reverse order
+            const ParamGate &gate =
+                (*gates)[inverse ? step : gates->size() - 1 - step];
+            const auto &row = rows[gate.param_idx];
+            if (row) {
+                const auto term = Gates::pauliGeneratorTerm<T>(
+                    gate.gntr_op, num_qubits, wires);
+                updateJacobianPauli(jac, *row, obs_stride, H_lambda, lambda,
+                                    *term, inverse, num_threads);
+            }
+            const std::vector<T> gate_params{params[gate.param_idx]};
+            dispatcher.applyOperationBatch(
+                lambda.getKernelForGate(gate.gate_op), &lambda_ptr, 1,
+                num_qubits, gate.gate_op, wires, !inverse, gate_params, 1);
+            if (!H_lambda.empty()) {
+                dispatcher.applyOperationBatch(
+                    H_lambda[0].getKernelForGate(gate.gate_op), H_ptrs.data(),
+                    H_ptrs.size(), num_qubits, gate.gate_op, wires, !inverse,
+                    gate_params, num_obs_threads);
+            }
+        }
+    }
+
+    /**
+     * @brief Run the backward pass of the adjoint method for the given
+     * observable-applied states.
+     *
+     * The result for state `obs_idx` and trainable parameter `param_idx` is
+     * stored in `jac[jac_offset + param_idx * param_stride + obs_idx *
+     * obs_stride]`, so the results can be written directly in the layout of
+     * the caller.
      *
      * @param jac Preallocated vector for Jacobian data results.
      * @param jd JacobianData represents the QuantumTape to differentiate
-     * @param apply_operations Indicate whether to apply operations to tape.psi
-     * prior to calculation.
+     * @param lambda State after applying all operations. Modified in place.
+     * @param H_lambda Observables applied to lambda. Modified in place.
+     * @param param_stride Distance between the results of consecutive
+     * trainable parameters.
+     * @param obs_stride Distance between the results of consecutive states.
+     * @param jac_offset Offset of the results of the first state.
+     * @param schedule Thread counts of the backward pass.
+     * @param checkpoints Checkpoints of the forward pass, if stored.
      */
-    void adjointJacobian(std::vector<T> &jac, const JacobianData<T> &jd,
-                         bool apply_operations = false) {
-        PL_ABORT_IF(!jd.hasTrainableParams(),
-                    "No trainable parameters provided.");
-
+    void backwardPass(std::vector<T> &jac, const JacobianData<T> &jd,
+                      StateVectorManagedCPU<T> &lambda,
+                      std::vector<StateVectorManagedCPU<T>> &H_lambda,
+                      size_t param_stride, size_t obs_stride,
+                      size_t jac_offset, const Schedule &schedule,
+                      std::optional<Checkpoints> &checkpoints) {
+        PL_TRACE_SCOPE("backward", "adjoint");
         const OpsData<T> &ops = jd.getOperations();
         const std::vector<std::string> &ops_name = ops.getOpsName();
 
-        const std::vector<ObsDatum<T>> &obs = jd.getObservables();
-        const size_t num_observables = obs.size();
-
         const std::vector<size_t> &tp = jd.getTrainableParams();
         const size_t tp_size = tp.size();
-        const size_t num_param_ops = ops.getNumParOps();
+        const size_t num_params = ops.getNumParams();
 
         // Track positions within par and non-par operations
         size_t trainableParamNumber = tp_size - 1;
-        size_t current_param_idx =
-            num_param_ops - 1; // total number of parametric ops
-
-        // Create $U_{1:p}\vert \lambda \rangle$
-        StateVectorManagedCPU<T> lambda(jd.getPtrStateVec(),
-                                        jd.getSizeStateVec());
-
-        // Apply given operations to statevector if requested
-        if (apply_operations) {
-            applyOperations(lambda, ops);
-        }
+        size_t current_param_idx = num_params - 1;
 
         auto tp_it = tp.rbegin();
         const auto tp_rend = tp.rend();
 
-        // Create observable-applied state-vectors
-        std::vector<StateVectorManagedCPU<T>> H_lambda(
-            num_observables, StateVectorManagedCPU<T>{lambda.getNumQubits()});
-        applyObservables(H_lambda, lambda, obs);
+        const size_t num_obs_threads = schedule.num_obs_threads;
+        // The inner products distribute tiles over all threads
+        const size_t num_threads = num_obs_threads * schedule.num_elem_threads;
+
+        // Only allocated for generators which are not controlled Pauli
+        // strings
+        std::optional<StateVectorManagedCPU<T>> mu;
+
+        // Resolve the kernels once for lambda and for the other states, which
+        // share the threading and memory model of H_lambda
+        const CompiledOps<T> lambda_ops(ops, lambda);
+        const CompiledOps<T> mu_ops(ops,
+                                    H_lambda.empty() ? lambda : H_lambda[0]);
 
-        StateVectorManagedCPU<T> mu(lambda.getNumQubits());
+        const bool use_checkpoints = checkpoints.has_value();
+        if (use_checkpoints) {
+            // No segment is in the buffer yet
+            checkpoints->segment = checkpoints->numSegments();
+        }
 
         for (int op_idx = static_cast<int>(ops_name.size() - 1); op_idx >= 0;
              op_idx--) {
-            PL_ABORT_IF(ops.getOpsParams()[op_idx].size() > 1,
-                        "The operation is not supported using the adjoint "
-                        "differentiation method");
             if ((ops_name[op_idx] == "QubitStateVector") ||
                 (ops_name[op_idx] == "BasisState")) {
                 continue;
@@ -364,46 +776,1385 @@ template <class T = double> class AdjointJacobian {
             if (tp_it == tp_rend) {
                 break; // All done
             }
-            mu.updateData(lambda.getDataVector());
-            applyOperationAdj(lambda, ops, op_idx);
-
+            PL_TRACE_SCOPE("backward step", "adjoint");
+            const size_t num_op_params = ops.getOpsParams()[op_idx].size();
+            if (num_op_params > 1) {
+                std::vector<std::optional<size_t>> rows(num_op_params);
+                for (size_t param_idx = num_op_params; param_idx-- > 0;
+                     current_param_idx--) {
+                    if (tp_it != tp_rend && current_param_idx == *tp_it) {
+                        rows[param_idx] =
+                            trainableParamNumber * param_stride + jac_offset;
+                        trainableParamNumber--;
+                        ++tp_it;
+                    }
+                }
+                multiParamStep(jac, ops, static_cast<size_t>(op_idx), rows,
+                               obs_stride, lambda, H_lambda, num_obs_threads,
+                               num_threads);
+                if (use_checkpoints) {
+                    restoreCheckpoint(lambda, lambda_ops,
+                                      static_cast<size_t>(op_idx),
+                                      *checkpoints);
+                }
+                continue;
+            }
             if (ops.hasParams(op_idx)) {
                 if (current_param_idx == *tp_it) {
-                    const T scalingFactor =
-                        applyGenerator(mu, ops_name[op_idx],
-                                       ops.getOpsWires()[op_idx],
-                                       !ops.getOpsInverses()[op_idx]) *
-                        (ops.getOpsInverses()[op_idx] ? -1 : 1);
-
+                    // The generator acts on lambda before the adjoint of
+                    // the operation is applied to it
                     const size_t mat_row_idx =
-                        trainableParamNumber * num_observables;
-
-                    // clang-format off
-
-                    #if defined(_OPENMP)
-                        #pragma omp parallel for default(none)   \
-                        shared(H_lambda, jac, mu, scalingFactor, \
-                            mat_row_idx,        \
-                            num_observables)
-                    #endif
-
-                    // clang-format on
-                    for (size_t obs_idx = 0; obs_idx < num_observables;
-                         obs_idx++) {
-                        jac[mat_row_idx + obs_idx] =
-                            -2 * scalingFactor *
-                            std::imag(
-                                innerProdC(H_lambda[obs_idx].getDataVector(),
-                                           mu.getDataVector()));
+                        trainableParamNumber * param_stride + jac_offset;
+                    const auto &term =
+                        mu_ops.pauliGenerator(static_cast<size_t>(op_idx));
+                    if (term) {
+                        updateJacobianPauli(jac, mat_row_idx, obs_stride,
+                                            H_lambda, lambda, *term,
+                                            ops.getOpsInverses()[op_idx],
+                                            num_threads);
+                    } else {
+                        if (!mu) {
+                            mu.emplace(makeTemporaryState(
+                                lambda.getNumQubits(), schedule.threading()));
+                        }
+                        mu->updateData(lambda.getDataVector());
+                        const T scalingFactor =
+                            mu_ops.applyGenerator(
+                                *mu, static_cast<size_t>(op_idx),
+                                !ops.getOpsInverses()[op_idx]) *
+                            (ops.getOpsInverses()[op_idx] ? -1 : 1);
+                        updateJacobianState(jac, mat_row_idx, obs_stride,
+                                            H_lambda, *mu, scalingFactor,
+                                            num_threads);
                     }
                     trainableParamNumber--;
                     ++tp_it;
                 }
                 current_param_idx--;
             }
-            applyOperationsAdj(H_lambda, ops, static_cast<size_t>(op_idx));
+            if (use_checkpoints) {
+                restoreCheckpoint(lambda, lambda_ops,
+                                  static_cast<size_t>(op_idx), *checkpoints);
+            } else {
+                applyOperationAdj(lambda, lambda_ops, op_idx);
+            }
+            applyOperationsAdj(H_lambda, mu_ops, static_cast<size_t>(op_idx),
+                               num_obs_threads);
+        }
+    }
+
+    /**
+     * @brief Store the expectation value and, if requested, the variance of
+     * an observable @f$O@f$.
+     *
+     * As @f$O@f$ is Hermitian, @f$\langle O^2 \rangle@f$ is the squared
+     * norm of @f$O|\lambda\rangle@f$.
+     *
+     * @param results Results with preallocated measurements.
+     * @param obs_idx Index of the observable.
+     * @param lambda Measured statevector.
+     * @param H_lambda Observable applied to lambda.
+     */
+    static void storeMeasurements(ExecutionResults<T> &results, size_t obs_idx,
+                                  const StateVectorManagedCPU<T> &lambda,
+                                  const StateVectorManagedCPU<T> &H_lambda) {
+        const T expval = std::real(
+            innerProdC(lambda.getDataVector(), H_lambda.getDataVector()));
+        results.expvals[obs_idx] = expval;
+        if (!results.variances.empty()) {
+            results.variances[obs_idx] =
+                std::real(innerProdC(H_lambda.getDataVector(),
+                                     H_lambda.getDataVector())) -
+                expval * expval;
+        }
+    }
+
+    /**
+     * @brief Run the backward pass of the adjoint method for the observables
+     * with indices in [obs_begin, obs_end).
+     *
+     * The results are stored in `jac` in the observable-major order, i.e.
+     * `jac[obs_idx * jd.getNumParams() + param_idx]`.
+     *
+     * @param jac Preallocated vector for Jacobian data results.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param lambda State after applying all operations. Modified in place.
+     * @param obs_begin Index of the first observable of the batch.
+     * @param obs_end Index after the last observable of the batch.
+     * @param schedule Thread counts of the backward pass.
+     * @param checkpoints Checkpoints of the forward pass, if stored.
+     * @param results If not null, the measurements of the observables of the
+     * batch are stored in it before the backward pass.
+     */
+    void adjointJacobianBatch(std::vector<T> &jac, const JacobianData<T> &jd,
+                              StateVectorManagedCPU<T> &lambda,
+                              size_t obs_begin, size_t obs_end,
+                              const Schedule &schedule,
+                              std::optional<Checkpoints> &checkpoints,
+                              ExecutionResults<T> *results = nullptr) {
+        const std::vector<ObsDatum<T>> &obs = jd.getObservables();
+        const size_t num_observables = obs.size();
+        const size_t num_batch_obs = obs_end - obs_begin;
+
+        // Create observable-applied state-vectors
+        std::vector<StateVectorManagedCPU<T>> H_lambda(
+            num_batch_obs,
+            makeTemporaryState(lambda.getNumQubits(), schedule.threading()));
+        if (num_batch_obs == num_observables) {
+            applyObservables(H_lambda, lambda, obs, schedule.num_obs_threads);
+        } else {
+            const auto first = obs.begin() + static_cast<ptrdiff_t>(obs_begin);
+            const auto last = obs.begin() + static_cast<ptrdiff_t>(obs_end);
+            applyObservables(H_lambda, lambda,
+                             std::vector<ObsDatum<T>>(first, last),
+                             schedule.num_obs_threads);
+        }
+        if (results != nullptr) {
+            for (size_t obs_idx = 0; obs_idx < num_batch_obs; obs_idx++) {
+                storeMeasurements(*results, obs_begin + obs_idx, lambda,
+                                  H_lambda[obs_idx]);
+            }
+        }
+        const size_t num_params = jd.getNumParams();
+        backwardPass(jac, jd, lambda, H_lambda, 1, num_params,
+                     obs_begin * num_params, schedule, checkpoints);
+    }
+
+    /**
+     * @brief Compute @f$\sum_k dy_k O_k |\lambda\rangle@f$.
+     *
+     * Observables are applied one at a time to a working copy of lambda, so
+     * only two statevectors are allocated regardless of the number of
+     * observables.
+     *
+     * @param out Statevector receiving the result.
+     * @param lambda Reference statevector.
+     * @param observables Observables @f$O_k@f$.
+     * @param dy Coefficient of each observable.
+     */
+    void applyWeightedObservables(StateVectorManagedCPU<T> &out,
+                                  const StateVectorManagedCPU<T> &lambda,
+                                  const std::vector<ObsDatum<T>> &observables,
+                                  const std::vector<T> &dy) {
+        const size_t length = lambda.getLength();
+        StateVectorManagedCPU<T> work =
+            makeTemporaryState(lambda.getNumQubits(), lambda.threading());
+        [[maybe_unused]] const bool parallel =
+            lambda.threading() == Threading::MultiThread;
+        std::complex<T> *out_data = out.getData();
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static) if(parallel)
+        #endif
+        // clang-format on
+        for (size_t idx = 0; idx < length; idx++) {
+            out_data[idx] = std::complex<T>{0.0, 0.0};
+        }
+        for (size_t obs_idx = 0; obs_idx < observables.size(); obs_idx++) {
+            if (dy[obs_idx] == 0) {
+                continue;
+            }
+            applyObservable(lambda, work, observables[obs_idx]);
+            const std::complex<T> *work_data = work.getData();
+            const T coeff = dy[obs_idx];
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp parallel for schedule(static) if(parallel)
+            #endif
+            // clang-format on
+            for (size_t idx = 0; idx < length; idx++) {
+                out_data[idx] += coeff * work_data[idx];
+            }
+        }
+    }
+
+    /**
+     * @brief Get the bit position of each measured wire, with the first wire
+     * in the most significant bit of the outcome.
+     *
+     * @param wires Measured wires.
+     * @param num_qubits Number of qubits.
+     */
+    static auto outcomeBits(const std::vector<size_t> &wires,
+                            size_t num_qubits) -> std::vector<size_t> {
+        std::vector<size_t> rev_wires(wires.size());
+        for (size_t k = 0; k < wires.size(); k++) {
+            PL_ABORT_IF(wires[k] >= num_qubits, "Invalid wire index.");
+            rev_wires[k] = num_qubits - 1 - wires[k];
+        }
+        return rev_wires;
+    }
+
+    /**
+     * @brief Outcome of the measured wires for each basis state, looked up
+     * from the low and the high half of the index.
+     *
+     * The measured bits of both halves are disjoint, so the outcome is the
+     * bitwise or of their outcomes, each tabulated once for
+     * @f$O(2^{n/2})@f$ indices instead of looping over the wires for every
+     * basis state.
+     */
+    class OutcomeTable {
+      private:
+        size_t num_low_bits_;
+        std::vector<size_t> low_;
+        std::vector<size_t> high_;
+
+        static auto tabulate(const std::vector<size_t> &rev_wires,
+                             size_t shift, size_t num_bits)
+            -> std::vector<size_t> {
+            std::vector<size_t> table(Util::exp2(num_bits));
+            for (size_t part = 0; part < table.size(); part++) {
+                const size_t idx = part << shift;
+                size_t outcome = 0;
+                for (const size_t rev_wire : rev_wires) {
+                    outcome = (outcome << 1U) | ((idx >> rev_wire) & 1U);
+                }
+                table[part] = outcome;
+            }
+            return table;
+        }
+
+      public:
+        /**
+         * @param rev_wires Bit positions of the measured wires.
+         * @param num_qubits Number of qubits.
+         */
+        OutcomeTable(const std::vector<size_t> &rev_wires, size_t num_qubits)
+            : num_low_bits_{num_qubits / 2},
+              low_{tabulate(rev_wires, 0, num_low_bits_)},
+              high_{tabulate(rev_wires, num_low_bits_,
+                             num_qubits - num_low_bits_)} {}
+
+        /**
+         * @brief Get the outcome of the measured wires for a basis state.
+         *
+         * @param idx Index of the basis state.
+         */
+        [[nodiscard]] auto operator()(size_t idx) const -> size_t {
+            return low_[idx & (low_.size() - 1)] |
+                   high_[idx >> num_low_bits_];
+        }
+    };
+
+    /**
+     * @brief Compute @f$\sum_j dy_j P_j |\lambda\rangle@f$, where @f$P_j@f$
+     * projects onto the outcome @f$j@f$ of the measured wires.
+     *
+     * @param out Statevector receiving the result.
+     * @param lambda Reference statevector.
+     * @param rev_wires Bit positions of the measured wires.
+     * @param dy Coefficient of each outcome.
+     */
+    static void applyWeightedProjectors(StateVectorManagedCPU<T> &out,
+                                        const StateVectorManagedCPU<T> &lambda,
+                                        const std::vector<size_t> &rev_wires,
+                                        const std::vector<T> &dy) {
+        const OutcomeTable outcome_of(rev_wires, lambda.getNumQubits());
+        std::complex<T> *out_data = out.getData();
+        const std::complex<T> *data = lambda.getData();
+        const size_t length = lambda.getLength();
+        [[maybe_unused]] const bool parallel =
+            lambda.threading() == Threading::MultiThread;
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static) if(parallel)
+        #endif
+        // clang-format on
+        for (size_t idx = 0; idx < length; idx++) {
+            out_data[idx] = dy[outcome_of(idx)] * data[idx];
+        }
+    }
+
+    /**
+     * @brief Check whether an operation with several parameters has a
+     * trainable parameter.
+     *
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     */
+    static auto hasTrainableMultiParamOps(const JacobianData<T> &jd) -> bool {
+        const OpsData<T> &ops = jd.getOperations();
+        const auto &tp = jd.getTrainableParams();
+        auto tp_it = tp.begin();
+        size_t param_idx = 0;
+        for (size_t op_idx = 0; op_idx < ops.getSize() && tp_it != tp.end();
+             op_idx++) {
+            const size_t num_op_params = ops.getOpsParams()[op_idx].size();
+            const size_t op_end = param_idx + num_op_params;
+            if (*tp_it < op_end && num_op_params > 1) {
+                return true;
+            }
+            while (tp_it != tp.end() && *tp_it < op_end) {
+                ++tp_it;
+            }
+            param_idx = op_end;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Compute the Jacobian of the probabilities with one forward
+     * sweep per trainable parameter.
+     *
+     * The state @f$|\mu\rangle@f$ is recovered from the final state and
+     * carried forward. At each trainable operation, @f$|\phi\rangle =
+     * G|\mu\rangle@f$ is propagated to the end of the circuit, where
+     * @f$\partial p_j = -2c\,\mathrm{Im}\sum_{i \in j} \psi_i^* \phi_i@f$.
+     * Trainable operations must have a single parameter.
+     *
+     * @param jac Preallocated Jacobian, set to zero.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param psi State after applying all operations.
+     * @param rev_wires Bit positions of the measured wires.
+     * @param row_stride Distance between the rows of consecutive outcomes.
+     */
+    void probsJacobianForward(std::vector<T> &jac, const JacobianData<T> &jd,
+                              const StateVectorManagedCPU<T> &psi,
+                              const std::vector<size_t> &rev_wires,
+                              size_t row_stride) {
+        const OpsData<T> &ops = jd.getOperations();
+        const auto tp_of_op = trainableOps(jd);
+        const auto is_state_prep = [&ops](size_t op_idx) {
+            return ops.getOpsName()[op_idx] == "QubitStateVector" ||
+                   ops.getOpsName()[op_idx] == "BasisState";
+        };
+        const CompiledOps<T> compiled(ops, psi);
+
+        StateVectorManagedCPU<T> mu =
+            makeTemporaryState(psi.getNumQubits(), psi.threading());
+        StateVectorManagedCPU<T> phi =
+            makeTemporaryState(psi.getNumQubits(), psi.threading());
+        mu.updateData(psi.getDataVector());
+        for (size_t op_idx = ops.getSize(); op_idx-- > 0;) {
+            if (!is_state_prep(op_idx)) {
+                compiled.apply(mu, op_idx, true);
+            }
+        }
+
+        const OutcomeTable outcome_of(rev_wires, psi.getNumQubits());
+        const std::complex<T> *psi_data = psi.getData();
+        const std::complex<T> *phi_data = phi.getData();
+        size_t num_remaining = jd.getTrainableParams().size();
+        for (size_t op_idx = 0; op_idx < ops.getSize() && num_remaining > 0;
+             op_idx++) {
+            if (is_state_prep(op_idx)) {
+                continue;
+            }
+            compiled.apply(mu, op_idx);
+            const auto &tp_idx = tp_of_op[op_idx];
+            if (!tp_idx) {
+                continue;
+            }
+            const T c = applyDerivativeGenerator(phi, mu, compiled, op_idx);
+            for (size_t next = op_idx + 1; next < ops.getSize(); next++) {
+                if (!is_state_prep(next)) {
+                    compiled.apply(phi, next);
+                }
+            }
+            for (size_t idx = 0; idx < psi.getLength(); idx++) {
+                const T im =
+                    std::imag(std::conj(psi_data[idx]) * phi_data[idx]);
+                jac[outcome_of(idx) * row_stride + *tp_idx] +=
+                    -2 * c * im;
+            }
+            num_remaining--;
+        }
+    }
+
+    /**
+     * @brief Run the backward pass for the observables with indices in
+     * [obs_begin, obs_end) using the given schedule.
+     *
+     * @param jac Preallocated vector for Jacobian data results.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param lambda State after applying all operations. Modified in place.
+     * @param obs_begin Index of the first observable of the batch.
+     * @param obs_end Index after the last observable of the batch.
+     * @param schedule Thread counts of the backward pass.
+     * @param checkpoints Checkpoints of the forward pass, if stored.
+     * @param results If not null, the measurements of the observables of the
+     * batch are stored in it.
+     */
+    void runBatch(std::vector<T> &jac, const JacobianData<T> &jd,
+                  StateVectorManagedCPU<T> &lambda, size_t obs_begin,
+                  size_t obs_end, const Schedule &schedule,
+                  std::optional<Checkpoints> &checkpoints,
+                  ExecutionResults<T> *results = nullptr) {
+        if (schedule.num_obs_threads > 1 && schedule.num_elem_threads > 1) {
+            [[maybe_unused]] const NestedThreadsGuard guard(
+                schedule.num_elem_threads);
+            adjointJacobianBatch(jac, jd, lambda, obs_begin, obs_end,
+                                 schedule, checkpoints, results);
+        } else {
+            adjointJacobianBatch(jac, jd, lambda, obs_begin, obs_end,
+                                 schedule, checkpoints, results);
+        }
+    }
+
+    /**
+     * @brief Get the working state of the adjoint method.
+     *
+     * This is the statevector held by `jd` if any, and otherwise a copy of
+     * the statevector data of `jd` constructed in `storage`. Operations are
+     * applied to it if requested, storing checkpoints in `checkpoints` if
+     * enabled.
+     *
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param apply_operations Indicate whether to apply operations to the
+     * state.
+     * @param threading Threading of the copy.
+     * @param storage Storage of the copy.
+     * @param checkpoints Storage of the checkpoints.
+     */
+    auto getWorkingState(const JacobianData<T> &jd, bool apply_operations,
+                         Threading threading,
+                         std::optional<StateVectorManagedCPU<T>> &storage,
+                         std::optional<Checkpoints> &checkpoints)
+        -> StateVectorManagedCPU<T> & {
+        PL_TRACE_SCOPE("forward", "adjoint");
+        StateVectorManagedCPU<T> *state = jd.getStateVec();
+        if (state == nullptr) {
+            state = &storage.emplace(
+                jd.getPtrStateVec(), jd.getSizeStateVec(), threading,
+                bestCPUMemoryModel(), bestNUMAPolicy(threading),
+                Util::HugePagePolicy::Disabled, buffer_pool_);
+        }
+        // Checkpoints are only used by the backward pass
+        if (apply_operations && checkpoint_interval_ > 0 &&
+            jd.hasTrainableParams() &&
+            !jd.getOperations().getOpsName().empty()) {
+            applyOperationsWithCheckpoints(*state, jd.getOperations(),
+                                           checkpoints);
+        } else if (apply_operations) {
+            applyOperations(*state, jd.getOperations());
+        }
+        return *state;
+    }
+
+    /**
+     * @brief Apply the generator of a parametric operation to a copy of the
+     * state.
+     *
+     * The derivative of the operation @f$U@f$ is
+     * @f$\partial U = i c G U@f$, where @f$c@f$ is the returned coefficient.
+     *
+     * @param out Statevector receiving @f$G|\phi\rangle@f$.
+     * @param state Statevector @f$|\phi\rangle@f$.
+     * @param operations Operations, compiled for the statevectors.
+     * @param op_idx Operation index.
+     * @return T Coefficient @f$c@f$.
+     */
+    static auto applyDerivativeGenerator(StateVectorManagedCPU<T> &out,
+                                         const StateVectorManagedCPU<T> &state,
+                                         const CompiledOps<T> &operations,
+                                         size_t op_idx) -> T {
+        const bool inverse = operations.getOps().getOpsInverses()[op_idx];
+        out.updateData(state.getDataVector());
+        return operations.applyGenerator(out, op_idx, !inverse) *
+               (inverse ? -1 : 1);
+    }
+
+    /**
+     * @brief Compute @f$|y\rangle \mathrel{+}= a |x\rangle@f$.
+     */
+    static void addScaled(StateVectorManagedCPU<T> &y, std::complex<T> a,
+                          const StateVectorManagedCPU<T> &x) {
+        std::complex<T> *y_data = y.getData();
+        const std::complex<T> *x_data = x.getData();
+        for (size_t idx = 0; idx < y.getLength(); idx++) {
+            y_data[idx] += a * x_data[idx];
+        }
+    }
+
+    /**
+     * @brief Get the trainable parameter of each operation for the
+     * second-order methods.
+     *
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @return Index in the trainable parameters for each operation, or
+     * std::nullopt if the operation has no trainable parameter.
+     */
+    static auto trainableOps(const JacobianData<T> &jd)
+        -> std::vector<std::optional<size_t>> {
+        const OpsData<T> &ops = jd.getOperations();
+        const auto &tp = jd.getTrainableParams();
+        std::vector<std::optional<size_t>> tp_of_op(ops.getSize());
+        auto tp_it = tp.begin();
+        size_t param_idx = 0;
+        for (size_t op_idx = 0; op_idx < ops.getSize(); op_idx++) {
+            const size_t num_op_params = ops.getOpsParams()[op_idx].size();
+            const auto op_end = param_idx + num_op_params;
+            if (tp_it != tp.end() && *tp_it < op_end) {
+                PL_ABORT_IF(num_op_params > 1,
+                            "The adjoint Hessian does not support trainable "
+                            "multi-parameter operations.");
+                tp_of_op[op_idx] = static_cast<size_t>(tp_it - tp.begin());
+                ++tp_it;
+            }
+            param_idx = op_end;
+        }
+        PL_ABORT_IF(tp_it != tp.end(),
+                    "Invalid index of a trainable parameter.");
+        return tp_of_op;
+    }
+
+    /**
+     * @brief Run the sweeps of metricTensor() using the given schedule.
+     *
+     * @param metric Preallocated metric tensor, set to zero.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param schedule Thread counts of the backward pass, which distributes
+     * the carried states.
+     */
+    void metricTensorSweeps(std::vector<T> &metric, const JacobianData<T> &jd,
+                            const Schedule &schedule) {
+        const OpsData<T> &ops = jd.getOperations();
+        const auto tp_of_op = trainableOps(jd);
+        const size_t num_params = jd.getTrainableParams().size();
+        const size_t num_qubits = Util::log2(jd.getSizeStateVec());
+        const Threading threading = schedule.threading();
+        const size_t num_threads =
+            schedule.num_obs_threads * schedule.num_elem_threads;
+
+        StateVectorManagedCPU<T> phi =
+            makeTemporaryState(num_qubits, threading);
+        std::copy(jd.getPtrStateVec(),
+                  jd.getPtrStateVec() + jd.getSizeStateVec(), phi.getData());
+        {
+            PL_TRACE_SCOPE("forward", "adjoint");
+            applyOperations(phi, ops);
+        }
+
+        PL_TRACE_SCOPE("backward", "adjoint");
+        const CompiledOps<T> compiled(ops, phi);
+        // G_j|phi_j> of the parameters visited so far, carried back with
+        // phi, and the parameter of each
+        std::vector<StateVectorManagedCPU<T>> carried;
+        carried.reserve(num_params);
+        std::vector<size_t> carried_params;
+        carried_params.reserve(num_params);
+        std::vector<T> coeffs(num_params);
+        std::vector<T> gen_expvals(num_params);
+        const size_t length = phi.getLength();
+
+        for (size_t op_idx = ops.getSize();
+             op_idx-- > 0 && carried.size() < num_params;) {
+            if ((ops.getOpsName()[op_idx] == "QubitStateVector") ||
+                (ops.getOpsName()[op_idx] == "BasisState")) {
+                continue;
+            }
+            if (const auto &tp_idx = tp_of_op[op_idx]; tp_idx) {
+                const size_t i = *tp_idx;
+                StateVectorManagedCPU<T> nu =
+                    makeTemporaryState(num_qubits, threading);
+                const T c_i =
+                    applyDerivativeGenerator(nu, phi, compiled, op_idx);
+                const T e_i =
+                    std::real(innerProdC(phi.getData(), nu.getData(), length));
+                coeffs[i] = c_i;
+                gen_expvals[i] = e_i;
+                metric[i * num_params + i] =
+                    c_i * c_i *
+                    (std::real(innerProdC(nu.getData(), nu.getData(), length)) -
+                     e_i * e_i);
+
+                const auto ptrs = dataPointers(carried);
+                std::vector<std::complex<T>> prods(carried.size());
+                innerProdsC(ptrs.data(), ptrs.size(), nu.getData(), length,
+                            prods.data(), num_threads);
+                for (size_t k = 0; k < carried.size(); k++) {
+                    const size_t j = carried_params[k];
+                    const T g_ij = c_i * coeffs[j] *
+                                   (std::real(prods[k]) - e_i * gen_expvals[j]);
+                    metric[i * num_params + j] = g_ij;
+                    metric[j * num_params + i] = g_ij;
+                }
+                carried.emplace_back(std::move(nu));
+                carried_params.emplace_back(i);
+            }
+            if (carried.size() < num_params) {
+                compiled.apply(phi, op_idx, true);
+                compiled.applyBatch(carried, op_idx, true,
+                                    schedule.num_obs_threads);
+            }
+        }
+    }
+
+  public:
+    AdjointJacobian() = default;
+
+    /**
+     * @brief Set the parallelisation strategy of the backward pass.
+     *
+     * @param parallelism Parallelisation strategy.
+     */
+    void setParallelism(AdjointParallelism parallelism) {
+        parallelism_ = parallelism;
+    }
+
+    /**
+     * @brief Get the parallelisation strategy of the backward pass.
+     */
+    [[nodiscard]] auto getParallelism() const -> AdjointParallelism {
+        return parallelism_;
+    }
+
+    /**
+     * @brief Set the number of operations between checkpoints of the
+     * forward pass.
+     *
+     * When non-zero and operations are applied by the adjoint method, the
+     * state before every `interval`-th operation is stored during the
+     * forward pass. The backward pass then recomputes the states it needs
+     * from the nearest checkpoint instead of applying inverse operations to
+     * the final state, which avoids the accumulation of rounding errors on
+     * deep circuits. This requires getNumCheckpointStates() additional
+     * statevectors, taken from the buffer pool for the duration of each
+     * call. An interval of about the square root of the number of
+     * operations minimises it.
+     *
+     * @param interval Number of operations between checkpoints. 0 disables
+     * checkpointing.
+     */
+    void setCheckpointInterval(size_t interval) {
+        checkpoint_interval_ = interval;
+    }
+
+    /**
+     * @brief Get the number of operations between checkpoints of the
+     * forward pass. 0 if checkpointing is disabled.
+     */
+    [[nodiscard]] auto getCheckpointInterval() const -> size_t {
+        return checkpoint_interval_;
+    }
+
+    /**
+     * @brief Set the pool of the temporary statevectors.
+     *
+     * The temporary statevectors of the forward and backward passes take
+     * their data from the pool and return it when done, so that repeated
+     * calls do not allocate large buffers. The process-wide pool
+     * `Util::BufferPool::global()` is used by default.
+     *
+     * @param pool Buffer pool, or nullptr to allocate and free the data of
+     * each temporary statevector.
+     */
+    void setBufferPool(Util::BufferPool *pool) { buffer_pool_ = pool; }
+
+    /**
+     * @brief Get the pool of the temporary statevectors.
+     */
+    [[nodiscard]] auto getBufferPool() const -> Util::BufferPool * {
+        return buffer_pool_;
+    }
+
+    /**
+     * @brief Set the threads used by the adjoint method.
+     *
+     * The number of threads bounds the threads distributing the
+     * observables or parameters and those applying each gate.
+     *
+     * @param config Threading configuration.
+     */
+    void setThreadingConfig(ThreadingConfig config) {
+        threading_config_ = std::move(config);
+    }
+
+    /**
+     * @brief Get the threading configuration.
+     */
+    [[nodiscard]] auto getThreadingConfig() const -> const ThreadingConfig & {
+        return threading_config_;
+    }
+
+    /**
+     * @brief Get the number of statevectors stored for checkpointing.
+     *
+     * These are one checkpoint per segment of `interval` operations and the
+     * states within a segment.
+     *
+     * @param num_ops Number of operations.
+     * @param interval Number of operations between checkpoints.
+     */
+    static auto getNumCheckpointStates(size_t num_ops, size_t interval)
+        -> size_t {
+        if (interval == 0 || num_ops == 0) {
+            return 0;
+        }
+        return (num_ops + interval - 1) / interval +
+               std::min(interval, num_ops) - 1;
+    }
+
+    /**
+     * @brief Choose the parallelisation strategy for AdjointParallelism::Auto.
+     *
+     * Observables are distributed over threads when there are enough of
+     * them to occupy all threads, or when the statevector is too small for
+     * the multi-threaded gate kernels. Otherwise, a single observable uses
+     * all threads for each gate, and a few observables share the threads in
+     * teams.
+     *
+     * @param num_qubits Number of qubits.
+     * @param num_observables Number of observables.
+     * @param num_threads Number of available threads.
+     * @return AdjointParallelism Never AdjointParallelism::Auto.
+     */
+    static auto chooseParallelism(size_t num_qubits, size_t num_observables,
+                                  size_t num_threads) -> AdjointParallelism {
+        if (num_threads <= 1 || num_observables >= num_threads ||
+            num_qubits < KernelMap::parallel_lm_min_num_qubits) {
+            return AdjointParallelism::Observables;
+        }
+        if (num_observables <= 1) {
+            return AdjointParallelism::Elements;
+        }
+        if (num_threads / num_observables < 2) {
+            return AdjointParallelism::Observables;
+        }
+        return AdjointParallelism::Nested;
+    }
+
+    /**
+     * @brief Calculates the Jacobian for the statevector for the selected set
+     * of parametric gates.
+     *
+     * For the statevector data associated with `psi` of length `num_elements`,
+     * we make internal copies to a `%StateVectorManagedCPU<T>` object, with one
+     * per required observable. If `jd` holds a statevector, it is used in
+     * place of the first copy and is overwritten. The `operations` will be
+     * applied to the internal statevector copies, with the operation indices
+     * participating in the gradient calculations given in `trainableParams`,
+     * and the overall number of parameters for the gradient calculation
+     * provided within `num_params`.
+     * The resulting row-major ordered `jac` matrix representation will be of
+     * size `jd.getSizeStateVec() * jd.getObservables().size()`. OpenMP is used
+     * to enable independent operations to be offloaded to threads, following
+     * the strategy set by setParallelism().
+     *
+     * @param jac Preallocated vector for Jacobian data results.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param apply_operations Indicate whether to apply operations to tape.psi
+     * prior to calculation.
+     */
+    void adjointJacobian(std::vector<T> &jac, const JacobianData<T> &jd,
+                         bool apply_operations = false) {
+        const auto scope = threadingScope(jd);
+        PL_ABORT_IF(!jd.hasTrainableParams(),
+                    "No trainable parameters provided.");
+
+        const size_t num_observables = jd.getObservables().size();
+        const Schedule schedule = getSchedule(
+            Util::log2(jd.getSizeStateVec()), num_observables);
+
+        // Create $U_{1:p}\vert \lambda \rangle$, applying given operations
+        // to statevector if requested
+        std::optional<StateVectorManagedCPU<T>> storage;
+        std::optional<Checkpoints> checkpoints;
+        StateVectorManagedCPU<T> &lambda = getWorkingState(
+            jd, apply_operations, schedule.threading(), storage,
+            checkpoints);
+
+        runBatch(jac, jd, lambda, 0, num_observables, schedule, checkpoints);
+    }
+
+    /**
+     * @brief Get the number of observables processed together by the
+     * memory-bounded adjointJacobian.
+     *
+     * Processing a batch of `n` observables requires `n + 3` statevectors:
+     * one per observable, the state after the forward pass, and two working
+     * states of the backward pass. Checkpoints are not included.
+     *
+     * @param num_qubits Number of qubits.
+     * @param num_observables Total number of observables.
+     * @param max_memory_bytes Memory budget for statevectors in bytes.
+     * @return size_t Number of observables in each batch.
+     */
+    static auto getNumObsPerBatch(size_t num_qubits, size_t num_observables,
+                                  size_t max_memory_bytes) -> size_t {
+        const size_t sv_bytes =
+            Util::exp2(num_qubits) * sizeof(std::complex<T>);
+        const size_t num_sv = max_memory_bytes / sv_bytes;
+        PL_ABORT_IF(num_sv < 4, "The memory budget is too small to compute "
+                                "the Jacobian using the adjoint method.");
+        return std::min(num_sv - 3, num_observables);
+    }
+
+    /**
+     * @brief Calculates the Jacobian within a memory budget.
+     *
+     * Same as adjointJacobian(std::vector<T>&, const JacobianData<T>&, bool),
+     * but the observables are processed in batches so that the statevectors
+     * allocated at any time fit within `max_memory_bytes`. The backward pass
+     * is repeated for each batch, and observables within a batch are still
+     * processed in parallel.
+     *
+     * @param jac Preallocated vector for Jacobian data results.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param apply_operations Indicate whether to apply operations to tape.psi
+     * prior to calculation.
+     * @param max_memory_bytes Memory budget for statevectors in bytes.
+     */
+    void adjointJacobian(std::vector<T> &jac, const JacobianData<T> &jd,
+                         bool apply_operations, size_t max_memory_bytes) {
+        const auto scope = threadingScope(jd);
+        PL_ABORT_IF(!jd.hasTrainableParams(),
+                    "No trainable parameters provided.");
+
+        const size_t num_observables = jd.getObservables().size();
+        const size_t num_qubits = Util::log2(jd.getSizeStateVec());
+        const size_t num_obs_per_batch =
+            getNumObsPerBatch(num_qubits, num_observables, max_memory_bytes);
+
+        if (num_obs_per_batch == num_observables) {
+            adjointJacobian(jac, jd, apply_operations);
+            return;
+        }
+
+        const Schedule schedule = getSchedule(num_qubits, num_obs_per_batch);
+
+        std::optional<StateVectorManagedCPU<T>> storage;
+        std::optional<Checkpoints> checkpoints;
+        StateVectorManagedCPU<T> &forward_state = getWorkingState(
+            jd, apply_operations, schedule.threading(), storage,
+            checkpoints);
+
+        for (size_t obs_begin = 0; obs_begin < num_observables;
+             obs_begin += num_obs_per_batch) {
+            const size_t obs_end =
+                std::min(obs_begin + num_obs_per_batch, num_observables);
+            if (obs_end == num_observables) {
+                // The forward state is not needed after the last batch
+                runBatch(jac, jd, forward_state, obs_begin, obs_end, schedule,
+                         checkpoints);
+                break;
+            }
+            StateVectorManagedCPU<T> lambda(forward_state, buffer_pool_);
+            runBatch(jac, jd, lambda, obs_begin, obs_end, schedule,
+                     checkpoints);
+        }
+    }
+
+    /**
+     * @brief Calculates the expectation values of the observables of `jd`.
+     *
+     * This is the forward pass of the adjoint method, so a circuit can be
+     * executed and differentiated with the same JacobianData.
+     *
+     * @param expvals Preallocated vector for the results, one per
+     * observable.
+     * @param jd JacobianData represents the QuantumTape to execute
+     * @param apply_operations Indicate whether to apply operations to tape.psi
+     * prior to calculation.
+     */
+    void computeExpvals(std::vector<T> &expvals, const JacobianData<T> &jd,
+                        bool apply_operations = false) {
+        const auto scope = threadingScope(jd);
+        const std::vector<ObsDatum<T>> &observables = jd.getObservables();
+        PL_ABORT_IF(expvals.size() < observables.size(),
+                    "The output vector must have one element per "
+                    "observable.");
+
+        const Threading threading =
+            getSchedule(Util::log2(jd.getSizeStateVec()), 1).threading();
+        std::optional<StateVectorManagedCPU<T>> storage;
+        StateVectorManagedCPU<T> *state = jd.getStateVec();
+        if (state == nullptr) {
+            state = &storage.emplace(
+                jd.getPtrStateVec(), jd.getSizeStateVec(), threading,
+                bestCPUMemoryModel(), bestNUMAPolicy(threading),
+                Util::HugePagePolicy::Disabled, buffer_pool_);
+        }
+        if (apply_operations) {
+            applyOperations(*state, jd.getOperations());
+        }
+
+        StateVectorManagedCPU<T> work =
+            makeTemporaryState(state->getNumQubits(), threading);
+        for (size_t obs_idx = 0; obs_idx < observables.size(); obs_idx++) {
+            applyObservable(*state, work, observables[obs_idx]);
+            expvals[obs_idx] = std::real(
+                innerProdC(state->getDataVector(), work.getDataVector()));
+        }
+    }
+
+    /**
+     * @brief Execute a tape and compute its measurements and Jacobian on a
+     * single state.
+     *
+     * The forward pass and the application of the observables are shared by
+     * the measurements and the adjoint method, so executing and
+     * differentiating a tape costs the same as differentiating it. The
+     * Jacobian is computed if `jd` has trainable parameters and is stored
+     * in the same order as by adjointJacobian().
+     *
+     * @param jd JacobianData represents the QuantumTape to execute
+     * @param compute_variances Indicate whether to compute the variances of
+     * the observables.
+     * @param prob_wires Wires of the probabilities to compute. No
+     * probabilities are computed if empty.
+     * @param apply_operations Indicate whether to apply operations to tape.psi
+     * prior to calculation.
+     * @return ExecutionResults<T>
+     */
+    auto execute(const JacobianData<T> &jd, bool compute_variances = false,
+                 const std::vector<size_t> &prob_wires = {},
+                 bool apply_operations = false) -> ExecutionResults<T> {
+        const auto scope = threadingScope(jd);
+        const std::vector<ObsDatum<T>> &observables = jd.getObservables();
+        const size_t num_observables = observables.size();
+        const bool compute_jacobian = jd.hasTrainableParams();
+        const Schedule schedule =
+            getSchedule(Util::log2(jd.getSizeStateVec()),
+                        compute_jacobian ? num_observables : 1);
+
+        std::optional<StateVectorManagedCPU<T>> storage;
+        std::optional<Checkpoints> checkpoints;
+        StateVectorManagedCPU<T> &lambda = getWorkingState(
+            jd, apply_operations, schedule.threading(), storage,
+            checkpoints);
+
+        ExecutionResults<T> results;
+        if (!prob_wires.empty()) {
+            results.probs =
+                Measures<T, StateVectorManagedCPU<T>>(lambda).probs(
+                    prob_wires);
+        }
+        results.expvals.resize(num_observables);
+        if (compute_variances) {
+            results.variances.resize(num_observables);
+        }
+
+        if (!compute_jacobian) {
+            StateVectorManagedCPU<T> work =
+                makeTemporaryState(lambda.getNumQubits(), lambda.threading());
+            for (size_t obs_idx = 0; obs_idx < num_observables; obs_idx++) {
+                applyObservable(lambda, work, observables[obs_idx]);
+                storeMeasurements(results, obs_idx, lambda, work);
+            }
+            return results;
+        }
+
+        results.jacobian.resize(num_observables * jd.getNumParams());
+        runBatch(results.jacobian, jd, lambda, 0, num_observables, schedule,
+                 checkpoints, &results);
+        return results;
+    }
+
+    /**
+     * @brief Calculates the vector-Jacobian product @f$\sum_k dy_k
+     * \partial \langle O_k \rangle / \partial \theta_p@f$ with a single
+     * backward pass.
+     *
+     * As the Jacobian is linear in the observables, the cotangent is
+     * contracted up front into the single state
+     * @f$\sum_k dy_k O_k |\psi\rangle@f$, which is then propagated
+     * backwards in place of one state per observable.
+     *
+     * @param vjp Preallocated vector for the results, one per trainable
+     * parameter.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param dy Gradient-output vector, one element per observable.
+     * @param apply_operations Indicate whether to apply operations to tape.psi
+     * prior to calculation.
+     */
+    void adjointVJP(std::vector<T> &vjp, const JacobianData<T> &jd,
+                    const std::vector<T> &dy, bool apply_operations = false) {
+        const auto scope = threadingScope(jd);
+        PL_ABORT_IF(!jd.hasTrainableParams(),
+                    "No trainable parameters provided.");
+        PL_ABORT_IF(dy.size() != jd.getObservables().size(),
+                    "Invalid size for the gradient-output vector");
+        PL_ABORT_IF(vjp.size() < jd.getTrainableParams().size(),
+                    "The output vector must have one element per trainable "
+                    "parameter.");
+
+        const Schedule schedule =
+            getSchedule(Util::log2(jd.getSizeStateVec()), 1);
+
+        std::optional<StateVectorManagedCPU<T>> storage;
+        std::optional<Checkpoints> checkpoints;
+        StateVectorManagedCPU<T> &lambda = getWorkingState(
+            jd, apply_operations, schedule.threading(), storage,
+            checkpoints);
+
+        std::vector<StateVectorManagedCPU<T>> H_lambda(
+            1,
+            makeTemporaryState(lambda.getNumQubits(), schedule.threading()));
+        applyWeightedObservables(H_lambda[0], lambda, jd.getObservables(), dy);
+        backwardPass(vjp, jd, lambda, H_lambda, 1, 1, 0, schedule,
+                     checkpoints);
+    }
+
+    /**
+     * @brief Calculates the vector-Jacobian product of the output state,
+     * @f$\sum_i \mathrm{Re}(\overline{dy_i}\, \partial \psi_i / \partial
+     * \theta_p)@f$, with a single backward pass.
+     *
+     * This is the gradient of a real loss @f$L@f$ of the state for
+     * @f$dy_i = \partial L / \partial \mathrm{Re}\,\psi_i + i \partial L /
+     * \partial \mathrm{Im}\,\psi_i@f$. The cotangent takes the place of the
+     * observable-applied state, so two statevectors are propagated.
+     *
+     * @param vjp Preallocated vector for the results, one per trainable
+     * parameter.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param dy Gradient-output vector, one element per amplitude.
+     * @param apply_operations Indicate whether to apply operations to tape.psi
+     * prior to calculation.
+     */
+    void adjointStateVJP(std::vector<T> &vjp, const JacobianData<T> &jd,
+                         const std::vector<std::complex<T>> &dy,
+                         bool apply_operations = false) {
+        const auto scope = threadingScope(jd);
+        PL_ABORT_IF(!jd.hasTrainableParams(),
+                    "No trainable parameters provided.");
+        PL_ABORT_IF(dy.size() != jd.getSizeStateVec(),
+                    "Invalid size for the gradient-output vector");
+        PL_ABORT_IF(vjp.size() < jd.getTrainableParams().size(),
+                    "The output vector must have one element per trainable "
+                    "parameter.");
+
+        const Schedule schedule =
+            getSchedule(Util::log2(jd.getSizeStateVec()), 1);
+
+        std::optional<StateVectorManagedCPU<T>> storage;
+        std::optional<Checkpoints> checkpoints;
+        StateVectorManagedCPU<T> &lambda = getWorkingState(
+            jd, apply_operations, schedule.threading(), storage,
+            checkpoints);
+
+        // The backward pass computes 2 Re<H lambda|d psi>
+        std::vector<StateVectorManagedCPU<T>> H_lambda(
+            1,
+            makeTemporaryState(lambda.getNumQubits(), schedule.threading()));
+        std::complex<T> *data = H_lambda[0].getData();
+        for (size_t idx = 0; idx < dy.size(); idx++) {
+            data[idx] = dy[idx] / T{2};
+        }
+        backwardPass(vjp, jd, lambda, H_lambda, 1, 1, 0, schedule,
+                     checkpoints);
+    }
+
+    /**
+     * @brief Calculates the vector-Jacobian product @f$\sum_j dy_j
+     * \partial p_j / \partial \theta_p@f$ of the marginal probabilities of
+     * the given wires with a single backward pass.
+     *
+     * As @f$p_j = \langle\psi|P_j|\psi\rangle@f$ for the projector
+     * @f$P_j@f$ onto the outcome @f$j@f$, the cotangent is contracted into
+     * the single state @f$\sum_j dy_j P_j |\psi\rangle@f$, so the cost does
+     * not depend on the number of outcomes.
+     *
+     * @param vjp Preallocated vector for the results, one per trainable
+     * parameter.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param wires Measured wires. wires[0] corresponds to the most
+     * significant bit of the outcome.
+     * @param dy Gradient-output vector, one element per outcome.
+     * @param apply_operations Indicate whether to apply operations to tape.psi
+     * prior to calculation.
+     */
+    void adjointProbsVJP(std::vector<T> &vjp, const JacobianData<T> &jd,
+                         const std::vector<size_t> &wires,
+                         const std::vector<T> &dy,
+                         bool apply_operations = false) {
+        const auto scope = threadingScope(jd);
+        PL_ABORT_IF(!jd.hasTrainableParams(),
+                    "No trainable parameters provided.");
+        const size_t num_qubits = Util::log2(jd.getSizeStateVec());
+        const auto rev_wires = outcomeBits(wires, num_qubits);
+        PL_ABORT_IF(dy.size() != Util::exp2(wires.size()),
+                    "Invalid size for the gradient-output vector");
+        PL_ABORT_IF(vjp.size() < jd.getTrainableParams().size(),
+                    "The output vector must have one element per trainable "
+                    "parameter.");
+
+        const Schedule schedule = getSchedule(num_qubits, 1);
+
+        std::optional<StateVectorManagedCPU<T>> storage;
+        std::optional<Checkpoints> checkpoints;
+        StateVectorManagedCPU<T> &lambda = getWorkingState(
+            jd, apply_operations, schedule.threading(), storage,
+            checkpoints);
+
+        std::vector<StateVectorManagedCPU<T>> H_lambda(
+            1, makeTemporaryState(num_qubits, schedule.threading()));
+        applyWeightedProjectors(H_lambda[0], lambda, rev_wires, dy);
+        backwardPass(vjp, jd, lambda, H_lambda, 1, 1, 0, schedule,
+                     checkpoints);
+    }
+
+    /**
+     * @brief Calculates the Jacobian of the marginal probabilities of the
+     * given wires.
+     *
+     * With fewer outcomes than trainable parameters, or trainable
+     * multi-parameter operations, each row is computed by a backward pass
+     * as in adjointProbsVJP(). Otherwise, each column is computed by a
+     * forward sweep from the trainable operation, which does not depend on
+     * the number of outcomes. Either way, three statevectors are allocated.
+     *
+     * @param jac Preallocated vector for the results, in row-major order
+     * with one row per outcome and `jd.getNumParams()` columns.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param wires Measured wires. wires[0] corresponds to the most
+     * significant bit of the outcome.
+     * @param apply_operations Indicate whether to apply operations to tape.psi
+     * prior to calculation.
+     */
+    void adjointProbsJacobian(std::vector<T> &jac, const JacobianData<T> &jd,
+                              const std::vector<size_t> &wires,
+                              bool apply_operations = false) {
+        const auto scope = threadingScope(jd);
+        PL_ABORT_IF(!jd.hasTrainableParams(),
+                    "No trainable parameters provided.");
+        const size_t num_qubits = Util::log2(jd.getSizeStateVec());
+        const auto rev_wires = outcomeBits(wires, num_qubits);
+        const size_t num_outcomes = Util::exp2(wires.size());
+        const size_t row_stride = jd.getNumParams();
+        PL_ABORT_IF(jac.size() < num_outcomes * row_stride,
+                    "The output vector must have one element per outcome and "
+                    "parameter.");
+
+        const Schedule schedule = getSchedule(num_qubits, 1);
+
+        std::optional<StateVectorManagedCPU<T>> storage;
+        std::optional<Checkpoints> checkpoints;
+        StateVectorManagedCPU<T> &lambda = getWorkingState(
+            jd, apply_operations, schedule.threading(), storage,
+            checkpoints);
+        StateVectorManagedCPU<T> psi =
+            makeTemporaryState(num_qubits, schedule.threading());
+        psi.updateData(lambda.getDataVector());
+
+        if (num_outcomes > jd.getTrainableParams().size() &&
+            !hasTrainableMultiParamOps(jd)) {
+            std::fill(jac.begin(), jac.begin() + static_cast<ptrdiff_t>(
+                                                     num_outcomes * row_stride),
+                      T{0});
+            probsJacobianForward(jac, jd, psi, rev_wires, row_stride);
+            return;
+        }
+
+        std::vector<StateVectorManagedCPU<T>> H_lambda(
+            1, makeTemporaryState(num_qubits, schedule.threading()));
+        std::vector<T> dy(num_outcomes, 0);
+        for (size_t outcome = 0; outcome < num_outcomes; outcome++) {
+            if (outcome > 0) {
+                lambda.updateData(psi.getDataVector());
+            }
+            dy[outcome] = 1;
+            applyWeightedProjectors(H_lambda[0], psi, rev_wires, dy);
+            dy[outcome] = 0;
+            backwardPass(jac, jd, lambda, H_lambda, 1, 1,
+                         outcome * row_stride, schedule, checkpoints);
+        }
+    }
+    /**
+     * @brief Calculates the Hessian-vector products
+     * @f$\sum_q \partial^2 \langle O_k \rangle /
+     * \partial \theta_p \partial \theta_q v_q@f$ of the trainable
+     * parameters by forward-over-reverse differentiation.
+     *
+     * The tangent @f$|d\phi\rangle@f$ of the state along @f$v@f$ is
+     * propagated with the state through the forward pass, using the
+     * generators as @f$d(U|\phi\rangle) = U|d\phi\rangle +
+     * i c v_p G U|\phi\rangle@f$. The backward pass then propagates the
+     * tangents of the state and of the observable-applied states with them,
+     * and differentiates the adjoint Jacobian element
+     * @f$-2c\,\mathrm{Im}\langle\lambda_k|G|\phi\rangle@f$ along
+     * @f$v@f$. This costs about twice the state updates of adjointJacobian.
+     * Operations are always applied to the statevector of `jd`, and trainable
+     * operations must have a single parameter.
+     *
+     * @param hvp Preallocated vector for the results, in row-major order with
+     * one row per observable and one column per trainable parameter.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     * @param v Tangent vector, one element per trainable parameter.
+     */
+    void hessianVectorProduct(std::vector<T> &hvp, const JacobianData<T> &jd,
+                              const std::vector<T> &v) {
+        const auto scope = threadingScope(jd);
+        PL_ABORT_IF(!jd.hasTrainableParams(),
+                    "No trainable parameters provided.");
+        const size_t num_params = jd.getTrainableParams().size();
+        const auto &observables = jd.getObservables();
+        const size_t num_obs = observables.size();
+        PL_ABORT_IF(v.size() != num_params,
+                    "The tangent vector must have one element per trainable "
+                    "parameter.");
+        PL_ABORT_IF(hvp.size() != num_obs * num_params,
+                    "The output vector must have one element per observable "
+                    "and trainable parameter.");
+        std::fill(hvp.begin(), hvp.end(), T{0});
+
+        const OpsData<T> &ops = jd.getOperations();
+        const auto tp_of_op = trainableOps(jd);
+        const size_t num_qubits = Util::log2(jd.getSizeStateVec());
+        const Threading threading = getSchedule(num_qubits, 1).threading();
+
+        // The state and its tangent, followed by the observable-applied
+        // states and their tangents
+        std::vector<StateVectorManagedCPU<T>> lambda(
+            2, makeTemporaryState(num_qubits, threading));
+        std::vector<StateVectorManagedCPU<T>> H_lambda(
+            2 * num_obs, makeTemporaryState(num_qubits, threading));
+        StateVectorManagedCPU<T> mu = makeTemporaryState(num_qubits, threading);
+        StateVectorManagedCPU<T> &phi = lambda[0];
+        StateVectorManagedCPU<T> &d_phi = lambda[1];
+        std::copy(jd.getPtrStateVec(),
+                  jd.getPtrStateVec() + jd.getSizeStateVec(), phi.getData());
+        std::fill(d_phi.getData(), d_phi.getData() + d_phi.getLength(),
+                  std::complex<T>{0.0, 0.0});
+        const CompiledOps<T> compiled(ops, phi);
+
+        {
+            PL_TRACE_SCOPE("forward", "adjoint");
+            for (size_t op_idx = 0; op_idx < ops.getSize(); op_idx++) {
+                compiled.applyBatch(lambda, op_idx, false, 1);
+                const auto &tp_idx = tp_of_op[op_idx];
+                if (tp_idx && v[*tp_idx] != 0) {
+                    const T c =
+                        applyDerivativeGenerator(mu, phi, compiled, op_idx);
+                    addScaled(d_phi, {0, c * v[*tp_idx]}, mu);
+                }
+            }
+            for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+                applyObservable(phi, H_lambda[obs_idx], observables[obs_idx]);
+                applyObservable(d_phi, H_lambda[num_obs + obs_idx],
+                                observables[obs_idx]);
+            }
+        }
+
+        PL_TRACE_SCOPE("backward", "adjoint");
+        const size_t length = phi.getLength();
+        for (size_t op_idx = ops.getSize(); op_idx-- > 0;) {
+            if ((ops.getOpsName()[op_idx] == "QubitStateVector") ||
+                (ops.getOpsName()[op_idx] == "BasisState")) {
+                continue;
+            }
+            const auto &tp_idx = tp_of_op[op_idx];
+            if (tp_idx) {
+                // d/dv of -2c Im<lambda|G|phi>
+                const T c = applyDerivativeGenerator(mu, phi, compiled, op_idx);
+                std::vector<std::complex<T>> prods(num_obs);
+                for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+                    prods[obs_idx] = innerProdC(
+                        H_lambda[num_obs + obs_idx].getData(), mu.getData(),
+                        length);
+                }
+                applyDerivativeGenerator(mu, d_phi, compiled, op_idx);
+                for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+                    prods[obs_idx] += innerProdC(H_lambda[obs_idx].getData(),
+                                                 mu.getData(), length);
+                    hvp[obs_idx * num_params + *tp_idx] =
+                        -2 * c * std::imag(prods[obs_idx]);
+                }
+            }
+            compiled.applyBatch(lambda, op_idx, true, 1);
+            compiled.applyBatch(H_lambda, op_idx, true, 1);
+            if (tp_idx && v[*tp_idx] != 0) {
+                // The tangents of the adjoint operation
+                const T c = applyDerivativeGenerator(mu, phi, compiled, op_idx);
+                const std::complex<T> coeff{0, -c * v[*tp_idx]};
+                addScaled(d_phi, coeff, mu);
+                for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+                    applyDerivativeGenerator(mu, H_lambda[obs_idx], compiled,
+                                             op_idx);
+                    addScaled(H_lambda[num_obs + obs_idx], coeff, mu);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Calculates the Hessians of the expectation values with respect
+     * to the trainable parameters.
+     *
+     * Each column is the Hessian-vector product with a unit vector, so this
+     * costs one call of hessianVectorProduct() per trainable parameter. The
+     * result is symmetrised.
+     *
+     * @param hess Preallocated vector for the results, with the row-major
+     * @f$P \times P@f$ Hessian of each observable in turn.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     */
+    void adjointHessian(std::vector<T> &hess, const JacobianData<T> &jd) {
+        const size_t num_params = jd.getTrainableParams().size();
+        const size_t num_obs = jd.getObservables().size();
+        PL_ABORT_IF(hess.size() != num_obs * num_params * num_params,
+                    "The output vector must have one element per observable "
+                    "and pair of trainable parameters.");
+        std::vector<T> v(num_params, 0);
+        std::vector<T> hvp(num_obs * num_params);
+        for (size_t col = 0; col < num_params; col++) {
+            v[col] = 1;
+            hessianVectorProduct(hvp, jd, v);
+            v[col] = 0;
+            for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+                for (size_t row = 0; row < num_params; row++) {
+                    hess[(obs_idx * num_params + row) * num_params + col] =
+                        hvp[obs_idx * num_params + row];
+                }
+            }
+        }
+        for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+            T *block = hess.data() + obs_idx * num_params * num_params;
+            for (size_t row = 0; row < num_params; row++) {
+                for (size_t col = row + 1; col < num_params; col++) {
+                    const T sym = (block[row * num_params + col] +
+                                   block[col * num_params + row]) /
+                                  2;
+                    block[row * num_params + col] = sym;
+                    block[col * num_params + row] = sym;
+                }
+            }
+        }
+    }
+    /**
+     * @brief Calculates the Fubini-Study metric tensor
+     * @f$g_{ij} = \mathrm{Re}[\langle \partial_i \psi | \partial_j \psi
+     * \rangle - \langle \partial_i \psi | \psi \rangle \langle \psi |
+     * \partial_j \psi \rangle]@f$ of the trainable parameters.
+     *
+     * With @f$|\phi_j\rangle@f$ the state after the operation of parameter
+     * @f$j@f$, @f$\langle \partial_i \psi | \partial_j \psi \rangle =
+     * c_i c_j \langle \phi_i | G_i U_{i+1:j}^\dagger G_j | \phi_j
+     * \rangle@f$ for @f$i \le j@f$. After a forward pass, a single backward
+     * pass carries @f$G_j|\phi_j\rangle@f$ for each visited parameter back
+     * with the state, and takes the inner products of all of them with
+     * @f$G_i|\phi_i\rangle@f$ at once on reaching parameter @f$i@f$. This
+     * costs as many operations as adjointJacobian with one observable per
+     * trainable parameter. The operations are applied to the statevector of
+     * `jd`, whose observables are not used, and trainable operations must
+     * have a single parameter.
+     *
+     * Generators follow the convention of the operations, e.g. the metric
+     * of @f$RX(\theta)|0\rangle@f$ is @f$\mathrm{Var}(X)/4 = 1/4@f$.
+     *
+     * @param metric Preallocated vector for the row-major @f$P \times P@f$
+     * metric tensor.
+     * @param jd JacobianData represents the QuantumTape to differentiate
+     */
+    void metricTensor(std::vector<T> &metric, const JacobianData<T> &jd) {
+        const auto scope = threadingScope(jd);
+        PL_ABORT_IF(!jd.hasTrainableParams(),
+                    "No trainable parameters provided.");
+        const size_t num_params = jd.getTrainableParams().size();
+        PL_ABORT_IF(metric.size() != num_params * num_params,
+                    "The output vector must have one element per pair of "
+                    "trainable parameters.");
+        std::fill(metric.begin(), metric.end(), T{0});
+        const Schedule schedule =
+            getSchedule(Util::log2(jd.getSizeStateVec()), num_params);
+        if (schedule.num_obs_threads > 1 && schedule.num_elem_threads > 1) {
+            [[maybe_unused]] const NestedThreadsGuard guard(
+                schedule.num_elem_threads);
+            metricTensorSweeps(metric, jd, schedule);
+        } else {
+            metricTensorSweeps(metric, jd, schedule);
         }
-        jac = Transpose(jac, jd.getNumParams(), num_observables);
     }
 }; // class AdjointJacobian
 } // namespace Pennylane::Algorithms
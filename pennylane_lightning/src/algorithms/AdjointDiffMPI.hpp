@@ -0,0 +1,175 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file AdjointDiffMPI.hpp
+ * Defines the adjoint method for statevectors distributed over MPI ranks.
+ * Requires ENABLE_MPI.
+ */
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "JacobianTape.hpp"
+#include "StateVectorMPI.hpp"
+
+namespace Pennylane::Algorithms {
+/**
+ * @brief Adjoint Jacobian method of arXiV:2009.02823 for StateVectorMPI.
+ *
+ * Each rank propagates its slices of the states, and the inner products
+ * are reduced over all ranks. Observables must be given as gates or
+ * matrices.
+ *
+ * @tparam T Floating-point precision.
+ */
+template <class T = double> class AdjointJacobianMPI {
+  private:
+    static void applyOperation(StateVectorMPI<T> &state, const OpsData<T> &ops,
+                               size_t op_idx, bool adj) {
+        const bool inverse = ops.getOpsInverses()[op_idx] ^ adj;
+        const auto &name = ops.getOpsName()[op_idx];
+        if (DynamicDispatcher<T>::getInstance().hasGateOp(name)) {
+            state.applyOperation(name, ops.getOpsWires()[op_idx], inverse,
+                                 ops.getOpsParams()[op_idx]);
+            return;
+        }
+        PL_ABORT_IF(ops.getOpsMatrices()[op_idx].empty(),
+                    "The operation " + name +
+                        " is not supported by the distributed statevector.");
+        state.applyMatrix(ops.getOpsMatrices()[op_idx],
+                          ops.getOpsWires()[op_idx], inverse);
+    }
+
+    static void applyObservable(StateVectorMPI<T> &state,
+                                const ObsDatum<T> &observable) {
+        PL_ABORT_IF(observable.getPauliSum() ||
+                        observable.getSparseHamiltonian(),
+                    "Pauli sums and sparse Hamiltonians are not supported "
+                    "by the distributed adjoint method.");
+        for (size_t j = 0; j < observable.getSize(); j++) {
+            const auto &name = observable.getObsName()[j];
+            const auto &wires = observable.getObsWires()[j];
+            if (observable.getObsParams().empty()) {
+                state.applyOperation(name, wires);
+                continue;
+            }
+            std::visit(
+                [&](const auto &param) {
+                    using p_t = std::decay_t<decltype(param)>;
+                    if constexpr (std::is_same_v<p_t, std::vector<T>>) {
+                        state.applyOperation(name, wires, false, param);
+                    } else if constexpr (std::is_same_v<
+                                             p_t,
+                                             std::vector<std::complex<T>>>) {
+                        state.applyMatrix(param, wires);
+                    } else {
+                        state.applyOperation(name, wires);
+                    }
+                },
+                observable.getObsParams()[j]);
+        }
+    }
+
+  public:
+    /**
+     * @brief Calculates the Jacobian of the expectation values of the
+     * observables with respect to the trainable parameters.
+     *
+     * The result is stored in `jac[obs_idx * trainableParams.size() +
+     * param_idx]`, as by AdjointJacobian::adjointJacobian.
+     *
+     * @param jac Preallocated vector for Jacobian data results.
+     * @param state Statevector, before the operations if `apply_operations`
+     * is set, and after them otherwise. It is not modified.
+     * @param observables Observables.
+     * @param ops Operations.
+     * @param trainableParams Indices of the trainable parameters among the
+     * parameters of parametric operations.
+     * @param apply_operations Indicate whether to apply the operations to
+     * the state prior to calculation.
+     */
+    void adjointJacobian(std::vector<T> &jac, const StateVectorMPI<T> &state,
+                         const std::vector<ObsDatum<T>> &observables,
+                         const OpsData<T> &ops,
+                         const std::vector<size_t> &trainableParams,
+                         bool apply_operations = false) {
+        PL_ABORT_IF(trainableParams.empty(),
+                    "No trainable parameters provided.");
+        const size_t tp_size = trainableParams.size();
+        const size_t num_observables = observables.size();
+        PL_ABORT_IF(jac.size() < num_observables * tp_size,
+                    "The output vector must have one element per observable "
+                    "and trainable parameter.");
+
+        StateVectorMPI<T> lambda(state);
+        if (apply_operations) {
+            for (size_t op_idx = 0; op_idx < ops.getSize(); op_idx++) {
+                applyOperation(lambda, ops, op_idx, false);
+            }
+        }
+
+        std::vector<StateVectorMPI<T>> H_lambda(num_observables, lambda);
+        for (size_t obs_idx = 0; obs_idx < num_observables; obs_idx++) {
+            applyObservable(H_lambda[obs_idx], observables[obs_idx]);
+        }
+
+        auto tp_it = trainableParams.rbegin();
+        size_t tp_idx = tp_size - 1;
+        size_t param_idx = ops.getNumParOps() - 1;
+        const auto &ops_name = ops.getOpsName();
+        for (size_t op_idx = ops.getSize(); op_idx-- > 0;) {
+            PL_ABORT_IF(ops.getOpsParams()[op_idx].size() > 1,
+                        "The operation is not supported using the adjoint "
+                        "differentiation method");
+            if ((ops_name[op_idx] == "QubitStateVector") ||
+                (ops_name[op_idx] == "BasisState")) {
+                continue;
+            }
+            if (tp_it == trainableParams.rend()) {
+                break; // All done
+            }
+            StateVectorMPI<T> mu(lambda);
+            applyOperation(lambda, ops, op_idx, true);
+
+            if (ops.hasParams(op_idx)) {
+                if (param_idx == *tp_it) {
+                    const bool inverse = ops.getOpsInverses()[op_idx];
+                    const T scaling =
+                        mu.applyGenerator(ops_name[op_idx],
+                                          ops.getOpsWires()[op_idx],
+                                          !inverse) *
+                        (inverse ? -1 : 1);
+                    for (size_t obs_idx = 0; obs_idx < num_observables;
+                         obs_idx++) {
+                        jac[obs_idx * tp_size + tp_idx] =
+                            -2 * scaling *
+                            std::imag(H_lambda[obs_idx].innerProd(mu));
+                    }
+                    tp_idx--;
+                    ++tp_it;
+                }
+                param_idx--;
+            }
+            for (auto &h_state : H_lambda) {
+                applyOperation(h_state, ops, op_idx, true);
+            }
+        }
+    }
+};
+} // namespace Pennylane::Algorithms
@@ -0,0 +1,445 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a gate sequence executed for many sets of parameters at once.
+ */
+#pragma once
+
+#include "Constant.hpp"
+#include "ConstantUtil.hpp"
+#include "CPUMemoryModel.hpp"
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "KernelMap.hpp"
+#include "KernelType.hpp"
+#include "Memory.hpp"
+#include "PauliSum.hpp"
+#include "StateVectorBatchMajor.hpp"
+#include "Threading.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace Pennylane::Algorithms {
+/**
+ * @brief A fixed gate sequence executed for many sets of parameters.
+ *
+ * Gate names are resolved once on construction and kernels once per batch,
+ * so executing each circuit of a batch only dispatches pre-resolved
+ * operations. The parameters of all circuits are given as a row-major
+ * @f$N \times P@f$ matrix, where row @f$i@f$ holds the parameters of circuit
+ * @f$i@f$ concatenated in the order of the operations.
+ *
+ * Circuits are executed concurrently using single-threaded gate kernels when
+ * there are enough of them to occupy all threads. Otherwise, they are executed
+ * one after another using multi-threaded gate kernels. Circuits on few qubits
+ * are instead executed in groups of batch_major_width, with each group stored
+ * batch-major (see StateVectorBatchMajor) so that the SIMD lanes of the gate
+ * kernels map to the circuits of the group.
+ *
+ * @tparam T Floating point precision.
+ */
+template <class T> class BatchedCircuit {
+  public:
+    using ComplexT = std::complex<T>;
+
+  private:
+    std::vector<Gates::GateOperation> gate_ops_;
+    std::vector<std::vector<size_t>> ops_wires_;
+    std::vector<bool> ops_inverse_;
+    std::vector<size_t> param_offsets_; // Size is the number of ops + 1
+
+    /**
+     * @brief Get the number of available threads.
+     */
+    static auto getMaxNumThreads() -> size_t {
+#if defined(_OPENMP)
+        return static_cast<size_t>(omp_get_max_threads());
+#else
+        return 1;
+#endif
+    }
+
+    /**
+     * @brief Get the kernel of each operation.
+     *
+     * @param num_qubits Number of qubits.
+     * @param threading Threading option.
+     * @param memory_model Memory model of the statevectors.
+     */
+    [[nodiscard]] auto getKernels(size_t num_qubits, Threading threading,
+                                  CPUMemoryModel memory_model) const
+        -> std::vector<Gates::KernelType> {
+        using KernelMap::OperationKernelMap;
+        const auto kernel_map =
+            OperationKernelMap<Gates::GateOperation>::getInstance()
+                .getKernelMap(num_qubits, threading, memory_model);
+        std::vector<Gates::KernelType> kernels;
+        kernels.reserve(gate_ops_.size());
+        for (const auto gate_op : gate_ops_) {
+            kernels.emplace_back(kernel_map.at(gate_op));
+        }
+        return kernels;
+    }
+
+    /**
+     * @brief Check the wires of all operations are valid for the given
+     * number of qubits.
+     *
+     * @param num_qubits Number of qubits.
+     */
+    void checkWires(size_t num_qubits) const {
+        for (const auto &wires : ops_wires_) {
+            for (const size_t wire : wires) {
+                PL_ABORT_IF(wire >= num_qubits, "Invalid wire index.");
+            }
+        }
+    }
+
+    /**
+     * @brief Apply all operations to the statevector.
+     *
+     * @param data Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param kernels Kernel of each operation.
+     * @param params Parameters of the circuit.
+     * @param op_params Buffer for the parameters of each operation.
+     */
+    void applyCircuit(ComplexT *data, size_t num_qubits,
+                      const std::vector<Gates::KernelType> &kernels,
+                      const T *params, std::vector<T> &op_params) const {
+        const auto &dispatcher = DynamicDispatcher<T>::getInstance();
+        for (size_t op_idx = 0; op_idx < gate_ops_.size(); op_idx++) {
+            op_params.assign(params + param_offsets_[op_idx],
+                             params + param_offsets_[op_idx + 1]);
+            dispatcher.applyOperation(kernels[op_idx], data, num_qubits,
+                                      gate_ops_[op_idx], ops_wires_[op_idx],
+                                      ops_inverse_[op_idx], op_params);
+        }
+    }
+
+    /**
+     * @brief Execute func(first_circuit_idx, batch) for groups of at most
+     * batch_major_width consecutive circuits, where statevector b of the
+     * batch holds the final state of circuit first_circuit_idx + b.
+     *
+     * @param init_state Pointer to the initial state.
+     * @param num_qubits Number of qubits.
+     * @param params Parameter matrix.
+     * @param num_circuits Number of circuits.
+     * @param func Function consuming the final states of a group.
+     */
+    template <class Func>
+    void forEachBatchMajor(const ComplexT *init_state, size_t num_qubits,
+                           const T *params, size_t num_circuits,
+                           Func &&func) const {
+        const size_t num_params = getNumParams();
+        const size_t num_batches =
+            (num_circuits + batch_major_width - 1) / batch_major_width;
+
+        // clang-format off
+        std::exception_ptr ex = nullptr;
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(dynamic) \
+                default(none) shared(init_state, num_qubits, params, \
+                                     num_circuits, num_params, num_batches, \
+                                     func, ex)
+        #endif
+        for (size_t batch_idx = 0; batch_idx < num_batches; batch_idx++) {
+            try {
+                const size_t first = batch_idx * batch_major_width;
+                const size_t batch_size =
+                    std::min(batch_major_width, num_circuits - first);
+                StateVectorBatchMajor<T> batch(num_qubits, batch_size);
+                batch.setAllStates(init_state);
+                const T *batch_params = params + first * num_params;
+                for (size_t op_idx = 0; op_idx < gate_ops_.size(); op_idx++) {
+                    batch.applyOperation(
+                        gate_ops_[op_idx], ops_wires_[op_idx],
+                        ops_inverse_[op_idx],
+                        batch_params + param_offsets_[op_idx], num_params);
+                }
+                func(first, batch);
+            } catch (...) {
+                #if defined(_OPENMP)
+                    #pragma omp critical
+                #endif
+                ex = std::current_exception();
+            }
+        }
+        if (ex) {
+            std::rethrow_exception(ex); //LCOV_EXCL_LINE
+        }
+        // clang-format on
+    }
+
+    /**
+     * @brief Execute func(circuit_idx, kernels) for all circuits.
+     *
+     * @param num_qubits Number of qubits.
+     * @param num_circuits Number of circuits.
+     * @param memory_model Memory model of the statevectors.
+     * @param func Function executing a single circuit.
+     */
+    template <class Func>
+    void forEachCircuit(size_t num_qubits, size_t num_circuits,
+                        CPUMemoryModel memory_model, Func &&func) const {
+        const Threading threading =
+            chooseThreading(num_qubits, num_circuits, getMaxNumThreads());
+        const auto kernels = getKernels(num_qubits, threading, memory_model);
+        [[maybe_unused]] const bool parallel_circuits =
+            (threading == Threading::SingleThread) && (num_circuits > 1);
+
+        // clang-format off
+        // Globally scoped exception value to be captured within OpenMP block.
+        // See the following for OpenMP design decisions:
+        // https://www.openmp.org/wp-content/uploads/openmp-examples-4.5.0.pdf
+        std::exception_ptr ex = nullptr;
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(dynamic) if(parallel_circuits) \
+                default(none) shared(num_circuits, kernels, func, ex)
+        #endif
+        for (size_t circuit_idx = 0; circuit_idx < num_circuits;
+             circuit_idx++) {
+            try {
+                func(circuit_idx, kernels);
+            } catch (...) {
+                #if defined(_OPENMP)
+                    #pragma omp critical
+                #endif
+                ex = std::current_exception();
+            }
+        }
+        if (ex) {
+            std::rethrow_exception(ex); //LCOV_EXCL_LINE
+        }
+        // clang-format on
+    }
+
+  public:
+    /**
+     * @brief Maximum number of qubits for which circuits are executed
+     * batch-major. A group of batch_major_width statevectors then fits in
+     * the L2 cache.
+     */
+    constexpr static size_t batch_major_max_num_qubits = 10;
+
+    /**
+     * @brief Number of circuits executed together batch-major, a multiple of
+     * the number of lanes of the widest vector unit.
+     */
+    constexpr static size_t batch_major_width = 16;
+
+    /**
+     * @brief Construct a batched circuit.
+     *
+     * @param ops_name Name of each operation.
+     * @param ops_wires Wires of each operation.
+     * @param ops_inverse Indicates whether each operation is to be inverted.
+     */
+    BatchedCircuit(const std::vector<std::string> &ops_name,
+                   std::vector<std::vector<size_t>> ops_wires,
+                   std::vector<bool> ops_inverse)
+        : ops_wires_{std::move(ops_wires)},
+          ops_inverse_{std::move(ops_inverse)} {
+        PL_ABORT_IF(ops_name.size() != ops_wires_.size() ||
+                        ops_name.size() != ops_inverse_.size(),
+                    "The number of operations, wires, and inverses must all "
+                    "be equal.");
+        const auto &dispatcher = DynamicDispatcher<T>::getInstance();
+        gate_ops_.reserve(ops_name.size());
+        param_offsets_.reserve(ops_name.size() + 1);
+        param_offsets_.emplace_back(0);
+        for (size_t op_idx = 0; op_idx < ops_name.size(); op_idx++) {
+            const auto gate_op = dispatcher.strToGateOp(ops_name[op_idx]);
+            if (!Util::array_has_elt(Gates::Constant::multi_qubit_gates,
+                                     gate_op)) {
+                PL_ABORT_IF(ops_wires_[op_idx].size() !=
+                                Util::lookup(Gates::Constant::gate_wires,
+                                             gate_op),
+                            "The number of wires does not match the gate.");
+            }
+            gate_ops_.emplace_back(gate_op);
+            param_offsets_.emplace_back(
+                param_offsets_.back() +
+                Util::lookup(Gates::Constant::gate_num_params, gate_op));
+        }
+    }
+
+    /**
+     * @brief Get the number of operations.
+     */
+    [[nodiscard]] auto getNumOps() const -> size_t { return gate_ops_.size(); }
+
+    /**
+     * @brief Get the number of parameters of each circuit, i.e. the number of
+     * columns of the parameter matrix.
+     */
+    [[nodiscard]] auto getNumParams() const -> size_t {
+        return param_offsets_.back();
+    }
+
+    /**
+     * @brief Choose the threading of gate kernels for a batch.
+     *
+     * @param num_qubits Number of qubits.
+     * @param num_circuits Number of circuits in the batch.
+     * @param num_threads Number of available threads.
+     * @return Threading::SingleThread if circuits are executed concurrently,
+     * Threading::MultiThread otherwise.
+     */
+    static auto chooseThreading(size_t num_qubits, size_t num_circuits,
+                                size_t num_threads) -> Threading {
+        if (num_circuits < num_threads &&
+            num_qubits >= KernelMap::parallel_lm_min_num_qubits) {
+            return Threading::MultiThread;
+        }
+        return Threading::SingleThread;
+    }
+
+    /**
+     * @brief Check whether a batch is executed batch-major.
+     *
+     * @param num_qubits Number of qubits.
+     * @param num_circuits Number of circuits in the batch.
+     */
+    static auto useBatchMajor(size_t num_qubits, size_t num_circuits)
+        -> bool {
+        return num_circuits > 1 && num_qubits <= batch_major_max_num_qubits;
+    }
+
+    /**
+     * @brief Compute the final state of each circuit.
+     *
+     * @param init_state Pointer to the initial state.
+     * @param num_qubits Number of qubits.
+     * @param params Parameter matrix of size num_circuits * getNumParams()
+     * in row-major order.
+     * @param num_circuits Number of circuits.
+     * @param out Pointer to the output of size num_circuits * 2^num_qubits.
+     * Row i receives the final state of circuit i.
+     */
+    void executeStates(const ComplexT *init_state, size_t num_qubits,
+                       const T *params, size_t num_circuits,
+                       ComplexT *out) const {
+        checkWires(num_qubits);
+        if (num_circuits == 0) {
+            return;
+        }
+        const size_t length = Util::exp2(num_qubits);
+        const size_t num_params = getNumParams();
+
+        if (useBatchMajor(num_qubits, num_circuits)) {
+            forEachBatchMajor(
+                init_state, num_qubits, params, num_circuits,
+                [&](size_t first, const StateVectorBatchMajor<T> &batch) {
+                    for (size_t b = 0; b < batch.getBatchSize(); b++) {
+                        batch.copyState(b, out + (first + b) * length);
+                    }
+                });
+            return;
+        }
+
+        // Every row is aligned only if both the first and the second rows are
+        const CPUMemoryModel memory_model = std::min(
+            getMemoryModel(out), getMemoryModel(out + length),
+            [](CPUMemoryModel lhs, CPUMemoryModel rhs) {
+                return getAlignment<ComplexT>(lhs) <
+                       getAlignment<ComplexT>(rhs);
+            });
+
+        forEachCircuit(
+            num_qubits, num_circuits, memory_model,
+            [&](size_t circuit_idx,
+                const std::vector<Gates::KernelType> &kernels) {
+                ComplexT *data = out + circuit_idx * length;
+                std::vector<T> op_params;
+                std::copy(init_state, init_state + length, data);
+                applyCircuit(data, num_qubits, kernels,
+                             params + circuit_idx * num_params, op_params);
+            });
+    }
+
+    /**
+     * @brief Compute the expectation values of observables for each circuit.
+     *
+     * @param init_state Pointer to the initial state.
+     * @param num_qubits Number of qubits.
+     * @param params Parameter matrix of size num_circuits * getNumParams()
+     * in row-major order.
+     * @param num_circuits Number of circuits.
+     * @param observables Observables to measure.
+     * @return std::vector<T> Row-major matrix of size
+     * num_circuits * observables.size(). Element (i, j) is the expectation
+     * value of observable j for circuit i.
+     */
+    [[nodiscard]] auto
+    executeExpval(const ComplexT *init_state, size_t num_qubits,
+                  const T *params, size_t num_circuits,
+                  const std::vector<PauliSum<T>> &observables) const
+        -> std::vector<T> {
+        checkWires(num_qubits);
+        const size_t length = Util::exp2(num_qubits);
+        const size_t num_params = getNumParams();
+        const size_t num_obs = observables.size();
+        const CPUMemoryModel memory_model = bestCPUMemoryModel();
+
+        std::vector<T> expvals(num_circuits * num_obs);
+        if (useBatchMajor(num_qubits, num_circuits)) {
+            forEachBatchMajor(
+                init_state, num_qubits, params, num_circuits,
+                [&](size_t first, const StateVectorBatchMajor<T> &batch) {
+                    std::vector<ComplexT> data(length);
+                    for (size_t b = 0; b < batch.getBatchSize(); b++) {
+                        batch.copyState(b, data.data());
+                        for (size_t obs_idx = 0; obs_idx < num_obs;
+                             obs_idx++) {
+                            expvals[(first + b) * num_obs + obs_idx] =
+                                observables[obs_idx].expval(data.data(),
+                                                            num_qubits);
+                        }
+                    }
+                });
+            return expvals;
+        }
+        forEachCircuit(
+            num_qubits, num_circuits, memory_model,
+            [&](size_t circuit_idx,
+                const std::vector<Gates::KernelType> &kernels) {
+                std::vector<ComplexT, Util::AlignedAllocator<ComplexT>> data(
+                    init_state, init_state + length,
+                    getAllocator<ComplexT>(memory_model));
+                std::vector<T> op_params;
+                applyCircuit(data.data(), num_qubits, kernels,
+                             params + circuit_idx * num_params, op_params);
+                for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+                    expvals[circuit_idx * num_obs + obs_idx] =
+                        observables[obs_idx].expval(data.data(), num_qubits);
+                }
+            });
+        return expvals;
+    }
+};
+} // namespace Pennylane::Algorithms
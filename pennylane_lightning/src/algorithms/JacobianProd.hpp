@@ -14,6 +14,9 @@
 #pragma once
 
 #include <algorithm>
+#include <complex>
+#include <functional>
+#include <stdexcept>
 
 #include "AdjointDiff.hpp"
 #include "JacobianTape.hpp"
@@ -124,15 +127,103 @@ template <class T = double> class VectorJacobianProduct {
                 return {};
             }
 
-            std::vector<T> vjp(num_params);
-            std::vector<T> jac(jd.getNumObservables() * num_params, 0);
+            if (dy.size() != jd.getNumObservables()) {
+                throw std::invalid_argument(
+                    "Invalid size for the gradient-output vector");
+            }
 
-            // Compute Jacobian for the input jd using `adjoint` method
+            // Contract dy with the observables before the backward pass of
+            // the adjoint method, so that a single state is propagated
+            // instead of one per observable.
+            std::vector<T> vjp(num_params, 0);
+            AdjointJacobian<T> v;
+            v.adjointVJP(vjp, jd, dy, apply_operations);
+            return vjp;
+        };
+    }
+
+    /**
+     * @brief Calculates the VectorJacobianProduct of the marginal
+     * probabilities of the given wires using `AdjointJacobian`.
+     *
+     * @param dy Gradient-output vector, one element per outcome.
+     * @param wires Measured wires. wires[0] corresponds to the most
+     * significant bit of the outcome.
+     * @param num_params Total number of parameters in the QuantumTape
+     * @param apply_operations Indicate whether to apply operations to jd.psi
+     * prior to calculation.
+     *
+     * @return std::function<std::vector<T>(const JacobianData<T> &jd)>
+     * where `jd` is a JacobianData object representing the QuantumTape
+     * to differentiate.
+     */
+    auto probsVectorJacobianProduct(const std::vector<T> &dy,
+                                    const std::vector<size_t> &wires,
+                                    size_t num_params,
+                                    bool apply_operations = false)
+        -> std::function<std::vector<T>(const JacobianData<T> &)> {
+        if (dy.size() != Util::exp2(wires.size())) {
+            throw std::invalid_argument(
+                "Invalid size for the gradient-output vector");
+        }
+        if (std::all_of(dy.cbegin(), dy.cend(), [](T e) { return e == 0; })) {
+            return
+                [num_params =
+                     num_params]([[maybe_unused]] const JacobianData<T> &jd)
+                    -> std::vector<T> { return std::vector<T>(num_params, 0); };
+        }
+
+        return [=](const JacobianData<T> &jd) -> std::vector<T> {
+            if (!jd.hasTrainableParams()) {
+                return {};
+            }
+            // The outcomes are contracted with dy, so a single state is
+            // propagated regardless of the number of outcomes.
+            std::vector<T> vjp(num_params, 0);
             AdjointJacobian<T> v;
-            v.adjointJacobian(jac, jd, apply_operations);
+            v.adjointProbsVJP(vjp, jd, wires, dy, apply_operations);
+            return vjp;
+        };
+    }
 
-            // Compute VJP
-            computeVJP(vjp, jac, dy, jd.getNumObservables(), num_params);
+    /**
+     * @brief Calculates the VectorJacobianProduct of the output state using
+     * `AdjointJacobian`.
+     *
+     * @param dy Gradient-output vector, one element per amplitude, in the
+     * convention of AdjointJacobian::adjointStateVJP().
+     * @param num_params Total number of parameters in the QuantumTape
+     * @param apply_operations Indicate whether to apply operations to jd.psi
+     * prior to calculation.
+     *
+     * @return std::function<std::vector<T>(const JacobianData<T> &jd)>
+     * where `jd` is a JacobianData object representing the QuantumTape
+     * to differentiate.
+     */
+    auto stateVectorJacobianProduct(const std::vector<std::complex<T>> &dy,
+                                    size_t num_params,
+                                    bool apply_operations = false)
+        -> std::function<std::vector<T>(const JacobianData<T> &)> {
+        if (std::all_of(dy.cbegin(), dy.cend(), [](std::complex<T> e) {
+                return e == std::complex<T>{0, 0};
+            })) {
+            return
+                [num_params =
+                     num_params]([[maybe_unused]] const JacobianData<T> &jd)
+                    -> std::vector<T> { return std::vector<T>(num_params, 0); };
+        }
+
+        return [=](const JacobianData<T> &jd) -> std::vector<T> {
+            if (!jd.hasTrainableParams()) {
+                return {};
+            }
+            if (dy.size() != jd.getSizeStateVec()) {
+                throw std::invalid_argument(
+                    "Invalid size for the gradient-output vector");
+            }
+            std::vector<T> vjp(num_params, 0);
+            AdjointJacobian<T> v;
+            v.adjointStateVJP(vjp, jd, dy, apply_operations);
             return vjp;
         };
     }
@@ -21,4 +21,7 @@ template class Pennylane::Algorithms::ObsDatum<std::complex<float>>;
 template class Pennylane::Algorithms::ObsDatum<std::complex<double>>;
 
 template class Pennylane::Algorithms::JacobianData<float>;
-template class Pennylane::Algorithms::JacobianData<double>;
\ No newline at end of file
+template class Pennylane::Algorithms::JacobianData<double>;
+
+template class Pennylane::Algorithms::CompiledOps<float>;
+template class Pennylane::Algorithms::CompiledOps<double>;
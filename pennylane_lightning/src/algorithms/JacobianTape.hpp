@@ -13,12 +13,29 @@
 // limitations under the License.
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <complex>
 #include <cstring>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
 
+#include "CostLayer.hpp"
+#include "Gates.hpp"
+#include "GeneratorOverlap.hpp"
+#include "MeasuresKernels.hpp"
+#include "PauliRot.hpp"
+#include "PauliSum.hpp"
+#include "SparseHamiltonian.hpp"
+#include "StateVectorManagedCPU.hpp"
+
 namespace Pennylane::Algorithms {
 
 /**
@@ -52,6 +69,34 @@ template <class T = double> class ObsDatum {
           obs_params_(std::move(obs_params)), obs_wires_{
                                                   std::move(obs_wires)} {};
 
+    /**
+     * @brief Construct an ObsDatum object representing a Hamiltonian given
+     * by a linear combination of Pauli words.
+     *
+     * The observable has a single operation named "Hamiltonian" acting on
+     * all wires of the Hamiltonian.
+     *
+     * @param hamiltonian Hamiltonian.
+     */
+    explicit ObsDatum(PauliSum<T> hamiltonian)
+        : obs_name_{"Hamiltonian"}, obs_params_{},
+          obs_wires_{hamiltonian.getAllWires()}, pauli_sum_{
+                                                     std::move(hamiltonian)} {};
+
+    /**
+     * @brief Construct an ObsDatum object representing a Hamiltonian given
+     * by a sparse matrix.
+     *
+     * The observable has a single operation named "SparseHamiltonian" acting
+     * on all wires.
+     *
+     * @param hamiltonian Hamiltonian.
+     */
+    explicit ObsDatum(SparseHamiltonian<T> hamiltonian)
+        : obs_name_{"SparseHamiltonian"}, obs_params_{},
+          obs_wires_{allWires(hamiltonian.getNumQubits())},
+          sparse_hamiltonian_{std::move(hamiltonian)} {};
+
     /**
      * @brief Get the number of operations in observable.
      *
@@ -85,12 +130,312 @@ template <class T = double> class ObsDatum {
         return obs_wires_;
     }
 
+    /**
+     * @brief Get the Hamiltonian if the observable is given by a linear
+     * combination of Pauli words, and std::nullopt otherwise.
+     *
+     * @return const std::optional<PauliSum<T>>&
+     */
+    [[nodiscard]] auto getPauliSum() const
+        -> const std::optional<PauliSum<T>> & {
+        return pauli_sum_;
+    }
+
+    /**
+     * @brief Get the Hamiltonian if the observable is given by a sparse
+     * matrix, and std::nullopt otherwise.
+     *
+     * @return const std::optional<SparseHamiltonian<T>>&
+     */
+    [[nodiscard]] auto getSparseHamiltonian() const
+        -> const std::optional<SparseHamiltonian<T>> & {
+        return sparse_hamiltonian_;
+    }
+
   private:
     const std::vector<std::string> obs_name_;
     const std::vector<param_var_t> obs_params_;
     const std::vector<std::vector<size_t>> obs_wires_;
+    const std::optional<PauliSum<T>> pauli_sum_;
+    const std::optional<SparseHamiltonian<T>> sparse_hamiltonian_;
+
+    /**
+     * @brief Get the wires of a single operation acting on all qubits.
+     *
+     * @param num_qubits Number of qubits.
+     */
+    static auto allWires(size_t num_qubits)
+        -> std::vector<std::vector<size_t>> {
+        std::vector<size_t> wires(num_qubits);
+        std::iota(wires.begin(), wires.end(), 0);
+        return {wires};
+    }
 };
 
+/**
+ * @brief Apply the observable to the statevector.
+ *
+ * @param state Statevector to be updated.
+ * @param observable Observable to apply.
+ */
+template <class T>
+void applyObservable(StateVectorManagedCPU<T> &state,
+                     const ObsDatum<T> &observable) {
+    if (const auto &pauli_sum = observable.getPauliSum(); pauli_sum) {
+        std::vector<std::complex<T>> out(state.getLength());
+        pauli_sum->apply(state.getData(), out.data(), state.getNumQubits());
+        state.updateData(out);
+        return;
+    }
+    if (const auto &sparse_ham = observable.getSparseHamiltonian();
+        sparse_ham) {
+        PL_ABORT_IF(sparse_ham->getNumQubits() != state.getNumQubits(),
+                    "Statevector and Hamiltonian have incompatible sizes.");
+        std::vector<std::complex<T>> out(state.getLength());
+        sparse_ham->apply(state.getData(), out.data(), state.getNumQubits());
+        state.updateData(out);
+        return;
+    }
+    for (size_t j = 0; j < observable.getSize(); j++) {
+        if (!observable.getObsParams().empty()) {
+            std::visit(
+                [&](const auto &param) {
+                    using p_t = std::decay_t<decltype(param)>;
+                    // Apply supported gate with given params
+                    if constexpr (std::is_same_v<p_t, std::vector<T>>) {
+                        state.applyOperation(observable.getObsName()[j],
+                                             observable.getObsWires()[j],
+                                             false, param);
+                    }
+                    // Apply provided matrix
+                    else if constexpr (std::is_same_v<
+                                           p_t, std::vector<std::complex<T>>>) {
+                        state.applyMatrix(param, observable.getObsWires()[j],
+                                          false);
+                    } else {
+                        state.applyOperation(observable.getObsName()[j],
+                                             observable.getObsWires()[j],
+                                             false);
+                    }
+                },
+                observable.getObsParams()[j]);
+        } else { // Offload to SV dispatcher if no parameters provided
+            state.applyOperation(observable.getObsName()[j],
+                                 observable.getObsWires()[j], false);
+        }
+    }
+}
+
+/**
+ * @brief Tensor product observable fused into a Pauli word, given by its
+ * bit masks, and a single dense matrix acting on the remaining wires.
+ */
+template <class T> struct FusedObservable {
+    /// Maximum number of wires of the combined dense matrix
+    static constexpr size_t max_matrix_wires = 4;
+
+    MeasuresKernels::PauliWordMasks masks;
+    std::vector<std::complex<T>> matrix{std::complex<T>{1.0, 0.0}};
+    std::vector<size_t> matrix_wires;
+};
+
+/**
+ * @brief Fuse the factors of a tensor product observable.
+ *
+ * Pauli factors are folded into bit masks, and Hadamard and Hermitian
+ * factors are combined by their Kronecker product.
+ *
+ * @param observable Observable to fuse.
+ * @param num_qubits Number of qubits.
+ * @return The fused observable, or std::nullopt if a factor is not supported,
+ * factors share a wire, or the dense factors act on more than
+ * FusedObservable::max_matrix_wires wires.
+ */
+template <class T>
+auto fuseObservable(const ObsDatum<T> &observable, size_t num_qubits)
+    -> std::optional<FusedObservable<T>> {
+    using ComplexT = std::complex<T>;
+    FusedObservable<T> fused;
+    size_t used_wires = 0;
+    for (size_t j = 0; j < observable.getSize(); j++) {
+        const auto &name = observable.getObsName()[j];
+        const auto &wires = observable.getObsWires()[j];
+        std::vector<ComplexT> factor;
+        if (!observable.getObsParams().empty()) {
+            const auto &param = observable.getObsParams()[j];
+            if (const auto *matrix =
+                    std::get_if<std::vector<ComplexT>>(&param);
+                matrix != nullptr) {
+                factor = *matrix;
+            } else if (const auto *params = std::get_if<std::vector<T>>(&param);
+                       params != nullptr && !params->empty()) {
+                return std::nullopt;
+            }
+        }
+        for (const size_t wire : wires) {
+            if (wire >= num_qubits ||
+                (used_wires & (size_t{1U} << wire)) != 0) {
+                return std::nullopt;
+            }
+            used_wires |= size_t{1U} << wire;
+        }
+
+        if (factor.empty()) {
+            if (name == "Identity") {
+                continue;
+            }
+            if (wires.size() != 1) {
+                return std::nullopt;
+            }
+            if (name == "PauliX" || name == "PauliY" || name == "PauliZ") {
+                const auto masks = MeasuresKernels::getPauliWordMasks(
+                    name.substr(5, 1), wires, num_qubits);
+                fused.masks.x_mask |= masks.x_mask;
+                fused.masks.z_mask |= masks.z_mask;
+                fused.masks.num_y += masks.num_y;
+                continue;
+            }
+            if (name != "Hadamard") {
+                return std::nullopt;
+            }
+            factor = Gates::getHadamard<T>();
+        }
+
+        const size_t dim = Util::exp2(wires.size());
+        if (factor.size() != dim * dim ||
+            fused.matrix_wires.size() + wires.size() >
+                FusedObservable<T>::max_matrix_wires) {
+            return std::nullopt;
+        }
+        const size_t prev_dim = Util::exp2(fused.matrix_wires.size());
+        const size_t new_dim = prev_dim * dim;
+        std::vector<ComplexT> kron(new_dim * new_dim);
+        for (size_t r1 = 0; r1 < prev_dim; r1++) {
+            for (size_t c1 = 0; c1 < prev_dim; c1++) {
+                const ComplexT lhs = fused.matrix[r1 * prev_dim + c1];
+                for (size_t r2 = 0; r2 < dim; r2++) {
+                    for (size_t c2 = 0; c2 < dim; c2++) {
+                        kron[(r1 * dim + r2) * new_dim + c1 * dim + c2] =
+                            lhs * factor[r2 * dim + c2];
+                    }
+                }
+            }
+        }
+        fused.matrix = std::move(kron);
+        fused.matrix_wires.insert(fused.matrix_wires.end(), wires.begin(),
+                                  wires.end());
+    }
+    return fused;
+}
+
+/**
+ * @brief Compute @f$O|\psi\rangle@f$ for a fused observable in a single
+ * pass.
+ *
+ * @param arr Pointer to the statevector @f$|\psi\rangle@f$.
+ * @param out Pointer to the output. Must not alias arr.
+ * @param num_qubits Number of qubits.
+ * @param fused Fused observable.
+ */
+template <class T>
+void applyFusedObservable(const std::complex<T> *arr, std::complex<T> *out,
+                          size_t num_qubits, const FusedObservable<T> &fused) {
+    using ComplexT = std::complex<T>;
+    constexpr std::array<ComplexT, 4> i_pow{
+        ComplexT{1.0, 0.0}, ComplexT{0.0, 1.0}, ComplexT{-1.0, 0.0},
+        ComplexT{0.0, -1.0}};
+    const size_t x_mask = fused.masks.x_mask;
+    const size_t z_mask = fused.masks.z_mask;
+    const ComplexT phase = i_pow[fused.masks.num_y % 4];
+    const auto &matrix = fused.matrix;
+    const size_t num_wires = fused.matrix_wires.size();
+    const size_t dim = Util::exp2(num_wires);
+
+    // Offsets of the statevector index for each row of the matrix, and bit
+    // positions of its wires in ascending order
+    std::vector<size_t> rev_wires(num_wires);
+    std::vector<size_t> offsets(dim, 0);
+    for (size_t k = 0; k < num_wires; k++) {
+        rev_wires[k] = num_qubits - 1 - fused.matrix_wires[k];
+    }
+    for (size_t inner = 0; inner < dim; inner++) {
+        for (size_t k = 0; k < num_wires; k++) {
+            if (((inner >> (num_wires - 1 - k)) & 1U) != 0) {
+                offsets[inner] |= size_t{1U} << rev_wires[k];
+            }
+        }
+    }
+    std::sort(rev_wires.begin(), rev_wires.end());
+
+    // The Pauli word acts on other wires than the matrix, so each output
+    // index is written by exactly one row of one outer index.
+    const size_t num_outer = Util::exp2(num_qubits - num_wires);
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static)
+    #endif
+    // clang-format on
+    for (size_t outer = 0; outer < num_outer; outer++) {
+        size_t base = outer;
+        for (const size_t rev_wire : rev_wires) {
+            base = ((base >> rev_wire) << (rev_wire + 1)) |
+                   (base & Util::fillTrailingOnes(rev_wire));
+        }
+        for (size_t row = 0; row < dim; row++) {
+            ComplexT row_sum{0.0, 0.0};
+            for (size_t col = 0; col < dim; col++) {
+                row_sum += matrix[row * dim + col] * arr[base + offsets[col]];
+            }
+            const size_t idx = base + offsets[row];
+            out[idx ^ x_mask] =
+                ((std::popcount(idx & z_mask) & 1U) == 0 ? phase : -phase) *
+                row_sum;
+        }
+    }
+}
+
+/**
+ * @brief Apply the observable to a statevector, writing the result to
+ * another statevector of the same size.
+ *
+ * Tensor products of Pauli, Hadamard and small Hermitian factors are applied
+ * in a single pass (see fuseObservable()), as are Hamiltonians. Other
+ * observables are applied factor by factor to a copy of the statevector.
+ *
+ * @param state Statevector to which the observable is applied.
+ * @param out Statevector receiving the result.
+ * @param observable Observable to apply.
+ */
+template <class T>
+void applyObservable(const StateVectorManagedCPU<T> &state,
+                     StateVectorManagedCPU<T> &out,
+                     const ObsDatum<T> &observable) {
+    PL_ABORT_IF(state.getLength() != out.getLength(),
+                "Statevectors have incompatible sizes.");
+    const size_t num_qubits = state.getNumQubits();
+    if (const auto &pauli_sum = observable.getPauliSum(); pauli_sum) {
+        out.canonicalizeWires();
+        pauli_sum->apply(state.getData(), out.getData(), num_qubits);
+        return;
+    }
+    if (const auto &sparse_ham = observable.getSparseHamiltonian();
+        sparse_ham) {
+        PL_ABORT_IF(sparse_ham->getNumQubits() != num_qubits,
+                    "Statevector and Hamiltonian have incompatible sizes.");
+        out.canonicalizeWires();
+        sparse_ham->apply(state.getData(), out.getData(), num_qubits);
+        return;
+    }
+    if (const auto fused = fuseObservable(observable, num_qubits); fused) {
+        out.canonicalizeWires();
+        applyFusedObservable(state.getData(), out.getData(), num_qubits,
+                             *fused);
+        return;
+    }
+    out.updateData(state.getDataVector());
+    applyObservable(out, observable);
+}
+
 /**
  * @brief Utility class for encapsulating operations used by AdjointJacobian
  * class.
@@ -100,11 +445,28 @@ template <class T> class OpsData {
   private:
     size_t num_par_ops_;
     size_t num_nonpar_ops_;
+    size_t num_params_;
     const std::vector<std::string> ops_name_;
     const std::vector<std::vector<T>> ops_params_;
     const std::vector<std::vector<size_t>> ops_wires_;
     const std::vector<bool> ops_inverses_;
     const std::vector<std::vector<std::complex<T>>> ops_matrices_;
+    const std::vector<std::vector<std::complex<T>>> ops_generators_;
+    const std::vector<std::vector<T>> ops_diagonals_;
+    const std::vector<std::string> ops_pauli_words_;
+
+    /**
+     * @brief Get the given data of each operation, or empty data for each
+     * operation if none is given.
+     */
+    template <class U>
+    static auto perOp(std::vector<U> &&data, size_t num_ops)
+        -> std::vector<U> {
+        if (data.empty()) {
+            data.resize(num_ops);
+        }
+        return std::move(data);
+    }
 
   public:
     /**
@@ -124,15 +486,57 @@ template <class T> class OpsData {
             std::vector<std::vector<size_t>> ops_wires,
             std::vector<bool> ops_inverses,
             std::vector<std::vector<std::complex<T>>> ops_matrices)
+        : OpsData(std::move(ops_name), ops_params, std::move(ops_wires),
+                  std::move(ops_inverses), std::move(ops_matrices),
+                  std::vector<std::vector<std::complex<T>>>(
+                      ops_params.size())) {}
+
+    /**
+     * @brief Construct an OpsData object with generators of matrix
+     * operations.
+     *
+     * A matrix operation @f$U(\theta) = e^{i \theta G}@f$ with a single
+     * parameter @f$\theta@f$ is given by its matrix at the parameter value and
+     * the matrix of its generator @f$G@f$, so that it can be differentiated.
+     * Both are in row-major order.
+     *
+     * @param ops_name Name of each operation to apply.
+     * @param ops_params Parameters for a given operation ({} if optional).
+     * @param ops_wires Wires upon which to apply operation
+     * @param ops_inverses Value to represent whether given operation is
+     * adjoint.
+     * @param ops_matrices Numerical representation of given matrix if not
+     * supported.
+     * @param ops_generators Generator of given matrix operation ({} if not
+     * trainable).
+     * @param ops_diagonals Diagonal of the cost operator of given cost layer
+     * ({} if not a cost layer). Omitted if there is no cost layer.
+     * @param ops_pauli_words Pauli word of given Pauli rotation ("" if not a
+     * Pauli rotation). Omitted if there is no Pauli rotation.
+     */
+    OpsData(std::vector<std::string> ops_name,
+            const std::vector<std::vector<T>> &ops_params,
+            std::vector<std::vector<size_t>> ops_wires,
+            std::vector<bool> ops_inverses,
+            std::vector<std::vector<std::complex<T>>> ops_matrices,
+            std::vector<std::vector<std::complex<T>>> ops_generators,
+            std::vector<std::vector<T>> ops_diagonals = {},
+            std::vector<std::string> ops_pauli_words = {})
         : ops_name_{std::move(ops_name)}, ops_params_{ops_params},
           ops_wires_{std::move(ops_wires)},
-          ops_inverses_{std::move(ops_inverses)}, ops_matrices_{
-                                                      std::move(ops_matrices)} {
+          ops_inverses_{std::move(ops_inverses)},
+          ops_matrices_{std::move(ops_matrices)},
+          ops_generators_{std::move(ops_generators)},
+          ops_diagonals_{perOp(std::move(ops_diagonals), ops_name_.size())},
+          ops_pauli_words_{
+              perOp(std::move(ops_pauli_words), ops_name_.size())} {
         num_par_ops_ = 0;
+        num_params_ = 0;
         for (const auto &p : ops_params) {
             if (!p.empty()) {
                 num_par_ops_++;
             }
+            num_params_ += p.size();
         }
         num_nonpar_ops_ = ops_params.size() - num_par_ops_;
     };
@@ -154,12 +558,15 @@ template <class T> class OpsData {
         : ops_name_{ops_name}, ops_params_{ops_params},
           ops_wires_{std::move(ops_wires)}, ops_inverses_{std::move(
                                                 ops_inverses)},
-          ops_matrices_(ops_name.size()) {
+          ops_matrices_(ops_name.size()), ops_generators_(ops_name.size()),
+          ops_diagonals_(ops_name.size()), ops_pauli_words_(ops_name.size()) {
         num_par_ops_ = 0;
+        num_params_ = 0;
         for (const auto &p : ops_params) {
             if (p.size() > 0) {
                 num_par_ops_++;
             }
+            num_params_ += p.size();
         }
         num_nonpar_ops_ = ops_params.size() - num_par_ops_;
     };
@@ -217,6 +624,39 @@ template <class T> class OpsData {
         return ops_matrices_;
     }
 
+    /**
+     * @brief Get the generator matrix of each matrix operation. Given
+     * entries are empty ({}) if not required.
+     *
+     * @return const std::vector<std::vector<std::complex<T>>>&
+     */
+    [[nodiscard]] auto getOpsGenerators() const
+        -> const std::vector<std::vector<std::complex<T>>> & {
+        return ops_generators_;
+    }
+
+    /**
+     * @brief Get the diagonal of the cost operator of each cost layer. Given
+     * entries are empty ({}) if not required.
+     *
+     * @return const std::vector<std::vector<T>>&
+     */
+    [[nodiscard]] auto getOpsDiagonals() const
+        -> const std::vector<std::vector<T>> & {
+        return ops_diagonals_;
+    }
+
+    /**
+     * @brief Get the Pauli word of each Pauli rotation. Given entries are
+     * empty ("") if not required.
+     *
+     * @return const std::vector<std::string>&
+     */
+    [[nodiscard]] auto getOpsPauliWords() const
+        -> const std::vector<std::string> & {
+        return ops_pauli_words_;
+    }
+
     /**
      * @brief Notify if the operation at a given index is parametric.
      *
@@ -243,6 +683,254 @@ template <class T> class OpsData {
     [[nodiscard]] auto getNumNonParOps() const -> size_t {
         return num_nonpar_ops_;
     }
+
+    /**
+     * @brief Get the total number of parameters of all operations.
+     *
+     * @return size_t
+     */
+    [[nodiscard]] auto getNumParams() const -> size_t { return num_params_; }
+};
+
+/**
+ * @brief Operations of an OpsData object with gate names resolved to
+ * kernel functions.
+ *
+ * Names are resolved once on construction for the kernels of a given
+ * statevector, so applying an operation calls its kernel function without
+ * looking up the name and the kernel. Operations which are not gates are
+ * applied by name, or by their matrix if they are not gates. A cost layer,
+ * named Gates::cost_layer_name, applies
+ * @f$e^{-i\gamma C}@f$ where the diagonal of @f$C@f$ is given by
+ * OpsData::getOpsDiagonals(). A Pauli rotation, named Gates::pauli_rot_name,
+ * applies @f$e^{-i\theta P/2}@f$ where the Pauli word @f$P@f$ is given
+ * by OpsData::getOpsPauliWords(). Generators which are controlled Pauli
+ * strings are also resolved, so that their overlaps need not apply them to
+ * a copy of a statevector. The OpsData object must outlive this object.
+ *
+ * @tparam T Floating point precision.
+ */
+template <class T> class CompiledOps {
+  public:
+    using GateFunc = typename DynamicDispatcher<T>::GateFunc;
+
+  private:
+    const OpsData<T> *ops_;
+    std::vector<GateFunc> funcs_;   // nullptr if not a gate
+    std::vector<Gates::GateOperation> gate_ops_; // valid if funcs_ is set
+    std::vector<Gates::KernelType> kernels_;     // valid if funcs_ is set
+    std::vector<std::vector<T>> costs_; // empty if not a cost layer
+    std::vector<std::string> words_;    // empty if not a Pauli rotation
+    // std::nullopt if the generator is not a controlled Pauli string
+    std::vector<std::optional<Gates::PauliGeneratorTerm<T>>> generators_;
+
+  public:
+    /**
+     * @brief Construct a CompiledOps object.
+     *
+     * @param ops Operations.
+     * @param sv Statevector whose kernels are used. The operations can be
+     * applied to any statevector with the same number of qubits, threading,
+     * and memory model.
+     */
+    template <class Derived>
+    CompiledOps(const OpsData<T> &ops, const StateVectorCPU<T, Derived> &sv)
+        : ops_{&ops} {
+        const auto &dispatcher = DynamicDispatcher<T>::getInstance();
+        funcs_.reserve(ops.getSize());
+        costs_.resize(ops.getSize());
+        words_.resize(ops.getSize());
+        generators_.resize(ops.getSize());
+        gate_ops_.resize(ops.getSize());
+        kernels_.resize(ops.getSize());
+        for (size_t op_idx = 0; op_idx < ops.getSize(); op_idx++) {
+            const auto &op_name = ops.getOpsName()[op_idx];
+            GateFunc func = nullptr;
+            if (dispatcher.hasGateOp(op_name)) {
+                const auto gate_op = dispatcher.strToGateOp(op_name);
+                const auto kernel = sv.getKernelForGate(gate_op);
+                if (dispatcher.isRegistered(gate_op, kernel)) {
+                    func = dispatcher.getGateFunc(gate_op, kernel);
+                    gate_ops_[op_idx] = gate_op;
+                    kernels_[op_idx] = kernel;
+                }
+                if (dispatcher.hasGeneratorOp(op_name)) {
+                    generators_[op_idx] = Gates::pauliGeneratorTerm<T>(
+                        dispatcher.strToGeneratorOp(op_name),
+                        sv.getNumQubits(), ops.getOpsWires()[op_idx]);
+                }
+            } else if (op_name == Gates::cost_layer_name) {
+                const auto &diagonal = ops.getOpsDiagonals()[op_idx];
+                PL_ABORT_IF(diagonal.size() !=
+                                Util::exp2(ops.getOpsWires()[op_idx].size()),
+                            "The cost layer requires the diagonal of the "
+                            "cost operator.");
+                PL_ABORT_IF(ops.getOpsParams()[op_idx].size() != 1,
+                            "The cost layer requires a single parameter.");
+                costs_[op_idx] = diagonal;
+            } else if (op_name == Gates::pauli_rot_name) {
+                const auto &wires = ops.getOpsWires()[op_idx];
+                PL_ABORT_IF(wires.empty(),
+                            "The Pauli rotation requires at least one wire.");
+                PL_ABORT_IF(ops.getOpsParams()[op_idx].size() != 1,
+                            "The Pauli rotation requires a single "
+                            "parameter.");
+                words_[op_idx] = ops.getOpsPauliWords()[op_idx];
+                const auto masks = Gates::pauliWordMasks(
+                    sv.getNumQubits(), wires, words_[op_idx]);
+                generators_[op_idx] = Gates::PauliGeneratorTerm<T>{
+                    masks.x_mask, masks.z_mask, 0, masks.num_y,
+                    -static_cast<T>(0.5)};
+            } else {
+                const size_t dim = Util::exp2(ops.getOpsWires()[op_idx].size());
+                const auto &matrix = ops.getOpsMatrices()[op_idx];
+                const auto &generator = ops.getOpsGenerators()[op_idx];
+                PL_ABORT_IF(!matrix.empty() && matrix.size() != dim * dim,
+                            "The matrix of the operation has an invalid "
+                            "size.");
+                PL_ABORT_IF(!generator.empty() &&
+                                (generator.size() != dim * dim ||
+                                 matrix.empty() ||
+                                 ops.getOpsParams()[op_idx].size() != 1),
+                            "A generator requires a matrix operation with a "
+                            "single parameter and a square matrix of the same "
+                            "size.");
+            }
+            funcs_.emplace_back(func);
+        }
+    }
+
+    /**
+     * @brief Get the operations.
+     */
+    [[nodiscard]] auto getOps() const -> const OpsData<T> & { return *ops_; }
+
+    /**
+     * @brief Apply the indexed operation to the statevector.
+     *
+     * @param sv Statevector to be updated.
+     * @param op_idx Operation index.
+     * @param adj Take the adjoint of the operation.
+     */
+    template <class Derived>
+    void apply(StateVectorCPU<T, Derived> &sv, size_t op_idx,
+               bool adj = false) const {
+        const bool inverse = ops_->getOpsInverses()[op_idx] ^ adj;
+        const GateFunc func = funcs_[op_idx];
+        if (!costs_[op_idx].empty()) {
+            sv.applyCostLayer(costs_[op_idx].data(),
+                              ops_->getOpsWires()[op_idx],
+                              ops_->getOpsParams()[op_idx][0], inverse);
+            return;
+        }
+        if (!words_[op_idx].empty()) {
+            sv.applyPauliRot(ops_->getOpsWires()[op_idx], inverse,
+                             ops_->getOpsParams()[op_idx][0], words_[op_idx]);
+            return;
+        }
+        if (func == nullptr) {
+            const auto &matrix = ops_->getOpsMatrices()[op_idx];
+            if (!matrix.empty()) {
+                sv.applyMatrix(matrix, ops_->getOpsWires()[op_idx], inverse);
+                return;
+            }
+            sv.applyOperation(ops_->getOpsName()[op_idx],
+                              ops_->getOpsWires()[op_idx], inverse,
+                              ops_->getOpsParams()[op_idx]);
+            return;
+        }
+        func(sv.getData(), sv.getNumQubits(), ops_->getOpsWires()[op_idx],
+             inverse, ops_->getOpsParams()[op_idx]);
+    }
+
+    /**
+     * @brief Check whether the indexed operation is a gate applied by its
+     * kernel function.
+     */
+    [[nodiscard]] auto isGate(size_t op_idx) const -> bool {
+        return funcs_[op_idx] != nullptr;
+    }
+
+    /**
+     * @brief Apply the indexed operation to a batch of statevectors.
+     *
+     * Gates are applied to all statevectors by a single call of
+     * DynamicDispatcher::applyOperationBatch, other operations to each
+     * statevector in turn.
+     *
+     * @param states Statevectors to be updated.
+     * @param op_idx Operation index.
+     * @param adj Take the adjoint of the operation.
+     * @param num_threads Number of threads distributing the statevectors of
+     * gates.
+     */
+    template <class Derived>
+    void applyBatch(std::vector<Derived> &states, size_t op_idx, bool adj,
+                    size_t num_threads) const {
+        if (states.empty()) {
+            return;
+        }
+        if (funcs_[op_idx] == nullptr) {
+            for (auto &sv : states) {
+                apply(sv, op_idx, adj);
+            }
+            return;
+        }
+        std::vector<std::complex<T> *> data;
+        data.reserve(states.size());
+        for (auto &sv : states) {
+            data.emplace_back(sv.getData());
+        }
+        DynamicDispatcher<T>::getInstance().applyOperationBatch(
+            kernels_[op_idx], data.data(), data.size(),
+            states[0].getNumQubits(), gate_ops_[op_idx],
+            ops_->getOpsWires()[op_idx], ops_->getOpsInverses()[op_idx] ^ adj,
+            ops_->getOpsParams()[op_idx], num_threads);
+    }
+
+    /**
+     * @brief Apply the generator of the indexed operation to the
+     * statevector.
+     *
+     * @param sv Statevector to be updated.
+     * @param op_idx Operation index.
+     * @param adj Indicate whether to take the adjoint of the generator.
+     * @return T Generator scaling coefficient.
+     */
+    template <class Derived>
+    auto applyGenerator(StateVectorCPU<T, Derived> &sv, size_t op_idx,
+                        bool adj) const -> T {
+        if (!costs_[op_idx].empty()) {
+            return sv.applyCostGenerator(costs_[op_idx].data(),
+                                         ops_->getOpsWires()[op_idx]);
+        }
+        if (!words_[op_idx].empty()) {
+            // Hermitian, so the adjoint is the generator itself
+            return sv.applyPauliRotGenerator(ops_->getOpsWires()[op_idx],
+                                             words_[op_idx]);
+        }
+        const auto &generator = ops_->getOpsGenerators()[op_idx];
+        if (!generator.empty()) {
+            // Hermitian, so the adjoint is the generator itself
+            sv.applyMatrix(generator, ops_->getOpsWires()[op_idx], false);
+            return 1;
+        }
+        return sv.applyGenerator(ops_->getOpsName()[op_idx],
+                                 ops_->getOpsWires()[op_idx], adj);
+    }
+
+    /**
+     * @brief Get the generator of the indexed operation as a controlled
+     * Pauli string.
+     *
+     * @param op_idx Operation index.
+     * @return The term, or std::nullopt if the generator is not a
+     * controlled Pauli string.
+     */
+    [[nodiscard]] auto pauliGenerator(size_t op_idx) const
+        -> const std::optional<Gates::PauliGeneratorTerm<T>> & {
+        return generators_[op_idx];
+    }
 };
 
 /**
@@ -264,6 +952,8 @@ template <class T> class JacobianData {
     const std::vector<ObsDatum<T>> observables;
     const OpsData<T> operations;
     const std::vector<size_t> trainableParams;
+    // Working state of the adjoint method, either caller-owned or moved in
+    std::shared_ptr<StateVectorManagedCPU<T>> state;
 
   public:
     /**
@@ -284,6 +974,50 @@ template <class T> class JacobianData {
           observables(std::move(obs)), operations(std::move(ops)),
           trainableParams(std::move(trainP)) {}
 
+    /**
+     * @brief Construct a JacobianData object using a caller-owned
+     * statevector as the working state of the adjoint method.
+     *
+     * The adjoint method then operates on `sv` directly instead of a copy of
+     * its data, so e.g. the state after a forward execution of the tape can
+     * be differentiated without copying it or executing the tape again. The
+     * statevector is overwritten by the adjoint method and must outlive this
+     * object.
+     *
+     * @param num_params Number of parameters in the Tape.
+     * @param sv Statevector. Operations are applied to it first if
+     * requested by the adjoint method.
+     * @param obs Observables for which to calculate Jacobian.
+     * @param ops Operations used to create given state.
+     * @param trainP List of parameters participating in Jacobian
+     * calculation. This must be sorted.
+     */
+    JacobianData(size_t num_params, StateVectorManagedCPU<T> &sv,
+                 std::vector<ObsDatum<T>> obs, OpsData<T> ops,
+                 std::vector<size_t> trainP)
+        : num_parameters(num_params), num_elements(sv.getLength()),
+          psi(sv.getData()), observables(std::move(obs)),
+          operations(std::move(ops)), trainableParams(std::move(trainP)),
+          state(std::shared_ptr<StateVectorManagedCPU<T>>{}, &sv) {}
+
+    /**
+     * @brief Construct a JacobianData object owning the working state of the
+     * adjoint method.
+     *
+     * @see JacobianData(size_t num_params, StateVectorManagedCPU<T> &sv,
+     * std::vector<ObsDatum<T>> obs, OpsData<T> ops,
+     * std::vector<size_t> trainP)
+     */
+    JacobianData(size_t num_params, StateVectorManagedCPU<T> &&sv,
+                 std::vector<ObsDatum<T>> obs, OpsData<T> ops,
+                 std::vector<size_t> trainP)
+        : num_parameters(num_params), num_elements(sv.getLength()),
+          psi(nullptr), observables(std::move(obs)),
+          operations(std::move(ops)), trainableParams(std::move(trainP)),
+          state(std::make_shared<StateVectorManagedCPU<T>>(std::move(sv))) {
+        psi = state->getData();
+    }
+
     /**
      * @brief Get Number of parameters in the Tape.
      *
@@ -309,6 +1043,16 @@ template <class T> class JacobianData {
         return psi;
     }
 
+    /**
+     * @brief Get the statevector used as the working state of the adjoint
+     * method, or nullptr if the adjoint method works on a copy of the data.
+     *
+     * @return StateVectorManagedCPU<T> *
+     */
+    [[nodiscard]] auto getStateVec() const -> StateVectorManagedCPU<T> * {
+        return state.get();
+    }
+
     /**
      * @brief Get observables for which to calculate Jacobian.
      *
@@ -0,0 +1,358 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines the parameter-shift Jacobian of serialized tapes.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <exception>
+#include <string>
+#include <vector>
+
+#include "CPUMemoryModel.hpp"
+#include "Error.hpp"
+#include "JacobianTape.hpp"
+#include "LinearAlgebra.hpp"
+#include "Memory.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "Threading.hpp"
+#include "Trace.hpp"
+#include "Util.hpp"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace Pennylane::Algorithms {
+/**
+ * @brief Compute the Jacobian of a tape with the parameter-shift rule.
+ *
+ * A shifted execution of the tape only differs from the unshifted one from
+ * the shifted operation on. The operations before it are thus applied once
+ * to a shared state, which is forked at every trainable operation into
+ * statevectors taken from a pool. Forks apply the shifted operation and the
+ * remaining operations using single-threaded kernels, and are executed
+ * concurrently whenever the pool is full.
+ *
+ * @tparam T Floating-point precision.
+ */
+template <class T = double> class ParameterShift {
+  private:
+    /**
+     * @brief Term @f$c [f(\theta + s) - f(\theta - s)]@f$ of a shift rule.
+     */
+    struct ShiftTerm {
+        T coeff;
+        T shift;
+    };
+
+    /**
+     * @brief Shifted execution forked from the shared state.
+     */
+    struct Fork {
+        size_t op_idx;    /**< Shifted operation */
+        size_t param_idx; /**< Shifted parameter of the operation */
+        size_t tp_idx;    /**< Column of the Jacobian */
+        T coeff;          /**< Coefficient of the expectation values */
+        T shift;          /**< Shift of the parameter */
+    };
+
+    size_t max_num_forks_{0};
+    Util::BufferPool *buffer_pool_{&Util::BufferPool::global()};
+
+    /**
+     * @brief Get the number of available threads.
+     */
+    static auto getMaxNumThreads() -> size_t {
+#if defined(_OPENMP)
+        return static_cast<size_t>(omp_get_max_threads());
+#else
+        return 1;
+#endif
+    }
+
+    /**
+     * @brief Create a statevector, whose data is taken from and returned to
+     * the buffer pool.
+     */
+    auto makeState(size_t num_qubits, Threading threading) const
+        -> StateVectorManagedCPU<T> {
+        return {num_qubits, threading, bestCPUMemoryModel(),
+                bestNUMAPolicy(threading), Util::HugePagePolicy::Disabled,
+                buffer_pool_};
+    }
+
+    /**
+     * @brief Get the shift rule of a parameter of the operation.
+     *
+     * Operations @f$e^{-i \theta G}@f$ whose generator has eigenvalues
+     * differing by 1 use the two-term rule
+     * @f$f'(\theta) = \frac{1}{2}[f(\theta + \frac{\pi}{2}) -
+     * f(\theta - \frac{\pi}{2})]@f$. Controlled rotations and excitations,
+     * whose generators also have eigenvalue differences of 1/2, use the
+     * four-term rule of arXiv:2104.05695.
+     *
+     * @param op_name Name of the operation.
+     * @return The terms @f$(c, s)@f$ of the rule, or an empty vector if the
+     * operation is not supported.
+     */
+    static auto shiftRule(const std::string &op_name)
+        -> std::vector<ShiftTerm> {
+        constexpr auto half_pi = static_cast<T>(M_PI / 2);
+        static const std::vector<std::string> two_term{
+            "RX",      "RY",      "RZ",      "Rot",
+            "PhaseShift",         "ControlledPhaseShift",
+            "IsingXX", "IsingYY", "IsingZZ", "MultiRZ",
+            "SingleExcitationMinus", "SingleExcitationPlus",
+            "DoubleExcitationMinus", "DoubleExcitationPlus"};
+        static const std::vector<std::string> four_term{
+            "CRX", "CRY", "CRZ", "CRot", "IsingXY", "SingleExcitation",
+            "DoubleExcitation"};
+        if (std::find(two_term.begin(), two_term.end(), op_name) !=
+            two_term.end()) {
+            return {ShiftTerm{static_cast<T>(0.5), half_pi}};
+        }
+        if (std::find(four_term.begin(), four_term.end(), op_name) !=
+            four_term.end()) {
+            const T sqrt2 = std::sqrt(static_cast<T>(2));
+            return {ShiftTerm{(sqrt2 + 1) / (4 * sqrt2), half_pi},
+                    ShiftTerm{-(sqrt2 - 1) / (4 * sqrt2), 3 * half_pi}};
+        }
+        return {};
+    }
+
+    /**
+     * @brief Compute the expectation values of the observables.
+     *
+     * @param sv Statevector.
+     * @param observables Observables.
+     * @param results Pre-allocated array of one value per observable.
+     */
+    void expvals(const StateVectorManagedCPU<T> &sv,
+                 const std::vector<ObsDatum<T>> &observables,
+                 T *results) const {
+        for (size_t obs_idx = 0; obs_idx < observables.size(); obs_idx++) {
+            const auto &observable = observables[obs_idx];
+            if (const auto &pauli_sum = observable.getPauliSum(); pauli_sum) {
+                results[obs_idx] =
+                    pauli_sum->expval(sv.getData(), sv.getNumQubits());
+                continue;
+            }
+            StateVectorManagedCPU<T> work(sv, buffer_pool_);
+            applyObservable(sv, work, observable);
+            results[obs_idx] = std::real(
+                Util::innerProdC(sv.getData(), work.getData(), sv.getLength()));
+        }
+    }
+
+    /**
+     * @brief Execute the forks concurrently and accumulate their shifted
+     * expectation values into the Jacobian.
+     *
+     * @param jac Jacobian, in row-major order with one row per observable.
+     * @param forks Forks of the shared state.
+     * @param states Statevectors of the forks, holding the state before the
+     * shifted operation.
+     * @param operations Operations, compiled for the statevectors of the
+     * forks.
+     * @param observables Observables.
+     * @param num_params Number of trainable parameters.
+     */
+    void executeForks(std::vector<T> &jac, const std::vector<Fork> &forks,
+                      std::vector<StateVectorManagedCPU<T>> &states,
+                      const CompiledOps<T> &operations,
+                      const std::vector<ObsDatum<T>> &observables,
+                      size_t num_params) const {
+        PL_TRACE_SCOPE("forks", "parameter-shift");
+        const OpsData<T> &ops = operations.getOps();
+        const size_t num_forks = forks.size();
+        const size_t num_obs = observables.size();
+        std::vector<T> results(num_forks * num_obs);
+
+        // clang-format off
+        // Globally scoped exception value to be captured within OpenMP block.
+        // See the following for OpenMP design decisions:
+        // https://www.openmp.org/wp-content/uploads/openmp-examples-4.5.0.pdf
+        std::exception_ptr ex = nullptr;
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(dynamic) if(num_forks > 1) \
+                default(none) shared(forks, states, operations, observables, \
+                                     ops, num_forks, num_obs, results, ex)
+        #endif
+        for (size_t k = 0; k < num_forks; k++) {
+            try {
+                const Fork &fork = forks[k];
+                StateVectorManagedCPU<T> &sv = states[k];
+                std::vector<T> params = ops.getOpsParams()[fork.op_idx];
+                params[fork.param_idx] += fork.shift;
+                sv.applyOperation(ops.getOpsName()[fork.op_idx],
+                                  ops.getOpsWires()[fork.op_idx],
+                                  ops.getOpsInverses()[fork.op_idx], params);
+                for (size_t op_idx = fork.op_idx + 1; op_idx < ops.getSize();
+                     op_idx++) {
+                    operations.apply(sv, op_idx);
+                }
+                expvals(sv, observables, results.data() + k * num_obs);
+            } catch (...) {
+                #if defined(_OPENMP)
+                    #pragma omp critical
+                #endif
+                ex = std::current_exception();
+            }
+        }
+        if (ex) {
+            std::rethrow_exception(ex); //LCOV_EXCL_LINE
+        }
+        // clang-format on
+
+        for (size_t k = 0; k < num_forks; k++) {
+            for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+                jac[obs_idx * num_params + forks[k].tp_idx] +=
+                    forks[k].coeff * results[k * num_obs + obs_idx];
+            }
+        }
+    }
+
+  public:
+    ParameterShift() = default;
+
+    /**
+     * @brief Set the maximum number of forks stored at once.
+     *
+     * Each fork holds a statevector. Smaller values bound the memory, while
+     * values of at least the number of threads keep all threads busy.
+     *
+     * @param max_num_forks Maximum number of forks. 0 uses the number of
+     * available threads.
+     */
+    void setMaxNumForks(size_t max_num_forks) {
+        max_num_forks_ = max_num_forks;
+    }
+
+    /**
+     * @brief Get the maximum number of forks stored at once. 0 if it is the
+     * number of available threads.
+     */
+    [[nodiscard]] auto getMaxNumForks() const -> size_t {
+        return max_num_forks_;
+    }
+
+    /**
+     * @brief Set the pool of the statevectors.
+     *
+     * @param pool Buffer pool, or nullptr to allocate and free the data of
+     * each statevector.
+     */
+    void setBufferPool(Util::BufferPool *pool) { buffer_pool_ = pool; }
+
+    /**
+     * @brief Get the pool of the statevectors.
+     */
+    [[nodiscard]] auto getBufferPool() const -> Util::BufferPool * {
+        return buffer_pool_;
+    }
+
+    /**
+     * @brief Calculate the Jacobian of the expectation values of the
+     * observables with the parameter-shift rule.
+     *
+     * The operations are applied to the statevector of `jd`, which is left
+     * unchanged.
+     *
+     * @param jac Preallocated vector for Jacobian data results, in row-major
+     * order with one row per observable and one column per trainable
+     * parameter.
+     * @param jd JacobianData represents the QuantumTape to differentiate.
+     */
+    void parameterShift(std::vector<T> &jac, const JacobianData<T> &jd) {
+        PL_ABORT_IF(!jd.hasTrainableParams(),
+                    "No trainable parameters provided.");
+        const OpsData<T> &ops = jd.getOperations();
+        const auto &observables = jd.getObservables();
+        const auto &trainable = jd.getTrainableParams();
+        const size_t num_params = trainable.size();
+        PL_ABORT_IF_NOT(jac.size() == observables.size() * num_params,
+                        "The preallocated Jacobian must have one entry per "
+                        "observable and trainable parameter.");
+        std::fill(jac.begin(), jac.end(), T{0});
+
+        const size_t num_qubits = Util::log2(jd.getSizeStateVec());
+        const size_t max_num_forks =
+            (max_num_forks_ == 0) ? getMaxNumThreads() : max_num_forks_;
+
+        auto shared = makeState(num_qubits, Threading::MultiThread);
+        std::copy(jd.getPtrStateVec(),
+                  jd.getPtrStateVec() + jd.getSizeStateVec(),
+                  shared.getData());
+        // Statevectors of the forks, created as needed
+        std::vector<StateVectorManagedCPU<T>> states;
+        states.reserve(max_num_forks);
+        states.emplace_back(makeState(num_qubits, Threading::SingleThread));
+        const CompiledOps<T> shared_ops(ops, shared);
+        const CompiledOps<T> fork_ops(ops, states[0]);
+
+        std::vector<Fork> forks;
+        forks.reserve(max_num_forks);
+        auto tp_it = trainable.begin();
+        size_t param_offset = 0;
+        for (size_t op_idx = 0;
+             op_idx < ops.getSize() && tp_it != trainable.end(); op_idx++) {
+            const size_t num_op_params = ops.getOpsParams()[op_idx].size();
+            for (size_t param_idx = 0;
+                 param_idx < num_op_params && tp_it != trainable.end();
+                 param_idx++) {
+                if (*tp_it != param_offset + param_idx) {
+                    continue;
+                }
+                const auto terms = shiftRule(ops.getOpsName()[op_idx]);
+                PL_ABORT_IF(terms.empty(),
+                            "The operation " + ops.getOpsName()[op_idx] +
+                                " is not supported by the parameter-shift "
+                                "method.");
+                const auto tp_idx =
+                    static_cast<size_t>(tp_it - trainable.begin());
+                for (const auto &term : terms) {
+                    for (const T sign : {T{1}, T{-1}}) {
+                        if (forks.size() == max_num_forks) {
+                            executeForks(jac, forks, states, fork_ops,
+                                         observables, num_params);
+                            forks.clear();
+                        }
+                        if (forks.size() == states.size()) {
+                            states.emplace_back(makeState(
+                                num_qubits, Threading::SingleThread));
+                        }
+                        std::copy(shared.getData(),
+                                  shared.getData() + shared.getLength(),
+                                  states[forks.size()].getData());
+                        forks.push_back({op_idx, param_idx, tp_idx,
+                                         sign * term.coeff,
+                                         sign * term.shift});
+                    }
+                }
+                ++tp_it;
+            }
+            param_offset += num_op_params;
+            shared_ops.apply(shared, op_idx);
+        }
+        PL_ABORT_IF(tp_it != trainable.end(),
+                    "Invalid index of a trainable parameter.");
+        executeForks(jac, forks, states, fork_ops, observables, num_params);
+    }
+};
+} // namespace Pennylane::Algorithms
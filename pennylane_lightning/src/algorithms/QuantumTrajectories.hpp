@@ -0,0 +1,493 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines the simulation of noisy circuits by quantum trajectories.
+ */
+#pragma once
+
+#include "Error.hpp"
+#include "KernelMap.hpp"
+#include "MeasuresKernels.hpp"
+#include "PauliSum.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <exception>
+#include <random>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace Pennylane::Algorithms {
+/**
+ * @brief A quantum channel given by its Kraus operators
+ * @f$\{K_i\}@f$ with @f$\sum_i K_i^\dagger K_i = I@f$.
+ *
+ * In a trajectory, the channel applies @f$K_i/\sqrt{p_i}@f$ with probability
+ * @f$p_i = \langle\psi|K_i^\dagger K_i|\psi\rangle@f$. The products
+ * @f$K_i^\dagger K_i@f$ are precomputed, so that all branch probabilities
+ * are obtained in a single read-only pass over the statevector without
+ * applying any operator to a copy of it. For a mixture of unitaries, where
+ * each product is a multiple @f$p_i I@f$ of the identity, the probabilities
+ * do not depend on the state and no pass is needed at all.
+ *
+ * @tparam T Floating point precision.
+ */
+template <class T> class KrausChannel {
+  public:
+    using ComplexT = std::complex<T>;
+
+  private:
+    std::vector<size_t> wires_;
+    std::vector<std::vector<ComplexT>> kraus_ops_;
+    // K_i^\dagger K_i of all operators but the last, stored one after another
+    std::vector<ComplexT> products_;
+    // Branch probabilities if the channel is a mixture of unitaries
+    std::vector<T> fixed_probs_;
+
+  public:
+    /**
+     * @brief Construct a channel.
+     *
+     * @param kraus_ops Kraus operators in row-major order.
+     * @param wires Wires the channel acts on. wires[0] corresponds to the
+     * most significant bit of the matrix index.
+     */
+    KrausChannel(std::vector<std::vector<ComplexT>> kraus_ops,
+                 std::vector<size_t> wires)
+        : wires_{std::move(wires)}, kraus_ops_{std::move(kraus_ops)} {
+        PL_ABORT_IF(wires_.empty(), "Number of wires must be larger than 0");
+        PL_ABORT_IF(kraus_ops_.empty(),
+                    "A channel must have at least one Kraus operator.");
+        const size_t dim = Util::exp2(wires_.size());
+        constexpr T tol = 1e-5;
+
+        std::vector<ComplexT> total(dim * dim, ComplexT{0.0, 0.0});
+        std::vector<ComplexT> product(dim * dim);
+        bool unitary_mixture = true;
+        for (size_t i = 0; i < kraus_ops_.size(); i++) {
+            const auto &op = kraus_ops_[i];
+            PL_ABORT_IF(op.size() != dim * dim,
+                        "The size of a Kraus operator does not match with "
+                        "the given number of wires");
+            for (size_t row = 0; row < dim; row++) {
+                for (size_t col = 0; col < dim; col++) {
+                    ComplexT sum{0.0, 0.0};
+                    for (size_t k = 0; k < dim; k++) {
+                        sum += std::conj(op[k * dim + row]) * op[k * dim + col];
+                    }
+                    product[row * dim + col] = sum;
+                    total[row * dim + col] += sum;
+                }
+            }
+            const T prob = std::real(product[0]);
+            for (size_t row = 0; row < dim; row++) {
+                for (size_t col = 0; col < dim; col++) {
+                    const ComplexT expected =
+                        (row == col) ? ComplexT{prob, 0.0} : ComplexT{0.0, 0.0};
+                    unitary_mixture = unitary_mixture &&
+                                      std::abs(product[row * dim + col] -
+                                               expected) < tol;
+                }
+            }
+            fixed_probs_.emplace_back(prob);
+            if (i + 1 < kraus_ops_.size()) {
+                products_.insert(products_.end(), product.begin(),
+                                 product.end());
+            }
+        }
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                const ComplexT expected =
+                    (row == col) ? ComplexT{1.0, 0.0} : ComplexT{0.0, 0.0};
+                PL_ABORT_IF(std::abs(total[row * dim + col] - expected) >= tol,
+                            "The Kraus operators must satisfy "
+                            "sum_i K_i^dagger K_i = I.");
+            }
+        }
+        if (!unitary_mixture) {
+            fixed_probs_.clear();
+        }
+    }
+
+    /**
+     * @brief Depolarizing channel, applying each of the Pauli operators with
+     * probability p/3.
+     *
+     * @param p Depolarizing probability.
+     * @param wire Wire the channel acts on.
+     */
+    static auto depolarizing(T p, size_t wire) -> KrausChannel {
+        PL_ABORT_IF(p < 0 || p > 1, "The probability must be in [0, 1].");
+        const T k0 = std::sqrt(1 - p);
+        const T k = std::sqrt(p / 3);
+        return KrausChannel({{k0, 0.0, 0.0, k0},
+                             {0.0, k, k, 0.0},
+                             {0.0, ComplexT{0.0, -k}, ComplexT{0.0, k}, 0.0},
+                             {k, 0.0, 0.0, -k}},
+                            {wire});
+    }
+
+    /**
+     * @brief Amplitude damping channel, decaying @f$|1\rangle@f$ to
+     * @f$|0\rangle@f$ with probability gamma.
+     *
+     * @param gamma Damping probability.
+     * @param wire Wire the channel acts on.
+     */
+    static auto amplitudeDamping(T gamma, size_t wire) -> KrausChannel {
+        PL_ABORT_IF(gamma < 0 || gamma > 1,
+                    "The probability must be in [0, 1].");
+        return KrausChannel({{1.0, 0.0, 0.0, std::sqrt(1 - gamma)},
+                             {0.0, std::sqrt(gamma), 0.0, 0.0}},
+                            {wire});
+    }
+
+    /**
+     * @brief Get the wires the channel acts on.
+     */
+    [[nodiscard]] auto getWires() const -> const std::vector<size_t> & {
+        return wires_;
+    }
+
+    /**
+     * @brief Get the Kraus operators.
+     */
+    [[nodiscard]] auto getKrausOps() const
+        -> const std::vector<std::vector<ComplexT>> & {
+        return kraus_ops_;
+    }
+
+    /**
+     * @brief Check whether the channel is a mixture of unitaries, with
+     * branch probabilities independent of the state.
+     */
+    [[nodiscard]] auto isUnitaryMixture() const -> bool {
+        return !fixed_probs_.empty();
+    }
+
+    /**
+     * @brief Compute the probability of each Kraus operator for a normalized
+     * state.
+     *
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     */
+    [[nodiscard]] auto branchProbs(const ComplexT *arr,
+                                   size_t num_qubits) const -> std::vector<T> {
+        if (isUnitaryMixture()) {
+            return fixed_probs_;
+        }
+        auto probs = MeasuresKernels::expvalMatrices(
+            arr, num_qubits, products_.data(), kraus_ops_.size() - 1, wires_);
+        T total = 0.0;
+        for (auto &prob : probs) {
+            prob = std::max(prob, T{0.0});
+            total += prob;
+        }
+        // The last probability follows from the completeness relation
+        probs.emplace_back(std::max(T{1.0} - total, T{0.0}));
+        return probs;
+    }
+
+    /**
+     * @brief Apply a Kraus operator drawn from the branch probabilities and
+     * renormalize the state.
+     *
+     * @param sv Statevector.
+     * @param random Uniform random number in [0, 1) drawing the operator.
+     * @return Index of the applied Kraus operator.
+     */
+    auto apply(StateVectorManagedCPU<T> &sv, double random) const -> size_t {
+        const auto probs = branchProbs(sv.getData(), sv.getNumQubits());
+        T total = 0.0;
+        for (const T prob : probs) {
+            total += prob;
+        }
+        // Draw the last operator of non-zero probability if rounding leaves
+        // the random number beyond the cumulative sum
+        double threshold = random * static_cast<double>(total);
+        size_t idx = 0;
+        size_t last_nonzero = 0;
+        for (; idx < probs.size(); idx++) {
+            if (probs[idx] > 0) {
+                last_nonzero = idx;
+                if (threshold < static_cast<double>(probs[idx])) {
+                    break;
+                }
+            }
+            threshold -= static_cast<double>(probs[idx]);
+        }
+        idx = std::min(idx, last_nonzero);
+
+        // Renormalization is folded into the matrix, so the state is updated
+        // in a single pass
+        const T scale = 1 / std::sqrt(probs[idx]);
+        std::vector<ComplexT> matrix(kraus_ops_[idx]);
+        for (auto &elt : matrix) {
+            elt *= scale;
+        }
+        sv.applyMatrix(matrix, wires_);
+        return idx;
+    }
+};
+
+/**
+ * @brief Results of a trajectory simulation.
+ */
+template <class T> struct TrajectoryResults {
+    /// Mean expectation value of each observable over the trajectories
+    std::vector<T> expvals;
+    /// Standard error of each mean
+    std::vector<T> std_errors;
+};
+
+/**
+ * @brief Simulates a noisy circuit by Monte-Carlo wavefunction (quantum
+ * trajectory) sampling, storing a single statevector per thread in place
+ * of a density matrix on twice as many qubits.
+ *
+ * Each trajectory starts from the initial state and applies the gates
+ * exactly, while each channel applies one of its Kraus operators drawn from
+ * the branch probabilities. Trajectory t draws from its own random stream,
+ * seeded by the seed of the simulation and t, so results do not depend on
+ * which thread executes it.
+ *
+ * Trajectories are distributed over the threads, each thread reusing a
+ * statevector from a pool of one statevector per thread, unless the
+ * statevectors are large enough for multi-threaded gate kernels and there
+ * are fewer trajectories than threads (see TapeExecutor::runConcurrently).
+ * Expectation values are accumulated as each trajectory finishes, so no
+ * final state is kept.
+ *
+ * @tparam T Floating point precision.
+ */
+template <class T> class QuantumTrajectories {
+  public:
+    using ComplexT = std::complex<T>;
+
+  private:
+    struct Gate {
+        std::string name;
+        std::vector<size_t> wires;
+        bool inverse;
+        std::vector<T> params;
+    };
+
+    size_t num_qubits_;
+    std::vector<std::variant<Gate, KrausChannel<T>>> ops_;
+
+    /**
+     * @brief Get the number of available threads.
+     */
+    static auto getMaxNumThreads() -> size_t {
+#if defined(_OPENMP)
+        return static_cast<size_t>(omp_get_max_threads());
+#else
+        return 1;
+#endif
+    }
+
+    /**
+     * @brief Check the wires are valid and distinct.
+     */
+    void checkWires(const std::vector<size_t> &wires) const {
+        for (size_t k = 0; k < wires.size(); k++) {
+            PL_ABORT_IF(wires[k] >= num_qubits_, "Invalid wire index.");
+            PL_ABORT_IF(std::find(wires.begin(), wires.begin() + k,
+                                  wires[k]) != wires.begin() + k,
+                        "Wires must be distinct.");
+        }
+    }
+
+    /**
+     * @brief Run a single trajectory on the statevector.
+     *
+     * @param sv Statevector holding the initial state.
+     * @param seed Seed of the simulation.
+     * @param trajectory Index of the trajectory.
+     */
+    void runTrajectory(StateVectorManagedCPU<T> &sv, uint64_t seed,
+                       uint64_t trajectory) const {
+        std::seed_seq seq{static_cast<uint32_t>(seed),
+                          static_cast<uint32_t>(seed >> 32U),
+                          static_cast<uint32_t>(trajectory),
+                          static_cast<uint32_t>(trajectory >> 32U)};
+        std::mt19937_64 generator(seq);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        for (const auto &op : ops_) {
+            if (const auto *gate = std::get_if<Gate>(&op); gate != nullptr) {
+                sv.applyOperation(gate->name, gate->wires, gate->inverse,
+                                  gate->params);
+            } else {
+                std::get<KrausChannel<T>>(op).apply(sv, uniform(generator));
+            }
+        }
+    }
+
+  public:
+    /**
+     * @brief Construct an empty noisy circuit.
+     *
+     * @param num_qubits Number of qubits.
+     */
+    explicit QuantumTrajectories(size_t num_qubits)
+        : num_qubits_{num_qubits} {}
+
+    /**
+     * @brief Get the number of qubits.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Get the number of gates and channels.
+     */
+    [[nodiscard]] auto getNumOps() const -> size_t { return ops_.size(); }
+
+    /**
+     * @brief Append a gate.
+     *
+     * @param name Name of the gate.
+     * @param wires Wires the gate acts on.
+     * @param inverse Indicates whether to use the inverse of the gate.
+     * @param params Parameters of the gate.
+     */
+    void addGate(std::string name, std::vector<size_t> wires,
+                 bool inverse = false, std::vector<T> params = {}) {
+        checkWires(wires);
+        ops_.emplace_back(Gate{std::move(name), std::move(wires), inverse,
+                               std::move(params)});
+    }
+
+    /**
+     * @brief Append a channel.
+     *
+     * @param channel Channel given by its Kraus operators.
+     */
+    void addChannel(KrausChannel<T> channel) {
+        checkWires(channel.getWires());
+        ops_.emplace_back(std::move(channel));
+    }
+
+    /**
+     * @brief Estimate expectation values of observables by sampling
+     * trajectories.
+     *
+     * @param init_state Pointer to the normalized initial state of size
+     * 2^getNumQubits().
+     * @param observables Observables to measure.
+     * @param num_trajectories Number of trajectories.
+     * @param seed Seed of the random streams of the trajectories.
+     */
+    [[nodiscard]] auto execute(const ComplexT *init_state,
+                               const std::vector<PauliSum<T>> &observables,
+                               size_t num_trajectories, uint64_t seed) const
+        -> TrajectoryResults<T> {
+        using AccT = Util::accumulator_t<T>;
+        const size_t length = Util::exp2(num_qubits_);
+        const size_t num_obs = observables.size();
+        const size_t num_threads = getMaxNumThreads();
+        const bool concurrent =
+            num_trajectories >= num_threads ||
+            num_qubits_ < KernelMap::parallel_lm_min_num_qubits;
+        const Threading threading =
+            concurrent ? Threading::SingleThread : Threading::MultiThread;
+        [[maybe_unused]] const size_t team_size =
+            concurrent ? std::max(size_t{1},
+                                  std::min(num_trajectories, num_threads))
+                       : 1;
+        const std::vector<ComplexT> init(init_state, init_state + length);
+
+        // Sums of the expectation values and of their squares
+        std::vector<AccT> sums(2 * num_obs, 0.0);
+
+        // clang-format off
+        std::exception_ptr ex = nullptr;
+        #if defined(_OPENMP)
+            #pragma omp parallel num_threads(team_size) default(none) \
+                shared(init, observables, num_trajectories, seed, num_obs, \
+                       concurrent, threading, sums, ex)
+        #endif
+        {
+            #if defined(_OPENMP)
+                if (concurrent) {
+                    // Kernels use the thread executing the trajectory only
+                    omp_set_num_threads(1);
+                }
+            #endif
+            std::vector<AccT> local_sums(2 * num_obs, 0.0);
+            StateVectorManagedCPU<T> sv(num_qubits_, threading);
+            #if defined(_OPENMP)
+                #pragma omp for schedule(dynamic, 1)
+            #endif
+            for (size_t t = 0; t < num_trajectories; t++) {
+                try {
+                    sv.updateData(init);
+                    runTrajectory(sv, seed, t);
+                    for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+                        const AccT expval = observables[obs_idx].expval(
+                            sv.getData(), num_qubits_);
+                        local_sums[2 * obs_idx] += expval;
+                        local_sums[2 * obs_idx + 1] += expval * expval;
+                    }
+                } catch (...) {
+                    #if defined(_OPENMP)
+                        #pragma omp critical
+                    #endif
+                    ex = std::current_exception();
+                }
+            }
+            #if defined(_OPENMP)
+                #pragma omp critical
+            #endif
+            for (size_t k = 0; k < local_sums.size(); k++) {
+                sums[k] += local_sums[k];
+            }
+        }
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+        // clang-format on
+
+        TrajectoryResults<T> results{std::vector<T>(num_obs, 0.0),
+                                     std::vector<T>(num_obs, 0.0)};
+        if (num_trajectories == 0) {
+            return results;
+        }
+        const auto n = static_cast<AccT>(num_trajectories);
+        for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+            const AccT mean = sums[2 * obs_idx] / n;
+            results.expvals[obs_idx] = static_cast<T>(mean);
+            if (num_trajectories > 1) {
+                const AccT var = std::max(
+                    AccT{0.0}, (sums[2 * obs_idx + 1] - n * mean * mean) /
+                                   (n - 1));
+                results.std_errors[obs_idx] =
+                    static_cast<T>(std::sqrt(var / n));
+            }
+        }
+        return results;
+    }
+};
+} // namespace Pennylane::Algorithms
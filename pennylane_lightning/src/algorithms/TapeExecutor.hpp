@@ -0,0 +1,203 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines an executor of many independent tapes.
+ */
+#pragma once
+
+#include "AdjointDiff.hpp"
+#include "Error.hpp"
+#include "JacobianTape.hpp"
+#include "KernelMap.hpp"
+#include "Threading.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace Pennylane::Algorithms {
+/**
+ * @brief Executes and differentiates a batch of independent tapes, e.g. the
+ * shifted tapes of a gradient or the points of a dataset.
+ *
+ * Tapes which would not use multi-threaded gate kernels, or all tapes when
+ * there are at least as many as threads, are distributed over the threads,
+ * each tape using a single thread. Threads take the next tape as soon as
+ * they are done, starting with the most expensive ones so that the last
+ * tapes to start are the shortest. The remaining tapes are executed one
+ * after another using all threads within each state.
+ *
+ * Each tape is executed by a copy of the AdjointJacobian given on
+ * construction, so its settings (parallelism, checkpointing, buffer pool
+ * and threading configuration) apply to every tape.
+ *
+ * @tparam T Floating point precision.
+ */
+template <class T> class TapeExecutor {
+  private:
+    AdjointJacobian<T> adjoint_;
+
+    /**
+     * @brief Get the number of available threads.
+     */
+    static auto getMaxNumThreads() -> size_t {
+#if defined(_OPENMP)
+        return static_cast<size_t>(omp_get_max_threads());
+#else
+        return 1;
+#endif
+    }
+
+    /**
+     * @brief Estimate the cost of a tape as the number of amplitudes
+     * touched by its operations and observables.
+     */
+    static auto cost(const JacobianData<T> &jd) -> size_t {
+        return jd.getSizeStateVec() * (jd.getOperations().getSize() +
+                                       jd.getObservables().size());
+    }
+
+  public:
+    /**
+     * @brief Construct an executor.
+     *
+     * @param adjoint Adjoint method whose settings are used for each tape.
+     */
+    explicit TapeExecutor(AdjointJacobian<T> adjoint = {})
+        : adjoint_{std::move(adjoint)} {}
+
+    /**
+     * @brief Get the adjoint method whose settings are used for each tape.
+     */
+    [[nodiscard]] auto getAdjoint() -> AdjointJacobian<T> & {
+        return adjoint_;
+    }
+
+    /**
+     * @brief Check whether tapes are distributed over the threads, each
+     * using a single thread.
+     *
+     * @param num_qubits Number of qubits of a tape.
+     * @param num_tapes Number of tapes in the batch.
+     * @param num_threads Number of available threads.
+     */
+    static auto runConcurrently(size_t num_qubits, size_t num_tapes,
+                                size_t num_threads) -> bool {
+        return num_tapes >= num_threads ||
+               num_qubits < KernelMap::parallel_lm_min_num_qubits;
+    }
+
+    /**
+     * @brief Execute the tapes and compute their expectation values and, for
+     * tapes with trainable parameters, their Jacobians.
+     *
+     * Tapes must not share a working statevector.
+     *
+     * @param tapes Tapes to execute.
+     * @param compute_variances Indicate whether to compute the variances of
+     * the observables.
+     * @param apply_operations Indicate whether to apply the operations of
+     * each tape to its state prior to calculation.
+     * @return The results of each tape. See AdjointJacobian::execute.
+     */
+    auto execute(const std::vector<JacobianData<T>> &tapes,
+                 bool compute_variances = false, bool apply_operations = true)
+        -> std::vector<ExecutionResults<T>> {
+        const size_t num_tapes = tapes.size();
+        std::vector<ExecutionResults<T>> results(num_tapes);
+        if (num_tapes == 0) {
+            return results;
+        }
+
+        size_t max_num_qubits = 0;
+        for (const auto &jd : tapes) {
+            max_num_qubits = std::max(max_num_qubits,
+                                      Util::log2(jd.getSizeStateVec()));
+        }
+        const ThreadingScope scope(adjoint_.getThreadingConfig(),
+                                   max_num_qubits);
+        const size_t num_threads = getMaxNumThreads();
+
+        std::vector<size_t> concurrent;
+        std::vector<size_t> sequential;
+        for (size_t idx = 0; idx < num_tapes; idx++) {
+            const size_t num_qubits = Util::log2(tapes[idx].getSizeStateVec());
+            if (runConcurrently(num_qubits, num_tapes, num_threads)) {
+                concurrent.emplace_back(idx);
+            } else {
+                sequential.emplace_back(idx);
+            }
+        }
+        std::stable_sort(concurrent.begin(), concurrent.end(),
+                         [&tapes](size_t lhs, size_t rhs) {
+                             return cost(tapes[lhs]) > cost(tapes[rhs]);
+                         });
+
+        for (const size_t idx : sequential) {
+            results[idx] = adjoint_.execute(tapes[idx], compute_variances, {},
+                                            apply_operations);
+        }
+
+        if (concurrent.empty()) {
+            return results;
+        }
+        const size_t num_concurrent = concurrent.size();
+        [[maybe_unused]] const size_t team_size =
+            std::min(num_concurrent, num_threads);
+
+        // clang-format off
+        std::exception_ptr ex = nullptr;
+        #if defined(_OPENMP)
+            #pragma omp parallel num_threads(team_size) default(none) \
+                shared(tapes, concurrent, num_concurrent, results, \
+                       compute_variances, apply_operations, ex)
+        #endif
+        {
+            #if defined(_OPENMP)
+                // Nested regions of the kernels and of the adjoint method
+                // use the thread executing the tape only
+                omp_set_num_threads(1);
+            #endif
+            #if defined(_OPENMP)
+                #pragma omp for schedule(dynamic, 1)
+            #endif
+            for (size_t k = 0; k < num_concurrent; k++) {
+                try {
+                    const size_t idx = concurrent[k];
+                    results[idx] = adjoint_.execute(
+                        tapes[idx], compute_variances, {}, apply_operations);
+                } catch (...) {
+                    #if defined(_OPENMP)
+                        #pragma omp critical
+                    #endif
+                    ex = std::current_exception();
+                }
+            }
+        }
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+        // clang-format on
+        return results;
+    }
+};
+} // namespace Pennylane::Algorithms
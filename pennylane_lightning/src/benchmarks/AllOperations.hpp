@@ -19,9 +19,121 @@
 #include "StateVectorManagedCPU.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <complex>
+#include <numeric>
 #include <random>
 #include <vector>
 
+//***********************************************************************//
+//                            Roofline counters
+//***********************************************************************//
+/**
+ * @brief Estimated memory traffic and floating point operations of applying
+ * an operator, per amplitude of the statevector.
+ *
+ * Amplitudes whose row of the operator matrix is the identity are neither
+ * read nor written, and every other one is read and written once. Products
+ * with 0, 1, -1, i or -i are free, other complex products cost 6 FLOPs and
+ * complex additions 2.
+ */
+struct OperatorCost {
+    double bytes_per_amplitude;
+    double flops_per_amplitude;
+};
+
+/**
+ * @brief Estimate the cost of an operator from its matrix.
+ *
+ * @param matrix Row-major matrix of the operator.
+ * @param num_wires Number of wires of the operator.
+ */
+template <class T>
+auto operatorCost(const std::vector<std::complex<T>> &matrix, size_t num_wires)
+    -> OperatorCost {
+    const size_t dim = size_t{1} << num_wires;
+    const auto is_trivial = [](std::complex<T> value) {
+        return (value.real() == 0 && std::abs(value.imag()) == 1) ||
+               (value.imag() == 0 && std::abs(value.real()) == 1);
+    };
+    double touched = 0;
+    double flops = 0;
+    for (size_t row = 0; row < dim; row++) {
+        size_t nnz = 0;
+        size_t products = 0;
+        bool identity_row = true;
+        for (size_t col = 0; col < dim; col++) {
+            const auto value = matrix[row * dim + col];
+            if (value == std::complex<T>{0, 0}) {
+                continue;
+            }
+            nnz++;
+            products += is_trivial(value) ? 0 : 1;
+            identity_row = identity_row && (col == row) &&
+                           (value == std::complex<T>{1, 0});
+        }
+        if (!identity_row) {
+            touched += 1;
+            flops += 6.0 * static_cast<double>(products) +
+                     2.0 * static_cast<double>(nnz > 0 ? nnz - 1 : 0);
+        }
+    }
+    return {2.0 * sizeof(std::complex<T>) * touched / static_cast<double>(dim),
+            flops / static_cast<double>(dim)};
+}
+
+/**
+ * @brief Get the matrix of an operator by applying it to the basis states
+ * of its wires.
+ *
+ * @param num_wires Number of wires of the operator.
+ * @param apply Function applying the operator to a statevector and wires.
+ */
+template <class T, class ApplyFunc>
+auto operatorMatrix(size_t num_wires, ApplyFunc &&apply)
+    -> std::vector<std::complex<T>> {
+    const size_t dim = size_t{1} << num_wires;
+    std::vector<size_t> wires(num_wires);
+    std::iota(wires.begin(), wires.end(), size_t{0});
+    std::vector<std::complex<T>> matrix(dim * dim);
+    for (size_t col = 0; col < dim; col++) {
+        Pennylane::StateVectorManagedCPU<T> sv{num_wires};
+        std::complex<T> *data = sv.getData();
+        std::fill(data, data + dim, std::complex<T>{0, 0});
+        data[col] = {1, 0};
+        apply(sv, wires);
+        for (size_t row = 0; row < dim; row++) {
+            matrix[row * dim + col] = data[row];
+        }
+    }
+    return matrix;
+}
+
+/**
+ * @brief Report the estimated bytes/s, FLOP/s and arithmetic intensity
+ * (FLOP/byte) of a benchmark applying operators.
+ *
+ * @param state Benchmark state.
+ * @param cost Cost of each operator.
+ * @param num_qubits Number of qubits.
+ * @param num_ops Number of operators applied per iteration.
+ */
+inline void setRooflineCounters(benchmark::State &state,
+                                const OperatorCost &cost, size_t num_qubits,
+                                size_t num_ops) {
+    const double amplitudes = static_cast<double>(state.iterations()) *
+                              static_cast<double>(num_ops) *
+                              static_cast<double>(size_t{1} << num_qubits);
+    state.SetBytesProcessed(
+        static_cast<int64_t>(amplitudes * cost.bytes_per_amplitude));
+    state.counters["flops"] = benchmark::Counter(
+        amplitudes * cost.flops_per_amplitude, benchmark::Counter::kIsRate);
+    state.counters["intensity"] =
+        (cost.bytes_per_amplitude > 0)
+            ? cost.flops_per_amplitude / cost.bytes_per_amplitude
+            : 0.0;
+}
+
 //***********************************************************************//
 //                            Gates
 //***********************************************************************//
@@ -99,6 +211,15 @@ static void applyOperation_GateOp(benchmark::State &state,
         benchmark::DoNotOptimize(sv.getDataVector()[0]);
         benchmark::DoNotOptimize(sv.getDataVector()[(1 << num_qubits) - 1]);
     }
+
+    const auto cost = operatorCost(
+        operatorMatrix<T>(num_wires,
+                          [&](auto &sv, const std::vector<size_t> &op_wires) {
+                              sv.applyOperation(kernel, gate_name, op_wires,
+                                                false, params[0]);
+                          }),
+        num_wires);
+    setRooflineCounters(state, cost, num_qubits, num_gates);
 }
 
 //***********************************************************************//
@@ -161,6 +282,17 @@ applyGenerator_GntrOp(benchmark::State &state,
         benchmark::DoNotOptimize(sv.getDataVector()[0]);
         benchmark::DoNotOptimize(sv.getDataVector()[(1 << num_qubits) - 1]);
     }
+
+    const auto cost = operatorCost(
+        operatorMatrix<T>(num_wires,
+                          [&](auto &sv, const std::vector<size_t> &op_wires) {
+                              [[maybe_unused]] const auto scale =
+                                  sv.applyGenerator(kernel,
+                                                    gntr_name_without_suffix,
+                                                    op_wires, false);
+                          }),
+        num_wires);
+    setRooflineCounters(state, cost, num_qubits, num_gntrs);
 }
 
 //***********************************************************************//
@@ -210,4 +342,39 @@ static void applyMatrix(benchmark::State &state,
         benchmark::DoNotOptimize(sv.getDataVector()[0]);
         benchmark::DoNotOptimize(sv.getDataVector()[(1 << num_qubits) - 1]);
     }
+
+    setRooflineCounters(state, operatorCost(matrices[0], num_wires),
+                        num_qubits, num_matrices);
+}
+
+//***********************************************************************//
+//                            Bandwidth probe
+//***********************************************************************//
+
+/**
+ * @brief Benchmark the memory bandwidth of scaling `2^state.range(0)`
+ * complex numbers in place, which moves the same bytes as a gate touching
+ * every amplitude. This gives the memory bound of the roofline.
+ *
+ * @tparam T Floating point precision type.
+ */
+template <class T, size_t num_sweeps = 32>
+static void bandwidthProbe(benchmark::State &state) {
+    const size_t num_qubits = state.range(0);
+    const size_t length = size_t{1} << num_qubits;
+    std::vector<std::complex<T>> data(length, std::complex<T>{1, 0});
+    const std::complex<T> scale{std::cos(T{0.5}), std::sin(T{0.5})};
+
+    for (auto _ : state) {
+        for (size_t s = 0; s < num_sweeps; s++) {
+            for (size_t i = 0; i < length; i++) {
+                data[i] *= scale;
+            }
+        }
+        benchmark::DoNotOptimize(data.data());
+        benchmark::ClobberMemory();
+    }
+
+    setRooflineCounters(state, {2.0 * sizeof(std::complex<T>), 6.0},
+                        num_qubits, num_sweeps);
 }
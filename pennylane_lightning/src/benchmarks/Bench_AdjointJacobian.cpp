@@ -0,0 +1,185 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AdjointDiff.hpp"
+#include "JacobianProd.hpp"
+#include "StateVectorManagedCPU.hpp"
+
+#include "Bench_Utils.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+namespace {
+/**
+ * @brief Layers of RX and RY rotations on every qubit followed by a chain of
+ * CNOTs.
+ *
+ * @param num_qubits Number of qubits.
+ * @param num_layers Number of layers.
+ */
+template <class T>
+auto layeredAnsatz(size_t num_qubits, size_t num_layers) -> OpsData<T> {
+    std::mt19937_64 re{1337};
+    std::uniform_real_distribution<T> angle(0, 2 * static_cast<T>(M_PI));
+    std::vector<std::string> names;
+    std::vector<std::vector<T>> params;
+    std::vector<std::vector<size_t>> wires;
+    for (size_t layer = 0; layer < num_layers; layer++) {
+        for (size_t i = 0; i < num_qubits; i++) {
+            for (const auto *rotation : {"RX", "RY"}) {
+                names.emplace_back(rotation);
+                params.push_back({angle(re)});
+                wires.push_back({i});
+            }
+        }
+        for (size_t i = 0; i + 1 < num_qubits; i++) {
+            names.emplace_back("CNOT");
+            params.emplace_back();
+            wires.push_back({i, i + 1});
+        }
+    }
+    return {names, params, wires, std::vector<bool>(names.size(), false)};
+}
+
+/**
+ * @brief Get observables cycling through PauliZ and two-qubit Pauli words on
+ * successive wires.
+ */
+template <class T>
+auto observables(size_t num_obs, size_t num_qubits)
+    -> std::vector<ObsDatum<T>> {
+    std::vector<ObsDatum<T>> obs;
+    for (size_t i = 0; i < num_obs; i++) {
+        const size_t wire = i % num_qubits;
+        if (i % 2 == 0) {
+            obs.emplace_back(std::vector<std::string>{"PauliZ"},
+                             std::vector<typename ObsDatum<T>::param_var_t>{
+                                 {}},
+                             std::vector<std::vector<size_t>>{{wire}});
+        } else {
+            obs.emplace_back(
+                std::vector<std::string>{"PauliX", "PauliY"},
+                std::vector<typename ObsDatum<T>::param_var_t>{{}, {}},
+                std::vector<std::vector<size_t>>{
+                    {wire}, {(wire + 1) % num_qubits}});
+        }
+    }
+    return obs;
+}
+
+/**
+ * @brief Tape of the layered ansatz with all parameters trainable.
+ */
+template <class T> struct Tape {
+    StateVectorManagedCPU<T> sv;
+    OpsData<T> ops;
+    std::vector<ObsDatum<T>> obs;
+    std::vector<size_t> trainable;
+
+    Tape(size_t num_qubits, size_t num_obs, size_t num_layers,
+         Threading threading)
+        : sv(num_qubits, threading),
+          ops(layeredAnsatz<T>(num_qubits, num_layers)),
+          obs(observables<T>(num_obs, num_qubits)),
+          trainable(ops.getNumParOps()) {
+        std::iota(trainable.begin(), trainable.end(), size_t{0});
+    }
+
+    [[nodiscard]] auto jacobianData() -> JacobianData<T> {
+        return {trainable.size(), sv, obs, ops, trainable};
+    }
+};
+
+/**
+ * @brief Benchmark the adjoint Jacobian for `state.range(0)` qubits,
+ * `state.range(1)` threads, `state.range(2)` observables and
+ * `state.range(3)` layers.
+ */
+template <class T> void adjointJacobian(benchmark::State &state) {
+    resetPeakRSS();
+    const auto num_threads = static_cast<size_t>(state.range(1));
+    Tape<T> tape(static_cast<size_t>(state.range(0)),
+                 static_cast<size_t>(state.range(2)),
+                 static_cast<size_t>(state.range(3)), useThreads(num_threads));
+    const auto tape_data = tape.jacobianData();
+    std::vector<T> jacobian(tape.trainable.size() * tape.obs.size());
+    AdjointJacobian<T> adjoint;
+    for (auto _ : state) {
+        adjoint.adjointJacobian(jacobian, tape_data, true);
+        benchmark::DoNotOptimize(jacobian.data());
+    }
+    state.counters["params"] = static_cast<double>(tape.trainable.size());
+    addPeakRSS(state);
+}
+
+/**
+ * @brief Benchmark the vector-Jacobian product, with the same arguments as
+ * adjointJacobian().
+ */
+template <class T> void vectorJacobianProduct(benchmark::State &state) {
+    resetPeakRSS();
+    const auto num_threads = static_cast<size_t>(state.range(1));
+    Tape<T> tape(static_cast<size_t>(state.range(0)),
+                 static_cast<size_t>(state.range(2)),
+                 static_cast<size_t>(state.range(3)), useThreads(num_threads));
+    const auto tape_data = tape.jacobianData();
+    std::vector<T> dy(tape.obs.size());
+    std::iota(dy.begin(), dy.end(), T{1});
+    VectorJacobianProduct<T> vjp;
+    const auto vjp_fn = vjp.vectorJacobianProduct(
+        dy, tape.trainable.size(), /* apply_operations */ true);
+    for (auto _ : state) {
+        auto result = vjp_fn(tape_data);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.counters["params"] = static_cast<double>(tape.trainable.size());
+    addPeakRSS(state);
+}
+
+template <class T> void registerAdjoint() {
+    const std::string precision = "<" + std::string(precision_to_str<T>) + ">";
+    const std::vector<std::vector<int64_t>> args{
+        benchmark::CreateDenseRange(12, 22, 2), // qubits
+        threadCounts(),                         // threads
+        {1, 4, 16},                             // observables
+        {2, 8},                                 // layers
+    };
+    benchmark::RegisterBenchmark(("adjointJacobian" + precision).c_str(),
+                                 adjointJacobian<T>)
+        ->ArgNames({"qubits", "threads", "observables", "layers"})
+        ->ArgsProduct(args)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("vectorJacobianProduct" + precision).c_str(),
+                                 vectorJacobianProduct<T>)
+        ->ArgNames({"qubits", "threads", "observables", "layers"})
+        ->ArgsProduct(args)
+        ->Unit(benchmark::kMillisecond);
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    addCompileInfo();
+    addRuntimeInfo();
+    registerAdjoint<float>();
+    registerAdjoint<double>();
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
@@ -0,0 +1,364 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <complex>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AdjointDiff.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "Threading.hpp"
+
+#include "Bench_Utils.hpp"
+
+using namespace Pennylane;
+
+namespace {
+/**
+ * @brief Operations of a circuit. Operations with a non-empty matrix are
+ * applied as matrices.
+ */
+template <class T> struct Circuit {
+    std::vector<std::string> names;
+    std::vector<std::vector<size_t>> wires;
+    std::vector<std::vector<T>> params;
+    std::vector<std::vector<std::complex<T>>> matrices;
+
+    void add(std::string name, std::vector<size_t> op_wires,
+             std::vector<T> op_params = {}) {
+        names.emplace_back(std::move(name));
+        wires.emplace_back(std::move(op_wires));
+        params.emplace_back(std::move(op_params));
+        matrices.emplace_back();
+    }
+
+    void addMatrix(std::vector<std::complex<T>> matrix,
+                   std::vector<size_t> op_wires) {
+        names.emplace_back("QubitUnitary");
+        wires.emplace_back(std::move(op_wires));
+        params.emplace_back();
+        matrices.emplace_back(std::move(matrix));
+    }
+
+    [[nodiscard]] auto size() const -> size_t { return names.size(); }
+
+    void apply(StateVectorManagedCPU<T> &sv) const {
+        for (size_t i = 0; i < size(); i++) {
+            if (matrices[i].empty()) {
+                sv.applyOperation(names[i], wires[i], false, params[i]);
+            } else {
+                sv.applyMatrix(matrices[i], wires[i]);
+            }
+        }
+    }
+
+    [[nodiscard]] auto toOpsData() const -> Algorithms::OpsData<T> {
+        return {names, params, wires, std::vector<bool>(size(), false),
+                matrices};
+    }
+};
+
+/**
+ * @brief Quantum Fourier transform, including the final qubit reversal.
+ */
+template <class T> auto qft(size_t num_qubits) -> Circuit<T> {
+    Circuit<T> circuit;
+    for (size_t i = 0; i < num_qubits; i++) {
+        circuit.add("Hadamard", {i});
+        for (size_t j = i + 1; j < num_qubits; j++) {
+            circuit.add("ControlledPhaseShift", {j, i},
+                        {static_cast<T>(M_PI) /
+                         static_cast<T>(size_t{1} << (j - i))});
+        }
+    }
+    for (size_t i = 0; i < num_qubits / 2; i++) {
+        circuit.add("SWAP", {i, num_qubits - 1 - i});
+    }
+    return circuit;
+}
+
+/**
+ * @brief Haar-like random 4x4 unitary from the Gram-Schmidt
+ * orthonormalization of a Gaussian matrix.
+ */
+template <class T, class RandomEngine>
+auto randomUnitary4(RandomEngine &re) -> std::vector<std::complex<T>> {
+    constexpr size_t dim = 4;
+    std::normal_distribution<T> dist;
+    std::vector<std::complex<T>> cols(dim * dim);
+    for (auto &elt : cols) {
+        elt = {dist(re), dist(re)};
+    }
+    for (size_t c = 0; c < dim; c++) {
+        std::complex<T> *col = cols.data() + c * dim;
+        for (size_t p = 0; p < c; p++) {
+            const std::complex<T> *prev = cols.data() + p * dim;
+            std::complex<T> overlap{0, 0};
+            for (size_t r = 0; r < dim; r++) {
+                overlap += std::conj(prev[r]) * col[r];
+            }
+            for (size_t r = 0; r < dim; r++) {
+                col[r] -= overlap * prev[r];
+            }
+        }
+        T norm{0};
+        for (size_t r = 0; r < dim; r++) {
+            norm += std::norm(col[r]);
+        }
+        for (size_t r = 0; r < dim; r++) {
+            col[r] /= std::sqrt(norm);
+        }
+    }
+    // Stored column by column, so transpose to row-major
+    std::vector<std::complex<T>> matrix(dim * dim);
+    for (size_t r = 0; r < dim; r++) {
+        for (size_t c = 0; c < dim; c++) {
+            matrix[r * dim + c] = cols[c * dim + r];
+        }
+    }
+    return matrix;
+}
+
+/**
+ * @brief Quantum volume circuit: as many layers as qubits, each applying
+ * random two-qubit unitaries to a random pairing of the qubits.
+ */
+template <class T> auto quantumVolume(size_t num_qubits) -> Circuit<T> {
+    std::mt19937_64 re{1337};
+    Circuit<T> circuit;
+    std::vector<size_t> perm(num_qubits);
+    for (size_t layer = 0; layer < num_qubits; layer++) {
+        std::iota(perm.begin(), perm.end(), size_t{0});
+        std::shuffle(perm.begin(), perm.end(), re);
+        for (size_t i = 0; i + 1 < num_qubits; i += 2) {
+            circuit.addMatrix(randomUnitary4<T>(re), {perm[i], perm[i + 1]});
+        }
+    }
+    return circuit;
+}
+
+/**
+ * @brief Hardware-efficient ansatz: layers of RY and RZ rotations on every
+ * qubit followed by a chain of CNOTs.
+ */
+template <class T>
+auto hardwareEfficientAnsatz(size_t num_qubits, size_t num_layers)
+    -> Circuit<T> {
+    std::mt19937_64 re{1337};
+    std::uniform_real_distribution<T> angle(0, 2 * static_cast<T>(M_PI));
+    Circuit<T> circuit;
+    for (size_t layer = 0; layer < num_layers; layer++) {
+        for (size_t i = 0; i < num_qubits; i++) {
+            circuit.add("RY", {i}, {angle(re)});
+            circuit.add("RZ", {i}, {angle(re)});
+        }
+        for (size_t i = 0; i + 1 < num_qubits; i++) {
+            circuit.add("CNOT", {i, i + 1});
+        }
+    }
+    return circuit;
+}
+
+/**
+ * @brief QAOA for MaxCut on the graph joining each qubit to its first and
+ * second neighbours on a ring.
+ */
+template <class T>
+auto qaoaMaxCut(size_t num_qubits, size_t num_layers) -> Circuit<T> {
+    Circuit<T> circuit;
+    for (size_t i = 0; i < num_qubits; i++) {
+        circuit.add("Hadamard", {i});
+    }
+    for (size_t layer = 0; layer < num_layers; layer++) {
+        const auto gamma = static_cast<T>(0.1 * (layer + 1));
+        const auto beta = static_cast<T>(0.7 / (layer + 1));
+        for (size_t dist = 1; dist <= 2; dist++) {
+            for (size_t i = 0; i < num_qubits; i++) {
+                circuit.add("IsingZZ", {i, (i + dist) % num_qubits},
+                            {2 * gamma});
+            }
+        }
+        for (size_t i = 0; i < num_qubits; i++) {
+            circuit.add("RX", {i}, {2 * beta});
+        }
+    }
+    return circuit;
+}
+
+/**
+ * @brief UCCSD-style ansatz: Hartree-Fock state on the first half of the
+ * qubits, all single excitations and the double excitations of neighbouring
+ * pairs of orbitals.
+ */
+template <class T> auto uccsd(size_t num_qubits) -> Circuit<T> {
+    const size_t num_occupied = num_qubits / 2;
+    Circuit<T> circuit;
+    for (size_t i = 0; i < num_occupied; i++) {
+        circuit.add("PauliX", {i});
+    }
+    T theta{0.01};
+    for (size_t i = 0; i < num_occupied; i++) {
+        for (size_t a = num_occupied; a < num_qubits; a++) {
+            circuit.add("SingleExcitation", {i, a}, {theta});
+            theta += static_cast<T>(0.01);
+        }
+    }
+    for (size_t i = 0; i + 1 < num_occupied; i++) {
+        for (size_t a = num_occupied; a + 1 < num_qubits; a++) {
+            circuit.add("DoubleExcitation", {i, i + 1, a, a + 1}, {theta});
+            theta += static_cast<T>(0.01);
+        }
+    }
+    return circuit;
+}
+
+/**
+ * @brief Report the amplitudes updated per second and the corresponding
+ * memory traffic, each update reading and writing one amplitude.
+ *
+ * @param state Benchmark state.
+ * @param num_passes Number of passes over the statevector per iteration.
+ * @param num_qubits Number of qubits.
+ */
+template <class T>
+void setThroughput(benchmark::State &state, size_t num_passes,
+                   size_t num_qubits) {
+    const auto amplitudes = static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(num_passes) *
+                            static_cast<int64_t>(size_t{1} << num_qubits);
+    state.SetItemsProcessed(amplitudes);
+    state.SetBytesProcessed(amplitudes * 2 *
+                            static_cast<int64_t>(sizeof(std::complex<T>)));
+}
+
+/**
+ * @brief Benchmark the execution of a circuit from @f$|0\cdots 0\rangle@f$.
+ *
+ * @param make_circuit Circuit for a number of qubits.
+ * @param threading Threading of the statevector.
+ */
+template <class T, class CircuitFactory>
+void executeCircuit(benchmark::State &state, CircuitFactory make_circuit,
+                    Threading threading) {
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const Circuit<T> circuit = make_circuit(num_qubits);
+    StateVectorManagedCPU<T> sv(num_qubits, threading);
+    std::complex<T> *data = sv.getData();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::fill(data, data + sv.getLength(), std::complex<T>{0, 0});
+        data[0] = {1, 0};
+        state.ResumeTiming();
+
+        circuit.apply(sv);
+        benchmark::DoNotOptimize(data[0]);
+        benchmark::ClobberMemory();
+    }
+    setThroughput<T>(state, circuit.size(), num_qubits);
+}
+
+/**
+ * @brief Benchmark the adjoint Jacobian of @f$\langle Z_0 Z_{n-1}\rangle@f$
+ * for the hardware-efficient ansatz, with respect to all parameters.
+ *
+ * @param threading Threading of the statevector.
+ */
+template <class T>
+void adjointHardwareEfficientAnsatz(benchmark::State &state,
+                                    Threading threading) {
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto circuit = hardwareEfficientAnsatz<T>(num_qubits, 4);
+    const auto ops = circuit.toOpsData();
+    std::vector<size_t> trainable(ops.getNumParOps());
+    std::iota(trainable.begin(), trainable.end(), size_t{0});
+    const std::vector<Algorithms::ObsDatum<T>> observables{
+        Algorithms::ObsDatum<T>({"PauliZ", "PauliZ"}, {{}, {}},
+                                {{0}, {num_qubits - 1}})};
+
+    StateVectorManagedCPU<T> sv(num_qubits, threading);
+    const Algorithms::JacobianData<T> tape{trainable.size(), sv, observables,
+                                           ops, trainable};
+    std::vector<T> jacobian(trainable.size());
+    Algorithms::AdjointJacobian<T> adjoint;
+
+    for (auto _ : state) {
+        adjoint.adjointJacobian(jacobian, tape, true);
+        benchmark::DoNotOptimize(jacobian.data());
+        benchmark::ClobberMemory();
+    }
+    // The forward pass, then each operation is undone on two states and
+    // parametric ones also apply their generator
+    setThroughput<T>(state, 3 * ops.getSize() + ops.getNumParOps(),
+                     num_qubits);
+}
+
+/**
+ * @brief Get the largest number of qubits to benchmark, from the
+ * PL_BENCH_MAX_QUBITS environment variable and 30 by default.
+ */
+auto maxQubits() -> int64_t {
+    // NOLINTNEXTLINE(concurrency-mt-unsafe)
+    const char *env = std::getenv("PL_BENCH_MAX_QUBITS");
+    return (env == nullptr) ? 30 : std::strtol(env, nullptr, 10);
+}
+
+auto threadingName(Threading threading) -> std::string {
+    return (threading == Threading::MultiThread) ? "MultiThread"
+                                                 : "SingleThread";
+}
+
+template <class T> void registerCircuits() {
+    const auto qubits = benchmark::CreateDenseRange(12, maxQubits(), 2);
+    for (const auto threading :
+         {Threading::SingleThread, Threading::MultiThread}) {
+        const std::string suffix = "<" + std::string(precision_to_str<T>) +
+                                   ">/" + threadingName(threading);
+        const auto register_circuit = [&](const std::string &name,
+                                          auto make_circuit) {
+            benchmark::RegisterBenchmark((name + suffix).c_str(),
+                                         executeCircuit<T, decltype(
+                                                               make_circuit)>,
+                                         make_circuit, threading)
+                ->ArgsProduct({qubits})
+                ->Unit(benchmark::kMillisecond);
+        };
+        register_circuit("QFT", [](size_t n) { return qft<T>(n); });
+        register_circuit("QuantumVolume",
+                         [](size_t n) { return quantumVolume<T>(n); });
+        register_circuit("QAOA_MaxCut",
+                         [](size_t n) { return qaoaMaxCut<T>(n, 4); });
+        register_circuit("UCCSD", [](size_t n) { return uccsd<T>(n); });
+        benchmark::RegisterBenchmark(
+            ("HardwareEfficientAnsatz_Adjoint" + suffix).c_str(),
+            adjointHardwareEfficientAnsatz<T>, threading)
+            ->ArgsProduct({qubits})
+            ->Unit(benchmark::kMillisecond);
+    }
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    addCompileInfo();
+    addRuntimeInfo();
+    registerCircuits<float>();
+    registerCircuits<double>();
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
@@ -104,6 +104,15 @@ template <class T, class GateImplementation> void registerAllMatrices() {
     }
 }
 
+template <class T> void registerBandwidthProbe() {
+    const std::string name =
+        "BandwidthProbe<" + std::string(precision_to_str<T>) + ">/Memory";
+    benchmark::RegisterBenchmark(name.c_str(), bandwidthProbe<T>)
+        ->ArgsProduct({
+            benchmark::CreateDenseRange(6, 24, /*step=*/2), // num_qubits
+        });
+}
+
 template <typename TypeList, std::size_t... Is>
 void registerAllKernelsHelper(std::index_sequence<Is...>) {
     /* Gates */
@@ -125,6 +134,8 @@ void registerAllKernels() {
 int main(int argc, char **argv) {
     addCompileInfo();
     addRuntimeInfo();
+    registerBandwidthProbe<float>();
+    registerBandwidthProbe<double>();
     registerAllKernels();
 
     benchmark::Initialize(&argc, argv);
@@ -0,0 +1,266 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Measures.hpp"
+#include "SparseHamiltonian.hpp"
+#include "StateVectorManagedCPU.hpp"
+
+#include "Bench_Utils.hpp"
+
+using namespace Pennylane;
+
+namespace {
+/**
+ * @brief Create a statevector of normalized random amplitudes.
+ *
+ * @param num_qubits Number of qubits.
+ * @param threading Threading of the statevector.
+ */
+template <class T>
+auto randomStateVector(size_t num_qubits, Threading threading)
+    -> StateVectorManagedCPU<T> {
+    StateVectorManagedCPU<T> sv(num_qubits, threading);
+    std::mt19937_64 re{1337};
+    std::normal_distribution<T> dist;
+    std::complex<T> *data = sv.getData();
+    T norm{0};
+    for (size_t i = 0; i < sv.getLength(); i++) {
+        data[i] = {dist(re), dist(re)};
+        norm += std::norm(data[i]);
+    }
+    const T scale = 1 / std::sqrt(norm);
+    for (size_t i = 0; i < sv.getLength(); i++) {
+        data[i] *= scale;
+    }
+    return sv;
+}
+
+/**
+ * @brief Get observables named by the given names in turn, on successive
+ * wires.
+ */
+auto observables(const std::vector<std::string> &names, size_t num_obs,
+                 size_t num_qubits)
+    -> std::pair<std::vector<std::string>, std::vector<std::vector<size_t>>> {
+    std::vector<std::string> ops(num_obs);
+    std::vector<std::vector<size_t>> wires(num_obs);
+    for (size_t i = 0; i < num_obs; i++) {
+        ops[i] = names[i % names.size()];
+        wires[i] = {i % num_qubits};
+    }
+    return {ops, wires};
+}
+
+/**
+ * @brief Benchmark the probabilities of all basis states, for
+ * `state.range(0)` qubits and `state.range(1)` threads.
+ */
+template <class T> void probsAll(benchmark::State &state) {
+    resetPeakRSS();
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto sv = randomStateVector<T>(
+        num_qubits, useThreads(static_cast<size_t>(state.range(1))));
+    Measures<T, StateVectorManagedCPU<T>> measures(sv);
+    for (auto _ : state) {
+        auto probs = measures.probs();
+        benchmark::DoNotOptimize(probs.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(sv.getLength()));
+    addPeakRSS(state);
+}
+
+/**
+ * @brief Benchmark the marginal probabilities of `state.range(2)` wires,
+ * for `state.range(0)` qubits and `state.range(1)` threads.
+ */
+template <class T> void probsWires(benchmark::State &state) {
+    resetPeakRSS();
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto sv = randomStateVector<T>(
+        num_qubits, useThreads(static_cast<size_t>(state.range(1))));
+    std::vector<size_t> wires(static_cast<size_t>(state.range(2)));
+    std::iota(wires.begin(), wires.end(), size_t{0});
+    Measures<T, StateVectorManagedCPU<T>> measures(sv);
+    for (auto _ : state) {
+        auto probs = measures.probs(wires);
+        benchmark::DoNotOptimize(probs.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(sv.getLength()));
+    addPeakRSS(state);
+}
+
+/**
+ * @brief Benchmark sampling `state.range(2)` shots, for `state.range(0)`
+ * qubits and `state.range(1)` threads.
+ */
+template <class T> void generateSamples(benchmark::State &state) {
+    resetPeakRSS();
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto sv = randomStateVector<T>(
+        num_qubits, useThreads(static_cast<size_t>(state.range(1))));
+    const auto num_shots = static_cast<size_t>(state.range(2));
+    Measures<T, StateVectorManagedCPU<T>> measures(sv);
+    for (auto _ : state) {
+        auto samples = measures.generate_samples(num_shots, 1337);
+        benchmark::DoNotOptimize(samples.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(num_shots));
+    addPeakRSS(state);
+}
+
+/**
+ * @brief Benchmark the expected values of `state.range(2)` observables
+ * cycling through the given names, for `state.range(0)` qubits and
+ * `state.range(1)` threads.
+ */
+template <class T>
+void expvalObservables(benchmark::State &state,
+                       const std::vector<std::string> &names) {
+    resetPeakRSS();
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto sv = randomStateVector<T>(
+        num_qubits, useThreads(static_cast<size_t>(state.range(1))));
+    const auto [ops, wires] = observables(
+        names, static_cast<size_t>(state.range(2)), num_qubits);
+    Measures<T, StateVectorManagedCPU<T>> measures(sv);
+    for (auto _ : state) {
+        auto expvals = measures.expval(ops, wires);
+        benchmark::DoNotOptimize(expvals.data());
+    }
+    addPeakRSS(state);
+}
+
+/**
+ * @brief Benchmark the variances of `state.range(2)` observables cycling
+ * through the given names, for `state.range(0)` qubits and `state.range(1)`
+ * threads.
+ */
+template <class T>
+void varObservables(benchmark::State &state,
+                    const std::vector<std::string> &names) {
+    resetPeakRSS();
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto sv = randomStateVector<T>(
+        num_qubits, useThreads(static_cast<size_t>(state.range(1))));
+    const auto [ops, wires] = observables(
+        names, static_cast<size_t>(state.range(2)), num_qubits);
+    Measures<T, StateVectorManagedCPU<T>> measures(sv);
+    for (auto _ : state) {
+        auto vars = measures.var(ops, wires);
+        benchmark::DoNotOptimize(vars.data());
+    }
+    addPeakRSS(state);
+}
+
+/**
+ * @brief Benchmark the expected value of a sparse Hamiltonian with
+ * `state.range(2)` non-zero elements per row, for `state.range(0)` qubits
+ * and `state.range(1)` threads.
+ */
+template <class T> void expvalSparse(benchmark::State &state) {
+    resetPeakRSS();
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto sv = randomStateVector<T>(
+        num_qubits, useThreads(static_cast<size_t>(state.range(1))));
+    const auto num_rows = static_cast<long>(sv.getLength());
+    const auto per_row = static_cast<long>(state.range(2));
+
+    // Banded Hermitian matrix with periodic boundaries
+    std::vector<long> row_map(num_rows + 1, 0);
+    std::vector<long> entries;
+    std::vector<std::complex<T>> values;
+    for (long row = 0; row < num_rows; row++) {
+        const auto row_begin = static_cast<std::ptrdiff_t>(entries.size());
+        for (long k = 0; k < per_row; k++) {
+            entries.push_back((row + k - per_row / 2 + num_rows) % num_rows);
+        }
+        std::sort(entries.begin() + row_begin, entries.end());
+        for (auto col = entries.begin() + row_begin; col != entries.end();
+             ++col) {
+            values.emplace_back(*col == row ? 2 : -1, 0);
+        }
+        row_map[row + 1] = static_cast<long>(entries.size());
+    }
+    const SparseHamiltonian<T> hamiltonian(row_map, entries, values);
+
+    Measures<T, StateVectorManagedCPU<T>> measures(sv);
+    for (auto _ : state) {
+        auto expval = measures.expval(hamiltonian);
+        benchmark::DoNotOptimize(expval);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(values.size()));
+    addPeakRSS(state);
+}
+
+template <class T> void registerMeasures() {
+    const std::string precision = "<" + std::string(precision_to_str<T>) + ">";
+    const auto qubits = benchmark::CreateDenseRange(12, 26, 2);
+    const auto threads = threadCounts();
+
+    benchmark::RegisterBenchmark(("probs" + precision).c_str(), probsAll<T>)
+        ->ArgNames({"qubits", "threads"})
+        ->ArgsProduct({qubits, threads});
+    benchmark::RegisterBenchmark(("probs_wires" + precision).c_str(),
+                                 probsWires<T>)
+        ->ArgNames({"qubits", "threads", "wires"})
+        ->ArgsProduct({qubits, threads, {1, 4, 8}});
+    benchmark::RegisterBenchmark(("generate_samples" + precision).c_str(),
+                                 generateSamples<T>)
+        ->ArgNames({"qubits", "threads", "shots"})
+        ->ArgsProduct({qubits, threads, {1000, 100000}});
+    benchmark::RegisterBenchmark(("expval_pauli" + precision).c_str(),
+                                 expvalObservables<T>,
+                                 std::vector<std::string>{"PauliX", "PauliY",
+                                                          "PauliZ"})
+        ->ArgNames({"qubits", "threads", "observables"})
+        ->ArgsProduct({qubits, threads, {1, 8, 32}});
+    benchmark::RegisterBenchmark(("expval_hadamard" + precision).c_str(),
+                                 expvalObservables<T>,
+                                 std::vector<std::string>{"Hadamard"})
+        ->ArgNames({"qubits", "threads", "observables"})
+        ->ArgsProduct({qubits, threads, {1, 8, 32}});
+    benchmark::RegisterBenchmark(("var_pauli" + precision).c_str(),
+                                 varObservables<T>,
+                                 std::vector<std::string>{"PauliX", "PauliY",
+                                                          "PauliZ"})
+        ->ArgNames({"qubits", "threads", "observables"})
+        ->ArgsProduct({qubits, threads, {1, 8, 32}});
+    benchmark::RegisterBenchmark(("expval_sparse" + precision).c_str(),
+                                 expvalSparse<T>)
+        ->ArgNames({"qubits", "threads", "nnz_per_row"})
+        ->ArgsProduct({qubits, threads, {3, 9}});
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    addCompileInfo();
+    addRuntimeInfo();
+    registerMeasures<float>();
+    registerMeasures<double>();
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
@@ -0,0 +1,213 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Benchmarks of the fixed cost per call of the layers between the Python
+ * bindings and the kernels, for small statevectors. Each benchmark adds one
+ * layer to the previous one, so that the cost of a layer is the difference
+ * of their times. The Python layers are benchmarked by bench_overhead.py.
+ */
+#include <algorithm>
+#include <complex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Constant.hpp"
+#include "DynamicDispatcher.hpp"
+#include "JacobianTape.hpp"
+#include "Measures.hpp"
+#include "StateVectorRawCPU.hpp"
+#include "cpu_kernels/GateImplementationsLM.hpp"
+
+#include "Bench_Utils.hpp"
+
+using namespace Pennylane;
+
+namespace {
+/**
+ * @brief Names of the gates applied in turn by the benchmarks.
+ */
+const std::vector<std::string> gate_names{"RX", "RY", "RZ", "PhaseShift"};
+
+template <class T> auto zeroState(size_t num_qubits) {
+    std::vector<std::complex<T>> data(size_t{1U} << num_qubits);
+    data[0] = {1, 0};
+    return data;
+}
+
+/**
+ * @brief Benchmark the lookup of gate names in DynamicDispatcher.
+ */
+template <class T> void strToGateOp(benchmark::State &state) {
+    const auto &dispatcher = DynamicDispatcher<T>::getInstance();
+    size_t idx = 0;
+    for (auto _ : state) {
+        auto gate_op =
+            dispatcher.strToGateOp(gate_names[idx++ % gate_names.size()]);
+        benchmark::DoNotOptimize(gate_op);
+    }
+}
+
+/**
+ * @brief Benchmark calling a gate kernel directly, for `state.range(0)`
+ * qubits. This is the baseline of the benchmarks applying gates.
+ */
+template <class T> void applyKernel(benchmark::State &state) {
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    auto data = zeroState<T>(num_qubits);
+    const std::vector<size_t> wires{0};
+    for (auto _ : state) {
+        Gates::GateImplementationsLM::applyRX(data.data(), num_qubits, wires,
+                                              false, T{0.3});
+        benchmark::ClobberMemory();
+    }
+}
+
+/**
+ * @brief Benchmark applying a gate given by a GateOperation through
+ * DynamicDispatcher, for `state.range(0)` qubits.
+ */
+template <class T> void applyGateOp(benchmark::State &state) {
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    auto data = zeroState<T>(num_qubits);
+    StateVectorRawCPU<T> sv(data.data(), data.size(),
+                            Threading::SingleThread);
+    const std::vector<size_t> wires{0};
+    const std::vector<T> params{0.3};
+    for (auto _ : state) {
+        sv.applyOperation(Gates::GateOperation::RX, wires, false, params);
+        benchmark::ClobberMemory();
+    }
+}
+
+/**
+ * @brief Benchmark applying gates given by their names, for
+ * `state.range(0)` qubits.
+ */
+template <class T> void applyByName(benchmark::State &state) {
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    auto data = zeroState<T>(num_qubits);
+    StateVectorRawCPU<T> sv(data.data(), data.size(),
+                            Threading::SingleThread);
+    const std::vector<size_t> wires{0};
+    const std::vector<T> params{0.3};
+    size_t idx = 0;
+    for (auto _ : state) {
+        sv.applyOperation(gate_names[idx++ % gate_names.size()], wires, false,
+                          params);
+        benchmark::ClobberMemory();
+    }
+}
+
+/**
+ * @brief Benchmark converting a statevector of the other precision, as a
+ * forcecast binding argument does, for `state.range(0)` qubits.
+ */
+template <class T> void convertState(benchmark::State &state) {
+    using OtherT = std::conditional_t<std::is_same_v<T, float>, double, float>;
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    const auto data = zeroState<OtherT>(num_qubits);
+    for (auto _ : state) {
+        std::vector<std::complex<T>> converted(data.size());
+        std::transform(data.begin(), data.end(), converted.begin(),
+                       [](const std::complex<OtherT> &amp) {
+                           return std::complex<T>(amp);
+                       });
+        benchmark::DoNotOptimize(converted.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(data.size() *
+                                                 sizeof(std::complex<T>)));
+}
+
+/**
+ * @brief Benchmark wrapping a statevector and constructing Measures over
+ * it, as MeasuresC64 and MeasuresC128 do, for `state.range(0)` qubits.
+ */
+template <class T> void constructMeasures(benchmark::State &state) {
+    const auto num_qubits = static_cast<size_t>(state.range(0));
+    auto data = zeroState<T>(num_qubits);
+    for (auto _ : state) {
+        const StateVectorRawCPU<T> sv(data.data(), data.size());
+        Measures<T> measures(sv);
+        benchmark::DoNotOptimize(&measures);
+    }
+}
+
+/**
+ * @brief Benchmark constructing OpsData of `state.range(0)` operations, as
+ * OpsStructC64 and OpsStructC128 do.
+ */
+template <class T> void constructOpsData(benchmark::State &state) {
+    const auto num_ops = static_cast<size_t>(state.range(0));
+    std::vector<std::string> names(num_ops);
+    std::vector<std::vector<T>> params(num_ops, std::vector<T>{0.3});
+    std::vector<std::vector<size_t>> wires(num_ops);
+    for (size_t op = 0; op < num_ops; op++) {
+        names[op] = gate_names[op % gate_names.size()];
+        wires[op] = {op % 4};
+    }
+    const std::vector<bool> inverses(num_ops, false);
+    for (auto _ : state) {
+        Algorithms::OpsData<T> ops(names, params, wires, inverses);
+        benchmark::DoNotOptimize(&ops);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(num_ops));
+}
+
+template <class T> void registerOverhead() {
+    const std::string precision = "<" + std::string(precision_to_str<T>) + ">";
+    const auto qubits = benchmark::CreateDenseRange(4, 16, 4);
+
+    benchmark::RegisterBenchmark(("str_to_gate_op" + precision).c_str(),
+                                 strToGateOp<T>);
+    benchmark::RegisterBenchmark(("apply_kernel" + precision).c_str(),
+                                 applyKernel<T>)
+        ->ArgNames({"qubits"})
+        ->ArgsProduct({qubits});
+    benchmark::RegisterBenchmark(("apply_gate_op" + precision).c_str(),
+                                 applyGateOp<T>)
+        ->ArgNames({"qubits"})
+        ->ArgsProduct({qubits});
+    benchmark::RegisterBenchmark(("apply_by_name" + precision).c_str(),
+                                 applyByName<T>)
+        ->ArgNames({"qubits"})
+        ->ArgsProduct({qubits});
+    benchmark::RegisterBenchmark(("convert_state" + precision).c_str(),
+                                 convertState<T>)
+        ->ArgNames({"qubits"})
+        ->ArgsProduct({qubits});
+    benchmark::RegisterBenchmark(("construct_measures" + precision).c_str(),
+                                 constructMeasures<T>)
+        ->ArgNames({"qubits"})
+        ->ArgsProduct({qubits});
+    benchmark::RegisterBenchmark(("construct_ops_data" + precision).c_str(),
+                                 constructOpsData<T>)
+        ->ArgNames({"ops"})
+        ->ArgsProduct({{1, 16, 128}});
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    addCompileInfo();
+    addRuntimeInfo();
+    registerOverhead<float>();
+    registerOverhead<double>();
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
@@ -15,10 +15,20 @@
 #include "ConstantUtil.hpp"
 #include "Macros.hpp"
 #include "RuntimeInfo.hpp"
+#include "Threading.hpp"
 
 #include <benchmark/benchmark.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include <fstream>
 #include <string>
+#include <vector>
 
 /**
  * @brief A benchmark macro to register func<t>(...)
@@ -90,6 +100,11 @@ inline auto addCompileInfo() {
                                 std::to_string(Util::Constant::use_avx2));
     benchmark::AddCustomContext("Compiler::AVX512F",
                                 std::to_string(Util::Constant::use_avx512f));
+    benchmark::AddCustomContext("Compiler::NEON",
+                                std::to_string(Util::Constant::use_neon));
+    benchmark::AddCustomContext(
+        "Compiler::RuntimeDispatch",
+        std::to_string(Util::Constant::use_runtime_dispatch));
     benchmark::AddCustomContext(
         "Compiler::Version",
         std::string(
@@ -110,4 +125,86 @@ inline auto addRuntimeInfo() {
                                 std::string{boolToStr(RuntimeInfo::AVX2())});
     benchmark::AddCustomContext("CPU::AVX512F",
                                 std::string{boolToStr(RuntimeInfo::AVX512F())});
+    benchmark::AddCustomContext("CPU::NEON",
+                                std::string{boolToStr(RuntimeInfo::NEON())});
+    benchmark::AddCustomContext("CPU::SVE",
+                                std::string{boolToStr(RuntimeInfo::SVE())});
+}
+
+/**
+ * @brief Reset the peak resident set size of the process to the current
+ * one, so that the next addPeakRSS() reports the peak of a single benchmark.
+ * Only supported on Linux; elsewhere the peak is that of the process.
+ */
+inline void resetPeakRSS() {
+#if defined(__linux__)
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+#endif
+}
+
+/**
+ * @brief Get the peak resident set size of the process in MiB, or 0 if it
+ * is unavailable on the platform.
+ */
+inline auto peakRSSMiB() -> double {
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::stod(line.substr(6)) / 1024.0; // Given in kB
+        }
+    }
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+    return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#endif
+#else
+    return 0.0;
+#endif
+}
+
+/**
+ * @brief Report the peak resident set size since the last resetPeakRSS().
+ */
+inline void addPeakRSS(benchmark::State &state) {
+    state.counters["peak_rss_MiB"] = peakRSSMiB();
+}
+
+/**
+ * @brief Set the number of OpenMP threads and get the matching threading
+ * of statevectors.
+ *
+ * @param num_threads Number of threads.
+ */
+inline auto useThreads(size_t num_threads) -> Pennylane::Threading {
+#if defined(_OPENMP)
+    omp_set_num_threads(static_cast<int>(num_threads));
+#endif
+    return (num_threads > 1) ? Pennylane::Threading::MultiThread
+                             : Pennylane::Threading::SingleThread;
+}
+
+/**
+ * @brief Get the thread counts to benchmark, from 1 to the number of
+ * available threads in powers of two.
+ */
+inline auto threadCounts() -> std::vector<int64_t> {
+#if defined(_OPENMP)
+    const auto max_threads = static_cast<int64_t>(omp_get_max_threads());
+#else
+    const int64_t max_threads = 1;
+#endif
+    std::vector<int64_t> counts;
+    for (int64_t n = 1; n < max_threads; n *= 2) {
+        counts.push_back(n);
+    }
+    counts.push_back(max_threads);
+    return counts;
 }
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+# Copyright 2022 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Microbenchmarks of the fixed cost per call of the Python layers of
+lightning.qubit, for small statevectors.
+
+Each benchmark isolates one layer: pybind11 argument conversion, with and
+without a forcecast of the dtype, the construction of the ``StateVectorC*``,
+``MeasuresC*`` and ``OpsStructC*`` objects, the serialization of tapes in
+``_serialize.py``, and the whole device execution. The C++ layers below the
+bindings are benchmarked by ``bench_overhead``.
+"""
+import argparse
+import json
+import timeit
+
+import numpy as np
+import pennylane as qml
+
+from pennylane_lightning._serialize import _serialize_obs, _serialize_ops
+from pennylane_lightning.lightning_qubit_ops import (
+    AdjointJacobianC64,
+    AdjointJacobianC128,
+    MeasuresC64,
+    MeasuresC128,
+    StateVectorC64,
+    StateVectorC128,
+)
+
+CLASSES = {
+    "float": (np.complex64, StateVectorC64, MeasuresC64, AdjointJacobianC64),
+    "double": (np.complex128, StateVectorC128, MeasuresC128, AdjointJacobianC128),
+}
+
+
+def make_tape(num_qubits, num_gates):
+    """Tape of parametrized single-qubit gates cycling through the wires."""
+    gates = [qml.RX, qml.RY, qml.RZ]
+    with qml.tape.QuantumTape() as tape:
+        for k in range(num_gates):
+            gates[k % len(gates)](0.1 * k, wires=k % num_qubits)
+        qml.expval(qml.PauliZ(0))
+    tape.trainable_params = list(range(num_gates))
+    return tape
+
+
+def benchmarks(precision, num_qubits, num_gates):
+    """Get the benchmarks, as pairs of a name and a function to time."""
+    c_dtype, sv_class, measures_class, adjoint_class = CLASSES[precision]
+    other_dtype = np.complex128 if c_dtype == np.complex64 else np.complex64
+
+    state = np.zeros(2**num_qubits, dtype=c_dtype)
+    state[0] = 1
+    sv = sv_class(state)
+    matrix = np.array([[0, 1], [1, 0]], dtype=c_dtype)
+    matrix_other = matrix.astype(other_dtype)
+    tape = make_tape(num_qubits, num_gates)
+    wire_map = {w: w for w in range(num_qubits)}
+    ops_serialized, _ = _serialize_ops(tape, wire_map)
+    adjoint = adjoint_class()
+    dev = qml.device("lightning.qubit", wires=num_qubits, c_dtype=c_dtype)
+
+    return [
+        ("statevector_construct", lambda: sv_class(state)),
+        ("gate_by_name", lambda: sv.RX([0], False, [0.3])),
+        ("apply_matrix", lambda: sv.applyMatrix(matrix, [0], False)),
+        ("apply_matrix_forcecast", lambda: sv.applyMatrix(matrix_other, [0], False)),
+        ("measures_construct", lambda: measures_class(sv)),
+        ("measures_probs", lambda: measures_class(sv).probs([0])),
+        ("serialize_ops", lambda: _serialize_ops(tape, wire_map)),
+        (
+            "serialize_obs",
+            lambda: _serialize_obs(tape, wire_map, use_csingle=c_dtype == np.complex64),
+        ),
+        ("ops_struct_construct", lambda: adjoint.create_ops_list(*ops_serialized)),
+        ("device_execute", lambda: dev.execute(tape)),
+    ]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--qubits", type=int, nargs="+", default=[4, 8, 12, 16])
+    parser.add_argument("--gates", type=int, default=16, help="number of gates of the tapes")
+    parser.add_argument("--precision", choices=list(CLASSES), default="double")
+    parser.add_argument("--number", type=int, default=200, help="calls per repetition")
+    parser.add_argument("--repeat", type=int, default=7, help="number of repetitions")
+    parser.add_argument("--json", help="file to write the results to")
+    args = parser.parse_args()
+
+    results = []
+    print(f"{'benchmark':<26}{'qubits':>8}{'time per call (us)':>22}")
+    for num_qubits in args.qubits:
+        for name, func in benchmarks(args.precision, num_qubits, args.gates):
+            times = timeit.repeat(func, number=args.number, repeat=args.repeat)
+            per_call = min(times) / args.number * 1e6
+            results.append(
+                {
+                    "name": name,
+                    "precision": args.precision,
+                    "qubits": num_qubits,
+                    "gates": args.gates,
+                    "time_us": per_call,
+                }
+            )
+            print(f"{name:<26}{num_qubits:>8}{per_call:>22.3f}")
+
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as file:
+            json.dump(results, file, indent=2)
+
+
+if __name__ == "__main__":
+    main()
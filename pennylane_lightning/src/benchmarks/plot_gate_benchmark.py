@@ -19,9 +19,11 @@ class BenchmarkDataProcessor:
             raise ValueError("Argument precision must be one of None, float, or double")
         self.name_rgx = re_compile(r"^(\w+)<(\w+)>/(\w+)/(\d+)(/(\d+))?".format(precision))
         self.precision = precision
+        self.probe_name = "BandwidthProbe"
 
     def parse_result_json(self, filepath):
         parsed_data = defaultdict(list)
+        roofline_data = defaultdict(dict)
         with filepath.open("r") as jsonfile:
             all_data = json.load(jsonfile)
 
@@ -42,12 +44,21 @@ class BenchmarkDataProcessor:
                     timing_data = parsed_data[(op_name, kernel)]
                 else:
                     timing_data = parsed_data[(op_name, kernel)]
+                if "intensity" in d:
+                    roofline_data[(op_name, kernel)][int(num_qubits)] = (
+                        d["intensity"],
+                        d["flops"],
+                        d["bytes_per_second"],
+                    )
+                if op_name == self.probe_name:
+                    continue
                 timing_data.append([int(num_qubits), time])
 
         for k in parsed_data.keys():
             parsed_data[k].sort()
             parsed_data[k] = np.array(parsed_data[k])
         self.parsed_data = parsed_data
+        self.roofline_data = roofline_data
 
     def all_ops(self):
         return set(op_name for op_name, _ in self.parsed_data.keys())
@@ -84,6 +95,59 @@ class BenchmarkDataProcessor:
         plt.savefig(filepath)
         plt.close(fig)
 
+    def plot_roofline_to_file(self, filepath, num_qubits, peak_gflops=None):
+        """Plot the achieved FLOP/s of every operation and kernel against its
+        arithmetic intensity, under the memory bound measured by the bandwidth
+        probe for the same number of qubits."""
+        probes = {
+            kernel: data[num_qubits]
+            for (op_name, kernel), data in self.roofline_data.items()
+            if op_name == self.probe_name and num_qubits in data
+        }
+        if not probes:
+            raise ValueError(f"No bandwidth probe result for {num_qubits} qubits")
+        peak_bandwidth = max(bandwidth for _, _, bandwidth in probes.values())
+
+        points = defaultdict(list)
+        for (op_name, kernel), data in self.roofline_data.items():
+            if op_name == self.probe_name or num_qubits not in data:
+                continue
+            intensity, flops, _ = data[num_qubits]
+            if intensity > 0:
+                points[kernel].append((intensity, flops / 1e9, op_name))
+
+        fig, ax = plt.subplots(figsize=(8, 6))
+        all_intensities = [p[0] for kernel_points in points.values() for p in kernel_points]
+        if not all_intensities:
+            raise ValueError(f"No operation with FLOPs for {num_qubits} qubits")
+        intensities = np.logspace(
+            np.log10(min(all_intensities) / 2), np.log10(max(all_intensities) * 2), 100
+        )
+        roof = peak_bandwidth * intensities / 1e9
+        if peak_gflops:
+            roof = np.minimum(roof, peak_gflops)
+        ax.plot(
+            intensities,
+            roof,
+            "k-",
+            label=f"Memory bound ({peak_bandwidth / 1e9:.1f} GB/s)",
+        )
+
+        for kernel, kernel_points in sorted(points.items()):
+            xs, ys, names = zip(*kernel_points)
+            ax.scatter(xs, ys, label=kernel, s=12)
+            for x, y, name in kernel_points:
+                ax.annotate(name, (x, y), fontsize=5, alpha=0.7)
+
+        ax.legend()
+        ax.set_xscale("log")
+        ax.set_yscale("log")
+        ax.set_xlabel("Arithmetic intensity (FLOP/byte)")
+        ax.set_ylabel("Performance (GFLOP/s)")
+        ax.set_title(f"Roofline for {num_qubits} qubits")
+        plt.savefig(filepath, dpi=200)
+        plt.close(fig)
+
 
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(
@@ -100,6 +164,19 @@ if __name__ == "__main__":
     parser.add_argument(
         "--plot_dir", help="Output directory for plots", default="plots", metavar="DIR"
     )
+    parser.add_argument(
+        "--roofline_qubits",
+        help="Number of qubits of the roofline plot (default: the largest benchmarked)",
+        type=int,
+        default=None,
+        metavar="N",
+    )
+    parser.add_argument(
+        "--peak_gflops",
+        help="Peak compute throughput of the machine, drawn as the compute bound",
+        type=float,
+        default=None,
+    )
 
     args = parser.parse_args()
 
@@ -111,3 +188,17 @@ if __name__ == "__main__":
 
     for op_name in data_processor.all_ops():
         data_processor.plot_to_file(plot_dir.joinpath(f"{op_name}.png"), f"{op_name}")
+
+    probe_qubits = [
+        num_qubits
+        for (op_name, _), data in data_processor.roofline_data.items()
+        if op_name == data_processor.probe_name
+        for num_qubits in data
+    ]
+    if probe_qubits:
+        roofline_qubits = args.roofline_qubits or max(probe_qubits)
+        data_processor.plot_roofline_to_file(
+            plot_dir.joinpath(f"roofline_{roofline_qubits}.png"),
+            roofline_qubits,
+            args.peak_gflops,
+        )
@@ -17,9 +17,23 @@
  */
 #include "Bindings.hpp"
 
+#include "AdjointDiffFixedWeight.hpp"
 #include "GateUtil.hpp"
+#include "MatrixProductState.hpp"
 #include "SelectKernel.hpp"
+#include "StateVectorCompressedCPU.hpp"
+#include "StateVectorFixedWeightCPU.hpp"
+#include "StateVectorIO.hpp"
 #include "StateVectorManagedCPU.hpp"
+#include "StateVectorOutOfCoreCPU.hpp"
+#include "StateVectorSparseCPU.hpp"
+#include "StateVectorSplitCPU.hpp"
+#include "TapeExecutor.hpp"
+
+#if defined(_ENABLE_KOKKOS)
+#include "AdjointDiffKokkos.hpp"
+#include "StateVectorKokkos.hpp"
+#endif
 
 #include "pybind11/pybind11.h"
 
@@ -28,7 +42,17 @@ namespace {
 using namespace Pennylane::Algorithms;
 using namespace Pennylane::Gates;
 
+using Pennylane::MatrixProductState;
+using Pennylane::PauliSum;
+using Pennylane::SparseHamiltonian;
+using Pennylane::ChunkCompression;
+using Pennylane::StateVectorCompressedCPU;
+using Pennylane::StateVectorFixedWeightCPU;
+using Pennylane::StateVectorManagedCPU;
+using Pennylane::StateVectorOutOfCoreCPU;
 using Pennylane::StateVectorRawCPU;
+using Pennylane::StateVectorSparseCPU;
+using Pennylane::StateVectorSplitCPU;
 
 using std::complex;
 using std::string;
@@ -38,6 +62,17 @@ using std::vector;
 
 namespace py = pybind11;
 
+/**
+ * @brief Get the data of a statevector in the canonical order, after
+ * applying its pending operations and undoing lazy SWAP gates.
+ *
+ * @param sv Statevector.
+ */
+template <class SVType> auto canonicalData(SVType &sv) {
+    sv.canonicalizeWires();
+    return std::as_const(sv).getData();
+}
+
 /**
  * @brief Templated class to build all required precisions for Python module.
  *
@@ -68,18 +103,282 @@ void lightning_class_bindings(py::module_ &m) {
     std::string class_name = "StateVectorC" + bitsize;
     auto pyclass = py::class_<StateVectorRawCPU<PrecisionT>>(
         m, class_name.c_str(), py::module_local());
-    pyclass.def(py::init(&createRaw<PrecisionT>));
+    // The statevector shares the data of the array, which must stay alive
+    pyclass.def(py::init(&createRaw<PrecisionT>), py::arg("data").noconvert(),
+                py::keep_alive<1, 2>());
+    pyclass.def_static("from_dlpack", &stateVectorFromDLPack<PrecisionT>,
+                       py::arg("tensor"),
+                       "Create a statevector sharing the data of a DLPack "
+                       "tensor, e.g. a JAX array or a PyTorch tensor, "
+                       "without copying it.");
+    registerDLPackForStateVector<StateVectorRawCPU<PrecisionT>>(pyclass);
+    pyclass.def_static(
+        "map_file",
+        [](const std::string &path, bool read_only, size_t length) {
+            return StateVectorRawCPU<PrecisionT>(
+                Pennylane::Util::MappedMemory::mapFile(
+                    path,
+                    read_only ? Pennylane::Util::MapAccess::ReadOnly
+                              : Pennylane::Util::MapAccess::ReadWrite,
+                    length * sizeof(std::complex<PrecisionT>)));
+        },
+        py::arg("path"), py::arg("read_only") = true, py::arg("length") = 0,
+        "Map a statevector stored in a file. A writable file is created or "
+        "extended to hold length amplitudes. Read-only statevectors can be "
+        "measured but not modified.");
+    pyclass.def_static(
+        "map_shared_memory",
+        [](const std::string &name, bool read_only, size_t length) {
+            return StateVectorRawCPU<PrecisionT>(
+                Pennylane::Util::MappedMemory::mapSharedMemory(
+                    name,
+                    read_only ? Pennylane::Util::MapAccess::ReadOnly
+                              : Pennylane::Util::MapAccess::ReadWrite,
+                    length * sizeof(std::complex<PrecisionT>)));
+        },
+        py::arg("name"), py::arg("read_only") = true, py::arg("length") = 0,
+        "Map a statevector stored in a POSIX shared memory segment, so that "
+        "processes on a node share one copy.");
+    pyclass.def_static("unlink_shared_memory",
+                       &Pennylane::Util::MappedMemory::unlinkSharedMemory,
+                       "Remove a POSIX shared memory segment.");
+    pyclass.def("is_read_only", &StateVectorRawCPU<PrecisionT>::isReadOnly,
+                "Check whether the statevector is mapped read-only.");
+    pyclass.def(
+        "save",
+        [](StateVectorRawCPU<PrecisionT> &sv, const std::string &path,
+           bool compress) {
+            sv.canonicalizeWires();
+            saveStateVector(sv, path,
+                            compress ? StateVectorCompression::Zlib
+                                     : StateVectorCompression::None);
+        },
+        py::arg("path"), py::arg("compress") = false,
+        py::call_guard<py::gil_scoped_release>(),
+        "Save the statevector to a binary file.");
+    pyclass.def(
+        "load",
+        [](StateVectorRawCPU<PrecisionT> &sv, const std::string &path) {
+            loadStateVector(path, sv);
+        },
+        py::call_guard<py::gil_scoped_release>(),
+        "Load a statevector saved with the same number of qubits and "
+        "precision into the bound array.");
 
     registerGatesForStateVector<PrecisionT, ParamT,
                                 StateVectorRawCPU<PrecisionT>>(pyclass);
 
     pyclass.def("kernel_map", &svKernelMap<PrecisionT>,
                 "Get internal kernels for operations");
+    pyclass.def_static("dispatch_profile", &dispatchProfile<PrecisionT>,
+                       "Get the calls, time and bytes touched of dispatched "
+                       "operations per operation, kernel and number of "
+                       "qubits.");
+    pyclass.def_static(
+        "reset_dispatch_profile",
+        [] { DispatchProfiler<PrecisionT>::getInstance().reset(); },
+        "Clear the profile of dispatched operations.");
+    pyclass.def("setMaxFusedWires",
+                &StateVectorRawCPU<PrecisionT>::setMaxFusedWires,
+                "Set the maximum number of wires of a fused gate (0 disables "
+                "gate fusion).");
+    pyclass.def("getMaxFusedWires",
+                &StateVectorRawCPU<PrecisionT>::getMaxFusedWires,
+                "Get the maximum number of wires of a fused gate.");
+    pyclass.def("setLayerScheduling",
+                &StateVectorRawCPU<PrecisionT>::setLayerScheduling,
+                "Enable or disable applying the single-qubit gates of each "
+                "layer of disjoint gates as tensor products.");
+    pyclass.def("getLayerScheduling",
+                &StateVectorRawCPU<PrecisionT>::getLayerScheduling,
+                "Check whether operations are scheduled into layers.");
+    pyclass.def("setCacheBlockQubits",
+                &StateVectorRawCPU<PrecisionT>::setCacheBlockQubits,
+                "Set the number of qubits of a cache tile (0 disables cache "
+                "blocking).");
+    pyclass.def("getCacheBlockQubits",
+                &StateVectorRawCPU<PrecisionT>::getCacheBlockQubits,
+                "Get the number of qubits of a cache tile.");
+    pyclass.def("setLazySwaps", &StateVectorRawCPU<PrecisionT>::setLazySwaps,
+                "Enable or disable relabelling the wires for SWAP gates.");
+    pyclass.def("getLazySwaps", &StateVectorRawCPU<PrecisionT>::getLazySwaps,
+                "Check whether SWAP gates relabel the wires.");
+    pyclass.def("getWireMap", &StateVectorRawCPU<PrecisionT>::getWireMap,
+                "Get the physical wire of the data holding each wire.");
+    pyclass.def("setDeferredExecution",
+                &StateVectorRawCPU<PrecisionT>::setDeferredExecution,
+                py::call_guard<py::gil_scoped_release>(),
+                "Enable or disable recording gates until the data is "
+                "needed.");
+    pyclass.def("getDeferredExecution",
+                &StateVectorRawCPU<PrecisionT>::getDeferredExecution,
+                "Check whether gates are recorded until the data is needed.");
+    pyclass.def("flushOperations",
+                &StateVectorRawCPU<PrecisionT>::flushOperations,
+                py::call_guard<py::gil_scoped_release>(),
+                "Apply the recorded gates to the statevector.");
+    pyclass.def("beginCliffordPrefix",
+                &StateVectorRawCPU<PrecisionT>::beginCliffordPrefix,
+                py::call_guard<py::gil_scoped_release>(),
+                "Simulate the following Clifford gates by a stabilizer "
+                "tableau if the data holds a computational basis state.");
+    pyclass.def("inCliffordPrefix",
+                &StateVectorRawCPU<PrecisionT>::inCliffordPrefix,
+                "Check whether Clifford gates are simulated by a stabilizer "
+                "tableau.");
+    pyclass.def("canonicalizeWires",
+                &StateVectorRawCPU<PrecisionT>::canonicalizeWires,
+                py::call_guard<py::gil_scoped_release>(),
+                "Move the data to the order where each wire holds itself.");
+    pyclass.def("measureWire", &StateVectorRawCPU<PrecisionT>::measureWire,
+                py::call_guard<py::gil_scoped_release>(),
+                "Measure a wire in the computational basis given a uniform "
+                "random number in [0, 1) and collapse the statevector.");
+    pyclass.def("collapse", &StateVectorRawCPU<PrecisionT>::collapse,
+                py::call_guard<py::gil_scoped_release>(),
+                "Postselect an outcome of a wire and return its probability.");
+    pyclass.def("resetWire", &StateVectorRawCPU<PrecisionT>::resetWire,
+                py::call_guard<py::gil_scoped_release>(),
+                "Measure a wire and reset it to 0, returning the outcome.");
+    pyclass.def("setBasisState",
+                &StateVectorRawCPU<PrecisionT>::setBasisState,
+                py::call_guard<py::gil_scoped_release>(),
+                "Prepare a computational basis state in place.");
+    pyclass.def(
+        "setStateVector",
+        [](StateVectorRawCPU<PrecisionT> &sv, const np_arr_c &state,
+           const std::vector<size_t> &wires) {
+            PL_ABORT_IF(static_cast<size_t>(state.size()) !=
+                            Util::exp2(wires.size()),
+                        "The size of the state does not match with the given "
+                        "number of wires");
+            const auto *state_ptr =
+                static_cast<const std::complex<PrecisionT> *>(
+                    state.request().ptr);
+            const py::gil_scoped_release release;
+            sv.setStateVector(state_ptr, wires);
+        },
+        "Prepare a state of the given wires in place, with all other wires "
+        "in state 0.");
+    pyclass.def(
+        "getAmplitudes",
+        [](StateVectorRawCPU<PrecisionT> &sv,
+           const std::vector<size_t> &indices) {
+            return moveToNumpyArray(
+                withoutGIL([&] { return sv.getAmplitudes(indices); }));
+        },
+        "Get the amplitudes of the given basis states without copying the "
+        "statevector.");
+    pyclass.def(
+        "overlap",
+        [](StateVectorRawCPU<PrecisionT> &sv,
+           StateVectorRawCPU<PrecisionT> &other) {
+            return overlap(sv, other);
+        },
+        py::call_guard<py::gil_scoped_release>(),
+        "Compute the overlap <self|other> with another statevector.");
+    pyclass.def(
+        "fidelity",
+        [](StateVectorRawCPU<PrecisionT> &sv,
+           StateVectorRawCPU<PrecisionT> &other) {
+            return fidelity(sv, other);
+        },
+        py::call_guard<py::gil_scoped_release>(),
+        "Compute the fidelity |<self|other>|^2 with another normalized "
+        "statevector.");
+    pyclass.def("setThreadingConfig",
+                &StateVectorRawCPU<PrecisionT>::setThreadingConfig,
+                "Set the threads used by the kernels applied to the "
+                "statevector.");
+    pyclass.def("getThreadingConfig",
+                &StateVectorRawCPU<PrecisionT>::getThreadingConfig,
+                "Get the threading configuration.");
+    pyclass.def(
+        "apply_sparse_matrix",
+        [](StateVectorRawCPU<PrecisionT> &sv, const np_arr_sparse_ind &row_map,
+           const np_arr_sparse_ind &entries, const np_arr_c &values) {
+            auto *row_map_ptr =
+                static_cast<sparse_index_type *>(row_map.request().ptr);
+            const auto row_map_size =
+                static_cast<sparse_index_type>(row_map.request().size);
+            auto *entries_ptr =
+                static_cast<sparse_index_type *>(entries.request().ptr);
+            auto *values_ptr =
+                static_cast<std::complex<PrecisionT> *>(values.request().ptr);
+            const auto values_size =
+                static_cast<sparse_index_type>(values.request().size);
+            const py::gil_scoped_release release;
+            sv.applySparseMatrix(row_map_ptr, row_map_size, entries_ptr,
+                                 values_ptr, values_size);
+        },
+        "Apply a sparse matrix in the CSR format to the statevector.");
+
+    class_name = "StateVectorManagedC" + bitsize;
+    auto pyclass_managed = py::class_<StateVectorManagedCPU<PrecisionT>>(
+        m, class_name.c_str(), py::buffer_protocol(), py::module_local());
+    pyclass_managed.def(py::init<size_t>());
+    pyclass_managed.def(py::init(&createManaged<PrecisionT>));
+    registerDLPackForStateVector<StateVectorManagedCPU<PrecisionT>>(
+        pyclass_managed);
+
+    registerGatesForStateVector<PrecisionT, ParamT,
+                                StateVectorManagedCPU<PrecisionT>>(
+        pyclass_managed);
+
+    /* Expose the data as a buffer, so that numpy.asarray is a view */
+    pyclass_managed.def_buffer([](StateVectorManagedCPU<PrecisionT> &sv) {
+        sv.canonicalizeWires();
+        return py::buffer_info(sv.getData(), sizeof(std::complex<PrecisionT>),
+                               py::format_descriptor<
+                                   std::complex<PrecisionT>>::format(),
+                               1, {sv.getLength()},
+                               {sizeof(std::complex<PrecisionT>)});
+    });
+    pyclass_managed.def(
+        "save",
+        [](StateVectorManagedCPU<PrecisionT> &sv, const std::string &path,
+           bool compress) {
+            sv.canonicalizeWires();
+            saveStateVector(sv, path,
+                            compress ? StateVectorCompression::Zlib
+                                     : StateVectorCompression::None);
+        },
+        py::arg("path"), py::arg("compress") = false,
+        py::call_guard<py::gil_scoped_release>(),
+        "Save the statevector to a binary file.");
+    pyclass_managed.def_static(
+        "load",
+        [](const std::string &path) {
+            return loadStateVector<PrecisionT>(path);
+        },
+        py::call_guard<py::gil_scoped_release>(),
+        "Load a saved statevector.");
 
     //***********************************************************************//
     //                              Observable
     //***********************************************************************//
 
+    class_name = "SparseHamiltonianC" + bitsize;
+    py::class_<SparseHamiltonian<PrecisionT>>(m, class_name.c_str(),
+                                              py::module_local())
+        .def(py::init([](const np_arr_sparse_ind &row_map,
+                         const np_arr_sparse_ind &entries,
+                         const np_arr_c &values) {
+                 const auto *row_map_ptr =
+                     static_cast<sparse_index_type *>(row_map.request().ptr);
+                 const auto *entries_ptr =
+                     static_cast<sparse_index_type *>(entries.request().ptr);
+                 const auto *values_ptr = static_cast<std::complex<ParamT> *>(
+                     values.request().ptr);
+                 return SparseHamiltonian<PrecisionT>(
+                     {row_map_ptr, row_map_ptr + row_map.size()},
+                     {entries_ptr, entries_ptr + entries.size()},
+                     {values_ptr, values_ptr + values.size()});
+             }),
+             "Build a Hamiltonian once from a sparse matrix in the CSR "
+             "format, to measure it repeatedly.")
+        .def("get_num_qubits", &SparseHamiltonian<PrecisionT>::getNumQubits);
+
     class_name = "ObsStructC" + bitsize;
     using obs_data_var = std::variant<std::monostate, np_arr_r, np_arr_c>;
     py::class_<ObsDatum<PrecisionT>>(m, class_name.c_str(), py::module_local())
@@ -118,6 +417,38 @@ void lightning_class_bindings(py::module_ &m) {
             }
             return ObsDatum<PrecisionT>(names, conv_params, wires);
         }))
+        .def(py::init([](const std::vector<ParamT> &coeffs,
+                         const std::vector<std::string> &words,
+                         const std::vector<std::vector<size_t>> &wires) {
+                 return ObsDatum<PrecisionT>(
+                     PauliSum<PrecisionT>(coeffs, words, wires));
+             }),
+             "Construct a Hamiltonian observable from coefficients and Pauli "
+             "words.")
+        .def_static(
+            "sparse_hamiltonian",
+            [](const np_arr_sparse_ind &row_map,
+               const np_arr_sparse_ind &entries, const np_arr_c &values) {
+                const auto *row_map_ptr =
+                    static_cast<sparse_index_type *>(row_map.request().ptr);
+                const auto *entries_ptr =
+                    static_cast<sparse_index_type *>(entries.request().ptr);
+                const auto *values_ptr = static_cast<std::complex<ParamT> *>(
+                    values.request().ptr);
+                return ObsDatum<PrecisionT>(SparseHamiltonian<PrecisionT>(
+                    {row_map_ptr, row_map_ptr + row_map.size()},
+                    {entries_ptr, entries_ptr + entries.size()},
+                    {values_ptr, values_ptr + values.size()}));
+            },
+            "Construct a Hamiltonian observable from a sparse matrix in the "
+            "CSR format.")
+        .def_static(
+            "sparse_hamiltonian",
+            [](const SparseHamiltonian<PrecisionT> &hamiltonian) {
+                return ObsDatum<PrecisionT>(hamiltonian);
+            },
+            "Construct a Hamiltonian observable from a prebuilt sparse "
+            "Hamiltonian.")
         .def("__repr__",
              [](const ObsDatum<PrecisionT> &obs) {
                  using namespace Pennylane::Util;
@@ -175,6 +506,13 @@ void lightning_class_bindings(py::module_ &m) {
              const std::vector<std::vector<size_t>> &,
              const std::vector<bool> &,
              const std::vector<std::vector<std::complex<PrecisionT>>> &>())
+        .def(py::init<
+             const std::vector<std::string> &,
+             const std::vector<std::vector<ParamT>> &,
+             const std::vector<std::vector<size_t>> &,
+             const std::vector<bool> &,
+             const std::vector<std::vector<std::complex<PrecisionT>>> &,
+             const std::vector<std::vector<std::complex<PrecisionT>>> &>())
         .def("__repr__", [](const OpsData<PrecisionT> &ops) {
             using namespace Pennylane::Util;
             std::ostringstream ops_stream;
@@ -194,60 +532,392 @@ void lightning_class_bindings(py::module_ &m) {
     //                              Adjoint Jacobian
     //***********************************************************************//
 
+    // Convert serialized operations. Matrices and generators are empty
+    // arrays, and Pauli words empty strings, for the operations which do not
+    // need them.
+    const auto create_ops_list =
+        [](const std::vector<std::string> &ops_name,
+           const std::vector<np_arr_r> &ops_params,
+           const std::vector<std::vector<size_t>> &ops_wires,
+           const std::vector<bool> &ops_inverses,
+           const std::vector<np_arr_c> &ops_matrices,
+           const std::vector<np_arr_c> &ops_generators,
+           const std::vector<std::string> &ops_pauli_words) {
+            const auto to_vector = [](const auto &arr) {
+                using value_t =
+                    typename std::decay_t<decltype(arr)>::value_type;
+                const auto buffer = arr.request();
+                const auto *const ptr =
+                    static_cast<const value_t *>(buffer.ptr);
+                return std::vector<value_t>{ptr, ptr + buffer.size};
+            };
+            std::vector<std::vector<PrecisionT>> conv_params(ops_params.size());
+            std::vector<std::vector<std::complex<PrecisionT>>> conv_matrices(
+                ops_matrices.size());
+            std::vector<std::vector<std::complex<PrecisionT>>> conv_generators(
+                ops_name.size());
+            PL_ABORT_IF(!ops_generators.empty() &&
+                            ops_generators.size() != ops_name.size(),
+                        "Generators must be given for all operations.");
+            PL_ABORT_IF(!ops_pauli_words.empty() &&
+                            ops_pauli_words.size() != ops_name.size(),
+                        "Pauli words must be given for all operations.");
+            for (size_t op = 0; op < ops_name.size(); op++) {
+                conv_params[op] = to_vector(ops_params[op]);
+                conv_matrices[op] = to_vector(ops_matrices[op]);
+                if (!ops_generators.empty()) {
+                    conv_generators[op] = to_vector(ops_generators[op]);
+                }
+            }
+            return OpsData<PrecisionT>{ops_name,        conv_params,
+                                       ops_wires,       ops_inverses,
+                                       conv_matrices,   conv_generators,
+                                       {},              ops_pauli_words};
+        };
+
+    class_name = "AsyncResultC" + bitsize;
+    py::class_<AsyncResult<PrecisionT>>(m, class_name.c_str(),
+                                        py::module_local())
+        .def("done", &AsyncResult<PrecisionT>::done,
+             "Check if the result is ready, without blocking.")
+        .def("result", &AsyncResult<PrecisionT>::result,
+             "Wait for the result and return it. The result can be "
+             "retrieved once.");
+
     class_name = "AdjointJacobianC" + bitsize;
     py::class_<AdjointJacobian<PrecisionT>>(m, class_name.c_str(),
                                             py::module_local())
         .def(py::init<>())
-        .def("create_ops_list",
+        .def("set_parallelism", &AdjointJacobian<PrecisionT>::setParallelism,
+             "Set the parallelisation strategy of the backward pass.")
+        .def("get_parallelism", &AdjointJacobian<PrecisionT>::getParallelism,
+             "Get the parallelisation strategy of the backward pass.")
+        .def("set_checkpoint_interval",
+             &AdjointJacobian<PrecisionT>::setCheckpointInterval,
+             "Set the number of operations between checkpoints of the "
+             "forward pass. 0 disables checkpointing.")
+        .def("get_checkpoint_interval",
+             &AdjointJacobian<PrecisionT>::getCheckpointInterval,
+             "Get the number of operations between checkpoints of the "
+             "forward pass.")
+        .def("set_threading_config",
+             &AdjointJacobian<PrecisionT>::setThreadingConfig,
+             "Set the threads used by the adjoint method.")
+        .def("get_threading_config",
+             &AdjointJacobian<PrecisionT>::getThreadingConfig,
+             "Get the threading configuration.")
+        .def(
+            "create_ops_list",
+            [create_ops_list](AdjointJacobian<PrecisionT> &adj,
+                              const std::vector<std::string> &ops_name,
+                              const std::vector<np_arr_r> &ops_params,
+                              const std::vector<std::vector<size_t>> &ops_wires,
+                              const std::vector<bool> &ops_inverses,
+                              const std::vector<np_arr_c> &ops_matrices,
+                              const std::vector<np_arr_c> &ops_generators,
+                              const std::vector<std::string> &ops_pauli_words) {
+                static_cast<void>(adj);
+                return create_ops_list(ops_name, ops_params, ops_wires,
+                                       ops_inverses, ops_matrices,
+                                       ops_generators, ops_pauli_words);
+            },
+            py::arg("ops_name"), py::arg("ops_params"), py::arg("ops_wires"),
+            py::arg("ops_inverses"), py::arg("ops_matrices"),
+            py::arg("ops_generators") = std::vector<np_arr_c>{},
+            py::arg("ops_pauli_words") = std::vector<std::string>{})
+        .def("adjoint_jacobian",
+             static_cast<void (AdjointJacobian<PrecisionT>::*)(
+                 std::vector<PrecisionT> &, const JacobianData<PrecisionT> &,
+                 bool)>(&AdjointJacobian<PrecisionT>::adjointJacobian),
+             py::call_guard<py::gil_scoped_release>())
+        .def("adjoint_jacobian",
              [](AdjointJacobian<PrecisionT> &adj,
-                const std::vector<std::string> &ops_name,
-                const std::vector<np_arr_r> &ops_params,
-                const std::vector<std::vector<size_t>> &ops_wires,
-                const std::vector<bool> &ops_inverses,
-                const std::vector<np_arr_c> &ops_matrices) {
-                 std::vector<std::vector<PrecisionT>> conv_params(
-                     ops_params.size());
-                 std::vector<std::vector<std::complex<PrecisionT>>>
-                     conv_matrices(ops_matrices.size());
-                 static_cast<void>(adj);
-                 for (size_t op = 0; op < ops_name.size(); op++) {
-                     const auto p_buffer = ops_params[op].request();
-                     const auto m_buffer = ops_matrices[op].request();
-                     if (p_buffer.size) {
-                         const auto *const p_ptr =
-                             static_cast<const ParamT *>(p_buffer.ptr);
-                         conv_params[op] =
-                             std::vector<ParamT>{p_ptr, p_ptr + p_buffer.size};
-                     }
-                     if (m_buffer.size) {
-                         const auto m_ptr =
-                             static_cast<const std::complex<ParamT> *>(
-                                 m_buffer.ptr);
-                         conv_matrices[op] = std::vector<std::complex<ParamT>>{
-                             m_ptr, m_ptr + m_buffer.size};
-                     }
-                 }
-                 return OpsData<PrecisionT>{ops_name, conv_params, ops_wires,
-                                            ops_inverses, conv_matrices};
+                StateVectorRawCPU<PrecisionT> &sv,
+                const std::vector<ObsDatum<PrecisionT>> &observables,
+                const OpsData<PrecisionT> &operations,
+                const std::vector<size_t> &trainableParams, size_t num_params) {
+                 std::vector<PrecisionT> jac(observables.size() * num_params,
+                                             0);
+
+                 const JacobianData<PrecisionT> jd{
+                     num_params,  sv.getLength(), canonicalData(sv),
+                     observables, operations,     trainableParams};
+
+                 withoutGIL([&] { adj.adjointJacobian(jac, jd); });
+
+                 return moveToNumpyArray(std::move(jac));
              })
-        .def("adjoint_jacobian", &AdjointJacobian<PrecisionT>::adjointJacobian)
         .def("adjoint_jacobian",
              [](AdjointJacobian<PrecisionT> &adj,
-                const StateVectorRawCPU<PrecisionT> &sv,
+                StateVectorRawCPU<PrecisionT> &sv,
                 const std::vector<ObsDatum<PrecisionT>> &observables,
                 const OpsData<PrecisionT> &operations,
-                const std::vector<size_t> &trainableParams, size_t num_params) {
+                const std::vector<size_t> &trainableParams, size_t num_params,
+                size_t max_memory_bytes) {
                  std::vector<PrecisionT> jac(observables.size() * num_params,
                                              0);
 
                  const JacobianData<PrecisionT> jd{
-                     num_params,  sv.getLength(), sv.getData(),
+                     num_params,  sv.getLength(), canonicalData(sv),
                      observables, operations,     trainableParams};
 
-                 adj.adjointJacobian(jac, jd);
+                 withoutGIL([&] {
+                     adj.adjointJacobian(jac, jd, false, max_memory_bytes);
+                 });
 
-                 return py::array_t<ParamT>(py::cast(jac));
-             });
+                 return moveToNumpyArray(std::move(jac));
+             },
+             "Compute the Jacobian with statevectors bounded by "
+             "max_memory_bytes.")
+        .def(
+            "adjoint_jacobian",
+            [](AdjointJacobian<PrecisionT> &adj,
+               StateVectorManagedCPU<PrecisionT> &sv,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams, size_t num_params) {
+                std::vector<PrecisionT> jac(observables.size() * num_params,
+                                            0);
+
+                sv.canonicalizeWires();
+                const JacobianData<PrecisionT> jd{num_params, sv, observables,
+                                                  operations, trainableParams};
+
+                withoutGIL([&] { adj.adjointJacobian(jac, jd); });
+
+                return moveToNumpyArray(std::move(jac));
+            },
+            "Compute the Jacobian using a managed statevector as the working "
+            "state instead of a copy. The statevector is overwritten.")
+        .def(
+            "adjoint_vjp",
+            [](AdjointJacobian<PrecisionT> &adj,
+               StateVectorRawCPU<PrecisionT> &sv,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams, size_t num_params,
+               const std::vector<PrecisionT> &dy) {
+                std::vector<PrecisionT> vjp(num_params, 0);
+
+                const JacobianData<PrecisionT> jd{
+                    num_params,  sv.getLength(), canonicalData(sv),
+                    observables, operations,     trainableParams};
+
+                withoutGIL([&] { adj.adjointVJP(vjp, jd, dy); });
+
+                return moveToNumpyArray(std::move(vjp));
+            },
+            "Compute the vector-Jacobian product with a single backward "
+            "pass.")
+        .def(
+            "adjoint_probs_jacobian",
+            [](AdjointJacobian<PrecisionT> &adj,
+               StateVectorRawCPU<PrecisionT> &sv,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams, size_t num_params,
+               const std::vector<size_t> &wires) {
+                const size_t num_outcomes = Util::exp2(wires.size());
+                std::vector<PrecisionT> jac(num_outcomes * num_params, 0);
+
+                const JacobianData<PrecisionT> jd{
+                    num_params, sv.getLength(), canonicalData(sv), {},
+                    operations, trainableParams};
+
+                withoutGIL([&] { adj.adjointProbsJacobian(jac, jd, wires); });
+
+                return moveToNumpyArray(std::move(jac),
+                                        {num_outcomes, num_params});
+            },
+            "Compute the Jacobian of the marginal probabilities of the wires "
+            "with a constant number of statevectors.")
+        .def(
+            "hessian_vector_product",
+            [](AdjointJacobian<PrecisionT> &adj,
+               StateVectorRawCPU<PrecisionT> &sv,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams,
+               const std::vector<PrecisionT> &v) {
+                std::vector<PrecisionT> hvp(
+                    observables.size() * trainableParams.size(), 0);
+
+                const JacobianData<PrecisionT> jd{
+                    trainableParams.size(), sv.getLength(), canonicalData(sv),
+                    observables,            operations,     trainableParams};
+
+                withoutGIL([&] { adj.hessianVectorProduct(hvp, jd, v); });
+
+                return moveToNumpyArray(std::move(hvp));
+            },
+            "Compute the Hessian-vector product of each observable, "
+            "applying the operations to the statevector.")
+        .def(
+            "adjoint_hessian",
+            [](AdjointJacobian<PrecisionT> &adj,
+               StateVectorRawCPU<PrecisionT> &sv,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams) {
+                const size_t num_params = trainableParams.size();
+                std::vector<PrecisionT> hess(
+                    observables.size() * num_params * num_params, 0);
+
+                const JacobianData<PrecisionT> jd{
+                    num_params,  sv.getLength(), canonicalData(sv),
+                    observables, operations,     trainableParams};
+
+                withoutGIL([&] { adj.adjointHessian(hess, jd); });
+
+                return moveToNumpyArray(
+                    std::move(hess),
+                    {observables.size(), num_params, num_params});
+            },
+            "Compute the Hessian of each observable, applying the "
+            "operations to the statevector.")
+        .def(
+            "metric_tensor",
+            [](AdjointJacobian<PrecisionT> &adj,
+               StateVectorRawCPU<PrecisionT> &sv,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams) {
+                const size_t num_params = trainableParams.size();
+                std::vector<PrecisionT> metric(num_params * num_params, 0);
+
+                const JacobianData<PrecisionT> jd{
+                    num_params, sv.getLength(), canonicalData(sv), {},
+                    operations, trainableParams};
+
+                withoutGIL([&] { adj.metricTensor(metric, jd); });
+
+                return moveToNumpyArray(std::move(metric),
+                                        {num_params, num_params});
+            },
+            "Compute the Fubini-Study metric tensor of the trainable "
+            "parameters, applying the operations to the statevector.")
+        .def(
+            "execute",
+            [](AdjointJacobian<PrecisionT> &adj,
+               StateVectorRawCPU<PrecisionT> &sv,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams, size_t num_params,
+               bool compute_variances, const std::vector<size_t> &prob_wires) {
+                const JacobianData<PrecisionT> jd{
+                    num_params,  sv.getLength(), canonicalData(sv),
+                    observables, operations,     trainableParams};
+
+                auto results = withoutGIL([&] {
+                    return adj.execute(jd, compute_variances, prob_wires, true);
+                });
+
+                const size_t num_jac_params =
+                    results.jacobian.empty() ? 0 : num_params;
+                return py::make_tuple(
+                    moveToNumpyArray(std::move(results.expvals)),
+                    moveToNumpyArray(std::move(results.variances)),
+                    moveToNumpyArray(std::move(results.probs)),
+                    moveToNumpyArray(std::move(results.jacobian),
+                                     {observables.size(), num_jac_params}));
+            },
+            "Apply the operations to a copy of the statevector and return "
+            "the expectation values, the variances, the probabilities of "
+            "prob_wires and the Jacobian of the trainable parameters in a "
+            "single call. Variances are empty unless requested, and the "
+            "Jacobian is empty without trainable parameters.")
+        .def(
+            "execute_batch",
+            [](const AdjointJacobian<PrecisionT> &adj,
+               const std::vector<StateVectorRawCPU<PrecisionT> *> &svs,
+               const std::vector<std::vector<ObsDatum<PrecisionT>>>
+                   &observables,
+               const std::vector<OpsData<PrecisionT>> &operations,
+               const std::vector<std::vector<size_t>> &trainableParams,
+               const std::vector<size_t> &num_params) {
+                const size_t num_tapes = svs.size();
+                PL_ABORT_IF(observables.size() != num_tapes ||
+                                operations.size() != num_tapes ||
+                                trainableParams.size() != num_tapes ||
+                                num_params.size() != num_tapes,
+                            "The number of statevectors, observables, "
+                            "operations, trainable parameters and numbers of "
+                            "parameters must all be equal.");
+                std::vector<JacobianData<PrecisionT>> tapes;
+                tapes.reserve(num_tapes);
+                for (size_t idx = 0; idx < num_tapes; idx++) {
+                    tapes.emplace_back(num_params[idx], svs[idx]->getLength(),
+                                       canonicalData(*svs[idx]),
+                                       observables[idx], operations[idx],
+                                       trainableParams[idx]);
+                }
+
+                auto results = withoutGIL([&] {
+                    return TapeExecutor<PrecisionT>(adj).execute(tapes);
+                });
+
+                py::list out;
+                for (size_t idx = 0; idx < num_tapes; idx++) {
+                    const size_t num_jac_params =
+                        results[idx].jacobian.empty() ? 0 : num_params[idx];
+                    out.append(py::make_tuple(
+                        moveToNumpyArray(std::move(results[idx].expvals)),
+                        moveToNumpyArray(std::move(results[idx].jacobian),
+                                         {observables[idx].size(),
+                                          num_jac_params})));
+                }
+                return out;
+            },
+            "Execute independent tapes, each applying its operations to a "
+            "copy of its statevector, and return the expectation values and "
+            "the Jacobian of the trainable parameters of each. Small tapes "
+            "are distributed over the threads and large ones use all threads "
+            "each.")
+        .def(
+            "adjoint_jacobian_async",
+            [](const AdjointJacobian<PrecisionT> &adj, const py::object &sv_obj,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams, size_t num_params) {
+                const auto &sv =
+                    sv_obj.cast<StateVectorRawCPU<PrecisionT> &>();
+                // The job owns copies of the settings and the tape
+                auto future = Pennylane::Util::WorkerPool::global().submit(
+                    [adj, psi = canonicalData(sv), length = sv.getLength(),
+                     observables, operations, trainableParams,
+                     num_params]() mutable {
+                        std::vector<PrecisionT> jac(
+                            observables.size() * num_params, 0);
+                        const JacobianData<PrecisionT> jd{
+                            num_params,  length,     psi,
+                            observables, operations, trainableParams};
+                        adj.adjointJacobian(jac, jd);
+                        return jac;
+                    });
+                return AsyncResult<PrecisionT>(std::move(future), sv_obj);
+            },
+            "Compute the Jacobian on the worker pool. The statevector must "
+            "not be modified until the result is ready.")
+        .def(
+            "execute_async",
+            [](const AdjointJacobian<PrecisionT> &adj, const py::object &sv_obj,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations) {
+                const auto &sv =
+                    sv_obj.cast<StateVectorRawCPU<PrecisionT> &>();
+                auto future = Pennylane::Util::WorkerPool::global().submit(
+                    [adj, psi = canonicalData(sv), length = sv.getLength(),
+                     observables, operations]() mutable {
+                        std::vector<PrecisionT> expvals(observables.size());
+                        const JacobianData<PrecisionT> jd{
+                            0, length, psi, observables, operations, {}};
+                        adj.computeExpvals(expvals, jd, true);
+                        return expvals;
+                    });
+                return AsyncResult<PrecisionT>(std::move(future), sv_obj);
+            },
+            "Apply the operations to a copy of the statevector and compute "
+            "the expectation values of the observables on the worker pool. "
+            "The statevector must not be modified until the result is "
+            "ready.");
 
     //***********************************************************************//
     //                              VJP
@@ -257,38 +927,25 @@ void lightning_class_bindings(py::module_ &m) {
     py::class_<VectorJacobianProduct<PrecisionT>>(m, class_name.c_str(),
                                                   py::module_local())
         .def(py::init<>())
-        .def("create_ops_list",
-             [](VectorJacobianProduct<PrecisionT> &v,
-                const std::vector<std::string> &ops_name,
-                const std::vector<np_arr_r> &ops_params,
-                const std::vector<std::vector<size_t>> &ops_wires,
-                const std::vector<bool> &ops_inverses,
-                const std::vector<np_arr_c> &ops_matrices) {
-                 std::vector<std::vector<PrecisionT>> conv_params(
-                     ops_params.size());
-                 std::vector<std::vector<std::complex<PrecisionT>>>
-                     conv_matrices(ops_matrices.size());
-                 static_cast<void>(v);
-                 for (size_t op = 0; op < ops_name.size(); op++) {
-                     const auto p_buffer = ops_params[op].request();
-                     const auto m_buffer = ops_matrices[op].request();
-                     if (p_buffer.size) {
-                         const auto *const p_ptr =
-                             static_cast<const ParamT *>(p_buffer.ptr);
-                         conv_params[op] =
-                             std::vector<ParamT>{p_ptr, p_ptr + p_buffer.size};
-                     }
-                     if (m_buffer.size) {
-                         const auto m_ptr =
-                             static_cast<const std::complex<ParamT> *>(
-                                 m_buffer.ptr);
-                         conv_matrices[op] = std::vector<std::complex<ParamT>>{
-                             m_ptr, m_ptr + m_buffer.size};
-                     }
-                 }
-                 return OpsData<PrecisionT>{ops_name, conv_params, ops_wires,
-                                            ops_inverses, conv_matrices};
-             })
+        .def(
+            "create_ops_list",
+            [create_ops_list](VectorJacobianProduct<PrecisionT> &v,
+                              const std::vector<std::string> &ops_name,
+                              const std::vector<np_arr_r> &ops_params,
+                              const std::vector<std::vector<size_t>> &ops_wires,
+                              const std::vector<bool> &ops_inverses,
+                              const std::vector<np_arr_c> &ops_matrices,
+                              const std::vector<np_arr_c> &ops_generators,
+                              const std::vector<std::string> &ops_pauli_words) {
+                static_cast<void>(v);
+                return create_ops_list(ops_name, ops_params, ops_wires,
+                                       ops_inverses, ops_matrices,
+                                       ops_generators, ops_pauli_words);
+            },
+            py::arg("ops_name"), py::arg("ops_params"), py::arg("ops_wires"),
+            py::arg("ops_inverses"), py::arg("ops_matrices"),
+            py::arg("ops_generators") = std::vector<np_arr_c>{},
+            py::arg("ops_pauli_words") = std::vector<std::string>{})
         .def("compute_vjp_from_jac",
              &VectorJacobianProduct<PrecisionT>::computeVJP)
         .def("compute_vjp_from_jac",
@@ -297,7 +954,7 @@ void lightning_class_bindings(py::module_ &m) {
                 const std::vector<PrecisionT> &dy_row, size_t m, size_t n) {
                  std::vector<PrecisionT> vjp_res(n);
                  v.computeVJP(vjp_res, jac, dy_row, m, n);
-                 return py::array_t<ParamT>(py::cast(vjp_res));
+                 return moveToNumpyArray(std::move(vjp_res));
              })
         .def("vjp_fn",
              [](VectorJacobianProduct<PrecisionT> &v,
@@ -305,70 +962,949 @@ void lightning_class_bindings(py::module_ &m) {
                  auto fn = v.vectorJacobianProduct(dy, num_params);
                  return py::cpp_function(
                      [fn, num_params](
-                         const StateVectorRawCPU<PrecisionT> &sv,
+                         StateVectorRawCPU<PrecisionT> &sv,
                          const std::vector<ObsDatum<PrecisionT>> &observables,
                          const OpsData<PrecisionT> &operations,
                          const std::vector<size_t> &trainableParams) {
                          const JacobianData<PrecisionT> jd{
-                             num_params,  sv.getLength(), sv.getData(),
+                             num_params,  sv.getLength(), canonicalData(sv),
                              observables, operations,     trainableParams};
-                         return py::array_t<ParamT>(py::cast(fn(jd)));
+                         return moveToNumpyArray(
+                             withoutGIL([&] { return fn(jd); }));
+                     });
+             })
+        .def("probs_vjp_fn",
+             [](VectorJacobianProduct<PrecisionT> &v,
+                const std::vector<PrecisionT> &dy,
+                const std::vector<size_t> &wires, size_t num_params) {
+                 auto fn = v.probsVectorJacobianProduct(dy, wires, num_params);
+                 return py::cpp_function(
+                     [fn, num_params](
+                         StateVectorRawCPU<PrecisionT> &sv,
+                         const OpsData<PrecisionT> &operations,
+                         const std::vector<size_t> &trainableParams) {
+                         const JacobianData<PrecisionT> jd{
+                             num_params, sv.getLength(), canonicalData(sv), {},
+                             operations, trainableParams};
+                         return moveToNumpyArray(
+                             withoutGIL([&] { return fn(jd); }));
+                     });
+             })
+        .def("state_vjp_fn",
+             [](VectorJacobianProduct<PrecisionT> &v,
+                const std::vector<std::complex<PrecisionT>> &dy,
+                size_t num_params) {
+                 auto fn = v.stateVectorJacobianProduct(dy, num_params);
+                 return py::cpp_function(
+                     [fn, num_params](
+                         StateVectorRawCPU<PrecisionT> &sv,
+                         const OpsData<PrecisionT> &operations,
+                         const std::vector<size_t> &trainableParams) {
+                         const JacobianData<PrecisionT> jd{
+                             num_params, sv.getLength(), canonicalData(sv), {},
+                             operations, trainableParams};
+                         return moveToNumpyArray(
+                             withoutGIL([&] { return fn(jd); }));
                      });
              });
 
+    //***********************************************************************//
+    //                              Parameter shift
+    //***********************************************************************//
+
+    class_name = "ParameterShiftC" + bitsize;
+    py::class_<ParameterShift<PrecisionT>>(m, class_name.c_str(),
+                                           py::module_local())
+        .def(py::init<>())
+        .def("set_max_num_forks", &ParameterShift<PrecisionT>::setMaxNumForks,
+             "Set the maximum number of forked statevectors stored at once. "
+             "0 uses the number of threads.")
+        .def("get_max_num_forks", &ParameterShift<PrecisionT>::getMaxNumForks,
+             "Get the maximum number of forked statevectors stored at once.")
+        .def(
+            "parameter_shift",
+            [](ParameterShift<PrecisionT> &shift,
+               StateVectorRawCPU<PrecisionT> &sv,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams) {
+                std::vector<PrecisionT> jac(
+                    observables.size() * trainableParams.size(), 0);
+
+                const JacobianData<PrecisionT> jd{
+                    trainableParams.size(), sv.getLength(), canonicalData(sv),
+                    observables,            operations,     trainableParams};
+
+                withoutGIL([&] { shift.parameterShift(jac, jd); });
+
+                return moveToNumpyArray(std::move(jac));
+            },
+            "Compute the Jacobian with the parameter-shift rule, applying "
+            "the operations to the statevector, which is left unchanged.");
+
     //***********************************************************************//
     //                              Measures
     //***********************************************************************//
 
     class_name = "MeasuresC" + bitsize;
     py::class_<Measures<PrecisionT>>(m, class_name.c_str(), py::module_local())
-        .def(py::init<const StateVectorRawCPU<PrecisionT> &>())
+        .def(py::init([](StateVectorRawCPU<PrecisionT> &sv) {
+            sv.flushOperations();
+            return std::make_unique<Measures<PrecisionT>>(sv);
+        }))
+        .def("enable_cache", &Measures<PrecisionT>::enableCache,
+             py::arg("enable") = true)
+        .def("is_cache_enabled", &Measures<PrecisionT>::isCacheEnabled)
+        .def("set_threading_config", &Measures<PrecisionT>::setThreadingConfig)
+        .def("get_threading_config", &Measures<PrecisionT>::getThreadingConfig)
         .def("probs",
              [](Measures<PrecisionT> &M, const std::vector<size_t> &wires) {
                  if (wires.empty()) {
-                     return py::array_t<ParamT>(py::cast(M.probs()));
+                     return moveToNumpyArray(
+                         withoutGIL([&] { return M.probs(); }));
                  }
-                 return py::array_t<ParamT>(py::cast(M.probs(wires)));
+                 return moveToNumpyArray(
+                     withoutGIL([&] { return M.probs(wires); }));
              })
         .def("expval",
              static_cast<PrecisionT (Measures<PrecisionT>::*)(
                  const std::string &, const std::vector<size_t> &)>(
                  &Measures<PrecisionT>::expval),
-             "Expected value of an operation by name.")
+             "Expected value of an operation by name.",
+             py::call_guard<py::gil_scoped_release>())
+        .def(
+            "expval_pauli_word",
+            [](Measures<PrecisionT> &M, const std::string &pauli_word,
+               const std::vector<size_t> &wires) {
+                return M.expvalPauliWord(pauli_word, wires);
+            },
+            "Expected value of a Pauli word.",
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "expval_pauli_sum",
+            [](Measures<PrecisionT> &M, const std::vector<ParamT> &coeffs,
+               const std::vector<std::string> &words,
+               const std::vector<std::vector<size_t>> &wires) {
+                return M.expval(PauliSum<PrecisionT>(coeffs, words, wires));
+            },
+            "Expected value of a Hamiltonian given by coefficients and Pauli "
+            "words.",
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "expval_pauli_sum_qubit_wise",
+            [](Measures<PrecisionT> &M, const std::vector<ParamT> &coeffs,
+               const std::vector<std::string> &words,
+               const std::vector<std::vector<size_t>> &wires) {
+                return M.expvalQubitWise(
+                    PauliSum<PrecisionT>(coeffs, words, wires));
+            },
+            "Expected value of a Hamiltonian given by coefficients and Pauli "
+            "words, measured in groups of qubit-wise commuting terms.",
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "expval_pauli_words",
+            [](Measures<PrecisionT> &M, const std::vector<std::string> &words,
+               const std::vector<std::vector<size_t>> &wires) {
+                return moveToNumpyArray(withoutGIL(
+                    [&] { return M.expvalPauliWords(words, wires); }));
+            },
+            "Expected values of several Pauli words, grouped into single "
+            "passes over the statevector.")
+        .def(
+            "var_pauli_words",
+            [](Measures<PrecisionT> &M, const std::vector<std::string> &words,
+               const std::vector<std::vector<size_t>> &wires) {
+                return moveToNumpyArray(
+                    withoutGIL([&] { return M.varPauliWords(words, wires); }));
+            },
+            "Variances of several Pauli words, grouped into single passes "
+            "over the statevector.")
+        .def(
+            "expval_z_correlators",
+            [](Measures<PrecisionT> &M,
+               const std::vector<std::vector<size_t>> &wires) {
+                return moveToNumpyArray(
+                    withoutGIL([&] { return M.expvalZCorrelators(wires); }));
+            },
+            "Expected values of products of Pauli Z operators, all evaluated "
+            "from the marginal probabilities of their wires.")
+        .def(
+            "expval_diagonal",
+            [](Measures<PrecisionT> &M,
+               const std::vector<std::vector<PrecisionT>> &diagonals,
+               const std::vector<std::vector<size_t>> &wires) {
+                return moveToNumpyArray(withoutGIL(
+                    [&] { return M.expvalDiagonal(diagonals, wires); }));
+            },
+            "Expected values of several diagonal observables in a single "
+            "pass over the statevector.")
+        .def(
+            "var_diagonal",
+            [](Measures<PrecisionT> &M,
+               const std::vector<std::vector<PrecisionT>> &diagonals,
+               const std::vector<std::vector<size_t>> &wires) {
+                return moveToNumpyArray(withoutGIL(
+                    [&] { return M.varDiagonal(diagonals, wires); }));
+            },
+            "Variances of several diagonal observables in a single pass over "
+            "the statevector.")
+        .def(
+            "expval_projector",
+            [](Measures<PrecisionT> &M, const std::vector<size_t> &basis_state,
+               const std::vector<size_t> &wires) {
+                return M.expvalProjector(basis_state, wires);
+            },
+            "Expected value of the projector onto a basis state of the given "
+            "wires.",
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "var_projector",
+            [](Measures<PrecisionT> &M, const std::vector<size_t> &basis_state,
+               const std::vector<size_t> &wires) {
+                return M.varProjector(basis_state, wires);
+            },
+            "Variance of the projector onto a basis state of the given wires.",
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "density_matrix",
+            [](Measures<PrecisionT> &M, const std::vector<size_t> &wires) {
+                const size_t dim = Util::exp2(wires.size());
+                return moveToNumpyArray(
+                    withoutGIL([&] { return M.densityMatrix(wires); }),
+                    {dim, dim});
+            },
+            "Reduced density matrix of the given wires, tracing out the "
+            "other wires.")
+        .def("purity", &Measures<PrecisionT>::purity,
+             "Purity of the reduced state of the given wires.",
+             py::call_guard<py::gil_scoped_release>())
+        .def("renyi2_entropy", &Measures<PrecisionT>::renyi2Entropy,
+             "Renyi entropy of order 2 of the reduced state of the given "
+             "wires.",
+             py::call_guard<py::gil_scoped_release>())
         .def(
             "expval",
             [](Measures<PrecisionT> &M, const np_arr_sparse_ind row_map,
                const np_arr_sparse_ind entries, const np_arr_c values) {
-                return M.expval(
-                    static_cast<sparse_index_type *>(row_map.request().ptr),
-                    static_cast<sparse_index_type>(row_map.request().size),
-                    static_cast<sparse_index_type *>(entries.request().ptr),
-                    static_cast<std::complex<PrecisionT> *>(
-                        values.request().ptr),
-                    static_cast<sparse_index_type>(values.request().size));
+                auto *row_map_ptr =
+                    static_cast<sparse_index_type *>(row_map.request().ptr);
+                const auto row_map_size =
+                    static_cast<sparse_index_type>(row_map.request().size);
+                auto *entries_ptr =
+                    static_cast<sparse_index_type *>(entries.request().ptr);
+                auto *values_ptr = static_cast<std::complex<PrecisionT> *>(
+                    values.request().ptr);
+                const auto values_size =
+                    static_cast<sparse_index_type>(values.request().size);
+                return withoutGIL([&] {
+                    return M.expval(row_map_ptr, row_map_size, entries_ptr,
+                                    values_ptr, values_size);
+                });
             },
             "Expected value of a sparse Hamiltonian.")
+        .def(
+            "expval",
+            [](Measures<PrecisionT> &M,
+               const SparseHamiltonian<PrecisionT> &hamiltonian) {
+                return M.expval(hamiltonian);
+            },
+            "Expected value of a prebuilt sparse Hamiltonian.",
+            py::call_guard<py::gil_scoped_release>())
         .def("generate_samples",
              [](Measures<PrecisionT> &M, size_t num_wires, size_t num_shots) {
-                 auto &&result = M.generate_samples(num_shots);
-                 const size_t ndim = 2;
-                 const std::vector<size_t> shape{num_shots, num_wires};
-                 constexpr auto sz = sizeof(size_t);
-                 const std::vector<size_t> strides{sz * num_wires, sz};
                  // return 2-D NumPy array
-                 return py::array(py::buffer_info(
-                     result.data(), /* data as contiguous array  */
-                     sz,            /* size of one scalar        */
-                     py::format_descriptor<size_t>::format(), /* data type */
-                     ndim,   /* number of dimensions      */
-                     shape,  /* shape of the matrix       */
-                     strides /* strides for each axis     */
-                     ));
+                 return moveToNumpyArray(
+                     withoutGIL([&] { return M.generate_samples(num_shots); }),
+                     {num_shots, num_wires});
              })
-        .def("var", [](Measures<PrecisionT> &M, const std::string &operation,
-                       const std::vector<size_t> &wires) {
-            return M.var(operation, wires);
-        });
+        .def(
+            "generate_samples",
+            [](Measures<PrecisionT> &M, size_t num_wires, size_t num_shots,
+               uint64_t seed) {
+                // return 2-D NumPy array
+                return moveToNumpyArray(
+                    withoutGIL(
+                        [&] { return M.generate_samples(num_shots, seed); }),
+                    {num_shots, num_wires});
+            },
+            "Generate samples reproducibly for the given seed.")
+        .def(
+            "generate_sample_indices",
+            [](Measures<PrecisionT> &M, size_t num_shots, uint64_t seed) {
+                return moveToNumpyArray(withoutGIL([&] {
+                    return M.generate_sample_indices(num_shots, seed);
+                }));
+            },
+            "Generate samples as computational basis state indices.")
+        .def(
+            "generate_packed_samples",
+            [](Measures<PrecisionT> &M, size_t num_shots,
+               const std::vector<size_t> &wires, uint64_t seed) {
+                return moveToNumpyArray(withoutGIL([&] {
+                    return M.generate_packed_samples(num_shots, wires, seed);
+                }));
+            },
+            "Generate samples of a subset of wires as a bit stream packed "
+            "into uint64 words.")
+        .def(
+            "generate_counts",
+            [](Measures<PrecisionT> &M, size_t num_shots, uint64_t seed) {
+                const auto counts = withoutGIL(
+                    [&] { return M.generate_counts(num_shots, seed); });
+                py::array_t<size_t> indices(counts.size());
+                py::array_t<size_t> values(counts.size());
+                auto indices_view = indices.mutable_unchecked<1>();
+                auto values_view = values.mutable_unchecked<1>();
+                for (size_t k = 0; k < counts.size(); k++) {
+                    indices_view(k) = counts[k].first;
+                    values_view(k) = counts[k].second;
+                }
+                return py::make_tuple(indices, values);
+            },
+            "Generate a histogram of samples as arrays of basis state indices "
+            "and their counts.")
+        .def(
+            "generate_shadow_samples",
+            [](Measures<PrecisionT> &M, size_t num_wires, size_t num_shots,
+               uint64_t seed) {
+                auto [bases, outcomes] = withoutGIL(
+                    [&] { return M.generate_shadow_samples(num_shots, seed); });
+                // return a 2-D NumPy array of bases
+                return py::make_tuple(
+                    moveToNumpyArray(std::move(bases), {num_shots, num_wires}),
+                    moveToNumpyArray(std::move(outcomes)));
+            },
+            "Generate classical shadow measurements as an array of the basis "
+            "of each shot and wire (0, 1, 2 for X, Y, Z) and the basis state "
+            "index of each outcome.")
+        .def(
+            "var",
+            [](Measures<PrecisionT> &M, const std::string &operation,
+               const std::vector<size_t> &wires) {
+                return M.var(operation, wires);
+            },
+            py::call_guard<py::gil_scoped_release>());
+
+    //***********************************************************************//
+    //                              Batched circuits
+    //***********************************************************************//
+
+    class_name = "BatchedCircuitC" + bitsize;
+    py::class_<BatchedCircuit<PrecisionT>>(m, class_name.c_str(),
+                                           py::module_local())
+        .def(py::init<const std::vector<std::string> &,
+                      std::vector<std::vector<size_t>>, std::vector<bool>>())
+        .def("get_num_params", &BatchedCircuit<PrecisionT>::getNumParams)
+        .def(
+            "execute_state",
+            [](const BatchedCircuit<PrecisionT> &circuit,
+               const np_arr_c &init_state, const np_arr_r &params) {
+                const auto num_qubits = Pennylane::Util::log2PerfectPower(
+                    static_cast<size_t>(init_state.size()));
+                PL_ABORT_IF(params.ndim() != 2 ||
+                                static_cast<size_t>(params.shape(1)) !=
+                                    circuit.getNumParams(),
+                            "The parameter matrix must have one column per "
+                            "parameter of the circuit.");
+                const auto num_circuits = static_cast<size_t>(params.shape(0));
+                const auto length = static_cast<size_t>(init_state.size());
+                py::array_t<std::complex<PrecisionT>> states(
+                    {num_circuits, length});
+                const auto *init_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        init_state.request().ptr);
+                const auto *params_ptr =
+                    static_cast<const PrecisionT *>(params.request().ptr);
+                auto *states_ptr = static_cast<std::complex<PrecisionT> *>(
+                    states.request().ptr);
+                withoutGIL([&] {
+                    circuit.executeStates(init_ptr, num_qubits, params_ptr,
+                                          num_circuits, states_ptr);
+                });
+                return states;
+            },
+            "Compute the final state for each row of the parameter matrix.")
+        .def(
+            "execute_expval",
+            [](const BatchedCircuit<PrecisionT> &circuit,
+               const np_arr_c &init_state, const np_arr_r &params,
+               const std::vector<std::vector<ParamT>> &coeffs,
+               const std::vector<std::vector<std::string>> &words,
+               const std::vector<std::vector<std::vector<size_t>>> &wires) {
+                PL_ABORT_IF(coeffs.size() != words.size() ||
+                                coeffs.size() != wires.size(),
+                            "The number of coefficients, Pauli words, and "
+                            "wires must all be equal.");
+                std::vector<PauliSum<PrecisionT>> observables;
+                observables.reserve(coeffs.size());
+                for (size_t obs_idx = 0; obs_idx < coeffs.size(); obs_idx++) {
+                    observables.emplace_back(coeffs[obs_idx], words[obs_idx],
+                                             wires[obs_idx]);
+                }
+                const auto num_qubits = Pennylane::Util::log2PerfectPower(
+                    static_cast<size_t>(init_state.size()));
+                PL_ABORT_IF(params.ndim() != 2 ||
+                                static_cast<size_t>(params.shape(1)) !=
+                                    circuit.getNumParams(),
+                            "The parameter matrix must have one column per "
+                            "parameter of the circuit.");
+                const auto num_circuits = static_cast<size_t>(params.shape(0));
+                const auto *init_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        init_state.request().ptr);
+                const auto *params_ptr =
+                    static_cast<const PrecisionT *>(params.request().ptr);
+                auto expvals = withoutGIL([&] {
+                    return circuit.executeExpval(init_ptr, num_qubits,
+                                                 params_ptr, num_circuits,
+                                                 observables);
+                });
+                return moveToNumpyArray(std::move(expvals),
+                                        {num_circuits, coeffs.size()});
+            },
+            "Compute the expectation values of Hamiltonians, each given by "
+            "coefficients and Pauli words, for each row of the parameter "
+            "matrix.");
+
+    //***********************************************************************//
+    //                              Matrix product state
+    //***********************************************************************//
+
+    class_name = "MatrixProductStateC" + bitsize;
+    auto pyclass_mps = py::class_<MatrixProductState<PrecisionT>>(
+        m, class_name.c_str(), py::module_local());
+    pyclass_mps.def(py::init<size_t, size_t, PrecisionT>(),
+                    py::arg("num_qubits"), py::arg("max_bond_dim") = 0,
+                    py::arg("cutoff") = 0);
+    const auto register_gate = [&pyclass_mps](GateOperation gate_op) {
+        const auto gate_name = std::string(
+            Pennylane::Util::lookup(Constant::gate_names, gate_op));
+        const std::string doc = "Apply the " + gate_name + " gate.";
+        auto func = [gate_name = gate_name](
+                        MatrixProductState<PrecisionT> &mps,
+                        const std::vector<size_t> &wires, bool inverse,
+                        const std::vector<ParamT> &params) {
+            mps.applyOperation(gate_name, wires, inverse, params);
+        };
+        pyclass_mps.def(gate_name.c_str(), func, doc.c_str(),
+                        py::call_guard<py::gil_scoped_release>());
+    };
+    Pennylane::Util::for_each_enum<GateOperation>(register_gate);
+    pyclass_mps
+        .def(
+            "applyMatrix",
+            [](MatrixProductState<PrecisionT> &mps, const np_arr_c &matrix,
+               const std::vector<size_t> &wires, bool inverse) {
+                const auto *matrix_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        matrix.request().ptr);
+                const std::vector<std::complex<PrecisionT>> matrix_vec(
+                    matrix_ptr, matrix_ptr + matrix.size());
+                const py::gil_scoped_release release;
+                mps.applyMatrix(matrix_vec, wires, inverse);
+            },
+            "Apply a given matrix to wires.")
+        .def("setMaxBondDim", &MatrixProductState<PrecisionT>::setMaxBondDim,
+             "Set the maximum bond dimension (0 for no limit).")
+        .def("getMaxBondDim", &MatrixProductState<PrecisionT>::getMaxBondDim,
+             "Get the maximum bond dimension.")
+        .def("setCutoff", &MatrixProductState<PrecisionT>::setCutoff,
+             "Set the maximum discarded weight of each truncation.")
+        .def("getCutoff", &MatrixProductState<PrecisionT>::getCutoff,
+             "Get the maximum discarded weight of each truncation.")
+        .def("getTruncationError",
+             &MatrixProductState<PrecisionT>::getTruncationError,
+             "Get the sum of the discarded weights of all truncations.")
+        .def("getBondDims", &MatrixProductState<PrecisionT>::getBondDims,
+             "Get the dimension of each bond.")
+        .def(
+            "getFullState",
+            [](const MatrixProductState<PrecisionT> &mps) {
+                return moveToNumpyArray(
+                    withoutGIL([&mps] { return mps.getFullState(); }));
+            },
+            "Compute the full statevector.")
+        .def(
+            "expval",
+            [](const MatrixProductState<PrecisionT> &mps,
+               const std::string &operation, const std::vector<size_t> &wires) {
+                return mps.expval(operation, wires);
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Expected value of a gate observable.")
+        .def(
+            "expval",
+            [](const MatrixProductState<PrecisionT> &mps,
+               const np_arr_c &matrix, const std::vector<size_t> &wires) {
+                const auto *matrix_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        matrix.request().ptr);
+                const std::vector<std::complex<PrecisionT>> matrix_vec(
+                    matrix_ptr, matrix_ptr + matrix.size());
+                const py::gil_scoped_release release;
+                return mps.expval(matrix_vec, wires);
+            },
+            "Expected value of a Hermitian matrix observable.")
+        .def(
+            "probs",
+            [](const MatrixProductState<PrecisionT> &mps,
+               const std::vector<size_t> &wires) {
+                return moveToNumpyArray(
+                    withoutGIL([&] { return mps.probs(wires); }));
+            },
+            "Probabilities of the computational basis states of the wires.");
+
+    //***********************************************************************//
+    //                          Sparse statevector
+    //***********************************************************************//
+
+    class_name = "StateVectorSparseC" + bitsize;
+    auto pyclass_sparse = py::class_<StateVectorSparseCPU<PrecisionT>>(
+        m, class_name.c_str(), py::module_local());
+    pyclass_sparse.def(py::init<size_t, size_t>(), py::arg("num_qubits"),
+                       py::arg("max_support") = 0);
+    const auto register_sparse_gate = [&pyclass_sparse](GateOperation gate_op) {
+        const auto gate_name = std::string(
+            Pennylane::Util::lookup(Constant::gate_names, gate_op));
+        const std::string doc = "Apply the " + gate_name + " gate.";
+        auto func = [gate_name = gate_name](
+                        StateVectorSparseCPU<PrecisionT> &sv,
+                        const std::vector<size_t> &wires, bool inverse,
+                        const std::vector<ParamT> &params) {
+            sv.applyOperation(gate_name, wires, inverse, params);
+        };
+        pyclass_sparse.def(gate_name.c_str(), func, doc.c_str(),
+                           py::call_guard<py::gil_scoped_release>());
+    };
+    Pennylane::Util::for_each_enum<GateOperation>(register_sparse_gate);
+    pyclass_sparse
+        .def(
+            "applyMatrix",
+            [](StateVectorSparseCPU<PrecisionT> &sv, const np_arr_c &matrix,
+               const std::vector<size_t> &wires, bool inverse) {
+                const auto *matrix_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        matrix.request().ptr);
+                const std::vector<std::complex<PrecisionT>> matrix_vec(
+                    matrix_ptr, matrix_ptr + matrix.size());
+                const py::gil_scoped_release release;
+                sv.applyMatrix(matrix_vec, wires, inverse);
+            },
+            "Apply a given matrix to wires.")
+        .def("setBasisState", &StateVectorSparseCPU<PrecisionT>::setBasisState,
+             "Prepare a computational basis state.")
+        .def("isDense", &StateVectorSparseCPU<PrecisionT>::isDense,
+             "Check whether the state was converted to a dense statevector.")
+        .def("getSupportSize",
+             &StateVectorSparseCPU<PrecisionT>::getSupportSize,
+             "Get the number of stored amplitudes.")
+        .def("getAmplitude", &StateVectorSparseCPU<PrecisionT>::getAmplitude,
+             "Get the amplitude of a basis state.")
+        .def(
+            "getSparseData",
+            [](const StateVectorSparseCPU<PrecisionT> &sv) {
+                auto [indices, amplitudes] =
+                    withoutGIL([&sv] { return sv.getSparseData(); });
+                return py::make_tuple(moveToNumpyArray(std::move(indices)),
+                                      moveToNumpyArray(std::move(amplitudes)));
+            },
+            "Get the indices and amplitudes of the nonzero amplitudes, "
+            "sorted by index.")
+        .def(
+            "getState",
+            [](const StateVectorSparseCPU<PrecisionT> &sv) {
+                return moveToNumpyArray(
+                    withoutGIL([&sv] { return sv.getDataVector(); }));
+            },
+            "Get the statevector as a dense array.");
+
+    //***********************************************************************//
+    //                  Compressed and out-of-core statevectors
+    //***********************************************************************//
+
+    const auto register_chunked = [](auto &pyclass) {
+        using SVType = typename std::decay_t<decltype(pyclass)>::type;
+        Pennylane::Util::for_each_enum<GateOperation>(
+            [&pyclass](GateOperation gate_op) {
+                const auto gate_name = std::string(
+                    Pennylane::Util::lookup(Constant::gate_names, gate_op));
+                const std::string doc = "Apply the " + gate_name + " gate.";
+                auto func = [gate_name = gate_name](
+                                SVType &sv, const std::vector<size_t> &wires,
+                                bool inverse,
+                                const std::vector<ParamT> &params) {
+                    sv.applyOperation(gate_name, wires, inverse, params);
+                };
+                pyclass.def(gate_name.c_str(), func, doc.c_str(),
+                            py::call_guard<py::gil_scoped_release>());
+            });
+        pyclass
+            .def("applyOperations", &SVType::applyOperations,
+                 "Apply gates, with consecutive gates on chunk qubits applied "
+                 "in a single pass over the chunks.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def(
+                "applyMatrix",
+                [](SVType &sv, const np_arr_c &matrix,
+                   const std::vector<size_t> &wires, bool inverse) {
+                    const auto *matrix_ptr =
+                        static_cast<const std::complex<PrecisionT> *>(
+                            matrix.request().ptr);
+                    const std::vector<std::complex<PrecisionT>> matrix_vec(
+                        matrix_ptr, matrix_ptr + matrix.size());
+                    const py::gil_scoped_release release;
+                    sv.applyMatrix(matrix_vec, wires, inverse);
+                },
+                "Apply a given matrix to wires.")
+            .def(
+                "setState",
+                [](SVType &sv, const np_arr_c &state) {
+                    const auto *data =
+                        static_cast<const std::complex<PrecisionT> *>(
+                            state.request().ptr);
+                    const size_t length = static_cast<size_t>(state.size());
+                    const py::gil_scoped_release release;
+                    sv.setFullState(data, length);
+                },
+                "Set the amplitudes from a full statevector.")
+            .def("resetState", &SVType::resetState,
+                 "Reset the statevector to the zero state.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def("getLayout", &SVType::getLayout,
+                 "Get the wire at each position of the current layout.")
+            .def("getNorm2", &SVType::getNorm2,
+                 "Get the squared norm of the statevector.",
+                 py::call_guard<py::gil_scoped_release>())
+            .def(
+                "probs",
+                [](const SVType &sv, const std::vector<size_t> &wires) {
+                    return moveToNumpyArray(
+                        withoutGIL([&] { return sv.probs(wires); }));
+                },
+                "Probabilities of the computational basis states of the "
+                "wires.")
+            .def(
+                "getState",
+                [](const SVType &sv) {
+                    return moveToNumpyArray(
+                        withoutGIL([&sv] { return sv.getFullState(); }));
+                },
+                "Get the full statevector.");
+    };
+
+    class_name = "StateVectorCompressedC" + bitsize;
+    auto pyclass_compressed = py::class_<StateVectorCompressedCPU<PrecisionT>>(
+        m, class_name.c_str(), py::module_local());
+    pyclass_compressed.def(py::init<size_t, size_t, ChunkCompression>(),
+                           py::arg("num_qubits"), py::arg("num_chunk_qubits"),
+                           py::arg("compression") = ChunkCompression::Lossless);
+    register_chunked(pyclass_compressed);
+    pyclass_compressed.def(
+        "getCompressedSize",
+        &StateVectorCompressedCPU<PrecisionT>::getCompressedSize,
+        "Get the number of bytes of the compressed chunks.");
+
+    class_name = "StateVectorOutOfCoreC" + bitsize;
+    auto pyclass_out_of_core =
+        py::class_<StateVectorOutOfCoreCPU<PrecisionT>>(m, class_name.c_str(),
+                                                        py::module_local());
+    pyclass_out_of_core.def(py::init<size_t, size_t, std::string>(),
+                            py::arg("num_qubits"), py::arg("num_chunk_qubits"),
+                            py::arg("path"),
+                            py::call_guard<py::gil_scoped_release>());
+    register_chunked(pyclass_out_of_core);
+    pyclass_out_of_core
+        .def("flush", &StateVectorOutOfCoreCPU<PrecisionT>::flush,
+             "Write the amplitudes back to the file.",
+             py::call_guard<py::gil_scoped_release>())
+        .def("getPath", &StateVectorOutOfCoreCPU<PrecisionT>::getPath,
+             "Get the path of the file.");
+
+    //***********************************************************************//
+    //                       Fixed-Hamming-weight statevector
+    //***********************************************************************//
+
+    class_name = "StateVectorFixedWeightC" + bitsize;
+    auto pyclass_fixed = py::class_<StateVectorFixedWeightCPU<PrecisionT>>(
+        m, class_name.c_str(), py::module_local());
+    pyclass_fixed.def(py::init<size_t, size_t>(), py::arg("num_qubits"),
+                      py::arg("weight"));
+    const auto register_fixed_gate = [&pyclass_fixed](GateOperation gate_op) {
+        const auto gate_name = std::string(
+            Pennylane::Util::lookup(Constant::gate_names, gate_op));
+        const std::string doc = "Apply the " + gate_name + " gate.";
+        auto func = [gate_name = gate_name](
+                        StateVectorFixedWeightCPU<PrecisionT> &sv,
+                        const std::vector<size_t> &wires, bool inverse,
+                        const std::vector<ParamT> &params) {
+            sv.applyOperation(gate_name, wires, inverse, params);
+        };
+        pyclass_fixed.def(gate_name.c_str(), func, doc.c_str(),
+                          py::call_guard<py::gil_scoped_release>());
+    };
+    Pennylane::Util::for_each_enum<GateOperation>(register_fixed_gate);
+    pyclass_fixed
+        .def(
+            "applyMatrix",
+            [](StateVectorFixedWeightCPU<PrecisionT> &sv,
+               const np_arr_c &matrix, const std::vector<size_t> &wires,
+               bool inverse) {
+                const auto *matrix_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        matrix.request().ptr);
+                const std::vector<std::complex<PrecisionT>> matrix_vec(
+                    matrix_ptr, matrix_ptr + matrix.size());
+                const py::gil_scoped_release release;
+                sv.applyMatrix(matrix_vec, wires, inverse);
+            },
+            "Apply a given weight-conserving matrix to wires.")
+        .def("setBasisState",
+             &StateVectorFixedWeightCPU<PrecisionT>::setBasisState,
+             "Prepare a computational basis state of the weight.")
+        .def("getLength", &StateVectorFixedWeightCPU<PrecisionT>::getLength,
+             "Get the number of amplitudes of the subspace.")
+        .def("getAmplitude",
+             &StateVectorFixedWeightCPU<PrecisionT>::getAmplitude,
+             "Get the amplitude of a basis state.")
+        .def(
+            "getState",
+            [](const StateVectorFixedWeightCPU<PrecisionT> &sv) {
+                return moveToNumpyArray(
+                    withoutGIL([&sv] { return sv.getDataVector(); }));
+            },
+            "Get the statevector as a dense array.")
+        .def(
+            "expval_pauli_sum",
+            [](const StateVectorFixedWeightCPU<PrecisionT> &sv,
+               const std::vector<ParamT> &coeffs,
+               const std::vector<std::string> &words,
+               const std::vector<std::vector<size_t>> &wires) {
+                return sv.expval(PauliSum<PrecisionT>(coeffs, words, wires));
+            },
+            "Expected value of a Hamiltonian given by coefficients and Pauli "
+            "words.",
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "adjoint_jacobian",
+            [](const StateVectorFixedWeightCPU<PrecisionT> &sv,
+               const std::vector<std::vector<ParamT>> &coeffs,
+               const std::vector<std::vector<std::string>> &words,
+               const std::vector<std::vector<std::vector<size_t>>> &wires,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams) {
+                PL_ABORT_IF(coeffs.size() != words.size() ||
+                                coeffs.size() != wires.size(),
+                            "The number of coefficients, Pauli words, and "
+                            "wires must all be equal.");
+                std::vector<PauliSum<PrecisionT>> observables;
+                observables.reserve(coeffs.size());
+                for (size_t obs_idx = 0; obs_idx < coeffs.size(); obs_idx++) {
+                    observables.emplace_back(coeffs[obs_idx], words[obs_idx],
+                                             wires[obs_idx]);
+                }
+                std::vector<PrecisionT> jac(observables.size() *
+                                            trainableParams.size());
+                withoutGIL([&] {
+                    AdjointJacobianFixedWeight<PrecisionT>().adjointJacobian(
+                        jac, sv, observables, operations, trainableParams);
+                });
+                return moveToNumpyArray(std::move(jac),
+                                        {observables.size(),
+                                         trainableParams.size()});
+            },
+            "Compute the Jacobian of Hamiltonians, each given by coefficients "
+            "and Pauli words, for the state after the operations.");
+
+    //***********************************************************************//
+    //                       Split real/imaginary statevector
+    //***********************************************************************//
+
+    class_name = "StateVectorSplitC" + bitsize;
+    auto pyclass_split = py::class_<StateVectorSplitCPU<PrecisionT>>(
+        m, class_name.c_str(), py::module_local());
+    pyclass_split.def(py::init<size_t>(), py::arg("num_qubits"));
+    pyclass_split.def(py::init([](const np_arr_c &state) {
+        const auto *data_ptr =
+            static_cast<const std::complex<PrecisionT> *>(state.request().ptr);
+        return StateVectorSplitCPU<PrecisionT>(data_ptr, state.size());
+    }));
+    const auto register_split_gate = [&pyclass_split](GateOperation gate_op) {
+        const auto gate_name = std::string(
+            Pennylane::Util::lookup(Constant::gate_names, gate_op));
+        const std::string doc = "Apply the " + gate_name + " gate.";
+        auto func = [gate_name = gate_name](
+                        StateVectorSplitCPU<PrecisionT> &sv,
+                        const std::vector<size_t> &wires, bool inverse,
+                        const std::vector<ParamT> &params) {
+            sv.applyOperation(gate_name, wires, inverse, params);
+        };
+        pyclass_split.def(gate_name.c_str(), func, doc.c_str(),
+                          py::call_guard<py::gil_scoped_release>());
+    };
+    Pennylane::Util::for_each_enum<GateOperation>(register_split_gate);
+    pyclass_split
+        .def(
+            "applyMatrix",
+            [](StateVectorSplitCPU<PrecisionT> &sv, const np_arr_c &matrix,
+               const std::vector<size_t> &wires, bool inverse) {
+                const auto *matrix_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        matrix.request().ptr);
+                const std::vector<std::complex<PrecisionT>> matrix_vec(
+                    matrix_ptr, matrix_ptr + matrix.size());
+                const py::gil_scoped_release release;
+                sv.applyMatrix(matrix_vec, wires, inverse);
+            },
+            "Apply a given matrix to wires.")
+        .def(
+            "getState",
+            [](const StateVectorSplitCPU<PrecisionT> &sv, np_arr_c &state) {
+                PL_ABORT_IF(static_cast<size_t>(state.size()) !=
+                                sv.getLength(),
+                            "The size of the output does not match the "
+                            "statevector.");
+                auto *data_ptr = static_cast<std::complex<PrecisionT> *>(
+                    state.request().ptr);
+                const py::gil_scoped_release release;
+                sv.copyTo(data_ptr);
+            },
+            "Copy the statevector to an interleaved complex array.")
+        .def(
+            "probs",
+            [](const StateVectorSplitCPU<PrecisionT> &sv) {
+                return moveToNumpyArray(
+                    withoutGIL([&sv] { return sv.probs(); }));
+            },
+            "Probabilities of the computational basis states.");
+
+#if defined(_ENABLE_KOKKOS)
+    //***********************************************************************//
+    //                            Kokkos statevector
+    //***********************************************************************//
+
+    using SVKokkos = Pennylane::StateVectorKokkos<PrecisionT>;
+    class_name = "StateVectorKokkosC" + bitsize;
+    auto pyclass_kokkos =
+        py::class_<SVKokkos>(m, class_name.c_str(), py::module_local());
+    pyclass_kokkos.def(py::init<size_t>(), py::arg("num_qubits"));
+    const auto register_kokkos_gate =
+        [&pyclass_kokkos](GateOperation gate_op) {
+            const auto gate_name = std::string(
+                Pennylane::Util::lookup(Constant::gate_names, gate_op));
+            const std::string doc = "Apply the " + gate_name + " gate.";
+            auto func = [gate_name = gate_name](
+                            SVKokkos &sv, const std::vector<size_t> &wires,
+                            bool inverse, const std::vector<ParamT> &params) {
+                sv.applyOperation(gate_name, wires, inverse, params);
+            };
+            pyclass_kokkos.def(gate_name.c_str(), func, doc.c_str(),
+                               py::call_guard<py::gil_scoped_release>());
+        };
+    Pennylane::Util::for_each_enum<GateOperation>(register_kokkos_gate);
+    pyclass_kokkos
+        .def(
+            "applyMatrix",
+            [](SVKokkos &sv, const np_arr_c &matrix,
+               const std::vector<size_t> &wires, bool inverse) {
+                const auto *matrix_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        matrix.request().ptr);
+                const std::vector<std::complex<PrecisionT>> matrix_vec(
+                    matrix_ptr, matrix_ptr + matrix.size());
+                const py::gil_scoped_release release;
+                sv.applyMatrix(matrix_vec, wires, inverse);
+            },
+            "Apply a given matrix to wires.")
+        .def(
+            "setState",
+            [](SVKokkos &sv, const np_arr_c &state) {
+                const auto *data =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        state.request().ptr);
+                const size_t length = static_cast<size_t>(state.size());
+                const py::gil_scoped_release release;
+                sv.setStateVector(data, length);
+            },
+            "Copy the amplitudes from the host.")
+        .def(
+            "getState",
+            [](const SVKokkos &sv) {
+                return moveToNumpyArray(
+                    withoutGIL([&sv] { return sv.getStateVector(); }));
+            },
+            "Copy the amplitudes to the host.")
+        .def("resetState", &SVKokkos::resetState,
+             "Reset the statevector to the zero state.",
+             py::call_guard<py::gil_scoped_release>())
+        .def("getNorm2", &SVKokkos::getNorm2,
+             "Get the squared norm of the statevector.",
+             py::call_guard<py::gil_scoped_release>())
+        .def(
+            "probs",
+            [](const SVKokkos &sv, const std::vector<size_t> &wires) {
+                return moveToNumpyArray(
+                    withoutGIL([&] { return sv.probs(wires); }));
+            },
+            "Probabilities of the computational basis states of the "
+            "wires.")
+        .def(
+            "expval",
+            [](const SVKokkos &sv, const std::string &name,
+               const std::vector<size_t> &wires,
+               const std::vector<ParamT> &params) {
+                return sv.expval(name, wires, params);
+            },
+            py::arg("name"), py::arg("wires"),
+            py::arg("params") = std::vector<ParamT>{},
+            "Expected value of a gate observable.",
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "expval",
+            [](const SVKokkos &sv, const np_arr_c &matrix,
+               const std::vector<size_t> &wires) {
+                const auto *matrix_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        matrix.request().ptr);
+                const std::vector<std::complex<PrecisionT>> matrix_vec(
+                    matrix_ptr, matrix_ptr + matrix.size());
+                const py::gil_scoped_release release;
+                return sv.expval(matrix_vec, wires);
+            },
+            "Expected value of a Hermitian matrix observable.")
+        .def(
+            "var",
+            [](const SVKokkos &sv, const std::string &name,
+               const std::vector<size_t> &wires,
+               const std::vector<ParamT> &params) {
+                return sv.var(name, wires, params);
+            },
+            py::arg("name"), py::arg("wires"),
+            py::arg("params") = std::vector<ParamT>{},
+            "Variance of a gate observable.",
+            py::call_guard<py::gil_scoped_release>())
+        .def(
+            "adjoint_jacobian",
+            [](const SVKokkos &sv,
+               const std::vector<ObsDatum<PrecisionT>> &observables,
+               const OpsData<PrecisionT> &operations,
+               const std::vector<size_t> &trainableParams,
+               bool apply_operations) {
+                std::vector<PrecisionT> jac(observables.size() *
+                                            trainableParams.size());
+                withoutGIL([&] {
+                    AdjointJacobianKokkos<PrecisionT>().adjointJacobian(
+                        jac, sv, observables, operations, trainableParams,
+                        apply_operations);
+                });
+                return moveToNumpyArray(std::move(jac),
+                                        {observables.size(),
+                                         trainableParams.size()});
+            },
+            py::arg("observables"), py::arg("operations"),
+            py::arg("trainable_params"), py::arg("apply_operations") = false,
+            "Compute the Jacobian of the observables with the adjoint "
+            "method, keeping the states on the device.");
+#endif
 }
 
 /**
@@ -408,12 +1944,56 @@ PYBIND11_MODULE(lightning_qubit_ops, // NOLINT: No control over Pybind internals
     /* Add CPUMemoryModel enum class */
     py::enum_<CPUMemoryModel>(m, "CPUMemoryModel")
         .value("Unaligned", CPUMemoryModel::Unaligned)
+        .value("Aligned128", CPUMemoryModel::Aligned128)
         .value("Aligned256", CPUMemoryModel::Aligned256)
         .value("Aligned512", CPUMemoryModel::Aligned512);
 
+    /* Add AdjointParallelism enum class */
+    py::enum_<AdjointParallelism>(m, "AdjointParallelism")
+        .value("Auto", AdjointParallelism::Auto)
+        .value("Observables", AdjointParallelism::Observables)
+        .value("Elements", AdjointParallelism::Elements)
+        .value("Nested", AdjointParallelism::Nested);
+
+    /* Add ThreadingConfig class */
+    py::class_<ThreadingConfig>(m, "ThreadingConfig")
+        .def(py::init([](size_t num_threads, std::vector<size_t> cpu_set,
+                         size_t sequential_below_num_qubits) {
+                 return ThreadingConfig{num_threads, std::move(cpu_set),
+                                        sequential_below_num_qubits};
+             }),
+             py::arg("num_threads") = 0,
+             py::arg("cpu_set") = std::vector<size_t>{},
+             py::arg("sequential_below_num_qubits") = 0)
+        .def_readwrite("num_threads", &ThreadingConfig::num_threads)
+        .def_readwrite("cpu_set", &ThreadingConfig::cpu_set)
+        .def_readwrite("sequential_below_num_qubits",
+                       &ThreadingConfig::sequential_below_num_qubits)
+        .def("is_default", &ThreadingConfig::isDefault);
+
+    /* Add NUMAPolicy enum class */
+    py::enum_<Util::NUMAPolicy>(m, "NUMAPolicy")
+        .value("Default", Util::NUMAPolicy::Default)
+        .value("FirstTouch", Util::NUMAPolicy::FirstTouch)
+        .value("Interleave", Util::NUMAPolicy::Interleave)
+        .value("Bind", Util::NUMAPolicy::Bind);
+
+    /* Add ChunkCompression enum class */
+    py::enum_<ChunkCompression>(m, "ChunkCompression")
+        .value("Lossless", ChunkCompression::Lossless)
+        .value("Fixed16", ChunkCompression::Fixed16);
+
+    /* Add HugePagePolicy enum class */
+    py::enum_<Util::HugePagePolicy>(m, "HugePagePolicy")
+        .value("Disabled", Util::HugePagePolicy::Disabled)
+        .value("Transparent", Util::HugePagePolicy::Transparent)
+        .value("Explicit", Util::HugePagePolicy::Explicit);
+
     /* Add array */
     m.def("allocate_aligned_array", &allocateAlignedArray,
-          "Get numpy array whose underlying data is aligned.");
+          "Get numpy array whose underlying data is aligned.", py::arg("size"),
+          py::arg("dt"), py::arg("numa_policy") = Util::NUMAPolicy::Default,
+          py::arg("huge_pages") = Util::HugePagePolicy::Disabled);
     m.def("get_alignment", &getNumpyArrayAlignment,
           "Get alignment of an underlying data for a numpy array.");
     m.def("best_alignment", &bestCPUMemoryModel,
@@ -425,6 +2005,25 @@ PYBIND11_MODULE(lightning_qubit_ops, // NOLINT: No control over Pybind internals
     /* Add compile info */
     m.def("runtime_info", &getRuntimeInfo, "Runtime information.");
 
+    /* Add timeline tracing of simulator phases */
+    m.def(
+        "set_tracing",
+        [](bool enabled) {
+            Pennylane::Util::TraceRecorder::getInstance().setEnabled(enabled);
+        },
+        "Start or stop recording trace events of simulator phases (needs a "
+        "build with ENABLE_TRACING).");
+    m.def(
+        "save_trace",
+        [](const std::string &path) {
+            Pennylane::Util::TraceRecorder::getInstance().saveChromeTrace(path);
+        },
+        "Write the recorded trace events as a Chrome trace JSON file.");
+    m.def(
+        "clear_trace",
+        [] { Pennylane::Util::TraceRecorder::getInstance().clear(); },
+        "Remove all recorded trace events.");
+
     /* Add Kokkos and Kokkos Kernels info */
     m.def("Kokkos_info", &getKokkosInfo,
           "Kokkos and Kokkos Kernels information.");
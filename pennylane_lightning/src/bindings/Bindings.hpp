@@ -18,16 +18,23 @@
  */
 #pragma once
 #include "AdjointDiff.hpp"
+#include "BatchedCircuit.hpp"
 #include "CPUMemoryModel.hpp"
+#include "DLPack.hpp"
+#include "DispatchProfiler.hpp"
 #include "JacobianProd.hpp"
 #include "Kokkos_Sparse.hpp"
 #include "Macros.hpp"
 #include "Measures.hpp"
 #include "Memory.hpp"
 #include "OpToMemberFuncPtr.hpp"
+#include "ParameterShift.hpp"
 #include "RuntimeInfo.hpp"
 #include "SelectKernel.hpp"
 #include "StateVectorManagedCPU.hpp"
+#include "Trace.hpp"
+#include "TrotterEvolution.hpp"
+#include "WorkerPool.hpp"
 
 #include "pybind11/complex.h"
 #include "pybind11/functional.h"
@@ -37,7 +44,10 @@
 #include "pybind11/stl_bind.h"
 
 #include <cassert>
+#include <chrono>
+#include <future>
 #include <iostream>
+#include <memory>
 #include <set>
 #include <tuple>
 #include <vector>
@@ -47,6 +57,10 @@ namespace Pennylane {
  * @brief Create a @ref Pennylane::StateVectorRawCPU object from a 1D numpy
  * complex data array.
  *
+ * The statevector shares the data of the array without owning it, so the
+ * binding must keep the array alive as long as the statevector object, and
+ * must not convert it to a temporary copy.
+ *
  * @tparam PrecisionT Precision data type
  * @param numpyArray Numpy data array.
  * @return StateVectorRawCPU object.
@@ -64,6 +78,9 @@ auto createRaw(const pybind11::array_t<std::complex<PrecisionT>> &numpyArray)
         throw std::invalid_argument(
             "NumPy array must be of type np.complex64 or np.complex128");
     }
+    if ((numpyArray.flags() & pybind11::array::c_style) == 0) {
+        throw std::invalid_argument("NumPy array must be C-contiguous");
+    }
     auto *data_ptr =
         static_cast<std::complex<PrecisionT> *>(numpyArrayInfo.ptr);
     return StateVectorRawCPU<PrecisionT>(
@@ -113,6 +130,281 @@ auto toNumpyArray(const StateVectorManagedCPU<PrecisionT> &sv)
         {sv.getLength()}, {2 * sizeof(PrecisionT)}, sv.getData());
 }
 
+/**
+ * @brief Move a contiguous container into a numpy array without copying
+ * its data.
+ *
+ * The array owns the container through a capsule, which destroys it when
+ * the array is garbage collected.
+ *
+ * @tparam Container Container type with `data()` and `size()`, e.g.
+ * std::vector.
+ * @param container Container to move.
+ * @param shape Shape of the array in the row-major order. A 1-dimensional
+ * array of the size of the container if empty.
+ * @return Numpy array
+ */
+template <class Container>
+auto moveToNumpyArray(Container container, std::vector<size_t> shape = {})
+    -> pybind11::array {
+    using T = typename Container::value_type;
+    if (shape.empty()) {
+        shape = {container.size()};
+    }
+    std::vector<size_t> strides(shape.size());
+    size_t stride = sizeof(T);
+    for (size_t dim = shape.size(); dim-- > 0;) {
+        strides[dim] = stride;
+        stride *= shape[dim];
+    }
+    PL_ABORT_IF_NOT(stride == sizeof(T) * container.size(),
+                    "The shape does not match the size of the container.");
+
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto *owner = new Container(std::move(container));
+    pybind11::capsule capsule(owner, [](void *p) {
+        delete static_cast<Container *>(p); // NOLINT(*-owning-memory)
+    });
+    return pybind11::array{pybind11::dtype::of<T>(), shape, strides,
+                           owner->data(), capsule};
+}
+
+/**
+ * @brief Call a function with the GIL released.
+ *
+ * The function must not access Python objects. This lets long-running
+ * computations of several Python threads run concurrently.
+ *
+ * @param func Function without arguments.
+ * @return Result of the function.
+ */
+template <class Func> auto withoutGIL(Func &&func) {
+    const pybind11::gil_scoped_release release;
+    return std::forward<Func>(func)();
+}
+
+/**
+ * @brief Wrap a DLPack tensor into a capsule named "dltensor".
+ *
+ * The capsule calls the deleter of the tensor when it is garbage collected,
+ * unless a consumer renamed it "used_dltensor" to take over the tensor.
+ *
+ * @param tensor Tensor to wrap.
+ * @return Capsule owning the tensor.
+ */
+inline auto toDLPackCapsule(DLPack::DLManagedTensor *tensor)
+    -> pybind11::capsule {
+    auto destructor = [](PyObject *capsule) {
+        if (PyCapsule_IsValid(capsule, "dltensor") == 0) {
+            return;
+        }
+        auto *unused = static_cast<DLPack::DLManagedTensor *>(
+            PyCapsule_GetPointer(capsule, "dltensor"));
+        if (unused->deleter != nullptr) {
+            unused->deleter(unused);
+        }
+    };
+    PyObject *capsule = PyCapsule_New(tensor, "dltensor", destructor);
+    if (capsule == nullptr) {
+        tensor->deleter(tensor);
+        throw pybind11::error_already_set();
+    }
+    return pybind11::reinterpret_steal<pybind11::capsule>(capsule);
+}
+
+/**
+ * @brief Export the data of a statevector as a DLPack capsule without
+ * copying it.
+ *
+ * Deferred operations are applied and the wires are brought to the
+ * canonical order first. The tensor keeps the Python statevector object
+ * alive, and a statevector sharing the data of a NumPy array keeps the
+ * array alive (see createRaw()), so the data remains valid until the
+ * consumer releases the tensor, even if the statevector and the array are
+ * dropped before. Operations applied to the statevector later are visible
+ * through the tensor, unless they reorder its wires.
+ *
+ * @tparam StateVectorT Statevector type.
+ * @param self Python statevector object.
+ * @param copy Export a copy of the data instead.
+ * @return DLPack capsule.
+ */
+template <class StateVectorT>
+auto stateVectorToDLPack(const pybind11::object &self, bool copy = false)
+    -> pybind11::capsule {
+    using PrecisionT = typename StateVectorT::PrecisionT;
+    using ComplexT = std::complex<PrecisionT>;
+    auto &sv = self.cast<StateVectorT &>();
+    // Read-only mapped statevectors have neither deferred operations nor
+    // reordered wires
+    const ComplexT *data = std::as_const(sv).getData();
+    if constexpr (std::is_same_v<StateVectorT,
+                                 StateVectorRawCPU<PrecisionT>>) {
+        if (!sv.isReadOnly()) {
+            sv.canonicalizeWires();
+            data = sv.getData();
+        }
+    } else {
+        sv.canonicalizeWires();
+        data = sv.getData();
+    }
+    const auto length = static_cast<int64_t>(sv.getLength());
+    if (copy) {
+        auto owned = std::make_shared<std::vector<ComplexT>>(
+            data, data + sv.getLength());
+        return toDLPackCapsule(DLPack::makeManagedTensor(
+            owned->data(), {length}, {}, owned));
+    }
+    // The consumer may release the tensor without holding the GIL
+    std::shared_ptr<void> owner(new pybind11::object(self), // NOLINT
+                                [](pybind11::object *obj) {
+                                    const pybind11::gil_scoped_acquire gil;
+                                    delete obj; // NOLINT
+                                });
+    return toDLPackCapsule(
+        DLPack::makeManagedTensor(data, {length}, {}, std::move(owner)));
+}
+
+/**
+ * @brief Create a statevector sharing the data of a DLPack tensor, e.g. a
+ * JAX array or a PyTorch tensor, without copying it.
+ *
+ * The statevector takes over the tensor and releases it when destroyed.
+ * As the tensor keeps the data of its producer alive, unlike a NumPy array
+ * passed to createRaw(), `obj` need not outlive the statevector.
+ *
+ * @tparam PrecisionT Floating point precision type.
+ * @param obj Object implementing `__dlpack__`, or a DLPack capsule.
+ * @return StateVectorRawCPU object.
+ */
+template <class PrecisionT>
+auto stateVectorFromDLPack(const pybind11::object &obj)
+    -> StateVectorRawCPU<PrecisionT> {
+    using ComplexT = std::complex<PrecisionT>;
+    const pybind11::object capsule = pybind11::hasattr(obj, "__dlpack__")
+                                         ? obj.attr("__dlpack__")()
+                                         : obj;
+    PyObject *ptr = capsule.ptr();
+    PL_ABORT_IF(PyCapsule_IsValid(ptr, "dltensor") == 0,
+                "Expected an object implementing __dlpack__ or an unused "
+                "DLPack capsule.");
+    auto *tensor = static_cast<DLPack::DLManagedTensor *>(
+        PyCapsule_GetPointer(ptr, "dltensor"));
+    const size_t length =
+        DLPack::checkStateVector<ComplexT>(tensor->dl_tensor);
+    auto *data = reinterpret_cast<ComplexT *>( // NOLINT
+        static_cast<char *>(tensor->dl_tensor.data) +
+        tensor->dl_tensor.byte_offset);
+
+    // The statevector owns the tensor from now on, and releases it if
+    // the construction fails
+    if (PyCapsule_SetName(ptr, "used_dltensor") != 0) {
+        throw pybind11::error_already_set();
+    }
+    std::shared_ptr<void> owner(tensor, [](DLPack::DLManagedTensor *t) {
+        if (t->deleter != nullptr) {
+            const pybind11::gil_scoped_acquire gil;
+            t->deleter(t);
+        }
+    });
+    return StateVectorRawCPU<PrecisionT>(data, length, std::move(owner));
+}
+
+/**
+ * @brief Register the DLPack protocol for a statevector class, so that
+ * e.g. `jax.dlpack.from_dlpack` or `torch.from_dlpack` view its data.
+ *
+ * @tparam SVType Statevector type to register
+ * @tparam Pyclass Pybind11's class object type
+ *
+ * @param pyclass Pybind11's class object to bind statevector
+ */
+template <class SVType, class PyClass>
+void registerDLPackForStateVector(PyClass &pyclass) {
+    pyclass.def(
+        "__dlpack__",
+        [](const pybind11::object &self, const pybind11::object &stream,
+           [[maybe_unused]] const pybind11::object &max_version,
+           const pybind11::object &dl_device, const pybind11::object &copy) {
+            PL_ABORT_IF(!stream.is_none(),
+                        "Streams are not supported for CPU data.");
+            PL_ABORT_IF(!dl_device.is_none() &&
+                            dl_device.cast<std::pair<int, int>>() !=
+                                std::pair<int, int>{DLPack::kDLCPU, 0},
+                        "The statevector can only be exported to the CPU.");
+            return stateVectorToDLPack<SVType>(self,
+                                               !copy.is_none() &&
+                                                   copy.cast<bool>());
+        },
+        pybind11::arg("stream") = pybind11::none(),
+        pybind11::arg("max_version") = pybind11::none(),
+        pybind11::arg("dl_device") = pybind11::none(),
+        pybind11::arg("copy") = pybind11::none(),
+        "Export the statevector as a DLPack capsule without copying it.");
+    pyclass.def(
+        "__dlpack_device__",
+        [](const SVType &) {
+            return std::make_pair(static_cast<int>(DLPack::kDLCPU), 0);
+        },
+        "Get the DLPack device of the statevector.");
+}
+
+/**
+ * @brief Handle of a result computed asynchronously by a worker pool.
+ *
+ * The handle keeps alive the Python object the job reads, e.g. the
+ * statevector object, which in turn keeps its numpy array alive. It waits
+ * for the job on destruction.
+ *
+ * @tparam T Element type of the result.
+ */
+template <class T> class AsyncResult {
+  private:
+    std::future<std::vector<T>> future_;
+    pybind11::object keep_alive_;
+
+  public:
+    /**
+     * @brief Construct a handle.
+     *
+     * @param future Future of the result.
+     * @param keep_alive Python object the job reads.
+     */
+    AsyncResult(std::future<std::vector<T>> &&future,
+                pybind11::object keep_alive)
+        : future_{std::move(future)}, keep_alive_{std::move(keep_alive)} {}
+
+    AsyncResult(const AsyncResult &) = delete;
+    AsyncResult(AsyncResult &&) noexcept = default;
+    AsyncResult &operator=(const AsyncResult &) = delete;
+    AsyncResult &operator=(AsyncResult &&) = delete;
+
+    ~AsyncResult() {
+        if (future_.valid()) {
+            withoutGIL([this] { future_.wait(); });
+        }
+    }
+
+    /**
+     * @brief Check if the result is ready, without blocking.
+     */
+    [[nodiscard]] auto done() const -> bool {
+        return !future_.valid() ||
+               future_.wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::ready;
+    }
+
+    /**
+     * @brief Wait for the result and move it into a numpy array. The result
+     * can be retrieved once.
+     */
+    auto result() -> pybind11::array {
+        PL_ABORT_IF_NOT(future_.valid(),
+                        "The result has already been retrieved.");
+        return moveToNumpyArray(withoutGIL([this] { return future_.get(); }));
+    }
+};
+
 /**
  * @brief Get memory alignment of a given numpy array.
  *
@@ -131,22 +423,34 @@ auto getNumpyArrayAlignment(const pybind11::array &numpyArray)
  * @tparam T Datatype of numpy array to create
  * @param memory_model Memory model to use
  * @param size Size of the array to create
+ * @param numa_policy Placement of the array on NUMA nodes
+ * @param huge_pages Backing of the array with huge pages
  * @return Numpy array
  */
 template <typename T>
-auto alignedNumpyArray(CPUMemoryModel memory_model, size_t size)
+auto alignedNumpyArray(
+    CPUMemoryModel memory_model, size_t size,
+    Util::NUMAPolicy numa_policy = Util::NUMAPolicy::Default,
+    Util::HugePagePolicy huge_pages = Util::HugePagePolicy::Disabled)
     -> pybind11::array {
-    if (getAlignment<T>(memory_model) > alignof(std::max_align_t)) {
-        void *ptr =
-            alignedAlloc(getAlignment<T>(memory_model), sizeof(T) * size);
-        auto capsule = pybind11::capsule(ptr, &alignedFree);
-        return pybind11::array{
-            pybind11::dtype::of<T>(), {size}, {sizeof(T)}, ptr, capsule};
-    } // else
-    void *ptr = malloc(sizeof(T) * size);
-    auto capsule = pybind11::capsule(ptr, free);
-    return pybind11::array{
-        pybind11::dtype::of<T>(), {size}, {sizeof(T)}, ptr, capsule};
+    // The capsule owns the allocator, as memory mapped for huge pages is
+    // released with its size.
+    struct Allocation {
+        Util::AlignedAllocator<T> allocator;
+        T *ptr;
+        size_t size;
+    };
+    auto allocator = getAllocator<T>(memory_model, numa_policy, huge_pages);
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto *allocation =
+        new Allocation{allocator, allocator.allocate(size), size};
+    auto capsule = pybind11::capsule(allocation, [](void *p) {
+        auto *allocation = static_cast<Allocation *>(p);
+        allocation->allocator.deallocate(allocation->ptr, allocation->size);
+        delete allocation; // NOLINT(cppcoreguidelines-owning-memory)
+    });
+    return pybind11::array{pybind11::dtype::of<T>(), {size}, {sizeof(T)},
+                           allocation->ptr, capsule};
 }
 
 /**
@@ -158,18 +462,28 @@ auto alignedNumpyArray(CPUMemoryModel memory_model, size_t size)
  *
  * @param size Size of the array to create
  * @param dt Pybind11's datatype object
+ * @param numa_policy Placement of the array on NUMA nodes
+ * @param huge_pages Backing of the array with huge pages
  */
-auto allocateAlignedArray(size_t size, pybind11::dtype dt) -> pybind11::array {
+auto allocateAlignedArray(
+    size_t size, pybind11::dtype dt,
+    Util::NUMAPolicy numa_policy = Util::NUMAPolicy::Default,
+    Util::HugePagePolicy huge_pages = Util::HugePagePolicy::Disabled)
+    -> pybind11::array {
     auto memory_model = bestCPUMemoryModel();
 
     if (dt.is(pybind11::dtype::of<float>())) {
-        return alignedNumpyArray<float>(memory_model, size);
+        return alignedNumpyArray<float>(memory_model, size, numa_policy,
+                                        huge_pages);
     } else if (dt.is(pybind11::dtype::of<double>())) {
-        return alignedNumpyArray<double>(memory_model, size);
+        return alignedNumpyArray<double>(memory_model, size, numa_policy,
+                                         huge_pages);
     } else if (dt.is(pybind11::dtype::of<std::complex<float>>())) {
-        return alignedNumpyArray<std::complex<float>>(memory_model, size);
+        return alignedNumpyArray<std::complex<float>>(memory_model, size,
+                                                      numa_policy, huge_pages);
     } else if (dt.is(pybind11::dtype::of<std::complex<double>>())) {
-        return alignedNumpyArray<std::complex<double>>(memory_model, size);
+        return alignedNumpyArray<std::complex<double>>(memory_model, size,
+                                                       numa_policy, huge_pages);
     } else {
         throw pybind11::type_error("Unsupported datatype.");
     }
@@ -193,12 +507,16 @@ void apply(pybind11::array_t<std::complex<PrecisionT>> &stateNumpyArray,
            const std::vector<bool> &inverse,
            const std::vector<std::vector<PrecisionT>> &params) {
     auto state = createRaw<PrecisionT>(stateNumpyArray);
+    const pybind11::gil_scoped_release release;
     state.applyOperations(ops, wires, inverse, params);
 }
 
 /**
  * @brief Register StateVector class to pybind.
  *
+ * The GIL is released while gates are applied, so that statevectors can be
+ * updated concurrently from Python threads.
+ *
  * @tparam PrecisionT Floating point type for statevector
  * @tparam ParamT Parameter type of gate operations for statevector
  * @tparam SVType Statevector type to register
@@ -221,13 +539,120 @@ void registerGatesForStateVector(PyClass &pyclass) {
                                        pybind11::array::c_style |
                                            pybind11::array::forcecast> &matrix,
                const std::vector<size_t> &wires, bool inverse = false) {
-                st.applyMatrix(static_cast<const std::complex<PrecisionT> *>(
-                                   matrix.request().ptr),
-                               wires, inverse);
+                const auto *matrix_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        matrix.request().ptr);
+                const pybind11::gil_scoped_release release;
+                st.applyMatrix(matrix_ptr, wires, inverse);
             };
         pyclass.def("applyMatrix", func, doc.c_str());
     }
 
+    { // Register controlled matrix
+        const std::string doc =
+            "Apply a given matrix to wires, controlled on the values of the "
+            "control wires.";
+        auto func =
+            [](SVType &st,
+               const pybind11::array_t<std::complex<PrecisionT>,
+                                       pybind11::array::c_style |
+                                           pybind11::array::forcecast> &matrix,
+               const std::vector<size_t> &controlled_wires,
+               const std::vector<bool> &controlled_values,
+               const std::vector<size_t> &wires, bool inverse = false) {
+                PL_ABORT_IF(static_cast<size_t>(matrix.size()) !=
+                                Util::exp2(2 * wires.size()),
+                            "The size of matrix does not match with the "
+                            "given number of wires");
+                const auto *matrix_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        matrix.request().ptr);
+                const pybind11::gil_scoped_release release;
+                st.applyControlledMatrix(matrix_ptr, controlled_wires,
+                                         controlled_values, wires, inverse);
+            };
+        pyclass.def("applyControlledMatrix", func, doc.c_str());
+    }
+
+    { // Register diagonal matrix
+        const std::string doc =
+            "Apply a diagonal matrix, given by its diagonal elements, to "
+            "wires.";
+        auto func =
+            [](SVType &st,
+               const pybind11::array_t<std::complex<PrecisionT>,
+                                       pybind11::array::c_style |
+                                           pybind11::array::forcecast> &diag,
+               const std::vector<size_t> &wires, bool inverse = false) {
+                PL_ABORT_IF(static_cast<size_t>(diag.size()) !=
+                                Util::exp2(wires.size()),
+                            "The size of diagonal does not match with the "
+                            "given number of wires");
+                const auto *diag_ptr =
+                    static_cast<const std::complex<PrecisionT> *>(
+                        diag.request().ptr);
+                const pybind11::gil_scoped_release release;
+                st.applyDiagonal(diag_ptr, wires, inverse);
+            };
+        pyclass.def("applyDiagonal", func, doc.c_str());
+    }
+
+    { // Register cost layer
+        const std::string doc =
+            "Apply exp(-i gamma C) for a cost operator C given by its "
+            "diagonal.";
+        auto func =
+            [](SVType &st,
+               const pybind11::array_t<PrecisionT,
+                                       pybind11::array::c_style |
+                                           pybind11::array::forcecast> &cost,
+               const std::vector<size_t> &wires, PrecisionT gamma,
+               bool inverse = false) {
+                PL_ABORT_IF(static_cast<size_t>(cost.size()) !=
+                                Util::exp2(wires.size()),
+                            "The size of cost does not match with the given "
+                            "number of wires");
+                const auto *cost_ptr =
+                    static_cast<const PrecisionT *>(cost.request().ptr);
+                const pybind11::gil_scoped_release release;
+                st.applyCostLayer(cost_ptr, wires, gamma, inverse);
+            };
+        pyclass.def("applyCostLayer", func, doc.c_str());
+    }
+
+    { // Register Pauli rotation
+        const std::string doc =
+            "Apply exp(-i theta P / 2) for a Pauli word P in a single pass.";
+        auto func = [](SVType &st, const std::vector<size_t> &wires,
+                       bool inverse, const std::vector<ParamT> &params,
+                       const std::string &word) {
+            PL_ABORT_IF(params.size() != 1,
+                        "The Pauli rotation requires a single parameter.");
+            st.applyPauliRot(wires, inverse, params[0], word);
+        };
+        pyclass.def(std::string(Gates::pauli_rot_name).c_str(), func,
+                    doc.c_str(),
+                    pybind11::call_guard<pybind11::gil_scoped_release>());
+    }
+
+    { // Register Trotterized time evolution
+        const std::string doc =
+            "Apply exp(-i H t) for a Hamiltonian H given by coefficients and "
+            "Pauli words, approximated by a product formula of the given "
+            "order in num_steps steps.";
+        auto func = [](SVType &st, const std::vector<ParamT> &coeffs,
+                       const std::vector<std::string> &words,
+                       const std::vector<std::vector<size_t>> &wires,
+                       ParamT time, size_t num_steps, size_t order) {
+            TrotterEvolution<PrecisionT> evolution(
+                PauliSum<PrecisionT>(coeffs, words, wires), st.getNumQubits(),
+                order);
+            evolution.evolve(st, time, num_steps);
+        };
+        pyclass.def("applyTimeEvolution", func, doc.c_str(),
+                    pybind11::call_guard<pybind11::gil_scoped_release>());
+    }
+
     Util::for_each_enum<GateOperation>([&pyclass](GateOperation gate_op) {
         const auto gate_name =
             std::string(lookup(Constant::gate_names, gate_op));
@@ -237,7 +662,8 @@ void registerGatesForStateVector(PyClass &pyclass) {
                         bool inverse, const std::vector<ParamT> &params) {
             sv.applyOperation(gate_name, wires, inverse, params);
         };
-        pyclass.def(gate_name.c_str(), func, doc.c_str());
+        pyclass.def(gate_name.c_str(), func, doc.c_str(),
+                    pybind11::call_guard<pybind11::gil_scoped_release>());
     });
 }
 
@@ -275,6 +701,28 @@ auto svKernelMap(const StateVectorRawCPU<PrecisionT> &sv) -> pybind11::dict {
     return res_map;
 }
 
+/**
+ * @brief Get the calls, time and memory traffic recorded by the dispatcher
+ * for each operation, kernel and number of qubits. The profile is empty
+ * unless compiled with `ENABLE_DISPATCH_PROFILING`.
+ *
+ * @tparam PrecisionT Precision of the statevector data.
+ */
+template <class PrecisionT> auto dispatchProfile() -> pybind11::list {
+    using namespace pybind11::literals;
+    pybind11::list res;
+    for (const auto &[key, record] :
+         Gates::DispatchProfiler<PrecisionT>::getInstance().getRecords()) {
+        res.append(pybind11::dict(
+            "op"_a = std::string(key.op_name),
+            "kernel"_a = std::string(
+                Util::lookup(Gates::kernel_id_name_pairs, key.kernel)),
+            "num_qubits"_a = key.num_qubits, "calls"_a = record.calls,
+            "seconds"_a = record.seconds, "bytes"_a = record.bytes));
+    }
+    return res;
+}
+
 /**
  * @brief Return basic information of the compiled binary.
  */
@@ -317,7 +765,11 @@ auto getCompileInfo() -> pybind11::dict {
     return pybind11::dict("cpu.arch"_a = cpu_arch_str,
                           "compiler.name"_a = compiler_name_str,
                           "compiler.version"_a = compiler_version_str,
-                          "AVX2"_a = use_avx2, "AVX512F"_a = use_avx512f);
+                          "AVX2"_a = use_avx2, "AVX512F"_a = use_avx512f,
+                          "NEON"_a = use_neon,
+                          "runtime_dispatch"_a = use_runtime_dispatch,
+                          "dispatch_profiling"_a = use_dispatch_profiling,
+                          "tracing"_a = use_tracing);
 }
 
 /**
@@ -329,7 +781,9 @@ auto getRuntimeInfo() -> pybind11::dict {
 
     return pybind11::dict("AVX"_a = RuntimeInfo::AVX(),
                           "AVX2"_a = RuntimeInfo::AVX2(),
-                          "AVX512F"_a = RuntimeInfo::AVX512F());
+                          "AVX512F"_a = RuntimeInfo::AVX512F(),
+                          "NEON"_a = RuntimeInfo::NEON(),
+                          "SVE"_a = RuntimeInfo::SVE());
 }
 
 /**
@@ -0,0 +1,180 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines the DLPack tensor structures used to exchange data with other
+ * frameworks, e.g. JAX and PyTorch, without copying it.
+ *
+ * The structures follow the ABI of the unversioned `DLManagedTensor` of
+ * DLPack 0.8, which is understood by all frameworks implementing
+ * `__dlpack__`.
+ */
+#pragma once
+
+#include "Error.hpp"
+
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Pennylane::DLPack {
+/**
+ * @brief Device types of DLPack.
+ */
+enum DLDeviceType : int32_t {
+    kDLCPU = 1,
+};
+
+/**
+ * @brief Type codes of DLPack.
+ */
+enum DLDataTypeCode : uint8_t {
+    kDLInt = 0U,
+    kDLUInt = 1U,
+    kDLFloat = 2U,
+    kDLComplex = 5U,
+};
+
+/**
+ * @brief Device holding the data of a tensor.
+ */
+struct DLDevice {
+    int32_t device_type;
+    int32_t device_id;
+};
+
+/**
+ * @brief Type of the elements of a tensor.
+ */
+struct DLDataType {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+};
+
+/**
+ * @brief Tensor whose data is owned by another object.
+ */
+struct DLTensor {
+    void *data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t *shape;
+    int64_t *strides; // in elements, or nullptr if row-major
+    uint64_t byte_offset;
+};
+
+/**
+ * @brief Tensor with the context which manages its memory.
+ *
+ * The consumer calls the deleter once it no longer needs the data.
+ */
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void *manager_ctx;
+    void (*deleter)(DLManagedTensor *self);
+};
+
+/**
+ * @brief Get the DLPack type of a C++ type.
+ *
+ * @tparam T Element type.
+ */
+template <class T> constexpr auto dataTypeOf() -> DLDataType {
+    constexpr auto bits = static_cast<uint8_t>(8 * sizeof(T));
+    if constexpr (std::is_same_v<T, std::complex<float>> ||
+                  std::is_same_v<T, std::complex<double>>) {
+        return {kDLComplex, bits, 1};
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return {kDLFloat, bits, 1};
+    } else if constexpr (std::is_signed_v<T>) {
+        return {kDLInt, bits, 1};
+    } else {
+        static_assert(std::is_unsigned_v<T>, "Unsupported DLPack type.");
+        return {kDLUInt, bits, 1};
+    }
+}
+
+/**
+ * @brief Create a managed tensor of the data kept alive by an owner.
+ *
+ * The tensor stores the owner, shape and strides in its context, which is
+ * destroyed by the deleter.
+ *
+ * @tparam T Element type.
+ * @param data Pointer to the data.
+ * @param shape Shape of the tensor.
+ * @param strides Strides of the tensor in elements. Row-major if empty.
+ * @param owner Object keeping the data alive.
+ * @return Pointer to the tensor, which must be passed to its deleter.
+ */
+template <class T>
+auto makeManagedTensor(T *data, std::vector<int64_t> shape,
+                       std::vector<int64_t> strides,
+                       std::shared_ptr<void> owner) -> DLManagedTensor * {
+    PL_ABORT_IF(!strides.empty() && strides.size() != shape.size(),
+                "The strides do not match the shape.");
+    struct Context {
+        DLManagedTensor tensor;
+        std::vector<int64_t> shape;
+        std::vector<int64_t> strides;
+        std::shared_ptr<void> owner;
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto *ctx = new Context{{}, std::move(shape), std::move(strides),
+                            std::move(owner)};
+    ctx->tensor.dl_tensor = {
+        static_cast<void *>(const_cast<std::remove_const_t<T> *>(data)),
+        {kDLCPU, 0},
+        static_cast<int32_t>(ctx->shape.size()),
+        dataTypeOf<std::remove_const_t<T>>(),
+        ctx->shape.data(),
+        ctx->strides.empty() ? nullptr : ctx->strides.data(),
+        0};
+    ctx->tensor.manager_ctx = ctx;
+    ctx->tensor.deleter = [](DLManagedTensor *self) {
+        delete static_cast<Context *>(self->manager_ctx); // NOLINT
+    };
+    return &ctx->tensor;
+}
+
+/**
+ * @brief Check whether a tensor holds a contiguous statevector on the CPU.
+ *
+ * @tparam T Complex type of the amplitudes.
+ * @param tensor Tensor to check.
+ * @return The number of amplitudes.
+ */
+template <class T> auto checkStateVector(const DLTensor &tensor) -> size_t {
+    PL_ABORT_IF(tensor.device.device_type != kDLCPU,
+                "The tensor must be on the CPU.");
+    constexpr DLDataType dtype = dataTypeOf<T>();
+    PL_ABORT_IF(tensor.dtype.code != dtype.code ||
+                    tensor.dtype.bits != dtype.bits ||
+                    tensor.dtype.lanes != dtype.lanes,
+                "The tensor must be of type complex64 or complex128 matching "
+                "the precision of the statevector.");
+    PL_ABORT_IF(tensor.ndim != 1, "The tensor must be 1-dimensional.");
+    PL_ABORT_IF(tensor.strides != nullptr && tensor.shape[0] > 1 &&
+                    tensor.strides[0] != 1,
+                "The tensor must be contiguous.");
+    PL_ABORT_IF(tensor.byte_offset % alignof(T) != 0,
+                "The tensor data is misaligned.");
+    return static_cast<size_t>(tensor.shape[0]);
+}
+} // namespace Pennylane::DLPack
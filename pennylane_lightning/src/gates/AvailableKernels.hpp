@@ -18,21 +18,65 @@
  */
 #pragma once
 
+#include "Macros.hpp"
 #include "TypeList.hpp"
+#include "cpu_kernels/GateImplementationsAVX2.hpp"
+#include "cpu_kernels/GateImplementationsAVX512.hpp"
 #include "cpu_kernels/GateImplementationsLM.hpp"
+#include "cpu_kernels/GateImplementationsNEON.hpp"
 #include "cpu_kernels/GateImplementationsPI.hpp"
+#include "cpu_kernels/GateImplementationsParallelLM.hpp"
 #include "cpu_kernels/QChemGateImplementations.hpp"
 
 namespace Pennylane {
+/**
+ * @brief List of kernels compiled for the instruction set of the build
+ * target.
+ *
+ * AVX and NEON kernels are only in this list when the library is compiled
+ * with the corresponding instruction set.
+ */
+#if defined(PL_USE_AVX512F)
+using BaselineKernels =
+    Util::TypeList<Gates::GateImplementationsLM, Gates::GateImplementationsPI,
+                   Gates::GateImplementationsParallelLM,
+                   Gates::GateImplementationsAVX2,
+                   Gates::GateImplementationsAVX512, void>;
+#elif defined(PL_USE_AVX2)
+using BaselineKernels =
+    Util::TypeList<Gates::GateImplementationsLM, Gates::GateImplementationsPI,
+                   Gates::GateImplementationsParallelLM,
+                   Gates::GateImplementationsAVX2, void>;
+#elif defined(PL_USE_NEON)
+using BaselineKernels =
+    Util::TypeList<Gates::GateImplementationsLM, Gates::GateImplementationsPI,
+                   Gates::GateImplementationsParallelLM,
+                   Gates::GateImplementationsNEON, void>;
+#else
+using BaselineKernels =
+    Util::TypeList<Gates::GateImplementationsLM, Gates::GateImplementationsPI,
+                   Gates::GateImplementationsParallelLM, void>;
+#endif
+
 /**
  * @brief List of all available kernels (gate implementations).
  *
  * If you want to add another gate implementation, just add it to this type
- * list.
+ * list. With runtime dispatch, the AVX kernels are compiled for their
+ * instruction sets in separate translation units (see
+ * KernelFuncTablesAVX2.cpp) and are registered to the dynamic dispatcher
+ * only if the CPU supports them. Otherwise, this is BaselineKernels.
  * @rst
  * See :ref:`lightning_add_gate_implementation` for details.
  * @endrst
  */
-using AvailableKernels = Util::TypeList<Gates::GateImplementationsLM,
-                                        Gates::GateImplementationsPI, void>;
+#if defined(_ENABLE_RUNTIME_DISPATCH) && !defined(PL_USE_AVX512F)
+using AvailableKernels =
+    Util::TypeList<Gates::GateImplementationsLM, Gates::GateImplementationsPI,
+                   Gates::GateImplementationsParallelLM,
+                   Gates::GateImplementationsAVX2,
+                   Gates::GateImplementationsAVX512, void>;
+#else
+using AvailableKernels = BaselineKernels;
+#endif
 } // namespace Pennylane
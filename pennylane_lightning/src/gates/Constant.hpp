@@ -39,6 +39,34 @@ namespace Pennylane::Gates::Constant {
     MatrixOperation::MultiQubitOp,
 };
 
+/**
+ * @brief List of gates which are diagonal in the computational basis
+ */
+[[maybe_unused]] constexpr std::array diagonal_gates{
+    GateOperation::Identity,
+    GateOperation::PauliZ,
+    GateOperation::S,
+    GateOperation::T,
+    GateOperation::PhaseShift,
+    GateOperation::RZ,
+    GateOperation::CZ,
+    GateOperation::IsingZZ,
+    GateOperation::ControlledPhaseShift,
+    GateOperation::CRZ,
+    GateOperation::MultiRZ,
+};
+
+/**
+ * @brief List of parameter-free Clifford gates, which map Pauli operators
+ * to Pauli operators under conjugation
+ */
+[[maybe_unused]] constexpr std::array clifford_gates{
+    GateOperation::Identity, GateOperation::PauliX, GateOperation::PauliY,
+    GateOperation::PauliZ,   GateOperation::Hadamard, GateOperation::S,
+    GateOperation::CNOT,     GateOperation::CY,       GateOperation::CZ,
+    GateOperation::SWAP,
+};
+
 /**
  * @brief Gate names
  */
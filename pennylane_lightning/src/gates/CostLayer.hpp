@@ -0,0 +1,93 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file CostLayer.hpp
+ * Defines utility functions for cost layers @f$e^{-i\gamma C}@f$ of a cost
+ * operator @f$C@f$ which is diagonal in the computational basis, as in QAOA.
+ */
+#pragma once
+
+#include "Error.hpp"
+#include "Util.hpp"
+
+#include <bit>
+#include <complex>
+#include <string_view>
+#include <vector>
+
+namespace Pennylane::Gates {
+/**
+ * @brief Name of the cost layer operation in a list of operations.
+ *
+ * The operation has a single parameter @f$\gamma@f$, and the diagonal of the
+ * cost operator is given as the matrix of the operation.
+ */
+constexpr std::string_view cost_layer_name = "CostLayer";
+
+/**
+ * @brief Compute the diagonal of a weighted sum of products of Pauli Z
+ * operators.
+ *
+ * The element `i` is @f$\sum_j w_j \prod_{k \in t_j} (-1)^{i_k}@f$, where
+ * @f$i_k@f$ is bit `k` of `i` counted from the most significant bit, i.e.
+ * wire `k` of a `num_wires`-wire register.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @param num_wires Number of wires of the cost operator.
+ * @param terms Wires of each Pauli Z string, in [0, num_wires).
+ * @param weights Weight of each Pauli Z string.
+ * @return std::vector<PrecisionT>
+ */
+template <class PrecisionT>
+auto pauliZCost(size_t num_wires, const std::vector<std::vector<size_t>> &terms,
+                const std::vector<PrecisionT> &weights)
+    -> std::vector<PrecisionT> {
+    PL_ABORT_IF(terms.size() != weights.size(),
+                "The number of terms and weights must be equal.");
+    const size_t dim = Util::exp2(num_wires);
+    std::vector<PrecisionT> cost(dim, 0.0);
+    for (size_t term = 0; term < terms.size(); term++) {
+        size_t mask = 0;
+        for (const size_t wire : terms[term]) {
+            PL_ABORT_IF(wire >= num_wires, "Invalid wire index.");
+            mask ^= static_cast<size_t>(1U) << (num_wires - 1 - wire);
+        }
+        const PrecisionT weight = weights[term];
+        for (size_t idx = 0; idx < dim; idx++) {
+            const bool odd = (std::popcount(idx & mask) % 2) != 0;
+            cost[idx] += odd ? -weight : weight;
+        }
+    }
+    return cost;
+}
+
+/**
+ * @brief Diagonal of the cost layer @f$e^{-i\gamma C}@f$.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @param cost Pointer to the diagonal of the cost operator @f$C@f$.
+ * @param dim Size of the diagonal.
+ * @param gamma Parameter @f$\gamma@f$.
+ * @return std::vector<std::complex<PrecisionT>>
+ */
+template <class PrecisionT>
+auto costLayerDiagonal(const PrecisionT *cost, size_t dim, PrecisionT gamma)
+    -> std::vector<std::complex<PrecisionT>> {
+    std::vector<std::complex<PrecisionT>> diag(dim);
+    for (size_t idx = 0; idx < dim; idx++) {
+        diag[idx] = std::polar(PrecisionT{1.0}, -gamma * cost[idx]);
+    }
+    return diag;
+}
+} // namespace Pennylane::Gates
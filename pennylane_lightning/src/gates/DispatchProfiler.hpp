@@ -0,0 +1,145 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file DispatchProfiler.hpp
+ * Defines DispatchProfiler class, which accumulates the calls, time and
+ * memory traffic of operations applied through the dynamic dispatcher.
+ *
+ * The dispatcher only records calls when compiled with
+ * `-DENABLE_DISPATCH_PROFILING=ON`. Otherwise the profile stays empty and
+ * applying an operation has no overhead.
+ */
+#pragma once
+
+#include "KernelType.hpp"
+
+#include <chrono>
+#include <complex>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Pennylane::Gates {
+/**
+ * @brief Operation, kernel and number of qubits of dispatched calls.
+ */
+struct DispatchKey {
+    std::string_view op_name; ///< Name of a gate, generator or matrix op
+    KernelType kernel;
+    size_t num_qubits;
+
+    [[nodiscard]] auto tie() const {
+        return std::tie(op_name, kernel, num_qubits);
+    }
+    friend bool operator<(const DispatchKey &lhs, const DispatchKey &rhs) {
+        return lhs.tie() < rhs.tie();
+    }
+};
+
+/**
+ * @brief Number of calls, total time and total memory traffic of dispatched
+ * calls. The traffic assumes every amplitude is read and written once.
+ */
+struct DispatchRecord {
+    size_t calls = 0;
+    double seconds = 0.0;
+    size_t bytes = 0;
+};
+
+/**
+ * @brief Profile of the calls through DynamicDispatcher<PrecisionT>. All
+ * member functions are thread-safe.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data.
+ */
+template <class PrecisionT> class DispatchProfiler {
+  private:
+    std::mutex mutex_;
+    std::map<DispatchKey, DispatchRecord> records_;
+
+    DispatchProfiler() = default;
+
+  public:
+    /**
+     * @brief Get the singleton instance
+     */
+    static DispatchProfiler &getInstance() {
+        static DispatchProfiler profiler;
+        return profiler;
+    }
+
+    /**
+     * @brief Add a call to the profile.
+     *
+     * @param key Operation, kernel and number of qubits of the call.
+     * @param seconds Duration of the call.
+     */
+    void record(const DispatchKey &key, double seconds) {
+        const size_t bytes = 2 * (size_t{1} << key.num_qubits) *
+                             sizeof(std::complex<PrecisionT>);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto &record = records_[key];
+        record.calls++;
+        record.seconds += seconds;
+        record.bytes += bytes;
+    }
+
+    /**
+     * @brief Get all records, sorted by operation name, kernel and number of
+     * qubits.
+     */
+    [[nodiscard]] auto getRecords()
+        -> std::vector<std::pair<DispatchKey, DispatchRecord>> {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return {records_.begin(), records_.end()};
+    }
+
+    /**
+     * @brief Remove all records.
+     */
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        records_.clear();
+    }
+};
+
+/**
+ * @brief Record the time from construction to destruction of a dispatched
+ * call.
+ */
+template <class PrecisionT> class ScopedDispatchTimer {
+  private:
+    DispatchKey key_;
+    std::chrono::steady_clock::time_point start_;
+
+  public:
+    explicit ScopedDispatchTimer(const DispatchKey &key)
+        : key_{key}, start_{std::chrono::steady_clock::now()} {}
+
+    ScopedDispatchTimer(const ScopedDispatchTimer &) = delete;
+    ScopedDispatchTimer(ScopedDispatchTimer &&) = delete;
+    ScopedDispatchTimer &operator=(const ScopedDispatchTimer &) = delete;
+    ScopedDispatchTimer &operator=(ScopedDispatchTimer &&) = delete;
+
+    ~ScopedDispatchTimer() {
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start_;
+        DispatchProfiler<PrecisionT>::getInstance().record(key_,
+                                                           elapsed.count());
+    }
+};
+} // namespace Pennylane::Gates
@@ -21,6 +21,7 @@
 
 #include "Constant.hpp"
 #include "ConstantUtil.hpp"
+#include "DispatchProfiler.hpp"
 #include "Error.hpp"
 #include "GateUtil.hpp"
 #include "KernelType.hpp"
@@ -28,23 +29,74 @@
 #include "OpToMemberFuncPtr.hpp"
 #include "Util.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <complex>
-#include <functional>
+#include <exception>
+#include <optional>
+#include <stdexcept>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <variant>
 #include <vector>
 
 /// @cond DEV
 namespace Pennylane::Internal {
 /**
- * @brief Register all implemented gates for all available kernels.
+ * @brief Pointer type for a gate operation with parameters given as a vector.
  *
  * @tparam PrecisionT Floating point precision of underlying statevector data.
- * @tparam ParamT Floating point type for parameters
  */
-template <class PrecisionT, class ParamT> int registerAllAvailableKernels();
+template <class PrecisionT>
+using DispatchGateFuncPtrT =
+    void (*)(std::complex<PrecisionT> * /*data*/, size_t /*num_qubits*/,
+             const std::vector<size_t> & /*wires*/, bool /*inverse*/,
+             const std::vector<PrecisionT> & /*params*/);
+
+/**
+ * @brief Number of kernel types including KernelType::None.
+ */
+constexpr size_t num_dispatch_kernels =
+    static_cast<size_t>(Gates::KernelType::None) + 1;
+
+/**
+ * @brief Table of functions indexed by an operation and a kernel.
+ */
+template <class Operation, class Func>
+using KernelFuncTable =
+    std::array<std::array<Func, num_dispatch_kernels>,
+               static_cast<size_t>(Operation::END)>;
+
+/**
+ * @brief Functions of all operations of all available kernels. An entry is
+ * nullptr if the kernel does not implement the operation.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data.
+ */
+template <class PrecisionT> struct KernelFuncTables {
+    KernelFuncTable<Gates::GateOperation, DispatchGateFuncPtrT<PrecisionT>>
+        gates{};
+    KernelFuncTable<Gates::GeneratorOperation,
+                    Gates::GeneratorFuncPtrT<PrecisionT>>
+        generators{};
+    KernelFuncTable<Gates::MatrixOperation, Gates::MatrixFuncPtrT<PrecisionT>>
+        matrices{};
+};
+
+/**
+ * @brief Get the tables of all available kernels.
+ *
+ * The tables are generated at compile time from the `implemented_gates`,
+ * `implemented_generators`, and `implemented_matrices` arrays of the kernels
+ * in DynamicDispatcher.cpp. With runtime dispatch, the AVX kernels the CPU
+ * supports are added on the first call.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data.
+ */
+template <class PrecisionT>
+auto availableKernelFuncTables() -> const KernelFuncTables<PrecisionT> &;
 
 constexpr auto generatorNamesWithoutPrefix() {
     constexpr std::string_view prefix = "Generator";
@@ -60,74 +112,171 @@ constexpr auto generatorNamesWithoutPrefix() {
     return res;
 }
 
-} // namespace Pennylane::Internal
-/// @endcond
-
-namespace Pennylane {
 /**
- * @brief These functions are only used to register kernels to the dynamic
- * dispatcher.
+ * @brief Sort an array of operation and name pairs by names.
+ *
+ * @param arr Array of operation and name pairs.
+ * @return Array of name and operation pairs sorted by names.
  */
-template <class PrecisionT, class ParamT> struct RegisterBeforeMain;
+template <class Operation, size_t size>
+constexpr auto
+sortByName(const std::array<std::pair<Operation, std::string_view>, size> &arr)
+    -> std::array<std::pair<std::string_view, Operation>, size> {
+    auto res = Util::reverse_pairs(arr);
+    std::sort(res.begin(), res.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.first < rhs.first;
+    });
+    return res;
+}
 
-/// @cond DEV
-template <> struct RegisterBeforeMain<float, float> {
-    const static inline int dummy =
-        Internal::registerAllAvailableKernels<float, float>();
-};
+/**
+ * @brief Check all names of an array sorted by sortByName() are unique.
+ */
+template <class Operation, size_t size>
+constexpr auto
+hasUniqueNames(const std::array<std::pair<std::string_view, Operation>, size>
+                   &sorted) -> bool {
+    return std::adjacent_find(sorted.begin(), sorted.end(),
+                              [](const auto &lhs, const auto &rhs) {
+                                  return lhs.first == rhs.first;
+                              }) == sorted.end();
+}
 
-template <> struct RegisterBeforeMain<double, double> {
-    const static inline int dummy =
-        Internal::registerAllAvailableKernels<double, double>();
-};
+/**
+ * @brief Find the operation of the given name by a binary search.
+ *
+ * @param sorted Array sorted by sortByName().
+ * @param name Name to find.
+ * @return Operation, or std::nullopt if there is no operation of the name.
+ */
+template <class Operation, size_t size>
+constexpr auto
+findByName(const std::array<std::pair<std::string_view, Operation>, size>
+               &sorted,
+           std::string_view name) -> std::optional<Operation> {
+    const auto iter =
+        std::lower_bound(sorted.begin(), sorted.end(), name,
+                         [](const auto &elt, std::string_view key) {
+                             return elt.first < key;
+                         });
+    if (iter == sorted.end() || iter->first != name) {
+        return std::nullopt;
+    }
+    return iter->second;
+}
+} // namespace Pennylane::Internal
 /// @endcond
 
+namespace Pennylane {
 /**
  * @brief DynamicDispatcher class
  *
- * This class calls a gate/generator operation dynamically
+ * This class calls a gate/generator operation dynamically. All member
+ * functions are thread-safe. When compiled with `_ENABLE_DISPATCH_PROFILING`,
+ * applied operations are recorded to DispatchProfiler<PrecisionT>, except
+ * functions resolved once with getGateFunc() and called directly.
  */
 template <typename PrecisionT> class DynamicDispatcher {
   public:
     using CFP_t = std::complex<PrecisionT>;
 
-    using GateFunc = std::function<void(
-        std::complex<PrecisionT> * /*data*/, size_t /*num_qubits*/,
-        const std::vector<size_t> & /*wires*/, bool /*inverse*/,
-        const std::vector<PrecisionT> & /*params*/)>;
+    using GateFunc = Internal::DispatchGateFuncPtrT<PrecisionT>;
 
     using GeneratorFunc = Gates::GeneratorFuncPtrT<PrecisionT>;
     using MatrixFunc = Gates::MatrixFuncPtrT<PrecisionT>;
 
   private:
-    std::unordered_map<std::string, Gates::GateOperation> str_to_gates_;
-    std::unordered_map<std::string, Gates::GeneratorOperation> str_to_gntrs_;
+    constexpr static size_t num_kernels = Internal::num_dispatch_kernels;
 
-    std::unordered_map<std::pair<Gates::GateOperation, Gates::KernelType>,
-                       GateFunc, Util::PairHash>
-        gates_;
+    /**
+     * @brief Table of functions indexed by an operation and a kernel. An
+     * entry is nullptr if no function is registered.
+     *
+     * Operations and kernels are dense enums, so a lookup is a single
+     * indexing without hashing. Entries are atomic, so lookups are lock-free
+     * and safe while another thread registers a kernel.
+     */
+    template <class Operation, class Func>
+    using DispatchTable =
+        std::array<std::array<std::atomic<Func>, num_kernels>,
+                   static_cast<size_t>(Operation::END)>;
 
-    std::unordered_map<std::pair<Gates::GeneratorOperation, Gates::KernelType>,
-                       GeneratorFunc, Util::PairHash>
-        generators_;
+    /**
+     * @brief Gate and generator names sorted for a binary search.
+     */
+    constexpr static auto gate_names_ =
+        Internal::sortByName(Gates::Constant::gate_names);
+    constexpr static auto gntr_names_ =
+        Internal::sortByName(Internal::generatorNamesWithoutPrefix());
+    static_assert(Internal::hasUniqueNames(gate_names_) &&
+                      Internal::hasUniqueNames(gntr_names_),
+                  "Operation names must be unique.");
+
+    DispatchTable<Gates::GateOperation, GateFunc> gates_{};
+    DispatchTable<Gates::GeneratorOperation, GeneratorFunc> generators_{};
+    DispatchTable<Gates::MatrixOperation, MatrixFunc> matrices_{};
 
-    std::unordered_map<std::pair<Gates::MatrixOperation, Gates::KernelType>,
-                       MatrixFunc, Util::PairHash>
-        matrices_;
+    /**
+     * @brief Get the entry of a dispatch table, or nullptr if the operation
+     * or the kernel is out of range.
+     */
+    template <class Operation, class Func>
+    [[nodiscard]] static auto lookupTable(
+        const DispatchTable<Operation, Func> &table, Operation op,
+        Gates::KernelType kernel) -> Func {
+        const auto op_idx = static_cast<size_t>(op);
+        const auto kernel_idx = static_cast<size_t>(kernel);
+        if (op_idx >= table.size() || kernel_idx >= num_kernels) {
+            return nullptr;
+        }
+        return table[op_idx][kernel_idx].load(std::memory_order_acquire);
+    }
 
-    DynamicDispatcher() {
-        using Gates::KernelType;
-        constexpr static auto gntr_names_without_prefix =
-            Internal::generatorNamesWithoutPrefix();
+    /**
+     * @brief Set the entry of a dispatch table unless already registered.
+     */
+    template <class Operation, class Func>
+    static void registerTable(DispatchTable<Operation, Func> &table,
+                              Operation op, Gates::KernelType kernel,
+                              Func func) {
+        const auto op_idx = static_cast<size_t>(op);
+        const auto kernel_idx = static_cast<size_t>(kernel);
+        PL_ABORT_IF(op_idx >= table.size() || kernel_idx >= num_kernels,
+                    "Invalid operation or kernel to register.");
+        Func expected = nullptr;
+        table[op_idx][kernel_idx].compare_exchange_strong(
+            expected, func, std::memory_order_release,
+            std::memory_order_relaxed);
+    }
 
-        for (const auto &[gate_op, gate_name] : Gates::Constant::gate_names) {
-            str_to_gates_.emplace(gate_name, gate_op);
-        }
-        for (const auto &[gntr_op, gntr_name] : gntr_names_without_prefix) {
-            str_to_gntrs_.emplace(gntr_name, gntr_op);
+    /**
+     * @brief Initialize a dispatch table from a table of functions.
+     */
+    template <class Table, class FuncTable>
+    static void copyTable(Table &table, const FuncTable &funcs) {
+        static_assert(std::tuple_size_v<Table> ==
+                      std::tuple_size_v<FuncTable>);
+        for (size_t op_idx = 0; op_idx < table.size(); op_idx++) {
+            for (size_t kernel_idx = 0; kernel_idx < num_kernels;
+                 kernel_idx++) {
+                table[op_idx][kernel_idx].store(funcs[op_idx][kernel_idx],
+                                                std::memory_order_relaxed);
+            }
         }
     }
 
+    /**
+     * @brief Construct the dispatcher with all implemented operations of
+     * all available kernels registered, copying the tables generated at
+     * compile time.
+     */
+    DynamicDispatcher() {
+        const auto &funcs = Internal::availableKernelFuncTables<PrecisionT>();
+        copyTable(gates_, funcs.gates);
+        copyTable(generators_, funcs.generators);
+        copyTable(matrices_, funcs.matrices);
+    }
+
   public:
     /**
      * @brief Get the singleton instance
@@ -144,7 +293,30 @@ template <typename PrecisionT> class DynamicDispatcher {
      */
     [[nodiscard]] auto strToGateOp(const std::string &gate_name) const
         -> Gates::GateOperation {
-        return str_to_gates_.at(gate_name);
+        const auto gate_op = Internal::findByName(gate_names_, gate_name);
+        if (!gate_op) {
+            throw std::out_of_range("Unknown gate operation " + gate_name);
+        }
+        return *gate_op;
+    }
+
+    /**
+     * @brief Check if the name is the name of a gate operation
+     *
+     * @param gate_name Gate name
+     */
+    [[nodiscard]] auto hasGateOp(const std::string &gate_name) const -> bool {
+        return Internal::findByName(gate_names_, gate_name).has_value();
+    }
+
+    /**
+     * @brief Check if the name is the name of a generator operation
+     *
+     * @param gntr_name Generator name without "Generator" prefix
+     */
+    [[nodiscard]] auto hasGeneratorOp(const std::string &gntr_name) const
+        -> bool {
+        return Internal::findByName(gntr_names_, gntr_name).has_value();
     }
 
     /**
@@ -154,7 +326,12 @@ template <typename PrecisionT> class DynamicDispatcher {
      */
     [[nodiscard]] auto strToGeneratorOp(const std::string &gntr_name) const
         -> Gates::GeneratorOperation {
-        return str_to_gntrs_.at(gntr_name);
+        const auto gntr_op = Internal::findByName(gntr_names_, gntr_name);
+        if (!gntr_op) {
+            throw std::out_of_range("Unknown generator operation " +
+                                    gntr_name);
+        }
+        return *gntr_op;
     }
 
     /**
@@ -164,9 +341,8 @@ template <typename PrecisionT> class DynamicDispatcher {
     template <typename FunctionType>
     void registerGateOperation(Gates::GateOperation gate_op,
                                Gates::KernelType kernel, FunctionType &&func) {
-        // TODO: Add mutex when we go to multithreading
-        gates_.emplace(std::make_pair(gate_op, kernel),
-                       std::forward<FunctionType>(func));
+        registerTable(gates_, gate_op, kernel,
+                      GateFunc{std::forward<FunctionType>(func)});
     }
 
     /**
@@ -177,9 +353,8 @@ template <typename PrecisionT> class DynamicDispatcher {
     void registerGeneratorOperation(Gates::GeneratorOperation gntr_op,
                                     Gates::KernelType kernel,
                                     FunctionType &&func) {
-        // TODO: Add mutex when we go to multithreading
-        generators_.emplace(std::make_pair(gntr_op, kernel),
-                            std::forward<FunctionType>(func));
+        registerTable(generators_, gntr_op, kernel,
+                      GeneratorFunc{std::forward<FunctionType>(func)});
     }
 
     /**
@@ -190,8 +365,7 @@ template <typename PrecisionT> class DynamicDispatcher {
     void registerMatrixOperation(Gates::MatrixOperation mat_op,
                                  Gates::KernelType kernel, MatrixFunc func) {
         // FunctionType&& func) {
-        // TODO: Add mutex when we go to multithreading
-        matrices_.emplace(std::make_pair(mat_op, kernel), func);
+        registerTable(matrices_, mat_op, kernel, func);
     }
 
     /**
@@ -203,7 +377,7 @@ template <typename PrecisionT> class DynamicDispatcher {
      */
     bool isRegistered(Gates::GateOperation gate_op,
                       Gates::KernelType kernel) const {
-        return gates_.find(std::make_pair(gate_op, kernel)) != gates_.cend();
+        return lookupTable(gates_, gate_op, kernel) != nullptr;
     }
 
     /**
@@ -215,8 +389,7 @@ template <typename PrecisionT> class DynamicDispatcher {
      */
     bool isRegistered(Gates::GeneratorOperation gntr_op,
                       Gates::KernelType kernel) const {
-        return generators_.find(std::make_pair(gntr_op, kernel)) !=
-               generators_.cend();
+        return lookupTable(generators_, gntr_op, kernel) != nullptr;
     }
 
     /**
@@ -228,8 +401,28 @@ template <typename PrecisionT> class DynamicDispatcher {
      */
     bool isRegistered(Gates::MatrixOperation mat_op,
                       Gates::KernelType kernel) const {
-        return matrices_.find(std::make_pair(mat_op, kernel)) !=
-               matrices_.cend();
+        return lookupTable(matrices_, mat_op, kernel) != nullptr;
+    }
+
+    /**
+     * @brief Get the kernel function registered for the given gate operation
+     * and kernel.
+     *
+     * A function can be resolved once and called many times.
+     *
+     * @param gate_op Gate operation
+     * @param kernel Kernel
+     */
+    [[nodiscard]] auto getGateFunc(Gates::GateOperation gate_op,
+                                   Gates::KernelType kernel) const
+        -> GateFunc {
+        const GateFunc func = lookupTable(gates_, gate_op, kernel);
+        if (func == nullptr) {
+            throw std::invalid_argument(
+                "Cannot find a registered kernel for a given gate "
+                "and kernel pair");
+        }
+        return func;
     }
 
     /**
@@ -247,14 +440,8 @@ template <typename PrecisionT> class DynamicDispatcher {
                         size_t num_qubits, const std::string &op_name,
                         const std::vector<size_t> &wires, bool inverse,
                         const std::vector<PrecisionT> &params = {}) const {
-        const auto iter =
-            gates_.find(std::make_pair(strToGateOp(op_name), kernel));
-        if (iter == gates_.cend()) {
-            throw std::invalid_argument(
-                "Cannot find a registered kernel for a given gate "
-                "and kernel pair");
-        }
-        (iter->second)(data, num_qubits, wires, inverse, params);
+        applyOperation(kernel, data, num_qubits, strToGateOp(op_name), wires,
+                       inverse, params);
     }
 
     /**
@@ -272,13 +459,64 @@ template <typename PrecisionT> class DynamicDispatcher {
                         size_t num_qubits, Gates::GateOperation gate_op,
                         const std::vector<size_t> &wires, bool inverse,
                         const std::vector<PrecisionT> &params = {}) const {
-        const auto iter = gates_.find(std::make_pair(gate_op, kernel));
-        if (iter == gates_.cend()) {
-            throw std::invalid_argument(
-                "Cannot find a registered kernel for a given gate "
-                "and kernel pair");
+        const GateFunc func = getGateFunc(gate_op, kernel);
+#if defined(_ENABLE_DISPATCH_PROFILING)
+        const Gates::ScopedDispatchTimer<PrecisionT> timer(
+            {Util::lookup(Gates::Constant::gate_names, gate_op), kernel,
+             num_qubits});
+#endif
+        func(data, num_qubits, wires, inverse, params);
+    }
+
+    /**
+     * @brief Apply a single gate to a batch of statevectors using the given
+     * kernel.
+     *
+     * The kernel function is looked up once for the whole batch, and the
+     * statevectors are distributed over threads.
+     *
+     * @param kernel Kernel to run the gate operation.
+     * @param data Pointers to the data of the statevectors.
+     * @param num_states Number of statevectors.
+     * @param num_qubits Number of qubits of each statevector.
+     * @param gate_op Gate operation.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Parameter list of the gate.
+     * @param num_threads Number of threads distributing the statevectors.
+     */
+    void applyOperationBatch(Gates::KernelType kernel, CFP_t *const *data,
+                             size_t num_states, size_t num_qubits,
+                             Gates::GateOperation gate_op,
+                             const std::vector<size_t> &wires, bool inverse,
+                             const std::vector<PrecisionT> &params,
+                             [[maybe_unused]] size_t num_threads) const {
+        const GateFunc func = getGateFunc(gate_op, kernel);
+#if defined(_ENABLE_DISPATCH_PROFILING)
+        const Gates::ScopedDispatchTimer<PrecisionT> timer(
+            {Util::lookup(Gates::Constant::gate_names, gate_op), kernel,
+             num_qubits});
+#endif
+        // clang-format off
+        std::exception_ptr ex = nullptr;
+        #if defined(_OPENMP)
+            #pragma omp parallel for num_threads(num_threads) \
+                if(num_threads > 1 && num_states > 1)
+        #endif
+        for (size_t state = 0; state < num_states; state++) {
+            try {
+                func(data[state], num_qubits, wires, inverse, params);
+            } catch (...) {
+                #if defined(_OPENMP)
+                    #pragma omp critical
+                #endif
+                ex = std::current_exception();
+            }
         }
-        (iter->second)(data, num_qubits, wires, inverse, params);
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+        // clang-format on
     }
 
     /**
@@ -363,15 +601,19 @@ template <typename PrecisionT> class DynamicDispatcher {
             }
         }();
 
-        const auto iter = matrices_.find(std::make_pair(mat_op, kernel));
-
-        if (iter == matrices_.end()) {
+        const MatrixFunc func = lookupTable(matrices_, mat_op, kernel);
+        if (func == nullptr) {
             throw std::invalid_argument(
                 std::string(
                     Util::lookup(Gates::Constant::matrix_names, mat_op)) +
                 " is not registered for the given kernel");
         }
-        (iter->second)(data, num_qubits, matrix, wires, inverse);
+#if defined(_ENABLE_DISPATCH_PROFILING)
+        const Gates::ScopedDispatchTimer<PrecisionT> timer(
+            {Util::lookup(Gates::Constant::matrix_names, mat_op), kernel,
+             num_qubits});
+#endif
+        func(data, num_qubits, matrix, wires, inverse);
     }
 
     /**
@@ -411,13 +653,17 @@ template <typename PrecisionT> class DynamicDispatcher {
                         const std::vector<size_t> &wires, bool adj) const
         -> PrecisionT {
         using Gates::Constant::generator_names;
-        const auto iter = generators_.find(std::make_pair(gntr_op, kernel));
-        if (iter == generators_.cend()) {
+        const GeneratorFunc func = lookupTable(generators_, gntr_op, kernel);
+        if (func == nullptr) {
             throw std::invalid_argument(
                 "Cannot find a registered kernel for a given generator "
                 "and kernel pair.");
         }
-        return (iter->second)(data, num_qubits, wires, adj);
+#if defined(_ENABLE_DISPATCH_PROFILING)
+        const Gates::ScopedDispatchTimer<PrecisionT> timer(
+            {Util::lookup(generator_names, gntr_op), kernel, num_qubits});
+#endif
+        return func(data, num_qubits, wires, adj);
     }
     /**
      * @brief Apply a single generator to the state-vector using the given
@@ -434,14 +680,8 @@ template <typename PrecisionT> class DynamicDispatcher {
                         size_t num_qubits, const std::string &op_name,
                         const std::vector<size_t> &wires, bool adj) const
         -> PrecisionT {
-        const auto iter =
-            generators_.find(std::make_pair(strToGeneratorOp(op_name), kernel));
-        if (iter == generators_.cend()) {
-            throw std::invalid_argument(
-                "Cannot find a registered kernel for a given generator "
-                "and kernel pair.");
-        }
-        return (iter->second)(data, num_qubits, wires, adj);
+        return applyGenerator(kernel, data, num_qubits,
+                              strToGeneratorOp(op_name), wires, adj);
     }
 };
 } // namespace Pennylane
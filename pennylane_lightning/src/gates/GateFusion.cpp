@@ -0,0 +1,143 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "GateFusion.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace Pennylane::Gates {
+auto partitionForFusion(const std::vector<std::vector<size_t>> &ops_wires,
+                        size_t max_wires) -> std::vector<FusedGateBlock> {
+    return partitionForFusion(ops_wires,
+                              std::vector<bool>(ops_wires.size(), false),
+                              max_wires, max_wires);
+}
+
+auto partitionForFusion(const std::vector<std::vector<size_t>> &ops_wires,
+                        const std::vector<bool> &ops_diagonal,
+                        size_t max_wires, size_t max_diagonal_wires)
+    -> std::vector<FusedGateBlock> {
+    PL_ABORT_IF_NOT(ops_diagonal.size() == ops_wires.size(),
+                    "The number of operations and diagonal flags must be "
+                    "equal.");
+    std::vector<FusedGateBlock> blocks;
+    FusedGateBlock current;
+
+    for (size_t op_idx = 0; op_idx < ops_wires.size(); op_idx++) {
+        std::vector<size_t> op_wires = ops_wires[op_idx];
+        std::sort(op_wires.begin(), op_wires.end());
+        const bool op_diagonal = ops_diagonal[op_idx];
+
+        std::vector<size_t> merged;
+        std::set_union(current.wires.begin(), current.wires.end(),
+                       op_wires.begin(), op_wires.end(),
+                       std::back_inserter(merged));
+
+        const bool diagonal =
+            (current.op_indices.empty() || current.diagonal) && op_diagonal;
+        const size_t limit = diagonal ? max_diagonal_wires : max_wires;
+        if (!current.op_indices.empty() && merged.size() > limit) {
+            blocks.emplace_back(std::move(current));
+            current = FusedGateBlock{};
+            merged = std::move(op_wires);
+            current.diagonal = op_diagonal;
+        } else {
+            current.diagonal = diagonal;
+        }
+        current.op_indices.emplace_back(op_idx);
+        current.wires = std::move(merged);
+    }
+    if (!current.op_indices.empty()) {
+        blocks.emplace_back(std::move(current));
+    }
+    return blocks;
+}
+
+auto partitionIntoLayers(const std::vector<std::vector<size_t>> &ops_wires)
+    -> std::vector<std::vector<size_t>> {
+    std::vector<std::vector<size_t>> layers;
+    // Number of layers up to the last one acting on each wire
+    std::vector<size_t> wire_depth;
+    for (size_t op_idx = 0; op_idx < ops_wires.size(); op_idx++) {
+        size_t layer = 0;
+        for (const size_t wire : ops_wires[op_idx]) {
+            if (wire >= wire_depth.size()) {
+                wire_depth.resize(wire + 1, 0);
+            }
+            layer = std::max(layer, wire_depth[wire]);
+        }
+        for (const size_t wire : ops_wires[op_idx]) {
+            wire_depth[wire] = layer + 1;
+        }
+        if (layer == layers.size()) {
+            layers.emplace_back();
+        }
+        layers[layer].emplace_back(op_idx);
+    }
+    return layers;
+}
+
+auto partitionForProducts(const std::vector<std::vector<size_t>> &ops_wires,
+                          size_t max_wires) -> std::vector<FusedGateBlock> {
+    PL_ABORT_IF(max_wires == 0,
+                "The maximum number of wires of a block must be positive.");
+    std::vector<FusedGateBlock> blocks;
+    std::vector<size_t> single;
+    for (const auto &layer : partitionIntoLayers(ops_wires)) {
+        single.clear();
+        for (const size_t op_idx : layer) {
+            if (ops_wires[op_idx].size() == 1) {
+                single.emplace_back(op_idx);
+            } else {
+                std::vector<size_t> wires = ops_wires[op_idx];
+                std::sort(wires.begin(), wires.end());
+                blocks.push_back({{op_idx}, std::move(wires), false});
+            }
+        }
+        std::sort(single.begin(), single.end(), [&](size_t lhs, size_t rhs) {
+            return ops_wires[lhs][0] < ops_wires[rhs][0];
+        });
+        for (size_t begin = 0; begin < single.size(); begin += max_wires) {
+            const size_t end = std::min(begin + max_wires, single.size());
+            FusedGateBlock block;
+            for (size_t k = begin; k < end; k++) {
+                block.op_indices.emplace_back(single[k]);
+                block.wires.emplace_back(ops_wires[single[k]][0]);
+            }
+            blocks.emplace_back(std::move(block));
+        }
+    }
+    return blocks;
+}
+
+auto getLocalWires(const FusedGateBlock &block,
+                   const std::vector<std::vector<size_t>> &ops_wires)
+    -> std::vector<std::vector<size_t>> {
+    std::vector<std::vector<size_t>> local_wires;
+    local_wires.reserve(block.op_indices.size());
+    for (const size_t op_idx : block.op_indices) {
+        std::vector<size_t> op_local_wires;
+        op_local_wires.reserve(ops_wires[op_idx].size());
+        for (const size_t wire : ops_wires[op_idx]) {
+            const auto iter = std::lower_bound(block.wires.begin(),
+                                               block.wires.end(), wire);
+            PL_ASSERT(iter != block.wires.end() && *iter == wire);
+            op_local_wires.emplace_back(
+                static_cast<size_t>(iter - block.wires.begin()));
+        }
+        local_wires.emplace_back(std::move(op_local_wires));
+    }
+    return local_wires;
+}
+} // namespace Pennylane::Gates
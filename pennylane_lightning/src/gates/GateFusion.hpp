@@ -0,0 +1,245 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file GateFusion.hpp
+ * Defines utility functions for fusing consecutive gates into a single dense
+ * matrix.
+ */
+#pragma once
+
+#include "Constant.hpp"
+#include "ConstantUtil.hpp"
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "KernelType.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <string>
+#include <vector>
+
+namespace Pennylane::Gates {
+/**
+ * @brief Maximum number of wires a fused gate may act on.
+ *
+ * A fused gate acting on @f$n@f$ wires is applied as a dense
+ * @f$2^n \times 2^n@f$ matrix, so the arithmetic cost per amplitude grows
+ * exponentially with @f$n@f$.
+ */
+constexpr size_t max_fused_wires = 5;
+
+/**
+ * @brief Maximum number of wires a fused diagonal gate may act on.
+ *
+ * A fused diagonal gate acting on @f$n@f$ wires is applied as
+ * @f$2^n@f$ diagonal elements, so the arithmetic cost per amplitude does not
+ * depend on @f$n@f$. The limit only bounds the size of the diagonal.
+ */
+constexpr size_t max_fused_diagonal_wires = 10;
+
+/**
+ * @brief A block of consecutive operations to be fused into a single gate.
+ */
+struct FusedGateBlock {
+    std::vector<size_t> op_indices; /**< Indices of the operations in the
+                                       original operation list. */
+    std::vector<size_t> wires;      /**< Sorted union of wires of the
+                                       operations in the block. */
+    bool diagonal{false};           /**< Whether all operations in the block
+                                       are diagonal. */
+};
+
+/**
+ * @brief Partition a list of operations into blocks of consecutive
+ * operations, each acting on at most `max_wires` wires in total.
+ *
+ * Operations are added to the current block greedily as long as the union of
+ * wires of the block does not exceed `max_wires`. An operation acting on more
+ * than `max_wires` wires forms a block on its own.
+ *
+ * @param ops_wires Wires of each operation.
+ * @param max_wires Maximum number of wires of each block.
+ * @return std::vector<FusedGateBlock>
+ */
+auto partitionForFusion(const std::vector<std::vector<size_t>> &ops_wires,
+                        size_t max_wires) -> std::vector<FusedGateBlock>;
+
+/**
+ * @brief Partition a list of operations into blocks of consecutive
+ * operations, where runs of diagonal operations may act on more wires.
+ *
+ * As long as all operations of the current block are diagonal, the block
+ * may grow up to `max_diagonal_wires` wires. Otherwise the block acts on at
+ * most `max_wires` wires in total, as in the overload without diagonal
+ * operations.
+ *
+ * @param ops_wires Wires of each operation.
+ * @param ops_diagonal Whether each operation is diagonal.
+ * @param max_wires Maximum number of wires of each block.
+ * @param max_diagonal_wires Maximum number of wires of each diagonal block.
+ * @return std::vector<FusedGateBlock>
+ */
+auto partitionForFusion(const std::vector<std::vector<size_t>> &ops_wires,
+                        const std::vector<bool> &ops_diagonal,
+                        size_t max_wires, size_t max_diagonal_wires)
+    -> std::vector<FusedGateBlock>;
+
+/**
+ * @brief Schedule a list of operations into layers of operations acting on
+ * pairwise-disjoint wires.
+ *
+ * Each operation is placed in the earliest layer after all layers holding
+ * an operation sharing a wire with it, i.e. it moves past earlier
+ * operations on disjoint wires, which commute with it. Applying the layers
+ * in order, with the operations of a layer in any order, is therefore
+ * equivalent to applying the operations in the original order.
+ *
+ * @param ops_wires Wires of each operation.
+ * @return Indices of the operations of each layer, in ascending order.
+ */
+auto partitionIntoLayers(const std::vector<std::vector<size_t>> &ops_wires)
+    -> std::vector<std::vector<size_t>>;
+
+/**
+ * @brief Partition a list of operations into layers, and the single-qubit
+ * operations of each layer into blocks acting on at most `max_wires`
+ * wires.
+ *
+ * As the operations of a block act on distinct wires, a block is the
+ * tensor product of single-qubit operations. The operations of a block are
+ * ordered by wire, so `op_indices[k]` acts on `wires[k]`. Each operation
+ * acting on more than one wire forms a block on its own. Applying the
+ * blocks in order is equivalent to applying the operations in the original
+ * order.
+ *
+ * @param ops_wires Wires of each operation.
+ * @param max_wires Maximum number of wires of each block.
+ * @return std::vector<FusedGateBlock>
+ */
+auto partitionForProducts(const std::vector<std::vector<size_t>> &ops_wires,
+                          size_t max_wires) -> std::vector<FusedGateBlock>;
+
+/**
+ * @brief Wires of each operation in the block, relative to `block.wires`.
+ *
+ * @param block Block of operations.
+ * @param ops_wires Wires of each operation.
+ */
+auto getLocalWires(const FusedGateBlock &block,
+                   const std::vector<std::vector<size_t>> &ops_wires)
+    -> std::vector<std::vector<size_t>>;
+
+/**
+ * @brief Compute the dense matrix of a block of operations.
+ *
+ * The matrix is obtained by applying all operations in the block to each
+ * computational basis state of a @f$|\text{block.wires}|@f$-qubit state
+ * vector. The returned matrix is in row-major order, and `block.wires[0]`
+ * corresponds to the most significant bit, so it can be directly applied
+ * using `applyMatrix` with wires `block.wires`.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data.
+ * @param block Block of operations to fuse.
+ * @param ops Name of each operation.
+ * @param ops_wires Wires of each operation.
+ * @param ops_inverse Indicates whether each operation is to be inverted.
+ * @param ops_params Parameters of each operation.
+ * @return std::vector<std::complex<PrecisionT>>
+ */
+template <class PrecisionT>
+auto getFusedMatrix(const FusedGateBlock &block,
+                    const std::vector<std::string> &ops,
+                    const std::vector<std::vector<size_t>> &ops_wires,
+                    const std::vector<bool> &ops_inverse,
+                    const std::vector<std::vector<PrecisionT>> &ops_params)
+    -> std::vector<std::complex<PrecisionT>> {
+    PL_ABORT_IF(block.wires.size() > max_fused_wires,
+                "The number of wires of a fused gate exceeds the maximum.");
+
+    const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+    const size_t num_wires = block.wires.size();
+    const size_t dim = Util::exp2(num_wires);
+
+    // Gate operations and wires relative to the block
+    std::vector<GateOperation> gate_ops;
+    gate_ops.reserve(block.op_indices.size());
+    for (const size_t op_idx : block.op_indices) {
+        gate_ops.emplace_back(dispatcher.strToGateOp(ops[op_idx]));
+    }
+    const auto local_wires = getLocalWires(block, ops_wires);
+
+    std::vector<std::complex<PrecisionT>> matrix(dim * dim);
+    std::vector<std::complex<PrecisionT>> column(dim);
+    for (size_t col = 0; col < dim; col++) {
+        std::fill(column.begin(), column.end(), std::complex<PrecisionT>{});
+        column[col] = std::complex<PrecisionT>{1.0, 0.0};
+        for (size_t k = 0; k < block.op_indices.size(); k++) {
+            const size_t op_idx = block.op_indices[k];
+            dispatcher.applyOperation(KernelType::PI, column.data(), num_wires,
+                                      gate_ops[k], local_wires[k],
+                                      ops_inverse[op_idx], ops_params[op_idx]);
+        }
+        for (size_t row = 0; row < dim; row++) {
+            matrix[row * dim + col] = column[row];
+        }
+    }
+    return matrix;
+}
+
+/**
+ * @brief Compute the diagonal of a block of diagonal operations.
+ *
+ * As the product of diagonal matrices is diagonal, the diagonal is obtained
+ * by applying all operations in the block to the vector of all ones. The
+ * element `i` corresponds to the basis state `i` of `block.wires`, where
+ * `block.wires[0]` is the most significant bit, so the result can be
+ * directly applied using `applyDiagonal` with wires `block.wires`.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data.
+ * @param block Block of diagonal operations to fuse.
+ * @param ops Name of each operation.
+ * @param ops_wires Wires of each operation.
+ * @param ops_inverse Indicates whether each operation is to be inverted.
+ * @param ops_params Parameters of each operation.
+ * @return std::vector<std::complex<PrecisionT>>
+ */
+template <class PrecisionT>
+auto getFusedDiagonal(const FusedGateBlock &block,
+                      const std::vector<std::string> &ops,
+                      const std::vector<std::vector<size_t>> &ops_wires,
+                      const std::vector<bool> &ops_inverse,
+                      const std::vector<std::vector<PrecisionT>> &ops_params)
+    -> std::vector<std::complex<PrecisionT>> {
+    PL_ABORT_IF(block.wires.size() > max_fused_diagonal_wires,
+                "The number of wires of a fused diagonal gate exceeds the "
+                "maximum.");
+
+    const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+    const size_t num_wires = block.wires.size();
+    const auto local_wires = getLocalWires(block, ops_wires);
+
+    std::vector<std::complex<PrecisionT>> diag(Util::exp2(num_wires),
+                                               {1.0, 0.0});
+    for (size_t k = 0; k < block.op_indices.size(); k++) {
+        const size_t op_idx = block.op_indices[k];
+        const auto gate_op = dispatcher.strToGateOp(ops[op_idx]);
+        PL_ABORT_IF_NOT(Util::array_has_elt(Constant::diagonal_gates, gate_op),
+                        "All operations of the block must be diagonal.");
+        dispatcher.applyOperation(KernelType::PI, diag.data(), num_wires,
+                                  gate_op, local_wires[k], ops_inverse[op_idx],
+                                  ops_params[op_idx]);
+    }
+    return diag;
+}
+} // namespace Pennylane::Gates
@@ -17,6 +17,9 @@
 #include "ConstantUtil.hpp"
 #include "Util.hpp"
 
+#include <algorithm>
+#include <list>
+
 namespace Pennylane::Gates {
 auto getIndicesAfterExclusion(const std::vector<size_t> &indicesToExclude,
                               size_t num_qubits) -> std::vector<size_t> {
@@ -46,6 +49,39 @@ auto generateBitPatterns(const std::vector<size_t> &qubitIndices,
     }
     return indices;
 }
+
+/// @cond DEV
+namespace {
+struct GateIndicesCacheEntry {
+    size_t num_qubits;
+    std::vector<size_t> wires;
+    GateIndices indices;
+
+    GateIndicesCacheEntry(const std::vector<size_t> &wires_, size_t n_qubits)
+        : num_qubits{n_qubits}, wires{wires_}, indices{wires_, n_qubits} {}
+};
+} // namespace
+/// @endcond
+
+auto cachedGateIndices(const std::vector<size_t> &wires, size_t num_qubits)
+    -> const GateIndices & {
+    // Least recently used last. Splicing keeps references to entries valid.
+    thread_local std::list<GateIndicesCacheEntry> cache;
+
+    const auto iter = std::find_if(
+        cache.begin(), cache.end(), [&](const GateIndicesCacheEntry &entry) {
+            return entry.num_qubits == num_qubits && entry.wires == wires;
+        });
+    if (iter != cache.end()) {
+        cache.splice(cache.begin(), cache, iter);
+    } else {
+        if (cache.size() == gate_indices_cache_size) {
+            cache.pop_back();
+        }
+        cache.emplace_front(wires, num_qubits);
+    }
+    return cache.front().indices;
+}
 } // namespace Pennylane::Gates
 
 /// @cond DEV
@@ -18,7 +18,10 @@
 
 #pragma once
 
+#include <bit>
+#include <cstddef>
 #include <cstdlib>
+#include <iterator>
 #include <set>
 #include <vector>
 
@@ -58,6 +61,79 @@ auto getIndicesAfterExclusion(const std::vector<size_t> &indicesToExclude,
 auto generateBitPatterns(const std::vector<size_t> &qubitIndices,
                          size_t num_qubits) -> std::vector<size_t>;
 
+/**
+ * @brief Range of the indices whose bits for the given wires are all zero.
+ *
+ * The indices are generated while iterating, from the mask of the wires, as
+ * the index after `index` is `((index | mask) + 1) & ~mask`. Thus the range
+ * takes constant memory for any number of qubits.
+ */
+class ExternalIndices {
+  private:
+    size_t mask_;
+    size_t end_;
+
+  public:
+    /**
+     * @brief Iterator over ExternalIndices.
+     */
+    class Iterator {
+      private:
+        size_t index_;
+        size_t mask_;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const size_t *;
+        using reference = size_t;
+
+        Iterator() = default;
+        Iterator(size_t index, size_t mask) : index_{index}, mask_{mask} {}
+
+        auto operator*() const -> size_t { return index_; }
+        auto operator++() -> Iterator & {
+            index_ = ((index_ | mask_) + 1) & ~mask_;
+            return *this;
+        }
+        auto operator++(int) -> Iterator {
+            Iterator prev = *this;
+            ++(*this);
+            return prev;
+        }
+        auto operator==(const Iterator &other) const -> bool {
+            return index_ == other.index_;
+        }
+        auto operator!=(const Iterator &other) const -> bool {
+            return index_ != other.index_;
+        }
+    };
+
+    /**
+     * @brief Create the range of external indices.
+     *
+     * @param wires Wires the gate applies to.
+     * @param num_qubits Number of qubits.
+     */
+    ExternalIndices(const std::vector<size_t> &wires, size_t num_qubits)
+        : mask_{0}, end_{Util::exp2(num_qubits)} {
+        for (const size_t wire : wires) {
+            mask_ |= Util::maxDecimalForQubit(wire, num_qubits);
+        }
+    }
+
+    [[nodiscard]] auto begin() const -> Iterator { return {0, mask_}; }
+    [[nodiscard]] auto end() const -> Iterator { return {end_, mask_}; }
+
+    /**
+     * @brief Number of external indices.
+     */
+    [[nodiscard]] auto size() const -> size_t {
+        return end_ >> std::popcount(mask_);
+    }
+};
+
 /**
  * @brief Internal utility struct to track data indices of application for
  * operations.
@@ -73,20 +149,39 @@ struct GateIndices {
                                           For the given wires with size n_wire,
                                           the output size is 2^n_wire. */
 
-    const std::vector<size_t>
+    const ExternalIndices
         external; /**< external External indices.
                     For the given wires with size n_wire, the
-                    output size is 2^(num_qubits - n_wires). */
+                    range size is 2^(num_qubits - n_wires). */
 
     /**
      * @brief Create indices for gates.
      */
     GateIndices(const std::vector<size_t> &wires, size_t num_qubits)
         : internal{generateBitPatterns(wires, num_qubits)},
-          external{generateBitPatterns(
-              getIndicesAfterExclusion(wires, num_qubits), num_qubits)} {}
+          external{wires, num_qubits} {}
 };
 
+/**
+ * @brief Number of wires whose GateIndices are cached per thread.
+ */
+constexpr size_t gate_indices_cache_size = 16;
+
+/**
+ * @brief Get the indices of a gate applied to the given wires.
+ *
+ * Indices of the most recently used wires are cached per thread, so that
+ * gates repeatedly applied to the same wires, as in layers of variational
+ * circuits, do not generate them again.
+ *
+ * @param wires Wires the gate applies to.
+ * @param num_qubits Number of qubits.
+ * @return Indices, valid until more than `gate_indices_cache_size` other
+ * wires are used in the same thread.
+ */
+auto cachedGateIndices(const std::vector<size_t> &wires, size_t num_qubits)
+    -> const GateIndices &;
+
 /**
  * @brief Return implemented_gates constexpr member variables for a given kernel
  *
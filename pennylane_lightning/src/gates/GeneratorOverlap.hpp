@@ -0,0 +1,230 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file GeneratorOverlap.hpp
+ * Defines overlaps @f$\langle \phi | G | \psi \rangle@f$ of generators
+ * @f$G@f$ which are controlled Pauli strings, computed in a single read-only
+ * pass over both statevectors.
+ */
+#pragma once
+
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "TypeTraits.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <complex>
+#include <optional>
+#include <vector>
+
+namespace Pennylane::Gates {
+/**
+ * @brief Generator acting as @f$s \Pi P@f$, where @f$\Pi@f$ projects the
+ * control wires onto @f$|1\rangle@f$ and @f$P@f$ is a Pauli string.
+ *
+ * Masks are in terms of the bits of the statevector index, i.e. the
+ * reversed wires.
+ */
+template <class PrecisionT> struct PauliGeneratorTerm {
+    size_t x_mask;    ///< Wires acted on by X or Y
+    size_t z_mask;    ///< Wires acted on by Z or Y
+    size_t ctrl_mask; ///< Control wires
+    size_t num_y;     ///< Number of Y factors
+    /// Coefficient @f$s@f$, i.e. the scaling factor returned by the
+    /// generator kernels times the sign of their action
+    PrecisionT scale;
+};
+
+/**
+ * @brief Get the generator of the operation as a controlled Pauli string.
+ *
+ * The term matches the generator kernels of GateImplementationsLM: for any
+ * kernel, the scaling factor times @f$\langle \phi | G | \psi \rangle@f$ is
+ * the scale of the term times pauliGeneratorOverlap().
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @param gntr_op Generator operation.
+ * @param num_qubits Number of qubits.
+ * @param wires Wires of the operation.
+ * @return The term, or std::nullopt if the generator is not a controlled
+ * Pauli string.
+ */
+template <class PrecisionT>
+auto pauliGeneratorTerm(GeneratorOperation gntr_op, size_t num_qubits,
+                        const std::vector<size_t> &wires)
+    -> std::optional<PauliGeneratorTerm<PrecisionT>> {
+    const auto bit = [num_qubits, &wires](size_t idx) -> size_t {
+        PL_ABORT_IF_NOT(idx < wires.size() && wires[idx] < num_qubits,
+                        "Invalid wire index.");
+        return static_cast<size_t>(1U) << (num_qubits - 1 - wires[idx]);
+    };
+    constexpr auto half = static_cast<PrecisionT>(0.5);
+
+    switch (gntr_op) {
+    case GeneratorOperation::PhaseShift:
+        return PauliGeneratorTerm<PrecisionT>{0, 0, bit(0), 0, 1};
+    case GeneratorOperation::RX:
+        return PauliGeneratorTerm<PrecisionT>{bit(0), 0, 0, 0, -half};
+    case GeneratorOperation::RY:
+        return PauliGeneratorTerm<PrecisionT>{bit(0), bit(0), 0, 1, -half};
+    case GeneratorOperation::RZ:
+        return PauliGeneratorTerm<PrecisionT>{0, bit(0), 0, 0, -half};
+    case GeneratorOperation::IsingXX:
+        return PauliGeneratorTerm<PrecisionT>{bit(0) | bit(1), 0, 0, 0,
+                                              -half};
+    case GeneratorOperation::IsingYY:
+        return PauliGeneratorTerm<PrecisionT>{bit(0) | bit(1), bit(0) | bit(1),
+                                              0, 2, -half};
+    case GeneratorOperation::IsingZZ:
+        return PauliGeneratorTerm<PrecisionT>{0, bit(0) | bit(1), 0, 0,
+                                              -half};
+    case GeneratorOperation::CRX:
+        return PauliGeneratorTerm<PrecisionT>{bit(1), 0, bit(0), 0, -half};
+    case GeneratorOperation::CRY:
+        return PauliGeneratorTerm<PrecisionT>{bit(1), bit(1), bit(0), 1,
+                                              -half};
+    case GeneratorOperation::CRZ:
+        return PauliGeneratorTerm<PrecisionT>{0, bit(1), bit(0), 0, -half};
+    case GeneratorOperation::ControlledPhaseShift:
+        return PauliGeneratorTerm<PrecisionT>{0, 0, bit(0) | bit(1), 0, 1};
+    case GeneratorOperation::MultiRZ: {
+        size_t z_mask = 0;
+        for (size_t idx = 0; idx < wires.size(); idx++) {
+            z_mask |= bit(idx);
+        }
+        // The kernel applies minus the Pauli Z string and scales by 1/2
+        return PauliGeneratorTerm<PrecisionT>{0, z_mask, 0, 0, -half};
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+/**
+ * @brief Multiply by @f$i^n@f$.
+ */
+template <class T>
+constexpr auto timesIPower(std::complex<T> value, size_t n)
+    -> std::complex<T> {
+    switch (n % 4) {
+    case 1:
+        return {-value.imag(), value.real()};
+    case 2:
+        return -value;
+    case 3:
+        return {value.imag(), -value.real()};
+    default:
+        return value;
+    }
+}
+
+/**
+ * @brief Compute @f$\langle \phi_k | \Pi P | \psi \rangle@f$ for the
+ * controlled Pauli string of the term and many statevectors
+ * @f$|\phi_k\rangle@f$, without applying it to a copy of
+ * @f$|\psi\rangle@f$.
+ *
+ * As @f$P|j\rangle = i^{n_Y} (-1)^{|j \wedge z|} |j \oplus x\rangle@f$, the
+ * overlaps are sums over the indices of the statevectors. They are computed
+ * in tiles of `TILE` indices, where the amplitudes of @f$|\psi\rangle@f$
+ * read for a tile are reused against every @f$|\phi_k\rangle@f$ while they
+ * are in cache. Tiles are distributed over threads.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @tparam TILE Number of indices of a tile.
+ * @param phis Pointers to the statevectors @f$|\phi_k\rangle@f$;
+ * conjugated.
+ * @param num_phis Number of statevectors @f$|\phi_k\rangle@f$.
+ * @param psi Pointer to @f$|\psi\rangle@f$.
+ * @param num_qubits Number of qubits.
+ * @param term Generator term.
+ * @param results Pre-allocated array of `num_phis` overlaps.
+ * @param num_threads Number of threads to use.
+ */
+template <class PrecisionT,
+          size_t TILE = (1U << 10U)> // NOLINT(readability-magic-numbers)
+void pauliGeneratorOverlaps(const std::complex<PrecisionT> *const *phis,
+                            size_t num_phis,
+                            const std::complex<PrecisionT> *psi,
+                            size_t num_qubits,
+                            const PauliGeneratorTerm<PrecisionT> &term,
+                            std::complex<PrecisionT> *results,
+                            [[maybe_unused]] size_t num_threads) {
+    using AccT = Util::accumulator_t<PrecisionT>;
+    const size_t length = Util::exp2(num_qubits);
+    const size_t x_mask = term.x_mask;
+    const size_t z_mask = term.z_mask;
+    const size_t ctrl_mask = term.ctrl_mask;
+    std::vector<AccT> sums(2 * num_phis, 0.0);
+    AccT *sums_ptr = sums.data();
+    const size_t num_tiles = (length + TILE - 1) / TILE;
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static) \
+            num_threads(num_threads) if(num_threads > 1) \
+            reduction(+:sums_ptr[:2 * num_phis])
+    #endif
+    // clang-format on
+    for (size_t tile = 0; tile < num_tiles; tile++) {
+        const size_t begin = tile * TILE;
+        const size_t end = std::min(begin + TILE, length);
+        for (size_t k = 0; k < num_phis; k++) {
+            const std::complex<PrecisionT> *phi = phis[k];
+            AccT sum_real = 0.0;
+            AccT sum_imag = 0.0;
+            for (size_t idx = begin; idx < end; idx++) {
+                if ((idx & ctrl_mask) != ctrl_mask) {
+                    continue;
+                }
+                const size_t src = idx ^ x_mask;
+                const std::complex<AccT> a = phi[idx];
+                const std::complex<AccT> b = psi[src];
+                const AccT sign =
+                    (std::popcount(src & z_mask) % 2 == 0) ? 1 : -1;
+                sum_real += sign * (a.real() * b.real() + a.imag() * b.imag());
+                sum_imag += sign * (a.real() * b.imag() - a.imag() * b.real());
+            }
+            sums_ptr[2 * k] += sum_real;
+            sums_ptr[2 * k + 1] += sum_imag;
+        }
+    }
+    for (size_t k = 0; k < num_phis; k++) {
+        const std::complex<AccT> sum{sums[2 * k], sums[2 * k + 1]};
+        results[k] = static_cast<std::complex<PrecisionT>>(
+            timesIPower(sum, term.num_y));
+    }
+}
+
+/**
+ * @brief Compute @f$\langle \phi | \Pi P | \psi \rangle@f$ for the
+ * controlled Pauli string of the term in a single read-only pass over both
+ * statevectors.
+ *
+ * @see pauliGeneratorOverlaps()
+ */
+template <class PrecisionT>
+auto pauliGeneratorOverlap(const std::complex<PrecisionT> *phi,
+                           const std::complex<PrecisionT> *psi,
+                           size_t num_qubits,
+                           const PauliGeneratorTerm<PrecisionT> &term,
+                           size_t num_threads) -> std::complex<PrecisionT> {
+    std::complex<PrecisionT> result;
+    pauliGeneratorOverlaps(&phi, 1, psi, num_qubits, term, &result,
+                           num_threads);
+    return result;
+}
+} // namespace Pennylane::Gates
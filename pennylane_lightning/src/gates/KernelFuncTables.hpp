@@ -0,0 +1,179 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file KernelFuncTables.hpp
+ * Defines functions filling the kernel function tables of the dynamic
+ * dispatcher from kernel classes.
+ *
+ * This file does not include any kernel, so that the translation units
+ * compiling a kernel for another instruction set can include it first.
+ */
+#pragma once
+
+#include "Constant.hpp"
+#include "ConstantUtil.hpp"
+#include "DynamicDispatcher.hpp"
+#include "GateOperation.hpp"
+#include "GateUtil.hpp"
+#include "OpToMemberFuncPtr.hpp"
+
+#include <cassert>
+#include <complex>
+#include <utility>
+#include <vector>
+
+/// @cond DEV
+namespace Pennylane::Internal {
+/**
+ * @brief return a lambda function for the given kernel and gate operation
+ *
+ * As we want the lambda function to be stateless, kernel and gate_op are
+ * template parameters (or the functions can be consteval in C++20).
+ * In C++20, one also may use a template lambda function instead.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data.
+ * @tparam ParamT Floating point type for parameters>
+ * @tparam GateImplementation Gate implementation class.
+ * @tparam gate_op Gate operation to make a functor.
+ */
+template <class PrecisionT, class ParamT, class GateImplementation,
+          Gates::GateOperation gate_op>
+constexpr auto gateOpToFunctor() {
+    return [](std::complex<PrecisionT> *data, size_t num_qubits,
+              const std::vector<size_t> &wires, bool inverse,
+              const std::vector<PrecisionT> &params) {
+        constexpr auto func_ptr =
+            Gates::GateOpToMemberFuncPtr<PrecisionT, ParamT, GateImplementation,
+                                         gate_op>::value;
+        assert(params.size() ==
+               Util::lookup(Gates::Constant::gate_num_params, gate_op));
+        Gates::callGateOps(func_ptr, data, num_qubits, wires, inverse, params);
+    };
+}
+
+/**
+ * @brief Set the functions of all implemented gates of a kernel in the table.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data
+ * @tparam ParamT Floating point type of gate parameters
+ * @tparam GateImplementation Gate implementation class.
+ */
+template <class PrecisionT, class ParamT, class GateImplementation,
+          size_t... gate_idx>
+constexpr void
+fillGateTable(KernelFuncTable<Gates::GateOperation,
+                                        Internal::DispatchGateFuncPtrT<
+                                            PrecisionT>> &table,
+              [[maybe_unused]] std::index_sequence<gate_idx...> dummy) {
+    constexpr auto kernel_idx =
+        static_cast<size_t>(GateImplementation::kernel_id);
+    constexpr auto &gate_ops = GateImplementation::implemented_gates;
+    ((table[static_cast<size_t>(gate_ops[gate_idx])][kernel_idx] =
+          gateOpToFunctor<PrecisionT, ParamT, GateImplementation,
+                          gate_ops[gate_idx]>()),
+     ...);
+}
+
+/**
+ * @brief Set the functions of all implemented generators of a kernel in the
+ * table.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data
+ * @tparam GateImplementation Gate implementation class.
+ */
+template <class PrecisionT, class GateImplementation, size_t... gntr_idx>
+constexpr void
+fillGeneratorTable(KernelFuncTable<
+                       Gates::GeneratorOperation,
+                       Gates::GeneratorFuncPtrT<PrecisionT>> &table,
+                   [[maybe_unused]] std::index_sequence<gntr_idx...> dummy) {
+    constexpr auto kernel_idx =
+        static_cast<size_t>(GateImplementation::kernel_id);
+    constexpr auto &gntr_ops = GateImplementation::implemented_generators;
+    ((table[static_cast<size_t>(gntr_ops[gntr_idx])][kernel_idx] =
+          Gates::GeneratorOpToMemberFuncPtr<PrecisionT, GateImplementation,
+                                            gntr_ops[gntr_idx]>::value),
+     ...);
+}
+
+/**
+ * @brief Set the functions of all implemented matrix operations of a kernel
+ * in the table.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data
+ * @tparam GateImplementation Gate implementation class.
+ */
+template <class PrecisionT, class GateImplementation, size_t... mat_idx>
+constexpr void
+fillMatrixTable(KernelFuncTable<Gates::MatrixOperation,
+                                          Gates::MatrixFuncPtrT<PrecisionT>>
+                    &table,
+                [[maybe_unused]] std::index_sequence<mat_idx...> dummy) {
+    constexpr auto kernel_idx =
+        static_cast<size_t>(GateImplementation::kernel_id);
+    constexpr auto &mat_ops = GateImplementation::implemented_matrices;
+    ((table[static_cast<size_t>(mat_ops[mat_idx])][kernel_idx] =
+          Gates::MatrixOpToMemberFuncPtr<PrecisionT, GateImplementation,
+                                         mat_ops[mat_idx]>::value),
+     ...);
+}
+
+/**
+ * @brief Set the functions of all kernels in the type list in the tables.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data
+ * @tparam ParamT Floating point type of gate parameters
+ * @tparam TypeList Type list of kernels.
+ */
+template <class PrecisionT, class ParamT, class TypeList>
+constexpr void fillKernelFuncTablesIter(
+    KernelFuncTables<PrecisionT> &tables) {
+    if constexpr (!std::is_same_v<TypeList, void>) {
+        using GateImplementation = typename TypeList::Type;
+        fillGateTable<PrecisionT, ParamT, GateImplementation>(
+            tables.gates,
+            std::make_index_sequence<
+                GateImplementation::implemented_gates.size()>{});
+        fillGeneratorTable<PrecisionT, GateImplementation>(
+            tables.generators,
+            std::make_index_sequence<
+                GateImplementation::implemented_generators.size()>{});
+        fillMatrixTable<PrecisionT, GateImplementation>(
+            tables.matrices,
+            std::make_index_sequence<
+                GateImplementation::implemented_matrices.size()>{});
+        fillKernelFuncTablesIter<PrecisionT, ParamT, typename TypeList::Next>(
+            tables);
+    }
+}
+
+/**
+ * @brief Set the functions of the AVX2 kernel compiled for AVX2 in the
+ * tables. Defined in KernelFuncTablesAVX2.cpp.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data
+ */
+template <class PrecisionT>
+void fillAVX2KernelFuncTables(KernelFuncTables<PrecisionT> &tables);
+
+/**
+ * @brief Set the functions of the AVX512 kernel compiled for AVX512F in the
+ * tables. Defined in KernelFuncTablesAVX512.cpp.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data
+ */
+template <class PrecisionT>
+void fillAVX512KernelFuncTables(KernelFuncTables<PrecisionT> &tables);
+} // namespace Pennylane::Internal
+/// @endcond
@@ -0,0 +1,62 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file KernelFuncTablesAVX2.cpp
+ * Compile the AVX2 kernel for AVX2, for runtime dispatch.
+ *
+ * Only the kernel headers are compiled for AVX2. Everything they depend on
+ * is included first, so functions from other headers are compiled for the
+ * build target as in any other translation unit and may safely be merged by
+ * the linker.
+ */
+#include "BitUtil.hpp"
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "Gates.hpp"
+#include "KernelFuncTables.hpp"
+#include "KernelType.hpp"
+#include "Macros.hpp"
+#include "TypeList.hpp"
+#include "Util.hpp"
+#include "cpu_kernels/GateImplementationsLM.hpp"
+#include "cpu_kernels/PauliGenerator.hpp"
+
+#include <array>
+#include <complex>
+#include <immintrin.h>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if !defined(PL_USE_AVX2)
+#define PL_USE_AVX2 1
+#endif
+PL_TARGET_PUSH("avx2")
+#include "cpu_kernels/GateImplementationsAVX2.hpp"
+PL_TARGET_POP
+
+/// @cond DEV
+namespace Pennylane::Internal {
+template <class PrecisionT>
+void fillAVX2KernelFuncTables(KernelFuncTables<PrecisionT> &tables) {
+    fillKernelFuncTablesIter<
+        PrecisionT, PrecisionT,
+        Util::TypeList<Gates::GateImplementationsAVX2, void>>(tables);
+}
+
+// explicit instantiations
+template void fillAVX2KernelFuncTables<float>(KernelFuncTables<float> &);
+template void fillAVX2KernelFuncTables<double>(KernelFuncTables<double> &);
+} // namespace Pennylane::Internal
+/// @endcond
@@ -0,0 +1,86 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file PauliRot.hpp
+ * Defines utility functions for Pauli rotations @f$e^{-i\theta P/2}@f$ of a
+ * Pauli word @f$P@f$.
+ */
+#pragma once
+
+#include "Error.hpp"
+#include "Util.hpp"
+
+#include <string_view>
+#include <vector>
+
+namespace Pennylane::Gates {
+/**
+ * @brief Name of the Pauli rotation operation in a list of operations.
+ *
+ * The operation has a single parameter @f$\theta@f$, and the Pauli word is
+ * given by Algorithms::OpsData::getOpsPauliWords().
+ */
+constexpr std::string_view pauli_rot_name = "PauliRot";
+
+/**
+ * @brief Pauli word @f$P@f$ as bit masks of the statevector index, i.e. of
+ * the reversed wires, so that
+ * @f$P|j\rangle = i^{n_Y} (-1)^{|j \wedge z|} |j \oplus x\rangle@f$.
+ */
+struct PauliWordMasks {
+    size_t x_mask; ///< Wires acted on by X or Y
+    size_t z_mask; ///< Wires acted on by Z or Y
+    size_t num_y;  ///< Number of Y factors
+};
+
+/**
+ * @brief Get the bit masks of a Pauli word.
+ *
+ * @param num_qubits Number of qubits.
+ * @param wires Wires of the word.
+ * @param word Pauli word of characters I, X, Y and Z, one per wire.
+ * @return PauliWordMasks
+ */
+inline auto pauliWordMasks(size_t num_qubits, const std::vector<size_t> &wires,
+                           std::string_view word) -> PauliWordMasks {
+    PL_ABORT_IF_NOT(word.size() == wires.size(),
+                    "The Pauli word must have one letter per wire.");
+    PauliWordMasks masks{0, 0, 0};
+    for (size_t idx = 0; idx < wires.size(); idx++) {
+        PL_ABORT_IF(wires[idx] >= num_qubits, "Invalid wire index.");
+        const size_t bit = static_cast<size_t>(1U)
+                           << (num_qubits - 1 - wires[idx]);
+        PL_ABORT_IF((masks.x_mask & bit) != 0 || (masks.z_mask & bit) != 0,
+                    "The wires of a Pauli word must be distinct.");
+        switch (word[idx]) {
+        case 'I':
+            break;
+        case 'X':
+            masks.x_mask |= bit;
+            break;
+        case 'Y':
+            masks.x_mask |= bit;
+            masks.z_mask |= bit;
+            masks.num_y++;
+            break;
+        case 'Z':
+            masks.z_mask |= bit;
+            break;
+        default:
+            PL_ABORT("A Pauli word must consist of I, X, Y and Z.");
+        }
+    }
+    return masks;
+}
+} // namespace Pennylane::Gates
@@ -0,0 +1,131 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file BatchMajorKernels.hpp
+ * Defines kernels for batches of statevectors stored batch-major, i.e. with
+ * the batch as the fastest varying index.
+ */
+#pragma once
+
+#include "Macros.hpp"
+#include "Util.hpp"
+#include "cpu_kernels/SplitComplexKernels.hpp"
+
+#include <vector>
+
+namespace Pennylane::Gates::BatchMajor {
+/**
+ * @brief Apply a matrix, which may differ for each statevector of the batch.
+ *
+ * Amplitude `i` of statevector `b` is at index `i * batch + b` of the real
+ * and imaginary arrays, so the innermost loop over the batch maps each SIMD
+ * lane to a statevector, whatever the wires of the gate.
+ *
+ * @param re Real parts of the batch.
+ * @param im Imaginary parts of the batch.
+ * @param num_qubits Number of qubits.
+ * @param batch Number of statevectors.
+ * @param mat_re Real parts of the matrices, where element (row, col) of
+ * statevector `b` is at index `(row * dim + col) * batch + b`.
+ * @param mat_im Imaginary parts of the matrices.
+ * @param wires Wires to apply the matrices to, where `wires[0]` is the most
+ * significant bit of the row and column indices.
+ */
+template <class PrecisionT>
+void applyMatrix(PrecisionT *re, PrecisionT *im, size_t num_qubits,
+                 size_t batch, const PrecisionT *mat_re,
+                 const PrecisionT *mat_im, const std::vector<size_t> &wires) {
+    const auto offsets = SplitComplex::Internal::wireOffsets(num_qubits, wires);
+    const size_t dim = offsets.size();
+    size_t mask = 0;
+    for (const size_t offset : offsets) {
+        mask |= offset;
+    }
+    std::vector<PrecisionT> v_re(dim * batch);
+    std::vector<PrecisionT> v_im(dim * batch);
+
+    const size_t length = Util::exp2(num_qubits);
+    for (size_t idx = 0; idx < length; idx++) {
+        if ((idx & mask) != 0) {
+            continue;
+        }
+        for (size_t k = 0; k < dim; k++) {
+            const size_t base = (idx | offsets[k]) * batch;
+            std::copy(re + base, re + base + batch, v_re.data() + k * batch);
+            std::copy(im + base, im + base + batch, v_im.data() + k * batch);
+        }
+        for (size_t row = 0; row < dim; row++) {
+            PrecisionT *out_re = re + (idx | offsets[row]) * batch;
+            PrecisionT *out_im = im + (idx | offsets[row]) * batch;
+            std::fill(out_re, out_re + batch, PrecisionT{0});
+            std::fill(out_im, out_im + batch, PrecisionT{0});
+            for (size_t col = 0; col < dim; col++) {
+                const PrecisionT *m_re = mat_re + (row * dim + col) * batch;
+                const PrecisionT *m_im = mat_im + (row * dim + col) * batch;
+                const PrecisionT *x_re = v_re.data() + col * batch;
+                const PrecisionT *x_im = v_im.data() + col * batch;
+                PL_LOOP_SIMD
+                for (size_t b = 0; b < batch; b++) {
+                    out_re[b] += m_re[b] * x_re[b] - m_im[b] * x_im[b];
+                    out_im[b] += m_re[b] * x_im[b] + m_im[b] * x_re[b];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Apply a diagonal matrix, which may differ for each statevector of
+ * the batch.
+ *
+ * @param re Real parts of the batch.
+ * @param im Imaginary parts of the batch.
+ * @param num_qubits Number of qubits.
+ * @param batch Number of statevectors.
+ * @param diag_re Real parts of the diagonals, where element `k` of
+ * statevector `b` is at index `k * batch + b`.
+ * @param diag_im Imaginary parts of the diagonals.
+ * @param wires Wires to apply the matrices to.
+ */
+template <class PrecisionT>
+void applyDiagonal(PrecisionT *re, PrecisionT *im, size_t num_qubits,
+                   size_t batch, const PrecisionT *diag_re,
+                   const PrecisionT *diag_im,
+                   const std::vector<size_t> &wires) {
+    const auto offsets = SplitComplex::Internal::wireOffsets(num_qubits, wires);
+    size_t mask = 0;
+    for (const size_t offset : offsets) {
+        mask |= offset;
+    }
+    const size_t length = Util::exp2(num_qubits);
+    for (size_t idx = 0; idx < length; idx++) {
+        if ((idx & mask) != 0) {
+            continue;
+        }
+        for (size_t k = 0; k < offsets.size(); k++) {
+            PrecisionT *x_re = re + (idx | offsets[k]) * batch;
+            PrecisionT *x_im = im + (idx | offsets[k]) * batch;
+            const PrecisionT *d_re = diag_re + k * batch;
+            const PrecisionT *d_im = diag_im + k * batch;
+            PL_LOOP_SIMD
+            for (size_t b = 0; b < batch; b++) {
+                const PrecisionT vr = x_re[b];
+                const PrecisionT vi = x_im[b];
+                x_re[b] = d_re[b] * vr - d_im[b] * vi;
+                x_im[b] = d_re[b] * vi + d_im[b] * vr;
+            }
+        }
+    }
+}
+} // namespace Pennylane::Gates::BatchMajor
@@ -0,0 +1,1348 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines common gate implementations for AVX2/AVX512 and NEON kernels.
+ *
+ * A complex number is stored as two consecutive floating point numbers, so a
+ * 128 bit (256 bit, 512 bit) register contains 1 (2, 4) complex<double> or
+ * 2 (4, 8) complex<float> values. When all target wires are outside of a
+ * register, i.e. the stride of every target wire is at least the number of
+ * complex numbers in a register, the gate acts on whole registers and is
+ * vectorized. A single-qubit gate on a wire inside a register permutes the
+ * amplitudes within each register, with a function specialized for the wire.
+ * Otherwise we fall back to the LM kernel.
+ *
+ * The kernels are declared in an inline namespace named after the instruction
+ * set they are compiled for, so that a translation unit compiled for AVX2 (see
+ * KernelFuncTablesAVX2.cpp) never shares symbols with the LM fallback
+ * instantiated elsewhere.
+ */
+#pragma once
+#include "BitUtil.hpp"
+#include "Error.hpp"
+#include "GateImplementationsLM.hpp"
+#include "Gates.hpp"
+#include "Macros.hpp"
+#include "Util.hpp"
+
+#include <complex>
+#include <utility>
+#include <vector>
+
+#if defined(PL_USE_AVX2) || defined(PL_USE_AVX512F)
+#include <immintrin.h>
+#elif defined(PL_USE_NEON)
+#include <arm_neon.h>
+#endif
+
+#if defined(PL_USE_AVX512F)
+#define PL_AVX_KERNEL_NAMESPACE avx512f
+#elif defined(PL_USE_AVX2)
+#define PL_AVX_KERNEL_NAMESPACE avx2
+#elif defined(PL_USE_NEON)
+#define PL_AVX_KERNEL_NAMESPACE neon
+#else
+#define PL_AVX_KERNEL_NAMESPACE fallback
+#endif
+
+namespace Pennylane::Gates::AVXCommon::inline PL_AVX_KERNEL_NAMESPACE {
+/**
+ * @brief Intrinsic operations for a given precision and packed size.
+ *
+ * The primary template is used when the corresponding instruction set is not
+ * available at compile time.
+ *
+ * @tparam PrecisionT Floating point precision type.
+ * @tparam packed_size Number of floating point numbers in a register.
+ */
+template <typename PrecisionT, size_t packed_size> struct AVXConcept {
+    constexpr static bool available = false;
+};
+
+#if defined(PL_USE_AVX2)
+template <> struct AVXConcept<double, 4> {
+    using PrecisionT = double;
+    using IntrinsicType = __m256d;
+    constexpr static bool available = true;
+
+    PL_FORCE_INLINE static auto load(const std::complex<double> *p)
+        -> IntrinsicType {
+        return _mm256_loadu_pd(reinterpret_cast<const double *>(p));
+    }
+    PL_FORCE_INLINE static void store(std::complex<double> *p,
+                                      IntrinsicType v) {
+        _mm256_storeu_pd(reinterpret_cast<double *>(p), v);
+    }
+    PL_FORCE_INLINE static auto set1(double v) -> IntrinsicType {
+        return _mm256_set1_pd(v);
+    }
+    /**
+     * @brief Create a register [-v, v, -v, v] (in memory order).
+     */
+    PL_FORCE_INLINE static auto imagFactor(double v) -> IntrinsicType {
+        return _mm256_setr_pd(-v, v, -v, v);
+    }
+    PL_FORCE_INLINE static auto add(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm256_add_pd(a, b);
+    }
+    PL_FORCE_INLINE static auto sub(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm256_sub_pd(a, b);
+    }
+    PL_FORCE_INLINE static auto mul(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm256_mul_pd(a, b);
+    }
+    /**
+     * @brief Swap real and imaginary parts of each complex number.
+     */
+    PL_FORCE_INLINE static auto swapReIm(IntrinsicType v) -> IntrinsicType {
+        return _mm256_permute_pd(v, 0B0101); // NOLINT(readability-magic-numbers)
+    }
+    /**
+     * @brief Swap the complex numbers whose indices in the register differ in
+     * bit `rev_wire`.
+     */
+    template <size_t rev_wire>
+    PL_FORCE_INLINE static auto permute(IntrinsicType v) -> IntrinsicType {
+        static_assert(rev_wire == 0);
+        return _mm256_permute2f128_pd(v, v, 0B0001);
+    }
+};
+
+template <> struct AVXConcept<float, 8> {
+    using PrecisionT = float;
+    using IntrinsicType = __m256;
+    constexpr static bool available = true;
+
+    PL_FORCE_INLINE static auto load(const std::complex<float> *p)
+        -> IntrinsicType {
+        return _mm256_loadu_ps(reinterpret_cast<const float *>(p));
+    }
+    PL_FORCE_INLINE static void store(std::complex<float> *p,
+                                      IntrinsicType v) {
+        _mm256_storeu_ps(reinterpret_cast<float *>(p), v);
+    }
+    PL_FORCE_INLINE static auto set1(float v) -> IntrinsicType {
+        return _mm256_set1_ps(v);
+    }
+    PL_FORCE_INLINE static auto imagFactor(float v) -> IntrinsicType {
+        return _mm256_setr_ps(-v, v, -v, v, -v, v, -v, v);
+    }
+    PL_FORCE_INLINE static auto add(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm256_add_ps(a, b);
+    }
+    PL_FORCE_INLINE static auto sub(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm256_sub_ps(a, b);
+    }
+    PL_FORCE_INLINE static auto mul(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm256_mul_ps(a, b);
+    }
+    PL_FORCE_INLINE static auto swapReIm(IntrinsicType v) -> IntrinsicType {
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        return _mm256_permute_ps(v, 0B10110001);
+    }
+    template <size_t rev_wire>
+    PL_FORCE_INLINE static auto permute(IntrinsicType v) -> IntrinsicType {
+        static_assert(rev_wire < 2);
+        if constexpr (rev_wire == 0) {
+            // NOLINTNEXTLINE(readability-magic-numbers)
+            return _mm256_permute_ps(v, 0B01001110);
+        } else {
+            return _mm256_permute2f128_ps(v, v, 0B0001);
+        }
+    }
+};
+#endif
+
+#if defined(PL_USE_AVX512F)
+template <> struct AVXConcept<double, 8> {
+    using PrecisionT = double;
+    using IntrinsicType = __m512d;
+    constexpr static bool available = true;
+
+    PL_FORCE_INLINE static auto load(const std::complex<double> *p)
+        -> IntrinsicType {
+        return _mm512_loadu_pd(reinterpret_cast<const double *>(p));
+    }
+    PL_FORCE_INLINE static void store(std::complex<double> *p,
+                                      IntrinsicType v) {
+        _mm512_storeu_pd(reinterpret_cast<double *>(p), v);
+    }
+    PL_FORCE_INLINE static auto set1(double v) -> IntrinsicType {
+        return _mm512_set1_pd(v);
+    }
+    PL_FORCE_INLINE static auto imagFactor(double v) -> IntrinsicType {
+        return _mm512_setr_pd(-v, v, -v, v, -v, v, -v, v);
+    }
+    PL_FORCE_INLINE static auto add(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm512_add_pd(a, b);
+    }
+    PL_FORCE_INLINE static auto sub(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm512_sub_pd(a, b);
+    }
+    PL_FORCE_INLINE static auto mul(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm512_mul_pd(a, b);
+    }
+    PL_FORCE_INLINE static auto swapReIm(IntrinsicType v) -> IntrinsicType {
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        return _mm512_permute_pd(v, 0B01010101);
+    }
+    template <size_t rev_wire>
+    PL_FORCE_INLINE static auto permute(IntrinsicType v) -> IntrinsicType {
+        static_assert(rev_wire < 2);
+        if constexpr (rev_wire == 0) {
+            // NOLINTNEXTLINE(readability-magic-numbers)
+            return _mm512_permutex_pd(v, 0B01001110);
+        } else {
+            // NOLINTNEXTLINE(readability-magic-numbers)
+            return _mm512_shuffle_f64x2(v, v, 0B01001110);
+        }
+    }
+};
+
+template <> struct AVXConcept<float, 16> {
+    using PrecisionT = float;
+    using IntrinsicType = __m512;
+    constexpr static bool available = true;
+
+    PL_FORCE_INLINE static auto load(const std::complex<float> *p)
+        -> IntrinsicType {
+        return _mm512_loadu_ps(reinterpret_cast<const float *>(p));
+    }
+    PL_FORCE_INLINE static void store(std::complex<float> *p,
+                                      IntrinsicType v) {
+        _mm512_storeu_ps(reinterpret_cast<float *>(p), v);
+    }
+    PL_FORCE_INLINE static auto set1(float v) -> IntrinsicType {
+        return _mm512_set1_ps(v);
+    }
+    PL_FORCE_INLINE static auto imagFactor(float v) -> IntrinsicType {
+        return _mm512_setr_ps(-v, v, -v, v, -v, v, -v, v, -v, v, -v, v, -v, v,
+                              -v, v);
+    }
+    PL_FORCE_INLINE static auto add(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm512_add_ps(a, b);
+    }
+    PL_FORCE_INLINE static auto sub(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm512_sub_ps(a, b);
+    }
+    PL_FORCE_INLINE static auto mul(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return _mm512_mul_ps(a, b);
+    }
+    PL_FORCE_INLINE static auto swapReIm(IntrinsicType v) -> IntrinsicType {
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        return _mm512_permute_ps(v, 0B10110001);
+    }
+    template <size_t rev_wire>
+    PL_FORCE_INLINE static auto permute(IntrinsicType v) -> IntrinsicType {
+        static_assert(rev_wire < 3);
+        // NOLINTBEGIN(readability-magic-numbers)
+        if constexpr (rev_wire == 0) {
+            return _mm512_permute_ps(v, 0B01001110);
+        } else if constexpr (rev_wire == 1) {
+            return _mm512_shuffle_f32x4(v, v, 0B10110001);
+        } else {
+            return _mm512_shuffle_f32x4(v, v, 0B01001110);
+        }
+        // NOLINTEND(readability-magic-numbers)
+    }
+};
+#endif
+
+#if defined(PL_USE_NEON)
+template <> struct AVXConcept<double, 2> {
+    using PrecisionT = double;
+    using IntrinsicType = float64x2_t;
+    constexpr static bool available = true;
+
+    PL_FORCE_INLINE static auto load(const std::complex<double> *p)
+        -> IntrinsicType {
+        return vld1q_f64(reinterpret_cast<const double *>(p));
+    }
+    PL_FORCE_INLINE static void store(std::complex<double> *p,
+                                      IntrinsicType v) {
+        vst1q_f64(reinterpret_cast<double *>(p), v);
+    }
+    PL_FORCE_INLINE static auto set1(double v) -> IntrinsicType {
+        return vdupq_n_f64(v);
+    }
+    PL_FORCE_INLINE static auto imagFactor(double v) -> IntrinsicType {
+        return vcombine_f64(vdup_n_f64(-v), vdup_n_f64(v));
+    }
+    PL_FORCE_INLINE static auto add(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return vaddq_f64(a, b);
+    }
+    PL_FORCE_INLINE static auto sub(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return vsubq_f64(a, b);
+    }
+    PL_FORCE_INLINE static auto mul(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return vmulq_f64(a, b);
+    }
+    PL_FORCE_INLINE static auto swapReIm(IntrinsicType v) -> IntrinsicType {
+        return vextq_f64(v, v, 1);
+    }
+    // A register holds a single complex<double>, so there is no permute.
+};
+
+template <> struct AVXConcept<float, 4> {
+    using PrecisionT = float;
+    using IntrinsicType = float32x4_t;
+    constexpr static bool available = true;
+
+    PL_FORCE_INLINE static auto load(const std::complex<float> *p)
+        -> IntrinsicType {
+        return vld1q_f32(reinterpret_cast<const float *>(p));
+    }
+    PL_FORCE_INLINE static void store(std::complex<float> *p,
+                                      IntrinsicType v) {
+        vst1q_f32(reinterpret_cast<float *>(p), v);
+    }
+    PL_FORCE_INLINE static auto set1(float v) -> IntrinsicType {
+        return vdupq_n_f32(v);
+    }
+    PL_FORCE_INLINE static auto imagFactor(float v) -> IntrinsicType {
+        const float32x2_t f = vset_lane_f32(v, vdup_n_f32(-v), 1);
+        return vcombine_f32(f, f);
+    }
+    PL_FORCE_INLINE static auto add(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return vaddq_f32(a, b);
+    }
+    PL_FORCE_INLINE static auto sub(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return vsubq_f32(a, b);
+    }
+    PL_FORCE_INLINE static auto mul(IntrinsicType a, IntrinsicType b)
+        -> IntrinsicType {
+        return vmulq_f32(a, b);
+    }
+    PL_FORCE_INLINE static auto swapReIm(IntrinsicType v) -> IntrinsicType {
+        return vrev64q_f32(v);
+    }
+    template <size_t rev_wire>
+    PL_FORCE_INLINE static auto permute(IntrinsicType v) -> IntrinsicType {
+        static_assert(rev_wire == 0);
+        return vextq_f32(v, v, 2);
+    }
+};
+#endif
+
+/**
+ * @brief Multiply each complex number in a register by a complex scalar.
+ */
+template <class Concept>
+PL_FORCE_INLINE auto
+mulComplex(typename Concept::IntrinsicType v,
+           std::complex<typename Concept::PrecisionT> c) ->
+    typename Concept::IntrinsicType {
+    return Concept::add(
+        Concept::mul(v, Concept::set1(std::real(c))),
+        Concept::mul(Concept::swapReIm(v), Concept::imagFactor(std::imag(c))));
+}
+
+/**
+ * @brief Multiply each complex number in a register by `i * s` for a real s.
+ */
+template <class Concept>
+PL_FORCE_INLINE auto mulImag(typename Concept::IntrinsicType v,
+                             typename Concept::PrecisionT s) ->
+    typename Concept::IntrinsicType {
+    return Concept::mul(Concept::swapReIm(v), Concept::imagFactor(s));
+}
+
+/**
+ * @brief Multiply each complex number in a register by a real scalar.
+ */
+template <class Concept>
+PL_FORCE_INLINE auto mulReal(typename Concept::IntrinsicType v,
+                             typename Concept::PrecisionT s) ->
+    typename Concept::IntrinsicType {
+    return Concept::mul(v, Concept::set1(s));
+}
+
+/**
+ * @brief Common gate implementations for AVX2, AVX512, and NEON kernels.
+ *
+ * @tparam register_bytes Size of a register in bytes.
+ */
+template <size_t register_bytes> class GateImplementationsAVXCommon {
+  private:
+    template <typename PrecisionT>
+    using Concept = AVXConcept<PrecisionT, register_bytes / sizeof(PrecisionT)>;
+
+    /**
+     * @brief Number of wires whose indices are inside a single register.
+     */
+    template <typename PrecisionT>
+    constexpr static auto internalWires() -> size_t {
+        return Util::log2PerfectPower(register_bytes /
+                                      (2 * sizeof(PrecisionT)));
+    }
+
+    /**
+     * @brief Check whether a gate acting on the given wires can be
+     * vectorized.
+     */
+    template <typename PrecisionT>
+    static auto useIntrinsics(size_t num_qubits,
+                              const std::vector<size_t> &wires) -> bool {
+        if constexpr (Concept<PrecisionT>::available) {
+            for (const auto wire : wires) {
+                if (num_qubits - wire - 1 < internalWires<PrecisionT>()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Check whether a single-qubit gate on the given wire acts within
+     * registers, i.e. both amplitudes of each pair are in the same register.
+     */
+    template <typename PrecisionT>
+    static auto useInternalIntrinsics(size_t num_qubits, size_t wire)
+        -> bool {
+        if constexpr (Concept<PrecisionT>::available) {
+            return num_qubits >= internalWires<PrecisionT>() &&
+                   num_qubits - wire - 1 < internalWires<PrecisionT>();
+        }
+        return false;
+    }
+
+    /**
+     * @brief Apply a function acting on a pair of registers for the
+     * amplitudes of |0> and |1> of the target wire.
+     */
+    template <typename PrecisionT, class Func>
+    static void applySingleQubitIntrin(std::complex<PrecisionT> *arr,
+                                       size_t num_qubits, size_t wire,
+                                       Func &&func) {
+        using C = Concept<PrecisionT>;
+        constexpr size_t step = static_cast<size_t>(1U)
+                                << internalWires<PrecisionT>();
+
+        const size_t rev_wire = num_qubits - wire - 1;
+        const size_t rev_wire_shift = (static_cast<size_t>(1U) << rev_wire);
+        const auto [parity_high, parity_low] =
+            GateImplementationsLM::revWireParity(rev_wire);
+
+        for (size_t k = 0; k < Util::exp2(num_qubits - 1); k += step) {
+            const size_t i0 = ((k << 1U) & parity_high) | (parity_low & k);
+            const size_t i1 = i0 | rev_wire_shift;
+            auto v0 = C::load(arr + i0);
+            auto v1 = C::load(arr + i1);
+            func(v0, v1);
+            C::store(arr + i0, v0);
+            C::store(arr + i1, v1);
+        }
+    }
+
+    /**
+     * @brief Apply a function acting on four registers for the amplitudes
+     * of |00>, |01>, |10>, |11> of the target wires (wires[0] is the higher
+     * bit).
+     */
+    template <typename PrecisionT, class Func>
+    static void applyTwoQubitIntrin(std::complex<PrecisionT> *arr,
+                                    size_t num_qubits,
+                                    const std::vector<size_t> &wires,
+                                    Func &&func) {
+        using C = Concept<PrecisionT>;
+        constexpr size_t step = static_cast<size_t>(1U)
+                                << internalWires<PrecisionT>();
+
+        const size_t rev_wire0 = num_qubits - wires[1] - 1;
+        const size_t rev_wire1 = num_qubits - wires[0] - 1; // Control qubit
+
+        const size_t rev_wire0_shift = static_cast<size_t>(1U) << rev_wire0;
+        const size_t rev_wire1_shift = static_cast<size_t>(1U) << rev_wire1;
+
+        const auto [parity_high, parity_middle, parity_low] =
+            GateImplementationsLM::revWireParity(rev_wire0, rev_wire1);
+
+        for (size_t k = 0; k < Util::exp2(num_qubits - 2); k += step) {
+            const size_t i00 = ((k << 2U) & parity_high) |
+                               ((k << 1U) & parity_middle) | (k & parity_low);
+            const size_t i01 = i00 | rev_wire0_shift;
+            const size_t i10 = i00 | rev_wire1_shift;
+            const size_t i11 = i00 | rev_wire0_shift | rev_wire1_shift;
+
+            auto v00 = C::load(arr + i00);
+            auto v01 = C::load(arr + i01);
+            auto v10 = C::load(arr + i10);
+            auto v11 = C::load(arr + i11);
+            func(v00, v01, v10, v11);
+            C::store(arr + i00, v00);
+            C::store(arr + i01, v01);
+            C::store(arr + i10, v10);
+            C::store(arr + i11, v11);
+        }
+    }
+
+    template <typename PrecisionT>
+    static void applyMatrix2x2(std::complex<PrecisionT> *arr,
+                               size_t num_qubits,
+                               const std::complex<PrecisionT> *matrix,
+                               size_t wire) {
+        using C = Concept<PrecisionT>;
+        applySingleQubitIntrin<PrecisionT>(
+            arr, num_qubits, wire, [matrix](auto &v0, auto &v1) {
+                const auto w0 = C::add(mulComplex<C>(v0, matrix[0B00]),
+                                       mulComplex<C>(v1, matrix[0B01]));
+                const auto w1 = C::add(mulComplex<C>(v0, matrix[0B10]),
+                                       mulComplex<C>(v1, matrix[0B11]));
+                v0 = w0;
+                v1 = w1;
+            });
+    }
+
+    /**
+     * @brief Non-zero entries of a single-qubit matrix applied within
+     * registers.
+     */
+    enum class InternalOp { Diagonal, AntiDiagonal, Dense };
+
+    /**
+     * @brief Apply a single-qubit matrix to a wire inside registers.
+     *
+     * Each amplitude is updated from itself and its partner in the same
+     * register, which is brought to its lane by Concept::permute<rev_wire>.
+     * The factors of an amplitude only depend on its lane, so they are
+     * loaded into registers once.
+     *
+     * @tparam rev_wire Reversed index of the target wire.
+     * @tparam op Non-zero entries of the matrix.
+     */
+    template <typename PrecisionT, size_t rev_wire, InternalOp op>
+    static void
+    applySingleQubitInternal(std::complex<PrecisionT> *arr, size_t num_qubits,
+                             const std::complex<PrecisionT> *matrix) {
+        using C = Concept<PrecisionT>;
+        constexpr size_t step = static_cast<size_t>(1U)
+                                << internalWires<PrecisionT>();
+
+        // Factors of the amplitude itself (diag) and of its partner (off),
+        // stored so that mulComplex is a multiplication by the real and the
+        // signed imaginary parts
+        std::array<std::complex<PrecisionT>, step> diag_re{};
+        std::array<std::complex<PrecisionT>, step> diag_im{};
+        std::array<std::complex<PrecisionT>, step> off_re{};
+        std::array<std::complex<PrecisionT>, step> off_im{};
+        for (size_t lane = 0; lane < step; lane++) {
+            const size_t bit = (lane >> rev_wire) & 1U;
+            const auto diag = matrix[3 * bit];
+            const auto off = matrix[2 * bit + (1 - bit)];
+            diag_re[lane] = {std::real(diag), std::real(diag)};
+            diag_im[lane] = {-std::imag(diag), std::imag(diag)};
+            off_re[lane] = {std::real(off), std::real(off)};
+            off_im[lane] = {-std::imag(off), std::imag(off)};
+        }
+        const auto dr = C::load(diag_re.data());
+        const auto di = C::load(diag_im.data());
+        const auto orr = C::load(off_re.data());
+        const auto oi = C::load(off_im.data());
+
+        for (size_t k = 0; k < Util::exp2(num_qubits); k += step) {
+            const auto v = C::load(arr + k);
+            if constexpr (op == InternalOp::Diagonal) {
+                C::store(arr + k, C::add(C::mul(v, dr),
+                                         C::mul(C::swapReIm(v), di)));
+            } else {
+                const auto p = C::template permute<rev_wire>(v);
+                const auto w =
+                    C::add(C::mul(p, orr), C::mul(C::swapReIm(p), oi));
+                if constexpr (op == InternalOp::AntiDiagonal) {
+                    C::store(arr + k, w);
+                } else {
+                    C::store(arr + k,
+                             C::add(C::add(C::mul(v, dr),
+                                           C::mul(C::swapReIm(v), di)),
+                                    w));
+                }
+            }
+        }
+    }
+
+    template <typename PrecisionT, InternalOp op, size_t... rev_wires>
+    constexpr static auto
+    internalFuncs([[maybe_unused]] std::index_sequence<rev_wires...> seq) {
+        using Func = void (*)(std::complex<PrecisionT> *, size_t,
+                              const std::complex<PrecisionT> *);
+        return std::array<Func, sizeof...(rev_wires)>{
+            &applySingleQubitInternal<PrecisionT, rev_wires, op>...};
+    }
+
+    /**
+     * @brief Apply a single-qubit matrix to a wire inside registers, using
+     * the function specialized for the wire and the non-zero entries of the
+     * matrix from a constexpr table.
+     */
+    template <typename PrecisionT>
+    static void applyMatrix2x2Internal(std::complex<PrecisionT> *arr,
+                                       size_t num_qubits,
+                                       const std::complex<PrecisionT> *matrix,
+                                       size_t wire) {
+        constexpr auto seq =
+            std::make_index_sequence<internalWires<PrecisionT>()>();
+        constexpr static auto diagonal =
+            internalFuncs<PrecisionT, InternalOp::Diagonal>(seq);
+        constexpr static auto anti_diagonal =
+            internalFuncs<PrecisionT, InternalOp::AntiDiagonal>(seq);
+        constexpr static auto dense =
+            internalFuncs<PrecisionT, InternalOp::Dense>(seq);
+
+        const size_t rev_wire = num_qubits - wire - 1;
+        const std::complex<PrecisionT> zero{0, 0};
+        if (matrix[0B01] == zero && matrix[0B10] == zero) {
+            diagonal[rev_wire](arr, num_qubits, matrix);
+        } else if (matrix[0B00] == zero && matrix[0B11] == zero) {
+            anti_diagonal[rev_wire](arr, num_qubits, matrix);
+        } else {
+            dense[rev_wire](arr, num_qubits, matrix);
+        }
+    }
+
+    /**
+     * @brief Apply a single-qubit gate inside registers if the wire is
+     * inside a register.
+     *
+     * @param getMatrix Function returning the matrix of the gate.
+     * @return True if the gate was applied.
+     */
+    template <typename PrecisionT, class MatrixFunc>
+    static auto applyInternal(std::complex<PrecisionT> *arr, size_t num_qubits,
+                              size_t wire, bool inverse,
+                              MatrixFunc &&getMatrix) -> bool {
+        if constexpr (Concept<PrecisionT>::available &&
+                      internalWires<PrecisionT>() > 0) {
+            if (useInternalIntrinsics<PrecisionT>(num_qubits, wire)) {
+                const auto matrix = getMatrix();
+                if (inverse) {
+                    const std::array<std::complex<PrecisionT>, 4> mat = {
+                        std::conj(matrix[0B00]), std::conj(matrix[0B10]),
+                        std::conj(matrix[0B01]), std::conj(matrix[0B11])};
+                    applyMatrix2x2Internal(arr, num_qubits, mat.data(), wire);
+                } else {
+                    applyMatrix2x2Internal(arr, num_qubits, matrix.data(),
+                                           wire);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+  public:
+    /* Matrix operations */
+
+    template <class PrecisionT>
+    static void
+    applySingleQubitOp(std::complex<PrecisionT> *arr, size_t num_qubits,
+                       const std::complex<PrecisionT> *matrix,
+                       const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                if (inverse) {
+                    const std::array<std::complex<PrecisionT>, 4> mat = {
+                        std::conj(matrix[0B00]), std::conj(matrix[0B10]),
+                        std::conj(matrix[0B01]), std::conj(matrix[0B11])};
+                    applyMatrix2x2(arr, num_qubits, mat.data(), wires[0]);
+                } else {
+                    applyMatrix2x2(arr, num_qubits, matrix, wires[0]);
+                }
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(arr, num_qubits, wires[0], inverse, [&] {
+                return std::array<std::complex<PrecisionT>, 4>{
+                    matrix[0], matrix[1], matrix[2], matrix[3]};
+            })) {
+            return;
+        }
+        GateImplementationsLM::applySingleQubitOp(arr, num_qubits, matrix,
+                                                  wires, inverse);
+    }
+
+    template <class PrecisionT>
+    static void
+    applyTwoQubitOp(std::complex<PrecisionT> *arr, size_t num_qubits,
+                    const std::complex<PrecisionT> *matrix,
+                    const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                constexpr size_t dim = 4;
+                std::array<std::complex<PrecisionT>, dim * dim> mat{};
+                for (size_t i = 0; i < dim; i++) {
+                    for (size_t j = 0; j < dim; j++) {
+                        mat[i * dim + j] = inverse
+                                               ? std::conj(matrix[j * dim + i])
+                                               : matrix[i * dim + j];
+                    }
+                }
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    [&mat](auto &v00, auto &v01, auto &v10, auto &v11) {
+                        // Row i of the matrix applied to (v00, v01, v10, v11)
+                        const auto row = [&](size_t i) {
+                            return C::add(
+                                C::add(mulComplex<C>(v00, mat[i * dim + 0]),
+                                       mulComplex<C>(v01, mat[i * dim + 1])),
+                                C::add(mulComplex<C>(v10, mat[i * dim + 2]),
+                                       mulComplex<C>(v11, mat[i * dim + 3])));
+                        };
+                        const auto w00 = row(0);
+                        const auto w01 = row(1);
+                        const auto w10 = row(2);
+                        v11 = row(3);
+                        v00 = w00;
+                        v01 = w01;
+                        v10 = w10;
+                    });
+                return;
+            }
+        }
+        GateImplementationsLM::applyTwoQubitOp(arr, num_qubits, matrix, wires,
+                                               inverse);
+    }
+
+    /* Single-qubit gates */
+
+    template <class PrecisionT>
+    static void applyPauliX(std::complex<PrecisionT> *arr,
+                            const size_t num_qubits,
+                            const std::vector<size_t> &wires,
+                            [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                applySingleQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires[0],
+                    [](auto &v0, auto &v1) { std::swap(v0, v1); });
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(arr, num_qubits, wires[0], inverse,
+                                      Gates::getPauliX<PrecisionT>)) {
+            return;
+        }
+        GateImplementationsLM::applyPauliX(arr, num_qubits, wires, inverse);
+    }
+
+    template <class PrecisionT>
+    static void applyPauliY(std::complex<PrecisionT> *arr,
+                            const size_t num_qubits,
+                            const std::vector<size_t> &wires,
+                            [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                applySingleQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires[0], [](auto &v0, auto &v1) {
+                        const auto w0 = mulImag<C>(v1, -1);
+                        v1 = mulImag<C>(v0, 1);
+                        v0 = w0;
+                    });
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(arr, num_qubits, wires[0], inverse,
+                                      Gates::getPauliY<PrecisionT>)) {
+            return;
+        }
+        GateImplementationsLM::applyPauliY(arr, num_qubits, wires, inverse);
+    }
+
+    template <class PrecisionT>
+    static void applyPauliZ(std::complex<PrecisionT> *arr,
+                            const size_t num_qubits,
+                            const std::vector<size_t> &wires,
+                            [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                applySingleQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires[0],
+                    []([[maybe_unused]] auto &v0, auto &v1) {
+                        v1 = mulReal<C>(v1, -1);
+                    });
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(arr, num_qubits, wires[0], inverse,
+                                      Gates::getPauliZ<PrecisionT>)) {
+            return;
+        }
+        GateImplementationsLM::applyPauliZ(arr, num_qubits, wires, inverse);
+    }
+
+    template <class PrecisionT>
+    static void applyHadamard(std::complex<PrecisionT> *arr,
+                              const size_t num_qubits,
+                              const std::vector<size_t> &wires,
+                              [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                constexpr static auto isqrt2 = Util::INVSQRT2<PrecisionT>();
+                applySingleQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires[0], [](auto &v0, auto &v1) {
+                        const auto w0 = mulReal<C>(C::add(v0, v1), isqrt2);
+                        v1 = mulReal<C>(C::sub(v0, v1), isqrt2);
+                        v0 = w0;
+                    });
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(arr, num_qubits, wires[0], inverse,
+                                      Gates::getHadamard<PrecisionT>)) {
+            return;
+        }
+        GateImplementationsLM::applyHadamard(arr, num_qubits, wires, inverse);
+    }
+
+    template <class PrecisionT>
+    static void applyS(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                       const std::vector<size_t> &wires, bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const PrecisionT s = inverse ? -1 : 1;
+                applySingleQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires[0],
+                    [s]([[maybe_unused]] auto &v0, auto &v1) {
+                        v1 = mulImag<C>(v1, s);
+                    });
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(arr, num_qubits, wires[0], inverse,
+                                      Gates::getS<PrecisionT>)) {
+            return;
+        }
+        GateImplementationsLM::applyS(arr, num_qubits, wires, inverse);
+    }
+
+    template <class PrecisionT>
+    static void applyT(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                       const std::vector<size_t> &wires, bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                constexpr static auto isqrt2 = Util::INVSQRT2<PrecisionT>();
+                const std::complex<PrecisionT> shift = {
+                    isqrt2, inverse ? -isqrt2 : isqrt2};
+                applySingleQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires[0],
+                    [shift]([[maybe_unused]] auto &v0, auto &v1) {
+                        v1 = mulComplex<C>(v1, shift);
+                    });
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(arr, num_qubits, wires[0], inverse,
+                                      Gates::getT<PrecisionT>)) {
+            return;
+        }
+        GateImplementationsLM::applyT(arr, num_qubits, wires, inverse);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyPhaseShift(std::complex<PrecisionT> *arr,
+                                const size_t num_qubits,
+                                const std::vector<size_t> &wires, bool inverse,
+                                ParamT angle) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const std::complex<PrecisionT> s =
+                    inverse ? std::exp(-std::complex<PrecisionT>(0, angle))
+                            : std::exp(std::complex<PrecisionT>(0, angle));
+                applySingleQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires[0],
+                    [s]([[maybe_unused]] auto &v0, auto &v1) {
+                        v1 = mulComplex<C>(v1, s);
+                    });
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(
+                arr, num_qubits, wires[0], inverse,
+                [angle] { return Gates::getPhaseShift<PrecisionT>(angle); })) {
+            return;
+        }
+        GateImplementationsLM::applyPhaseShift(arr, num_qubits, wires, inverse,
+                                               angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyRX(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                        const std::vector<size_t> &wires, bool inverse,
+                        ParamT angle) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const PrecisionT c = std::cos(angle / 2);
+                const PrecisionT js =
+                    (inverse) ? -std::sin(-angle / 2) : std::sin(-angle / 2);
+                applySingleQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires[0], [c, js](auto &v0, auto &v1) {
+                        const auto w0 =
+                            C::add(mulReal<C>(v0, c), mulImag<C>(v1, js));
+                        v1 = C::add(mulImag<C>(v0, js), mulReal<C>(v1, c));
+                        v0 = w0;
+                    });
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(
+                arr, num_qubits, wires[0], inverse,
+                [angle] { return Gates::getRX<PrecisionT>(angle); })) {
+            return;
+        }
+        GateImplementationsLM::applyRX(arr, num_qubits, wires, inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyRY(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                        const std::vector<size_t> &wires, bool inverse,
+                        ParamT angle) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const PrecisionT c = std::cos(angle / 2);
+                const PrecisionT s =
+                    (inverse) ? -std::sin(angle / 2) : std::sin(angle / 2);
+                applySingleQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires[0], [c, s](auto &v0, auto &v1) {
+                        const auto w0 =
+                            C::sub(mulReal<C>(v0, c), mulReal<C>(v1, s));
+                        v1 = C::add(mulReal<C>(v0, s), mulReal<C>(v1, c));
+                        v0 = w0;
+                    });
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(
+                arr, num_qubits, wires[0], inverse,
+                [angle] { return Gates::getRY<PrecisionT>(angle); })) {
+            return;
+        }
+        GateImplementationsLM::applyRY(arr, num_qubits, wires, inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyRZ(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                        const std::vector<size_t> &wires, bool inverse,
+                        ParamT angle) {
+        PL_ASSERT(wires.size() == 1);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const std::complex<PrecisionT> first{std::cos(angle / 2),
+                                                     -std::sin(angle / 2)};
+                const std::complex<PrecisionT> second{std::cos(angle / 2),
+                                                      std::sin(angle / 2)};
+                const auto shift0 = inverse ? std::conj(first) : first;
+                const auto shift1 = inverse ? std::conj(second) : second;
+                applySingleQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires[0],
+                    [shift0, shift1](auto &v0, auto &v1) {
+                        v0 = mulComplex<C>(v0, shift0);
+                        v1 = mulComplex<C>(v1, shift1);
+                    });
+                return;
+            }
+        }
+        if (applyInternal<PrecisionT>(
+                arr, num_qubits, wires[0], inverse,
+                [angle] { return Gates::getRZ<PrecisionT>(angle); })) {
+            return;
+        }
+        GateImplementationsLM::applyRZ(arr, num_qubits, wires, inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyRot(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                         const std::vector<size_t> &wires, bool inverse,
+                         ParamT phi, ParamT theta, ParamT omega) {
+        PL_ASSERT(wires.size() == 1);
+
+        const auto rotMat =
+            (inverse) ? Gates::getRot<PrecisionT>(-omega, -theta, -phi)
+                      : Gates::getRot<PrecisionT>(phi, theta, omega);
+
+        applySingleQubitOp(arr, num_qubits, rotMat.data(), wires);
+    }
+
+    /* Two-qubit gates */
+
+    template <class PrecisionT>
+    static void
+    applyCNOT(std::complex<PrecisionT> *arr, const size_t num_qubits,
+              const std::vector<size_t> &wires, [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    []([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+                       auto &v10, auto &v11) { std::swap(v10, v11); });
+                return;
+            }
+        }
+        GateImplementationsLM::applyCNOT(arr, num_qubits, wires, inverse);
+    }
+
+    template <class PrecisionT>
+    static void applyCY(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                        const std::vector<size_t> &wires,
+                        [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    []([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+                       auto &v10, auto &v11) {
+                        const auto w10 = mulImag<C>(v11, -1);
+                        v11 = mulImag<C>(v10, 1);
+                        v10 = w10;
+                    });
+                return;
+            }
+        }
+        GateImplementationsLM::applyCY(arr, num_qubits, wires, inverse);
+    }
+
+    template <class PrecisionT>
+    static void applyCZ(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                        const std::vector<size_t> &wires,
+                        [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    []([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+                       [[maybe_unused]] auto &v10,
+                       auto &v11) { v11 = mulReal<C>(v11, -1); });
+                return;
+            }
+        }
+        GateImplementationsLM::applyCZ(arr, num_qubits, wires, inverse);
+    }
+
+    template <class PrecisionT>
+    static void applySWAP(std::complex<PrecisionT> *arr, size_t num_qubits,
+                          const std::vector<size_t> &wires,
+                          [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    []([[maybe_unused]] auto &v00, auto &v01, auto &v10,
+                       [[maybe_unused]] auto &v11) { std::swap(v01, v10); });
+                return;
+            }
+        }
+        GateImplementationsLM::applySWAP(arr, num_qubits, wires, inverse);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyControlledPhaseShift(std::complex<PrecisionT> *arr,
+                                          const size_t num_qubits,
+                                          const std::vector<size_t> &wires,
+                                          bool inverse, ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const std::complex<PrecisionT> s =
+                    inverse ? std::exp(-std::complex<PrecisionT>(0, angle))
+                            : std::exp(std::complex<PrecisionT>(0, angle));
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    [s]([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+                        [[maybe_unused]] auto &v10,
+                        auto &v11) { v11 = mulComplex<C>(v11, s); });
+                return;
+            }
+        }
+        GateImplementationsLM::applyControlledPhaseShift(arr, num_qubits, wires,
+                                                         inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyCRX(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                         const std::vector<size_t> &wires, bool inverse,
+                         ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const PrecisionT c = std::cos(angle / 2);
+                const PrecisionT js =
+                    (inverse) ? std::sin(angle / 2) : -std::sin(angle / 2);
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    [c, js]([[maybe_unused]] auto &v00,
+                            [[maybe_unused]] auto &v01, auto &v10, auto &v11) {
+                        const auto w10 =
+                            C::add(mulReal<C>(v10, c), mulImag<C>(v11, js));
+                        v11 = C::add(mulImag<C>(v10, js), mulReal<C>(v11, c));
+                        v10 = w10;
+                    });
+                return;
+            }
+        }
+        GateImplementationsLM::applyCRX(arr, num_qubits, wires, inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyCRY(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                         const std::vector<size_t> &wires, bool inverse,
+                         ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const PrecisionT c = std::cos(angle / 2);
+                const PrecisionT s =
+                    (inverse) ? -std::sin(angle / 2) : std::sin(angle / 2);
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    [c, s]([[maybe_unused]] auto &v00,
+                           [[maybe_unused]] auto &v01, auto &v10, auto &v11) {
+                        const auto w10 =
+                            C::sub(mulReal<C>(v10, c), mulReal<C>(v11, s));
+                        v11 = C::add(mulReal<C>(v10, s), mulReal<C>(v11, c));
+                        v10 = w10;
+                    });
+                return;
+            }
+        }
+        GateImplementationsLM::applyCRY(arr, num_qubits, wires, inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyCRZ(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                         const std::vector<size_t> &wires, bool inverse,
+                         ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const std::complex<PrecisionT> first{std::cos(angle / 2),
+                                                     -std::sin(angle / 2)};
+                const std::complex<PrecisionT> second{std::cos(angle / 2),
+                                                      std::sin(angle / 2)};
+                const auto shift0 = inverse ? std::conj(first) : first;
+                const auto shift1 = inverse ? std::conj(second) : second;
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    [shift0, shift1]([[maybe_unused]] auto &v00,
+                                     [[maybe_unused]] auto &v01, auto &v10,
+                                     auto &v11) {
+                        v10 = mulComplex<C>(v10, shift0);
+                        v11 = mulComplex<C>(v11, shift1);
+                    });
+                return;
+            }
+        }
+        GateImplementationsLM::applyCRZ(arr, num_qubits, wires, inverse, angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyCRot(std::complex<PrecisionT> *arr, size_t num_qubits,
+                          const std::vector<size_t> &wires, bool inverse,
+                          ParamT phi, ParamT theta, ParamT omega) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const auto rotMat =
+                    (inverse) ? Gates::getRot<PrecisionT>(-omega, -theta, -phi)
+                              : Gates::getRot<PrecisionT>(phi, theta, omega);
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    [&rotMat]([[maybe_unused]] auto &v00,
+                              [[maybe_unused]] auto &v01, auto &v10,
+                              auto &v11) {
+                        const auto w10 = C::add(mulComplex<C>(v10, rotMat[0]),
+                                                mulComplex<C>(v11, rotMat[1]));
+                        v11 = C::add(mulComplex<C>(v10, rotMat[2]),
+                                     mulComplex<C>(v11, rotMat[3]));
+                        v10 = w10;
+                    });
+                return;
+            }
+        }
+        GateImplementationsLM::applyCRot(arr, num_qubits, wires, inverse, phi,
+                                         theta, omega);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyIsingXX(std::complex<PrecisionT> *arr, size_t num_qubits,
+                             const std::vector<size_t> &wires, bool inverse,
+                             ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const PrecisionT cr = std::cos(angle / 2);
+                const PrecisionT sj =
+                    inverse ? std::sin(angle / 2) : -std::sin(angle / 2);
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    [cr, sj](auto &v00, auto &v01, auto &v10, auto &v11) {
+                        const auto w00 =
+                            C::add(mulReal<C>(v00, cr), mulImag<C>(v11, sj));
+                        const auto w01 =
+                            C::add(mulReal<C>(v01, cr), mulImag<C>(v10, sj));
+                        const auto w10 =
+                            C::add(mulReal<C>(v10, cr), mulImag<C>(v01, sj));
+                        v11 = C::add(mulReal<C>(v11, cr), mulImag<C>(v00, sj));
+                        v00 = w00;
+                        v01 = w01;
+                        v10 = w10;
+                    });
+                return;
+            }
+        }
+        GateImplementationsLM::applyIsingXX(arr, num_qubits, wires, inverse,
+                                            angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyIsingXY(std::complex<PrecisionT> *arr, size_t num_qubits,
+                             const std::vector<size_t> &wires, bool inverse,
+                             ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const PrecisionT cr = std::cos(angle / 2);
+                const PrecisionT sj =
+                    inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    [cr, sj]([[maybe_unused]] auto &v00, auto &v01, auto &v10,
+                             [[maybe_unused]] auto &v11) {
+                        const auto w01 =
+                            C::add(mulReal<C>(v01, cr), mulImag<C>(v10, sj));
+                        v10 = C::add(mulReal<C>(v10, cr), mulImag<C>(v01, sj));
+                        v01 = w01;
+                    });
+                return;
+            }
+        }
+        GateImplementationsLM::applyIsingXY(arr, num_qubits, wires, inverse,
+                                            angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyIsingYY(std::complex<PrecisionT> *arr, size_t num_qubits,
+                             const std::vector<size_t> &wires, bool inverse,
+                             ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const PrecisionT cr = std::cos(angle / 2);
+                const PrecisionT sj =
+                    inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    [cr, sj](auto &v00, auto &v01, auto &v10, auto &v11) {
+                        const auto w00 =
+                            C::add(mulReal<C>(v00, cr), mulImag<C>(v11, sj));
+                        const auto w01 =
+                            C::sub(mulReal<C>(v01, cr), mulImag<C>(v10, sj));
+                        const auto w10 =
+                            C::sub(mulReal<C>(v10, cr), mulImag<C>(v01, sj));
+                        v11 = C::add(mulReal<C>(v11, cr), mulImag<C>(v00, sj));
+                        v00 = w00;
+                        v01 = w01;
+                        v10 = w10;
+                    });
+                return;
+            }
+        }
+        GateImplementationsLM::applyIsingYY(arr, num_qubits, wires, inverse,
+                                            angle);
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyIsingZZ(std::complex<PrecisionT> *arr,
+                             const size_t num_qubits,
+                             const std::vector<size_t> &wires, bool inverse,
+                             ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        if (useIntrinsics<PrecisionT>(num_qubits, wires)) {
+            if constexpr (Concept<PrecisionT>::available) {
+                using C = Concept<PrecisionT>;
+                const std::complex<PrecisionT> first{std::cos(angle / 2),
+                                                     -std::sin(angle / 2)};
+                const std::complex<PrecisionT> second{std::cos(angle / 2),
+                                                      std::sin(angle / 2)};
+                const auto shift0 = inverse ? std::conj(first) : first;
+                const auto shift1 = inverse ? std::conj(second) : second;
+                applyTwoQubitIntrin<PrecisionT>(
+                    arr, num_qubits, wires,
+                    [shift0, shift1](auto &v00, auto &v01, auto &v10,
+                                     auto &v11) {
+                        v00 = mulComplex<C>(v00, shift0);
+                        v01 = mulComplex<C>(v01, shift1);
+                        v10 = mulComplex<C>(v10, shift1);
+                        v11 = mulComplex<C>(v11, shift0);
+                    });
+                return;
+            }
+        }
+        GateImplementationsLM::applyIsingZZ(arr, num_qubits, wires, inverse,
+                                            angle);
+    }
+};
+} // namespace Pennylane::Gates::AVXCommon::inline PL_AVX_KERNEL_NAMESPACE
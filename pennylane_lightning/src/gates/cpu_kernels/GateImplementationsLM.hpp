@@ -24,9 +24,14 @@
 #include "KernelType.hpp"
 #include "LinearAlgebra.hpp"
 #include "PauliGenerator.hpp"
+#include "PauliRot.hpp"
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <complex>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace Pennylane::Gates {
@@ -39,8 +44,8 @@ namespace Pennylane::Gates {
  * @tparam PrecisionT Floating point precision of underlying statevector data
  */
 class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
-  private:
-    /* Alias utility functions */
+  public:
+    /* Utility functions. These are also used by other kernels. */
     static std::pair<size_t, size_t> revWireParity(size_t rev_wire) {
         using Util::fillLeadingOnes;
         using Util::fillTrailingOnes;
@@ -66,7 +71,6 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
         return {parity_high, parity_middle, parity_low};
     }
 
-  public:
     constexpr static KernelType kernel_id = KernelType::LM;
     constexpr static std::string_view name = "LM";
     template <typename PrecisionT>
@@ -280,65 +284,464 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
         }
     }
 
+    /**
+     * @brief Number of blocks gathered into one buffer by
+     * applyMultiQubitOpBlocks.
+     */
+    constexpr static size_t multi_qubit_op_batch = 32;
+
+    /**
+     * @brief Bit positions of the given wires in ascending order and the
+     * offset of each basis state of the wires.
+     *
+     * Offset i has the bits of i at the positions of the wires, where
+     * wires[0] corresponds to the most significant bit of i.
+     *
+     * @param num_qubits Number of qubits.
+     * @param wires Wires.
+     */
+    static auto multiQubitOffsets(size_t num_qubits,
+                                  const std::vector<size_t> &wires)
+        -> std::pair<std::vector<size_t>, std::vector<size_t>> {
+        const size_t n_wires = wires.size();
+        const size_t dim = Util::exp2(n_wires);
+        std::vector<size_t> rev_wires(n_wires);
+        std::vector<size_t> offsets(dim, 0);
+        for (size_t k = 0; k < n_wires; k++) {
+            PL_ASSERT(wires[k] < num_qubits);
+            rev_wires[k] = num_qubits - 1 - wires[k];
+            for (size_t inner = 0; inner < dim; inner++) {
+                if (((inner >> (n_wires - 1 - k)) & 1U) != 0) {
+                    offsets[inner] |= static_cast<size_t>(1U) << rev_wires[k];
+                }
+            }
+        }
+        std::sort(rev_wires.begin(), rev_wires.end());
+        return {rev_wires, offsets};
+    }
+
+    /**
+     * @brief Apply a dense matrix to the blocks [begin, end) of the
+     * statevector.
+     *
+     * Block `outer` consists of the amplitudes `base + offsets[i]`, where
+     * base is `outer` with zero bits inserted at the positions of the
+     * wires. Blocks are gathered into a local buffer, so the product never
+     * reads amplitudes it has already written.
+     *
+     * @param arr Pointer to the statevector.
+     * @param mat Matrix to apply in row-major order.
+     * @param rev_wires Bit positions of the wires in ascending order.
+     * @param offsets Offset of each basis state of the wires.
+     * @param begin First block.
+     * @param end One past the last block.
+     */
+    template <class PrecisionT>
+    static void
+    applyMultiQubitOpBlocks(std::complex<PrecisionT> *arr,
+                            const std::complex<PrecisionT> *mat,
+                            const std::vector<size_t> &rev_wires,
+                            const std::vector<size_t> &offsets, size_t begin,
+                            size_t end) {
+        const size_t dim = offsets.size();
+        std::vector<std::complex<PrecisionT>> coeffs_in(multi_qubit_op_batch *
+                                                        dim);
+        std::vector<std::complex<PrecisionT>> coeffs_out(
+            multi_qubit_op_batch * dim);
+        std::array<size_t, multi_qubit_op_batch> bases{};
+
+        for (size_t first = begin; first < end;
+             first += multi_qubit_op_batch) {
+            const size_t batch = std::min(multi_qubit_op_batch, end - first);
+            for (size_t b = 0; b < batch; b++) {
+                size_t base = first + b;
+                for (const size_t rev_wire : rev_wires) {
+                    base = ((base >> rev_wire) << (rev_wire + 1)) |
+                           (base & Util::fillTrailingOnes(rev_wire));
+                }
+                bases[b] = base;
+                for (size_t j = 0; j < dim; j++) {
+                    coeffs_in[b * dim + j] = arr[base + offsets[j]];
+                }
+            }
+
+            if constexpr (USE_CBLAS) {
+                // coeffs_out = coeffs_in * mat^T for all blocks at once
+                Util::matrixMatProd(coeffs_in.data(), mat, coeffs_out.data(),
+                                    batch, dim, dim, Util::Trans::Transpose);
+            } else {
+                for (size_t b = 0; b < batch; b++) {
+                    const auto *in = coeffs_in.data() + b * dim;
+                    auto *out = coeffs_out.data() + b * dim;
+                    for (size_t i = 0; i < dim; i++) {
+                        const auto *row = mat + i * dim;
+                        std::complex<PrecisionT> sum{0.0, 0.0};
+                        for (size_t j = 0; j < dim; j++) {
+                            sum += row[j] * in[j];
+                        }
+                        out[i] = sum;
+                    }
+                }
+            }
+
+            for (size_t b = 0; b < batch; b++) {
+                for (size_t i = 0; i < dim; i++) {
+                    arr[bases[b] + offsets[i]] = coeffs_out[b * dim + i];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Matrix in row-major order, or its conjugate transpose if
+     * inverse is true.
+     */
+    template <class PrecisionT>
+    static auto multiQubitMatrix(const std::complex<PrecisionT> *matrix,
+                                 size_t dim, bool inverse)
+        -> std::vector<std::complex<PrecisionT>> {
+        std::vector<std::complex<PrecisionT>> mat(matrix, matrix + dim * dim);
+        if (inverse) {
+            for (size_t i = 0; i < dim; i++) {
+                for (size_t j = 0; j < dim; j++) {
+                    mat[i * dim + j] = std::conj(matrix[j * dim + i]);
+                }
+            }
+        }
+        return mat;
+    }
+
+    /**
+     * @brief Apply a matrix acting on any number of wires.
+     *
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param matrix Perfect square matrix in row-major order.
+     * @param wires Wires the gate applies to. wires[0] corresponds to the
+     * most significant bit of the matrix index.
+     * @param inverse Indicate whether inverse should be taken.
+     */
     template <class PrecisionT>
     static void
     applyMultiQubitOp(std::complex<PrecisionT> *arr, size_t num_qubits,
                       const std::complex<PrecisionT> *matrix,
                       const std::vector<size_t> &wires, bool inverse) {
-        using Util::bitswap;
         PL_ASSERT(num_qubits >= wires.size());
 
-        const size_t dim = static_cast<size_t>(1U) << wires.size();
-        std::vector<size_t> indices(dim);
-        std::vector<std::complex<PrecisionT>> coeffs_in(dim, 0.0);
+        const size_t dim = Util::exp2(wires.size());
+        const auto mat = multiQubitMatrix(matrix, dim, inverse);
+        const auto [rev_wires, offsets] = multiQubitOffsets(num_qubits, wires);
+        applyMultiQubitOpBlocks(arr, mat.data(), rev_wires, offsets, 0,
+                                Util::exp2(num_qubits - wires.size()));
+    }
 
-        if (inverse) {
-            for (size_t k = 0; k < Util::exp2(num_qubits); k += dim) {
-                for (size_t inner_idx = 0; inner_idx < dim; inner_idx++) {
-                    size_t idx = k | inner_idx;
-                    const size_t n_wires = wires.size();
-                    for (size_t pos = 0; pos < n_wires; pos++) {
-                        idx = bitswap(idx, n_wires - pos - 1,
-                                      num_qubits - wires[pos] - 1);
+    /**
+     * @brief Maximum number of wires of applyTensorProduct, which bounds
+     * the size of its local buffer.
+     */
+    constexpr static size_t max_tensor_product_wires = 6;
+
+    /**
+     * @brief Apply the tensor product of single-qubit matrices in a single
+     * pass over the statevector.
+     *
+     * Each block of the @f$2^k@f$ amplitudes of the wires is gathered into a
+     * local buffer, the @f$k@f$ single-qubit matrices are applied to the
+     * buffer one after another, and the buffer is written back. The cost
+     * per amplitude is thus linear in @f$k@f$, instead of @f$2^k@f$ for the
+     * dense matrix of the product.
+     *
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param matrices Matrices in row-major order, 4 elements each, where
+     * matrices[4 * k] to matrices[4 * k + 3] act on wires[k].
+     * @param wires Distinct wires the matrices apply to.
+     */
+    template <class PrecisionT>
+    static void applyTensorProduct(std::complex<PrecisionT> *arr,
+                                   size_t num_qubits,
+                                   const std::complex<PrecisionT> *matrices,
+                                   const std::vector<size_t> &wires) {
+        const size_t n_wires = wires.size();
+        PL_ASSERT(n_wires <= max_tensor_product_wires);
+        PL_ASSERT(num_qubits >= n_wires);
+
+        const size_t dim = Util::exp2(n_wires);
+        const auto [rev_wires, offsets] = multiQubitOffsets(num_qubits, wires);
+        std::array<std::complex<PrecisionT>,
+                   static_cast<size_t>(1U) << max_tensor_product_wires>
+            buffer{};
+
+        for (size_t outer = 0; outer < Util::exp2(num_qubits - n_wires);
+             outer++) {
+            size_t base = outer;
+            for (const size_t rev_wire : rev_wires) {
+                base = ((base >> rev_wire) << (rev_wire + 1)) |
+                       (base & Util::fillTrailingOnes(rev_wire));
+            }
+            for (size_t i = 0; i < dim; i++) {
+                buffer[i] = arr[base + offsets[i]];
+            }
+            for (size_t k = 0; k < n_wires; k++) {
+                // wires[k] is the bit n_wires - 1 - k of the buffer index
+                const size_t stride = static_cast<size_t>(1U)
+                                      << (n_wires - 1 - k);
+                const std::complex<PrecisionT> *mat = matrices + 4 * k;
+                for (size_t i0 = 0; i0 < dim; i0++) {
+                    if ((i0 & stride) != 0) {
+                        continue;
                     }
-                    indices[inner_idx] = idx;
-                    coeffs_in[inner_idx] = arr[idx];
+                    const size_t i1 = i0 | stride;
+                    const std::complex<PrecisionT> v0 = buffer[i0];
+                    const std::complex<PrecisionT> v1 = buffer[i1];
+                    buffer[i0] = mat[0B00] * v0 + mat[0B01] * v1;
+                    buffer[i1] = mat[0B10] * v0 + mat[0B11] * v1;
                 }
+            }
+            for (size_t i = 0; i < dim; i++) {
+                arr[base + offsets[i]] = buffer[i];
+            }
+        }
+    }
 
-                for (size_t i = 0; i < dim; i++) {
-                    const auto idx = indices[i];
-                    arr[idx] = 0.0;
-
-                    for (size_t j = 0; j < dim; j++) {
-                        const size_t base_idx = j * dim;
-                        arr[idx] +=
-                            std::conj(matrix[base_idx + i]) * coeffs_in[j];
-                    }
+    /**
+     * @brief Apply a matrix to the target wires for the basis states in which
+     * the control wires have the given values.
+     *
+     * Only the @f$2^{n-c}@f$ amplitudes whose control bits match are read and
+     * written, instead of applying a dense matrix to all control and target
+     * wires.
+     *
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param matrix Matrix acting on the target wires in row-major order.
+     * @param controlled_wires Control wires.
+     * @param controlled_values Value, 0 or 1, of each control wire for which
+     * the matrix is applied.
+     * @param wires Target wires. wires[0] corresponds to the most significant
+     * bit of the matrix index.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    template <class PrecisionT>
+    static void
+    applyControlledMatrix(std::complex<PrecisionT> *arr, size_t num_qubits,
+                          const std::complex<PrecisionT> *matrix,
+                          const std::vector<size_t> &controlled_wires,
+                          const std::vector<bool> &controlled_values,
+                          const std::vector<size_t> &wires, bool inverse) {
+        const size_t n_contr = controlled_wires.size();
+        const size_t n_wires = wires.size();
+        PL_ABORT_IF(controlled_values.size() != n_contr,
+                    "The number of control wires and values must be equal.");
+        PL_ABORT_IF(n_wires == 0, "Number of wires must be larger than 0");
+        PL_ABORT_IF(n_contr + n_wires > num_qubits,
+                    "The number of wires exceeds the number of qubits.");
+
+        // Bit positions of all wires, for inserting zero bits into the
+        // index of the untouched wires
+        std::vector<size_t> rev_wires;
+        rev_wires.reserve(n_contr + n_wires);
+        size_t ctrl_offset = 0;
+        for (size_t k = 0; k < n_contr; k++) {
+            PL_ABORT_IF(controlled_wires[k] >= num_qubits,
+                        "Invalid wire index.");
+            const size_t rev_wire = num_qubits - 1 - controlled_wires[k];
+            rev_wires.emplace_back(rev_wire);
+            if (controlled_values[k]) {
+                ctrl_offset |= static_cast<size_t>(1U) << rev_wire;
+            }
+        }
+        const size_t dim = Util::exp2(n_wires);
+        std::vector<size_t> offsets(dim, 0);
+        for (size_t k = 0; k < n_wires; k++) {
+            PL_ABORT_IF(wires[k] >= num_qubits, "Invalid wire index.");
+            const size_t rev_wire = num_qubits - 1 - wires[k];
+            rev_wires.emplace_back(rev_wire);
+            for (size_t inner = 0; inner < dim; inner++) {
+                if (((inner >> (n_wires - 1 - k)) & 1U) != 0) {
+                    offsets[inner] |= static_cast<size_t>(1U) << rev_wire;
                 }
             }
-        } else {
-            for (size_t k = 0; k < Util::exp2(num_qubits); k += dim) {
-                for (size_t inner_idx = 0; inner_idx < dim; inner_idx++) {
-                    size_t idx = k | inner_idx;
-                    const size_t n_wires = wires.size();
-                    for (size_t pos = 0; pos < n_wires; pos++) {
-                        idx = bitswap(idx, n_wires - pos - 1,
-                                      num_qubits - wires[pos] - 1);
-                    }
-                    indices[inner_idx] = idx;
-                    coeffs_in[inner_idx] = arr[idx];
+        }
+        std::sort(rev_wires.begin(), rev_wires.end());
+        PL_ABORT_IF(std::adjacent_find(rev_wires.begin(), rev_wires.end()) !=
+                        rev_wires.end(),
+                    "Control and target wires must be distinct.");
+
+        const auto mat = multiQubitMatrix(matrix, dim, inverse);
+
+        const size_t num_outer = Util::exp2(num_qubits - rev_wires.size());
+        const auto base_index = [&rev_wires, ctrl_offset](size_t outer) {
+            for (const size_t rev_wire : rev_wires) {
+                outer = ((outer >> rev_wire) << (rev_wire + 1)) |
+                        (outer & Util::fillTrailingOnes(rev_wire));
+            }
+            return outer | ctrl_offset;
+        };
+
+        if (n_wires == 1) {
+            const size_t shift = offsets[1];
+            for (size_t outer = 0; outer < num_outer; outer++) {
+                const size_t i0 = base_index(outer);
+                const size_t i1 = i0 | shift;
+                const std::complex<PrecisionT> v0 = arr[i0];
+                const std::complex<PrecisionT> v1 = arr[i1];
+                arr[i0] = mat[0B00] * v0 + mat[0B01] * v1;
+                arr[i1] = mat[0B10] * v0 + mat[0B11] * v1;
+            }
+            return;
+        }
+
+        std::vector<std::complex<PrecisionT>> coeffs_in(dim);
+        for (size_t outer = 0; outer < num_outer; outer++) {
+            const size_t base = base_index(outer);
+            for (size_t inner = 0; inner < dim; inner++) {
+                coeffs_in[inner] = arr[base | offsets[inner]];
+            }
+            for (size_t i = 0; i < dim; i++) {
+                std::complex<PrecisionT> sum{0.0, 0.0};
+                for (size_t j = 0; j < dim; j++) {
+                    sum += mat[i * dim + j] * coeffs_in[j];
                 }
+                arr[base | offsets[i]] = sum;
+            }
+        }
+    }
 
-                for (size_t i = 0; i < dim; i++) {
-                    const auto idx = indices[i];
-                    arr[idx] = 0.0;
-                    const size_t base_idx = i * dim;
+    /**
+     * @brief Multiply the blocks [begin, end) of the statevector by a
+     * diagonal matrix.
+     *
+     * @param arr Pointer to the statevector.
+     * @param diag Diagonal elements of the matrix.
+     * @param rev_wires Bit positions of the wires in ascending order.
+     * @param offsets Offset of each basis state of the wires.
+     * @param begin First block.
+     * @param end One past the last block.
+     * @see applyMultiQubitOpBlocks
+     */
+    template <class PrecisionT>
+    static void applyDiagonalBlocks(std::complex<PrecisionT> *arr,
+                                    const std::complex<PrecisionT> *diag,
+                                    const std::vector<size_t> &rev_wires,
+                                    const std::vector<size_t> &offsets,
+                                    size_t begin, size_t end) {
+        const size_t dim = offsets.size();
+        for (size_t outer = begin; outer < end; outer++) {
+            size_t base = outer;
+            for (const size_t rev_wire : rev_wires) {
+                base = ((base >> rev_wire) << (rev_wire + 1)) |
+                       (base & Util::fillTrailingOnes(rev_wire));
+            }
+            for (size_t i = 0; i < dim; i++) {
+                arr[base + offsets[i]] *= diag[i];
+            }
+        }
+    }
 
-                    for (size_t j = 0; j < dim; j++) {
-                        arr[idx] += matrix[base_idx + j] * coeffs_in[j];
-                    }
+    /**
+     * @brief Diagonal elements, or their complex conjugates if inverse is
+     * true.
+     */
+    template <class PrecisionT>
+    static auto diagonalMatrix(const std::complex<PrecisionT> *diag,
+                               size_t dim, bool inverse)
+        -> std::vector<std::complex<PrecisionT>> {
+        std::vector<std::complex<PrecisionT>> res(diag, diag + dim);
+        if (inverse) {
+            for (auto &elt : res) {
+                elt = std::conj(elt);
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @brief Apply a diagonal matrix acting on any number of wires.
+     *
+     * Each amplitude is multiplied by the diagonal element of its basis state
+     * of the wires in a single pass over the statevector. Phase oracles and
+     * products of gates such as RZ, CZ, IsingZZ and MultiRZ can be applied
+     * this way without forming a dense matrix.
+     *
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param diag Diagonal elements of the matrix. Its size must be
+     * @f$2^{|\text{wires}|}@f$.
+     * @param wires Wires the matrix applies to. wires[0] corresponds to the
+     * most significant bit of the index of diag.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    template <class PrecisionT>
+    static void applyDiagonal(std::complex<PrecisionT> *arr, size_t num_qubits,
+                              const std::complex<PrecisionT> *diag,
+                              const std::vector<size_t> &wires, bool inverse) {
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        PL_ABORT_IF(wires.size() > num_qubits,
+                    "The number of wires exceeds the number of qubits.");
+        PL_ABORT_IF(std::any_of(wires.begin(), wires.end(),
+                                [num_qubits](size_t wire) {
+                                    return wire >= num_qubits;
+                                }),
+                    "Invalid wire index.");
+
+        const size_t dim = Util::exp2(wires.size());
+        const auto mat = diagonalMatrix(diag, dim, inverse);
+        const auto [rev_wires, offsets] = multiQubitOffsets(num_qubits, wires);
+        PL_ABORT_IF(std::adjacent_find(rev_wires.begin(), rev_wires.end()) !=
+                        rev_wires.end(),
+                    "Wires must be distinct.");
+        applyDiagonalBlocks(arr, mat.data(), rev_wires, offsets, 0,
+                            Util::exp2(num_qubits - wires.size()));
+    }
+
+    /**
+     * @brief Swap disjoint pairs of wires in a single pass over the
+     * statevector.
+     *
+     * Applying a SWAP gate for each pair takes a pass per pair, while this
+     * moves each amplitude at most once.
+     *
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param wire_pairs Pairs of wires to swap. All wires must be distinct.
+     */
+    template <class PrecisionT>
+    static void
+    applyDisjointSWAPs(std::complex<PrecisionT> *arr, size_t num_qubits,
+                       const std::vector<std::pair<size_t, size_t>>
+                           &wire_pairs) {
+        if (wire_pairs.size() == 1) {
+            applySWAP(arr, num_qubits,
+                      {wire_pairs[0].first, wire_pairs[0].second}, false);
+            return;
+        }
+        std::vector<size_t> wires;
+        std::vector<std::pair<size_t, size_t>> rev_wire_pairs;
+        for (const auto &[wire0, wire1] : wire_pairs) {
+            PL_ABORT_IF(wire0 >= num_qubits || wire1 >= num_qubits,
+                        "Invalid wire index.");
+            wires.push_back(wire0);
+            wires.push_back(wire1);
+            rev_wire_pairs.emplace_back(num_qubits - 1 - wire0,
+                                        num_qubits - 1 - wire1);
+        }
+        std::sort(wires.begin(), wires.end());
+        PL_ABORT_IF(std::adjacent_find(wires.begin(), wires.end()) !=
+                        wires.end(),
+                    "Wires must be distinct.");
+
+        for (size_t idx = 0; idx < Util::exp2(num_qubits); idx++) {
+            size_t swapped = idx;
+            for (const auto &[rev_wire0, rev_wire1] : rev_wire_pairs) {
+                if ((((idx >> rev_wire0) ^ (idx >> rev_wire1)) & 1U) != 0) {
+                    swapped ^= (static_cast<size_t>(1U) << rev_wire0) |
+                               (static_cast<size_t>(1U) << rev_wire1);
                 }
             }
+            if (idx < swapped) {
+                std::swap(arr[idx], arr[swapped]);
+            }
         }
     }
 
@@ -1065,6 +1468,69 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
         }
     }
 
+    /**
+     * @brief Apply the Pauli rotation @f$e^{-i\theta P/2}@f$ of a Pauli word
+     * @f$P@f$ in a single pass over the statevector.
+     *
+     * As @f$P@f$ maps each basis state to a multiple of the basis state
+     * with the bits of its X mask flipped (see PauliWordMasks), the rotation
+     * only mixes the amplitudes of each such pair, with signs given by the
+     * parities of the Z mask. Each pair is read and written once, instead
+     * of applying basis changes, a CNOT ladder and an RZ gate.
+     *
+     * @param word Pauli word of characters I, X, Y and Z, one per wire.
+     */
+    template <class PrecisionT, class ParamT>
+    static void applyPauliRot(std::complex<PrecisionT> *arr, size_t num_qubits,
+                              const std::vector<size_t> &wires, bool inverse,
+                              ParamT angle, std::string_view word) {
+        applyPauliRot<PrecisionT, ParamT>(
+            arr, num_qubits, pauliWordMasks(num_qubits, wires, word), inverse,
+            angle);
+    }
+
+    /**
+     * @brief Apply the Pauli rotation of a Pauli word given by its bit
+     * masks, e.g. precomputed for repeated rotations.
+     */
+    template <class PrecisionT, class ParamT>
+    static void applyPauliRot(std::complex<PrecisionT> *arr, size_t num_qubits,
+                              const PauliWordMasks &masks, bool inverse,
+                              ParamT angle) {
+        const auto [x_mask, z_mask, num_y] = masks;
+        const PrecisionT c = std::cos(angle / 2);
+        const PrecisionT s = (inverse ? -1 : 1) * std::sin(angle / 2);
+
+        if (x_mask == 0) {
+            const std::array<std::complex<PrecisionT>, 2> shifts = {
+                std::complex<PrecisionT>{c, -s},
+                std::complex<PrecisionT>{c, s}};
+            for (size_t k = 0; k < Util::exp2(num_qubits); k++) {
+                arr[k] *= shifts[std::popcount(k & z_mask) % 2];
+            }
+            return;
+        }
+
+        // -i sin(theta/2) i^{n_Y}
+        const std::array<std::complex<PrecisionT>, 4> i_powers = {
+            std::complex<PrecisionT>{1, 0}, std::complex<PrecisionT>{0, 1},
+            std::complex<PrecisionT>{-1, 0}, std::complex<PrecisionT>{0, -1}};
+        const std::complex<PrecisionT> coeff = s * i_powers[(num_y + 3) % 4];
+        const size_t rev_wire = std::bit_width(x_mask) - 1;
+        const auto [parity_high, parity_low] = revWireParity(rev_wire);
+
+        for (size_t k = 0; k < Util::exp2(num_qubits - 1); k++) {
+            const size_t i0 = ((k << 1U) & parity_high) | (parity_low & k);
+            const size_t i1 = i0 ^ x_mask;
+            const std::complex<PrecisionT> v0 = arr[i0];
+            const std::complex<PrecisionT> v1 = arr[i1];
+            const PrecisionT sign0 = (std::popcount(i0 & z_mask) % 2) ? -1 : 1;
+            const PrecisionT sign1 = (std::popcount(i1 & z_mask) % 2) ? -1 : 1;
+            arr[i0] = c * v0 + sign1 * coeff * v1;
+            arr[i1] = c * v1 + sign0 * coeff * v0;
+        }
+    }
+
     /* Define generators */
 
     template <class PrecisionT>
@@ -1325,5 +1791,53 @@ class GateImplementationsLM : public PauliGenerator<GateImplementationsLM> {
         // NOLINTNEXTLINE(readability-magic-numbers)
         return static_cast<PrecisionT>(0.5);
     }
+
+    /**
+     * @brief Apply the generator of the Pauli rotation of a Pauli word
+     * @f$P@f$, i.e. @f$P@f$ itself scaled by @f$-1/2@f$.
+     *
+     * @param word Pauli word of characters I, X, Y and Z, one per wire.
+     */
+    template <class PrecisionT>
+    [[nodiscard]] static auto
+    applyGeneratorPauliRot(std::complex<PrecisionT> *arr, size_t num_qubits,
+                           const std::vector<size_t> &wires,
+                           [[maybe_unused]] bool adj, std::string_view word)
+        -> PrecisionT {
+        const auto [x_mask, z_mask, num_y] =
+            pauliWordMasks(num_qubits, wires, word);
+
+        if (x_mask == 0) {
+            for (size_t k = 0; k < Util::exp2(num_qubits); k++) {
+                if (std::popcount(k & z_mask) % 2) {
+                    arr[k] = -arr[k];
+                }
+            }
+        } else {
+            const std::array<std::complex<PrecisionT>, 4> i_powers = {
+                std::complex<PrecisionT>{1, 0}, std::complex<PrecisionT>{0, 1},
+                std::complex<PrecisionT>{-1, 0},
+                std::complex<PrecisionT>{0, -1}};
+            const std::complex<PrecisionT> phase = i_powers[num_y % 4];
+            const size_t rev_wire = std::bit_width(x_mask) - 1;
+            const auto [parity_high, parity_low] = revWireParity(rev_wire);
+
+            for (size_t k = 0; k < Util::exp2(num_qubits - 1); k++) {
+                const size_t i0 =
+                    ((k << 1U) & parity_high) | (parity_low & k);
+                const size_t i1 = i0 ^ x_mask;
+                const std::complex<PrecisionT> v0 = arr[i0];
+                const std::complex<PrecisionT> v1 = arr[i1];
+                const PrecisionT sign0 =
+                    (std::popcount(i0 & z_mask) % 2) ? -1 : 1;
+                const PrecisionT sign1 =
+                    (std::popcount(i1 & z_mask) % 2) ? -1 : 1;
+                arr[i0] = sign1 * phase * v1;
+                arr[i1] = sign0 * phase * v0;
+            }
+        }
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        return -static_cast<PrecisionT>(0.5);
+    }
 };
 } // namespace Pennylane::Gates
@@ -0,0 +1,87 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines kernel functions using NEON intrinsics.
+ */
+#pragma once
+
+#include "GateImplementationsAVXCommon.hpp"
+#include "GateOperation.hpp"
+#include "KernelType.hpp"
+#include "PauliGenerator.hpp"
+
+#include <array>
+#include <complex>
+#include <string_view>
+
+namespace Pennylane::Gates::inline PL_AVX_KERNEL_NAMESPACE {
+/**
+ * @brief A gate operation implementation using NEON intrinsics.
+ *
+ * Each operation acts on 128 bit registers when all target wires are outside
+ * of a register. Otherwise (or if the library is not compiled for AArch64)
+ * it falls back to @ref GateImplementationsLM. NEON is part of the AArch64
+ * baseline, so no compile flag is needed.
+ */
+class GateImplementationsNEON
+    : public AVXCommon::GateImplementationsAVXCommon<16>,
+      public PauliGenerator<GateImplementationsNEON> {
+  public:
+    constexpr static KernelType kernel_id = KernelType::NEON;
+    constexpr static std::string_view name = "NEON";
+    template <typename PrecisionT>
+    constexpr static size_t required_alignment = 16;
+    template <typename PrecisionT>
+    constexpr static size_t packed_bytes = 16;
+
+    constexpr static std::array implemented_gates = {
+        GateOperation::PauliX,
+        GateOperation::PauliY,
+        GateOperation::PauliZ,
+        GateOperation::Hadamard,
+        GateOperation::S,
+        GateOperation::T,
+        GateOperation::PhaseShift,
+        GateOperation::RX,
+        GateOperation::RY,
+        GateOperation::RZ,
+        GateOperation::Rot,
+        GateOperation::CNOT,
+        GateOperation::CY,
+        GateOperation::CZ,
+        GateOperation::SWAP,
+        GateOperation::ControlledPhaseShift,
+        GateOperation::CRX,
+        GateOperation::CRY,
+        GateOperation::CRZ,
+        GateOperation::CRot,
+        GateOperation::IsingXX,
+        GateOperation::IsingXY,
+        GateOperation::IsingYY,
+        GateOperation::IsingZZ,
+    };
+
+    constexpr static std::array implemented_generators = {
+        GeneratorOperation::RX,
+        GeneratorOperation::RY,
+        GeneratorOperation::RZ,
+    };
+
+    constexpr static std::array implemented_matrices = {
+        MatrixOperation::SingleQubitOp,
+        MatrixOperation::TwoQubitOp,
+    };
+};
+} // namespace Pennylane::Gates::inline PL_AVX_KERNEL_NAMESPACE
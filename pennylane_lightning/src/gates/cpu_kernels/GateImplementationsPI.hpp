@@ -41,7 +41,8 @@ namespace Pennylane::Gates {
  * @brief Kernel functions for gate operations with precomputed indices
  *
  * For given wires, we first compute the indices the gate applies to and use
- * the computed indices to apply the operation.
+ * the computed indices to apply the operation. The indices of recently used
+ * wires are reused across calls, see cachedGateIndices().
  *
  * @tparam PrecisionT Floating point precision of underlying statevector data.
  * */
@@ -124,7 +125,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                        const std::vector<size_t> &wires, bool inverse = false) {
         PL_ASSERT(wires.size() == 1);
 
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         if (inverse) {
             for (const size_t &externalIndex : externalIndices) {
@@ -170,7 +172,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                     const std::complex<PrecisionT> *matrix,
                     const std::vector<size_t> &wires, bool inverse = false) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         if (inverse) {
             for (const size_t &externalIndex : externalIndices) {
@@ -265,7 +268,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
     applyMultiQubitOp(std::complex<PrecisionT> *arr, size_t num_qubits,
                       const std::complex<PrecisionT> *matrix,
                       const std::vector<size_t> &wires, bool inverse) {
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         std::vector<std::complex<PrecisionT>> v(indices.size());
         for (const size_t &externalIndex : externalIndices) {
@@ -319,7 +323,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                             const std::vector<size_t> &wires,
                             [[maybe_unused]] bool inverse) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -332,7 +337,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                             const std::vector<size_t> &wires,
                             [[maybe_unused]] bool inverse) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -350,7 +356,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                             const std::vector<size_t> &wires,
                             [[maybe_unused]] bool inverse) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -363,7 +370,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                               const std::vector<size_t> &wires,
                               [[maybe_unused]] bool inverse) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -380,7 +388,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
     static void applyS(std::complex<PrecisionT> *arr, size_t num_qubits,
                        const std::vector<size_t> &wires, bool inverse) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         const std::complex<PrecisionT> shift =
             (inverse) ? -Util::IMAG<PrecisionT>() : Util::IMAG<PrecisionT>();
 
@@ -394,7 +403,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
     static void applyT(std::complex<PrecisionT> *arr, size_t num_qubits,
                        const std::vector<size_t> &wires, bool inverse) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const std::complex<PrecisionT> shift =
             (inverse) ? std::conj(std::exp(std::complex<PrecisionT>(
@@ -415,7 +425,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                                 const std::vector<size_t> &wires, bool inverse,
                                 ParamT angle) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         const std::complex<PrecisionT> s =
             inverse ? std::conj(std::exp(std::complex<PrecisionT>(0, angle)))
                     : std::exp(std::complex<PrecisionT>(0, angle));
@@ -430,7 +441,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                         const std::vector<size_t> &wires, bool inverse,
                         ParamT angle) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const PrecisionT c = std::cos(angle / 2);
         const PrecisionT js =
@@ -452,7 +464,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                         const std::vector<size_t> &wires, bool inverse,
                         ParamT angle) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const PrecisionT c = std::cos(angle / 2);
         const PrecisionT s =
@@ -472,7 +485,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                         const std::vector<size_t> &wires, bool inverse,
                         ParamT angle) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const std::complex<PrecisionT> first =
             std::complex<PrecisionT>(std::cos(angle / 2), -std::sin(angle / 2));
@@ -495,7 +509,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                          const std::vector<size_t> &wires, bool inverse,
                          ParamT phi, ParamT theta, ParamT omega) {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const auto rot = Gates::getRot<PrecisionT>(phi, theta, omega);
 
@@ -521,7 +536,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                           const std::vector<size_t> &wires,
                           [[maybe_unused]] bool inverse) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
             std::swap(shiftedState[indices[2]], shiftedState[indices[3]]);
@@ -533,7 +549,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                         const std::vector<size_t> &wires,
                         [[maybe_unused]] bool inverse) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
             std::complex<PrecisionT> v2 = shiftedState[indices[2]];
@@ -550,7 +567,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                         const std::vector<size_t> &wires,
                         [[maybe_unused]] bool inverse) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
             shiftedState[indices[3]] *= -1;
@@ -562,7 +580,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                           const std::vector<size_t> &wires,
                           [[maybe_unused]] bool inverse) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
             std::swap(shiftedState[indices[1]], shiftedState[indices[2]]);
@@ -576,7 +595,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                              ParamT angle) {
         using ComplexPrecisionT = std::complex<PrecisionT>;
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const PrecisionT cr = std::cos(angle / 2);
         const PrecisionT sj =
@@ -607,7 +627,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                              ParamT angle) {
         using ComplexPrecisionT = std::complex<PrecisionT>;
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const PrecisionT cr = std::cos(angle / 2);
         const PrecisionT sj =
@@ -636,7 +657,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                              ParamT angle) {
         using ComplexPrecisionT = std::complex<PrecisionT>;
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const PrecisionT cr = std::cos(angle / 2);
         const PrecisionT sj =
@@ -666,7 +688,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                              const std::vector<size_t> &wires, bool inverse,
                              ParamT angle) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const std::complex<PrecisionT> first =
             std::complex<PrecisionT>{std::cos(angle / 2), -std::sin(angle / 2)};
@@ -693,7 +716,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                                           const std::vector<size_t> &wires,
                                           bool inverse, ParamT angle) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const std::complex<PrecisionT> s =
             inverse ? std::conj(std::exp(std::complex<PrecisionT>(0, angle)))
@@ -709,7 +733,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                          const std::vector<size_t> &wires, bool inverse,
                          ParamT angle) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const PrecisionT c = std::cos(angle / 2);
         const PrecisionT js =
@@ -731,7 +756,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                          const std::vector<size_t> &wires, bool inverse,
                          ParamT angle) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         const PrecisionT c = std::cos(angle / 2);
         const PrecisionT s =
@@ -751,7 +777,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                          const std::vector<size_t> &wires, bool inverse,
                          ParamT angle) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         const std::complex<PrecisionT> m00 =
             (inverse) ? std::complex<PrecisionT>(std::cos(angle / 2),
                                                  std::sin(angle / 2))
@@ -774,7 +801,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                           const std::vector<size_t> &wires, bool inverse,
                           ParamT phi, ParamT theta, ParamT omega) {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         const auto rot = Gates::getRot<PrecisionT>(phi, theta, omega);
 
         const std::complex<PrecisionT> t1 =
@@ -799,7 +827,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                              const std::vector<size_t> &wires,
                              [[maybe_unused]] bool inverse) {
         PL_ASSERT(wires.size() == 3);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         // Participating swapped indices
         static const size_t op_idx0 = 6;
         static const size_t op_idx1 = 7;
@@ -815,7 +844,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                            const std::vector<size_t> &wires,
                            [[maybe_unused]] bool inverse) {
         PL_ASSERT(wires.size() == 3);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         // Participating swapped indices
         static const size_t op_idx0 = 5;
         static const size_t op_idx1 = 6;
@@ -850,7 +880,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
     static void applyMultiRZ(std::complex<PrecisionT> *arr, size_t num_qubits,
                              const std::vector<size_t> &wires,
                              [[maybe_unused]] bool inverse, ParamT angle) {
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         const std::complex<PrecisionT> first =
             std::complex<PrecisionT>{std::cos(angle / 2), -std::sin(angle / 2)};
         const std::complex<PrecisionT> second =
@@ -876,7 +907,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                              const std::vector<size_t> &wires,
                              [[maybe_unused]] bool adj) -> PrecisionT {
         PL_ASSERT(wires.size() == 1);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
             shiftedState[indices[0]] = std::complex<PrecisionT>{0.0, 0.0};
@@ -891,7 +923,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                       const std::vector<size_t> &wires,
                       [[maybe_unused]] bool adj) -> PrecisionT {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -910,7 +943,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                           const std::vector<size_t> &wires,
                           [[maybe_unused]] bool adj) -> PrecisionT {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -928,7 +962,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                           const std::vector<size_t> &wires,
                           [[maybe_unused]] bool adj) -> PrecisionT {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -948,7 +983,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                           const std::vector<size_t> &wires,
                           [[maybe_unused]] bool adj) -> PrecisionT {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -967,7 +1003,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                       const std::vector<size_t> &wires,
                       [[maybe_unused]] bool adj) -> PrecisionT {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -988,7 +1025,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
                       const std::vector<size_t> &wires,
                       [[maybe_unused]] bool adj) -> PrecisionT {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -1006,7 +1044,8 @@ class GateImplementationsPI : public PauliGenerator<GateImplementationsPI> {
         const std::vector<size_t> &wires, [[maybe_unused]] bool adj)
         -> PrecisionT {
         PL_ASSERT(wires.size() == 2);
-        const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+        const auto &[indices, externalIndices] =
+            cachedGateIndices(wires, num_qubits);
 
         for (const size_t &externalIndex : externalIndices) {
             std::complex<PrecisionT> *shiftedState = arr + externalIndex;
@@ -0,0 +1,714 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines OpenMP parallelized kernel functions with less memory
+ */
+#pragma once
+
+#include "BitUtil.hpp"
+#include "Error.hpp"
+#include "GateImplementationsLM.hpp"
+#include "GateOperation.hpp"
+#include "Gates.hpp"
+#include "KernelType.hpp"
+#include "PauliGenerator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <complex>
+#include <vector>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace Pennylane::Gates {
+/**
+ * @brief A multi-threaded gate operation implementation with less memory.
+ *
+ * Indices are computed on the fly as in @ref GateImplementationsLM, and the
+ * outer loop over indices is statically distributed over OpenMP threads. When
+ * the library is compiled without OpenMP, this kernel is identical to the LM
+ * kernel.
+ */
+class GateImplementationsParallelLM
+    : public PauliGenerator<GateImplementationsParallelLM> {
+  private:
+    /**
+     * @brief Call `func(arr[i0], arr[i1])` for all index pairs of the
+     * given wire in parallel.
+     */
+    template <class PrecisionT, class FuncT>
+    static void applySingleQubitKernel(std::complex<PrecisionT> *arr,
+                                       size_t num_qubits, size_t wire,
+                                       FuncT &&func) {
+        const size_t rev_wire = num_qubits - wire - 1;
+        const size_t rev_wire_shift = (static_cast<size_t>(1U) << rev_wire);
+        const auto parity = GateImplementationsLM::revWireParity(rev_wire);
+        const size_t parity_high = parity.first;
+        const size_t parity_low = parity.second;
+        const size_t num_iter = Util::exp2(num_qubits - 1);
+
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_iter; k++) {
+            const size_t i0 = ((k << 1U) & parity_high) | (parity_low & k);
+            const size_t i1 = i0 | rev_wire_shift;
+            func(arr[i0], arr[i1]);
+        }
+    }
+
+    /**
+     * @brief Call `func(arr[i00], arr[i01], arr[i10], arr[i11])` for all
+     * index quadruples of the given wires in parallel. Here wires[0]
+     * corresponds to the higher bit (control qubit).
+     */
+    template <class PrecisionT, class FuncT>
+    static void applyTwoQubitKernel(std::complex<PrecisionT> *arr,
+                                    size_t num_qubits,
+                                    const std::vector<size_t> &wires,
+                                    FuncT &&func) {
+        const size_t rev_wire0 = num_qubits - wires[1] - 1;
+        const size_t rev_wire1 = num_qubits - wires[0] - 1; // Control qubit
+
+        const size_t rev_wire0_shift = static_cast<size_t>(1U) << rev_wire0;
+        const size_t rev_wire1_shift = static_cast<size_t>(1U) << rev_wire1;
+
+        const auto parity =
+            GateImplementationsLM::revWireParity(rev_wire0, rev_wire1);
+        const size_t parity_high = std::get<0>(parity);
+        const size_t parity_middle = std::get<1>(parity);
+        const size_t parity_low = std::get<2>(parity);
+        const size_t num_iter = Util::exp2(num_qubits - 2);
+
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_iter; k++) {
+            const size_t i00 = ((k << 2U) & parity_high) |
+                               ((k << 1U) & parity_middle) | (k & parity_low);
+            const size_t i01 = i00 | rev_wire0_shift;
+            const size_t i10 = i00 | rev_wire1_shift;
+            const size_t i11 = i00 | rev_wire0_shift | rev_wire1_shift;
+            func(arr[i00], arr[i01], arr[i10], arr[i11]);
+        }
+    }
+
+    /**
+     * @brief Return the RZ(angle) phases for the |0> and |1> bases.
+     */
+    template <class PrecisionT, class ParamT>
+    static auto rzShifts(bool inverse, ParamT angle)
+        -> std::array<std::complex<PrecisionT>, 2> {
+        const std::complex<PrecisionT> first =
+            std::complex<PrecisionT>{std::cos(angle / 2), -std::sin(angle / 2)};
+        const std::complex<PrecisionT> second =
+            std::complex<PrecisionT>{std::cos(angle / 2), std::sin(angle / 2)};
+        return {(inverse) ? std::conj(first) : first,
+                (inverse) ? std::conj(second) : second};
+    }
+
+  public:
+    constexpr static KernelType kernel_id = KernelType::ParallelLM;
+    constexpr static std::string_view name = "ParallelLM";
+    template <typename PrecisionT>
+    constexpr static size_t required_alignment =
+        std::alignment_of_v<PrecisionT>;
+    template <typename PrecisionT>
+    constexpr static size_t packed_bytes = sizeof(PrecisionT);
+
+    constexpr static std::array implemented_gates = {
+        GateOperation::PauliX,
+        GateOperation::PauliY,
+        GateOperation::PauliZ,
+        GateOperation::Hadamard,
+        GateOperation::S,
+        GateOperation::T,
+        GateOperation::PhaseShift,
+        GateOperation::RX,
+        GateOperation::RY,
+        GateOperation::RZ,
+        GateOperation::Rot,
+        GateOperation::CNOT,
+        GateOperation::CY,
+        GateOperation::CZ,
+        GateOperation::SWAP,
+        GateOperation::ControlledPhaseShift,
+        GateOperation::CRX,
+        GateOperation::CRY,
+        GateOperation::CRZ,
+        GateOperation::CRot,
+        GateOperation::IsingXX,
+        GateOperation::IsingXY,
+        GateOperation::IsingYY,
+        GateOperation::IsingZZ,
+        GateOperation::MultiRZ,
+    };
+
+    constexpr static std::array implemented_generators = {
+        GeneratorOperation::RX,
+        GeneratorOperation::RY,
+        GeneratorOperation::RZ,
+    };
+
+    constexpr static std::array implemented_matrices = {
+        MatrixOperation::SingleQubitOp,
+        MatrixOperation::TwoQubitOp,
+        MatrixOperation::MultiQubitOp,
+    };
+
+    /* Matrix operations */
+
+    template <class PrecisionT>
+    static void
+    applySingleQubitOp(std::complex<PrecisionT> *arr, size_t num_qubits,
+                       const std::complex<PrecisionT> *matrix,
+                       const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ASSERT(wires.size() == 1);
+        std::array<std::complex<PrecisionT>, 4> mat{};
+        if (inverse) {
+            mat = {std::conj(matrix[0B00]), std::conj(matrix[0B10]),
+                   std::conj(matrix[0B01]), std::conj(matrix[0B11])};
+        } else {
+            mat = {matrix[0B00], matrix[0B01], matrix[0B10], matrix[0B11]};
+        }
+        applySingleQubitKernel(arr, num_qubits, wires[0],
+                               [&mat](auto &v0, auto &v1) {
+                                   const auto w0 = mat[0B00] * v0 +
+                                                   mat[0B01] * v1;
+                                   v1 = mat[0B10] * v0 + mat[0B11] * v1;
+                                   v0 = w0;
+                               });
+    }
+
+    template <class PrecisionT>
+    static void
+    applyTwoQubitOp(std::complex<PrecisionT> *arr, size_t num_qubits,
+                    const std::complex<PrecisionT> *matrix,
+                    const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ASSERT(wires.size() == 2);
+        constexpr size_t dim = 4;
+        std::array<std::complex<PrecisionT>, dim * dim> mat{};
+        for (size_t i = 0; i < dim; i++) {
+            for (size_t j = 0; j < dim; j++) {
+                mat[i * dim + j] = inverse ? std::conj(matrix[j * dim + i])
+                                           : matrix[i * dim + j];
+            }
+        }
+        applyTwoQubitKernel(
+            arr, num_qubits, wires,
+            [&mat](auto &v00, auto &v01, auto &v10, auto &v11) {
+                const std::array<std::complex<PrecisionT>, dim> v{v00, v01,
+                                                                  v10, v11};
+                std::array<std::complex<PrecisionT>, dim> w{};
+                for (size_t i = 0; i < dim; i++) {
+                    for (size_t j = 0; j < dim; j++) {
+                        w[i] += mat[i * dim + j] * v[j];
+                    }
+                }
+                v00 = w[0];
+                v01 = w[1];
+                v10 = w[2];
+                v11 = w[3];
+            });
+    }
+
+    /**
+     * @brief Apply a matrix acting on any number of wires.
+     *
+     * Each thread applies the matrix to a contiguous range of blocks using
+     * its own gather buffer.
+     */
+    template <class PrecisionT>
+    static void
+    applyMultiQubitOp(std::complex<PrecisionT> *arr, size_t num_qubits,
+                      const std::complex<PrecisionT> *matrix,
+                      const std::vector<size_t> &wires, bool inverse) {
+        PL_ASSERT(num_qubits >= wires.size());
+
+        const size_t dim = Util::exp2(wires.size());
+        const auto mat =
+            GateImplementationsLM::multiQubitMatrix(matrix, dim, inverse);
+        const auto indices =
+            GateImplementationsLM::multiQubitOffsets(num_qubits, wires);
+        const auto &rev_wires = indices.first;
+        const auto &offsets = indices.second;
+        const size_t num_blocks = Util::exp2(num_qubits - wires.size());
+
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel
+        #endif
+        // clang-format on
+        {
+#if defined(_OPENMP)
+            const auto num_threads =
+                static_cast<size_t>(omp_get_num_threads());
+            const auto thread_id = static_cast<size_t>(omp_get_thread_num());
+#else
+            const size_t num_threads = 1;
+            const size_t thread_id = 0;
+#endif
+            const size_t chunk = (num_blocks + num_threads - 1) / num_threads;
+            const size_t begin = std::min(num_blocks, thread_id * chunk);
+            const size_t end = std::min(num_blocks, begin + chunk);
+            GateImplementationsLM::applyMultiQubitOpBlocks(
+                arr, mat.data(), rev_wires, offsets, begin, end);
+        }
+    }
+
+    /**
+     * @brief Apply a diagonal matrix acting on any number of wires.
+     *
+     * @see GateImplementationsLM::applyDiagonal
+     */
+    template <class PrecisionT>
+    static void applyDiagonal(std::complex<PrecisionT> *arr, size_t num_qubits,
+                              const std::complex<PrecisionT> *diag,
+                              const std::vector<size_t> &wires, bool inverse) {
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        PL_ABORT_IF(wires.size() > num_qubits,
+                    "The number of wires exceeds the number of qubits.");
+        PL_ABORT_IF(std::any_of(wires.begin(), wires.end(),
+                                [num_qubits](size_t wire) {
+                                    return wire >= num_qubits;
+                                }),
+                    "Invalid wire index.");
+
+        const size_t dim = Util::exp2(wires.size());
+        const auto mat =
+            GateImplementationsLM::diagonalMatrix(diag, dim, inverse);
+        const auto indices =
+            GateImplementationsLM::multiQubitOffsets(num_qubits, wires);
+        const auto &rev_wires = indices.first;
+        const auto &offsets = indices.second;
+        PL_ABORT_IF(std::adjacent_find(rev_wires.begin(), rev_wires.end()) !=
+                        rev_wires.end(),
+                    "Wires must be distinct.");
+        const size_t num_blocks = Util::exp2(num_qubits - wires.size());
+
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t outer = 0; outer < num_blocks; outer++) {
+            GateImplementationsLM::applyDiagonalBlocks(
+                arr, mat.data(), rev_wires, offsets, outer, outer + 1);
+        }
+    }
+
+    /* Single-qubit gates */
+
+    template <class PrecisionT>
+    static void applyPauliX(std::complex<PrecisionT> *arr,
+                            const size_t num_qubits,
+                            const std::vector<size_t> &wires,
+                            [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        applySingleQubitKernel(arr, num_qubits, wires[0],
+                               [](auto &v0, auto &v1) { std::swap(v0, v1); });
+    }
+
+    template <class PrecisionT>
+    static void applyPauliY(std::complex<PrecisionT> *arr,
+                            const size_t num_qubits,
+                            const std::vector<size_t> &wires,
+                            [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        applySingleQubitKernel(
+            arr, num_qubits, wires[0], [](auto &v0, auto &v1) {
+                const auto w0 = v0;
+                v0 = std::complex<PrecisionT>{std::imag(v1), -std::real(v1)};
+                v1 = std::complex<PrecisionT>{-std::imag(w0), std::real(w0)};
+            });
+    }
+
+    template <class PrecisionT>
+    static void applyPauliZ(std::complex<PrecisionT> *arr,
+                            const size_t num_qubits,
+                            const std::vector<size_t> &wires,
+                            [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        applySingleQubitKernel(arr, num_qubits, wires[0],
+                               []([[maybe_unused]] auto &v0, auto &v1) {
+                                   v1 *= -1;
+                               });
+    }
+
+    template <class PrecisionT>
+    static void applyHadamard(std::complex<PrecisionT> *arr,
+                              const size_t num_qubits,
+                              const std::vector<size_t> &wires,
+                              [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        const PrecisionT isqrt2 = Util::INVSQRT2<PrecisionT>();
+        applySingleQubitKernel(arr, num_qubits, wires[0],
+                               [isqrt2](auto &v0, auto &v1) {
+                                   const auto w0 = v0;
+                                   v0 = isqrt2 * w0 + isqrt2 * v1;
+                                   v1 = isqrt2 * w0 - isqrt2 * v1;
+                               });
+    }
+
+    template <class PrecisionT>
+    static void applyS(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                       const std::vector<size_t> &wires, bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        const std::complex<PrecisionT> shift =
+            (inverse) ? -Util::IMAG<PrecisionT>() : Util::IMAG<PrecisionT>();
+        applySingleQubitKernel(arr, num_qubits, wires[0],
+                               [shift]([[maybe_unused]] auto &v0, auto &v1) {
+                                   v1 *= shift;
+                               });
+    }
+
+    template <class PrecisionT>
+    static void applyT(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                       const std::vector<size_t> &wires, bool inverse) {
+        PL_ASSERT(wires.size() == 1);
+        constexpr static auto isqrt2 = Util::INVSQRT2<PrecisionT>();
+        const std::complex<PrecisionT> shift = {isqrt2,
+                                                inverse ? -isqrt2 : isqrt2};
+        applySingleQubitKernel(arr, num_qubits, wires[0],
+                               [shift]([[maybe_unused]] auto &v0, auto &v1) {
+                                   v1 *= shift;
+                               });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyPhaseShift(std::complex<PrecisionT> *arr,
+                                const size_t num_qubits,
+                                const std::vector<size_t> &wires, bool inverse,
+                                ParamT angle) {
+        PL_ASSERT(wires.size() == 1);
+        const std::complex<PrecisionT> s =
+            inverse ? std::exp(-std::complex<PrecisionT>(0, angle))
+                    : std::exp(std::complex<PrecisionT>(0, angle));
+        applySingleQubitKernel(arr, num_qubits, wires[0],
+                               [s]([[maybe_unused]] auto &v0, auto &v1) {
+                                   v1 *= s;
+                               });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyRX(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                        const std::vector<size_t> &wires, bool inverse,
+                        ParamT angle) {
+        PL_ASSERT(wires.size() == 1);
+        const PrecisionT c = std::cos(angle / 2);
+        const PrecisionT js =
+            (inverse) ? -std::sin(-angle / 2) : std::sin(-angle / 2);
+        applySingleQubitKernel(
+            arr, num_qubits, wires[0], [c, js](auto &v0, auto &v1) {
+                const auto w0 = v0;
+                v0 = c * w0 + std::complex<PrecisionT>{-std::imag(v1) * js,
+                                                       std::real(v1) * js};
+                v1 = std::complex<PrecisionT>{-std::imag(w0) * js,
+                                              std::real(w0) * js} +
+                     c * v1;
+            });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyRY(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                        const std::vector<size_t> &wires, bool inverse,
+                        ParamT angle) {
+        PL_ASSERT(wires.size() == 1);
+        const PrecisionT c = std::cos(angle / 2);
+        const PrecisionT s =
+            (inverse) ? -std::sin(angle / 2) : std::sin(angle / 2);
+        applySingleQubitKernel(arr, num_qubits, wires[0],
+                               [c, s](auto &v0, auto &v1) {
+                                   const auto w0 = v0;
+                                   v0 = c * w0 - s * v1;
+                                   v1 = s * w0 + c * v1;
+                               });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyRZ(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                        const std::vector<size_t> &wires, bool inverse,
+                        ParamT angle) {
+        PL_ASSERT(wires.size() == 1);
+        const auto shifts = rzShifts<PrecisionT>(inverse, angle);
+        applySingleQubitKernel(arr, num_qubits, wires[0],
+                               [&shifts](auto &v0, auto &v1) {
+                                   v0 *= shifts[0];
+                                   v1 *= shifts[1];
+                               });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyRot(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                         const std::vector<size_t> &wires, bool inverse,
+                         ParamT phi, ParamT theta, ParamT omega) {
+        PL_ASSERT(wires.size() == 1);
+
+        const auto rotMat =
+            (inverse) ? Gates::getRot<PrecisionT>(-omega, -theta, -phi)
+                      : Gates::getRot<PrecisionT>(phi, theta, omega);
+
+        applySingleQubitOp(arr, num_qubits, rotMat.data(), wires);
+    }
+
+    /* Two-qubit gates */
+
+    template <class PrecisionT>
+    static void
+    applyCNOT(std::complex<PrecisionT> *arr, const size_t num_qubits,
+              const std::vector<size_t> &wires, [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 2);
+        applyTwoQubitKernel(
+            arr, num_qubits, wires,
+            []([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+               auto &v10, auto &v11) { std::swap(v10, v11); });
+    }
+
+    template <class PrecisionT>
+    static void applyCY(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                        const std::vector<size_t> &wires,
+                        [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 2);
+        applyTwoQubitKernel(
+            arr, num_qubits, wires,
+            []([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+               auto &v10, auto &v11) {
+                const auto w10 = v10;
+                v10 = std::complex<PrecisionT>{std::imag(v11), -std::real(v11)};
+                v11 = std::complex<PrecisionT>{-std::imag(w10), std::real(w10)};
+            });
+    }
+
+    template <class PrecisionT>
+    static void applyCZ(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                        const std::vector<size_t> &wires,
+                        [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 2);
+        applyTwoQubitKernel(
+            arr, num_qubits, wires,
+            []([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+               [[maybe_unused]] auto &v10, auto &v11) { v11 *= -1; });
+    }
+
+    template <class PrecisionT>
+    static void applySWAP(std::complex<PrecisionT> *arr, size_t num_qubits,
+                          const std::vector<size_t> &wires,
+                          [[maybe_unused]] bool inverse) {
+        PL_ASSERT(wires.size() == 2);
+        applyTwoQubitKernel(
+            arr, num_qubits, wires,
+            []([[maybe_unused]] auto &v00, auto &v01, auto &v10,
+               [[maybe_unused]] auto &v11) { std::swap(v01, v10); });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyControlledPhaseShift(std::complex<PrecisionT> *arr,
+                                          const size_t num_qubits,
+                                          const std::vector<size_t> &wires,
+                                          bool inverse, ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        const std::complex<PrecisionT> s =
+            inverse ? std::exp(-std::complex<PrecisionT>(0, angle))
+                    : std::exp(std::complex<PrecisionT>(0, angle));
+        applyTwoQubitKernel(
+            arr, num_qubits, wires,
+            [s]([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+                [[maybe_unused]] auto &v10, auto &v11) { v11 *= s; });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyCRX(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                         const std::vector<size_t> &wires, bool inverse,
+                         ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        const PrecisionT c = std::cos(angle / 2);
+        const PrecisionT js =
+            (inverse) ? -std::sin(angle / 2) : std::sin(angle / 2);
+        applyTwoQubitKernel(
+            arr, num_qubits, wires,
+            [c, js]([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+                    auto &v10, auto &v11) {
+                const auto w10 = v10;
+                v10 = std::complex<PrecisionT>{
+                    c * std::real(w10) + js * std::imag(v11),
+                    c * std::imag(w10) - js * std::real(v11)};
+                v11 = std::complex<PrecisionT>{
+                    c * std::real(v11) + js * std::imag(w10),
+                    c * std::imag(v11) - js * std::real(w10)};
+            });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyCRY(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                         const std::vector<size_t> &wires, bool inverse,
+                         ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        const PrecisionT c = std::cos(angle / 2);
+        const PrecisionT s =
+            (inverse) ? -std::sin(angle / 2) : std::sin(angle / 2);
+        applyTwoQubitKernel(
+            arr, num_qubits, wires,
+            [c, s]([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+                   auto &v10, auto &v11) {
+                const auto w10 = v10;
+                v10 = c * w10 - s * v11;
+                v11 = s * w10 + c * v11;
+            });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyCRZ(std::complex<PrecisionT> *arr, const size_t num_qubits,
+                         const std::vector<size_t> &wires, bool inverse,
+                         ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        const auto shifts = rzShifts<PrecisionT>(inverse, angle);
+        applyTwoQubitKernel(
+            arr, num_qubits, wires,
+            [&shifts]([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+                      auto &v10, auto &v11) {
+                v10 *= shifts[0];
+                v11 *= shifts[1];
+            });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyCRot(std::complex<PrecisionT> *arr, size_t num_qubits,
+                          const std::vector<size_t> &wires, bool inverse,
+                          ParamT phi, ParamT theta, ParamT omega) {
+        PL_ASSERT(wires.size() == 2);
+        const auto rotMat =
+            (inverse) ? Gates::getRot<PrecisionT>(-omega, -theta, -phi)
+                      : Gates::getRot<PrecisionT>(phi, theta, omega);
+        applyTwoQubitKernel(
+            arr, num_qubits, wires,
+            [&rotMat]([[maybe_unused]] auto &v00, [[maybe_unused]] auto &v01,
+                      auto &v10, auto &v11) {
+                const auto w10 = v10;
+                v10 = rotMat[0] * w10 + rotMat[1] * v11;
+                v11 = rotMat[2] * w10 + rotMat[3] * v11;
+            });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyIsingXX(std::complex<PrecisionT> *arr, size_t num_qubits,
+                             const std::vector<size_t> &wires, bool inverse,
+                             ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        const PrecisionT cr = std::cos(angle / 2);
+        const PrecisionT sj =
+            inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
+        // Multiply by -i * sj
+        const std::complex<PrecisionT> mjs{0, -sj};
+        applyTwoQubitKernel(arr, num_qubits, wires,
+                            [cr, mjs](auto &v00, auto &v01, auto &v10,
+                                      auto &v11) {
+                                const auto w00 = v00;
+                                const auto w01 = v01;
+                                v00 = cr * w00 + mjs * v11;
+                                v01 = cr * w01 + mjs * v10;
+                                v10 = cr * v10 + mjs * w01;
+                                v11 = cr * v11 + mjs * w00;
+                            });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyIsingXY(std::complex<PrecisionT> *arr, size_t num_qubits,
+                             const std::vector<size_t> &wires, bool inverse,
+                             ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        const PrecisionT cr = std::cos(angle / 2);
+        const PrecisionT sj =
+            inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
+        const std::complex<PrecisionT> js{0, sj};
+        applyTwoQubitKernel(arr, num_qubits, wires,
+                            [cr, js]([[maybe_unused]] auto &v00, auto &v01,
+                                     auto &v10, [[maybe_unused]] auto &v11) {
+                                const auto w01 = v01;
+                                v01 = cr * w01 + js * v10;
+                                v10 = cr * v10 + js * w01;
+                            });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyIsingYY(std::complex<PrecisionT> *arr, size_t num_qubits,
+                             const std::vector<size_t> &wires, bool inverse,
+                             ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        const PrecisionT cr = std::cos(angle / 2);
+        const PrecisionT sj =
+            inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
+        const std::complex<PrecisionT> js{0, sj};
+        applyTwoQubitKernel(arr, num_qubits, wires,
+                            [cr, js](auto &v00, auto &v01, auto &v10,
+                                     auto &v11) {
+                                const auto w00 = v00;
+                                const auto w01 = v01;
+                                v00 = cr * w00 + js * v11;
+                                v01 = cr * w01 - js * v10;
+                                v10 = cr * v10 - js * w01;
+                                v11 = cr * v11 + js * w00;
+                            });
+    }
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyIsingZZ(std::complex<PrecisionT> *arr,
+                             const size_t num_qubits,
+                             const std::vector<size_t> &wires, bool inverse,
+                             ParamT angle) {
+        PL_ASSERT(wires.size() == 2);
+        const auto shifts = rzShifts<PrecisionT>(inverse, angle);
+        applyTwoQubitKernel(arr, num_qubits, wires,
+                            [&shifts](auto &v00, auto &v01, auto &v10,
+                                      auto &v11) {
+                                v00 *= shifts[0];
+                                v01 *= shifts[1];
+                                v10 *= shifts[1];
+                                v11 *= shifts[0];
+                            });
+    }
+
+    /* Multi-qubit gates */
+
+    template <class PrecisionT, class ParamT = PrecisionT>
+    static void applyMultiRZ(std::complex<PrecisionT> *arr, size_t num_qubits,
+                             const std::vector<size_t> &wires, bool inverse,
+                             ParamT angle) {
+        const auto shifts = rzShifts<PrecisionT>(inverse, angle);
+
+        size_t wires_parity = 0U;
+        for (size_t wire : wires) {
+            wires_parity |=
+                (static_cast<size_t>(1U) << (num_qubits - wire - 1));
+        }
+        const size_t num_iter = Util::exp2(num_qubits);
+
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_iter; k++) {
+            arr[k] *= shifts[std::popcount(k & wires_parity) % 2];
+        }
+    }
+};
+} // namespace Pennylane::Gates
@@ -208,7 +208,8 @@ void GateImplementationsPI::applyDoubleExcitation(
     const std::vector<size_t> &wires, [[maybe_unused]] bool inverse,
     ParamT angle) {
     PL_ASSERT(wires.size() == 4);
-    const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+    const auto &[indices, externalIndices] =
+        cachedGateIndices(wires, num_qubits);
     const PrecisionT c = std::cos(angle / 2);
     const PrecisionT s = inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
 
@@ -233,7 +234,8 @@ void GateImplementationsPI::applyDoubleExcitationMinus(
     const std::vector<size_t> &wires, [[maybe_unused]] bool inverse,
     ParamT angle) {
     PL_ASSERT(wires.size() == 4);
-    const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+    const auto &[indices, externalIndices] =
+        cachedGateIndices(wires, num_qubits);
 
     const PrecisionT c = std::cos(angle / 2);
     const PrecisionT s = inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
@@ -293,7 +295,8 @@ void GateImplementationsPI::applyDoubleExcitationPlus(
     const std::vector<size_t> &wires, [[maybe_unused]] bool inverse,
     ParamT angle) {
     PL_ASSERT(wires.size() == 4);
-    const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+    const auto &[indices, externalIndices] =
+        cachedGateIndices(wires, num_qubits);
     const PrecisionT c = std::cos(angle / 2);
     const PrecisionT s = inverse ? -std::sin(angle / 2) : std::sin(angle / 2);
     const std::complex<PrecisionT> e =
@@ -350,7 +353,8 @@ auto GateImplementationsPI::applyGeneratorDoubleExcitation(
     std::complex<PrecisionT> *arr, size_t num_qubits,
     const std::vector<size_t> &wires, [[maybe_unused]] bool adj) -> PrecisionT {
     PL_ASSERT(wires.size() == 4);
-    const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+    const auto &[indices, externalIndices] =
+        cachedGateIndices(wires, num_qubits);
 
     // NOLINTNEXTLINE(readability-magic-numbers)
     const size_t i0 = 3;
@@ -377,7 +381,8 @@ auto GateImplementationsPI::applyGeneratorDoubleExcitationMinus(
     std::complex<PrecisionT> *arr, size_t num_qubits,
     const std::vector<size_t> &wires, [[maybe_unused]] bool adj) -> PrecisionT {
     PL_ASSERT(wires.size() == 4);
-    const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+    const auto &[indices, externalIndices] =
+        cachedGateIndices(wires, num_qubits);
 
     // NOLINTNEXTLINE(readability-magic-numbers)
     const size_t i0 = 3;
@@ -401,7 +406,8 @@ auto GateImplementationsPI::applyGeneratorDoubleExcitationPlus(
     std::complex<PrecisionT> *arr, size_t num_qubits,
     const std::vector<size_t> &wires, [[maybe_unused]] bool adj) -> PrecisionT {
     PL_ASSERT(wires.size() == 4);
-    const auto [indices, externalIndices] = GateIndices(wires, num_qubits);
+    const auto &[indices, externalIndices] =
+        cachedGateIndices(wires, num_qubits);
 
     // NOLINTNEXTLINE(readability-magic-numbers)
     const size_t i0 = 3;
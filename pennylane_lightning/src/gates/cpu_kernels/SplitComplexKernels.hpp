@@ -0,0 +1,224 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file SplitComplexKernels.hpp
+ * Defines kernels for statevectors stored as separate arrays of the real and
+ * imaginary parts (structure of arrays).
+ */
+#pragma once
+
+#include "Macros.hpp"
+#include "Util.hpp"
+
+#include <complex>
+#include <vector>
+
+/// @cond DEV
+namespace Pennylane::Gates::SplitComplex::Internal {
+/**
+ * @brief Get the offset of each basis state of the wires in the statevector
+ * index, where `wires[0]` is the most significant bit of the basis state.
+ */
+inline auto wireOffsets(size_t num_qubits, const std::vector<size_t> &wires)
+    -> std::vector<size_t> {
+    const size_t num_wires = wires.size();
+    std::vector<size_t> offsets(Util::exp2(num_wires), 0);
+    for (size_t k = 0; k < offsets.size(); k++) {
+        for (size_t w = 0; w < num_wires; w++) {
+            if (((k >> (num_wires - 1 - w)) & 1U) != 0) {
+                offsets[k] |= static_cast<size_t>(1U)
+                              << (num_qubits - 1 - wires[w]);
+            }
+        }
+    }
+    return offsets;
+}
+} // namespace Pennylane::Gates::SplitComplex::Internal
+/// @endcond
+
+namespace Pennylane::Gates::SplitComplex {
+/**
+ * @brief Apply a single-qubit matrix.
+ *
+ * The pairs of amplitudes are visited in contiguous runs of length
+ * @f$2^{r}@f$ for the reversed wire @f$r@f$, so that the real arithmetic
+ * of the inner loop vectorizes without shuffling real and imaginary parts.
+ *
+ * @param re Real parts of the statevector.
+ * @param im Imaginary parts of the statevector.
+ * @param num_qubits Number of qubits.
+ * @param matrix Row-major 2x2 matrix.
+ * @param wire Wire to apply the matrix to.
+ */
+template <class PrecisionT>
+void applySingleQubit(PrecisionT *re, PrecisionT *im, size_t num_qubits,
+                      const std::complex<PrecisionT> *matrix, size_t wire) {
+    const size_t stride = Util::exp2(num_qubits - 1 - wire);
+    const size_t length = Util::exp2(num_qubits);
+    const PrecisionT m00r = matrix[0].real();
+    const PrecisionT m00i = matrix[0].imag();
+    const PrecisionT m01r = matrix[1].real();
+    const PrecisionT m01i = matrix[1].imag();
+    const PrecisionT m10r = matrix[2].real();
+    const PrecisionT m10i = matrix[2].imag();
+    const PrecisionT m11r = matrix[3].real();
+    const PrecisionT m11i = matrix[3].imag();
+
+    for (size_t base = 0; base < length; base += 2 * stride) {
+        PrecisionT *re0 = re + base;
+        PrecisionT *im0 = im + base;
+        PrecisionT *re1 = re0 + stride;
+        PrecisionT *im1 = im0 + stride;
+        PL_LOOP_SIMD
+        for (size_t j = 0; j < stride; j++) {
+            const PrecisionT v0r = re0[j];
+            const PrecisionT v0i = im0[j];
+            const PrecisionT v1r = re1[j];
+            const PrecisionT v1i = im1[j];
+            re0[j] = m00r * v0r - m00i * v0i + m01r * v1r - m01i * v1i;
+            im0[j] = m00r * v0i + m00i * v0r + m01r * v1i + m01i * v1r;
+            re1[j] = m10r * v0r - m10i * v0i + m11r * v1r - m11i * v1i;
+            im1[j] = m10r * v0i + m10i * v0r + m11r * v1i + m11i * v1r;
+        }
+    }
+}
+
+/**
+ * @brief Apply a diagonal matrix.
+ *
+ * @param re Real parts of the statevector.
+ * @param im Imaginary parts of the statevector.
+ * @param num_qubits Number of qubits.
+ * @param diag Diagonal of the matrix, where `wires[0]` is the most
+ * significant bit of the index.
+ * @param wires Wires to apply the matrix to.
+ */
+template <class PrecisionT>
+void applyDiagonal(PrecisionT *re, PrecisionT *im, size_t num_qubits,
+                   const std::complex<PrecisionT> *diag,
+                   const std::vector<size_t> &wires) {
+    const size_t length = Util::exp2(num_qubits);
+    if (wires.size() == 1) {
+        // The elements are constant over runs of length 2^r
+        const size_t stride = Util::exp2(num_qubits - 1 - wires[0]);
+        for (size_t base = 0; base < length; base += stride) {
+            const auto d = diag[(base / stride) & 1U];
+            const PrecisionT dr = d.real();
+            const PrecisionT di = d.imag();
+            PL_LOOP_SIMD
+            for (size_t j = base; j < base + stride; j++) {
+                const PrecisionT vr = re[j];
+                const PrecisionT vi = im[j];
+                re[j] = dr * vr - di * vi;
+                im[j] = dr * vi + di * vr;
+            }
+        }
+        return;
+    }
+    const auto offsets = Internal::wireOffsets(num_qubits, wires);
+    size_t mask = 0;
+    for (const size_t offset : offsets) {
+        mask |= offset;
+    }
+    for (size_t idx = 0; idx < length; idx++) {
+        if ((idx & mask) != 0) {
+            continue;
+        }
+        for (size_t k = 0; k < offsets.size(); k++) {
+            const size_t i = idx | offsets[k];
+            const PrecisionT dr = diag[k].real();
+            const PrecisionT di = diag[k].imag();
+            const PrecisionT vr = re[i];
+            const PrecisionT vi = im[i];
+            re[i] = dr * vr - di * vi;
+            im[i] = dr * vi + di * vr;
+        }
+    }
+}
+
+/**
+ * @brief Apply a matrix acting on any number of wires.
+ *
+ * @param re Real parts of the statevector.
+ * @param im Imaginary parts of the statevector.
+ * @param num_qubits Number of qubits.
+ * @param matrix Row-major matrix, where `wires[0]` is the most significant
+ * bit of the row and column indices.
+ * @param wires Wires to apply the matrix to.
+ */
+template <class PrecisionT>
+void applyMatrix(PrecisionT *re, PrecisionT *im, size_t num_qubits,
+                 const std::complex<PrecisionT> *matrix,
+                 const std::vector<size_t> &wires) {
+    if (wires.size() == 1) {
+        applySingleQubit(re, im, num_qubits, matrix, wires[0]);
+        return;
+    }
+    const auto offsets = Internal::wireOffsets(num_qubits, wires);
+    const size_t dim = offsets.size();
+    size_t mask = 0;
+    for (const size_t offset : offsets) {
+        mask |= offset;
+    }
+    // The matrix is split as well, so the products are real FMAs
+    std::vector<PrecisionT> mat_re(dim * dim);
+    std::vector<PrecisionT> mat_im(dim * dim);
+    for (size_t k = 0; k < dim * dim; k++) {
+        mat_re[k] = matrix[k].real();
+        mat_im[k] = matrix[k].imag();
+    }
+    std::vector<PrecisionT> v_re(dim);
+    std::vector<PrecisionT> v_im(dim);
+
+    const size_t length = Util::exp2(num_qubits);
+    for (size_t idx = 0; idx < length; idx++) {
+        if ((idx & mask) != 0) {
+            continue;
+        }
+        for (size_t k = 0; k < dim; k++) {
+            v_re[k] = re[idx | offsets[k]];
+            v_im[k] = im[idx | offsets[k]];
+        }
+        for (size_t row = 0; row < dim; row++) {
+            const PrecisionT *row_re = mat_re.data() + row * dim;
+            const PrecisionT *row_im = mat_im.data() + row * dim;
+            PrecisionT acc_re = 0;
+            PrecisionT acc_im = 0;
+            for (size_t col = 0; col < dim; col++) {
+                acc_re += row_re[col] * v_re[col] - row_im[col] * v_im[col];
+                acc_im += row_re[col] * v_im[col] + row_im[col] * v_re[col];
+            }
+            re[idx | offsets[row]] = acc_re;
+            im[idx | offsets[row]] = acc_im;
+        }
+    }
+}
+
+/**
+ * @brief Compute the probability of each basis state.
+ *
+ * @param re Real parts of the statevector.
+ * @param im Imaginary parts of the statevector.
+ * @param length Length of the statevector.
+ * @param probs Output of the probabilities.
+ */
+template <class PrecisionT>
+void probabilities(const PrecisionT *re, const PrecisionT *im, size_t length,
+                   PrecisionT *probs) {
+    PL_LOOP_SIMD
+    for (size_t idx = 0; idx < length; idx++) {
+        probs[idx] = re[idx] * re[idx] + im[idx] * im[idx];
+    }
+}
+} // namespace Pennylane::Gates::SplitComplex
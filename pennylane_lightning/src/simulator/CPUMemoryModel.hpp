@@ -30,6 +30,7 @@ namespace Pennylane {
  */
 enum class CPUMemoryModel : uint8_t {
     Unaligned,
+    Aligned128,
     Aligned256,
     Aligned512,
     END,
@@ -51,9 +52,50 @@ inline auto getMemoryModel(const void *ptr) -> CPUMemoryModel {
         return CPUMemoryModel::Aligned256;
     }
 
+    if ((reinterpret_cast<uintptr_t>(ptr) % 16) == 0) {
+        return CPUMemoryModel::Aligned128;
+    }
+
     return CPUMemoryModel::Unaligned;
 }
 
+/**
+ * @brief Check whether the AVX2 kernels are compiled with AVX2 intrinsics,
+ * either for the build target or for runtime dispatch, and the CPU supports
+ * them.
+ */
+inline auto hasAVX2Kernels() -> bool {
+    if constexpr (Util::Constant::use_avx2 ||
+                  Util::Constant::use_runtime_dispatch) {
+        return Util::RuntimeInfo::AVX2();
+    }
+    return false;
+}
+
+/**
+ * @brief Check whether the AVX512 kernels are compiled with AVX512F
+ * intrinsics, either for the build target or for runtime dispatch, and the
+ * CPU supports them.
+ */
+inline auto hasAVX512FKernels() -> bool {
+    if constexpr (Util::Constant::use_avx512f ||
+                  Util::Constant::use_runtime_dispatch) {
+        return Util::RuntimeInfo::AVX512F();
+    }
+    return false;
+}
+
+/**
+ * @brief Check whether the NEON kernels are compiled with NEON intrinsics,
+ * i.e. the library is built for AArch64, and the CPU supports them.
+ */
+inline auto hasNEONKernels() -> bool {
+    if constexpr (Util::Constant::use_neon) {
+        return Util::RuntimeInfo::NEON();
+    }
+    return false;
+}
+
 /**
  * @brief Choose the best memory model to use using runtime/compile-time
  * information.
@@ -61,17 +103,14 @@ inline auto getMemoryModel(const void *ptr) -> CPUMemoryModel {
  * @return CPUMemoryModel
  */
 inline auto bestCPUMemoryModel() -> CPUMemoryModel {
-    if constexpr (Util::Constant::use_avx512f) {
-        // If the binary is compiled with AVX512F support
-        if (Util::RuntimeInfo::AVX512F()) {
-            // and the CPU support it as well
-            return CPUMemoryModel::Aligned512;
-        }
+    if (hasAVX512FKernels()) {
+        return CPUMemoryModel::Aligned512;
+    }
+    if (hasAVX2Kernels()) {
+        return CPUMemoryModel::Aligned256;
     }
-    if constexpr (Util::Constant::use_avx2) {
-        if (Util::RuntimeInfo::AVX2()) {
-            return CPUMemoryModel::Aligned256;
-        }
+    if (hasNEONKernels()) {
+        return CPUMemoryModel::Aligned128;
     }
     return CPUMemoryModel::Unaligned;
 }
@@ -86,6 +125,8 @@ constexpr inline auto getAlignment(CPUMemoryModel memory_model) -> uint32_t {
     switch (memory_model) {
     case CPUMemoryModel::Unaligned:
         return alignof(T);
+    case CPUMemoryModel::Aligned128:
+        return 16U;
     case CPUMemoryModel::Aligned256:
         return 32U;
     case CPUMemoryModel::Aligned512:
@@ -102,10 +143,18 @@ constexpr inline auto getAlignment(CPUMemoryModel memory_model) -> uint32_t {
  * @brief Get a corresponding allocator for standard library containers.
  *
  * @tparam T Data type
+ * @param memory_model Memory model
+ * @param numa_policy Placement of the allocated pages on NUMA nodes
+ * @param huge_pages Backing of the allocation with huge pages
+ * @param pool Pool the deallocated memory is returned to, or nullptr
  */
 template <class T>
-constexpr auto getAllocator(CPUMemoryModel memory_model)
-    -> Util::AlignedAllocator<T> {
-    return Util::AlignedAllocator<T>{getAlignment<T>(memory_model)};
+constexpr auto
+getAllocator(CPUMemoryModel memory_model,
+             Util::NUMAPolicy numa_policy = Util::NUMAPolicy::Default,
+             Util::HugePagePolicy huge_pages = Util::HugePagePolicy::Disabled,
+             Util::BufferPool *pool = nullptr) -> Util::AlignedAllocator<T> {
+    return Util::AlignedAllocator<T>{getAlignment<T>(memory_model),
+                                     numa_policy, huge_pages, pool};
 }
 } // namespace Pennylane
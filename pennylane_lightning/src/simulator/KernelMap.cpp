@@ -12,9 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include "KernelMap.hpp"
+#include "KernelProfile.hpp"
 
+#include "CPUMemoryModel.hpp"
 #include "GateOperation.hpp"
 #include "KernelType.hpp"
+#include "Macros.hpp"
+#include "cpu_kernels/GateImplementationsAVX2.hpp"
+#include "cpu_kernels/GateImplementationsAVX512.hpp"
+#include "cpu_kernels/GateImplementationsNEON.hpp"
+#include "cpu_kernels/GateImplementationsParallelLM.hpp"
 
 using namespace Pennylane;
 using namespace Pennylane::KernelMap;
@@ -34,6 +41,88 @@ namespace Pennylane::KernelMap::Internal {
 
 constexpr static auto all_qubit_numbers = Util::full_domain<size_t>();
 
+/**
+ * @brief Assign AVX2/AVX512 kernels to the aligned memory models for the given
+ * operations if the library is compiled with the instruction sets, or with
+ * runtime dispatch and the CPU supports them.
+ *
+ * @param avx2_ops Operations implemented in the AVX2 kernel
+ * @param avx512_ops Operations implemented in the AVX512 kernel
+ */
+template <class Operation, size_t avx2_size, size_t avx512_size>
+void assignAVXKernelsForOps(
+    [[maybe_unused]] const std::array<Operation, avx2_size> &avx2_ops,
+    [[maybe_unused]] const std::array<Operation, avx512_size> &avx512_ops) {
+    auto &instance = OperationKernelMap<Operation>::getInstance();
+    const bool avx512f = hasAVX512FKernels();
+    if (hasAVX2Kernels()) {
+        for (const auto op : avx2_ops) {
+            instance.assignKernelForOp(op, all_threading,
+                                       CPUMemoryModel::Aligned256,
+                                       all_qubit_numbers, KernelType::AVX2);
+            if (!avx512f) {
+                instance.assignKernelForOp(op, all_threading,
+                                           CPUMemoryModel::Aligned512,
+                                           all_qubit_numbers, KernelType::AVX2);
+            }
+        }
+    }
+    if (avx512f) {
+        for (const auto op : avx512_ops) {
+            instance.assignKernelForOp(op, all_threading,
+                                       CPUMemoryModel::Aligned512,
+                                       all_qubit_numbers, KernelType::AVX512);
+        }
+    }
+}
+
+/**
+ * @brief Assign the NEON kernel to the aligned memory models for the given
+ * operations if the library is compiled for AArch64 and the CPU supports
+ * NEON.
+ *
+ * @param ops Operations implemented in the NEON kernel
+ */
+template <class Operation, size_t size>
+void assignNEONKernelsForOps(
+    [[maybe_unused]] const std::array<Operation, size> &ops) {
+    if (!hasNEONKernels()) {
+        return;
+    }
+    auto &instance = OperationKernelMap<Operation>::getInstance();
+    for (const auto op : ops) {
+        for (const auto memory_model :
+             {CPUMemoryModel::Aligned128, CPUMemoryModel::Aligned256,
+              CPUMemoryModel::Aligned512}) {
+            instance.assignKernelForOp(op, all_threading, memory_model,
+                                       all_qubit_numbers, KernelType::NEON);
+        }
+    }
+}
+
+/**
+ * @brief Assign the multi-threaded LM kernel to Threading::MultiThread for the
+ * given operations if the library is compiled with OpenMP.
+ *
+ * As the assignment is for all memory models, its priority (2) is higher than
+ * that of AVX kernels.
+ *
+ * @param ops Operations implemented in the ParallelLM kernel
+ */
+template <class Operation, size_t size>
+void assignParallelKernelsForOps(
+    [[maybe_unused]] const std::array<Operation, size> &ops) {
+    if constexpr (Util::Constant::use_openmp) {
+        auto &instance = OperationKernelMap<Operation>::getInstance();
+        for (const auto op : ops) {
+            instance.assignKernelForOp(
+                op, Threading::MultiThread, all_memory_model,
+                larger_than_equal_to<size_t>(parallel_lm_min_num_qubits),
+                KernelType::ParallelLM);
+        }
+    }
+}
+
 int assignDefaultKernelsForGateOp() {
     auto &instance = OperationKernelMap<GateOperation>::getInstance();
 
@@ -146,6 +235,13 @@ int assignDefaultKernelsForGateOp() {
     instance.assignKernelForOp(GateOperation::MultiRZ, all_threading,
                                all_memory_model, all_qubit_numbers,
                                Gates::KernelType::LM);
+
+    assignAVXKernelsForOps(Gates::GateImplementationsAVX2::implemented_gates,
+                           Gates::GateImplementationsAVX512::implemented_gates);
+    assignNEONKernelsForOps(
+        Gates::GateImplementationsNEON::implemented_gates);
+    assignParallelKernelsForOps(
+        Gates::GateImplementationsParallelLM::implemented_gates);
     return 1;
 }
 
@@ -208,6 +304,14 @@ int assignDefaultKernelsForGeneratorOp() {
     instance.assignKernelForOp(GeneratorOperation::MultiRZ, all_threading,
                                all_memory_model, all_qubit_numbers,
                                KernelType::LM);
+
+    assignAVXKernelsForOps(
+        Gates::GateImplementationsAVX2::implemented_generators,
+        Gates::GateImplementationsAVX512::implemented_generators);
+    assignNEONKernelsForOps(
+        Gates::GateImplementationsNEON::implemented_generators);
+    assignParallelKernelsForOps(
+        Gates::GateImplementationsParallelLM::implemented_generators);
     return 1;
 }
 int assignDefaultKernelsForMatrixOp() {
@@ -222,6 +326,18 @@ int assignDefaultKernelsForMatrixOp() {
     instance.assignKernelForOp(MatrixOperation::MultiQubitOp, all_threading,
                                all_memory_model, all_qubit_numbers,
                                KernelType::PI);
+
+    assignAVXKernelsForOps(
+        Gates::GateImplementationsAVX2::implemented_matrices,
+        Gates::GateImplementationsAVX512::implemented_matrices);
+    assignNEONKernelsForOps(
+        Gates::GateImplementationsNEON::implemented_matrices);
+    assignParallelKernelsForOps(
+        Gates::GateImplementationsParallelLM::implemented_matrices);
     return 1;
 }
+
+void loadKernelProfileOnce() {
+    [[maybe_unused]] static const bool loaded = loadKernelProfile();
+}
 } // namespace Pennylane::KernelMap::Internal
@@ -25,10 +25,19 @@
 
 #include <deque>
 #include <functional>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <utility>
 
 namespace Pennylane::KernelMap {
+/**
+ * @brief Minimum number of qubits to use the multi-threaded kernel for
+ * Threading::MultiThread. For smaller statevectors, the overhead of creating a
+ * parallel region dominates.
+ */
+constexpr size_t parallel_lm_min_num_qubits = 14;
+
 ///@cond DEV
 namespace Internal {
 
@@ -36,6 +45,12 @@ int assignDefaultKernelsForGateOp();
 int assignDefaultKernelsForGeneratorOp();
 int assignDefaultKernelsForMatrixOp();
 
+/**
+ * @brief Assign the kernel profile given by the environment variable
+ * `PL_KERNEL_PROFILE` for all operations. Only the first call has an effect.
+ */
+void loadKernelProfileOnce();
+
 template <class Operation> struct AssignKernelForOp;
 
 template <> struct AssignKernelForOp<Gates::GateOperation> {
@@ -150,6 +165,9 @@ constexpr static AllMemoryModel all_memory_model{};
  *
  * For a given number of qubit, threading, and memory model, this class
  * returns the best kernels for each gate/generator/matrix operation.
+ *
+ * All member functions are thread-safe. Kernel maps are looked up under a
+ * shared lock, so statevectors can be created concurrently.
  */
 template <class Operation, size_t cache_size = 16> class OperationKernelMap {
   public:
@@ -162,6 +180,16 @@ template <class Operation, size_t cache_size = 16> class OperationKernelMap {
     EnumDispatchKernalMap kernel_map_;
     mutable std::deque<std::tuple<size_t, uint32_t, EnumKernelMap>> cache_;
 
+    /**
+     * @brief Guards kernel_map_. It is acquired before cache_mutex_.
+     */
+    mutable std::shared_mutex mutex_;
+
+    /**
+     * @brief Guards cache_, which is updated by concurrent readers.
+     */
+    mutable std::mutex cache_mutex_;
+
     /**
      * @brief Allowed kernels for a given memory model
      */
@@ -172,11 +200,19 @@ template <class Operation, size_t cache_size = 16> class OperationKernelMap {
         : allowed_kernels_{
               // LCOV_EXCL_START
               {CPUMemoryModel::Unaligned,
-               {Gates::KernelType::LM, Gates::KernelType::PI}},
+               {Gates::KernelType::LM, Gates::KernelType::PI,
+                Gates::KernelType::ParallelLM}},
+              {CPUMemoryModel::Aligned128,
+               {Gates::KernelType::LM, Gates::KernelType::PI,
+                Gates::KernelType::ParallelLM, Gates::KernelType::NEON}},
               {CPUMemoryModel::Aligned256,
-               {Gates::KernelType::LM, Gates::KernelType::PI}},
+               {Gates::KernelType::LM, Gates::KernelType::PI,
+                Gates::KernelType::ParallelLM, Gates::KernelType::NEON,
+                Gates::KernelType::AVX2}},
               {CPUMemoryModel::Aligned512,
-               {Gates::KernelType::LM, Gates::KernelType::PI}},
+               {Gates::KernelType::LM, Gates::KernelType::PI,
+                Gates::KernelType::ParallelLM, Gates::KernelType::NEON,
+                Gates::KernelType::AVX2, Gates::KernelType::AVX512}},
               // LCOV_EXCL_STOP
           } {}
 
@@ -192,6 +228,16 @@ template <class Operation, size_t cache_size = 16> class OperationKernelMap {
         return instance;
     }
 
+    /**
+     * @brief Get the kernels allowed for a given memory model.
+     *
+     * @param memory_model Memory model
+     */
+    [[nodiscard]] auto getAllowedKernels(CPUMemoryModel memory_model) const
+        -> const std::vector<Gates::KernelType> & {
+        return allowed_kernels_.at(memory_model);
+    }
+
     /**
      * @brief Assign a kernel for a given operation, threading, and memory
      * model.
@@ -218,13 +264,17 @@ template <class Operation, size_t cache_size = 16> class OperationKernelMap {
                      "the given memory model.");
         }
         const auto dispatch_key = toDispatchKey(threading, memory_model);
+        const std::unique_lock lock(mutex_);
         auto &set = kernel_map_[std::make_pair(op, dispatch_key)];
 
         PL_ABORT_IF(set.conflict(priority, interval),
                     "The given interval conflicts with existing intervals.");
 
         // Reset cache
-        cache_.clear();
+        {
+            const std::lock_guard cache_lock(cache_mutex_);
+            cache_.clear();
+        }
 
         set.emplace(priority, interval, kernel);
     }
@@ -287,6 +337,7 @@ template <class Operation, size_t cache_size = 16> class OperationKernelMap {
                            CPUMemoryModel memory_model, uint32_t priority) {
         uint32_t dispatch_key = toDispatchKey(threading, memory_model);
         const auto key = std::make_pair(op, dispatch_key);
+        const std::unique_lock lock(mutex_);
 
         const auto iter = kernel_map_.find(key);
         PL_ABORT_IF(iter == kernel_map_.end(),
@@ -294,6 +345,7 @@ template <class Operation, size_t cache_size = 16> class OperationKernelMap {
         (iter->second).clearPriority(priority);
 
         // Reset cache
+        const std::lock_guard cache_lock(cache_mutex_);
         cache_.clear();
     }
 
@@ -308,29 +360,35 @@ template <class Operation, size_t cache_size = 16> class OperationKernelMap {
     [[nodiscard]] auto getKernelMap(size_t num_qubits, Threading threading,
                                     CPUMemoryModel memory_model) const
         -> EnumKernelMap {
-        // TODO: Add mutex for cache_ when we goto multithread.
+        Internal::loadKernelProfileOnce();
         const uint32_t dispatch_key = toDispatchKey(threading, memory_model);
+        const std::shared_lock lock(mutex_);
+
+        {
+            const std::lock_guard cache_lock(cache_mutex_);
+            const auto cache_iter = std::find_if(
+                cache_.begin(), cache_.end(), [=](const auto &elt) {
+                    return (std::get<0>(elt) == num_qubits) &&
+                           (std::get<1>(elt) == dispatch_key);
+                });
+            if (cache_iter != cache_.end()) {
+                return std::get<2>(*cache_iter);
+            }
+        }
 
-        const auto cache_iter =
-            std::find_if(cache_.begin(), cache_.end(), [=](const auto &elt) {
-                return (std::get<0>(elt) == num_qubits) &&
-                       (std::get<1>(elt) == dispatch_key);
-            });
-        if (cache_iter == cache_.end()) {
-            std::unordered_map<Operation, Gates::KernelType> kernel_for_op;
+        std::unordered_map<Operation, Gates::KernelType> kernel_for_op;
+        Util::for_each_enum<Operation>([&](Operation op) {
+            const auto key = std::make_pair(op, dispatch_key);
+            const auto &set = kernel_map_.at(key);
+            kernel_for_op.emplace(op, set.getKernel(num_qubits));
+        });
 
-            Util::for_each_enum<Operation>([&](Operation op) {
-                const auto key = std::make_pair(op, dispatch_key);
-                const auto &set = kernel_map_.at(key);
-                kernel_for_op.emplace(op, set.getKernel(num_qubits));
-            });
-            if (cache_.size() == cache_size) {
-                cache_.pop_back();
-            }
-            cache_.emplace_front(num_qubits, dispatch_key, kernel_for_op);
-            return kernel_for_op;
+        const std::lock_guard cache_lock(cache_mutex_);
+        if (cache_.size() == cache_size) {
+            cache_.pop_back();
         }
-        return std::get<2>(*cache_iter);
+        cache_.emplace_front(num_qubits, dispatch_key, kernel_for_op);
+        return kernel_for_op;
     }
 };
 } // namespace Pennylane::KernelMap
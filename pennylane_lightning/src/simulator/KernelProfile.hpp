@@ -0,0 +1,430 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Read and write kernel assignments, and load a per-CPU kernel profile.
+ */
+#pragma once
+#include "AvailableKernels.hpp"
+#include "CPUMemoryModel.hpp"
+#include "Constant.hpp"
+#include "ConstantUtil.hpp"
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "IntegerInterval.hpp"
+#include "KernelMap.hpp"
+#include "KernelType.hpp"
+#include "RuntimeInfo.hpp"
+#include "SelectKernel.hpp"
+#include "Threading.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Pennylane::KernelMap {
+/**
+ * @brief Priority of kernels assigned from measurements or a kernel profile.
+ * It is higher than the priorities of the default assignments, which remain
+ * as a fallback for numbers of qubits not covered by the measurements.
+ */
+constexpr uint32_t tuned_priority = 3;
+
+/**
+ * @brief Kernel selected for an operation, threading, memory model, and range
+ * of the number of qubits.
+ */
+template <class Operation> struct TunedKernel {
+    Operation op;
+    Threading threading;
+    CPUMemoryModel memory_model;
+    Util::IntegerInterval<size_t> interval;
+    Gates::KernelType kernel;
+};
+
+/**
+ * @brief Kernels selected for all gate, generator, and matrix operations.
+ */
+struct TunedKernelTable {
+    std::vector<TunedKernel<Gates::GateOperation>> gates;
+    std::vector<TunedKernel<Gates::GeneratorOperation>> generators;
+    std::vector<TunedKernel<Gates::MatrixOperation>> matrices;
+};
+
+/// @cond DEV
+namespace Internal {
+constexpr std::array threading_names{
+    std::pair<Threading, std::string_view>{Threading::SingleThread,
+                                           "SingleThread"},
+    std::pair<Threading, std::string_view>{Threading::MultiThread,
+                                           "MultiThread"},
+};
+
+constexpr std::array memory_model_names{
+    std::pair<CPUMemoryModel, std::string_view>{CPUMemoryModel::Unaligned,
+                                                "Unaligned"},
+    std::pair<CPUMemoryModel, std::string_view>{CPUMemoryModel::Aligned128,
+                                                "Aligned128"},
+    std::pair<CPUMemoryModel, std::string_view>{CPUMemoryModel::Aligned256,
+                                                "Aligned256"},
+    std::pair<CPUMemoryModel, std::string_view>{CPUMemoryModel::Aligned512,
+                                                "Aligned512"},
+};
+
+template <class Operation> constexpr auto operationNames() {
+    if constexpr (std::is_same_v<Operation, Gates::GateOperation>) {
+        return Gates::Constant::gate_names;
+    } else if constexpr (std::is_same_v<Operation,
+                                        Gates::GeneratorOperation>) {
+        return Gates::Constant::generator_names;
+    } else {
+        return Gates::Constant::matrix_names;
+    }
+}
+
+/**
+ * @brief Find the key of a name in an array of key and name pairs.
+ */
+template <class Key, size_t size>
+auto findByName(const std::array<std::pair<Key, std::string_view>, size> &arr,
+                std::string_view name) -> std::optional<Key> {
+    for (const auto &[key, key_name] : arr) {
+        if (key_name == name) {
+            return key;
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Remove leading and trailing whitespace.
+ */
+inline auto trim(std::string_view str) -> std::string_view {
+    constexpr std::string_view whitespace = " \t\r\n";
+    const auto begin = str.find_first_not_of(whitespace);
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    const auto end = str.find_last_not_of(whitespace);
+    return str.substr(begin, end - begin + 1);
+}
+
+/**
+ * @brief Check if a kernel in the type list implements the operation.
+ */
+template <class TypeList, class Operation>
+auto isImplemented(Operation op, Gates::KernelType kernel) -> bool {
+    if constexpr (std::is_same_v<TypeList, void>) {
+        return false;
+    } else {
+        using GateImplementation = typename TypeList::Type;
+        if (GateImplementation::kernel_id != kernel) {
+            return isImplemented<typename TypeList::Next>(op, kernel);
+        }
+        if constexpr (std::is_same_v<Operation, Gates::GateOperation>) {
+            return Util::array_has_elt(GateImplementation::implemented_gates,
+                                       op);
+        } else if constexpr (std::is_same_v<Operation,
+                                            Gates::GeneratorOperation>) {
+            return Util::array_has_elt(
+                GateImplementation::implemented_generators, op);
+        } else {
+            return Util::array_has_elt(
+                GateImplementation::implemented_matrices, op);
+        }
+    }
+}
+
+/**
+ * @brief Check if the kernel implements the operation in this binary and the
+ * CPU supports its instruction set.
+ */
+template <class Operation>
+auto isKernelAvailable(Operation op, Gates::KernelType kernel) -> bool {
+    switch (kernel) {
+    case Gates::KernelType::AVX2:
+        if (!Util::RuntimeInfo::AVX2()) {
+            return false;
+        }
+        break;
+    case Gates::KernelType::AVX512:
+        if (!Util::RuntimeInfo::AVX512F()) {
+            return false;
+        }
+        break;
+    case Gates::KernelType::NEON:
+        if (!Util::RuntimeInfo::NEON()) {
+            return false;
+        }
+        break;
+    default:
+        break;
+    }
+    return isImplemented<AvailableKernels>(op, kernel);
+}
+} // namespace Internal
+/// @endcond
+
+/**
+ * @brief Assign selected kernels to OperationKernelMap with priority
+ * `tuned_priority`.
+ *
+ * Kernels previously assigned with this priority for the same operation,
+ * threading, and memory model are removed first.
+ *
+ * @param tuned Selected kernels.
+ */
+template <class Operation>
+void assignTunedKernels(const std::vector<TunedKernel<Operation>> &tuned) {
+    auto &instance = OperationKernelMap<Operation>::getInstance();
+    std::set<std::tuple<Operation, Threading, CPUMemoryModel>> cleared;
+    for (const auto &elt : tuned) {
+        if (cleared.emplace(elt.op, elt.threading, elt.memory_model).second) {
+            instance.removeKernelForOp(elt.op, elt.threading,
+                                       elt.memory_model, tuned_priority);
+        }
+        instance.assignKernelForOp(elt.op, elt.threading, elt.memory_model,
+                                   tuned_priority, elt.interval, elt.kernel);
+    }
+}
+
+/**
+ * @brief Assign selected kernels for all operations.
+ *
+ * @param table Selected kernels.
+ */
+inline void assignTunedKernels(const TunedKernelTable &table) {
+    assignTunedKernels(table.gates);
+    assignTunedKernels(table.generators);
+    assignTunedKernels(table.matrices);
+}
+
+/**
+ * @brief Write selected kernels in a line-based text format.
+ *
+ * Each line is `<operation> <threading> <memory model> <min qubits>
+ * <max qubits> <kernel>`, where the range of the number of qubits is
+ * [min, max). Lines starting with `#` are comments.
+ *
+ * @param os Output stream.
+ * @param table Selected kernels.
+ */
+inline void writeTunedKernels(std::ostream &os,
+                              const TunedKernelTable &table) {
+    const auto write = [&os](const auto &tuned) {
+        for (const auto &elt : tuned) {
+            using Operation = std::decay_t<decltype(elt.op)>;
+            os << Util::lookup(Internal::operationNames<Operation>(), elt.op)
+               << ' ' << Util::lookup(Internal::threading_names, elt.threading)
+               << ' '
+               << Util::lookup(Internal::memory_model_names, elt.memory_model)
+               << ' ' << elt.interval.min() << ' ' << elt.interval.max() << ' '
+               << Util::lookup(Gates::kernel_id_name_pairs, elt.kernel)
+               << '\n';
+        }
+    };
+    os << "# operation threading memory_model min_qubits max_qubits kernel\n";
+    write(table.gates);
+    write(table.generators);
+    write(table.matrices);
+}
+
+/**
+ * @brief Read selected kernels written by writeTunedKernels.
+ *
+ * @param is Input stream.
+ */
+inline auto readTunedKernels(std::istream &is) -> TunedKernelTable {
+    TunedKernelTable table;
+    std::string line;
+    while (std::getline(is, line)) {
+        std::istringstream line_stream(line);
+        std::string op_name;
+        std::string threading_name;
+        std::string memory_model_name;
+        size_t min_qubits = 0;
+        size_t max_qubits = 0;
+        std::string kernel_name;
+        if (!(line_stream >> op_name) || op_name.front() == '#') {
+            continue;
+        }
+        PL_ABORT_IF(!(line_stream >> threading_name >> memory_model_name >>
+                      min_qubits >> max_qubits >> kernel_name) ||
+                        min_qubits >= max_qubits,
+                    "Invalid line in the kernel table.");
+        const auto threading =
+            Internal::findByName(Internal::threading_names, threading_name);
+        const auto memory_model = Internal::findByName(
+            Internal::memory_model_names, memory_model_name);
+        const auto kernel =
+            Internal::findByName(Gates::kernel_id_name_pairs, kernel_name);
+        PL_ABORT_IF(!threading || !memory_model || !kernel,
+                    "Invalid threading, memory model, or kernel in the "
+                    "kernel table.");
+        const Util::IntegerInterval<size_t> interval{min_qubits, max_qubits};
+
+        if (const auto op = Internal::findByName(
+                Internal::operationNames<Gates::GateOperation>(), op_name)) {
+            table.gates.push_back(
+                {*op, *threading, *memory_model, interval, *kernel});
+        } else if (const auto gntr_op = Internal::findByName(
+                       Internal::operationNames<Gates::GeneratorOperation>(),
+                       op_name)) {
+            table.generators.push_back(
+                {*gntr_op, *threading, *memory_model, interval, *kernel});
+        } else if (const auto mat_op = Internal::findByName(
+                       Internal::operationNames<Gates::MatrixOperation>(),
+                       op_name)) {
+            table.matrices.push_back(
+                {*mat_op, *threading, *memory_model, interval, *kernel});
+        } else {
+            PL_ABORT("Unknown operation in the kernel table.");
+        }
+    }
+    return table;
+}
+
+/**
+ * @brief Write selected kernels to a file.
+ *
+ * @param path Path of the file.
+ * @param table Selected kernels.
+ */
+inline void saveTunedKernels(const std::string &path,
+                             const TunedKernelTable &table) {
+    std::ofstream file(path);
+    PL_ABORT_IF(!file, "Cannot open the kernel table file for writing.");
+    writeTunedKernels(file, table);
+}
+
+/**
+ * @brief Read selected kernels from a file.
+ *
+ * @param path Path of the file.
+ */
+inline auto loadTunedKernels(const std::string &path) -> TunedKernelTable {
+    std::ifstream file(path);
+    PL_ABORT_IF(!file, "Cannot open the kernel table file.");
+    return readTunedKernels(file);
+}
+
+/**
+ * @brief Environment variable holding the path of the kernel profile loaded
+ * by OperationKernelMap at first use.
+ */
+constexpr std::string_view kernel_profile_env = "PL_KERNEL_PROFILE";
+
+/**
+ * @brief Write selected kernels as a section of a kernel profile.
+ *
+ * A kernel profile is a kernel table in the format of writeTunedKernels
+ * split into sections by lines `[<cpu brand>]`, so that one file can hold
+ * the kernels for all node types of a cluster. Lines before the first
+ * section apply to all CPUs.
+ *
+ * @param os Output stream.
+ * @param cpu_brand CPU brand string, e.g. Util::RuntimeInfo::brand().
+ * @param table Selected kernels.
+ */
+inline void writeKernelProfile(std::ostream &os, std::string_view cpu_brand,
+                               const TunedKernelTable &table) {
+    os << '[' << Internal::trim(cpu_brand) << "]\n";
+    writeTunedKernels(os, table);
+}
+
+/**
+ * @brief Read the kernels of a kernel profile that apply to a CPU.
+ *
+ * @param is Input stream.
+ * @param cpu_brand CPU brand string, e.g. Util::RuntimeInfo::brand().
+ */
+inline auto readKernelProfile(std::istream &is, std::string_view cpu_brand)
+    -> TunedKernelTable {
+    const auto brand = Internal::trim(cpu_brand);
+    std::stringstream selected;
+    bool in_section = true;
+    std::string line;
+    while (std::getline(is, line)) {
+        const auto trimmed = Internal::trim(line);
+        if (!trimmed.empty() && trimmed.front() == '[') {
+            PL_ABORT_IF(trimmed.back() != ']',
+                        "Invalid section header in the kernel profile.");
+            in_section =
+                Internal::trim(trimmed.substr(1, trimmed.size() - 2)) ==
+                brand;
+        } else if (in_section) {
+            selected << line << '\n';
+        }
+    }
+    return readTunedKernels(selected);
+}
+
+/**
+ * @brief Remove kernels which are not compiled into this binary or not
+ * supported by the CPU.
+ *
+ * @param table Selected kernels.
+ */
+inline auto filterAvailableKernels(TunedKernelTable table)
+    -> TunedKernelTable {
+    const auto filter = [](auto &tuned) {
+        tuned.erase(std::remove_if(tuned.begin(), tuned.end(),
+                                   [](const auto &elt) {
+                                       return !Internal::isKernelAvailable(
+                                           elt.op, elt.kernel);
+                                   }),
+                    tuned.end());
+    };
+    filter(table.gates);
+    filter(table.generators);
+    filter(table.matrices);
+    return table;
+}
+
+/**
+ * @brief Assign the kernels of the kernel profile given by the environment
+ * variable `PL_KERNEL_PROFILE` for this CPU.
+ *
+ * Kernels which are not available in this binary or on this CPU are skipped,
+ * so a profile can be shared between builds.
+ *
+ * @return True if a profile was loaded.
+ */
+inline auto loadKernelProfile() -> bool {
+    // NOLINTNEXTLINE(concurrency-mt-unsafe)
+    const char *path = std::getenv(kernel_profile_env.data());
+    if (path == nullptr || *path == '\0') {
+        return false;
+    }
+    std::ifstream file(path);
+    PL_ABORT_IF(!file, "Cannot open the kernel profile given by "
+                       "PL_KERNEL_PROFILE.");
+    assignTunedKernels(filterAvailableKernels(
+        readKernelProfile(file, Util::RuntimeInfo::brand())));
+    return true;
+}
+} // namespace Pennylane::KernelMap
@@ -0,0 +1,283 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Select kernels for each operation by timing them on this machine.
+ */
+#pragma once
+#include "CPUMemoryModel.hpp"
+#include "Constant.hpp"
+#include "ConstantUtil.hpp"
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "IntegerInterval.hpp"
+#include "KernelMap.hpp"
+#include "KernelProfile.hpp"
+#include "KernelType.hpp"
+#include "Memory.hpp"
+#include "SelectKernel.hpp"
+#include "Threading.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Pennylane::KernelMap {
+/// @cond DEV
+namespace Internal {
+/**
+ * @brief Number of wires of multi-qubit operations when timing kernels.
+ */
+constexpr size_t tuning_multi_qubit_wires = 3;
+
+/**
+ * @brief Number of wires the operation is timed on.
+ */
+template <class Operation> auto tuningNumWires(Operation op) -> size_t {
+    using namespace Gates::Constant;
+    if constexpr (std::is_same_v<Operation, Gates::GateOperation>) {
+        if (Util::array_has_elt(multi_qubit_gates, op)) {
+            return tuning_multi_qubit_wires;
+        }
+        return Util::lookup(gate_wires, op);
+    } else if constexpr (std::is_same_v<Operation,
+                                        Gates::GeneratorOperation>) {
+        if (Util::array_has_elt(multi_qubit_generators, op)) {
+            return tuning_multi_qubit_wires;
+        }
+        return Util::lookup(generator_wires, op);
+    } else {
+        switch (op) {
+        case Gates::MatrixOperation::SingleQubitOp:
+            return 1;
+        case Gates::MatrixOperation::TwoQubitOp:
+            return 2;
+        default:
+            return tuning_multi_qubit_wires;
+        }
+    }
+}
+} // namespace Internal
+/// @endcond
+
+/**
+ * @brief Selects the fastest registered kernel for each operation by timing
+ * all of them on this machine.
+ *
+ * Each operation is timed on a uniform superposition for each given number
+ * of qubits, once on the lowest and once on the highest wires. The fastest
+ * kernel for a number of qubits is used up to the next given number of
+ * qubits, or for all larger numbers of qubits if it is the last one. The
+ * results can be assigned to OperationKernelMap with priority
+ * `tuned_priority` and be written to a file so that later processes do not
+ * repeat the measurements.
+ *
+ * @tparam PrecisionT Floating point precision of the timed kernels.
+ */
+template <class PrecisionT> class KernelTuner {
+  private:
+    using ComplexT = std::complex<PrecisionT>;
+
+    /**
+     * @brief Check if the kernel is a candidate for the given threading and
+     * memory model.
+     */
+    template <class Operation>
+    static auto isCandidate(Operation op, Gates::KernelType kernel,
+                            Threading threading, CPUMemoryModel memory_model)
+        -> bool {
+        // Single-threaded statevectors must not run multi-threaded kernels
+        if (threading == Threading::SingleThread &&
+            kernel == Gates::KernelType::ParallelLM) {
+            return false;
+        }
+        const auto &allowed = OperationKernelMap<Operation>::getInstance()
+                                  .getAllowedKernels(memory_model);
+        return DynamicDispatcher<PrecisionT>::getInstance().isRegistered(
+                   op, kernel) &&
+               std::find(allowed.cbegin(), allowed.cend(), kernel) !=
+                   allowed.cend();
+    }
+
+    /**
+     * @brief Apply the operation once using the given kernel.
+     */
+    template <class Operation>
+    static void applyOnce(Operation op, Gates::KernelType kernel,
+                          ComplexT *data, size_t num_qubits,
+                          const std::vector<size_t> &wires,
+                          const std::vector<ComplexT> &matrix) {
+        const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+        if constexpr (std::is_same_v<Operation, Gates::GateOperation>) {
+            const std::vector<PrecisionT> params(
+                Util::lookup(Gates::Constant::gate_num_params, op),
+                PrecisionT{0.3});
+            dispatcher.applyOperation(kernel, data, num_qubits, op, wires,
+                                      false, params);
+        } else if constexpr (std::is_same_v<Operation,
+                                            Gates::GeneratorOperation>) {
+            [[maybe_unused]] const auto scale = dispatcher.applyGenerator(
+                kernel, data, num_qubits, op, wires, false);
+        } else {
+            dispatcher.applyMatrix(kernel, data, num_qubits, matrix.data(),
+                                   wires, false);
+        }
+    }
+
+  public:
+    /**
+     * @brief Time a kernel for an operation.
+     *
+     * @param op Operation.
+     * @param kernel Kernel to time.
+     * @param num_qubits Number of qubits.
+     * @param memory_model Memory model of the statevector.
+     * @param num_repeats Number of measurements. The fastest one is used.
+     * @return Seconds taken to apply the operation on the lowest and on the
+     * highest wires.
+     */
+    template <class Operation>
+    static auto timeKernel(Operation op, Gates::KernelType kernel,
+                           size_t num_qubits, CPUMemoryModel memory_model,
+                           size_t num_repeats) -> double {
+        const size_t num_wires = Internal::tuningNumWires(op);
+        PL_ABORT_IF(num_wires > num_qubits,
+                    "The operation acts on more wires than qubits.");
+        const size_t length = Util::exp2(num_qubits);
+        std::vector<ComplexT, Util::AlignedAllocator<ComplexT>> data(
+            length,
+            ComplexT{static_cast<PrecisionT>(1.0 / std::sqrt(length)), 0.0},
+            getAllocator<ComplexT>(memory_model));
+        const std::vector<ComplexT> matrix(
+            Util::exp2(2 * num_wires),
+            ComplexT{static_cast<PrecisionT>(1.0 / Util::exp2(num_wires)),
+                     0.0});
+
+        std::vector<size_t> low_wires(num_wires);
+        std::iota(low_wires.begin(), low_wires.end(), 0);
+        std::vector<size_t> high_wires(num_wires);
+        std::iota(high_wires.begin(), high_wires.end(),
+                  num_qubits - num_wires);
+
+        // Warm up
+        applyOnce(op, kernel, data.data(), num_qubits, low_wires, matrix);
+
+        double best = std::numeric_limits<double>::max();
+        for (size_t repeat = 0; repeat < std::max<size_t>(num_repeats, 1);
+             repeat++) {
+            const auto start = std::chrono::steady_clock::now();
+            applyOnce(op, kernel, data.data(), num_qubits, low_wires, matrix);
+            applyOnce(op, kernel, data.data(), num_qubits, high_wires, matrix);
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+            best = std::min(best, elapsed.count());
+        }
+        return best;
+    }
+
+    /**
+     * @brief Select the fastest kernel for each operation of a kind.
+     *
+     * @tparam Operation Gates::GateOperation, Gates::GeneratorOperation, or
+     * Gates::MatrixOperation.
+     * @param threading Threading of the statevectors.
+     * @param memory_model Memory model of the statevectors.
+     * @param sample_num_qubits Increasing numbers of qubits to time kernels
+     * for.
+     * @param num_repeats Number of measurements for each kernel.
+     */
+    template <class Operation>
+    static auto tune(Threading threading, CPUMemoryModel memory_model,
+                     const std::vector<size_t> &sample_num_qubits,
+                     size_t num_repeats)
+        -> std::vector<TunedKernel<Operation>> {
+        PL_ABORT_IF(sample_num_qubits.empty() ||
+                        std::adjacent_find(sample_num_qubits.begin(),
+                                           sample_num_qubits.end(),
+                                           std::greater_equal<>{}) !=
+                            sample_num_qubits.end(),
+                    "The numbers of qubits must be strictly increasing.");
+
+        std::vector<TunedKernel<Operation>> result;
+        Util::for_each_enum<Operation>([&](Operation op) {
+            const size_t num_wires = Internal::tuningNumWires(op);
+            for (size_t idx = 0; idx < sample_num_qubits.size(); idx++) {
+                const size_t num_qubits = sample_num_qubits[idx];
+                if (num_wires > num_qubits) {
+                    continue;
+                }
+                std::optional<Gates::KernelType> best_kernel;
+                double best_time = std::numeric_limits<double>::max();
+                for (const auto &[kernel, name] : Gates::kernel_id_name_pairs) {
+                    if (!isCandidate(op, kernel, threading, memory_model)) {
+                        continue;
+                    }
+                    const double time = timeKernel(op, kernel, num_qubits,
+                                                   memory_model, num_repeats);
+                    if (time < best_time) {
+                        best_time = time;
+                        best_kernel = kernel;
+                    }
+                }
+                if (!best_kernel) {
+                    continue;
+                }
+                const size_t max_num_qubits =
+                    (idx + 1 < sample_num_qubits.size())
+                        ? sample_num_qubits[idx + 1]
+                        : std::numeric_limits<size_t>::max();
+                // Merge with the previous range if the kernel is the same
+                if (!result.empty() && result.back().op == op &&
+                    result.back().kernel == *best_kernel &&
+                    result.back().interval.max() == num_qubits) {
+                    result.back().interval = Util::IntegerInterval<size_t>{
+                        result.back().interval.min(), max_num_qubits};
+                    continue;
+                }
+                result.push_back(
+                    {op, threading, memory_model,
+                     Util::IntegerInterval<size_t>{num_qubits, max_num_qubits},
+                     *best_kernel});
+            }
+        });
+        return result;
+    }
+
+    /**
+     * @brief Select the fastest kernel for all operations.
+     *
+     * @see KernelTuner::tune
+     */
+    static auto tuneAll(Threading threading, CPUMemoryModel memory_model,
+                        const std::vector<size_t> &sample_num_qubits,
+                        size_t num_repeats) -> TunedKernelTable {
+        return {tune<Gates::GateOperation>(threading, memory_model,
+                                           sample_num_qubits, num_repeats),
+                tune<Gates::GeneratorOperation>(threading, memory_model,
+                                                sample_num_qubits, num_repeats),
+                tune<Gates::MatrixOperation>(threading, memory_model,
+                                             sample_num_qubits, num_repeats)};
+    }
+};
+} // namespace Pennylane::KernelMap
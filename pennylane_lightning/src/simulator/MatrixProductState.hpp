@@ -0,0 +1,639 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file MatrixProductState.hpp
+ * Defines a matrix product state simulator for wide circuits with low
+ * entanglement.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "GateFusion.hpp"
+#include "LinearAlgebra.hpp"
+#include "Util.hpp"
+
+namespace Pennylane {
+/**
+ * @brief Quantum state of @f$n@f$ qubits as a matrix product state (MPS).
+ *
+ * The site @f$k@f$ holds wire @f$k@f$ as a tensor
+ * @f$A^{(k)}_{l s r}@f$ of shape @f$(\chi_k, 2, \chi_{k+1})@f$, and the
+ * amplitude of a basis state is the product of the matrices selected by its
+ * bits, so memory grows as @f$n\chi^2@f$ instead of @f$2^n@f$. The tensors
+ * are kept in mixed canonical form around one site, so the singular values
+ * of a bond are those of the Schmidt decomposition of the state across it.
+ *
+ * A gate acting on several wires is applied to the contracted tensor of
+ * adjacent sites, after moving its wires next to each other by SWAP gates,
+ * and the result is split back by singular value decompositions. Singular
+ * values are truncated to at most getMaxBondDim() per bond and such that
+ * the discarded weight of each decomposition, i.e. the sum of the squared
+ * discarded singular values relative to the total, is at most getCutoff().
+ * The state is renormalized after truncation, and getTruncationError()
+ * accumulates the discarded weights. Tensor contractions use
+ * Util::matrixMatProd, i.e. BLAS when enabled and OpenMP otherwise.
+ *
+ * @tparam PrecisionT Floating point precision of underlying tensor data.
+ */
+template <class PrecisionT = double> class MatrixProductState {
+  public:
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+
+  private:
+    size_t num_qubits_;
+    size_t max_bond_dim_;
+    PrecisionT cutoff_;
+    PrecisionT truncation_error_{0};
+    std::vector<std::vector<ComplexPrecisionT>> tensors_;
+    std::vector<size_t> bond_dims_; // Dimension of the bond left of each site
+    size_t center_{0};              // Site of the orthogonality center
+
+    /**
+     * @brief Compute the product of row-major matrices of shape m * k and
+     * k * n.
+     */
+    static auto matMul(const ComplexPrecisionT *left,
+                       const ComplexPrecisionT *right, size_t m, size_t n,
+                       size_t k) -> std::vector<ComplexPrecisionT> {
+        // The OpenMP product accumulates into the result
+        std::vector<ComplexPrecisionT> result(m * n);
+        Util::matrixMatProd(left, right, result.data(), m, n, k);
+        return result;
+    }
+
+    /**
+     * @brief Get the number of singular values kept from a decomposition.
+     *
+     * Numerically zero singular values are always discarded, at least one
+     * is kept, and the discarded weight is added to the truncation error.
+     *
+     * @param s Singular values in descending order. Kept values are
+     * rescaled so that their squares sum to the total.
+     * @param apply_thresholds Whether to apply the truncation thresholds.
+     */
+    auto truncate(std::vector<PrecisionT> &s, bool apply_thresholds)
+        -> size_t {
+        const PrecisionT total = std::accumulate(
+            s.begin(), s.end(), PrecisionT{0},
+            [](PrecisionT acc, PrecisionT val) { return acc + val * val; });
+        const PrecisionT zero = std::numeric_limits<PrecisionT>::epsilon() *
+                                (s.empty() ? PrecisionT{0} : s[0]);
+        size_t kept = s.size();
+        PrecisionT discarded = 0;
+        while (kept > 1) {
+            const PrecisionT weight = s[kept - 1] * s[kept - 1];
+            const bool over_budget =
+                (max_bond_dim_ > 0 && kept > max_bond_dim_) ||
+                discarded + weight <= cutoff_ * total;
+            const bool drop =
+                s[kept - 1] <= zero || (apply_thresholds && over_budget);
+            if (!drop) {
+                break;
+            }
+            discarded += weight;
+            kept--;
+        }
+        if (discarded > 0 && total > 0) {
+            truncation_error_ += discarded / total;
+            const PrecisionT scale = std::sqrt(total / (total - discarded));
+            for (size_t idx = 0; idx < kept; idx++) {
+                s[idx] *= scale;
+            }
+        }
+        return kept;
+    }
+
+    /**
+     * @brief Make the site left-orthonormal and move the orthogonality
+     * center to the next site.
+     */
+    void moveCenterRight(size_t site) {
+        const size_t chi_l = bond_dims_[site];
+        const size_t chi_r = bond_dims_[site + 1];
+        auto res = Util::svd(tensors_[site].data(), 2 * chi_l, chi_r);
+        const size_t rank = res.s.size();
+        const size_t kept = truncate(res.s, false);
+
+        std::vector<ComplexPrecisionT> left(2 * chi_l * kept);
+        for (size_t row = 0; row < 2 * chi_l; row++) {
+            std::copy_n(res.u.data() + row * rank, kept,
+                        left.data() + row * kept);
+        }
+        // S V^\dagger (kept x chi_r)
+        std::vector<ComplexPrecisionT> svh(kept * chi_r);
+        for (size_t row = 0; row < kept; row++) {
+            for (size_t col = 0; col < chi_r; col++) {
+                svh[row * chi_r + col] =
+                    res.s[row] * res.vh[row * chi_r + col];
+            }
+        }
+        tensors_[site] = std::move(left);
+        tensors_[site + 1] =
+            matMul(svh.data(), tensors_[site + 1].data(), kept,
+                   2 * bond_dims_[site + 2], chi_r);
+        bond_dims_[site + 1] = kept;
+    }
+
+    /**
+     * @brief Make the site right-orthonormal and move the orthogonality
+     * center to the previous site.
+     */
+    void moveCenterLeft(size_t site) {
+        const size_t chi_l = bond_dims_[site];
+        const size_t chi_r = bond_dims_[site + 1];
+        auto res = Util::svd(tensors_[site].data(), chi_l, 2 * chi_r);
+        const size_t rank = res.s.size();
+        const size_t kept = truncate(res.s, false);
+
+        // U S (chi_l x kept)
+        std::vector<ComplexPrecisionT> us(chi_l * kept);
+        for (size_t row = 0; row < chi_l; row++) {
+            for (size_t col = 0; col < kept; col++) {
+                us[row * kept + col] = res.u[row * rank + col] * res.s[col];
+            }
+        }
+        res.vh.resize(kept * 2 * chi_r);
+        tensors_[site] = std::move(res.vh);
+        tensors_[site - 1] = matMul(tensors_[site - 1].data(), us.data(),
+                                    2 * bond_dims_[site - 1], kept, chi_l);
+        bond_dims_[site] = kept;
+    }
+
+    /**
+     * @brief Move the orthogonality center to the given site.
+     */
+    void moveCenter(size_t site) {
+        for (; center_ < site; center_++) {
+            moveCenterRight(center_);
+        }
+        for (; center_ > site; center_--) {
+            moveCenterLeft(center_);
+        }
+    }
+
+    /**
+     * @brief Apply a matrix to consecutive sites.
+     *
+     * @param matrix Row-major matrix with the first site as the most
+     * significant bit.
+     * @param first First site.
+     * @param num_sites Number of sites.
+     */
+    void applyToSites(const ComplexPrecisionT *matrix, size_t first,
+                      size_t num_sites) {
+        moveCenter(first);
+
+        // Contract the sites into theta of shape (chi_l, 2^num_sites, chi_r)
+        const size_t chi_l = bond_dims_[first];
+        std::vector<ComplexPrecisionT> theta = tensors_[first];
+        for (size_t k = 1; k < num_sites; k++) {
+            const size_t site = first + k;
+            theta = matMul(theta.data(), tensors_[site].data(),
+                           chi_l * Util::exp2(k), 2 * bond_dims_[site + 1],
+                           bond_dims_[site]);
+        }
+        const size_t dim = Util::exp2(num_sites);
+        const size_t chi_r = bond_dims_[first + num_sites];
+        for (size_t l = 0; l < chi_l; l++) {
+            ComplexPrecisionT *block = theta.data() + l * dim * chi_r;
+            const auto applied = matMul(matrix, block, dim, chi_r, dim);
+            std::copy(applied.begin(), applied.end(), block);
+        }
+
+        // Split theta from the left, moving the center along
+        size_t chi = chi_l;
+        for (size_t k = 0; k + 1 < num_sites; k++) {
+            const size_t cols = Util::exp2(num_sites - 1 - k) * chi_r;
+            auto res = Util::svd(theta.data(), 2 * chi, cols);
+            const size_t rank = res.s.size();
+            const size_t kept = truncate(res.s, true);
+
+            std::vector<ComplexPrecisionT> left(2 * chi * kept);
+            for (size_t row = 0; row < 2 * chi; row++) {
+                std::copy_n(res.u.data() + row * rank, kept,
+                            left.data() + row * kept);
+            }
+            tensors_[first + k] = std::move(left);
+            theta.resize(kept * cols);
+            for (size_t row = 0; row < kept; row++) {
+                for (size_t col = 0; col < cols; col++) {
+                    theta[row * cols + col] =
+                        res.s[row] * res.vh[row * cols + col];
+                }
+            }
+            bond_dims_[first + k + 1] = kept;
+            chi = kept;
+        }
+        tensors_[first + num_sites - 1] = std::move(theta);
+        center_ = first + num_sites - 1;
+    }
+
+    /**
+     * @brief Apply a matrix to the given sorted wires.
+     *
+     * The wires are made adjacent to the first one by SWAP gates, which are
+     * undone after applying the matrix.
+     */
+    void applyToSortedWires(const ComplexPrecisionT *matrix,
+                            const std::vector<size_t> &wires) {
+        // clang-format off
+        static const std::vector<ComplexPrecisionT> swap_matrix{
+            1, 0, 0, 0,
+            0, 0, 1, 0,
+            0, 1, 0, 0,
+            0, 0, 0, 1};
+        // clang-format on
+        std::vector<size_t> swaps;
+        for (size_t k = 1; k < wires.size(); k++) {
+            for (size_t site = wires[k]; site > wires[0] + k; site--) {
+                applyToSites(swap_matrix.data(), site - 1, 2);
+                swaps.push_back(site - 1);
+            }
+        }
+        applyToSites(matrix, wires[0], wires.size());
+        for (auto iter = swaps.rbegin(); iter != swaps.rend(); ++iter) {
+            applyToSites(swap_matrix.data(), *iter, 2);
+        }
+    }
+
+    /**
+     * @brief Contract @f$\langle\psi|\phi\rangle@f$, where @f$\psi@f$ is
+     * this state, restricted to the basis states whose bits of the given
+     * sites equal the given outcome.
+     *
+     * @param other State @f$\phi@f$.
+     * @param sites Sorted sites to restrict.
+     * @param outcome Bits of the sites, with the first site as the most
+     * significant bit.
+     */
+    [[nodiscard]] auto contract(const MatrixProductState &other,
+                                const std::vector<size_t> &sites,
+                                size_t outcome) const -> ComplexPrecisionT {
+        // Environment of shape (chi of this, chi of other)
+        std::vector<ComplexPrecisionT> env{{1, 0}};
+        size_t fixed = 0;
+        for (size_t site = 0; site < num_qubits_; site++) {
+            const size_t chi_l = bond_dims_[site];
+            const size_t chi_r = bond_dims_[site + 1];
+            const size_t other_l = other.bond_dims_[site];
+            const size_t other_r = other.bond_dims_[site + 1];
+
+            // (chi_l, 2, other_r)
+            auto half = matMul(env.data(), other.tensors_[site].data(), chi_l,
+                               2 * other_r, other_l);
+            if (fixed < sites.size() && sites[fixed] == site) {
+                const size_t bit =
+                    (outcome >> (sites.size() - 1 - fixed)) & 1U;
+                for (size_t l = 0; l < chi_l; l++) {
+                    std::fill_n(half.data() + (2 * l + 1 - bit) * other_r,
+                                other_r, ComplexPrecisionT{0, 0});
+                }
+                fixed++;
+            }
+            // Adjoint of this tensor, (chi_r, chi_l * 2)
+            const auto &tensor = tensors_[site];
+            std::vector<ComplexPrecisionT> adjoint(chi_r * 2 * chi_l);
+            for (size_t row = 0; row < 2 * chi_l; row++) {
+                for (size_t col = 0; col < chi_r; col++) {
+                    adjoint[col * 2 * chi_l + row] =
+                        std::conj(tensor[row * chi_r + col]);
+                }
+            }
+            env = matMul(adjoint.data(), half.data(), chi_r, other_r,
+                         2 * chi_l);
+        }
+        return env[0];
+    }
+
+    /**
+     * @brief Get the matrix acting on the sorted wires equal to a matrix
+     * acting on the given wires.
+     */
+    static auto sortWires(const ComplexPrecisionT *matrix,
+                          const std::vector<size_t> &wires, bool inverse)
+        -> std::pair<std::vector<ComplexPrecisionT>, std::vector<size_t>> {
+        const size_t num_wires = wires.size();
+        const size_t dim = Util::exp2(num_wires);
+        std::vector<size_t> sorted = wires;
+        std::sort(sorted.begin(), sorted.end());
+        PL_ABORT_IF(std::adjacent_find(sorted.begin(), sorted.end()) !=
+                        sorted.end(),
+                    "Wires must be distinct.");
+
+        // Bit of each basis index of the given wires in the sorted order
+        std::vector<size_t> perm(dim, 0);
+        for (size_t idx = 0; idx < dim; idx++) {
+            for (size_t k = 0; k < num_wires; k++) {
+                const size_t pos = static_cast<size_t>(
+                    std::lower_bound(sorted.begin(), sorted.end(), wires[k]) -
+                    sorted.begin());
+                const size_t bit = (idx >> (num_wires - 1 - k)) & 1U;
+                perm[idx] |= bit << (num_wires - 1 - pos);
+            }
+        }
+        std::vector<ComplexPrecisionT> result(dim * dim);
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                result[perm[row] * dim + perm[col]] =
+                    inverse ? std::conj(matrix[col * dim + row])
+                            : matrix[row * dim + col];
+            }
+        }
+        return {result, sorted};
+    }
+
+  public:
+    /**
+     * @brief Construct the state @f$|0\cdots 0\rangle@f$.
+     *
+     * @param num_qubits Number of qubits.
+     * @param max_bond_dim Maximum bond dimension, or 0 for no limit.
+     * @param cutoff Maximum discarded weight of each truncation.
+     */
+    explicit MatrixProductState(size_t num_qubits, size_t max_bond_dim = 0,
+                                PrecisionT cutoff = 0)
+        : num_qubits_{num_qubits}, max_bond_dim_{max_bond_dim},
+          cutoff_{cutoff} {
+        PL_ABORT_IF(num_qubits == 0, "The number of qubits must be positive.");
+        PL_ABORT_IF(cutoff < 0, "The cutoff must not be negative.");
+        resetState();
+    }
+
+    /**
+     * @brief Reset the state to @f$|0\cdots 0\rangle@f$ and the truncation
+     * error to zero.
+     */
+    void resetState() {
+        tensors_.assign(num_qubits_,
+                        std::vector<ComplexPrecisionT>{{1, 0}, {0, 0}});
+        bond_dims_.assign(num_qubits_ + 1, 1);
+        center_ = 0;
+        truncation_error_ = 0;
+    }
+
+    /**
+     * @brief Get the number of qubits.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Set the maximum bond dimension, or 0 for no limit.
+     */
+    void setMaxBondDim(size_t max_bond_dim) { max_bond_dim_ = max_bond_dim; }
+
+    /**
+     * @brief Get the maximum bond dimension, or 0 for no limit.
+     */
+    [[nodiscard]] auto getMaxBondDim() const -> size_t {
+        return max_bond_dim_;
+    }
+
+    /**
+     * @brief Set the maximum discarded weight of each truncation.
+     */
+    void setCutoff(PrecisionT cutoff) {
+        PL_ABORT_IF(cutoff < 0, "The cutoff must not be negative.");
+        cutoff_ = cutoff;
+    }
+
+    /**
+     * @brief Get the maximum discarded weight of each truncation.
+     */
+    [[nodiscard]] auto getCutoff() const -> PrecisionT { return cutoff_; }
+
+    /**
+     * @brief Get the sum of the discarded weights of all truncations, which
+     * approximates the infidelity of the state to first order.
+     */
+    [[nodiscard]] auto getTruncationError() const -> PrecisionT {
+        return truncation_error_;
+    }
+
+    /**
+     * @brief Get the dimension of the bond between each pair of adjacent
+     * sites.
+     */
+    [[nodiscard]] auto getBondDims() const -> std::vector<size_t> {
+        return {bond_dims_.begin() + 1, bond_dims_.end() - 1};
+    }
+
+    /**
+     * @brief Compute the full statevector, with wire 0 as the most
+     * significant bit.
+     *
+     * Intended for testing and small states, as the statevector has
+     * @f$2^n@f$ amplitudes.
+     */
+    [[nodiscard]] auto getFullState() const -> std::vector<ComplexPrecisionT> {
+        std::vector<ComplexPrecisionT> state = tensors_[0];
+        for (size_t site = 1; site < num_qubits_; site++) {
+            state = matMul(state.data(), tensors_[site].data(),
+                           Util::exp2(site), 2 * bond_dims_[site + 1],
+                           bond_dims_[site]);
+        }
+        return state;
+    }
+
+    /**
+     * @brief Apply a single gate, acting on at most Gates::max_fused_wires
+     * wires, to the state.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+        }
+        Gates::FusedGateBlock block{{0}, wires};
+        std::sort(block.wires.begin(), block.wires.end());
+        const auto matrix = Gates::getFusedMatrix<PrecisionT>(
+            block, {opName}, {wires}, {inverse}, {params});
+        applyToSortedWires(matrix.data(), block.wires);
+    }
+
+    /**
+     * @brief Apply multiple gates to the state.
+     *
+     * @param ops Vector of gate names to be applied in order.
+     * @param ops_wires Vector of wires on which to apply index-matched gate
+     * name.
+     * @param ops_inverse Indicates whether gate at matched index is to be
+     * inverted.
+     * @param ops_params Parameter data for index matched gates.
+     */
+    void
+    applyOperations(const std::vector<std::string> &ops,
+                    const std::vector<std::vector<size_t>> &ops_wires,
+                    const std::vector<bool> &ops_inverse,
+                    const std::vector<std::vector<PrecisionT>> &ops_params) {
+        PL_ABORT_IF(ops.size() != ops_wires.size() ||
+                        ops.size() != ops_inverse.size() ||
+                        ops.size() != ops_params.size(),
+                    "Invalid arguments: number of operations, wires, "
+                    "inverses, and parameters must all be equal");
+        for (size_t i = 0; i < ops.size(); i++) {
+            applyOperation(ops[i], ops_wires[i], ops_inverse[i], ops_params[i]);
+        }
+    }
+
+    /**
+     * @brief Apply a matrix to the state.
+     *
+     * The matrix need not be unitary, but truncation renormalizes the
+     * state.
+     *
+     * @param matrix Row-major matrix of size `2^wires.size()`.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyMatrix(const std::vector<ComplexPrecisionT> &matrix,
+                     const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        PL_ABORT_IF(matrix.size() != Util::exp2(2 * wires.size()),
+                    "The size of matrix does not match with the given "
+                    "number of wires");
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+        }
+        const auto [sorted_matrix, sorted_wires] =
+            sortWires(matrix.data(), wires, inverse);
+        applyToSortedWires(sorted_matrix.data(), sorted_wires);
+    }
+
+    /**
+     * @brief Compute @f$\langle \psi | \phi \rangle@f$, where @f$\psi@f$ is
+     * this state.
+     *
+     * @param other State @f$\phi@f$.
+     */
+    [[nodiscard]] auto innerProd(const MatrixProductState &other) const
+        -> ComplexPrecisionT {
+        PL_ABORT_IF(other.num_qubits_ != num_qubits_,
+                    "The states have different numbers of qubits.");
+        return contract(other, {}, 0);
+    }
+
+    /**
+     * @brief Compute the squared norm of the state.
+     */
+    [[nodiscard]] auto getNorm2() const -> PrecisionT {
+        return std::real(innerProd(*this));
+    }
+
+    /**
+     * @brief Expected value of a gate observable.
+     *
+     * @param opName Name of the observable.
+     * @param wires Wires the observable acts on.
+     * @param params Parameters of the observable.
+     */
+    [[nodiscard]] auto expval(const std::string &opName,
+                              const std::vector<size_t> &wires,
+                              const std::vector<PrecisionT> &params = {}) const
+        -> PrecisionT {
+        MatrixProductState applied(*this);
+        applied.setMaxBondDim(0);
+        applied.setCutoff(0);
+        applied.applyOperation(opName, wires, false, params);
+        return std::real(innerProd(applied));
+    }
+
+    /**
+     * @brief Expected value of a Hermitian matrix observable.
+     *
+     * @param matrix Row-major matrix of size `2^wires.size()`.
+     * @param wires Wires the observable acts on.
+     */
+    [[nodiscard]] auto expval(const std::vector<ComplexPrecisionT> &matrix,
+                              const std::vector<size_t> &wires) const
+        -> PrecisionT {
+        MatrixProductState applied(*this);
+        applied.setMaxBondDim(0);
+        applied.setCutoff(0);
+        applied.applyMatrix(matrix, wires);
+        return std::real(innerProd(applied));
+    }
+
+    /**
+     * @brief Variance of a gate observable.
+     *
+     * @param opName Name of the observable.
+     * @param wires Wires the observable acts on.
+     * @param params Parameters of the observable.
+     */
+    [[nodiscard]] auto var(const std::string &opName,
+                           const std::vector<size_t> &wires,
+                           const std::vector<PrecisionT> &params = {}) const
+        -> PrecisionT {
+        MatrixProductState applied(*this);
+        applied.setMaxBondDim(0);
+        applied.setCutoff(0);
+        applied.applyOperation(opName, wires, false, params);
+        const PrecisionT mean = std::real(innerProd(applied));
+        return applied.getNorm2() - mean * mean;
+    }
+
+    /**
+     * @brief Probabilities of the computational basis states of the given
+     * wires, with the first wire as the most significant bit.
+     *
+     * Each probability is a contraction of the state with itself, so the
+     * cost grows as @f$2^{|\text{wires}|}@f$.
+     *
+     * @param wires Wires to measure.
+     */
+    [[nodiscard]] auto probs(const std::vector<size_t> &wires) const
+        -> std::vector<PrecisionT> {
+        const size_t num_wires = wires.size();
+        std::vector<size_t> sorted = wires;
+        std::sort(sorted.begin(), sorted.end());
+        PL_ABORT_IF(std::adjacent_find(sorted.begin(), sorted.end()) !=
+                        sorted.end(),
+                    "Wires must be distinct.");
+        PL_ABORT_IF(!sorted.empty() && sorted.back() >= num_qubits_,
+                    "Invalid wire index.");
+
+        std::vector<PrecisionT> result(Util::exp2(num_wires));
+        for (size_t outcome = 0; outcome < result.size(); outcome++) {
+            // Bits of the outcome in the sorted order
+            size_t sorted_outcome = 0;
+            for (size_t k = 0; k < num_wires; k++) {
+                const size_t pos = static_cast<size_t>(
+                    std::lower_bound(sorted.begin(), sorted.end(), wires[k]) -
+                    sorted.begin());
+                const size_t bit = (outcome >> (num_wires - 1 - k)) & 1U;
+                sorted_outcome |= bit << (num_wires - 1 - pos);
+            }
+            result[outcome] =
+                std::real(contract(*this, sorted, sorted_outcome));
+        }
+        return result;
+    }
+};
+} // namespace Pennylane
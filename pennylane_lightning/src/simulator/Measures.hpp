@@ -21,17 +21,34 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
 #include <complex>
+#include <cstdint>
 #include <cstdio>
+#include <map>
+#include <numeric>
+#include <optional>
 #include <random>
-#include <stack>
-#include <unordered_map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
-#include "Kokkos_Sparse.hpp"
+#include "GateFusion.hpp"
 #include "LinearAlgebra.hpp"
+#include "MeasuresKernels.hpp"
+#include "PauliSum.hpp"
+#include "Philox.hpp"
+#include "SparseHamiltonian.hpp"
+#include "SparseLinearAlgebra.hpp"
 #include "StateVectorManagedCPU.hpp"
 #include "StateVectorRawCPU.hpp"
+#include "Trace.hpp"
+#include "TypeTraits.hpp"
+#include "cpu_kernels/GateImplementationsLM.hpp"
 
 namespace Pennylane {
 
@@ -40,7 +57,9 @@ namespace Pennylane {
  *
  * This class performs measurements in the state vector provided to its
  * constructor. Observables are defined by its operator(matrix) or through a
- * string-based function dispatch.
+ * string-based function dispatch. Wires relabelled by lazy SWAP gates are
+ * translated to the physical wires of the data, so the statevector need not
+ * be canonicalized, but pending operations must be flushed.
  *
  * @tparam fp_t Floating point precision of underlying measurements.
  * @tparam SVType type of the statevector to be measured.
@@ -51,117 +70,1191 @@ class Measures {
     const SVType &original_statevector;
     using CFP_t = std::complex<fp_t>;
 
-  public:
-    explicit Measures(const SVType &provided_statevector)
-        : original_statevector{provided_statevector} {};
+    bool use_cache_{false};
+    size_t cache_version_{0};
+    std::vector<size_t> cache_wire_map_;
+    std::vector<fp_t> probs_cache_;
+    std::vector<double> cdf_cache_;
+    std::map<std::vector<size_t>, std::vector<fp_t>> marginal_cache_;
+    std::map<std::vector<size_t>, std::vector<double>> marginal_cdf_cache_;
+    Util::BufferPool *buffer_pool_{&Util::BufferPool::global()};
+    ThreadingConfig threading_config_;
 
     /**
-     * @brief Probabilities of each computational basis state.
+     * @brief Apply the threading configuration until the returned scope is
+     * destroyed.
+     */
+    [[nodiscard]] auto threadingScope() const -> ThreadingScope {
+        return {threading_config_, original_statevector.getNumQubits()};
+    }
+
+    /**
+     * @brief Drop cached values if the statevector has been modified or its
+     * wires have been relabelled since they were computed.
+     */
+    void refreshCache() {
+        auto wire_map = original_statevector.getWireMap();
+        if (cache_version_ != original_statevector.getVersion() ||
+            cache_wire_map_ != wire_map) {
+            probs_cache_.clear();
+            cdf_cache_.clear();
+            marginal_cache_.clear();
+            marginal_cdf_cache_.clear();
+            cache_version_ = original_statevector.getVersion();
+            cache_wire_map_ = std::move(wire_map);
+        }
+    }
+
+    /**
+     * @brief Get the data of the statevector in the physical order of its
+     * wire map (see StateVectorBase::getWireMap()).
+     */
+    [[nodiscard]] auto getStateData() const -> const CFP_t * {
+        PL_ABORT_IF(original_statevector.hasPendingOperations(),
+                    "The statevector has pending operations. Call "
+                    "flushOperations() before measuring it.");
+        return original_statevector.getPhysicalData();
+    }
+
+    /**
+     * @brief Get all wires in ascending order.
+     */
+    [[nodiscard]] auto allWires() const -> std::vector<size_t> {
+        std::vector<size_t> wires(original_statevector.getNumQubits());
+        std::iota(wires.begin(), wires.end(), size_t{0});
+        return wires;
+    }
+
+    /**
+     * @brief Translate wires to the physical wires of the data holding them.
      *
-     * @return Floating point std::vector with probabilities
-     * in lexicographic order.
+     * Invalid wires are kept as they are, to be reported by the kernels.
      */
-    std::vector<fp_t> probs() {
-        const CFP_t *arr_data = original_statevector.getData();
+    [[nodiscard]] auto physicalWires(const std::vector<size_t> &wires) const
+        -> std::vector<size_t> {
+        if (!original_statevector.hasWireMap()) {
+            return wires;
+        }
+        const auto wire_map = original_statevector.getWireMap();
+        std::vector<size_t> physical(wires);
+        for (auto &wire : physical) {
+            if (wire < wire_map.size()) {
+                wire = wire_map[wire];
+            }
+        }
+        return physical;
+    }
+
+    [[nodiscard]] auto
+    physicalWires(const std::vector<std::vector<size_t>> &wires_list) const
+        -> std::vector<std::vector<size_t>> {
+        std::vector<std::vector<size_t>> physical;
+        physical.reserve(wires_list.size());
+        for (const auto &wires : wires_list) {
+            physical.emplace_back(physicalWires(wires));
+        }
+        return physical;
+    }
+
+    /**
+     * @brief Translate a mask of wires, with wire 0 as the most significant
+     * bit, to the mask of the physical wires of the data holding them.
+     */
+    [[nodiscard]] auto physicalMask(size_t mask) const -> size_t {
+        if (!original_statevector.hasWireMap()) {
+            return mask;
+        }
+        const size_t num_qubits = original_statevector.getNumQubits();
+        const auto wire_map = original_statevector.getWireMap();
+        size_t physical = 0;
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            if (((mask >> (num_qubits - 1 - wire)) & 1U) != 0) {
+                physical |= size_t{1U} << (num_qubits - 1 - wire_map[wire]);
+            }
+        }
+        return physical;
+    }
+
+    /**
+     * @brief Copy the data of the statevector, in its physical order, to a
+     * statevector taken from the buffer pool.
+     */
+    auto copyState() const -> StateVectorManagedCPU<fp_t> {
+        const Threading threading = original_statevector.threading();
+        StateVectorManagedCPU<fp_t> copy(
+            getStateData(), original_statevector.getLength(), threading,
+            original_statevector.memoryModel(), bestNUMAPolicy(threading),
+            Util::HugePagePolicy::Disabled, buffer_pool_);
+        copy.setThreadingConfig(original_statevector.getThreadingConfig());
+        return copy;
+    }
+
+    /**
+     * @brief Compute the cumulative distribution of the basis states of data
+     * held in the physical order of the statevector, indexed by the basis
+     * states of the logical wires.
+     *
+     * @param data Data of the statevector or of a copy.
+     */
+    auto computeCDF(const CFP_t *data) const -> std::vector<double> {
+        const size_t num_qubits = original_statevector.getNumQubits();
+        if (!original_statevector.hasWireMap()) {
+            return MeasuresKernels::cumulativeProbs(data, num_qubits);
+        }
+        auto cdf = MeasuresKernels::marginalProbs(data, num_qubits,
+                                                  physicalWires(allWires()));
+        std::partial_sum(cdf.begin(), cdf.end(), cdf.begin());
+        return cdf;
+    }
+
+    /**
+     * @brief Call func with the cumulative distribution of the statevector,
+     * which is taken from the cache if enabled.
+     *
+     * @param func Function taking `const std::vector<double> &`.
+     */
+    template <class Func> auto withCDF(Func &&func) {
+        if (!use_cache_) {
+            return func(computeCDF(getStateData()));
+        }
+        refreshCache();
+        if (cdf_cache_.empty()) {
+            cdf_cache_ = computeCDF(getStateData());
+        }
+        return func(cdf_cache_);
+    }
+
+    /**
+     * @brief Call func with the cumulative marginal distribution of the
+     * wires, which is taken from the cache if enabled.
+     *
+     * @param wires Wires. wires[0] corresponds to the most significant bit.
+     * @param func Function taking `const std::vector<double> &`.
+     */
+    template <class Func>
+    auto withMarginalCDF(const std::vector<size_t> &wires, Func &&func) {
+        const auto compute = [this, &wires]() {
+            auto cdf = MeasuresKernels::marginalProbs(
+                getStateData(), original_statevector.getNumQubits(),
+                physicalWires(wires));
+            std::partial_sum(cdf.begin(), cdf.end(), cdf.begin());
+            return cdf;
+        };
+        if (!use_cache_) {
+            return func(compute());
+        }
+        refreshCache();
+        auto iter = marginal_cdf_cache_.find(wires);
+        if (iter == marginal_cdf_cache_.end()) {
+            iter = marginal_cdf_cache_.emplace(wires, compute()).first;
+        }
+        return func(iter->second);
+    }
+
+    /**
+     * @brief Compute probabilities of each computational basis state.
+     *
+     * @see probs()
+     */
+    auto computeProbs() -> std::vector<fp_t> {
+        if (original_statevector.hasWireMap()) {
+            // The marginal of all wires, in the order of the logical wires
+            return computeProbs(allWires());
+        }
+        PL_TRACE_SCOPE("probs", "measures");
+        const CFP_t *arr_data = getStateData();
         std::vector<fp_t> basis_probs(original_statevector.getLength(), 0);
 
         std::transform(arr_data, arr_data + original_statevector.getLength(),
                        basis_probs.begin(),
                        [](const CFP_t &z) -> fp_t { return std::norm(z); });
         return basis_probs;
-    };
+    }
 
     /**
-     * @brief Probabilities for a subset of the full system.
+     * @brief Compute probabilities for a subset of the full system.
      *
-     * @param wires Wires will restrict probabilities to a subset
-     * of the full system.
-     * @return Floating point std::vector with probabilities.
-     * The basis columns are rearranged according to wires.
+     * @see probs(const std::vector<size_t> &)
      */
-    std::vector<fp_t> probs(const std::vector<size_t> &wires) {
-        // Determining index that would sort the vector.
-        // This information is needed later.
+    auto computeProbs(const std::vector<size_t> &wires) -> std::vector<fp_t> {
+        PL_TRACE_SCOPE("probs", "measures");
+        const CFP_t *arr_data = getStateData();
+        const size_t num_qubits = original_statevector.getNumQubits();
+        const size_t length = original_statevector.getLength();
+        const size_t num_wires = wires.size();
+
+        PL_ABORT_IF(num_wires > num_qubits,
+                    "The number of wires must not exceed the number of "
+                    "qubits.");
+
+        // Determine the bit position in the statevector index of each bit of
+        // the output index. The output is ordered as the probabilities for the
+        // sorted wires transposed by Util::transpose_state_tensor with the
+        // indices that sort the wires. The order follows the logical wires,
+        // which are then translated to the physical wires of the data.
         const auto sorted_ind_wires = Util::sorting_indices(wires);
-        // Sorting wires.
-        std::vector<size_t> sorted_wires(wires.size());
-        for (size_t pos = 0; pos < wires.size(); pos++) {
+        std::vector<size_t> sorted_wires(num_wires);
+        for (size_t pos = 0; pos < num_wires; pos++) {
             sorted_wires[pos] = wires[sorted_ind_wires[pos]];
+            PL_ABORT_IF(sorted_wires[pos] >= num_qubits, "Invalid wire index.");
+        }
+        const auto sorted_physical_wires = physicalWires(sorted_wires);
+        // rev_wires[k] is the bit position for the k-th output bit counted
+        // from the most significant one.
+        std::vector<size_t> rev_wires(num_wires);
+        for (size_t j = 0; j < num_wires; j++) {
+            rev_wires[num_wires - 1 - sorted_ind_wires[j]] =
+                num_qubits - 1 - sorted_physical_wires[num_wires - 1 - j];
+        }
+
+        using AccT = Util::accumulator_t<fp_t>;
+        std::vector<AccT> probabilities(Util::exp2(num_wires), 0);
+
+        // Each thread accumulates a partial histogram over a contiguous chunk
+        // of the statevector, which is merged at the end. The output index is
+        // computed directly in the final order, so no index vector or
+        // transposition is required.
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel default(none) \
+                shared(arr_data, length, num_wires, rev_wires, probabilities)
+        #endif
+        // clang-format on
+        {
+            PL_TRACE_SCOPE("probs (thread)", "measures");
+            std::vector<AccT> local_probs(probabilities.size(), 0);
+
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp for schedule(static) nowait
+            #endif
+            // clang-format on
+            for (size_t idx = 0; idx < length; idx++) {
+                size_t out_idx = 0;
+                for (size_t k = 0; k < num_wires; k++) {
+                    out_idx = (out_idx << 1U) | ((idx >> rev_wires[k]) & 1U);
+                }
+                local_probs[out_idx] += std::norm(arr_data[idx]);
+            }
+
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp critical
+            #endif
+            // clang-format on
+            {
+                for (size_t k = 0; k < probabilities.size(); k++) {
+                    probabilities[k] += local_probs[k];
+                }
+            }
+        }
+        return {probabilities.begin(), probabilities.end()};
+    }
+
+    /**
+     * @brief Number of qubits not measured below which packed samples are
+     * drawn from the full distribution instead of the marginal one.
+     */
+    constexpr static size_t min_marginal_qubits = 12;
+
+    /**
+     * @brief Draw indices from a cumulative distribution by inverse transform
+     * sampling.
+     *
+     * Random numbers are drawn from a Philox4x32 generator keyed by `seed`
+     * with one counter per pair of samples, so the result only depends on
+     * the seed and not on the number of threads.
+     *
+     * @param cdf Cumulative distribution. Need not be normalized.
+     * @param num_samples The number of samples to generate.
+     * @param seed Seed of the random number generator.
+     */
+    static auto sampleFromCDF(const std::vector<double> &cdf,
+                              size_t num_samples, uint64_t seed)
+        -> std::vector<size_t> {
+        PL_TRACE_SCOPE("sample_from_cdf", "measures");
+        const size_t length = cdf.size();
+        const double total = cdf.back();
+        const Util::Philox4x32 rng(seed);
+
+        std::vector<size_t> indices(num_samples);
+        const size_t num_pairs = (num_samples + 1) / 2;
+
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t pair = 0; pair < num_pairs; pair++) {
+            const auto uniforms = rng.uniform2(pair);
+            const size_t end = std::min(2 * pair + 2, num_samples);
+            for (size_t i = 2 * pair; i < end; i++) {
+                const double u = uniforms[i - 2 * pair] * total;
+                indices[i] = std::min(
+                    static_cast<size_t>(
+                        std::upper_bound(cdf.begin(), cdf.end(), u) -
+                        cdf.begin()),
+                    length - 1);
+            }
+        }
+        return indices;
+    }
+
+    /**
+     * @brief Draw a histogram of samples from a cumulative distribution.
+     *
+     * @see generate_counts
+     */
+    static auto countsFromCDF(const std::vector<double> &cdf,
+                              size_t num_samples, uint64_t seed)
+        -> std::vector<std::pair<size_t, size_t>> {
+        std::mt19937_64 generator(seed);
+
+        // Probability mass of basis states in [begin, end)
+        const auto mass = [&cdf](size_t begin, size_t end) {
+            return cdf[end - 1] - ((begin == 0) ? 0.0 : cdf[begin - 1]);
+        };
+
+        struct Range {
+            size_t begin;
+            size_t end;
+            size_t count;
+        };
+        std::vector<std::pair<size_t, size_t>> counts;
+        std::vector<Range> ranges{{0, cdf.size(), num_samples}};
+        while (!ranges.empty()) {
+            const Range range = ranges.back();
+            ranges.pop_back();
+            if (range.count == 0) {
+                continue;
+            }
+            if (range.end - range.begin == 1) {
+                counts.emplace_back(range.begin, range.count);
+                continue;
+            }
+            const size_t mid = range.begin + (range.end - range.begin) / 2;
+            const double total = mass(range.begin, range.end);
+            const double p_left =
+                (total > 0.0)
+                    ? std::clamp(mass(range.begin, mid) / total, 0.0, 1.0)
+                    : 0.5;
+            std::binomial_distribution<size_t> distribution(range.count,
+                                                            p_left);
+            const size_t count_left = distribution(generator);
+            // Push the right half first so that the left half is visited
+            // first and the indices come out sorted.
+            ranges.push_back({mid, range.end, range.count - count_left});
+            ranges.push_back({range.begin, mid, count_left});
+        }
+        return counts;
+    }
+
+    /**
+     * @brief Get the character of a single-qubit Pauli observable.
+     *
+     * @param operation String with the operator name.
+     * @return 'I', 'X', 'Y', or 'Z', or '\0' if the operation is not a Pauli
+     * observable.
+     */
+    static auto pauliChar(const std::string &operation) -> char {
+        if (operation == "Identity") {
+            return 'I';
+        }
+        if (operation == "PauliX") {
+            return 'X';
+        }
+        if (operation == "PauliY") {
+            return 'Y';
+        }
+        if (operation == "PauliZ") {
+            return 'Z';
+        }
+        return '\0';
+    }
+
+    /**
+     * @brief Compute the expected values of several Pauli words.
+     *
+     * Words are grouped by their bit flip mask, and each group is evaluated
+     * in a single read-only pass over the statevector. In particular, all
+     * words consisting of 'I' and 'Z' only are evaluated in one pass.
+     *
+     * @param pauli_words Pauli words consisting of 'I', 'X', 'Y', and 'Z'.
+     * @param wires_list Wires each character of the corresponding word acts
+     * on.
+     * @param with_norm Whether to also compute the squared norm of the
+     * statevector, which is appended to the result. It is accumulated in the
+     * same pass as the diagonal words.
+     */
+    auto pauliWordsMoments(const std::vector<std::string> &pauli_words,
+                           const std::vector<std::vector<size_t>> &wires_list,
+                           bool with_norm) -> std::vector<fp_t> {
+        PL_ABORT_IF(
+            (pauli_words.size() != wires_list.size()),
+            "The lengths of the list of Pauli words and wires do not match.");
+        const CFP_t *arr_data = getStateData();
+        const size_t num_qubits = original_statevector.getNumQubits();
+        const size_t num_words = pauli_words.size();
+
+        std::vector<MeasuresKernels::PauliWordMasks> masks;
+        masks.reserve(num_words);
+        // Indices of the words sharing each bit flip mask
+        std::map<size_t, std::vector<size_t>> groups;
+        for (size_t w = 0; w < num_words; w++) {
+            masks.emplace_back(MeasuresKernels::getPauliWordMasks(
+                pauli_words[w], physicalWires(wires_list[w]), num_qubits));
+            groups[masks.back().x_mask].emplace_back(w);
+        }
+        if (with_norm) {
+            // The identity is represented by index num_words
+            groups[0].emplace_back(num_words);
+            masks.emplace_back();
+        }
+
+        std::vector<fp_t> res(masks.size());
+        for (const auto &[x_mask, indices] : groups) {
+            std::vector<size_t> z_masks;
+            z_masks.reserve(indices.size());
+            for (const size_t w : indices) {
+                z_masks.emplace_back(masks[w].z_mask);
+            }
+            const auto sums = MeasuresKernels::pauliMaskInnerProds(
+                arr_data, num_qubits, x_mask, z_masks);
+            for (size_t t = 0; t < indices.size(); t++) {
+                res[indices[t]] = MeasuresKernels::applyYPhase(
+                    sums[t], masks[indices[t]].num_y);
+            }
+        }
+        return res;
+    }
+
+    /**
+     * @brief Convert a list of single-qubit Pauli observables to Pauli
+     * words.
+     *
+     * @param operations_list List of operator names.
+     * @param wires_list List of wires where to apply the operators.
+     * @return Pauli words, or an empty vector if any observable is not a
+     * single-qubit Pauli observable.
+     */
+    static auto
+    toPauliWords(const std::vector<std::string> &operations_list,
+                 const std::vector<std::vector<size_t>> &wires_list)
+        -> std::vector<std::string> {
+        std::vector<std::string> pauli_words;
+        pauli_words.reserve(operations_list.size());
+        for (size_t index = 0; index < operations_list.size(); index++) {
+            const char word = pauliChar(operations_list[index]);
+            if (word == '\0' || wires_list[index].size() != 1) {
+                return {};
+            }
+            pauli_words.emplace_back(1, word);
+        }
+        return pauli_words;
+    }
+
+    /**
+     * @brief Get the diagonal of a matrix if it is a real diagonal matrix.
+     *
+     * @param matrix Square matrix in row-major order.
+     * @param dim Dimension of the matrix.
+     * @return Diagonal of the matrix, or std::nullopt if any off-diagonal
+     * element or the imaginary part of any diagonal element is non-zero.
+     */
+    static auto realDiagonal(const std::vector<CFP_t> &matrix, size_t dim)
+        -> std::optional<std::vector<fp_t>> {
+        std::vector<fp_t> diagonal(dim);
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                const CFP_t elt = matrix[row * dim + col];
+                if (row != col && elt != CFP_t{0.0, 0.0}) {
+                    return std::nullopt;
+                }
+            }
+            const CFP_t elt = matrix[row * dim + row];
+            if (elt.imag() != 0.0) {
+                return std::nullopt;
+            }
+            diagonal[row] = elt.real();
+        }
+        return diagonal;
+    }
+
+    /**
+     * @brief Get the marginal probabilities of the given wires with wires[0]
+     * corresponding to the most significant bit of the output index.
+     *
+     * The probabilities are obtained from the cached marginal of the sorted
+     * wires, for which both orderings coincide.
+     *
+     * @param wires Wires to compute the marginal probabilities of.
+     */
+    auto orderedMarginal(const std::vector<size_t> &wires)
+        -> std::vector<fp_t> {
+        const size_t num_wires = wires.size();
+        std::vector<size_t> sorted_wires(wires);
+        std::sort(sorted_wires.begin(), sorted_wires.end());
+        const auto &sorted_marginal = probs(sorted_wires);
+        if (sorted_wires == wires) {
+            return sorted_marginal;
         }
-        // Determining probabilities for the sorted wires.
-        const CFP_t *arr_data = original_statevector.getData();
+        // shifts[k] is the bit position of wires[k] in the sorted index
+        std::vector<size_t> shifts(num_wires);
+        for (size_t k = 0; k < num_wires; k++) {
+            const auto pos = static_cast<size_t>(
+                std::lower_bound(sorted_wires.begin(), sorted_wires.end(),
+                                 wires[k]) -
+                sorted_wires.begin());
+            shifts[k] = num_wires - 1 - pos;
+        }
+        std::vector<fp_t> marginal(sorted_marginal.size());
+        for (size_t idx = 0; idx < marginal.size(); idx++) {
+            size_t sorted_idx = 0;
+            for (size_t k = 0; k < num_wires; k++) {
+                sorted_idx |= ((idx >> (num_wires - 1 - k)) & 1U)
+                              << shifts[k];
+            }
+            marginal[idx] = sorted_marginal[sorted_idx];
+        }
+        return marginal;
+    }
+
+    /**
+     * @brief Compute @f$\langle D \rangle@f$ and @f$\langle D^2 \rangle@f$
+     * of a diagonal observable @f$D@f$ as a weighted sum of probabilities.
+     *
+     * The cached marginal probabilities are used when caching is enabled.
+     *
+     * @param diagonal Diagonal of the observable.
+     * @param wires Wires the observable acts on. wires[0] corresponds to the
+     * most significant bit of the diagonal index.
+     */
+    auto diagonalMoments(const std::vector<fp_t> &diagonal,
+                         const std::vector<size_t> &wires)
+        -> std::array<fp_t, 2> {
+        if (use_cache_) {
+            const auto marginal = orderedMarginal(wires);
+            fp_t mean = 0.0;
+            fp_t mean_square = 0.0;
+            for (size_t k = 0; k < diagonal.size(); k++) {
+                mean += marginal[k] * diagonal[k];
+                mean_square += marginal[k] * diagonal[k] * diagonal[k];
+            }
+            return {mean, mean_square};
+        }
+        const auto moments = MeasuresKernels::diagonalMoments(
+            getStateData(), original_statevector.getNumQubits(), {diagonal},
+            {physicalWires(wires)});
+        return {moments[0], moments[1]};
+    }
+
+    /**
+     * @brief Rotate the eigenbases of Pauli X and Y on the given wires to
+     * the computational basis, by H and @f$H S^\dagger@f$.
+     *
+     * The rotations are applied as tensor products of up to
+     * GateImplementationsLM::max_tensor_product_wires single-qubit matrices,
+     * each in a single pass over the statevector.
+     *
+     * @param data Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     * @param x_mask Bits of the wires measured in the X basis.
+     * @param y_mask Bits of the wires measured in the Y basis.
+     */
+    static void rotateToZBasis(CFP_t *data, size_t num_qubits, size_t x_mask,
+                               size_t y_mask) {
+        using Gates::GateImplementationsLM;
+        constexpr fp_t inv_sqrt2 = Util::INVSQRT2<fp_t>();
+        constexpr std::array<CFP_t, 4> rotation_x{
+            CFP_t{inv_sqrt2, 0.0}, CFP_t{inv_sqrt2, 0.0},
+            CFP_t{inv_sqrt2, 0.0}, CFP_t{-inv_sqrt2, 0.0}};
+        constexpr std::array<CFP_t, 4> rotation_y{
+            CFP_t{inv_sqrt2, 0.0}, CFP_t{0.0, -inv_sqrt2},
+            CFP_t{inv_sqrt2, 0.0}, CFP_t{0.0, inv_sqrt2}};
+
+        std::vector<size_t> wires;
+        std::vector<CFP_t> matrices;
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            const size_t bit = size_t{1U} << (num_qubits - 1 - wire);
+            if (((x_mask | y_mask) & bit) == 0) {
+                continue;
+            }
+            const auto &rotation =
+                ((x_mask & bit) != 0) ? rotation_x : rotation_y;
+            wires.emplace_back(wire);
+            matrices.insert(matrices.end(), rotation.begin(), rotation.end());
+            if (wires.size() ==
+                GateImplementationsLM::max_tensor_product_wires) {
+                GateImplementationsLM::applyTensorProduct(
+                    data, num_qubits, matrices.data(), wires);
+                wires.clear();
+                matrices.clear();
+            }
+        }
+        if (!wires.empty()) {
+            GateImplementationsLM::applyTensorProduct(data, num_qubits,
+                                                      matrices.data(), wires);
+        }
+    }
+
+    /**
+     * @brief Translate the wires of the terms of a Hamiltonian to the
+     * physical wires of the data.
+     */
+    [[nodiscard]] auto physicalTerms(const PauliSum<fp_t> &hamiltonian) const
+        -> PauliSum<fp_t> {
+        return {hamiltonian.getCoeffs(), hamiltonian.getWords(),
+                physicalWires(hamiltonian.getWires())};
+    }
+
+    /**
+     * @brief Expected value of a Hamiltonian on the physical wires of the
+     * data, measured in groups of qubit-wise commuting terms.
+     *
+     * @see expvalQubitWise()
+     */
+    auto qubitWiseExpval(const PauliSum<fp_t> &hamiltonian) -> fp_t {
+        const size_t num_qubits = original_statevector.getNumQubits();
+        double result = 0.0;
+        for (const auto &group : hamiltonian.getQubitWiseGroups(num_qubits)) {
+            std::optional<StateVectorManagedCPU<fp_t>> rotated;
+            const CFP_t *data = getStateData();
+            if ((group.x_mask | group.y_mask) != 0) {
+                rotated.emplace(copyState());
+                rotateToZBasis(rotated->getData(), num_qubits, group.x_mask,
+                               group.y_mask);
+                data = rotated->getData();
+            }
+
+            // Wires of the group in ascending order, and the support of each
+            // term as a mask of their marginal outcomes
+            const size_t support = group.x_mask | group.y_mask | group.z_mask;
+            std::vector<size_t> wires;
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                if (((support >> (num_qubits - 1 - wire)) & 1U) != 0) {
+                    wires.emplace_back(wire);
+                }
+            }
+            const size_t num_wires = wires.size();
+            std::vector<size_t> masks;
+            masks.reserve(group.terms.size());
+            for (const auto &term : group.terms) {
+                size_t mask = 0;
+                for (size_t k = 0; k < num_wires; k++) {
+                    mask |= ((term.first >> (num_qubits - 1 - wires[k])) & 1U)
+                            << (num_wires - 1 - k);
+                }
+                masks.emplace_back(mask);
+            }
+
+            const auto correlators = MeasuresKernels::zCorrelators(
+                MeasuresKernels::marginalProbs(data, num_qubits, wires),
+                num_wires, masks);
+            for (size_t t = 0; t < group.terms.size(); t++) {
+                result += group.terms[t].second * correlators[t];
+            }
+        }
+        return static_cast<fp_t>(result);
+    }
+
+  public:
+    explicit Measures(const SVType &provided_statevector)
+        : original_statevector{provided_statevector},
+          threading_config_{provided_statevector.getThreadingConfig()} {};
+
+    /**
+     * @brief Enable or disable caching of probabilities.
+     *
+     * When enabled, the probability vector, the marginal probabilities of
+     * each requested set of wires, and the cumulative distributions used for
+     * sampling are kept until the statevector is modified, as detected by
+     * StateVectorBase::getVersion(), or its wires are relabelled. Repeated
+     * measurements on an unchanged state then reuse them instead of sweeping
+     * over the statevector.
+     *
+     * @param enable Whether to cache probabilities.
+     */
+    void enableCache(bool enable = true) {
+        use_cache_ = enable;
+        cache_version_ = 0;
+        refreshCache();
+    }
+
+    /**
+     * @brief Check whether caching of probabilities is enabled.
+     */
+    [[nodiscard]] auto isCacheEnabled() const -> bool { return use_cache_; }
 
-        size_t num_qubits = original_statevector.getNumQubits();
+    /**
+     * @brief Set the pool of the temporary statevectors of expval and var.
+     *
+     * @param pool Buffer pool, or nullptr to allocate and free the data of
+     * each temporary statevector. Util::BufferPool::global() by default.
+     */
+    void setBufferPool(Util::BufferPool *pool) { buffer_pool_ = pool; }
 
-        const std::vector<size_t> all_indices =
-            Gates::generateBitPatterns(sorted_wires, num_qubits);
-        const std::vector<size_t> all_offsets = Gates::generateBitPatterns(
-            Gates::getIndicesAfterExclusion(sorted_wires, num_qubits),
-            num_qubits);
+    /**
+     * @brief Set the threads used by the measurements.
+     *
+     * @param config Threading configuration. That of the statevector by
+     * default.
+     */
+    void setThreadingConfig(ThreadingConfig config) {
+        threading_config_ = std::move(config);
+    }
 
-        std::vector<fp_t> probabilities(all_indices.size(), 0);
+    /**
+     * @brief Get the threading configuration.
+     */
+    [[nodiscard]] auto getThreadingConfig() const -> const ThreadingConfig & {
+        return threading_config_;
+    }
 
-        size_t ind_probs = 0;
-        for (auto index : all_indices) {
-            for (auto offset : all_offsets) {
-                probabilities[ind_probs] += std::norm(arr_data[index + offset]);
+    /**
+     * @brief Probabilities of each computational basis state.
+     *
+     * @return Floating point std::vector with probabilities
+     * in lexicographic order.
+     */
+    std::vector<fp_t> probs() {
+        const auto scope = threadingScope();
+        if (use_cache_) {
+            refreshCache();
+            if (probs_cache_.empty()) {
+                probs_cache_ = computeProbs();
             }
-            ind_probs++;
+            return probs_cache_;
         }
-        // Transposing the probabilities tensor with the indices determined at
-        // the beginning.
-        if (wires != sorted_wires) {
-            probabilities =
-                Util::transpose_state_tensor(probabilities, sorted_ind_wires);
+        return computeProbs();
+    };
+
+    /**
+     * @brief Probabilities for a subset of the full system.
+     *
+     * @param wires Wires will restrict probabilities to a subset
+     * of the full system.
+     * @return Floating point std::vector with probabilities.
+     * The basis columns are rearranged according to wires.
+     */
+    std::vector<fp_t> probs(const std::vector<size_t> &wires) {
+        const auto scope = threadingScope();
+        if (!use_cache_) {
+            return computeProbs(wires);
         }
-        return probabilities;
+        refreshCache();
+        auto iter = marginal_cache_.find(wires);
+        if (iter == marginal_cache_.end()) {
+            iter = marginal_cache_.emplace(wires, computeProbs(wires)).first;
+        }
+        return iter->second;
     }
 
     /**
      * @brief Expected value of an observable.
      *
+     * Real diagonal matrices are evaluated as a weighted sum of
+     * probabilities.
+     *
      * @param matrix Square matrix in row-major order.
      * @param wires Wires where to apply the operator.
      * @return Floating point expected value of the observable.
      */
     fp_t expval(const std::vector<CFP_t> &matrix,
                 const std::vector<size_t> &wires) {
-        // Copying the original state vector, for the application of the
-        // observable operator.
-        StateVectorManagedCPU<fp_t> operator_statevector(original_statevector);
-
-        operator_statevector.applyMatrix(matrix, wires);
-
-        CFP_t expected_value = Util::innerProdC(
-            original_statevector.getData(), operator_statevector.getData(),
-            original_statevector.getLength());
-        return std::real(expected_value);
+        const auto scope = threadingScope();
+        PL_ABORT_IF(matrix.size() != Util::exp2(2 * wires.size()),
+                    "The size of matrix does not match with the given "
+                    "number of wires");
+        if (const auto diagonal =
+                realDiagonal(matrix, Util::exp2(wires.size()))) {
+            return diagonalMoments(*diagonal, wires)[0];
+        }
+        return MeasuresKernels::expvalMatrix(
+            getStateData(), original_statevector.getNumQubits(), matrix.data(),
+            physicalWires(wires));
     };
 
     /**
      * @brief Expected value of an observable.
      *
+     * Pauli operators are evaluated directly from the statevector, and other
+     * operations acting on at most Gates::max_fused_wires wires are
+     * evaluated using their dense matrix, so the statevector is not copied.
+     *
      * @param operation String with the operator name.
      * @param wires Wires where to apply the operator.
      * @return Floating point expected value of the observable.
      */
     fp_t expval(const std::string &operation,
                 const std::vector<size_t> &wires) {
+        const auto scope = threadingScope();
+        if (wires.size() == 1) {
+            const char word = pauliChar(operation);
+            if (word != '\0') {
+                return expvalPauliWord(std::string_view(&word, 1), wires);
+            }
+        }
+
+        if (wires.size() <= Gates::max_fused_wires) {
+            Gates::FusedGateBlock block{{0}, wires};
+            std::sort(block.wires.begin(), block.wires.end());
+            const auto matrix = Gates::getFusedMatrix<fp_t>(
+                block, {operation}, {wires}, {false}, {{}});
+            return expval(matrix, block.wires);
+        }
+
         // Copying the original state vector, for the application of the
         // observable operator.
-        StateVectorManagedCPU<fp_t> operator_statevector(original_statevector);
+        auto operator_statevector = copyState();
 
-        operator_statevector.applyOperation(operation, wires);
+        operator_statevector.applyOperation(operation, physicalWires(wires));
 
         CFP_t expected_value = Util::innerProdC(
-            original_statevector.getData(), operator_statevector.getData(),
+            getStateData(), operator_statevector.getData(),
             original_statevector.getLength());
         return std::real(expected_value);
     };
 
+    /**
+     * @brief Expected value of a Pauli word.
+     *
+     * When caching is enabled, words consisting of 'I' and 'Z' only are
+     * evaluated on the cached marginal probabilities of their 'Z' wires.
+     *
+     * @param pauli_word String consisting of 'I', 'X', 'Y', and 'Z'.
+     * @param wires Wires each character of pauli_word acts on.
+     * @return Floating point expected value of the Pauli word.
+     */
+    fp_t expvalPauliWord(std::string_view pauli_word,
+                         const std::vector<size_t> &wires) {
+        const auto scope = threadingScope();
+        if (use_cache_ &&
+            pauli_word.find_first_not_of("IZ") == std::string_view::npos) {
+            PL_ABORT_IF(pauli_word.size() != wires.size(),
+                        "The length of the Pauli word must be the same as "
+                        "the number of wires.");
+            // Parity of the Z wires evaluated on their marginal
+            std::vector<size_t> z_wires;
+            for (size_t k = 0; k < wires.size(); k++) {
+                if (pauli_word[k] == 'Z') {
+                    z_wires.emplace_back(wires[k]);
+                }
+            }
+            if (z_wires.empty()) {
+                return Util::squaredNorm(getStateData(),
+                                         original_statevector.getLength());
+            }
+            const auto &marginal = probs(z_wires);
+            fp_t sum = 0.0;
+            for (size_t k = 0; k < marginal.size(); k++) {
+                sum += ((std::popcount(k) & 1U) == 0) ? marginal[k]
+                                                      : -marginal[k];
+            }
+            return sum;
+        }
+        return MeasuresKernels::expvalPauliWord(
+            getStateData(), original_statevector.getNumQubits(), pauli_word,
+            physicalWires(wires));
+    }
+
+    /**
+     * @brief Expected value of a Hamiltonian given by a linear combination of
+     * Pauli words.
+     *
+     * Terms are grouped by their bit flip mask, and each group is evaluated in
+     * a single pass over the statevector.
+     *
+     * @param hamiltonian Hamiltonian to measure.
+     * @return Floating point expected value of the Hamiltonian.
+     */
+    fp_t expval(const PauliSum<fp_t> &hamiltonian) {
+        const auto scope = threadingScope();
+        const CFP_t *arr_data = getStateData();
+        const size_t num_qubits = original_statevector.getNumQubits();
+        if (original_statevector.hasWireMap()) {
+            return physicalTerms(hamiltonian).expval(arr_data, num_qubits);
+        }
+        return hamiltonian.expval(arr_data, num_qubits);
+    }
+
+    /**
+     * @brief Expected value of a Hamiltonian given by a linear combination of
+     * Pauli words, measured in groups of qubit-wise commuting terms.
+     *
+     * For each group of PauliSum::getQubitWiseGroups(), one layer of basis
+     * rotations is applied to a copy of the statevector taken from the
+     * buffer pool, and all terms of the group are evaluated from the
+     * marginal probabilities of its wires in a single pass. This is
+     * preferable to expval(const PauliSum<fp_t> &) when there are much fewer
+     * groups than distinct bit flip masks, e.g. for a transverse field on
+     * every wire.
+     *
+     * @param hamiltonian Hamiltonian to measure.
+     * @return Floating point expected value of the Hamiltonian.
+     */
+    fp_t expvalQubitWise(const PauliSum<fp_t> &hamiltonian) {
+        const auto scope = threadingScope();
+        if (original_statevector.hasWireMap()) {
+            return qubitWiseExpval(physicalTerms(hamiltonian));
+        }
+        return qubitWiseExpval(hamiltonian);
+    }
+
+    /**
+     * @brief Expected values of several Pauli words.
+     *
+     * Words sharing the same bit flip mask, e.g. all words consisting of 'I'
+     * and 'Z' only, are evaluated together in a single read-only pass over
+     * the statevector.
+     *
+     * @param pauli_words Pauli words consisting of 'I', 'X', 'Y', and 'Z'.
+     * @param wires_list Wires each character of the corresponding word acts
+     * on.
+     * @return Floating point std::vector with the expected value of each
+     * word.
+     */
+    std::vector<fp_t>
+    expvalPauliWords(const std::vector<std::string> &pauli_words,
+                     const std::vector<std::vector<size_t>> &wires_list) {
+        const auto scope = threadingScope();
+        return pauliWordsMoments(pauli_words, wires_list, false);
+    }
+
+    /**
+     * @brief Variances of several Pauli words.
+     *
+     * As each Pauli word squares to the identity, its variance is
+     * @f$\langle\psi|\psi\rangle - \langle P \rangle^2@f$. The expected
+     * values and the squared norm are computed with the same passes as
+     * expvalPauliWords().
+     *
+     * @param pauli_words Pauli words consisting of 'I', 'X', 'Y', and 'Z'.
+     * @param wires_list Wires each character of the corresponding word acts
+     * on.
+     * @return Floating point std::vector with the variance of each word.
+     */
+    std::vector<fp_t>
+    varPauliWords(const std::vector<std::string> &pauli_words,
+                  const std::vector<std::vector<size_t>> &wires_list) {
+        const auto scope = threadingScope();
+        auto res = pauliWordsMoments(pauli_words, wires_list, true);
+        const fp_t norm = res.back();
+        res.pop_back();
+        for (auto &value : res) {
+            value = norm - value * value;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Expected values of several products of Pauli Z operators, e.g.
+     * @f$Z_i Z_j@f$ and @f$Z_i Z_j Z_k@f$.
+     *
+     * The marginal probabilities of all wires involved are computed once,
+     * sharing the probs() cache when caching is enabled, and every
+     * correlator is then evaluated from them by
+     * MeasuresKernels::zCorrelators().
+     *
+     * @param wires_list Wires of the Z operators of each correlator. A wire
+     * appearing twice cancels out.
+     * @return Floating point std::vector with the expected value of each
+     * correlator.
+     */
+    std::vector<fp_t>
+    expvalZCorrelators(const std::vector<std::vector<size_t>> &wires_list) {
+        const auto scope = threadingScope();
+        const size_t num_qubits = original_statevector.getNumQubits();
+        std::vector<size_t> all_wires;
+        for (const auto &wires : wires_list) {
+            for (const size_t wire : wires) {
+                PL_ABORT_IF(wire >= num_qubits, "Invalid wire index.");
+                all_wires.emplace_back(wire);
+            }
+        }
+        std::sort(all_wires.begin(), all_wires.end());
+        all_wires.erase(std::unique(all_wires.begin(), all_wires.end()),
+                        all_wires.end());
+        const size_t num_wires = all_wires.size();
+
+        std::vector<size_t> masks;
+        masks.reserve(wires_list.size());
+        for (const auto &wires : wires_list) {
+            size_t mask = 0;
+            for (const size_t wire : wires) {
+                const auto pos = static_cast<size_t>(
+                    std::lower_bound(all_wires.begin(), all_wires.end(),
+                                     wire) -
+                    all_wires.begin());
+                mask ^= size_t{1U} << (num_wires - 1 - pos);
+            }
+            masks.emplace_back(mask);
+        }
+        // Sorted wires give the marginal in the order of probs()
+        const auto marginal =
+            (num_wires == num_qubits) ? probs() : probs(all_wires);
+        return MeasuresKernels::zCorrelators(marginal, num_wires, masks);
+    }
+
+    /**
+     * @brief Expected values of several diagonal observables, computed in a
+     * single read-only pass over the statevector.
+     *
+     * @param diagonals Diagonal of each observable. The diagonal of an
+     * observable acting on k wires has 2^k entries.
+     * @param wires_list Wires each observable acts on. wires[0] corresponds
+     * to the most significant bit of the diagonal index.
+     * @return Floating point std::vector with the expected value of each
+     * observable.
+     */
+    std::vector<fp_t>
+    expvalDiagonal(const std::vector<std::vector<fp_t>> &diagonals,
+                   const std::vector<std::vector<size_t>> &wires_list) {
+        const auto scope = threadingScope();
+        const auto moments = MeasuresKernels::diagonalMoments(
+            getStateData(), original_statevector.getNumQubits(), diagonals,
+            physicalWires(wires_list));
+        std::vector<fp_t> res(diagonals.size());
+        for (size_t obs = 0; obs < res.size(); obs++) {
+            res[obs] = moments[2 * obs];
+        }
+        return res;
+    }
+
+    /**
+     * @brief Variances of several diagonal observables, computed in a single
+     * read-only pass over the statevector.
+     *
+     * @param diagonals Diagonal of each observable. The diagonal of an
+     * observable acting on k wires has 2^k entries.
+     * @param wires_list Wires each observable acts on. wires[0] corresponds
+     * to the most significant bit of the diagonal index.
+     * @return Floating point std::vector with the variance of each
+     * observable.
+     */
+    std::vector<fp_t>
+    varDiagonal(const std::vector<std::vector<fp_t>> &diagonals,
+                const std::vector<std::vector<size_t>> &wires_list) {
+        const auto scope = threadingScope();
+        const auto moments = MeasuresKernels::diagonalMoments(
+            getStateData(), original_statevector.getNumQubits(), diagonals,
+            physicalWires(wires_list));
+        std::vector<fp_t> res(diagonals.size());
+        for (size_t obs = 0; obs < res.size(); obs++) {
+            res[obs] =
+                moments[2 * obs + 1] - moments[2 * obs] * moments[2 * obs];
+        }
+        return res;
+    }
+
+    /**
+     * @brief Expected value of the projector onto a computational basis state
+     * of the given wires, i.e. the probability of measuring it.
+     *
+     * Only the amplitudes consistent with the basis state are read, or the
+     * cached marginal probabilities are used when caching is enabled.
+     *
+     * @param basis_state Bit of each wire, 0 or 1.
+     * @param wires Wires of the projector.
+     * @return Floating point expected value of the projector.
+     */
+    fp_t expvalProjector(const std::vector<size_t> &basis_state,
+                         const std::vector<size_t> &wires) {
+        const auto scope = threadingScope();
+        if (use_cache_ && basis_state.size() == wires.size() &&
+            std::all_of(basis_state.begin(), basis_state.end(),
+                        [](size_t bit) { return bit <= 1; })) {
+            size_t idx = 0;
+            for (const size_t bit : basis_state) {
+                idx = (idx << 1U) | bit;
+            }
+            return orderedMarginal(wires)[idx];
+        }
+        return MeasuresKernels::projectorProb(
+            getStateData(), original_statevector.getNumQubits(), basis_state,
+            physicalWires(wires));
+    }
+
+    /**
+     * @brief Variance of the projector onto a computational basis state of
+     * the given wires.
+     *
+     * As the projector is idempotent, the variance is
+     * @f$\langle P \rangle - \langle P \rangle^2@f$.
+     *
+     * @param basis_state Bit of each wire, 0 or 1.
+     * @param wires Wires of the projector.
+     * @return Floating point variance of the projector.
+     */
+    fp_t varProjector(const std::vector<size_t> &basis_state,
+                      const std::vector<size_t> &wires) {
+        const auto scope = threadingScope();
+        const fp_t prob = expvalProjector(basis_state, wires);
+        return prob - prob * prob;
+    }
+
+    /**
+     * @brief Reduced density matrix of the given wires, tracing out the
+     * other wires.
+     *
+     * @param wires Distinct wires to keep. wires[0] corresponds to the most
+     * significant bit of the row and column indices.
+     * @return Row-major density matrix of size @f$4^k@f$ for @f$k@f$ wires.
+     */
+    std::vector<CFP_t> densityMatrix(const std::vector<size_t> &wires) {
+        const auto scope = threadingScope();
+        return MeasuresKernels::reducedDensityMatrix(
+            getStateData(), original_statevector.getNumQubits(),
+            physicalWires(wires));
+    }
+
+    /**
+     * @brief Purity @f$\mathrm{Tr}(\rho^2)@f$ of the reduced state of the
+     * given wires.
+     *
+     * @param wires Distinct wires to keep.
+     */
+    fp_t purity(const std::vector<size_t> &wires) {
+        const auto scope = threadingScope();
+        return MeasuresKernels::reducedPurity(
+            getStateData(), original_statevector.getNumQubits(),
+            physicalWires(wires));
+    }
+
+    /**
+     * @brief Renyi entropy of order 2, @f$-\ln \mathrm{Tr}(\rho^2)@f$, of the
+     * reduced state of the given wires.
+     *
+     * @param wires Distinct wires to keep.
+     */
+    fp_t renyi2Entropy(const std::vector<size_t> &wires) {
+        return -std::log(purity(wires));
+    }
+
+    /**
+     * @brief Expected value of a Hamiltonian given by a sparse matrix.
+     *
+     * The wires of the statevector must be canonical, as the matrix is
+     * indexed by the basis states of the logical wires.
+     *
+     * @param hamiltonian Hamiltonian to measure.
+     * @return Floating point expected value of the Hamiltonian.
+     */
+    fp_t expval(const SparseHamiltonian<fp_t> &hamiltonian) {
+        const auto scope = threadingScope();
+        PL_ABORT_IF(hamiltonian.getNumQubits() !=
+                        original_statevector.getNumQubits(),
+                    "Statevector and Hamiltonian have incompatible sizes.");
+        return hamiltonian.expval(original_statevector.getData(),
+                                  original_statevector.getNumQubits());
+    }
+
     /**
      * @brief Expected value of a Sparse Hamiltonian.
      *
+     * The expected value is accumulated row by row without storing
+     * @f$H|\psi\rangle@f$, and does not require Kokkos. The wires of the
+     * statevector must be canonical.
+     *
      * @tparam index_type integer type used as indices of the sparse matrix.
      * @param row_map_ptr   row_map array pointer.
      *                      The j element encodes the number of non-zeros above
@@ -177,23 +1270,22 @@ class Measures {
     fp_t expval(const index_type *row_map_ptr, const index_type row_map_size,
                 const index_type *entries_ptr, const CFP_t *values_ptr,
                 const index_type numNNZ) {
+        const auto scope = threadingScope();
         PL_ABORT_IF(
             (original_statevector.getLength() != (size_t(row_map_size) - 1)),
             "Statevector and Hamiltonian have incompatible sizes.");
-        auto operator_vector = Util::apply_Sparse_Matrix(
+        return Util::expval_Sparse_Matrix_CSR(
             original_statevector.getData(),
             static_cast<index_type>(original_statevector.getLength()),
             row_map_ptr, row_map_size, entries_ptr, values_ptr, numNNZ);
-
-        CFP_t expected_value = Util::innerProdC(
-            original_statevector.getData(), operator_vector.data(),
-            original_statevector.getLength());
-        return std::real(expected_value);
     };
 
     /**
      * @brief Expected value for a list of observables.
      *
+     * Lists consisting of single-qubit Pauli observables only are evaluated
+     * with expvalPauliWords().
+     *
      * @tparam op_type Operation type.
      * @param operations_list List of operations to measure.
      * @param wires_list List of wires where to apply the operators.
@@ -204,9 +1296,16 @@ class Measures {
     std::vector<fp_t>
     expval(const std::vector<op_type> &operations_list,
            const std::vector<std::vector<size_t>> &wires_list) {
+        const auto scope = threadingScope();
         PL_ABORT_IF(
             (operations_list.size() != wires_list.size()),
             "The lengths of the list of operations and wires do not match.");
+        if constexpr (std::is_same_v<op_type, std::string>) {
+            const auto pauli_words = toPauliWords(operations_list, wires_list);
+            if (!pauli_words.empty()) {
+                return expvalPauliWords(pauli_words, wires_list);
+            }
+        }
         std::vector<fp_t> expected_value_list;
 
         for (size_t index = 0; index < operations_list.size(); index++) {
@@ -225,19 +1324,38 @@ class Measures {
      * @return Floating point with the variance of the observables.
      */
     fp_t var(const std::string &operation, const std::vector<size_t> &wires) {
+        const auto scope = threadingScope();
+        // Observables with O^2 = I have the variance <psi|psi> - <O>^2, which
+        // requires no copy of the statevector.
+        if (wires.size() == 1 &&
+            (operation == "Identity" || operation == "PauliX" ||
+             operation == "PauliY" || operation == "PauliZ" ||
+             operation == "Hadamard")) {
+            fp_t norm = 0.0;
+            if (use_cache_) {
+                const auto marginal = probs(wires);
+                norm = marginal[0] + marginal[1];
+            } else {
+                norm = Util::squaredNorm(getStateData(),
+                                         original_statevector.getLength());
+            }
+            const fp_t mean = expval(operation, wires);
+            return norm - mean * mean;
+        }
+
         // Copying the original state vector, for the application of the
         // observable operator.
-        StateVectorManagedCPU<fp_t> operator_statevector(original_statevector);
+        auto operator_statevector = copyState();
 
-        operator_statevector.applyOperation(operation, wires);
+        operator_statevector.applyOperation(operation, physicalWires(wires));
 
         const std::complex<fp_t> *opsv_data = operator_statevector.getData();
         size_t orgsv_len = original_statevector.getLength();
 
         fp_t mean_square =
             std::real(Util::innerProdC(opsv_data, opsv_data, orgsv_len));
-        fp_t squared_mean = std::real(Util::innerProdC(
-            original_statevector.getData(), opsv_data, orgsv_len));
+        fp_t squared_mean = std::real(
+            Util::innerProdC(getStateData(), opsv_data, orgsv_len));
         squared_mean = static_cast<fp_t>(std::pow(squared_mean, 2));
         return (mean_square - squared_mean);
     };
@@ -245,25 +1363,37 @@ class Measures {
     /**
      * @brief Variance of an observable.
      *
+     * Real diagonal matrices are evaluated as a weighted sum of
+     * probabilities.
+     *
      * @param matrix Square matrix in row-major order.
      * @param wires Wires where to apply the operator.
      * @return Floating point with the variance of the observables.
      */
     fp_t var(const std::vector<CFP_t> &matrix,
              const std::vector<size_t> &wires) {
+        const auto scope = threadingScope();
+        PL_ABORT_IF(matrix.size() != Util::exp2(2 * wires.size()),
+                    "The size of matrix does not match with the given "
+                    "number of wires");
+        if (const auto diagonal =
+                realDiagonal(matrix, Util::exp2(wires.size()))) {
+            const auto [mean, mean_square] = diagonalMoments(*diagonal, wires);
+            return mean_square - mean * mean;
+        }
         // Copying the original state vector, for the application of the
         // observable operator.
-        StateVectorManagedCPU<fp_t> operator_statevector(original_statevector);
+        auto operator_statevector = copyState();
 
-        operator_statevector.applyMatrix(matrix, wires);
+        operator_statevector.applyMatrix(matrix, physicalWires(wires));
 
         const std::complex<fp_t> *opsv_data = operator_statevector.getData();
         size_t orgsv_len = original_statevector.getLength();
 
         fp_t mean_square =
             std::real(Util::innerProdC(opsv_data, opsv_data, orgsv_len));
-        fp_t squared_mean = std::real(Util::innerProdC(
-            original_statevector.getData(), opsv_data, orgsv_len));
+        fp_t squared_mean = std::real(
+            Util::innerProdC(getStateData(), opsv_data, orgsv_len));
         squared_mean = static_cast<fp_t>(std::pow(squared_mean, 2));
         return (mean_square - squared_mean);
     };
@@ -271,6 +1401,9 @@ class Measures {
     /**
      * @brief Variance for a list of observables.
      *
+     * Lists consisting of single-qubit Pauli observables only are evaluated
+     * with varPauliWords().
+     *
      * @tparam op_type Operation type.
      * @param operations_list List of operations to measure.
      * Square matrix in row-major order or string with the operator name.
@@ -280,9 +1413,16 @@ class Measures {
     template <typename op_type>
     std::vector<fp_t> var(const std::vector<op_type> &operations_list,
                           const std::vector<std::vector<size_t>> &wires_list) {
+        const auto scope = threadingScope();
         PL_ABORT_IF(
             (operations_list.size() != wires_list.size()),
             "The lengths of the list of operations and wires do not match.");
+        if constexpr (std::is_same_v<op_type, std::string>) {
+            const auto pauli_words = toPauliWords(operations_list, wires_list);
+            if (!pauli_words.empty()) {
+                return varPauliWords(pauli_words, wires_list);
+            }
+        }
 
         std::vector<fp_t> expected_value_list;
 
@@ -295,89 +1435,249 @@ class Measures {
     };
 
     /**
-     * @brief Generate samples using the alias method.
-     * Reference: https://en.wikipedia.org/wiki/Alias_method
+     * @brief Generate samples by inverse transform sampling.
+     *
+     * Each sample binary searches a uniform random number in the cumulative
+     * distribution of the statevector. The random numbers are drawn from a
+     * Philox4x32 generator keyed by `seed` with one counter per pair of
+     * samples, so the samples only depend on the seed and not on the number
+     * of threads.
      *
      * @param num_samples The number of samples to generate.
+     * @param seed Seed of the random number generator.
      * @return 1-D vector of samples in binary, each sample is
      * separated by a stride equal to the number of qubits.
      */
-    std::vector<size_t> generate_samples(size_t num_samples) {
+    std::vector<size_t> generate_samples(size_t num_samples, uint64_t seed) {
+        const auto scope = threadingScope();
+        PL_TRACE_SCOPE("generate_samples", "measures");
         const size_t num_qubits = original_statevector.getNumQubits();
-        auto &&probabilities = probs();
-
+        const auto indices = generate_sample_indices(num_samples, seed);
         std::vector<size_t> samples(num_samples * num_qubits, 0);
-        std::mt19937 generator(std::random_device{}());
-        std::uniform_real_distribution<fp_t> distribution(0.0, 1.0);
-        std::unordered_map<size_t, size_t> cache;
 
-        const size_t N = probabilities.size();
-        std::vector<double> bucket(N);
-        std::vector<size_t> bucket_partner(N);
-        std::stack<size_t> overfull_bucket_ids;
-        std::stack<size_t> underfull_bucket_ids;
-
-        for (size_t i = 0; i < N; i++) {
-            bucket[i] = N * probabilities[i];
-            bucket_partner[i] = i;
-            if (bucket[i] > 1.0) {
-                overfull_bucket_ids.push(i);
-            }
-            if (bucket[i] < 1.0) {
-                underfull_bucket_ids.push(i);
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t i = 0; i < num_samples; i++) {
+            const size_t idx = indices[i];
+            size_t *sample = samples.data() + i * num_qubits;
+            for (size_t j = 0; j < num_qubits; j++) {
+                sample[j] = (idx >> (num_qubits - 1 - j)) & 1U;
             }
         }
+        return samples;
+    }
 
-        // Run alias algorithm
-        while (!underfull_bucket_ids.empty() && !overfull_bucket_ids.empty()) {
-            // get an overfull bucket
-            size_t i = overfull_bucket_ids.top();
+    /**
+     * @brief Generate samples using a random seed.
+     *
+     * @see generate_samples(size_t, uint64_t)
+     * @param num_samples The number of samples to generate.
+     * @return 1-D vector of samples in binary, each sample is
+     * separated by a stride equal to the number of qubits.
+     */
+    std::vector<size_t> generate_samples(size_t num_samples) {
+        const auto scope = threadingScope();
+        std::random_device rd;
+        const uint64_t seed = (uint64_t{rd()} << 32U) | rd();
+        return generate_samples(num_samples, seed);
+    }
 
-            // get an underfull bucket
-            size_t j = underfull_bucket_ids.top();
-            underfull_bucket_ids.pop();
+    /**
+     * @brief Generate samples as computational basis state indices.
+     *
+     * Uses the same random numbers as generate_samples(size_t, uint64_t), but
+     * returns one index per sample instead of one integer per bit.
+     *
+     * @param num_samples The number of samples to generate.
+     * @param seed Seed of the random number generator.
+     * @return std::vector<size_t> Basis state index of each sample.
+     */
+    std::vector<size_t> generate_sample_indices(size_t num_samples,
+                                                uint64_t seed) {
+        const auto scope = threadingScope();
+        return withCDF([num_samples, seed](const std::vector<double> &cdf) {
+            return sampleFromCDF(cdf, num_samples, seed);
+        });
+    }
 
-            // underfull bucket is partned with an overfull bucket
-            bucket_partner[j] = i;
-            bucket[i] = bucket[i] + bucket[j] - 1;
+    /**
+     * @brief Generate samples of a subset of wires as a packed bit stream.
+     *
+     * Bit `j` of sample `i`, i.e. the outcome of `wires[j]`, is stored at
+     * position `p = i * wires.size() + j` of the stream, i.e. in bit `p % 64`
+     * of word `p / 64`. Samples are drawn from the marginal distribution of
+     * the wires, so only a vector of size @f$2^{|wires|}@f$ is built, unless
+     * the wires cover nearly all qubits.
+     *
+     * @param num_samples The number of samples to generate.
+     * @param wires Wires to sample.
+     * @param seed Seed of the random number generator.
+     * @return std::vector<uint64_t> Packed samples of
+     * ceil(num_samples * wires.size() / 64) words.
+     */
+    auto generate_packed_samples(size_t num_samples,
+                                 const std::vector<size_t> &wires,
+                                 uint64_t seed) -> std::vector<uint64_t> {
+        const auto scope = threadingScope();
+        const size_t num_qubits = original_statevector.getNumQubits();
+        const size_t num_wires = wires.size();
+        PL_ABORT_IF(num_wires == 0 || num_wires > num_qubits,
+                    "Invalid number of wires.");
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits, "Invalid wire index.");
+        }
 
-            // if overfull bucket is now underfull
-            // put in underfull stack
-            if (bucket[i] < 1) {
-                overfull_bucket_ids.pop();
-                underfull_bucket_ids.push(i);
+        std::vector<size_t> outcomes;
+        if (num_wires + min_marginal_qubits > num_qubits) {
+            outcomes = generate_sample_indices(num_samples, seed);
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp parallel for schedule(static)
+            #endif
+            // clang-format on
+            for (size_t i = 0; i < num_samples; i++) {
+                size_t outcome = 0;
+                for (const size_t wire : wires) {
+                    outcome = (outcome << 1U) |
+                              ((outcomes[i] >> (num_qubits - 1 - wire)) & 1U);
+                }
+                outcomes[i] = outcome;
             }
+        } else {
+            outcomes = withMarginalCDF(
+                wires, [num_samples, seed](const std::vector<double> &cdf) {
+                    return sampleFromCDF(cdf, num_samples, seed);
+                });
+        }
+
+        constexpr size_t word_bits = 64;
+        std::vector<uint64_t> packed(
+            (num_samples * num_wires + word_bits - 1) / word_bits, 0);
+        // Each group of 64 samples fills exactly num_wires words, so groups
+        // are packed independently.
+        const size_t num_groups = (num_samples + word_bits - 1) / word_bits;
 
-            // if overfull bucket is full -> remove
-            else if (bucket[i] == 1.0) {
-                overfull_bucket_ids.pop();
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t group = 0; group < num_groups; group++) {
+            const size_t end = std::min(num_samples, (group + 1) * word_bits);
+            for (size_t i = group * word_bits; i < end; i++) {
+                for (size_t j = 0; j < num_wires; j++) {
+                    const size_t pos = i * num_wires + j;
+                    const uint64_t bit =
+                        (outcomes[i] >> (num_wires - 1 - j)) & 1U;
+                    packed[pos / word_bits] |= bit << (pos % word_bits);
+                }
             }
         }
+        return packed;
+    }
+
+    /**
+     * @brief Generate the measurements of a classical shadow.
+     *
+     * Each shot measures every qubit in a random Pauli basis, X, Y, or Z.
+     * Shots are grouped by their basis setting: for each setting, the basis
+     * rotations are applied to a copy of the statevector taken from the
+     * buffer pool, as tensor products of single-qubit matrices on up to
+     * GateImplementationsLM::max_tensor_product_wires wires per pass, and
+     * all shots of the setting are sampled from the copy at once. The
+     * result only depends on the seed and not on the number of threads.
+     *
+     * @param num_samples The number of shots.
+     * @param seed Seed of the random number generator.
+     * @return Pair of the bases, `num_samples * num_qubits` values where
+     * `bases[i * num_qubits + j]` is 0, 1, or 2 for X, Y, or Z on wire `j`
+     * in shot `i`, and of the outcome of each shot as a computational basis
+     * state index of the rotated state.
+     */
+    auto generate_shadow_samples(size_t num_samples, uint64_t seed)
+        -> std::pair<std::vector<uint8_t>, std::vector<size_t>> {
+        const auto scope = threadingScope();
+        PL_TRACE_SCOPE("generate_shadow_samples", "measures");
+        const size_t num_qubits = original_statevector.getNumQubits();
 
-        // Pick samples
+        std::mt19937_64 generator(seed);
+        std::uniform_int_distribution<int> basis_dist(0, 2);
+        std::vector<uint8_t> bases(num_samples * num_qubits);
+        for (auto &basis : bases) {
+            basis = static_cast<uint8_t>(basis_dist(generator));
+        }
+        // Shots of each basis setting, given by the masks of the wires
+        // measured in X and in Y, in ascending order of the setting
+        using Setting = std::pair<size_t, size_t>;
+        const auto basis_at = [](const Setting &setting, size_t bit) {
+            return ((setting.first & bit) != 0)    ? 0
+                   : ((setting.second & bit) != 0) ? 1
+                                                   : 2;
+        };
+        const auto setting_less = [&basis_at](const Setting &lhs,
+                                              const Setting &rhs) {
+            const size_t diff =
+                (lhs.first ^ rhs.first) | (lhs.second ^ rhs.second);
+            if (diff == 0) {
+                return false;
+            }
+            const size_t bit = std::bit_floor(diff); // First differing wire
+            return basis_at(lhs, bit) < basis_at(rhs, bit);
+        };
+        std::map<Setting, std::vector<size_t>, decltype(setting_less)>
+            settings(setting_less);
         for (size_t i = 0; i < num_samples; i++) {
-            fp_t pct = distribution(generator) * N;
-            auto idx = static_cast<size_t>(pct);
-            if (pct - idx > bucket[idx]) {
-                idx = bucket_partner[idx];
-            }
-            // If cached, retrieve sample from cache
-            if (cache.count(idx) != 0) {
-                size_t cache_id = cache[idx];
-                auto it_temp = samples.begin() + cache_id * num_qubits;
-                std::copy(it_temp, it_temp + num_qubits,
-                          samples.begin() + i * num_qubits);
-            }
-            // If not cached, compute
-            else {
-                for (size_t j = 0; j < num_qubits; j++) {
-                    samples[i * num_qubits + (num_qubits - 1 - j)] =
-                        (idx >> j) & 1U;
-                }
-                cache[idx] = i;
+            Setting setting{0, 0};
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                const size_t bit = size_t{1U} << (num_qubits - 1 - wire);
+                const uint8_t basis = bases[i * num_qubits + wire];
+                setting.first |= (basis == 0) ? bit : 0;
+                setting.second |= (basis == 1) ? bit : 0;
             }
+            settings[setting].emplace_back(i);
         }
-        return samples;
+
+        std::vector<size_t> outcomes(num_samples);
+        for (const auto &[setting, shots] : settings) {
+            auto rotated = copyState();
+            rotateToZBasis(rotated.getData(), num_qubits,
+                           physicalMask(setting.first),
+                           physicalMask(setting.second));
+
+            const auto indices = sampleFromCDF(computeCDF(rotated.getData()),
+                                               shots.size(), generator());
+            for (size_t k = 0; k < shots.size(); k++) {
+                outcomes[shots[k]] = indices[k];
+            }
+        }
+        return {std::move(bases), std::move(outcomes)};
+    }
+
+    /**
+     * @brief Generate a histogram of samples without drawing individual
+     * samples.
+     *
+     * The number of samples in each half of a range of basis states is drawn
+     * from a binomial distribution, recursively, starting from all basis
+     * states. Ranges without samples are not visited, so the cost scales with
+     * the number of distinct outcomes times the number of qubits instead of
+     * the number of samples.
+     *
+     * @param num_samples The number of samples to generate.
+     * @param seed Seed of the random number generator.
+     * @return std::vector<std::pair<size_t, size_t>> Pairs of basis state
+     * index and count in ascending order of the index. Only outcomes with
+     * nonzero count are returned.
+     */
+    auto generate_counts(size_t num_samples, uint64_t seed)
+        -> std::vector<std::pair<size_t, size_t>> {
+        const auto scope = threadingScope();
+        return withCDF([num_samples, seed](const std::vector<double> &cdf) {
+            return countsFromCDF(cdf, num_samples, seed);
+        });
     }
 }; // class Measures
 } // namespace Pennylane
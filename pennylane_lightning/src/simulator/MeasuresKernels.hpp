@@ -0,0 +1,867 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines read-only kernels computing expectation values directly from the
+ * statevector data.
+ */
+#pragma once
+
+#include "BitUtil.hpp"
+#include "Error.hpp"
+#include "TypeTraits.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <complex>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace Pennylane::MeasuresKernels {
+/**
+ * @brief Bit masks representing a Pauli word.
+ *
+ * A Pauli word @f$P@f$ acts on a computational basis state as
+ * @f$P|b\rangle = i^{n_Y} (-1)^{|b \wedge z|} |b \oplus x\rangle@f$, where
+ * @f$x@f$ (`x_mask`) has ones for X and Y, @f$z@f$ (`z_mask`) has ones for Z
+ * and Y, and @f$n_Y@f$ (`num_y`) is the number of Y.
+ */
+struct PauliWordMasks {
+    size_t x_mask{0};
+    size_t z_mask{0};
+    size_t num_y{0};
+};
+
+/**
+ * @brief Compute bit masks for a Pauli word.
+ *
+ * @param pauli_word String consisting of 'I', 'X', 'Y', and 'Z'.
+ * @param wires Wires each character of the word acts on.
+ * @param num_qubits Number of qubits.
+ */
+inline auto getPauliWordMasks(std::string_view pauli_word,
+                              const std::vector<size_t> &wires,
+                              size_t num_qubits) -> PauliWordMasks {
+    PL_ABORT_IF(pauli_word.size() != wires.size(),
+                "The length of the Pauli word must be the same as the number "
+                "of wires.");
+    PauliWordMasks masks;
+    for (size_t k = 0; k < wires.size(); k++) {
+        PL_ABORT_IF(wires[k] >= num_qubits, "Invalid wire index.");
+        const size_t bit = static_cast<size_t>(1U)
+                           << (num_qubits - 1 - wires[k]);
+        switch (pauli_word[k]) {
+        case 'I':
+            break;
+        case 'X':
+            masks.x_mask ^= bit;
+            break;
+        case 'Y':
+            masks.x_mask ^= bit;
+            masks.z_mask ^= bit;
+            masks.num_y++;
+            break;
+        case 'Z':
+            masks.z_mask ^= bit;
+            break;
+        default:
+            PL_ABORT("Pauli word must consist of 'I', 'X', 'Y', and 'Z'.");
+        }
+    }
+    return masks;
+}
+
+/**
+ * @brief Compute @f$\sum_b (-1)^{|b \wedge z|} \psi^*_{b \oplus x} \psi_b@f$
+ * in a single read-only pass.
+ *
+ * Multiplying the result by @f$i^{n_Y}@f$ gives the expectation value of
+ * the corresponding Pauli word.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param x_mask Bit flip mask.
+ * @param z_mask Phase mask.
+ */
+template <class PrecisionT>
+auto pauliMaskInnerProd(const std::complex<PrecisionT> *arr, size_t num_qubits,
+                        size_t x_mask, size_t z_mask)
+    -> std::complex<PrecisionT> {
+    using AccT = Util::accumulator_t<PrecisionT>;
+    const size_t length = Util::exp2(num_qubits);
+    AccT sum_real = 0.0;
+    AccT sum_imag = 0.0;
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static) \
+            reduction(+:sum_real, sum_imag)
+    #endif
+    // clang-format on
+    for (size_t idx = 0; idx < length; idx++) {
+        const auto term = std::conj(arr[idx ^ x_mask]) * arr[idx];
+        if ((std::popcount(idx & z_mask) & 1U) == 0) {
+            sum_real += term.real();
+            sum_imag += term.imag();
+        } else {
+            sum_real -= term.real();
+            sum_imag -= term.imag();
+        }
+    }
+    return {static_cast<PrecisionT>(sum_real),
+            static_cast<PrecisionT>(sum_imag)};
+}
+
+/**
+ * @brief Compute pauliMaskInnerProd for several phase masks sharing the same
+ * bit flip mask in a single read-only pass.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param x_mask Bit flip mask.
+ * @param z_masks Phase mask of each term.
+ */
+template <class PrecisionT>
+auto pauliMaskInnerProds(const std::complex<PrecisionT> *arr,
+                         size_t num_qubits, size_t x_mask,
+                         const std::vector<size_t> &z_masks)
+    -> std::vector<std::complex<PrecisionT>> {
+    const size_t length = Util::exp2(num_qubits);
+    const size_t num_terms = z_masks.size();
+    const size_t *z_masks_ptr = z_masks.data();
+
+    // Real and imaginary parts of each term are interleaved
+    using AccT = Util::accumulator_t<PrecisionT>;
+    std::vector<AccT> acc(2 * num_terms, 0.0);
+    [[maybe_unused]] const size_t num_acc = acc.size();
+    AccT *acc_ptr = acc.data();
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static) \
+            reduction(+:acc_ptr[:num_acc])
+    #endif
+    // clang-format on
+    for (size_t idx = 0; idx < length; idx++) {
+        const auto term = std::conj(arr[idx ^ x_mask]) * arr[idx];
+        for (size_t t = 0; t < num_terms; t++) {
+            if ((std::popcount(idx & z_masks_ptr[t]) & 1U) == 0) {
+                acc_ptr[2 * t] += term.real();
+                acc_ptr[2 * t + 1] += term.imag();
+            } else {
+                acc_ptr[2 * t] -= term.real();
+                acc_ptr[2 * t + 1] -= term.imag();
+            }
+        }
+    }
+
+    std::vector<std::complex<PrecisionT>> res(num_terms);
+    for (size_t t = 0; t < num_terms; t++) {
+        res[t] = {static_cast<PrecisionT>(acc[2 * t]),
+                  static_cast<PrecisionT>(acc[2 * t + 1])};
+    }
+    return res;
+}
+
+/**
+ * @brief Real part of @f$i^{n_Y} z@f$.
+ *
+ * @param res Complex number @f$z@f$, e.g. the result of pauliMaskInnerProd.
+ * @param num_y Number of Y in the Pauli word.
+ */
+template <class PrecisionT>
+auto applyYPhase(const std::complex<PrecisionT> &res, size_t num_y)
+    -> PrecisionT {
+    switch (num_y % 4) {
+    case 0:
+        return res.real();
+    case 1:
+        return -res.imag();
+    case 2:
+        return -res.real();
+    default:
+        return res.imag();
+    }
+}
+
+/**
+ * @brief Expectation value of a Pauli word.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param masks Bit masks of the Pauli word.
+ */
+template <class PrecisionT>
+auto expvalPauliWord(const std::complex<PrecisionT> *arr, size_t num_qubits,
+                     const PauliWordMasks &masks) -> PrecisionT {
+    return applyYPhase(
+        pauliMaskInnerProd(arr, num_qubits, masks.x_mask, masks.z_mask),
+        masks.num_y);
+}
+
+/**
+ * @brief Expectation value of a Pauli word.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param pauli_word String consisting of 'I', 'X', 'Y', and 'Z'.
+ * @param wires Wires each character of the word acts on.
+ */
+template <class PrecisionT>
+auto expvalPauliWord(const std::complex<PrecisionT> *arr, size_t num_qubits,
+                     std::string_view pauli_word,
+                     const std::vector<size_t> &wires) -> PrecisionT {
+    return expvalPauliWord(arr, num_qubits,
+                           getPauliWordMasks(pauli_word, wires, num_qubits));
+}
+
+/**
+ * @brief Expectation value of a dense matrix acting on the given wires,
+ * computed in a single read-only pass.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param matrix Square matrix in row-major order.
+ * @param wires Wires the matrix acts on. wires[0] corresponds to the most
+ * significant bit of the matrix index.
+ */
+template <class PrecisionT>
+auto expvalMatrix(const std::complex<PrecisionT> *arr, size_t num_qubits,
+                  const std::complex<PrecisionT> *matrix,
+                  const std::vector<size_t> &wires) -> PrecisionT {
+    const size_t num_wires = wires.size();
+    PL_ABORT_IF(num_wires == 0 || num_wires > num_qubits,
+                "Invalid number of wires.");
+    const size_t dim = Util::exp2(num_wires);
+
+    // Bit positions of the wires in ascending order, used for inserting
+    // zeros into the outer index.
+    std::vector<size_t> rev_wires(num_wires);
+    // Offsets of the statevector index for each internal index
+    std::vector<size_t> offsets(dim, 0);
+    for (size_t k = 0; k < num_wires; k++) {
+        PL_ABORT_IF(wires[k] >= num_qubits, "Invalid wire index.");
+        rev_wires[k] = num_qubits - 1 - wires[k];
+    }
+    for (size_t inner = 0; inner < dim; inner++) {
+        for (size_t k = 0; k < num_wires; k++) {
+            if (((inner >> (num_wires - 1 - k)) & 1U) != 0) {
+                offsets[inner] |= static_cast<size_t>(1U) << rev_wires[k];
+            }
+        }
+    }
+    std::sort(rev_wires.begin(), rev_wires.end());
+
+    const size_t num_outer = Util::exp2(num_qubits - num_wires);
+    Util::accumulator_t<PrecisionT> sum = 0.0;
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static) reduction(+:sum)
+    #endif
+    // clang-format on
+    for (size_t outer = 0; outer < num_outer; outer++) {
+        size_t base = outer;
+        for (const size_t rev_wire : rev_wires) {
+            base = ((base >> rev_wire) << (rev_wire + 1)) |
+                   (base & Util::fillTrailingOnes(rev_wire));
+        }
+        for (size_t row = 0; row < dim; row++) {
+            std::complex<PrecisionT> row_sum{0.0, 0.0};
+            for (size_t col = 0; col < dim; col++) {
+                row_sum += matrix[row * dim + col] * arr[base + offsets[col]];
+            }
+            sum += std::real(std::conj(arr[base + offsets[row]]) * row_sum);
+        }
+    }
+    return static_cast<PrecisionT>(sum);
+}
+
+/**
+ * @brief Expectation values of several dense matrices acting on the same
+ * wires, computed together in a single read-only pass.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param matrices Square matrices in row-major order, stored one after
+ * another.
+ * @param num_matrices Number of matrices.
+ * @param wires Wires the matrices act on. wires[0] corresponds to the most
+ * significant bit of the matrix index.
+ */
+template <class PrecisionT>
+auto expvalMatrices(const std::complex<PrecisionT> *arr, size_t num_qubits,
+                    const std::complex<PrecisionT> *matrices,
+                    size_t num_matrices, const std::vector<size_t> &wires)
+    -> std::vector<PrecisionT> {
+    const size_t num_wires = wires.size();
+    PL_ABORT_IF(num_wires == 0 || num_wires > num_qubits,
+                "Invalid number of wires.");
+    const size_t dim = Util::exp2(num_wires);
+
+    std::vector<size_t> rev_wires(num_wires);
+    std::vector<size_t> offsets(dim, 0);
+    for (size_t k = 0; k < num_wires; k++) {
+        PL_ABORT_IF(wires[k] >= num_qubits, "Invalid wire index.");
+        rev_wires[k] = num_qubits - 1 - wires[k];
+    }
+    for (size_t inner = 0; inner < dim; inner++) {
+        for (size_t k = 0; k < num_wires; k++) {
+            if (((inner >> (num_wires - 1 - k)) & 1U) != 0) {
+                offsets[inner] |= static_cast<size_t>(1U) << rev_wires[k];
+            }
+        }
+    }
+    std::sort(rev_wires.begin(), rev_wires.end());
+
+    const size_t num_outer = Util::exp2(num_qubits - num_wires);
+    using AccT = Util::accumulator_t<PrecisionT>;
+    std::vector<AccT> acc(num_matrices, 0.0);
+    [[maybe_unused]] const size_t num_acc = acc.size();
+    AccT *acc_ptr = acc.data();
+    const size_t *offsets_ptr = offsets.data();
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static) \
+            reduction(+:acc_ptr[:num_acc])
+    #endif
+    // clang-format on
+    for (size_t outer = 0; outer < num_outer; outer++) {
+        size_t base = outer;
+        for (const size_t rev_wire : rev_wires) {
+            base = ((base >> rev_wire) << (rev_wire + 1)) |
+                   (base & Util::fillTrailingOnes(rev_wire));
+        }
+        for (size_t m = 0; m < num_matrices; m++) {
+            const std::complex<PrecisionT> *matrix =
+                matrices + m * dim * dim;
+            for (size_t row = 0; row < dim; row++) {
+                std::complex<PrecisionT> row_sum{0.0, 0.0};
+                for (size_t col = 0; col < dim; col++) {
+                    row_sum +=
+                        matrix[row * dim + col] * arr[base + offsets_ptr[col]];
+                }
+                acc_ptr[m] += std::real(
+                    std::conj(arr[base + offsets_ptr[row]]) * row_sum);
+            }
+        }
+    }
+
+    std::vector<PrecisionT> res(num_matrices);
+    std::transform(acc.begin(), acc.end(), res.begin(), [](AccT val) {
+        return static_cast<PrecisionT>(val);
+    });
+    return res;
+}
+
+/**
+ * @brief Probability of measuring the given basis state on the given wires,
+ * i.e. the expectation value of the projector onto it.
+ *
+ * Only the @f$2^{n-k}@f$ amplitudes consistent with the basis state are
+ * read.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param basis_state Bit of each wire, 0 or 1.
+ * @param wires Wires of the projector.
+ */
+template <class PrecisionT>
+auto projectorProb(const std::complex<PrecisionT> *arr, size_t num_qubits,
+                   const std::vector<size_t> &basis_state,
+                   const std::vector<size_t> &wires) -> PrecisionT {
+    const size_t num_wires = wires.size();
+    PL_ABORT_IF(basis_state.size() != num_wires,
+                "The basis state must have one bit for each wire.");
+    PL_ABORT_IF(num_wires > num_qubits, "Invalid number of wires.");
+
+    std::vector<size_t> rev_wires(num_wires);
+    size_t offset = 0;
+    for (size_t k = 0; k < num_wires; k++) {
+        PL_ABORT_IF(wires[k] >= num_qubits, "Invalid wire index.");
+        PL_ABORT_IF(basis_state[k] > 1, "The basis state must consist of 0 "
+                                        "and 1.");
+        rev_wires[k] = num_qubits - 1 - wires[k];
+        offset |= basis_state[k] << rev_wires[k];
+    }
+    std::sort(rev_wires.begin(), rev_wires.end());
+    PL_ABORT_IF(std::adjacent_find(rev_wires.begin(), rev_wires.end()) !=
+                    rev_wires.end(),
+                "Wires must be unique.");
+
+    const size_t num_outer = Util::exp2(num_qubits - num_wires);
+    Util::accumulator_t<PrecisionT> sum = 0.0;
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static) reduction(+:sum)
+    #endif
+    // clang-format on
+    for (size_t outer = 0; outer < num_outer; outer++) {
+        size_t base = outer;
+        for (const size_t rev_wire : rev_wires) {
+            base = ((base >> rev_wire) << (rev_wire + 1)) |
+                   (base & Util::fillTrailingOnes(rev_wire));
+        }
+        sum += std::norm(arr[base | offset]);
+    }
+    return static_cast<PrecisionT>(sum);
+}
+
+/**
+ * @brief Compute the first and second moments of several diagonal
+ * observables in a single read-only pass.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param diagonals Diagonal of each observable. The diagonal of an
+ * observable acting on k wires has 2^k entries.
+ * @param wires_list Wires each observable acts on. wires[0] corresponds to
+ * the most significant bit of the diagonal index.
+ * @return std::vector<PrecisionT> Vector of size 2 * diagonals.size() + 1.
+ * Elements 2i and 2i + 1 are @f$\langle D_i \rangle@f$ and
+ * @f$\langle D_i^2 \rangle@f$, and the last element is the squared norm of
+ * the statevector.
+ */
+template <class PrecisionT>
+auto diagonalMoments(const std::complex<PrecisionT> *arr, size_t num_qubits,
+                     const std::vector<std::vector<PrecisionT>> &diagonals,
+                     const std::vector<std::vector<size_t>> &wires_list)
+    -> std::vector<PrecisionT> {
+    PL_ABORT_IF(diagonals.size() != wires_list.size(),
+                "The lengths of the list of diagonals and wires do not "
+                "match.");
+    const size_t length = Util::exp2(num_qubits);
+    const size_t num_obs = diagonals.size();
+
+    // Bit positions of the wires of all observables, in the order of the
+    // diagonal index bits from the most significant one
+    std::vector<size_t> rev_wires;
+    std::vector<size_t> wire_offsets{0};
+    std::vector<const PrecisionT *> diag_ptrs;
+    for (size_t obs = 0; obs < num_obs; obs++) {
+        PL_ABORT_IF(diagonals[obs].size() != Util::exp2(wires_list[obs].size()),
+                    "The size of the diagonal does not match the number of "
+                    "wires.");
+        for (const size_t wire : wires_list[obs]) {
+            PL_ABORT_IF(wire >= num_qubits, "Invalid wire index.");
+            rev_wires.emplace_back(num_qubits - 1 - wire);
+        }
+        wire_offsets.emplace_back(rev_wires.size());
+        diag_ptrs.emplace_back(diagonals[obs].data());
+    }
+    const size_t *rev_wires_ptr = rev_wires.data();
+    const size_t *wire_offsets_ptr = wire_offsets.data();
+    const PrecisionT *const *diag_ptrs_ptr = diag_ptrs.data();
+
+    using AccT = Util::accumulator_t<PrecisionT>;
+    std::vector<AccT> acc(2 * num_obs + 1, 0.0);
+    [[maybe_unused]] const size_t num_acc = acc.size();
+    AccT *acc_ptr = acc.data();
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static) \
+            reduction(+:acc_ptr[:num_acc])
+    #endif
+    // clang-format on
+    for (size_t idx = 0; idx < length; idx++) {
+        const auto prob = static_cast<AccT>(std::norm(arr[idx]));
+        for (size_t obs = 0; obs < num_obs; obs++) {
+            size_t diag_idx = 0;
+            const size_t k_end = wire_offsets_ptr[obs + 1];
+            for (size_t k = wire_offsets_ptr[obs]; k < k_end; k++) {
+                diag_idx = (diag_idx << 1U) | ((idx >> rev_wires_ptr[k]) & 1U);
+            }
+            const auto value = static_cast<AccT>(diag_ptrs_ptr[obs][diag_idx]);
+            acc_ptr[2 * obs] += prob * value;
+            acc_ptr[2 * obs + 1] += prob * value * value;
+        }
+        acc_ptr[2 * num_obs] += prob;
+    }
+    return {acc.begin(), acc.end()};
+}
+
+/**
+ * @brief Compute the marginal probabilities of the given wires.
+ *
+ * The statevector is split into a fixed number of chunks with their own
+ * partial histograms, which are merged in order, so the result does not
+ * depend on the number of threads.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param wires Wires to compute the marginal probabilities of. wires[0]
+ * corresponds to the most significant bit of the output index.
+ */
+template <class PrecisionT>
+auto marginalProbs(const std::complex<PrecisionT> *arr, size_t num_qubits,
+                   const std::vector<size_t> &wires) -> std::vector<double> {
+    constexpr size_t max_num_chunks = 64;
+    const size_t num_wires = wires.size();
+    const size_t length = Util::exp2(num_qubits);
+    const size_t num_outcomes = Util::exp2(num_wires);
+    const size_t num_chunks = std::min(max_num_chunks, length);
+    const size_t chunk_size = length / num_chunks;
+
+    std::vector<size_t> rev_wires(num_wires);
+    for (size_t k = 0; k < num_wires; k++) {
+        PL_ABORT_IF(wires[k] >= num_qubits, "Invalid wire index.");
+        rev_wires[k] = num_qubits - 1 - wires[k];
+    }
+
+    std::vector<double> chunk_probs(num_chunks * num_outcomes, 0.0);
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static)
+    #endif
+    // clang-format on
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+        double *local_probs = chunk_probs.data() + chunk * num_outcomes;
+        for (size_t idx = chunk * chunk_size; idx < (chunk + 1) * chunk_size;
+             idx++) {
+            size_t outcome = 0;
+            for (const size_t rev_wire : rev_wires) {
+                outcome = (outcome << 1U) | ((idx >> rev_wire) & 1U);
+            }
+            local_probs[outcome] += static_cast<double>(std::norm(arr[idx]));
+        }
+    }
+
+    std::vector<double> probs(chunk_probs.begin(),
+                              chunk_probs.begin() +
+                                  static_cast<ptrdiff_t>(num_outcomes));
+    for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+        for (size_t outcome = 0; outcome < num_outcomes; outcome++) {
+            probs[outcome] += chunk_probs[chunk * num_outcomes + outcome];
+        }
+    }
+    return probs;
+}
+
+/**
+ * @brief Compute the reduced density matrix of the given wires,
+ * @f$\rho_{ab} = \sum_e \psi_{ae} \psi^*_{be}@f$, where @f$e@f$ runs over the
+ * basis states of the traced-out wires.
+ *
+ * The traced-out indices are split into a fixed number of chunks, each
+ * accumulating its own matrix, which are merged in order, so the result
+ * does not depend on the number of threads. Within a chunk, the amplitudes
+ * of a block of traced-out indices are gathered first, and only the upper
+ * triangle is accumulated, as the matrix is Hermitian.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param wires Distinct wires to keep. wires[0] corresponds to the most
+ * significant bit of the row and column indices.
+ * @return Row-major density matrix of size @f$4^k@f$ for @f$k@f$ wires.
+ */
+template <class PrecisionT>
+auto reducedDensityMatrix(const std::complex<PrecisionT> *arr,
+                          size_t num_qubits, const std::vector<size_t> &wires)
+    -> std::vector<std::complex<PrecisionT>> {
+    using AccT = std::complex<double>;
+    constexpr size_t max_num_chunks = 64;
+    // Bound on the number of elements of the matrices of all chunks
+    constexpr size_t max_chunk_elements = size_t{1U} << 22U;
+    constexpr size_t block_size = 16;
+
+    const size_t num_wires = wires.size();
+    PL_ABORT_IF(num_wires > num_qubits,
+                "The number of wires must not exceed the number of qubits.");
+    const size_t dim = Util::exp2(num_wires);
+    const size_t num_env = Util::exp2(num_qubits - num_wires);
+
+    // Offsets of the statevector index for each row, and bit positions of
+    // the wires in ascending order
+    std::vector<size_t> rev_wires(num_wires);
+    std::vector<size_t> offsets(dim, 0);
+    size_t wire_mask = 0;
+    for (size_t k = 0; k < num_wires; k++) {
+        PL_ABORT_IF(wires[k] >= num_qubits, "Invalid wire index.");
+        rev_wires[k] = num_qubits - 1 - wires[k];
+        PL_ABORT_IF(((wire_mask >> rev_wires[k]) & 1U) != 0,
+                    "Wires must be distinct.");
+        wire_mask |= size_t{1U} << rev_wires[k];
+    }
+    for (size_t row = 0; row < dim; row++) {
+        for (size_t k = 0; k < num_wires; k++) {
+            if (((row >> (num_wires - 1 - k)) & 1U) != 0) {
+                offsets[row] |= size_t{1U} << rev_wires[k];
+            }
+        }
+    }
+    std::sort(rev_wires.begin(), rev_wires.end());
+
+    const size_t num_chunks =
+        std::min({max_num_chunks, num_env,
+                  std::max(size_t{1}, max_chunk_elements / (dim * dim))});
+    const size_t chunk_size = (num_env + num_chunks - 1) / num_chunks;
+    std::vector<AccT> chunk_rho(num_chunks * dim * dim, AccT{0.0, 0.0});
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static)
+    #endif
+    // clang-format on
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+        AccT *local_rho = chunk_rho.data() + chunk * dim * dim;
+        // block[row * block_size + e] holds the amplitude of the row for the
+        // e-th traced-out index of the block
+        std::vector<AccT> block(dim * block_size);
+        const size_t env_end = std::min(num_env, (chunk + 1) * chunk_size);
+        for (size_t env_begin = chunk * chunk_size; env_begin < env_end;
+             env_begin += block_size) {
+            const size_t num_block = std::min(block_size, env_end - env_begin);
+            for (size_t e = 0; e < num_block; e++) {
+                size_t base = env_begin + e;
+                for (const size_t rev_wire : rev_wires) {
+                    base = ((base >> rev_wire) << (rev_wire + 1)) |
+                           (base & Util::fillTrailingOnes(rev_wire));
+                }
+                for (size_t row = 0; row < dim; row++) {
+                    block[row * block_size + e] =
+                        static_cast<AccT>(arr[base + offsets[row]]);
+                }
+            }
+            for (size_t row = 0; row < dim; row++) {
+                const AccT *row_amps = block.data() + row * block_size;
+                for (size_t col = row; col < dim; col++) {
+                    const AccT *col_amps = block.data() + col * block_size;
+                    AccT sum{0.0, 0.0};
+                    for (size_t e = 0; e < num_block; e++) {
+                        sum += row_amps[e] * std::conj(col_amps[e]);
+                    }
+                    local_rho[row * dim + col] += sum;
+                }
+            }
+        }
+    }
+
+    std::vector<std::complex<PrecisionT>> rho(dim * dim);
+    for (size_t row = 0; row < dim; row++) {
+        for (size_t col = row; col < dim; col++) {
+            AccT sum = chunk_rho[row * dim + col];
+            for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+                sum += chunk_rho[(chunk * dim + row) * dim + col];
+            }
+            rho[row * dim + col] = static_cast<std::complex<PrecisionT>>(sum);
+            rho[col * dim + row] =
+                static_cast<std::complex<PrecisionT>>(std::conj(sum));
+        }
+    }
+    return rho;
+}
+
+/**
+ * @brief Compute the purity @f$\mathrm{Tr}(\rho^2)@f$ of the reduced state
+ * of the given wires.
+ *
+ * The purity equals the squared Frobenius norm of the Hermitian @f$\rho@f$,
+ * so no matrix product is formed. As the reduced states of a pure state on
+ * complementary wires have the same purity, the smaller of the two reduced
+ * density matrices is computed.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ * @param wires Distinct wires to keep.
+ */
+template <class PrecisionT>
+auto reducedPurity(const std::complex<PrecisionT> *arr, size_t num_qubits,
+                   const std::vector<size_t> &wires) -> PrecisionT {
+    std::vector<size_t> kept = wires;
+    if (2 * wires.size() > num_qubits) {
+        PL_ABORT_IF(wires.size() > num_qubits,
+                    "The number of wires must not exceed the number of "
+                    "qubits.");
+        std::vector<bool> is_kept(num_qubits, false);
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits, "Invalid wire index.");
+            PL_ABORT_IF(is_kept[wire], "Wires must be distinct.");
+            is_kept[wire] = true;
+        }
+        kept.clear();
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            if (!is_kept[wire]) {
+                kept.emplace_back(wire);
+            }
+        }
+    }
+    const auto rho = reducedDensityMatrix(arr, num_qubits, kept);
+    double purity = 0.0;
+    for (const auto &elt : rho) {
+        purity += static_cast<double>(std::norm(elt));
+    }
+    return static_cast<PrecisionT>(purity);
+}
+
+/**
+ * @brief Compute the cumulative distribution of the computational basis
+ * measurement, i.e. @f$c_i = \sum_{j \leq i} |\psi_j|^2@f$.
+ *
+ * The statevector is split into blocks of a fixed size. Each block is summed
+ * in order and the block offsets are accumulated serially, so the result
+ * does not depend on the number of threads.
+ *
+ * @param arr Pointer to the statevector.
+ * @param num_qubits Number of qubits.
+ */
+template <class PrecisionT>
+auto cumulativeProbs(const std::complex<PrecisionT> *arr, size_t num_qubits)
+    -> std::vector<double> {
+    constexpr size_t block_size = size_t{1U} << 12U;
+    const size_t length = Util::exp2(num_qubits);
+    const size_t num_blocks = (length + block_size - 1) / block_size;
+    std::vector<double> cdf(length);
+    std::vector<double> block_offsets(num_blocks + 1, 0.0);
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static)
+    #endif
+    // clang-format on
+    for (size_t block = 0; block < num_blocks; block++) {
+        const size_t end = std::min(length, (block + 1) * block_size);
+        double sum = 0.0;
+        for (size_t idx = block * block_size; idx < end; idx++) {
+            sum += static_cast<double>(std::norm(arr[idx]));
+            cdf[idx] = sum;
+        }
+        block_offsets[block + 1] = sum;
+    }
+    for (size_t block = 0; block < num_blocks; block++) {
+        block_offsets[block + 1] += block_offsets[block];
+    }
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static)
+    #endif
+    // clang-format on
+    for (size_t block = 1; block < num_blocks; block++) {
+        const size_t end = std::min(length, (block + 1) * block_size);
+        const double offset = block_offsets[block];
+        for (size_t idx = block * block_size; idx < end; idx++) {
+            cdf[idx] += offset;
+        }
+    }
+    return cdf;
+}
+
+/**
+ * @brief Apply the unnormalized Walsh-Hadamard transform in place,
+ * @f$\hat{f}(m) = \sum_k (-1)^{|k \wedge m|} f(k)@f$.
+ *
+ * Each of the `num_bits` butterfly stages runs in parallel over the
+ * pairs of entries it combines.
+ *
+ * @param data Array of size @f$2^{\textrm{num\_bits}}@f$.
+ * @param num_bits Number of bits of the indices.
+ */
+template <class PrecisionT>
+void walshHadamardTransform(PrecisionT *data, size_t num_bits) {
+    const size_t half_length = Util::exp2(num_bits) / 2;
+    for (size_t bit = 0; bit < num_bits; bit++) {
+        const size_t stride = size_t{1U} << bit;
+        const size_t low_mask = Util::fillTrailingOnes(bit);
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static) \
+                if (half_length >= (size_t{1U} << 14U))
+        #endif
+        // clang-format on
+        for (size_t pair = 0; pair < half_length; pair++) {
+            const size_t i0 = ((pair & ~low_mask) << 1U) | (pair & low_mask);
+            const size_t i1 = i0 | stride;
+            const PrecisionT v0 = data[i0];
+            const PrecisionT v1 = data[i1];
+            data[i0] = v0 + v1;
+            data[i1] = v0 - v1;
+        }
+    }
+}
+
+/**
+ * @brief Compute the expected values of products of Pauli Z operators from
+ * probabilities, @f$\langle Z_m \rangle = \sum_k (-1)^{|k \wedge m|}
+ * p_k@f$.
+ *
+ * With more masks than bits, all @f$2^n@f$ correlators are obtained by a
+ * Walsh-Hadamard transform of the probabilities at a cost of
+ * @f$n 2^n@f$. Otherwise, the masks are accumulated in a single pass over
+ * the probabilities.
+ *
+ * @param probs Probabilities of the @f$2^n@f$ outcomes of `num_bits` bits.
+ * @param num_bits Number of bits @f$n@f$.
+ * @param masks Bits each product of Z operators acts on.
+ */
+template <class PrecisionT>
+auto zCorrelators(const std::vector<PrecisionT> &probs, size_t num_bits,
+                  const std::vector<size_t> &masks) -> std::vector<PrecisionT> {
+    const size_t length = Util::exp2(num_bits);
+    PL_ABORT_IF(probs.size() != length,
+                "The number of probabilities must be 2^num_bits.");
+    const size_t num_masks = masks.size();
+    std::vector<PrecisionT> res(num_masks);
+
+    if (num_masks > num_bits) {
+        std::vector<PrecisionT> spectrum(probs);
+        walshHadamardTransform(spectrum.data(), num_bits);
+        for (size_t t = 0; t < num_masks; t++) {
+            res[t] = spectrum[masks[t] & (length - 1)];
+        }
+        return res;
+    }
+
+    using AccT = Util::accumulator_t<PrecisionT>;
+    std::vector<AccT> sums(num_masks, 0.0);
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel if (length >= (size_t{1U} << 14U))
+    #endif
+    // clang-format on
+    {
+        std::vector<AccT> local_sums(num_masks, 0.0);
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp for schedule(static) nowait
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < length; k++) {
+            const AccT prob = probs[k];
+            for (size_t t = 0; t < num_masks; t++) {
+                local_sums[t] +=
+                    ((std::popcount(k & masks[t]) & 1U) == 0) ? prob : -prob;
+            }
+        }
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp critical
+        #endif
+        // clang-format on
+        {
+            for (size_t t = 0; t < num_masks; t++) {
+                sums[t] += local_sums[t];
+            }
+        }
+    }
+    std::transform(sums.begin(), sums.end(), res.begin(),
+                   [](AccT sum) { return static_cast<PrecisionT>(sum); });
+    return res;
+}
+} // namespace Pennylane::MeasuresKernels
@@ -0,0 +1,281 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a Hamiltonian represented as a linear combination of Pauli words.
+ */
+#pragma once
+
+#include "Error.hpp"
+#include "MeasuresKernels.hpp"
+#include "TypeTraits.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <complex>
+#include <map>
+#include <numeric>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Pennylane {
+/**
+ * @brief Hamiltonian given by a linear combination of Pauli words,
+ * @f$H = \sum_t c_t P_t@f$.
+ *
+ * Terms sharing the same bit flip (X/Y) mask map each basis state to the same
+ * basis state, up to a phase. Evaluating the Hamiltonian therefore requires
+ * one pass over the statevector per distinct X/Y mask, instead of one pass
+ * per term.
+ *
+ * @tparam T Floating point precision.
+ */
+template <class T> class PauliSum {
+  public:
+    using ComplexT = std::complex<T>;
+
+    /**
+     * @brief Terms of the Hamiltonian sharing the same bit flip mask.
+     *
+     * Each term is stored as a pair of its phase mask and its coefficient
+     * multiplied by @f$i^{n_Y}@f$.
+     */
+    struct Group {
+        size_t x_mask;
+        std::vector<std::pair<size_t, ComplexT>> terms;
+    };
+
+    /**
+     * @brief Terms of the Hamiltonian which commute qubit-wise, i.e. act on
+     * each wire either trivially or as the same Pauli operator.
+     *
+     * Rotating the wires of `x_mask` by H and those of `y_mask` by
+     * @f$H S^\dagger@f$ maps each term to the product of Pauli Z on its
+     * support, which is diagonal. Each term is stored as a pair of its
+     * support mask and its coefficient.
+     */
+    struct QubitWiseGroup {
+        size_t x_mask;
+        size_t y_mask;
+        size_t z_mask;
+        std::vector<std::pair<size_t, T>> terms;
+    };
+
+  private:
+    std::vector<T> coeffs_;
+    std::vector<std::string> words_;
+    std::vector<std::vector<size_t>> wires_;
+
+  public:
+    /**
+     * @brief Construct a PauliSum.
+     *
+     * @param coeffs Coefficient of each term.
+     * @param words Pauli word of each term, consisting of 'I', 'X', 'Y', and
+     * 'Z'.
+     * @param wires Wires each character of the corresponding Pauli word acts
+     * on.
+     */
+    PauliSum(std::vector<T> coeffs, std::vector<std::string> words,
+             std::vector<std::vector<size_t>> wires)
+        : coeffs_{std::move(coeffs)}, words_{std::move(words)},
+          wires_{std::move(wires)} {
+        PL_ABORT_IF(coeffs_.size() != words_.size() ||
+                        coeffs_.size() != wires_.size(),
+                    "The number of coefficients, Pauli words, and wires must "
+                    "all be equal.");
+        for (size_t t = 0; t < words_.size(); t++) {
+            PL_ABORT_IF(words_[t].size() != wires_[t].size(),
+                        "The length of each Pauli word must be the same as "
+                        "the number of its wires.");
+        }
+    }
+
+    /**
+     * @brief Get the number of terms.
+     */
+    [[nodiscard]] auto getSize() const -> size_t { return coeffs_.size(); }
+
+    [[nodiscard]] auto getCoeffs() const -> const std::vector<T> & {
+        return coeffs_;
+    }
+
+    [[nodiscard]] auto getWords() const -> const std::vector<std::string> & {
+        return words_;
+    }
+
+    [[nodiscard]] auto getWires() const
+        -> const std::vector<std::vector<size_t>> & {
+        return wires_;
+    }
+
+    /**
+     * @brief Get all wires the Hamiltonian acts on in ascending order.
+     */
+    [[nodiscard]] auto getAllWires() const -> std::vector<size_t> {
+        std::set<size_t> all_wires;
+        for (const auto &term_wires : wires_) {
+            all_wires.insert(term_wires.begin(), term_wires.end());
+        }
+        return {all_wires.begin(), all_wires.end()};
+    }
+
+    /**
+     * @brief Group terms by their bit flip mask for the given number of
+     * qubits.
+     *
+     * @param num_qubits Number of qubits.
+     */
+    [[nodiscard]] auto getGroups(size_t num_qubits) const
+        -> std::vector<Group> {
+        constexpr std::array<ComplexT, 4> i_pow{
+            ComplexT{1.0, 0.0}, ComplexT{0.0, 1.0}, ComplexT{-1.0, 0.0},
+            ComplexT{0.0, -1.0}};
+        std::map<size_t, size_t> group_idx;
+        std::vector<Group> groups;
+        for (size_t t = 0; t < coeffs_.size(); t++) {
+            const auto masks = MeasuresKernels::getPauliWordMasks(
+                words_[t], wires_[t], num_qubits);
+            const auto [iter, inserted] =
+                group_idx.emplace(masks.x_mask, groups.size());
+            if (inserted) {
+                groups.push_back({masks.x_mask, {}});
+            }
+            groups[iter->second].terms.emplace_back(
+                masks.z_mask, coeffs_[t] * i_pow[masks.num_y % 4]);
+        }
+        return groups;
+    }
+
+    /**
+     * @brief Partition the terms into groups commuting qubit-wise for the
+     * given number of qubits.
+     *
+     * Terms are placed greedily into the first compatible group, those with
+     * the largest support first.
+     *
+     * @param num_qubits Number of qubits.
+     */
+    [[nodiscard]] auto getQubitWiseGroups(size_t num_qubits) const
+        -> std::vector<QubitWiseGroup> {
+        std::vector<MeasuresKernels::PauliWordMasks> masks;
+        masks.reserve(coeffs_.size());
+        for (size_t t = 0; t < coeffs_.size(); t++) {
+            masks.emplace_back(MeasuresKernels::getPauliWordMasks(
+                words_[t], wires_[t], num_qubits));
+        }
+        std::vector<size_t> order(coeffs_.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return std::popcount(masks[a].x_mask | masks[a].z_mask) >
+                   std::popcount(masks[b].x_mask | masks[b].z_mask);
+        });
+
+        std::vector<QubitWiseGroup> groups;
+        for (const size_t t : order) {
+            const size_t x_mask = masks[t].x_mask & ~masks[t].z_mask;
+            const size_t y_mask = masks[t].x_mask & masks[t].z_mask;
+            const size_t z_mask = masks[t].z_mask & ~masks[t].x_mask;
+            const auto iter = std::find_if(
+                groups.begin(), groups.end(), [&](const QubitWiseGroup &g) {
+                    return (x_mask & (g.y_mask | g.z_mask)) == 0 &&
+                           (y_mask & (g.x_mask | g.z_mask)) == 0 &&
+                           (z_mask & (g.x_mask | g.y_mask)) == 0;
+                });
+            QubitWiseGroup &group =
+                (iter != groups.end())
+                    ? *iter
+                    : groups.emplace_back(QubitWiseGroup{0, 0, 0, {}});
+            group.x_mask |= x_mask;
+            group.y_mask |= y_mask;
+            group.z_mask |= z_mask;
+            group.terms.emplace_back(x_mask | y_mask | z_mask, coeffs_[t]);
+        }
+        return groups;
+    }
+
+    /**
+     * @brief Compute the expectation value of the Hamiltonian.
+     *
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     */
+    [[nodiscard]] auto expval(const ComplexT *arr, size_t num_qubits) const
+        -> T {
+        using AccT = Util::accumulator_t<T>;
+        const size_t length = Util::exp2(num_qubits);
+        AccT result = 0.0;
+        for (const auto &group : getGroups(num_qubits)) {
+            const size_t x_mask = group.x_mask;
+            const auto &terms = group.terms;
+            AccT sum = 0.0;
+
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp parallel for schedule(static) reduction(+:sum)
+            #endif
+            // clang-format on
+            for (size_t idx = 0; idx < length; idx++) {
+                ComplexT factor{0.0, 0.0};
+                for (const auto &[z_mask, coeff] : terms) {
+                    factor += ((std::popcount(idx & z_mask) & 1U) == 0)
+                                  ? coeff
+                                  : -coeff;
+                }
+                sum += std::real(std::conj(arr[idx ^ x_mask]) * factor *
+                                 arr[idx]);
+            }
+            result += sum;
+        }
+        return static_cast<T>(result);
+    }
+
+    /**
+     * @brief Compute @f$H|\psi\rangle@f$.
+     *
+     * @param arr Pointer to the statevector @f$|\psi\rangle@f$.
+     * @param out Pointer to the output. Must not alias arr.
+     * @param num_qubits Number of qubits.
+     */
+    void apply(const ComplexT *arr, ComplexT *out, size_t num_qubits) const {
+        const size_t length = Util::exp2(num_qubits);
+        std::fill(out, out + length, ComplexT{0.0, 0.0});
+        for (const auto &group : getGroups(num_qubits)) {
+            const size_t x_mask = group.x_mask;
+            const auto &terms = group.terms;
+
+            // Each output index is written by exactly one idx for a given
+            // x_mask, so the loop is free of data races.
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp parallel for schedule(static)
+            #endif
+            // clang-format on
+            for (size_t idx = 0; idx < length; idx++) {
+                ComplexT factor{0.0, 0.0};
+                for (const auto &[z_mask, coeff] : terms) {
+                    factor += ((std::popcount(idx & z_mask) & 1U) == 0)
+                                  ? coeff
+                                  : -coeff;
+                }
+                out[idx ^ x_mask] += factor * arr[idx];
+            }
+        }
+    }
+};
+} // namespace Pennylane
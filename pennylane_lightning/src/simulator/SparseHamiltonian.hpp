@@ -0,0 +1,156 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a Hamiltonian represented as a sparse matrix in the CSR format.
+ */
+#pragma once
+
+#include "BitUtil.hpp"
+#include "Error.hpp"
+#include "Kokkos_Sparse.hpp"
+#include "SparseLinearAlgebra.hpp"
+#include "Util.hpp"
+
+#include <complex>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Pennylane {
+/**
+ * @brief Hamiltonian given by a sparse matrix in the compressed sparse row
+ * (CSR) format.
+ *
+ * Applying the Hamiltonian is a single sparse matrix-vector product, so e.g.
+ * molecular Hamiltonians need not be split into their Pauli terms. With
+ * Kokkos, the matrix is copied once to the Kokkos memory space on
+ * construction and reused by every product and expected value, also by the
+ * copies of the Hamiltonian.
+ *
+ * @tparam T Floating point precision.
+ * @tparam IndexT Integer type used as indices of the sparse matrix.
+ */
+template <class T, class IndexT = long> class SparseHamiltonian {
+  public:
+    using ComplexT = std::complex<T>;
+    using IndexType = IndexT;
+
+  private:
+    std::vector<IndexT> row_map_;
+    std::vector<IndexT> entries_;
+    std::vector<ComplexT> values_;
+    size_t num_qubits_;
+#ifdef _ENABLE_KOKKOS
+    std::shared_ptr<Util::KokkosSparseOperator<T>> kokkos_operator_;
+#endif
+
+  public:
+    /**
+     * @brief Construct a SparseHamiltonian.
+     *
+     * @param row_map Element j is the number of non-zero elements in all rows
+     * before row j. Its size is the number of rows plus one, where the number
+     * of rows must be a power of two.
+     * @param entries Column index of each non-zero element.
+     * @param values Non-zero elements.
+     */
+    SparseHamiltonian(std::vector<IndexT> row_map, std::vector<IndexT> entries,
+                      std::vector<ComplexT> values)
+        : row_map_{std::move(row_map)}, entries_{std::move(entries)},
+          values_{std::move(values)} {
+        PL_ABORT_IF(row_map_.size() < 2, "The row_map must have at least two "
+                                         "elements.");
+        PL_ABORT_IF(entries_.size() != values_.size(),
+                    "The number of column indices and values must be equal.");
+        const auto num_rows = row_map_.size() - 1;
+        PL_ABORT_IF(!Util::isPerfectPowerOf2(num_rows),
+                    "The number of rows must be a power of two.");
+        num_qubits_ = Util::log2PerfectPower(num_rows);
+        PL_ABORT_IF(row_map_.front() != 0 ||
+                        row_map_.back() != static_cast<IndexT>(values_.size()),
+                    "The row_map is inconsistent with the number of non-zero "
+                    "elements.");
+        for (const auto col : entries_) {
+            PL_ABORT_IF(col < 0 || static_cast<size_t>(col) >= num_rows,
+                        "Invalid column index.");
+        }
+#ifdef _ENABLE_KOKKOS
+        if constexpr (std::is_same_v<IndexT, Util::index_type>) {
+            kokkos_operator_ = std::make_shared<Util::KokkosSparseOperator<T>>(
+                row_map_.data(), static_cast<IndexT>(num_rows),
+                entries_.data(), values_.data(),
+                static_cast<IndexT>(values_.size()));
+        }
+#endif
+    }
+
+    /**
+     * @brief Get the number of qubits the Hamiltonian acts on.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    [[nodiscard]] auto getRowMap() const -> const std::vector<IndexT> & {
+        return row_map_;
+    }
+
+    [[nodiscard]] auto getEntries() const -> const std::vector<IndexT> & {
+        return entries_;
+    }
+
+    [[nodiscard]] auto getValues() const -> const std::vector<ComplexT> & {
+        return values_;
+    }
+
+    /**
+     * @brief Compute the expectation value of the Hamiltonian.
+     *
+     * @param arr Pointer to the statevector.
+     * @param num_qubits Number of qubits.
+     */
+    [[nodiscard]] auto expval(const ComplexT *arr, size_t num_qubits) const
+        -> T {
+#ifdef _ENABLE_KOKKOS
+        if (kokkos_operator_) {
+            return kokkos_operator_->expval(arr);
+        }
+#endif
+        return Util::expval_Sparse_Matrix_CSR(
+            arr, static_cast<IndexT>(Util::exp2(num_qubits)), row_map_.data(),
+            static_cast<IndexT>(row_map_.size()), entries_.data(),
+            values_.data(), static_cast<IndexT>(values_.size()));
+    }
+
+    /**
+     * @brief Compute @f$H|\psi\rangle@f$.
+     *
+     * @param arr Pointer to the statevector @f$|\psi\rangle@f$.
+     * @param out Pointer to the output. Must not alias arr.
+     * @param num_qubits Number of qubits.
+     */
+    void apply(const ComplexT *arr, ComplexT *out, size_t num_qubits) const {
+#ifdef _ENABLE_KOKKOS
+        if (kokkos_operator_) {
+            kokkos_operator_->apply(arr, out);
+            return;
+        }
+#endif
+        Util::apply_Sparse_Matrix_CSR(
+            arr, static_cast<IndexT>(Util::exp2(num_qubits)), row_map_.data(),
+            static_cast<IndexT>(row_map_.size()), entries_.data(),
+            values_.data(), static_cast<IndexT>(values_.size()), out);
+    }
+};
+} // namespace Pennylane
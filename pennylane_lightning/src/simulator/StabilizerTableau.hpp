@@ -0,0 +1,547 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file StabilizerTableau.hpp
+ * Defines a stabilizer tableau simulating Clifford gates in polynomial time.
+ */
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Constant.hpp"
+#include "ConstantUtil.hpp"
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "Util.hpp"
+
+namespace Pennylane {
+/**
+ * @brief Quantum state of @f$n@f$ qubits reachable from a computational
+ * basis state by Clifford gates, as a stabilizer tableau.
+ *
+ * The state is the unique common +1 eigenstate of @f$n@f$ commuting Pauli
+ * operators @f$(-1)^{r} \bigotimes_q X_q^{x_q} Z_q^{z_q}@f$, where a wire
+ * with @f$x_q = z_q = 1@f$ holds @f$Y_q@f$. A Clifford gate @f$U@f$ maps
+ * each generator @f$P@f$ to @f$UPU^\dagger@f$ in @f$O(n)@f$ bit operations
+ * (Aaronson and Gottesman, Phys. Rev. A 70, 052328 (2004)).
+ *
+ * The tableau determines the state only up to a global phase, so the exact
+ * amplitude of a reference basis state in its support is tracked along
+ * with it. Only a Hadamard gate needs the tableau for this, namely the
+ * ratio of the amplitudes of the reference state and the state with the
+ * gate wire flipped, which costs a Gaussian elimination of the generators.
+ * Thus writeState() reproduces the state vector obtained by applying the
+ * same gates densely, including the global phase.
+ */
+class StabilizerTableau {
+  private:
+    size_t num_qubits_;
+    size_t num_words_;
+
+    /**
+     * @brief Bits of the generators, with `num_words_` words per generator
+     * and bit `q % 64` of word `q / 64` for wire `q`.
+     */
+    std::vector<uint64_t> x_;
+    std::vector<uint64_t> z_;
+    std::vector<uint8_t> r_;
+
+    /**
+     * @brief Basis state in the support of the state, in the same bit
+     * layout as a generator, and its amplitude.
+     */
+    std::vector<uint64_t> ref_;
+    std::complex<double> ref_amp_;
+
+    size_t num_gates_{0};
+
+    /**
+     * @brief A Pauli operator @f$(-1)^r \bigotimes_q X_q^{x_q} Z_q^{z_q}@f$.
+     */
+    struct Pauli {
+        std::vector<uint64_t> x;
+        std::vector<uint64_t> z;
+        uint8_t r{0};
+    };
+
+    [[nodiscard]] static auto wordOf(size_t wire) -> size_t {
+        return wire / 64;
+    }
+    [[nodiscard]] static auto maskOf(size_t wire) -> uint64_t {
+        return uint64_t{1} << (wire % 64);
+    }
+
+    /**
+     * @brief Multiply `lhs` by `rhs` in place, where both commute.
+     */
+    static void multiply(Pauli &lhs, const uint64_t *x, const uint64_t *z,
+                         uint8_t r) {
+        // Powers of i of the product of the single-qubit operators
+        int phase = 2 * (lhs.r + r);
+        for (size_t w = 0; w < lhs.x.size(); w++) {
+            const uint64_t x1 = x[w];
+            const uint64_t z1 = z[w];
+            const uint64_t x2 = lhs.x[w];
+            const uint64_t z2 = lhs.z[w];
+            const uint64_t plus = (x1 & z1 & ~x2 & z2) |
+                                  (x1 & ~z1 & x2 & z2) |
+                                  (~x1 & z1 & x2 & ~z2);
+            const uint64_t minus = (x1 & z1 & x2 & ~z2) |
+                                   (x1 & ~z1 & ~x2 & z2) |
+                                   (~x1 & z1 & x2 & z2);
+            phase += std::popcount(plus) - std::popcount(minus);
+            lhs.x[w] ^= x1;
+            lhs.z[w] ^= z1;
+        }
+        lhs.r = static_cast<uint8_t>(((phase % 4) + 4) % 4 / 2);
+    }
+
+    /**
+     * @brief Get the generators in reduced row echelon form of their X
+     * parts.
+     *
+     * @return The generators with a nonzero X part, each with the wire of
+     * its leading X bit, which no other generator has.
+     */
+    [[nodiscard]] auto reduceGenerators() const
+        -> std::vector<std::pair<size_t, Pauli>> {
+        std::vector<Pauli> rows(num_qubits_);
+        for (size_t i = 0; i < num_qubits_; i++) {
+            const size_t offset = i * num_words_;
+            rows[i].x.assign(x_.begin() + offset,
+                             x_.begin() + offset + num_words_);
+            rows[i].z.assign(z_.begin() + offset,
+                             z_.begin() + offset + num_words_);
+            rows[i].r = r_[i];
+        }
+        std::vector<std::pair<size_t, Pauli>> reduced;
+        size_t rank = 0;
+        for (size_t wire = 0; wire < num_qubits_ && rank < num_qubits_;
+             wire++) {
+            const size_t w = wordOf(wire);
+            const uint64_t m = maskOf(wire);
+            size_t pivot = rank;
+            while (pivot < num_qubits_ && (rows[pivot].x[w] & m) == 0) {
+                pivot++;
+            }
+            if (pivot == num_qubits_) {
+                continue;
+            }
+            std::swap(rows[rank], rows[pivot]);
+            for (size_t i = 0; i < num_qubits_; i++) {
+                if (i != rank && (rows[i].x[w] & m) != 0) {
+                    multiply(rows[i], rows[rank].x.data(),
+                             rows[rank].z.data(), rows[rank].r);
+                }
+            }
+            rank++;
+        }
+        // Rows of earlier pivots were reduced by later ones, so collect last
+        size_t row = 0;
+        for (size_t wire = 0; wire < num_qubits_ && row < rank; wire++) {
+            if ((rows[row].x[wordOf(wire)] & maskOf(wire)) != 0) {
+                reduced.emplace_back(wire, std::move(rows[row]));
+                row++;
+            }
+        }
+        return reduced;
+    }
+
+    /**
+     * @brief Get the ratio of the amplitudes of the reference state with
+     * `wire` flipped and of the reference state.
+     *
+     * @return One of @f$0, \pm 1, \pm i@f$.
+     */
+    [[nodiscard]] auto flipRatio(size_t wire) const -> std::complex<double> {
+        const size_t w = wordOf(wire);
+        const uint64_t m = maskOf(wire);
+        bool any = false;
+        for (size_t i = 0; i < num_qubits_ && !any; i++) {
+            any = (x_[i * num_words_ + w] & m) != 0;
+        }
+        if (!any) {
+            return {0.0, 0.0};
+        }
+        // Find the stabilizer whose X part flips exactly `wire`
+        Pauli product{std::vector<uint64_t>(num_words_),
+                      std::vector<uint64_t>(num_words_), 0};
+        std::vector<uint64_t> target(num_words_);
+        target[w] = m;
+        for (const auto &[pivot, row] : reduceGenerators()) {
+            if ((target[wordOf(pivot)] & maskOf(pivot)) != 0) {
+                multiply(product, row.x.data(), row.z.data(), row.r);
+                for (size_t k = 0; k < num_words_; k++) {
+                    target[k] ^= row.x[k];
+                }
+            }
+        }
+        if (std::any_of(target.begin(), target.end(),
+                        [](uint64_t word) { return word != 0; })) {
+            return {0.0, 0.0};
+        }
+        // The stabilizer maps the reference state to the flipped one
+        int phase = 2 * product.r;
+        for (size_t k = 0; k < num_words_; k++) {
+            phase += 2 * std::popcount(product.z[k] & ref_[k]) +
+                     std::popcount(product.x[k] & product.z[k]);
+        }
+        constexpr std::complex<double> powers[4] = {
+            {1.0, 0.0}, {0.0, 1.0}, {-1.0, 0.0}, {0.0, -1.0}};
+        return powers[phase % 4];
+    }
+
+    void checkWires(const std::vector<size_t> &wires,
+                    size_t num_wires) const {
+        PL_ABORT_IF_NOT(wires.size() == num_wires,
+                        "Invalid number of wires.");
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+        }
+        PL_ABORT_IF(num_wires == 2 && wires[0] == wires[1],
+                    "Wires must be distinct.");
+    }
+
+    [[nodiscard]] auto refBit(size_t wire) const -> bool {
+        return (ref_[wordOf(wire)] & maskOf(wire)) != 0;
+    }
+
+    void applyHadamard(size_t wire) {
+        const auto ratio = flipRatio(wire);
+        const size_t w = wordOf(wire);
+        const uint64_t m = maskOf(wire);
+        for (size_t i = 0; i < num_qubits_; i++) {
+            uint64_t &x = x_[i * num_words_ + w];
+            uint64_t &z = z_[i * num_words_ + w];
+            const uint64_t xa = x & m;
+            const uint64_t za = z & m;
+            r_[i] ^= static_cast<uint8_t>(xa != 0 && za != 0);
+            x = (x & ~m) | za;
+            z = (z & ~m) | xa;
+        }
+        // New amplitudes of the reference state and of its flip
+        const double sign = refBit(wire) ? -1.0 : 1.0;
+        const auto same = ref_amp_ * (ratio + sign) * Util::INVSQRT2<double>();
+        const auto flipped =
+            ref_amp_ * (1.0 - sign * ratio) * Util::INVSQRT2<double>();
+        if (std::norm(flipped) > std::norm(same)) {
+            ref_[w] ^= m;
+            ref_amp_ = flipped;
+        } else {
+            ref_amp_ = same;
+        }
+    }
+
+    void applyS(size_t wire, bool inverse) {
+        const size_t w = wordOf(wire);
+        const uint64_t m = maskOf(wire);
+        for (size_t i = 0; i < num_qubits_; i++) {
+            const uint64_t x = x_[i * num_words_ + w];
+            uint64_t &z = z_[i * num_words_ + w];
+            const bool xa = (x & m) != 0;
+            const bool za = (z & m) != 0;
+            r_[i] ^= static_cast<uint8_t>(xa && (inverse ? !za : za));
+            z ^= x & m;
+        }
+        if (refBit(wire)) {
+            ref_amp_ *= std::complex<double>{0.0, inverse ? -1.0 : 1.0};
+        }
+    }
+
+    void applyPauli(size_t wire, bool flip_x, bool flip_z) {
+        const size_t w = wordOf(wire);
+        const uint64_t m = maskOf(wire);
+        for (size_t i = 0; i < num_qubits_; i++) {
+            // A generator anticommuting with the gate changes sign
+            const bool xa = (x_[i * num_words_ + w] & m) != 0;
+            const bool za = (z_[i * num_words_ + w] & m) != 0;
+            r_[i] ^= static_cast<uint8_t>((flip_z && xa) != (flip_x && za));
+        }
+        // X^x Z^z up to the phase making Y = iXZ
+        if (flip_z && refBit(wire)) {
+            ref_amp_ = -ref_amp_;
+        }
+        if (flip_x && flip_z) {
+            ref_amp_ *= std::complex<double>{0.0, 1.0};
+        }
+        if (flip_x) {
+            ref_[w] ^= m;
+        }
+    }
+
+    void applyCNOT(size_t control, size_t target) {
+        const size_t wc = wordOf(control);
+        const size_t wt = wordOf(target);
+        const uint64_t mc = maskOf(control);
+        const uint64_t mt = maskOf(target);
+        for (size_t i = 0; i < num_qubits_; i++) {
+            uint64_t *x = x_.data() + i * num_words_;
+            uint64_t *z = z_.data() + i * num_words_;
+            const bool xc = (x[wc] & mc) != 0;
+            const bool zc = (z[wc] & mc) != 0;
+            const bool xt = (x[wt] & mt) != 0;
+            const bool zt = (z[wt] & mt) != 0;
+            r_[i] ^= static_cast<uint8_t>(xc && zt && (xt == zc));
+            if (xc) {
+                x[wt] ^= mt;
+            }
+            if (zt) {
+                z[wc] ^= mc;
+            }
+        }
+        if (refBit(control)) {
+            ref_[wt] ^= mt;
+        }
+    }
+
+    void applyCZ(size_t wire0, size_t wire1) {
+        const size_t w0 = wordOf(wire0);
+        const size_t w1 = wordOf(wire1);
+        const uint64_t m0 = maskOf(wire0);
+        const uint64_t m1 = maskOf(wire1);
+        for (size_t i = 0; i < num_qubits_; i++) {
+            const uint64_t *x = x_.data() + i * num_words_;
+            uint64_t *z = z_.data() + i * num_words_;
+            const bool x0 = (x[w0] & m0) != 0;
+            const bool x1 = (x[w1] & m1) != 0;
+            const bool z0 = (z[w0] & m0) != 0;
+            const bool z1 = (z[w1] & m1) != 0;
+            r_[i] ^= static_cast<uint8_t>(x0 && x1 && (z0 != z1));
+            if (x1) {
+                z[w0] ^= m0;
+            }
+            if (x0) {
+                z[w1] ^= m1;
+            }
+        }
+        if (refBit(wire0) && refBit(wire1)) {
+            ref_amp_ = -ref_amp_;
+        }
+    }
+
+    void applySWAP(size_t wire0, size_t wire1) {
+        applyCNOT(wire0, wire1);
+        applyCNOT(wire1, wire0);
+        applyCNOT(wire0, wire1);
+    }
+
+  public:
+    /**
+     * @brief Construct a stabilizer tableau of a computational basis state.
+     *
+     * @param num_qubits Number of qubits.
+     * @param basis_index Index of the basis state, where wire 0 is the most
+     * significant bit.
+     * @param amplitude Amplitude of the basis state.
+     */
+    explicit StabilizerTableau(size_t num_qubits, size_t basis_index = 0,
+                               std::complex<double> amplitude = {1.0, 0.0})
+        : num_qubits_{num_qubits}, num_words_{(num_qubits + 63) / 64},
+          x_(num_qubits_ * num_words_), z_(num_qubits_ * num_words_),
+          r_(num_qubits_), ref_(num_words_), ref_amp_{amplitude} {
+        PL_ABORT_IF(num_qubits_ < 64 && (basis_index >> num_qubits_) != 0,
+                    "Invalid basis state index.");
+        for (size_t wire = 0; wire < num_qubits_; wire++) {
+            const size_t bit = num_qubits_ - 1 - wire;
+            const bool one = bit < 64 && ((basis_index >> bit) & 1U) != 0;
+            // The generator Z of a wire in |1> has sign -1
+            z_[wire * num_words_ + wordOf(wire)] = maskOf(wire);
+            r_[wire] = static_cast<uint8_t>(one);
+            if (one) {
+                ref_[wordOf(wire)] |= maskOf(wire);
+            }
+        }
+    }
+
+    /**
+     * @brief Check whether a gate is a Clifford gate supported by
+     * applyOperation().
+     */
+    [[nodiscard]] static auto isClifford(Gates::GateOperation gate_op)
+        -> bool {
+        return Util::array_has_elt(Gates::Constant::clifford_gates, gate_op);
+    }
+
+    /**
+     * @brief Get the number of qubits.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Get the number of gates applied since construction.
+     */
+    [[nodiscard]] auto getNumGates() const -> size_t { return num_gates_; }
+
+    /**
+     * @brief Apply a Clifford gate.
+     *
+     * @param gate_op Gate operation, one of Gates::Constant::clifford_gates.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     */
+    void applyOperation(Gates::GateOperation gate_op,
+                        const std::vector<size_t> &wires,
+                        bool inverse = false) {
+        using Gates::GateOperation;
+        switch (gate_op) {
+        case GateOperation::Identity:
+            checkWires(wires, 1);
+            break;
+        case GateOperation::PauliX:
+            checkWires(wires, 1);
+            applyPauli(wires[0], true, false);
+            break;
+        case GateOperation::PauliY:
+            checkWires(wires, 1);
+            applyPauli(wires[0], true, true);
+            break;
+        case GateOperation::PauliZ:
+            checkWires(wires, 1);
+            applyPauli(wires[0], false, true);
+            break;
+        case GateOperation::Hadamard:
+            checkWires(wires, 1);
+            applyHadamard(wires[0]);
+            break;
+        case GateOperation::S:
+            checkWires(wires, 1);
+            applyS(wires[0], inverse);
+            break;
+        case GateOperation::CNOT:
+            checkWires(wires, 2);
+            applyCNOT(wires[0], wires[1]);
+            break;
+        case GateOperation::CY:
+            // CY = S_t CNOT S_t^dagger
+            checkWires(wires, 2);
+            applyS(wires[1], true);
+            applyCNOT(wires[0], wires[1]);
+            applyS(wires[1], false);
+            break;
+        case GateOperation::CZ:
+            checkWires(wires, 2);
+            applyCZ(wires[0], wires[1]);
+            break;
+        case GateOperation::SWAP:
+            checkWires(wires, 2);
+            applySWAP(wires[0], wires[1]);
+            break;
+        default:
+            PL_ABORT("The gate is not a Clifford gate.");
+        }
+        num_gates_++;
+    }
+
+    /**
+     * @brief Write the state vector of the state.
+     *
+     * The support of the state is the reference state shifted by the span
+     * of the X parts of the generators, so only its @f$2^k@f$ amplitudes
+     * are written after zeroing the data, where @f$k@f$ is the rank of the
+     * X parts. The amplitudes are enumerated in Gray code order, each from
+     * the previous one by a single generator, in parallel over chunks.
+     *
+     * @tparam PrecisionT Floating point precision of the state vector data.
+     * @param arr Pointer to the state vector data of getNumQubits() qubits.
+     */
+    template <class PrecisionT>
+    void writeState(std::complex<PrecisionT> *arr) const {
+        PL_ABORT_IF(num_qubits_ >= 64, "Too many qubits for a state vector.");
+        const size_t length = Util::exp2(num_qubits_);
+
+        // Generators as masks of basis state indices
+        struct Generator {
+            size_t x;
+            size_t z;
+            int phase; // Powers of i of the generator acting on |0...0>
+        };
+        const auto toIndex = [this](const uint64_t *bits) {
+            size_t index = 0;
+            for (size_t wire = 0; wire < num_qubits_; wire++) {
+                if ((bits[wordOf(wire)] & maskOf(wire)) != 0) {
+                    index |= size_t{1} << (num_qubits_ - 1 - wire);
+                }
+            }
+            return index;
+        };
+        std::vector<Generator> generators;
+        for (const auto &[pivot, row] : reduceGenerators()) {
+            static_cast<void>(pivot);
+            int phase = 2 * row.r;
+            for (size_t k = 0; k < num_words_; k++) {
+                phase += std::popcount(row.x[k] & row.z[k]);
+            }
+            generators.push_back(
+                {toIndex(row.x.data()), toIndex(row.z.data()), phase % 4});
+        }
+        const size_t ref_index = toIndex(ref_.data());
+        const std::complex<PrecisionT> powers[4] = {
+            std::complex<PrecisionT>(ref_amp_),
+            std::complex<PrecisionT>(ref_amp_ *
+                                     std::complex<double>{0.0, 1.0}),
+            std::complex<PrecisionT>(-ref_amp_),
+            std::complex<PrecisionT>(ref_amp_ *
+                                     std::complex<double>{0.0, -1.0})};
+
+        // As a generator stabilizes the state, it maps the amplitude of a
+        // basis state to the amplitude of the basis state it flips to
+        const auto step = [&generators](size_t &index, int &phase, size_t j) {
+            const auto &gen = generators[j];
+            phase += gen.phase + 2 * std::popcount(gen.z & index);
+            index ^= gen.x;
+        };
+
+        const auto num_points = static_cast<size_t>(Util::exp2(
+            generators.size()));
+        constexpr size_t chunk_size = 1U << 12U;
+        const size_t num_chunks = (num_points + chunk_size - 1) / chunk_size;
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (size_t i = 0; i < length; i++) {
+            arr[i] = std::complex<PrecisionT>{0.0, 0.0};
+        }
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            const size_t begin = chunk * chunk_size;
+            const size_t end = std::min(begin + chunk_size, num_points);
+            size_t index = ref_index;
+            int phase = 0;
+            const size_t gray = begin ^ (begin >> 1U);
+            for (size_t j = 0; j < generators.size(); j++) {
+                if (((gray >> j) & 1U) != 0) {
+                    step(index, phase, j);
+                }
+            }
+            for (size_t t = begin; t < end; t++) {
+                arr[index] = powers[phase % 4];
+                if (t + 1 < end) {
+                    step(index, phase,
+                         static_cast<size_t>(std::countr_zero(t + 1)));
+                }
+            }
+        }
+    }
+};
+} // namespace Pennylane
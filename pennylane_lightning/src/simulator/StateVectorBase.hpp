@@ -22,7 +22,14 @@
 #include "ConstantUtil.hpp"
 #include "DynamicDispatcher.hpp"
 #include "Error.hpp"
+#include "GateFusion.hpp"
+#include "LinearAlgebra.hpp"
+#include "SparseLinearAlgebra.hpp"
+#include "StabilizerTableau.hpp"
+#include "Threading.hpp"
+#include "TypeTraits.hpp"
 #include "Util.hpp"
+#include "cpu_kernels/GateImplementationsLM.hpp"
 
 /// @cond DEV
 // Required for compilation with MSVC
@@ -31,11 +38,16 @@
 #endif
 /// @endcond
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <functional>
 #include <iostream>
+#include <numeric>
+#include <optional>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -62,6 +74,378 @@ template <class T, class Derived> class StateVectorBase {
 
   private:
     size_t num_qubits_{0};
+    size_t version_{nextVersion()};
+
+    /**
+     * @brief Get a version number unique among all statevectors.
+     */
+    static auto nextVersion() -> size_t {
+        static std::atomic<size_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+    size_t max_fused_wires_{0};
+    size_t cache_block_qubits_{0};
+    bool layer_scheduling_{false};
+    bool lazy_swaps_{false};
+    bool deferred_{false};
+    ThreadingConfig threading_config_;
+
+    /**
+     * @brief Gates recorded in deferred mode and not applied yet.
+     */
+    struct DeferredOperations {
+        std::vector<std::string> ops;
+        std::vector<std::vector<size_t>> wires;
+        std::vector<bool> inverse;
+        std::vector<std::vector<PrecisionT>> params;
+    };
+    DeferredOperations deferred_ops_;
+
+    /**
+     * @brief Tableau holding the state during a Clifford prefix.
+     */
+    std::optional<StabilizerTableau> clifford_prefix_;
+
+    /**
+     * @brief Write the state of the Clifford prefix to the data and end the
+     * prefix.
+     */
+    void expandCliffordPrefix() {
+        // End the prefix first, as writing the data requests it
+        const auto tableau = std::move(*clifford_prefix_);
+        clifford_prefix_.reset();
+        if (tableau.getNumGates() > 0) {
+            tableau.writeState(getData());
+        }
+    }
+
+    /**
+     * @brief Physical wire of the data holding each logical wire, or empty
+     * if every wire is held by itself.
+     */
+    std::vector<size_t> wire_map_;
+
+    /**
+     * @brief Relabel the wires instead of applying a SWAP gate.
+     */
+    void relabelSWAP(const std::vector<size_t> &wires) {
+        PL_ABORT_IF_NOT(wires.size() == 2, "SWAP acts on two wires.");
+        PL_ABORT_IF(wires[0] >= num_qubits_ || wires[1] >= num_qubits_,
+                    "Invalid wire index.");
+        if (wire_map_.empty()) {
+            wire_map_.resize(num_qubits_);
+            std::iota(wire_map_.begin(), wire_map_.end(), size_t{0});
+        }
+        std::swap(wire_map_[wires[0]], wire_map_[wires[1]]);
+        if (std::is_sorted(wire_map_.begin(), wire_map_.end())) {
+            wire_map_.clear();
+        }
+    }
+
+    /**
+     * @brief Split a permutation into two involutions.
+     *
+     * A cycle @f$(c_0, c_1, \ldots, c_{L-1})@f$ is the reflection
+     * @f$c_k \leftrightarrow c_{-k}@f$ followed by the reflection
+     * @f$c_k \leftrightarrow c_{1-k}@f$, indices modulo @f$L@f$. So any
+     * permutation of wires is applied by two passes of disjoint swaps.
+     *
+     * @param perm Permutation moving position p to perm[p].
+     * @return Pairs to swap first and pairs to swap second.
+     */
+    static auto splitIntoInvolutions(const std::vector<size_t> &perm)
+        -> std::pair<std::vector<std::pair<size_t, size_t>>,
+                     std::vector<std::pair<size_t, size_t>>> {
+        std::vector<std::pair<size_t, size_t>> first;
+        std::vector<std::pair<size_t, size_t>> second;
+        std::vector<bool> visited(perm.size(), false);
+        std::vector<size_t> cycle;
+        for (size_t start = 0; start < perm.size(); start++) {
+            cycle.clear();
+            for (size_t pos = start; !visited[pos]; pos = perm[pos]) {
+                visited[pos] = true;
+                cycle.push_back(pos);
+            }
+            const size_t len = cycle.size();
+            for (size_t k = 0; k < len; k++) {
+                const size_t mirror = (len - k) % len;
+                const size_t shifted = (len + 1 - k) % len;
+                if (k < mirror) {
+                    first.emplace_back(cycle[k], cycle[mirror]);
+                }
+                if (k < shifted) {
+                    second.emplace_back(cycle[k], cycle[shifted]);
+                }
+            }
+        }
+        return {first, second};
+    }
+
+    /**
+     * @brief A single step of applyOperations, i.e. a gate or a fused
+     * matrix.
+     *
+     * The function is called with a pointer to data, the number of qubits
+     * of the data, and the wires to apply the step to. This allows a step to
+     * be applied to a tile of the statevector as well as the full
+     * statevector.
+     */
+    struct OperationStep {
+        std::vector<size_t> wires;
+        std::function<void(ComplexPrecisionT * /*data*/,
+                           size_t /*num_qubits*/,
+                           const std::vector<size_t> & /*wires*/)>
+            func;
+    };
+
+    /**
+     * @brief Create a step applying the idx-th operation using the kernel
+     * for the gate.
+     */
+    [[nodiscard]] auto
+    createGateStep(const std::vector<std::string> &ops,
+                   const std::vector<std::vector<size_t>> &ops_wires,
+                   const std::vector<bool> &ops_inverse,
+                   const std::vector<std::vector<PrecisionT>> &ops_params,
+                   size_t idx) const -> OperationStep {
+        const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+        const auto gate_op = dispatcher.strToGateOp(ops[idx]);
+        return {ops_wires[idx],
+                [func = dispatcher.getGateFunc(gate_op,
+                                               getKernelForGate(gate_op)),
+                 inverse = static_cast<bool>(ops_inverse[idx]),
+                 &params = ops_params[idx]](ComplexPrecisionT *data,
+                                            size_t num_qubits,
+                                            const std::vector<size_t> &wires) {
+                    func(data, num_qubits, wires, inverse, params);
+                }};
+    }
+
+    /**
+     * @brief Create steps applying the operations layer by layer, where the
+     * single-qubit gates of each layer are applied as tensor products on up
+     * to GateImplementationsLM::max_tensor_product_wires wires.
+     */
+    [[nodiscard]] auto
+    createLayerSteps(const std::vector<std::string> &ops,
+                     const std::vector<std::vector<size_t>> &ops_wires,
+                     const std::vector<bool> &ops_inverse,
+                     const std::vector<std::vector<PrecisionT>> &ops_params)
+        const -> std::vector<OperationStep> {
+        std::vector<OperationStep> steps;
+        for (auto &block : Gates::partitionForProducts(
+                 ops_wires,
+                 Gates::GateImplementationsLM::max_tensor_product_wires)) {
+            if (block.op_indices.size() == 1) {
+                steps.emplace_back(createGateStep(ops, ops_wires, ops_inverse,
+                                                  ops_params,
+                                                  block.op_indices[0]));
+                continue;
+            }
+            std::vector<ComplexPrecisionT> matrices;
+            matrices.reserve(4 * block.op_indices.size());
+            for (size_t k = 0; k < block.op_indices.size(); k++) {
+                const auto matrix = Gates::getFusedMatrix<PrecisionT>(
+                    {{block.op_indices[k]}, {block.wires[k]}, false}, ops,
+                    ops_wires, ops_inverse, ops_params);
+                matrices.insert(matrices.end(), matrix.begin(), matrix.end());
+            }
+            steps.push_back(
+                {std::move(block.wires),
+                 [matrices = std::move(matrices)](
+                     ComplexPrecisionT *data, size_t num_qubits,
+                     const std::vector<size_t> &wires) {
+                     Gates::GateImplementationsLM::applyTensorProduct(
+                         data, num_qubits, matrices.data(), wires);
+                 }});
+        }
+        return steps;
+    }
+
+    /**
+     * @brief Create steps for the given operations. When gate fusion is
+     * enabled, consecutive gates are merged into matrix steps, and runs of
+     * consecutive diagonal gates are merged into diagonal steps which may
+     * act on up to Gates::max_fused_diagonal_wires wires. When layer
+     * scheduling is enabled, it takes precedence over gate fusion.
+     */
+    [[nodiscard]] auto
+    createSteps(const std::vector<std::string> &ops,
+                const std::vector<std::vector<size_t>> &ops_wires,
+                const std::vector<bool> &ops_inverse,
+                const std::vector<std::vector<PrecisionT>> &ops_params) const
+        -> std::vector<OperationStep> {
+        using Gates::MatrixOperation;
+        if (layer_scheduling_) {
+            return createLayerSteps(ops, ops_wires, ops_inverse, ops_params);
+        }
+        std::vector<OperationStep> steps;
+
+        if (max_fused_wires_ == 0) {
+            steps.reserve(ops.size());
+            for (size_t idx = 0; idx < ops.size(); idx++) {
+                steps.emplace_back(createGateStep(ops, ops_wires, ops_inverse,
+                                                  ops_params, idx));
+            }
+            return steps;
+        }
+
+        const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+        std::vector<bool> ops_diagonal(ops.size());
+        for (size_t idx = 0; idx < ops.size(); idx++) {
+            ops_diagonal[idx] =
+                Util::array_has_elt(Gates::Constant::diagonal_gates,
+                                    dispatcher.strToGateOp(ops[idx]));
+        }
+        for (auto &block : Gates::partitionForFusion(
+                 ops_wires, ops_diagonal, max_fused_wires_,
+                 Gates::max_fused_diagonal_wires)) {
+            if (block.op_indices.size() == 1) {
+                steps.emplace_back(createGateStep(ops, ops_wires, ops_inverse,
+                                                  ops_params,
+                                                  block.op_indices[0]));
+                continue;
+            }
+            if (block.diagonal) {
+                auto diag = Gates::getFusedDiagonal<PrecisionT>(
+                    block, ops, ops_wires, ops_inverse, ops_params);
+                steps.push_back(
+                    {std::move(block.wires),
+                     [diag = std::move(diag)](
+                         ComplexPrecisionT *data, size_t num_qubits,
+                         const std::vector<size_t> &wires) {
+                         Gates::GateImplementationsLM::applyDiagonal(
+                             data, num_qubits, diag.data(), wires, false);
+                     }});
+                continue;
+            }
+            const auto kernel = [n_wires = block.wires.size(), this]() {
+                switch (n_wires) {
+                case 1:
+                    return getKernelForMatrix(MatrixOperation::SingleQubitOp);
+                case 2:
+                    return getKernelForMatrix(MatrixOperation::TwoQubitOp);
+                default:
+                    return getKernelForMatrix(MatrixOperation::MultiQubitOp);
+                }
+            }();
+            auto matrix = Gates::getFusedMatrix<PrecisionT>(
+                block, ops, ops_wires, ops_inverse, ops_params);
+            steps.push_back(
+                {std::move(block.wires),
+                 [&dispatcher, kernel, matrix = std::move(matrix)](
+                     ComplexPrecisionT *data, size_t num_qubits,
+                     const std::vector<size_t> &wires) {
+                     dispatcher.applyMatrix(kernel, data, num_qubits,
+                                            matrix.data(), wires, false);
+                 }});
+        }
+        return steps;
+    }
+
+    /**
+     * @brief Apply steps to the statevector.
+     *
+     * When cache blocking is enabled, consecutive steps acting only on the
+     * lowest `cache_block_qubits_` reversed wires are applied tile by tile,
+     * where each tile is a contiguous chunk of `2^cache_block_qubits_`
+     * amplitudes. All such steps are applied to a tile before moving on to
+     * the next one, so the tile stays in cache. Other steps are applied to
+     * the full statevector.
+     *
+     * @param steps Steps to apply in order.
+     */
+    void applySteps(const std::vector<OperationStep> &steps) {
+        auto *arr = getData();
+        const size_t num_qubits = num_qubits_;
+        const size_t block_qubits = cache_block_qubits_;
+
+        if (block_qubits == 0 || block_qubits >= num_qubits) {
+            for (const auto &step : steps) {
+                step.func(arr, num_qubits, step.wires);
+            }
+            return;
+        }
+
+        // Wire w is local to a tile when its reversed index
+        // num_qubits - 1 - w is smaller than block_qubits.
+        const size_t wire_offset = num_qubits - block_qubits;
+        const auto is_local = [wire_offset](const std::vector<size_t> &wires) {
+            return std::all_of(wires.begin(), wires.end(),
+                               [wire_offset](size_t wire) {
+                                   return wire >= wire_offset;
+                               });
+        };
+
+        const size_t tile_size = Util::exp2(block_qubits);
+        const size_t num_tiles = Util::exp2(wire_offset);
+
+        size_t begin = 0;
+        while (begin < steps.size()) {
+            size_t end = begin;
+            while (end < steps.size() && is_local(steps[end].wires)) {
+                end++;
+            }
+            if (end - begin <= 1) {
+                // A non-local step, or a single local step which gains
+                // nothing from tiling
+                steps[begin].func(arr, num_qubits, steps[begin].wires);
+                begin++;
+                continue;
+            }
+
+            std::vector<std::vector<size_t>> local_wires;
+            local_wires.reserve(end - begin);
+            for (size_t k = begin; k < end; k++) {
+                std::vector<size_t> wires = steps[k].wires;
+                for (auto &wire : wires) {
+                    wire -= wire_offset;
+                }
+                local_wires.emplace_back(std::move(wires));
+            }
+
+            for (size_t tile = 0; tile < num_tiles; tile++) {
+                ComplexPrecisionT *tile_arr = arr + tile * tile_size;
+                for (size_t k = begin; k < end; k++) {
+                    steps[k].func(tile_arr, block_qubits,
+                                  local_wires[k - begin]);
+                }
+            }
+            begin = end;
+        }
+    }
+
+    /**
+     * @brief Apply operations as steps, translating their wires to the
+     * physical wires and relabelling the wires for lazy SWAP gates.
+     */
+    void applyOperationsAsSteps(
+        const std::vector<std::string> &ops,
+        const std::vector<std::vector<size_t>> &ops_wires,
+        const std::vector<bool> &ops_inverse,
+        const std::vector<std::vector<PrecisionT>> &ops_params) {
+        if (!lazy_swaps_ && wire_map_.empty()) {
+            applySteps(createSteps(ops, ops_wires, ops_inverse, ops_params));
+            return;
+        }
+        std::vector<std::string> phys_ops;
+        std::vector<std::vector<size_t>> phys_wires;
+        std::vector<bool> phys_inverse;
+        std::vector<std::vector<PrecisionT>> phys_params;
+        std::vector<size_t> buffer;
+        for (size_t i = 0; i < ops.size(); i++) {
+            if (lazy_swaps_ && ops[i] == "SWAP") {
+                relabelSWAP(ops_wires[i]);
+                continue;
+            }
+            phys_ops.push_back(ops[i]);
+            phys_wires.push_back(physicalWires(ops_wires[i], buffer));
+            phys_inverse.push_back(ops_inverse[i]);
+            phys_params.push_back(ops_params[i]);
+        }
+        applySteps(
+            createSteps(phys_ops, phys_wires, phys_inverse, phys_params));
+    }
 
   protected:
     /**
@@ -79,6 +463,55 @@ template <class T, class Derived> class StateVectorBase {
      */
     void setNumQubits(size_t qubits) { num_qubits_ = qubits; }
 
+    /**
+     * @brief Get the physical wires of the data holding the given wires.
+     *
+     * @param wires Logical wires.
+     * @param buffer Storage of the physical wires, used unless every wire
+     * is held by itself.
+     */
+    [[nodiscard]] auto physicalWires(const std::vector<size_t> &wires,
+                                     std::vector<size_t> &buffer) const
+        -> const std::vector<size_t> & {
+        if (wire_map_.empty()) {
+            return wires;
+        }
+        buffer.resize(wires.size());
+        for (size_t i = 0; i < wires.size(); i++) {
+            PL_ABORT_IF(wires[i] >= num_qubits_, "Invalid wire index.");
+            buffer[i] = wire_map_[wires[i]];
+        }
+        return buffer;
+    }
+
+    /**
+     * @brief Forget the wire map, as the data was replaced by data in the
+     * canonical order.
+     */
+    void discardWireMap() { wire_map_.clear(); }
+
+    /**
+     * @brief Abort unless the data holds the current state in the canonical
+     * order.
+     *
+     * It is called by the read-only getData() of derived classes, which
+     * does not apply pending work to the data.
+     */
+    void checkCanonical() const {
+        PL_ABORT_IF_NOT(isCanonical(),
+                        "The statevector has pending operations or "
+                        "relabelled wires. Call canonicalizeWires() before "
+                        "read-only access to the data.");
+    }
+
+    /**
+     * @brief Apply the threading configuration until the returned scope is
+     * destroyed.
+     */
+    [[nodiscard]] auto threadingScope() const -> ThreadingScope {
+        return {threading_config_, num_qubits_};
+    }
+
   public:
     /**
      * @brief Get the number of qubits represented by the statevector data.
@@ -98,6 +531,320 @@ template <class T, class Derived> class StateVectorBase {
         return static_cast<size_t>(Util::exp2(num_qubits_));
     }
 
+    /**
+     * @brief Set the maximum number of wires of a fused gate used in
+     * applyOperations.
+     *
+     * When it is nonzero, consecutive gates acting on at most `max_wires`
+     * wires in total are merged into a single dense matrix before being
+     * applied to the statevector. This reduces the number of sweeps over the
+     * statevector at the cost of more arithmetic per sweep. The value 0
+     * (default) disables gate fusion.
+     *
+     * @param max_wires Maximum number of wires of a fused gate.
+     */
+    void setMaxFusedWires(size_t max_wires) {
+        PL_ABORT_IF(max_wires > Gates::max_fused_wires,
+                    "The maximum number of wires for gate fusion must not "
+                    "exceed Gates::max_fused_wires.");
+        max_fused_wires_ = max_wires;
+    }
+
+    /**
+     * @brief Get the maximum number of wires of a fused gate. The value 0
+     * indicates that gate fusion is disabled.
+     */
+    [[nodiscard]] auto getMaxFusedWires() const -> size_t {
+        return max_fused_wires_;
+    }
+
+    /**
+     * @brief Set the threads used by the kernels applied to the
+     * statevector.
+     *
+     * The configuration is honoured by every gate, generator and matrix
+     * applied through the statevector, and copied by the Measures of the
+     * statevector. See ThreadingConfig.
+     *
+     * @param config Threading configuration.
+     */
+    void setThreadingConfig(ThreadingConfig config) {
+        threading_config_ = std::move(config);
+    }
+
+    /**
+     * @brief Get the threading configuration.
+     */
+    [[nodiscard]] auto getThreadingConfig() const -> const ThreadingConfig & {
+        return threading_config_;
+    }
+
+    /**
+     * @brief Enable or disable the layer scheduling of applyOperations.
+     *
+     * When enabled, operations are scheduled into layers of gates acting on
+     * pairwise-disjoint wires, moving each gate past earlier gates on other
+     * wires, which commute with it. The single-qubit gates of a layer, such
+     * as the rotations on every wire of a hardware-efficient ansatz, are
+     * then applied in blocks of up to
+     * GateImplementationsLM::max_tensor_product_wires wires, each in a
+     * single pass over the statevector, instead of one pass per gate. Layer
+     * scheduling takes precedence over gate fusion and is disabled by
+     * default.
+     *
+     * @param enabled Whether operations are scheduled into layers.
+     */
+    void setLayerScheduling(bool enabled) { layer_scheduling_ = enabled; }
+
+    /**
+     * @brief Check whether operations are scheduled into layers.
+     */
+    [[nodiscard]] auto getLayerScheduling() const -> bool {
+        return layer_scheduling_;
+    }
+
+    /**
+     * @brief Set the number of qubits of a cache tile used in
+     * applyOperations.
+     *
+     * When it is nonzero, runs of consecutive gates acting only on wires
+     * whose reversed index is below `block_qubits` are applied to each
+     * contiguous tile of `2^block_qubits` amplitudes in turn, instead of
+     * sweeping the full statevector once per gate. Choose the value so that
+     * a tile fits in the L2 cache, e.g. 15 for `complex<double>` and a
+     * 512 KiB cache. The value 0 (default) disables cache blocking.
+     *
+     * @param block_qubits Number of qubits of a tile.
+     */
+    void setCacheBlockQubits(size_t block_qubits) {
+        cache_block_qubits_ = block_qubits;
+    }
+
+    /**
+     * @brief Get the number of qubits of a cache tile. The value 0 indicates
+     * that cache blocking is disabled.
+     */
+    [[nodiscard]] auto getCacheBlockQubits() const -> size_t {
+        return cache_block_qubits_;
+    }
+
+    /**
+     * @brief Enable or disable lazy SWAP gates.
+     *
+     * When enabled, SWAP gates only relabel the wires: the logical wires
+     * are mapped to the physical wires of the data, and later operations
+     * are applied to the physical wires they map to. This saves a pass over
+     * the statevector for each SWAP, e.g. for the SWAP network closing a
+     * QFT. Until canonicalizeWires() is called, the data is in the physical
+     * order given by getWireMap(), and read-only access to the data, e.g.
+     * by Measures, is refused. Disabling lazy SWAP gates canonicalizes the
+     * wires.
+     *
+     * @param enabled Whether SWAP gates are lazy.
+     */
+    void setLazySwaps(bool enabled) {
+        if (!enabled) {
+            canonicalizeWires();
+        }
+        lazy_swaps_ = enabled;
+    }
+
+    /**
+     * @brief Check whether SWAP gates are lazy.
+     */
+    [[nodiscard]] auto getLazySwaps() const -> bool { return lazy_swaps_; }
+
+    /**
+     * @brief Enable or disable deferred execution of gates.
+     *
+     * When enabled, gates passed to applyOperations, or to applyOperation
+     * without a kernel, are only recorded. The recorded gates are applied
+     * together by flushOperations(), so gate fusion, diagonal merging, layer
+     * scheduling, cache blocking and lazy SWAP gates act on the whole
+     * circuit instead of on each gate as it arrives. Gates are flushed
+     * before any other operation, when mutable access to the data is
+     * requested, and by canonicalizeWires(). Read-only access to the data,
+     * e.g. by Measures, is refused while gates are pending. Invalid gates
+     * are only reported when flushed. Disabling deferred execution flushes
+     * the recorded gates.
+     *
+     * @param enabled Whether gates are deferred.
+     */
+    void setDeferredExecution(bool enabled) {
+        if (!enabled) {
+            flushOperations();
+        }
+        deferred_ = enabled;
+    }
+
+    /**
+     * @brief Check whether gates are deferred.
+     */
+    [[nodiscard]] auto getDeferredExecution() const -> bool {
+        return deferred_;
+    }
+
+    /**
+     * @brief Get the number of deferred gates not applied yet.
+     */
+    [[nodiscard]] auto getNumDeferredOperations() const -> size_t {
+        return deferred_ops_.ops.size();
+    }
+
+    /**
+     * @brief Check whether deferred gates or the gates of a Clifford prefix
+     * are not applied to the data yet.
+     */
+    [[nodiscard]] auto hasPendingOperations() const -> bool {
+        return !deferred_ops_.ops.empty() ||
+               (clifford_prefix_ && clifford_prefix_->getNumGates() > 0);
+    }
+
+    /**
+     * @brief Check whether the data holds the current state in the
+     * canonical order, i.e. whether no operations are pending and every
+     * wire is held by itself.
+     */
+    [[nodiscard]] auto isCanonical() const -> bool {
+        return !hasPendingOperations() && !hasWireMap();
+    }
+
+    /**
+     * @brief Apply the deferred gates to the statevector.
+     */
+    void flushOperations() {
+        if (clifford_prefix_) {
+            expandCliffordPrefix();
+        }
+        if (deferred_ops_.ops.empty()) {
+            return;
+        }
+        const auto scope = threadingScope();
+        // Clear the record first, as applying the gates requests the data
+        const auto pending = std::exchange(deferred_ops_, DeferredOperations{});
+        applyOperationsAsSteps(pending.ops, pending.wires, pending.inverse,
+                               pending.params);
+    }
+
+    /**
+     * @brief Start simulating Clifford gates by a stabilizer tableau.
+     *
+     * Circuits often start with a long Clifford section, e.g. a network of
+     * Hadamard, S, CNOT and CZ gates preparing a state. When the data holds
+     * a computational basis state, the following Clifford gates (see
+     * Gates::Constant::clifford_gates) passed to applyOperations, or to
+     * applyOperation without a kernel, update a StabilizerTableau in
+     * @f$O(n)@f$ time each instead of sweeping over the statevector. The
+     * stabilizer state is written to the data, with its global phase, in a
+     * single parallel pass when the first other gate arrives, or whenever
+     * the deferred gates would be flushed (see setDeferredExecution()).
+     * Checking for a basis state takes a parallel pass over the data, so
+     * the prefix is only worth starting before long Clifford sections.
+     *
+     * @return Whether the prefix started, i.e. whether the data holds a
+     * computational basis state.
+     */
+    auto beginCliffordPrefix() -> bool {
+        canonicalizeWires();
+        const ComplexPrecisionT *arr = std::as_const(*this).getData();
+        const size_t length = getLength();
+        const auto scope = threadingScope();
+        size_t num_nonzero = 0;
+        size_t basis_index = 0;
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static) \
+                reduction(+:num_nonzero) reduction(max:basis_index)
+        #endif
+        // clang-format on
+        for (size_t i = 0; i < length; i++) {
+            if (arr[i] != ComplexPrecisionT{0.0, 0.0}) {
+                num_nonzero++;
+                basis_index = std::max(basis_index, i);
+            }
+        }
+        if (num_nonzero != 1) {
+            return false;
+        }
+        clifford_prefix_.emplace(
+            num_qubits_, basis_index,
+            static_cast<std::complex<double>>(arr[basis_index]));
+        return true;
+    }
+
+    /**
+     * @brief Check whether Clifford gates are applied to a stabilizer
+     * tableau not written to the data yet.
+     */
+    [[nodiscard]] auto inCliffordPrefix() const -> bool {
+        return clifford_prefix_.has_value();
+    }
+
+    /**
+     * @brief Check whether lazy SWAP gates left any logical wire held by
+     * another physical wire.
+     */
+    [[nodiscard]] auto hasWireMap() const -> bool {
+        return !wire_map_.empty();
+    }
+
+    /**
+     * @brief Get the physical wire of the data holding each logical wire.
+     */
+    [[nodiscard]] auto getWireMap() const -> std::vector<size_t> {
+        if (wire_map_.empty()) {
+            std::vector<size_t> identity(num_qubits_);
+            std::iota(identity.begin(), identity.end(), size_t{0});
+            return identity;
+        }
+        return wire_map_;
+    }
+
+    /**
+     * @brief Move the data to the canonical order where every wire is held
+     * by itself.
+     *
+     * Any wire map is undone by at most two passes over the statevector,
+     * after the deferred gates are flushed.
+     */
+    void canonicalizeWires() {
+        flushOperations();
+        if (wire_map_.empty()) {
+            return;
+        }
+        // The data of physical wire wire_map_[w] moves to w
+        std::vector<size_t> perm(num_qubits_);
+        for (size_t wire = 0; wire < num_qubits_; wire++) {
+            perm[wire_map_[wire]] = wire;
+        }
+        const auto [first, second] = splitIntoInvolutions(perm);
+        const auto scope = threadingScope();
+        auto *arr = getData();
+        for (const auto &pairs : {first, second}) {
+            if (!pairs.empty()) {
+                Gates::GateImplementationsLM::applyDisjointSWAPs(
+                    arr, num_qubits_, pairs);
+            }
+        }
+        wire_map_.clear();
+    }
+
+    /**
+     * @brief Get the version of the statevector data.
+     *
+     * A new version, unique among all statevectors, is assigned whenever
+     * mutable access to the data is requested, e.g. by applying an operation,
+     * so caches of quantities derived from the data can detect changes by
+     * comparing versions. Call markModified() after writing to the data
+     * through a pointer obtained earlier.
+     */
+    [[nodiscard]] auto getVersion() const -> size_t { return version_; }
+
+    /**
+     * @brief Mark the statevector data as modified.
+     */
+    void markModified() { version_ = nextVersion(); }
+
     /**
      * @brief Get the data pointer of the statevector
      *
@@ -111,6 +858,16 @@ template <class T, class Derived> class StateVectorBase {
         return static_cast<const Derived *>(this)->getData();
     }
 
+    /**
+     * @brief Get the data pointer of the statevector without applying the
+     * deferred gates, the Clifford prefix or the wire map.
+     *
+     * @return The pointer to the data in the physical order of getWireMap()
+     */
+    [[nodiscard]] inline auto getPhysicalData() const -> decltype(auto) {
+        return static_cast<const Derived *>(this)->getPhysicalData();
+    }
+
     [[nodiscard]] inline auto
     getKernelForGate(Gates::GateOperation gate_op) const -> Gates::KernelType {
         return static_cast<const Derived *>(this)->getKernelForGate(gate_op);
@@ -163,9 +920,19 @@ template <class T, class Derived> class StateVectorBase {
     void applyOperation(Gates::KernelType kernel, const std::string &opName,
                         const std::vector<size_t> &wires, bool inverse = false,
                         const std::vector<PrecisionT> &params = {}) {
+        flushOperations();
+        auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+        const auto gate_op = dispatcher.strToGateOp(opName);
+        if (lazy_swaps_ && gate_op == Gates::GateOperation::SWAP) {
+            relabelSWAP(wires);
+            return;
+        }
+        const auto scope = threadingScope();
+        std::vector<size_t> buffer;
         auto *arr = getData();
-        DynamicDispatcher<PrecisionT>::getInstance().applyOperation(
-            kernel, arr, num_qubits_, opName, wires, inverse, params);
+        dispatcher.applyOperation(kernel, arr, num_qubits_, gate_op,
+                                  physicalWires(wires, buffer), inverse,
+                                  params);
     }
 
     /**
@@ -179,11 +946,48 @@ template <class T, class Derived> class StateVectorBase {
     void applyOperation(const std::string &opName,
                         const std::vector<size_t> &wires, bool inverse = false,
                         const std::vector<PrecisionT> &params = {}) {
+        const auto gate_op =
+            DynamicDispatcher<PrecisionT>::getInstance().strToGateOp(opName);
+        applyOperation(gate_op, wires, inverse, params);
+    }
+
+    /**
+     * @brief Apply a single gate to the state-vector without resolving a
+     * gate name.
+     *
+     * @param gate_op Gate operation to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(Gates::GateOperation gate_op,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        if (clifford_prefix_) {
+            if (StabilizerTableau::isClifford(gate_op)) {
+                clifford_prefix_->applyOperation(gate_op, wires, inverse);
+                return;
+            }
+            expandCliffordPrefix();
+        }
+        if (deferred_) {
+            deferred_ops_.ops.emplace_back(
+                Util::lookup(Gates::Constant::gate_names, gate_op));
+            deferred_ops_.wires.push_back(wires);
+            deferred_ops_.inverse.push_back(inverse);
+            deferred_ops_.params.push_back(params);
+            return;
+        }
+        if (lazy_swaps_ && gate_op == Gates::GateOperation::SWAP) {
+            relabelSWAP(wires);
+            return;
+        }
+        const auto scope = threadingScope();
+        std::vector<size_t> buffer;
         auto *arr = getData();
-        auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
-        const auto gate_op = dispatcher.strToGateOp(opName);
-        dispatcher.applyOperation(getKernelForGate(gate_op), arr, num_qubits_,
-                                  gate_op, wires, inverse, params);
+        DynamicDispatcher<PrecisionT>::getInstance().applyOperation(
+            getKernelForGate(gate_op), arr, num_qubits_, gate_op,
+            physicalWires(wires, buffer), inverse, params);
     }
 
     /**
@@ -214,6 +1018,48 @@ template <class T, class Derived> class StateVectorBase {
             numOperations != ops_params.size(),
             "Invalid arguments: number of operations, wires, inverses, and "
             "parameters must all be equal");
+        if (clifford_prefix_) {
+            auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+            size_t first = 0;
+            for (; first < numOperations; first++) {
+                const auto gate_op = dispatcher.strToGateOp(ops[first]);
+                if (!StabilizerTableau::isClifford(gate_op)) {
+                    break;
+                }
+                clifford_prefix_->applyOperation(gate_op, ops_wires[first],
+                                                 ops_inverse[first]);
+            }
+            if (first == numOperations) {
+                return;
+            }
+            expandCliffordPrefix();
+            if (first > 0) {
+                const auto rest = [first](const auto &vec) {
+                    return std::decay_t<decltype(vec)>(vec.begin() + first,
+                                                       vec.end());
+                };
+                applyOperations(rest(ops), rest(ops_wires), rest(ops_inverse),
+                                rest(ops_params));
+                return;
+            }
+        }
+        if (deferred_) {
+            auto &pending = deferred_ops_;
+            pending.ops.insert(pending.ops.end(), ops.begin(), ops.end());
+            pending.wires.insert(pending.wires.end(), ops_wires.begin(),
+                                 ops_wires.end());
+            pending.inverse.insert(pending.inverse.end(), ops_inverse.begin(),
+                                   ops_inverse.end());
+            pending.params.insert(pending.params.end(), ops_params.begin(),
+                                  ops_params.end());
+            return;
+        }
+        const auto scope = threadingScope();
+        if (max_fused_wires_ > 0 || cache_block_qubits_ > 0 ||
+            layer_scheduling_) {
+            applyOperationsAsSteps(ops, ops_wires, ops_inverse, ops_params);
+            return;
+        }
         for (size_t i = 0; i < numOperations; i++) {
             applyOperation(ops[i], ops_wires[i], ops_inverse[i], ops_params[i]);
         }
@@ -242,6 +1088,14 @@ template <class T, class Derived> class StateVectorBase {
                 "Invalid arguments: number of operations, wires and inverses"
                 "must all be equal");
         }
+        if (clifford_prefix_ || deferred_ || max_fused_wires_ > 0 ||
+            cache_block_qubits_ > 0 || layer_scheduling_) {
+            const std::vector<std::vector<PrecisionT>> ops_params(
+                numOperations);
+            applyOperations(ops, ops_wires, ops_inverse, ops_params);
+            return;
+        }
+        const auto scope = threadingScope();
         for (size_t i = 0; i < numOperations; i++) {
             applyOperation(ops[i], ops_wires[i], ops_inverse[i], {});
         }
@@ -259,9 +1113,13 @@ template <class T, class Derived> class StateVectorBase {
                                              const std::string &opName,
                                              const std::vector<size_t> &wires,
                                              bool adj = false) -> PrecisionT {
+        flushOperations();
+        const auto scope = threadingScope();
+        std::vector<size_t> buffer;
         auto *arr = getData();
         return DynamicDispatcher<PrecisionT>::getInstance().applyGenerator(
-            kernel, arr, num_qubits_, opName, wires, adj);
+            kernel, arr, num_qubits_, opName, physicalWires(wires, buffer),
+            adj);
     }
 
     /**
@@ -274,11 +1132,15 @@ template <class T, class Derived> class StateVectorBase {
     [[nodiscard]] auto applyGenerator(const std::string &opName,
                                       const std::vector<size_t> &wires,
                                       bool adj = false) -> PrecisionT {
+        flushOperations();
+        const auto scope = threadingScope();
+        std::vector<size_t> buffer;
         auto *arr = getData();
         const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
         const auto gntr_op = dispatcher.strToGeneratorOp(opName);
         return dispatcher.applyGenerator(getKernelForGenerator(gntr_op), arr,
-                                         num_qubits_, opName, wires, adj);
+                                         num_qubits_, gntr_op,
+                                         physicalWires(wires, buffer), adj);
     }
 
     /**
@@ -296,13 +1158,16 @@ template <class T, class Derived> class StateVectorBase {
                             bool inverse = false) {
         using Gates::MatrixOperation;
 
+        flushOperations();
         const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
         auto *arr = getData();
 
         PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
 
-        dispatcher.applyMatrix(kernel, arr, num_qubits_, matrix, wires,
-                               inverse);
+        const auto scope = threadingScope();
+        std::vector<size_t> buffer;
+        dispatcher.applyMatrix(kernel, arr, num_qubits_, matrix,
+                               physicalWires(wires, buffer), inverse);
     }
 
     /**
@@ -372,8 +1237,481 @@ template <class T, class Derived> class StateVectorBase {
 
         applyMatrix(matrix.data(), wires, inverse);
     }
+
+    /**
+     * @brief Apply a matrix to the target wires, controlled on the given
+     * values of the control wires.
+     *
+     * Only the amplitudes whose control bits match the given values are
+     * touched, so multi-controlled gates cost as much as the uncontrolled
+     * matrix on @f$n-c@f$ qubits.
+     *
+     * @param matrix Pointer to the matrix acting on the target wires (in
+     * row-major format).
+     * @param controlled_wires Control wires.
+     * @param controlled_values Value, 0 or 1, of each control wire.
+     * @param wires Target wires.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyControlledMatrix(const ComplexPrecisionT *matrix,
+                               const std::vector<size_t> &controlled_wires,
+                               const std::vector<bool> &controlled_values,
+                               const std::vector<size_t> &wires,
+                               bool inverse = false) {
+        flushOperations();
+        const auto scope = threadingScope();
+        std::vector<size_t> controlled_buffer;
+        std::vector<size_t> buffer;
+        Gates::GateImplementationsLM::applyControlledMatrix(
+            getData(), num_qubits_, matrix,
+            physicalWires(controlled_wires, controlled_buffer),
+            controlled_values, physicalWires(wires, buffer), inverse);
+    }
+
+    /**
+     * @brief Apply a matrix to the target wires, controlled on the given
+     * values of the control wires.
+     *
+     * @param matrix Matrix acting on the target wires (in row-major format).
+     * @param controlled_wires Control wires.
+     * @param controlled_values Value, 0 or 1, of each control wire.
+     * @param wires Target wires.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    template <typename Alloc>
+    void
+    applyControlledMatrix(const std::vector<ComplexPrecisionT, Alloc> &matrix,
+                          const std::vector<size_t> &controlled_wires,
+                          const std::vector<bool> &controlled_values,
+                          const std::vector<size_t> &wires,
+                          bool inverse = false) {
+        PL_ABORT_IF(matrix.size() != Util::exp2(2 * wires.size()),
+                    "The size of matrix does not match with the given "
+                    "number of wires");
+        applyControlledMatrix(matrix.data(), controlled_wires,
+                              controlled_values, wires, inverse);
+    }
+
+    /**
+     * @brief Apply a diagonal matrix to the given wires in a single pass
+     * over the statevector.
+     *
+     * @param diag Pointer to the diagonal elements of the matrix.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyDiagonal(const ComplexPrecisionT *diag,
+                       const std::vector<size_t> &wires,
+                       bool inverse = false) {
+        flushOperations();
+        const auto scope = threadingScope();
+        std::vector<size_t> buffer;
+        Gates::GateImplementationsLM::applyDiagonal(
+            getData(), num_qubits_, diag, physicalWires(wires, buffer),
+            inverse);
+    }
+
+    /**
+     * @brief Apply a diagonal matrix to the given wires in a single pass
+     * over the statevector.
+     *
+     * @param diag Diagonal elements of the matrix.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    template <typename Alloc>
+    void applyDiagonal(const std::vector<ComplexPrecisionT, Alloc> &diag,
+                       const std::vector<size_t> &wires,
+                       bool inverse = false) {
+        PL_ABORT_IF(diag.size() != Util::exp2(wires.size()),
+                    "The size of diagonal does not match with the given "
+                    "number of wires");
+        applyDiagonal(diag.data(), wires, inverse);
+    }
+
+    /**
+     * @brief Get the amplitudes of the given computational basis states.
+     *
+     * Only the requested amplitudes are gathered, in parallel for many
+     * indices, without copying the statevector. Deferred gates are flushed,
+     * and under a wire map the indices are mapped to the physical order of
+     * the data instead of canonicalizing it.
+     *
+     * @param indices Indices of the basis states, wire 0 being the most
+     * significant bit.
+     * @return Amplitude of each basis state.
+     */
+    auto getAmplitudes(const std::vector<size_t> &indices)
+        -> std::vector<ComplexPrecisionT> {
+        constexpr size_t parallel_min_indices = size_t{1U} << 12U;
+        flushOperations();
+        const size_t length = getLength();
+        const size_t num_indices = indices.size();
+        for (const size_t index : indices) {
+            PL_ABORT_IF(index >= length, "Invalid basis state index.");
+        }
+        // Bit of the data index holding the bit of each logical wire
+        std::vector<size_t> bits;
+        if (!wire_map_.empty()) {
+            bits.resize(num_qubits_);
+            for (size_t wire = 0; wire < num_qubits_; wire++) {
+                bits[num_qubits_ - 1 - wire] = size_t{1U}
+                                               << (num_qubits_ - 1 -
+                                                   wire_map_[wire]);
+            }
+        }
+
+        const auto scope = threadingScope();
+        const ComplexPrecisionT *arr = getPhysicalData();
+        std::vector<ComplexPrecisionT> amplitudes(num_indices);
+        [[maybe_unused]] const bool parallel =
+            num_indices >= parallel_min_indices;
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static) if(parallel)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_indices; k++) {
+            size_t index = indices[k];
+            if (!bits.empty()) {
+                size_t physical = 0;
+                for (size_t bit = 0; bit < num_qubits_; bit++) {
+                    if (((index >> bit) & 1U) != 0) {
+                        physical |= bits[bit];
+                    }
+                }
+                index = physical;
+            }
+            amplitudes[k] = arr[index];
+        }
+        return amplitudes;
+    }
+
+    /**
+     * @brief Prepare a computational basis state.
+     *
+     * The existing data is reused: it is zeroed in a single parallel pass
+     * and the amplitude of the basis state is set. Deferred gates, a
+     * Clifford prefix and the wire map are discarded, as they refer to the
+     * overwritten state.
+     *
+     * @param index Index of the basis state, wire 0 being the most
+     * significant bit.
+     */
+    void setBasisState(size_t index) {
+        PL_ABORT_IF(index >= getLength(), "Invalid basis state index.");
+        ComplexPrecisionT *arr = discardState(true);
+        arr[index] = {1.0, 0.0};
+    }
+
+    /**
+     * @brief Prepare a state of the given wires, with all other wires in
+     * state 0.
+     *
+     * The existing data is reused: it is zeroed in a single parallel pass,
+     * unless the wires cover all qubits, and the values are scattered to the
+     * basis states where the other wires are 0, so no full-size temporary
+     * is formed. Deferred gates, a Clifford prefix and the wire map are
+     * discarded, as they refer to the overwritten state.
+     *
+     * @param values Pointer to the @f$2^k@f$ amplitudes of the state of the
+     * @f$k@f$ wires.
+     * @param wires Distinct wires. wires[0] corresponds to the most
+     * significant bit of the index of values.
+     */
+    void setStateVector(const ComplexPrecisionT *values,
+                        const std::vector<size_t> &wires) {
+        const size_t num_wires = wires.size();
+        PL_ABORT_IF(num_wires > num_qubits_, "Invalid number of wires.");
+        // Bit of the data index set by bit k of the index of values
+        std::vector<size_t> bits(num_wires);
+        size_t wire_mask = 0;
+        for (size_t k = 0; k < num_wires; k++) {
+            const size_t wire = wires[num_wires - 1 - k];
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+            bits[k] = size_t{1U} << (num_qubits_ - 1 - wire);
+            PL_ABORT_IF((wire_mask & bits[k]) != 0, "Wires must be distinct.");
+            wire_mask |= bits[k];
+        }
+
+        const auto scope = threadingScope();
+        ComplexPrecisionT *arr = discardState(num_wires < num_qubits_);
+        const size_t dim = Util::exp2(num_wires);
+        const size_t *bits_ptr = bits.data();
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t idx = 0; idx < dim; idx++) {
+            size_t offset = 0;
+            for (size_t k = 0; k < num_wires; k++) {
+                if (((idx >> k) & 1U) != 0) {
+                    offset |= bits_ptr[k];
+                }
+            }
+            arr[offset] = values[idx];
+        }
+    }
+
+    /**
+     * @brief Prepare a state of the given wires, with all other wires in
+     * state 0.
+     *
+     * @param values Amplitudes of the state of the wires.
+     * @param wires Distinct wires. wires[0] corresponds to the most
+     * significant bit of the index of values.
+     */
+    template <typename Alloc>
+    void setStateVector(const std::vector<ComplexPrecisionT, Alloc> &values,
+                        const std::vector<size_t> &wires) {
+        PL_ABORT_IF(values.size() != Util::exp2(wires.size()),
+                    "The size of the state does not match with the given "
+                    "number of wires");
+        setStateVector(values.data(), wires);
+    }
+
+    /**
+     * @brief Measure a wire in the computational basis, collapsing the
+     * statevector onto the outcome.
+     *
+     * The probabilities of both outcomes are summed in one read-only pass,
+     * and the amplitudes of the other outcome are zeroed while the remaining
+     * ones are renormalized in a single parallel pass. A mid-circuit
+     * measurement therefore needs no ancilla qubit.
+     *
+     * @param wire Wire to measure.
+     * @param random Uniform random number in [0, 1) drawing the outcome,
+     * which is 0 if random is below the probability of 0.
+     * @return Measured outcome, 0 or 1.
+     */
+    auto measureWire(size_t wire, double random) -> size_t {
+        return collapseWire(wire, random, false);
+    }
+
+    /**
+     * @brief Project the statevector onto an outcome of a wire and
+     * renormalize it, i.e. postselect the outcome.
+     *
+     * @param wire Wire to project.
+     * @param outcome Outcome to project onto, 0 or 1.
+     * @return Probability of the outcome before the projection.
+     */
+    auto collapse(size_t wire, size_t outcome) -> PrecisionT {
+        PL_ABORT_IF(outcome > 1, "The outcome must be 0 or 1.");
+        const auto [prob0, prob1] = wireProbabilities(wire);
+        const auto prob = (outcome == 0) ? prob0 : prob1;
+        PL_ABORT_IF(!(prob > 0), "The outcome has zero probability.");
+        projectWire(wire, outcome, false, prob);
+        return static_cast<PrecisionT>(prob / (prob0 + prob1));
+    }
+
+    /**
+     * @brief Reset a wire to @f$|0\rangle@f$ after measuring it.
+     *
+     * Same as measureWire(), but the amplitudes of outcome 1 are moved to
+     * outcome 0 in the same pass, in place of a subsequent PauliX gate.
+     *
+     * @param wire Wire to reset.
+     * @param random Uniform random number in [0, 1) drawing the outcome.
+     * @return Measured outcome before the reset, 0 or 1.
+     */
+    auto resetWire(size_t wire, double random) -> size_t {
+        return collapseWire(wire, random, true);
+    }
+
+  private:
+    using AccT = Util::accumulator_t<PrecisionT>;
+
+    /**
+     * @brief Get the bit position in the data of a wire.
+     */
+    [[nodiscard]] auto wireBit(size_t wire) const -> size_t {
+        PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+        std::vector<size_t> buffer;
+        return num_qubits_ - 1 - physicalWires({wire}, buffer)[0];
+    }
+
+    /**
+     * @brief Sum the probabilities of the outcomes 0 and 1 of a wire.
+     */
+    auto wireProbabilities(size_t wire) -> std::pair<AccT, AccT> {
+        flushOperations();
+        const auto scope = threadingScope();
+        const size_t rev_wire = wireBit(wire);
+        const size_t bit = size_t{1U} << rev_wire;
+        const ComplexPrecisionT *arr = getPhysicalData();
+        const size_t num_pairs = Util::exp2(num_qubits_ - 1);
+        AccT prob0 = 0;
+        AccT prob1 = 0;
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static) reduction(+:prob0, prob1)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_pairs; k++) {
+            const size_t i0 = ((k >> rev_wire) << (rev_wire + 1)) |
+                              (k & Util::fillTrailingOnes(rev_wire));
+            prob0 += std::norm(arr[i0]);
+            prob1 += std::norm(arr[i0 | bit]);
+        }
+        return {prob0, prob1};
+    }
+
+    /**
+     * @brief Zero the amplitudes of the other outcome of a wire and
+     * renormalize the amplitudes of the given outcome, moving them to
+     * outcome 0 if requested.
+     *
+     * @param wire Wire to project.
+     * @param outcome Outcome to keep.
+     * @param reset Whether the kept amplitudes are moved to outcome 0.
+     * @param prob Unnormalized probability of the outcome.
+     */
+    void projectWire(size_t wire, size_t outcome, bool reset, AccT prob) {
+        const auto scope = threadingScope();
+        const size_t rev_wire = wireBit(wire);
+        const size_t bit = size_t{1U} << rev_wire;
+        ComplexPrecisionT *arr = getData();
+        const size_t num_pairs = Util::exp2(num_qubits_ - 1);
+        const auto scale = static_cast<PrecisionT>(1 / std::sqrt(prob));
+        const bool keep_one = (outcome == 1);
+        const bool move = keep_one && reset;
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t k = 0; k < num_pairs; k++) {
+            const size_t i0 = ((k >> rev_wire) << (rev_wire + 1)) |
+                              (k & Util::fillTrailingOnes(rev_wire));
+            const size_t i1 = i0 | bit;
+            if (move) {
+                arr[i0] = scale * arr[i1];
+                arr[i1] = 0;
+            } else if (keep_one) {
+                arr[i0] = 0;
+                arr[i1] *= scale;
+            } else {
+                arr[i0] *= scale;
+                arr[i1] = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Discard the deferred gates, the Clifford prefix and the wire
+     * map before the data is overwritten, optionally zeroing the data.
+     *
+     * @param zero Whether to zero the data in a parallel pass.
+     * @return Pointer to the data.
+     */
+    auto discardState(bool zero) -> ComplexPrecisionT * {
+        deferred_ops_ = DeferredOperations{};
+        clifford_prefix_.reset();
+        wire_map_.clear();
+        ComplexPrecisionT *arr = getData();
+        if (zero) {
+            const auto scope = threadingScope();
+            const size_t length = getLength();
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp parallel for schedule(static)
+            #endif
+            // clang-format on
+            for (size_t i = 0; i < length; i++) {
+                arr[i] = {0.0, 0.0};
+            }
+        }
+        return arr;
+    }
+
+    /**
+     * @brief Draw the outcome of a wire and collapse the statevector onto it.
+     */
+    auto collapseWire(size_t wire, double random, bool reset) -> size_t {
+        const auto [prob0, prob1] = wireProbabilities(wire);
+        PL_ABORT_IF(!(prob0 + prob1 > 0), "The statevector has zero norm.");
+        const size_t outcome =
+            (!(prob1 > 0) || random * static_cast<double>(prob0 + prob1) <
+                                 static_cast<double>(prob0))
+                ? 0
+                : 1;
+        projectWire(wire, outcome, reset, (outcome == 0) ? prob0 : prob1);
+        return outcome;
+    }
+
+  public:
+    /**
+     * @brief Apply a sparse matrix in the CSR format to the statevector,
+     * i.e. @f$|\psi\rangle \to H|\psi\rangle@f$.
+     *
+     * The matrix need not be unitary, so the result is in general not
+     * normalized.
+     *
+     * @tparam index_type Integer type used as indices of the sparse matrix.
+     * @param row_map_ptr Pointer to the row_map array. Elements of this array
+     * return the number of non-zero terms in all rows before it.
+     * @param row_map_size Number of elements in the row_map.
+     * @param entries_ptr Pointer to the column indices of the non-zero
+     * elements.
+     * @param values_ptr Pointer to the non-zero elements.
+     * @param numNNZ Number of non-zero elements.
+     */
+    template <class index_type>
+    void applySparseMatrix(const index_type *row_map_ptr,
+                           const index_type row_map_size,
+                           const index_type *entries_ptr,
+                           const ComplexPrecisionT *values_ptr,
+                           const index_type numNNZ) {
+        canonicalizeWires();
+        const auto scope = threadingScope();
+        auto *arr = getData();
+        const auto length = static_cast<index_type>(getLength());
+        const auto result =
+            Util::apply_Sparse_Matrix_CSR(arr, length, row_map_ptr,
+                                          row_map_size, entries_ptr,
+                                          values_ptr, numNNZ);
+        std::copy(result.begin(), result.end(), arr);
+    }
 };
 
+/**
+ * @brief Compute the overlap @f$\langle a|b\rangle@f$ of two statevectors.
+ *
+ * Both statevectors are canonicalized (see
+ * StateVectorBase::canonicalizeWires()), and the inner product is computed
+ * in place with a compensated parallel reduction (see
+ * Util::innerProdCKahan()), so that the result is reproducible for any
+ * number of threads.
+ *
+ * @param sv_a Statevector @f$|a\rangle@f$, conjugated.
+ * @param sv_b Statevector @f$|b\rangle@f$.
+ */
+template <class T, class DerivedA, class DerivedB>
+auto overlap(StateVectorBase<T, DerivedA> &sv_a,
+             StateVectorBase<T, DerivedB> &sv_b) -> std::complex<T> {
+    PL_ABORT_IF(sv_a.getNumQubits() != sv_b.getNumQubits(),
+                "The statevectors must have the same number of qubits.");
+    sv_a.canonicalizeWires();
+    sv_b.canonicalizeWires();
+    return Util::innerProdCKahan(std::as_const(sv_a).getData(),
+                                 std::as_const(sv_b).getData(),
+                                 sv_a.getLength());
+}
+
+/**
+ * @brief Compute the fidelity @f$|\langle a|b\rangle|^2@f$ of two
+ * normalized statevectors.
+ *
+ * @see overlap()
+ */
+template <class T, class DerivedA, class DerivedB>
+auto fidelity(StateVectorBase<T, DerivedA> &sv_a,
+              StateVectorBase<T, DerivedB> &sv_b) -> T {
+    return std::norm(overlap(sv_a, sv_b));
+}
+
 /**
  * @brief Streaming operator for StateVector data.
  *
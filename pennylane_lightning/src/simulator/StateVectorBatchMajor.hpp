@@ -0,0 +1,294 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a batch of statevectors stored with the batch as the fastest
+ * varying index.
+ */
+#pragma once
+
+#include "BitUtil.hpp"
+#include "CPUMemoryModel.hpp"
+#include "Constant.hpp"
+#include "ConstantUtil.hpp"
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "KernelType.hpp"
+#include "Memory.hpp"
+#include "Util.hpp"
+#include "cpu_kernels/BatchMajorKernels.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace Pennylane {
+/**
+ * @brief A batch of independent statevectors of the same number of qubits,
+ * stored batch-major.
+ *
+ * Amplitude @f$i@f$ of statevector @f$b@f$ is stored at index
+ * @f$iB + b@f$ of separate real and imaginary arrays, where @f$B@f$ is the
+ * batch size. Applying the same gate with different parameters to every
+ * statevector is then a loop over the batch in the innermost position (see
+ * Gates::BatchMajor), so each SIMD lane handles one statevector and the
+ * vector units are fully used even for gates on the lowest wires or for
+ * states too small for the usual kernels to vectorize.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT = double> class StateVectorBatchMajor {
+  public:
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    using ArrayT = std::vector<PrecisionT, Util::AlignedAllocator<PrecisionT>>;
+
+  private:
+    size_t num_qubits_;
+    size_t batch_size_;
+    ArrayT re_;
+    ArrayT im_;
+
+    // Buffers for the matrices of the batch, reused between gates
+    std::vector<PrecisionT> mat_re_;
+    std::vector<PrecisionT> mat_im_;
+    std::vector<ComplexPrecisionT> column_;
+
+    /**
+     * @brief Compute the matrix (or the diagonal) of a gate for a single
+     * statevector of the batch.
+     *
+     * @param gate_op Gate operation.
+     * @param num_wires Number of wires of the gate.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Parameters of the gate.
+     * @param diagonal Whether to compute the diagonal only.
+     * @param out Output of size dim * dim (or dim) in row-major order.
+     */
+    static void gateMatrix(Gates::GateOperation gate_op, size_t num_wires,
+                           bool inverse, const std::vector<PrecisionT> &params,
+                           bool diagonal, std::vector<ComplexPrecisionT> &out) {
+        const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+        const auto kernel =
+            dispatcher.isRegistered(gate_op, Gates::KernelType::LM)
+                ? Gates::KernelType::LM
+                : Gates::KernelType::PI;
+        const size_t dim = Util::exp2(num_wires);
+        std::vector<size_t> local_wires(num_wires);
+        std::iota(local_wires.begin(), local_wires.end(), size_t{0});
+
+        if (diagonal) {
+            out.assign(dim, {1.0, 0.0});
+            dispatcher.applyOperation(kernel, out.data(), num_wires, gate_op,
+                                      local_wires, inverse, params);
+            return;
+        }
+        out.resize(dim * dim);
+        std::vector<ComplexPrecisionT> column(dim);
+        for (size_t col = 0; col < dim; col++) {
+            std::fill(column.begin(), column.end(), ComplexPrecisionT{});
+            column[col] = {1.0, 0.0};
+            dispatcher.applyOperation(kernel, column.data(), num_wires,
+                                      gate_op, local_wires, inverse, params);
+            for (size_t row = 0; row < dim; row++) {
+                out[row * dim + col] = column[row];
+            }
+        }
+    }
+
+  public:
+    /**
+     * @brief Construct a batch of @f$|0\cdots 0\rangle@f$ states.
+     *
+     * @param num_qubits Number of qubits.
+     * @param batch_size Number of statevectors.
+     */
+    StateVectorBatchMajor(size_t num_qubits, size_t batch_size)
+        : num_qubits_{num_qubits}, batch_size_{batch_size},
+          re_(Util::exp2(num_qubits) * batch_size, 0,
+              getAllocator<PrecisionT>(bestCPUMemoryModel())),
+          im_(Util::exp2(num_qubits) * batch_size, 0,
+              getAllocator<PrecisionT>(bestCPUMemoryModel())) {
+        PL_ABORT_IF(batch_size == 0, "The batch size must be positive.");
+        std::fill(re_.begin(), re_.begin() + batch_size_, PrecisionT{1});
+    }
+
+    /**
+     * @brief Get the number of qubits.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Get the number of statevectors.
+     */
+    [[nodiscard]] auto getBatchSize() const -> size_t { return batch_size_; }
+
+    /**
+     * @brief Get the length of each statevector.
+     */
+    [[nodiscard]] auto getLength() const -> size_t {
+        return Util::exp2(num_qubits_);
+    }
+
+    /**
+     * @brief Overwrite every statevector with the same interleaved complex
+     * data.
+     *
+     * @param data Pointer to the data of length getLength().
+     */
+    void setAllStates(const ComplexPrecisionT *data) {
+        const size_t length = getLength();
+        for (size_t idx = 0; idx < length; idx++) {
+            std::fill_n(re_.begin() + idx * batch_size_, batch_size_,
+                        data[idx].real());
+            std::fill_n(im_.begin() + idx * batch_size_, batch_size_,
+                        data[idx].imag());
+        }
+    }
+
+    /**
+     * @brief Overwrite a statevector of the batch with interleaved complex
+     * data.
+     *
+     * @param batch_idx Index of the statevector.
+     * @param data Pointer to the data of length getLength().
+     */
+    void setState(size_t batch_idx, const ComplexPrecisionT *data) {
+        PL_ABORT_IF(batch_idx >= batch_size_, "Invalid batch index.");
+        const size_t length = getLength();
+        for (size_t idx = 0; idx < length; idx++) {
+            re_[idx * batch_size_ + batch_idx] = data[idx].real();
+            im_[idx * batch_size_ + batch_idx] = data[idx].imag();
+        }
+    }
+
+    /**
+     * @brief Copy a statevector of the batch to interleaved complex data.
+     *
+     * @param batch_idx Index of the statevector.
+     * @param data Pointer to the output of length getLength().
+     */
+    void copyState(size_t batch_idx, ComplexPrecisionT *data) const {
+        PL_ABORT_IF(batch_idx >= batch_size_, "Invalid batch index.");
+        const size_t length = getLength();
+        for (size_t idx = 0; idx < length; idx++) {
+            data[idx] = ComplexPrecisionT{re_[idx * batch_size_ + batch_idx],
+                                          im_[idx * batch_size_ + batch_idx]};
+        }
+    }
+
+    /**
+     * @brief Get a statevector of the batch as interleaved complex data.
+     *
+     * @param batch_idx Index of the statevector.
+     */
+    [[nodiscard]] auto getState(size_t batch_idx) const
+        -> std::vector<ComplexPrecisionT> {
+        std::vector<ComplexPrecisionT> data(getLength());
+        copyState(batch_idx, data.data());
+        return data;
+    }
+
+    /**
+     * @brief Apply a gate to every statevector of the batch, each with its
+     * own parameters.
+     *
+     * @param gate_op Gate operation.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Pointer to the parameters of the first statevector.
+     * Unused for non-parametric gates.
+     * @param params_stride Distance between the parameters of consecutive
+     * statevectors.
+     */
+    void applyOperation(Gates::GateOperation gate_op,
+                        const std::vector<size_t> &wires, bool inverse,
+                        const PrecisionT *params, size_t params_stride) {
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+        }
+        const size_t num_params =
+            Util::lookup(Gates::Constant::gate_num_params, gate_op);
+        const bool diagonal =
+            Util::array_has_elt(Gates::Constant::diagonal_gates, gate_op);
+        const size_t dim = Util::exp2(wires.size());
+        const size_t num_elts = diagonal ? dim : dim * dim;
+
+        mat_re_.resize(num_elts * batch_size_);
+        mat_im_.resize(num_elts * batch_size_);
+        std::vector<PrecisionT> op_params(num_params);
+        for (size_t b = 0; b < batch_size_; b++) {
+            // Non-parametric gates are the same for the whole batch
+            if (b == 0 || num_params > 0) {
+                std::copy(params + b * params_stride,
+                          params + b * params_stride + num_params,
+                          op_params.begin());
+                gateMatrix(gate_op, wires.size(), inverse, op_params, diagonal,
+                           column_);
+            }
+            for (size_t k = 0; k < num_elts; k++) {
+                mat_re_[k * batch_size_ + b] = column_[k].real();
+                mat_im_[k * batch_size_ + b] = column_[k].imag();
+            }
+        }
+
+        if (diagonal) {
+            Gates::BatchMajor::applyDiagonal(re_.data(), im_.data(),
+                                             num_qubits_, batch_size_,
+                                             mat_re_.data(), mat_im_.data(),
+                                             wires);
+            return;
+        }
+        Gates::BatchMajor::applyMatrix(re_.data(), im_.data(), num_qubits_,
+                                       batch_size_, mat_re_.data(),
+                                       mat_im_.data(), wires);
+    }
+
+    /**
+     * @brief Apply a gate to every statevector of the batch, each with its
+     * own parameters.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Parameters of each statevector. May be empty for
+     * non-parametric gates.
+     */
+    void
+    applyOperation(const std::string &opName, const std::vector<size_t> &wires,
+                   bool inverse = false,
+                   const std::vector<std::vector<PrecisionT>> &params = {}) {
+        const auto gate_op =
+            DynamicDispatcher<PrecisionT>::getInstance().strToGateOp(opName);
+        const size_t num_params =
+            Util::lookup(Gates::Constant::gate_num_params, gate_op);
+        if (num_params == 0) {
+            applyOperation(gate_op, wires, inverse, nullptr, 0);
+            return;
+        }
+        PL_ABORT_IF(params.size() != batch_size_,
+                    "The number of parameter sets must match the batch size.");
+        std::vector<PrecisionT> flat;
+        flat.reserve(batch_size_ * num_params);
+        for (const auto &batch_params : params) {
+            PL_ABORT_IF(batch_params.size() != num_params,
+                        "Invalid number of gate parameters.");
+            flat.insert(flat.end(), batch_params.begin(), batch_params.end());
+        }
+        applyOperation(gate_op, wires, inverse, flat.data(), num_params);
+    }
+};
+} // namespace Pennylane
@@ -11,13 +11,17 @@
 #pragma once
 
 #include "BitUtil.hpp"
+#include "CostLayer.hpp"
 #include "Gates.hpp"
 #include "KernelMap.hpp"
 #include "KernelType.hpp"
 #include "Memory.hpp"
+#include "PauliRot.hpp"
 #include "StateVectorBase.hpp"
 #include "Threading.hpp"
 #include "Util.hpp"
+#include "cpu_kernels/GateImplementationsLM.hpp"
+#include "cpu_kernels/GateImplementationsParallelLM.hpp"
 
 namespace Pennylane {
 
@@ -162,5 +166,124 @@ class StateVectorCPU : public StateVectorBase<PrecisionT, Derived> {
         && -> std::unordered_map<Gates::MatrixOperation, Gates::KernelType> {
         return kernel_for_matrices_;
     }
+
+    /**
+     * @brief Apply the cost layer @f$e^{-i\gamma C}@f$ of a diagonal cost
+     * operator @f$C@f$ in a single pass over the statevector.
+     *
+     * This replaces a sweep for each IsingZZ or MultiRZ gate of a QAOA cost
+     * layer. The pass is multi-threaded when the statevector is.
+     *
+     * @param cost Pointer to the diagonal of the cost operator. Its size must
+     * be @f$2^{|\text{wires}|}@f$.
+     * @param wires Wires the cost operator acts on. wires[0] corresponds to
+     * the most significant bit of the index of cost.
+     * @param gamma Parameter @f$\gamma@f$.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyCostLayer(const PrecisionT *cost,
+                        const std::vector<size_t> &wires, PrecisionT gamma,
+                        bool inverse = false) {
+        const auto diag =
+            Gates::costLayerDiagonal(cost, Util::exp2(wires.size()), gamma);
+        applyDiagonalKernel(diag.data(), wires, inverse);
+    }
+
+    /**
+     * @brief Apply the cost layer @f$e^{-i\gamma C}@f$ of a diagonal cost
+     * operator @f$C@f$ in a single pass over the statevector.
+     *
+     * @param cost Diagonal of the cost operator.
+     * @param wires Wires the cost operator acts on.
+     * @param gamma Parameter @f$\gamma@f$.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyCostLayer(const std::vector<PrecisionT> &cost,
+                        const std::vector<size_t> &wires, PrecisionT gamma,
+                        bool inverse = false) {
+        PL_ABORT_IF(cost.size() != Util::exp2(wires.size()),
+                    "The size of cost does not match with the given number "
+                    "of wires");
+        applyCostLayer(cost.data(), wires, gamma, inverse);
+    }
+
+    /**
+     * @brief Apply the generator of the cost layer, i.e. the cost operator
+     * @f$C@f$ itself.
+     *
+     * @param cost Pointer to the diagonal of the cost operator.
+     * @param wires Wires the cost operator acts on.
+     * @return PrecisionT Generator scaling coefficient, i.e. -1 as the cost
+     * layer is @f$e^{-i\gamma C}@f$.
+     */
+    [[nodiscard]] auto applyCostGenerator(const PrecisionT *cost,
+                                          const std::vector<size_t> &wires)
+        -> PrecisionT {
+        const std::vector<ComplexPrecisionT> diag(
+            cost, cost + Util::exp2(wires.size()));
+        applyDiagonalKernel(diag.data(), wires, false);
+        return -1;
+    }
+
+    /**
+     * @brief Apply the Pauli rotation @f$e^{-i\theta P/2}@f$ of a Pauli word
+     * @f$P@f$ in a single pass over the statevector.
+     *
+     * @param wires Wires the Pauli word acts on.
+     * @param inverse Indicate whether inverse should be taken.
+     * @param theta Parameter @f$\theta@f$.
+     * @param word Pauli word of characters I, X, Y and Z, one per wire.
+     */
+    void applyPauliRot(const std::vector<size_t> &wires, bool inverse,
+                       PrecisionT theta, std::string_view word) {
+        this->flushOperations();
+        const auto scope = this->threadingScope();
+        std::vector<size_t> buffer;
+        const auto &phys_wires = this->physicalWires(wires, buffer);
+        Gates::GateImplementationsLM::applyPauliRot(
+            this->getData(), this->getNumQubits(), phys_wires, inverse, theta,
+            word);
+    }
+
+    /**
+     * @brief Apply the generator of the Pauli rotation of a Pauli word
+     * @f$P@f$.
+     *
+     * @param wires Wires the Pauli word acts on.
+     * @param word Pauli word of characters I, X, Y and Z, one per wire.
+     * @return PrecisionT Generator scaling coefficient.
+     */
+    [[nodiscard]] auto applyPauliRotGenerator(const std::vector<size_t> &wires,
+                                              std::string_view word)
+        -> PrecisionT {
+        this->flushOperations();
+        const auto scope = this->threadingScope();
+        std::vector<size_t> buffer;
+        const auto &phys_wires = this->physicalWires(wires, buffer);
+        return Gates::GateImplementationsLM::applyGeneratorPauliRot(
+            this->getData(), this->getNumQubits(), phys_wires, false, word);
+    }
+
+  private:
+    /**
+     * @brief Apply a diagonal matrix using the kernel for the threading of
+     * the statevector.
+     */
+    void applyDiagonalKernel(const ComplexPrecisionT *diag,
+                             const std::vector<size_t> &wires, bool inverse) {
+        this->flushOperations();
+        const auto scope = this->threadingScope();
+        std::vector<size_t> buffer;
+        const auto &phys_wires = this->physicalWires(wires, buffer);
+        if (threading_ == Threading::MultiThread) {
+            Gates::GateImplementationsParallelLM::applyDiagonal(
+                this->getData(), this->getNumQubits(), diag, phys_wires,
+                inverse);
+        } else {
+            Gates::GateImplementationsLM::applyDiagonal(
+                this->getData(), this->getNumQubits(), diag, phys_wires,
+                inverse);
+        }
+    }
 };
 } // namespace Pennylane
@@ -0,0 +1,582 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines the base class of statevectors whose amplitudes are stored as
+ * chunks outside of a single array.
+ */
+#pragma once
+
+#include "BitUtil.hpp"
+#include "CPUMemoryModel.hpp"
+#include "Error.hpp"
+#include "Memory.hpp"
+#include "StateVectorRawCPU.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+namespace Pennylane {
+/**
+ * @brief Base class of statevectors whose amplitudes are stored as chunks,
+ * which are brought into memory one at a time to apply gates.
+ *
+ * The statevector of @f$n@f$ qubits is split into chunks of @f$2^c@f$
+ * amplitudes. As for StateVectorMPI, positions @f$0, \cdots, n-c-1@f$ of
+ * the qubit layout, i.e. the most significant bits of an amplitude index,
+ * select the chunk, and the remaining positions index the amplitudes of the
+ * chunk.
+ *
+ * Gates are applied chunk by chunk: each thread loads a chunk into its own
+ * scratch buffer, applies the gates with the usual kernels and stores the
+ * chunk again. applyOperations() applies consecutive gates acting on chunk
+ * qubits in a single pass, so each chunk is loaded and stored once per
+ * group of gates. Before a gate acts on a chunk selecting qubit, the qubit
+ * is swapped with a chunk qubit the gate does not act on, which exchanges
+ * half of the amplitudes of pairs of chunks. The layout is tracked so that
+ * each wire keeps its meaning.
+ *
+ * The derived class stores the chunks and must provide
+ * - `loadChunk(chunk, data)` and `storeChunk(chunk, data)`, copying a chunk
+ *   from and to an array of @f$2^c@f$ amplitudes,
+ * - `isZeroChunk(chunk)`, true only if all amplitudes of the chunk are
+ *   known to be zero, in which case gates leave it unchanged,
+ * - `prefetchChunk(chunk)`, a hint that the chunk is loaded soon.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @tparam Derived Type of a derived class.
+ */
+template <class PrecisionT, class Derived> class StateVectorChunkedBase {
+  public:
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+
+  protected:
+    using ArrayT = std::vector<ComplexPrecisionT,
+                               Util::AlignedAllocator<ComplexPrecisionT>>;
+
+    /**
+     * @brief Gate on chunk qubits, recorded until the chunks are visited.
+     */
+    struct ChunkOp {
+        std::string name;
+        std::vector<size_t> wires; // Wires of the chunk
+        bool inverse;
+        std::vector<PrecisionT> params;
+        std::vector<ComplexPrecisionT> matrix; // Empty for named gates
+    };
+
+    size_t num_qubits_;
+    size_t num_chunk_qubits_;
+    size_t num_global_qubits_;
+    std::vector<size_t> pos_to_wire_; // Wire at each position of the layout
+    std::vector<size_t> wire_to_pos_;
+
+    /**
+     * @param num_qubits Number of qubits.
+     * @param num_chunk_qubits Number of qubits of each chunk.
+     */
+    StateVectorChunkedBase(size_t num_qubits, size_t num_chunk_qubits)
+        : num_qubits_{num_qubits}, num_chunk_qubits_{num_chunk_qubits},
+          num_global_qubits_{num_qubits - num_chunk_qubits},
+          pos_to_wire_(num_qubits), wire_to_pos_(num_qubits) {
+        PL_ABORT_IF(num_chunk_qubits == 0 || num_chunk_qubits > num_qubits,
+                    "The number of chunk qubits must be between 1 and the "
+                    "number of qubits.");
+        PL_ABORT_IF(num_qubits >= std::numeric_limits<size_t>::digits,
+                    "The number of qubits must be smaller than 64.");
+        resetLayout();
+    }
+
+    [[nodiscard]] auto derived() -> Derived & {
+        return static_cast<Derived &>(*this);
+    }
+
+    [[nodiscard]] auto derived() const -> const Derived & {
+        return static_cast<const Derived &>(*this);
+    }
+
+    [[nodiscard]] auto chunkLength() const -> size_t {
+        return Util::exp2(num_chunk_qubits_);
+    }
+
+    [[nodiscard]] auto makeScratch() const -> ArrayT {
+        return ArrayT(chunkLength(),
+                      getAllocator<ComplexPrecisionT>(bestCPUMemoryModel()));
+    }
+
+    /**
+     * @brief Get the number of threads sharing the chunks of a parallel
+     * region.
+     */
+    static auto numRegionThreads() -> size_t {
+#if defined(_OPENMP)
+        return static_cast<size_t>(omp_get_num_threads());
+#else
+        return 1;
+#endif
+    }
+
+    /**
+     * @brief Reset the layout to the identity.
+     */
+    void resetLayout() {
+        std::iota(pos_to_wire_.begin(), pos_to_wire_.end(), size_t{0});
+        std::iota(wire_to_pos_.begin(), wire_to_pos_.end(), size_t{0});
+    }
+
+    /**
+     * @brief Apply gates on chunk qubits to all chunks.
+     *
+     * Zero chunks are skipped. The first other chunk is processed before the
+     * others, so an invalid gate throws before any chunk is changed.
+     */
+    void applyChunkOps(const std::vector<ChunkOp> &ops) {
+        if (ops.empty()) {
+            return;
+        }
+        const size_t length = chunkLength();
+        Derived &storage = derived();
+        const auto apply = [&](size_t chunk, ArrayT &scratch) {
+            storage.loadChunk(chunk, scratch.data());
+            StateVectorRawCPU<PrecisionT> sv(scratch.data(), length);
+            for (const auto &op : ops) {
+                if (op.matrix.empty()) {
+                    sv.applyOperation(op.name, op.wires, op.inverse,
+                                      op.params);
+                } else {
+                    sv.applyMatrix(op.matrix.data(), op.wires, op.inverse);
+                }
+            }
+            storage.storeChunk(chunk, scratch.data());
+        };
+
+        const size_t num_chunks = getNumChunks();
+        size_t first = 0;
+        while (first < num_chunks && storage.isZeroChunk(first)) {
+            first++;
+        }
+        if (first == num_chunks) {
+            return;
+        }
+        {
+            ArrayT scratch = makeScratch();
+            apply(first, scratch);
+        }
+
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel
+        #endif
+        // clang-format on
+        {
+            ArrayT scratch = makeScratch();
+            const size_t stride = numRegionThreads();
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp for schedule(dynamic)
+            #endif
+            // clang-format on
+            for (size_t chunk = first + 1; chunk < num_chunks; chunk++) {
+                if (chunk + stride < num_chunks) {
+                    storage.prefetchChunk(chunk + stride);
+                }
+                if (!storage.isZeroChunk(chunk)) {
+                    apply(chunk, scratch);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Swap a chunk selecting position and a chunk position of the
+     * layout.
+     *
+     * Each pair of chunks differing only in the bit of the global position
+     * exchanges the amplitudes whose bit at the chunk position differs from
+     * the bit of their chunk.
+     */
+    void swapGlobalLocal(size_t global_pos, size_t local_pos) {
+        const size_t length = chunkLength();
+        const size_t chunk_bit = num_global_qubits_ - 1 - global_pos;
+        const size_t local_bit = num_qubits_ - 1 - local_pos;
+        const size_t num_pairs = getNumChunks() / 2;
+        const size_t chunk_low_mask = (size_t{1} << chunk_bit) - 1;
+        const size_t local_low_mask = (size_t{1} << local_bit) - 1;
+        const auto pair_chunk = [=](size_t pair) {
+            return ((pair >> chunk_bit) << (chunk_bit + 1)) |
+                   (pair & chunk_low_mask);
+        };
+        Derived &storage = derived();
+
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel
+        #endif
+        // clang-format on
+        {
+            ArrayT scratch0 = makeScratch();
+            ArrayT scratch1 = makeScratch();
+            const size_t stride = numRegionThreads();
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp for schedule(dynamic)
+            #endif
+            // clang-format on
+            for (size_t pair = 0; pair < num_pairs; pair++) {
+                const size_t chunk0 = pair_chunk(pair);
+                const size_t chunk1 = chunk0 | (size_t{1} << chunk_bit);
+                if (pair + stride < num_pairs) {
+                    const size_t next = pair_chunk(pair + stride);
+                    storage.prefetchChunk(next);
+                    storage.prefetchChunk(next | (size_t{1} << chunk_bit));
+                }
+                if (storage.isZeroChunk(chunk0) &&
+                    storage.isZeroChunk(chunk1)) {
+                    continue;
+                }
+                storage.loadChunk(chunk0, scratch0.data());
+                storage.loadChunk(chunk1, scratch1.data());
+                for (size_t j = 0; j < length / 2; j++) {
+                    const size_t idx0 =
+                        ((j >> local_bit) << (local_bit + 1)) |
+                        (j & local_low_mask);
+                    std::swap(scratch0[idx0 | (size_t{1} << local_bit)],
+                              scratch1[idx0]);
+                }
+                storage.storeChunk(chunk0, scratch0.data());
+                storage.storeChunk(chunk1, scratch1.data());
+            }
+        }
+        swapPositions(global_pos, local_pos);
+    }
+
+    void swapPositions(size_t pos0, size_t pos1) {
+        std::swap(pos_to_wire_[pos0], pos_to_wire_[pos1]);
+        wire_to_pos_[pos_to_wire_[pos0]] = pos0;
+        wire_to_pos_[pos_to_wire_[pos1]] = pos1;
+    }
+
+    /**
+     * @brief Check whether the given wires are at chunk positions and get
+     * their wires on the chunks.
+     */
+    auto chunkWires(const std::vector<size_t> &wires) const
+        -> std::optional<std::vector<size_t>> {
+        std::vector<size_t> local_wires;
+        local_wires.reserve(wires.size());
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire.");
+            if (wire_to_pos_[wire] < num_global_qubits_) {
+                return std::nullopt;
+            }
+            local_wires.push_back(wire_to_pos_[wire] - num_global_qubits_);
+        }
+        return local_wires;
+    }
+
+    /**
+     * @brief Move the given wires to chunk positions and get their wires on
+     * the chunks.
+     *
+     * Chunk selecting wires are swapped with the least significant chunk
+     * positions not used by the given wires.
+     */
+    auto localizeWires(const std::vector<size_t> &wires)
+        -> std::vector<size_t> {
+        PL_ABORT_IF(wires.size() > num_chunk_qubits_,
+                    "The operation acts on more wires than there are chunk "
+                    "qubits.");
+        std::vector<bool> used(num_qubits_, false);
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire.");
+            used[wire_to_pos_[wire]] = true;
+        }
+        size_t candidate = num_qubits_;
+        std::vector<size_t> local_wires;
+        local_wires.reserve(wires.size());
+        for (const size_t wire : wires) {
+            if (wire_to_pos_[wire] < num_global_qubits_) {
+                do {
+                    candidate--;
+                } while (used[candidate]);
+                used[candidate] = true;
+                swapGlobalLocal(wire_to_pos_[wire], candidate);
+            }
+            local_wires.push_back(wire_to_pos_[wire] - num_global_qubits_);
+        }
+        return local_wires;
+    }
+
+    /**
+     * @brief Record a gate for applyChunkOps(), applying the recorded gates
+     * first if its wires must be moved to chunk positions.
+     */
+    void recordOp(std::vector<ChunkOp> &pending, ChunkOp op) {
+        if (auto local_wires = chunkWires(op.wires); local_wires) {
+            op.wires = std::move(*local_wires);
+        } else {
+            applyChunkOps(pending);
+            pending.clear();
+            op.wires = localizeWires(op.wires);
+        }
+        pending.push_back(std::move(op));
+    }
+
+    /**
+     * @brief Sum values computed from every chunk which is not a zero chunk,
+     * with the chunks distributed over the threads.
+     *
+     * @param num_values Number of values.
+     * @param func Function called with the index of a chunk, its
+     * amplitudes, their number and the values to add to.
+     */
+    template <class Func>
+    auto accumulateChunks(size_t num_values, Func &&func) const
+        -> std::vector<PrecisionT> {
+        const size_t num_chunks = getNumChunks();
+        const size_t length = chunkLength();
+        const Derived &storage = derived();
+        std::vector<PrecisionT> result(num_values, 0);
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel
+        #endif
+        // clang-format on
+        {
+            ArrayT scratch = makeScratch();
+            std::vector<PrecisionT> local(num_values, 0);
+            const size_t stride = numRegionThreads();
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp for schedule(dynamic) nowait
+            #endif
+            // clang-format on
+            for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+                if (chunk + stride < num_chunks) {
+                    storage.prefetchChunk(chunk + stride);
+                }
+                if (storage.isZeroChunk(chunk)) {
+                    continue;
+                }
+                storage.loadChunk(chunk, scratch.data());
+                func(chunk, scratch.data(), length, local.data());
+            }
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp critical
+            #endif
+            // clang-format on
+            for (size_t k = 0; k < num_values; k++) {
+                result[k] += local[k];
+            }
+        }
+        return result;
+    }
+
+  public:
+    /**
+     * @brief Set the amplitudes from the full statevector.
+     *
+     * @param data Amplitudes of the full statevector.
+     * @param length Number of amplitudes, i.e. `2^getNumQubits()`.
+     */
+    void setFullState(const ComplexPrecisionT *data, size_t length) {
+        PL_ABORT_IF(length != Util::exp2(num_qubits_),
+                    "The length of the statevector does not match the "
+                    "number of qubits.");
+        const size_t chunk_length = chunkLength();
+        const size_t num_chunks = getNumChunks();
+        Derived &storage = derived();
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            storage.storeChunk(chunk, data + chunk * chunk_length);
+        }
+        resetLayout();
+    }
+
+    /**
+     * @brief Get the full statevector.
+     *
+     * Intended for testing and small statevectors, as the full statevector
+     * is allocated.
+     */
+    [[nodiscard]] auto getFullState() const -> std::vector<ComplexPrecisionT> {
+        std::vector<ComplexPrecisionT> state(Util::exp2(num_qubits_));
+        ArrayT scratch = makeScratch();
+        for (size_t chunk = 0; chunk < getNumChunks(); chunk++) {
+            if (derived().isZeroChunk(chunk)) {
+                continue;
+            }
+            derived().loadChunk(chunk, scratch.data());
+            for (size_t i = 0; i < scratch.size(); i++) {
+                const size_t idx = (chunk << num_chunk_qubits_) | i;
+                size_t logical = 0;
+                for (size_t pos = 0; pos < num_qubits_; pos++) {
+                    const size_t bit = (idx >> (num_qubits_ - 1 - pos)) & 1U;
+                    logical |= bit << (num_qubits_ - 1 - pos_to_wire_[pos]);
+                }
+                state[logical] = scratch[i];
+            }
+        }
+        return state;
+    }
+
+    /**
+     * @brief Get the total number of qubits.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Get the number of qubits of each chunk.
+     */
+    [[nodiscard]] auto getNumChunkQubits() const -> size_t {
+        return num_chunk_qubits_;
+    }
+
+    /**
+     * @brief Get the number of chunks.
+     */
+    [[nodiscard]] auto getNumChunks() const -> size_t {
+        return Util::exp2(num_global_qubits_);
+    }
+
+    /**
+     * @brief Get the wire at each position of the current layout.
+     */
+    [[nodiscard]] auto getLayout() const -> const std::vector<size_t> & {
+        return pos_to_wire_;
+    }
+
+    /**
+     * @brief Apply a single gate to the statevector.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        std::vector<ChunkOp> pending;
+        recordOp(pending, {opName, wires, inverse, params, {}});
+        applyChunkOps(pending);
+    }
+
+    /**
+     * @brief Apply multiple gates to the statevector.
+     *
+     * Consecutive gates acting on chunk qubits are applied in a single pass
+     * over the chunks.
+     *
+     * @param ops Vector of gate names to be applied in order.
+     * @param ops_wires Vector of wires on which to apply index-matched gate
+     * name.
+     * @param ops_inverse Indicates whether gate at matched index is to be
+     * inverted.
+     * @param ops_params Parameter data for index matched gates.
+     */
+    void
+    applyOperations(const std::vector<std::string> &ops,
+                    const std::vector<std::vector<size_t>> &ops_wires,
+                    const std::vector<bool> &ops_inverse,
+                    const std::vector<std::vector<PrecisionT>> &ops_params) {
+        PL_ABORT_IF(ops.size() != ops_wires.size() ||
+                        ops.size() != ops_inverse.size() ||
+                        ops.size() != ops_params.size(),
+                    "Invalid arguments: number of operations, wires, "
+                    "inverses, and parameters must all be equal");
+        std::vector<ChunkOp> pending;
+        for (size_t i = 0; i < ops.size(); i++) {
+            recordOp(pending,
+                     {ops[i], ops_wires[i], ops_inverse[i], ops_params[i], {}});
+        }
+        applyChunkOps(pending);
+    }
+
+    /**
+     * @brief Apply a matrix to the statevector.
+     *
+     * @param matrix Row-major matrix of size `2^wires.size()`.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyMatrix(const std::vector<ComplexPrecisionT> &matrix,
+                     const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ABORT_IF(matrix.size() != Util::exp2(2 * wires.size()),
+                    "The size of matrix does not match with the given "
+                    "number of wires");
+        std::vector<ChunkOp> pending;
+        recordOp(pending, {"Matrix", wires, inverse, {}, matrix});
+        applyChunkOps(pending);
+    }
+
+    /**
+     * @brief Compute the squared norm of the statevector.
+     */
+    [[nodiscard]] auto getNorm2() const -> PrecisionT {
+        return accumulateChunks(1, [](size_t, const ComplexPrecisionT *data,
+                                      size_t length, PrecisionT *norm2) {
+            for (size_t i = 0; i < length; i++) {
+                *norm2 += std::norm(data[i]);
+            }
+        })[0];
+    }
+
+    /**
+     * @brief Probabilities of the computational basis states of the given
+     * wires, with the first wire as the most significant bit.
+     *
+     * @param wires Wires to measure.
+     */
+    [[nodiscard]] auto probs(const std::vector<size_t> &wires) const
+        -> std::vector<PrecisionT> {
+        std::vector<size_t> rev_pos(wires.size());
+        for (size_t idx = 0; idx < wires.size(); idx++) {
+            PL_ABORT_IF(wires[idx] >= num_qubits_, "Invalid wire.");
+            rev_pos[idx] = num_qubits_ - 1 - wire_to_pos_[wires[idx]];
+        }
+        const size_t num_chunk_qubits = num_chunk_qubits_;
+        return accumulateChunks(
+            Util::exp2(wires.size()),
+            [&rev_pos, num_chunk_qubits](size_t chunk,
+                                         const ComplexPrecisionT *data,
+                                         size_t length, PrecisionT *probs) {
+                for (size_t i = 0; i < length; i++) {
+                    const size_t idx = (chunk << num_chunk_qubits) | i;
+                    size_t outcome = 0;
+                    for (const size_t bit : rev_pos) {
+                        outcome = (outcome << 1U) | ((idx >> bit) & 1U);
+                    }
+                    probs[outcome] += std::norm(data[i]);
+                }
+            });
+    }
+};
+} // namespace Pennylane
@@ -0,0 +1,265 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a statevector stored as compressed chunks.
+ */
+#pragma once
+
+#include "BitUtil.hpp"
+#include "Error.hpp"
+#include "StateVectorChunkedBase.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace Pennylane {
+/**
+ * @brief Compression of the chunks of a StateVectorCompressedCPU.
+ */
+enum class ChunkCompression : uint8_t {
+    /** Nonzero blocks of amplitudes are stored exactly. */
+    Lossless,
+    /**
+     * Nonzero blocks of amplitudes are stored as 16-bit integers scaled by a
+     * power of 2 shared by the block. The error of each real or imaginary
+     * part is at most @f$2^{-15}@f$ times the largest one of the block.
+     */
+    Fixed16,
+};
+
+/**
+ * @brief Statevector whose amplitudes are stored as compressed chunks,
+ * trading compute for memory beyond the qubit counts fitting in RAM.
+ *
+ * The chunks are laid out and updated as described for
+ * StateVectorChunkedBase. Each chunk is split into blocks of block_size
+ * amplitudes, and only the blocks with a nonzero amplitude are stored,
+ * compressed according to ChunkCompression. A chunk without nonzero
+ * amplitude takes no memory and is skipped by gates. With Fixed16, every
+ * pass over the chunks adds the rounding error of one compression.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT = double>
+class StateVectorCompressedCPU
+    : public StateVectorChunkedBase<PrecisionT,
+                                    StateVectorCompressedCPU<PrecisionT>> {
+  public:
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+
+    /**
+     * @brief Number of amplitudes of a block.
+     */
+    static constexpr size_t block_size = 32;
+
+  private:
+    using BaseType =
+        StateVectorChunkedBase<PrecisionT,
+                               StateVectorCompressedCPU<PrecisionT>>;
+    friend BaseType;
+    using Bytes = std::vector<uint8_t>;
+
+    ChunkCompression compression_;
+    std::vector<Bytes> chunks_;
+
+    /**
+     * @brief Compress amplitudes.
+     *
+     * The result starts with a bitmap of the blocks with a nonzero
+     * amplitude, followed by the data of these blocks. It is empty if all
+     * amplitudes are zero.
+     *
+     * @param data Amplitudes.
+     * @param length Number of amplitudes, a power of 2.
+     * @param compression Compression of the blocks.
+     * @param out Compressed data.
+     */
+    static void compress(const ComplexPrecisionT *data, size_t length,
+                         ChunkCompression compression, Bytes &out) {
+        const size_t block_length = std::min(block_size, length);
+        const size_t num_blocks = length / block_length;
+        const size_t num_words = (num_blocks + 63) / 64;
+        std::vector<uint64_t> bitmap(num_words, 0);
+        Bytes payload;
+        std::vector<int16_t> fixed(2 * block_length);
+
+        for (size_t block = 0; block < num_blocks; block++) {
+            const ComplexPrecisionT *block_data = data + block * block_length;
+            PrecisionT max_abs = 0;
+            for (size_t k = 0; k < block_length; k++) {
+                max_abs = std::max({max_abs, std::abs(block_data[k].real()),
+                                    std::abs(block_data[k].imag())});
+            }
+            if (max_abs == PrecisionT{0}) {
+                continue;
+            }
+            bitmap[block / 64] |= uint64_t{1U} << (block % 64);
+            const size_t offset = payload.size();
+            if (compression == ChunkCompression::Lossless) {
+                const size_t num_bytes =
+                    block_length * sizeof(ComplexPrecisionT);
+                payload.resize(offset + num_bytes);
+                std::memcpy(payload.data() + offset, block_data, num_bytes);
+                continue;
+            }
+            // max_abs < 2^exponent
+            int exponent = 0;
+            std::frexp(max_abs, &exponent);
+            const PrecisionT scale = std::ldexp(PrecisionT{32767}, -exponent);
+            for (size_t k = 0; k < block_length; k++) {
+                fixed[2 * k] = static_cast<int16_t>(
+                    std::lround(block_data[k].real() * scale));
+                fixed[2 * k + 1] = static_cast<int16_t>(
+                    std::lround(block_data[k].imag() * scale));
+            }
+            const auto exponent32 = static_cast<int32_t>(exponent);
+            const size_t num_bytes = fixed.size() * sizeof(int16_t);
+            payload.resize(offset + sizeof(int32_t) + num_bytes);
+            std::memcpy(payload.data() + offset, &exponent32, sizeof(int32_t));
+            std::memcpy(payload.data() + offset + sizeof(int32_t),
+                        fixed.data(), num_bytes);
+        }
+
+        if (payload.empty()) {
+            Bytes{}.swap(out);
+            return;
+        }
+        Bytes result(num_words * sizeof(uint64_t) + payload.size());
+        std::memcpy(result.data(), bitmap.data(),
+                    num_words * sizeof(uint64_t));
+        std::copy(payload.begin(), payload.end(),
+                  result.begin() +
+                      static_cast<ptrdiff_t>(num_words * sizeof(uint64_t)));
+        out.swap(result);
+    }
+
+    /**
+     * @brief Decompress amplitudes compressed by compress().
+     *
+     * @param in Compressed data.
+     * @param length Number of amplitudes.
+     * @param compression Compression of the blocks.
+     * @param data Amplitudes.
+     */
+    static void decompress(const Bytes &in, size_t length,
+                           ChunkCompression compression,
+                           ComplexPrecisionT *data) {
+        std::fill(data, data + length, ComplexPrecisionT{0, 0});
+        if (in.empty()) {
+            return;
+        }
+        const size_t block_length = std::min(block_size, length);
+        const size_t num_blocks = length / block_length;
+        const size_t num_words = (num_blocks + 63) / 64;
+        std::vector<uint64_t> bitmap(num_words);
+        std::memcpy(bitmap.data(), in.data(), num_words * sizeof(uint64_t));
+        const uint8_t *payload = in.data() + num_words * sizeof(uint64_t);
+        std::vector<int16_t> fixed(2 * block_length);
+
+        for (size_t block = 0; block < num_blocks; block++) {
+            if (((bitmap[block / 64] >> (block % 64)) & 1U) == 0) {
+                continue;
+            }
+            ComplexPrecisionT *block_data = data + block * block_length;
+            if (compression == ChunkCompression::Lossless) {
+                const size_t num_bytes =
+                    block_length * sizeof(ComplexPrecisionT);
+                std::memcpy(block_data, payload, num_bytes);
+                payload += num_bytes;
+                continue;
+            }
+            int32_t exponent = 0;
+            std::memcpy(&exponent, payload, sizeof(int32_t));
+            const size_t num_bytes = fixed.size() * sizeof(int16_t);
+            std::memcpy(fixed.data(), payload + sizeof(int32_t), num_bytes);
+            payload += sizeof(int32_t) + num_bytes;
+            const PrecisionT unit =
+                std::ldexp(PrecisionT{1}, exponent) / PrecisionT{32767};
+            for (size_t k = 0; k < block_length; k++) {
+                block_data[k] = {static_cast<PrecisionT>(fixed[2 * k]) * unit,
+                                 static_cast<PrecisionT>(fixed[2 * k + 1]) *
+                                     unit};
+            }
+        }
+    }
+
+    void loadChunk(size_t chunk, ComplexPrecisionT *data) const {
+        decompress(chunks_[chunk], this->chunkLength(), compression_, data);
+    }
+
+    void storeChunk(size_t chunk, const ComplexPrecisionT *data) {
+        compress(data, this->chunkLength(), compression_, chunks_[chunk]);
+    }
+
+    [[nodiscard]] auto isZeroChunk(size_t chunk) const -> bool {
+        return chunks_[chunk].empty();
+    }
+
+    void prefetchChunk([[maybe_unused]] size_t chunk) const {}
+
+  public:
+    /**
+     * @brief Create a statevector in the state @f$|0\cdots 0\rangle@f$.
+     *
+     * @param num_qubits Number of qubits.
+     * @param num_chunk_qubits Number of qubits of each chunk. Each thread
+     * holds up to two decompressed chunks at once.
+     * @param compression Compression of the chunks.
+     */
+    StateVectorCompressedCPU(
+        size_t num_qubits, size_t num_chunk_qubits,
+        ChunkCompression compression = ChunkCompression::Lossless)
+        : BaseType(num_qubits, num_chunk_qubits), compression_{compression} {
+        chunks_.resize(this->getNumChunks());
+        resetState();
+    }
+
+    /**
+     * @brief Reset the statevector to @f$|0\cdots 0\rangle@f$ and the layout
+     * to the identity.
+     */
+    void resetState() {
+        for (auto &chunk : chunks_) {
+            Bytes{}.swap(chunk);
+        }
+        auto scratch = this->makeScratch();
+        scratch[0] = {1, 0};
+        storeChunk(0, scratch.data());
+        this->resetLayout();
+    }
+
+    /**
+     * @brief Get the compression of the chunks.
+     */
+    [[nodiscard]] auto getCompression() const -> ChunkCompression {
+        return compression_;
+    }
+
+    /**
+     * @brief Get the number of bytes of the compressed chunks.
+     */
+    [[nodiscard]] auto getCompressedSize() const -> size_t {
+        return std::accumulate(
+            chunks_.begin(), chunks_.end(), size_t{0},
+            [](size_t sum, const Bytes &chunk) { return sum + chunk.size(); });
+    }
+};
+} // namespace Pennylane
@@ -0,0 +1,657 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a statevector restricted to the basis states of a fixed Hamming
+ * weight.
+ */
+#pragma once
+
+#include "BitUtil.hpp"
+#include "CPUMemoryModel.hpp"
+#include "Constant.hpp"
+#include "ConstantUtil.hpp"
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "KernelType.hpp"
+#include "LinearAlgebra.hpp"
+#include "Memory.hpp"
+#include "PauliSum.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <complex>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace Pennylane {
+/**
+ * @brief A statevector of @f$n@f$ qubits holding only the amplitudes of the
+ * basis states with @f$k@f$ ones, i.e. a state of @f$k@f$ particles in
+ * @f$n@f$ modes.
+ *
+ * Circuits of particle-conserving gates, such as the excitation gates of
+ * UCCSD ansätze, applied to a basis state never leave this subspace, whose
+ * dimension @f$\binom{n}{k}@f$ is much smaller than @f$2^n@f$, e.g. 13M
+ * instead of 268M amplitudes for 10 electrons in 28 spin-orbitals.
+ *
+ * The basis state with ones at bit positions @f$c_1 < \dots < c_k@f$ is
+ * stored at index @f$\sum_j \binom{c_j}{j}@f$ (combinatorial number system),
+ * which orders the basis states as their indices in the full statevector.
+ * Consecutive basis states are enumerated with Gosper's hack, so kernels
+ * rank and unrank basis states only at the start of each chunk and for the
+ * partners of a basis state under a gate.
+ *
+ * Gates must conserve the Hamming weight of the basis states, i.e. their
+ * matrix must only connect local basis states of the same weight.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT = double> class StateVectorFixedWeightCPU {
+  public:
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+
+  private:
+    using ArrayT = std::vector<ComplexPrecisionT,
+                               Util::AlignedAllocator<ComplexPrecisionT>>;
+
+    static constexpr size_t chunk_size = size_t{1U} << 12U;
+
+    size_t num_qubits_;
+    size_t weight_;
+    std::vector<size_t> binom_; // binom_[m * (weight_ + 1) + j] = C(m, j)
+    ArrayT data_;
+
+    [[nodiscard]] auto binom(size_t m, size_t j) const -> size_t {
+        return binom_[m * (weight_ + 1) + j];
+    }
+
+    /**
+     * @brief Get the basis state following a basis state of the same
+     * weight in increasing order (Gosper's hack).
+     */
+    [[nodiscard]] static auto nextState(size_t state) -> size_t {
+        const size_t lowest = state & (~state + 1);
+        const size_t ripple = state + lowest;
+        return (((ripple ^ state) >> 2U) / lowest) | ripple;
+    }
+
+    /**
+     * @brief Call a function with the ranges of indices of the subspace
+     * data, in parallel over chunks.
+     *
+     * @param func Function of the first and last (excluded) index.
+     */
+    template <class Func> void forEachChunk(Func &&func) const {
+        const size_t length = getLength();
+        const size_t num_chunks = (length + chunk_size - 1) / chunk_size;
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static) if (num_chunks > 1)
+        #endif
+        // clang-format on
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            const size_t begin = chunk * chunk_size;
+            func(begin, std::min(begin + chunk_size, length));
+        }
+    }
+
+    /**
+     * @brief Get the bits of a basis state holding each local index of a
+     * gate on some wires.
+     */
+    [[nodiscard]] auto scatterBits(const std::vector<size_t> &wires) const
+        -> std::vector<size_t> {
+        const size_t num_wires = wires.size();
+        std::vector<size_t> scatter(Util::exp2(num_wires), 0);
+        for (size_t k = 0; k < num_wires; k++) {
+            const size_t bit = size_t{1U} << (num_qubits_ - 1 - wires[k]);
+            const size_t local_bit = size_t{1U} << (num_wires - 1 - k);
+            for (size_t local = 0; local < scatter.size(); local++) {
+                if ((local & local_bit) != 0) {
+                    scatter[local] |= bit;
+                }
+            }
+        }
+        return scatter;
+    }
+
+    /**
+     * @brief Get the local index of a basis state for a gate on some wires.
+     */
+    [[nodiscard]] auto gatherBits(size_t state,
+                                  const std::vector<size_t> &wires) const
+        -> size_t {
+        size_t local = 0;
+        for (const size_t wire : wires) {
+            local = (local << 1U) | ((state >> (num_qubits_ - 1 - wire)) & 1U);
+        }
+        return local;
+    }
+
+    void checkWires(const std::vector<size_t> &wires) const {
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+        }
+    }
+
+    /**
+     * @brief Compute the diagonal of a diagonal gate (or of its generator),
+     * or the matrix of any other gate (or of its generator), acting on its
+     * own wires.
+     *
+     * @param opName Name of the gate.
+     * @param num_wires Number of wires of the gate.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Parameters of the gate.
+     * @param diagonal Whether to compute the diagonal only.
+     * @param scale Set to the scaling factor of the generator if not
+     * nullptr, in which case the generator is computed.
+     * @return Diagonal of size dim, or matrix of size dim * dim in
+     * row-major order.
+     */
+    static auto gateMatrix(const std::string &opName, size_t num_wires,
+                           bool inverse, const std::vector<PrecisionT> &params,
+                           bool diagonal, PrecisionT *scale = nullptr)
+        -> std::vector<ComplexPrecisionT> {
+        using Gates::KernelType;
+        const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+        const size_t dim = Util::exp2(num_wires);
+        std::vector<size_t> local_wires(num_wires);
+        std::iota(local_wires.begin(), local_wires.end(), size_t{0});
+
+        const auto apply = [&](ComplexPrecisionT *column) {
+            if (scale != nullptr) {
+                const auto gntr_op = dispatcher.strToGeneratorOp(opName);
+                const auto kernel =
+                    dispatcher.isRegistered(gntr_op, KernelType::LM)
+                        ? KernelType::LM
+                        : KernelType::PI;
+                *scale = dispatcher.applyGenerator(
+                    kernel, column, num_wires, gntr_op, local_wires, inverse);
+                return;
+            }
+            const auto gate_op = dispatcher.strToGateOp(opName);
+            const auto kernel = dispatcher.isRegistered(gate_op, KernelType::LM)
+                                    ? KernelType::LM
+                                    : KernelType::PI;
+            dispatcher.applyOperation(kernel, column, num_wires, gate_op,
+                                      local_wires, inverse, params);
+        };
+
+        if (diagonal) {
+            std::vector<ComplexPrecisionT> diag(dim, {1.0, 0.0});
+            apply(diag.data());
+            return diag;
+        }
+        std::vector<ComplexPrecisionT> matrix(dim * dim);
+        std::vector<ComplexPrecisionT> column(dim);
+        for (size_t col = 0; col < dim; col++) {
+            std::fill(column.begin(), column.end(), ComplexPrecisionT{});
+            column[col] = {1.0, 0.0};
+            apply(column.data());
+            for (size_t row = 0; row < dim; row++) {
+                matrix[row * dim + col] = column[row];
+            }
+        }
+        return matrix;
+    }
+
+    /**
+     * @brief Multiply the amplitudes by a diagonal matrix.
+     *
+     * @param diag Diagonal of size dim.
+     * @param wires Wires the matrix acts on.
+     */
+    void applyDiagonalMatrix(const std::vector<ComplexPrecisionT> &diag,
+                             const std::vector<size_t> &wires) {
+        forEachChunk([&](size_t begin, size_t end) {
+            size_t state = stateOf(begin);
+            for (size_t idx = begin; idx < end; idx++) {
+                data_[idx] *= diag[gatherBits(state, wires)];
+                if (idx + 1 < end) {
+                    state = nextState(state);
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Apply a weight-conserving matrix.
+     *
+     * The local basis states of each weight form a block of the matrix.
+     * Each group of basis states differing only on the wires is updated by
+     * its member with the smallest local index.
+     *
+     * @param matrix Matrix of size dim * dim in row-major order.
+     * @param wires Wires the matrix acts on.
+     */
+    void applyBlockMatrix(const std::vector<ComplexPrecisionT> &matrix,
+                          const std::vector<size_t> &wires) {
+        const size_t num_wires = wires.size();
+        const size_t dim = Util::exp2(num_wires);
+
+        std::vector<std::vector<size_t>> blocks(num_wires + 1);
+        for (size_t local = 0; local < dim; local++) {
+            blocks[std::popcount(local)].emplace_back(local);
+        }
+        bool diagonal = true;
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                if (matrix[row * dim + col] == ComplexPrecisionT{}) {
+                    continue;
+                }
+                PL_ABORT_IF(std::popcount(row) != std::popcount(col),
+                            "The operation does not conserve the Hamming "
+                            "weight.");
+                diagonal = diagonal && row == col;
+            }
+        }
+        if (diagonal) {
+            std::vector<ComplexPrecisionT> diag(dim);
+            for (size_t idx = 0; idx < dim; idx++) {
+                diag[idx] = matrix[idx * dim + idx];
+            }
+            applyDiagonalMatrix(diag, wires);
+            return;
+        }
+
+        const auto scatter = scatterBits(wires);
+        const size_t wires_mask = scatter[dim - 1];
+        const size_t max_block =
+            std::max_element(blocks.begin(), blocks.end(),
+                             [](const auto &lhs, const auto &rhs) {
+                                 return lhs.size() < rhs.size();
+                             })
+                ->size();
+        forEachChunk([&](size_t begin, size_t end) {
+            std::vector<size_t> indices(max_block);
+            std::vector<ComplexPrecisionT> amps(max_block);
+            size_t state = stateOf(begin);
+            for (size_t idx = begin; idx < end; idx++) {
+                const size_t local = gatherBits(state, wires);
+                const auto &block = blocks[std::popcount(local)];
+                if (local == block[0]) {
+                    const size_t base = state & ~wires_mask;
+                    const size_t size = block.size();
+                    for (size_t i = 0; i < size; i++) {
+                        indices[i] = i == 0 ? idx
+                                            : rankOf(base | scatter[block[i]]);
+                        amps[i] = data_[indices[i]];
+                    }
+                    for (size_t i = 0; i < size; i++) {
+                        ComplexPrecisionT sum{};
+                        for (size_t j = 0; j < size; j++) {
+                            sum += matrix[block[i] * dim + block[j]] * amps[j];
+                        }
+                        data_[indices[i]] = sum;
+                    }
+                }
+                if (idx + 1 < end) {
+                    state = nextState(state);
+                }
+            }
+        });
+    }
+
+  public:
+    /**
+     * @brief Construct the lowest basis state of a Hamming weight, i.e.
+     * with ones on the last wires.
+     *
+     * @param num_qubits Number of qubits.
+     * @param weight Number of ones of the basis states.
+     */
+    StateVectorFixedWeightCPU(size_t num_qubits, size_t weight)
+        : num_qubits_{num_qubits}, weight_{weight},
+          data_{getAllocator<ComplexPrecisionT>(bestCPUMemoryModel())} {
+        PL_ABORT_IF(num_qubits >= 64,
+                    "The number of qubits must be smaller than 64.");
+        PL_ABORT_IF(weight > num_qubits,
+                    "The weight must not exceed the number of qubits.");
+        binom_.assign((num_qubits_ + 1) * (weight_ + 1), 0);
+        for (size_t m = 0; m <= num_qubits_; m++) {
+            binom_[m * (weight_ + 1)] = 1;
+            for (size_t j = 1; j <= std::min(m, weight_); j++) {
+                binom_[m * (weight_ + 1) + j] =
+                    binom(m - 1, j - 1) + binom(m - 1, j);
+            }
+        }
+        data_.resize(binom(num_qubits_, weight_));
+        data_[0] = {1.0, 0.0};
+    }
+
+    /**
+     * @brief Get the number of qubits.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Get the Hamming weight of the basis states.
+     */
+    [[nodiscard]] auto getWeight() const -> size_t { return weight_; }
+
+    /**
+     * @brief Get the number of stored amplitudes, @f$\binom{n}{k}@f$.
+     */
+    [[nodiscard]] auto getLength() const -> size_t { return data_.size(); }
+
+    /**
+     * @brief Get the amplitudes of the subspace.
+     */
+    [[nodiscard]] auto getData() -> ComplexPrecisionT * { return data_.data(); }
+
+    [[nodiscard]] auto getData() const -> const ComplexPrecisionT * {
+        return data_.data();
+    }
+
+    /**
+     * @brief Get the index in the subspace of a basis state of the weight.
+     *
+     * @param state Index of the basis state in the full statevector, with
+     * as many ones as the weight.
+     */
+    [[nodiscard]] auto rankOf(size_t state) const -> size_t {
+        size_t rank = 0;
+        size_t j = 1;
+        for (size_t bits = state; bits != 0; bits &= bits - 1, j++) {
+            rank += binom(static_cast<size_t>(std::countr_zero(bits)), j);
+        }
+        return rank;
+    }
+
+    /**
+     * @brief Get the basis state at an index of the subspace.
+     *
+     * @param rank Index in the subspace.
+     * @return Index of the basis state in the full statevector.
+     */
+    [[nodiscard]] auto stateOf(size_t rank) const -> size_t {
+        size_t state = 0;
+        size_t pos = num_qubits_;
+        for (size_t j = weight_; j > 0; j--) {
+            do {
+                pos--;
+            } while (binom(pos, j) > rank);
+            state |= size_t{1U} << pos;
+            rank -= binom(pos, j);
+        }
+        return state;
+    }
+
+    /**
+     * @brief Prepare a computational basis state of the weight, e.g. the
+     * Hartree-Fock state.
+     *
+     * @param state Index of the basis state in the full statevector.
+     */
+    void setBasisState(size_t state) {
+        PL_ABORT_IF(state >= Util::exp2(num_qubits_) ||
+                        static_cast<size_t>(std::popcount(state)) != weight_,
+                    "The basis state must have the Hamming weight of the "
+                    "statevector.");
+        std::fill(data_.begin(), data_.end(), ComplexPrecisionT{});
+        data_[rankOf(state)] = {1.0, 0.0};
+    }
+
+    /**
+     * @brief Get the amplitude of a basis state, zero if its weight differs.
+     *
+     * @param state Index of the basis state in the full statevector.
+     */
+    [[nodiscard]] auto getAmplitude(size_t state) const -> ComplexPrecisionT {
+        PL_ABORT_IF(state >= Util::exp2(num_qubits_),
+                    "Invalid basis state index.");
+        if (static_cast<size_t>(std::popcount(state)) != weight_) {
+            return {};
+        }
+        return data_[rankOf(state)];
+    }
+
+    /**
+     * @brief Get the full statevector of length @f$2^n@f$.
+     */
+    [[nodiscard]] auto getDataVector() const -> std::vector<ComplexPrecisionT> {
+        std::vector<ComplexPrecisionT> full(Util::exp2(num_qubits_));
+        size_t state = stateOf(0);
+        for (size_t idx = 0; idx < getLength(); idx++) {
+            full[state] = data_[idx];
+            if (idx + 1 < getLength()) {
+                state = nextState(state);
+            }
+        }
+        return full;
+    }
+
+    /**
+     * @brief Apply a weight-conserving matrix to wires.
+     *
+     * @param matrix Matrix of size dim * dim in row-major order.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyMatrix(const std::vector<ComplexPrecisionT> &matrix,
+                     const std::vector<size_t> &wires, bool inverse = false) {
+        checkWires(wires);
+        const size_t dim = Util::exp2(wires.size());
+        PL_ABORT_IF(matrix.size() != dim * dim,
+                    "The size of matrix does not match with the given "
+                    "number of wires");
+        if (!inverse) {
+            applyBlockMatrix(matrix, wires);
+            return;
+        }
+        std::vector<ComplexPrecisionT> adjoint(dim * dim);
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                adjoint[row * dim + col] = std::conj(matrix[col * dim + row]);
+            }
+        }
+        applyBlockMatrix(adjoint, wires);
+    }
+
+    /**
+     * @brief Apply a single weight-conserving gate, e.g. an excitation gate
+     * or a diagonal gate.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        checkWires(wires);
+        const auto gate_op =
+            DynamicDispatcher<PrecisionT>::getInstance().strToGateOp(opName);
+        if (Util::array_has_elt(Gates::Constant::diagonal_gates, gate_op)) {
+            applyDiagonalMatrix(
+                gateMatrix(opName, wires.size(), inverse, params, true),
+                wires);
+            return;
+        }
+        applyBlockMatrix(
+            gateMatrix(opName, wires.size(), inverse, params, false), wires);
+    }
+
+    /**
+     * @brief Apply multiple weight-conserving gates.
+     *
+     * @param ops Vector of gate names to be applied in order.
+     * @param wires Vector of wires on which to apply index-matched gate name.
+     * @param inverse Indicates whether gate at matched index is to be
+     * inverted.
+     * @param params Optional parameter data for index matched gates.
+     */
+    void applyOperations(const std::vector<std::string> &ops,
+                         const std::vector<std::vector<size_t>> &wires,
+                         const std::vector<bool> &inverse,
+                         const std::vector<std::vector<PrecisionT>> &params) {
+        const size_t num_operations = ops.size();
+        PL_ABORT_IF(num_operations != wires.size() ||
+                        num_operations != inverse.size() ||
+                        num_operations != params.size(),
+                    "Invalid arguments: number of operations, wires, "
+                    "inverses, and parameters must all be equal");
+        for (size_t idx = 0; idx < num_operations; idx++) {
+            applyOperation(ops[idx], wires[idx], inverse[idx], params[idx]);
+        }
+    }
+
+    /**
+     * @brief Apply the generator of a weight-conserving gate.
+     *
+     * @param opName Name of the gate.
+     * @param wires Wires the gate applies to.
+     * @param adj Indicates whether to use adjoint of operator.
+     * @return Scaling factor of the generator.
+     */
+    [[nodiscard]] auto applyGenerator(const std::string &opName,
+                                      const std::vector<size_t> &wires,
+                                      bool adj = false) -> PrecisionT {
+        checkWires(wires);
+        const auto gate_op =
+            DynamicDispatcher<PrecisionT>::getInstance().strToGateOp(opName);
+        PrecisionT scale{1};
+        if (Util::array_has_elt(Gates::Constant::diagonal_gates, gate_op)) {
+            applyDiagonalMatrix(
+                gateMatrix(opName, wires.size(), adj, {}, true, &scale),
+                wires);
+        } else {
+            applyBlockMatrix(
+                gateMatrix(opName, wires.size(), adj, {}, false, &scale),
+                wires);
+        }
+        return scale;
+    }
+
+    /**
+     * @brief Compute @f$\langle \psi | \phi \rangle@f$, where @f$\psi@f$ is
+     * this statevector.
+     *
+     * @param other Statevector @f$\phi@f$ of the same weight.
+     */
+    [[nodiscard]] auto innerProd(const StateVectorFixedWeightCPU &other) const
+        -> ComplexPrecisionT {
+        PL_ABORT_IF(other.num_qubits_ != num_qubits_ ||
+                        other.weight_ != weight_,
+                    "The statevectors have different numbers of qubits or "
+                    "weights.");
+        return Util::innerProdC(data_.data(), other.data_.data(),
+                                getLength());
+    }
+
+    /**
+     * @brief Compute the expectation value of a Hamiltonian.
+     *
+     * Only the terms whose bit flips conserve the weight of a basis state
+     * contribute, e.g. XX + YY but not X alone.
+     *
+     * @param hamiltonian Hamiltonian given by Pauli words.
+     */
+    [[nodiscard]] auto expval(const PauliSum<PrecisionT> &hamiltonian) const
+        -> PrecisionT {
+        using AccT = Util::accumulator_t<PrecisionT>;
+        AccT result = 0.0;
+        for (const auto &group : hamiltonian.getGroups(num_qubits_)) {
+            const size_t x_mask = group.x_mask;
+            const auto &terms = group.terms;
+            const size_t length = getLength();
+            const size_t num_chunks = (length + chunk_size - 1) / chunk_size;
+            AccT sum = 0.0;
+            // clang-format off
+            #if defined(_OPENMP)
+                #pragma omp parallel for schedule(static) reduction(+:sum) \
+                    if (num_chunks > 1)
+            #endif
+            // clang-format on
+            for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+                const size_t begin = chunk * chunk_size;
+                const size_t end = std::min(begin + chunk_size, length);
+                size_t state = stateOf(begin);
+                for (size_t idx = begin; idx < end; idx++) {
+                    const size_t flipped = state ^ x_mask;
+                    if (static_cast<size_t>(std::popcount(flipped)) ==
+                        weight_) {
+                        ComplexPrecisionT factor{0.0, 0.0};
+                        for (const auto &[z_mask, coeff] : terms) {
+                            factor +=
+                                ((std::popcount(state & z_mask) & 1U) == 0)
+                                    ? coeff
+                                    : -coeff;
+                        }
+                        sum += std::real(std::conj(data_[rankOf(flipped)]) *
+                                         factor * data_[idx]);
+                    }
+                    if (idx + 1 < end) {
+                        state = nextState(state);
+                    }
+                }
+            }
+            result += sum;
+        }
+        return static_cast<PrecisionT>(result);
+    }
+
+    /**
+     * @brief Compute the projection of @f$H|\psi\rangle@f$ onto the
+     * subspace.
+     *
+     * This is @f$H|\psi\rangle@f$ itself for weight-conserving
+     * Hamiltonians, and gives the same inner products with the states of
+     * the subspace otherwise.
+     *
+     * @param hamiltonian Hamiltonian given by Pauli words.
+     * @param out Statevector of the same weight receiving the result.
+     */
+    void applyPauliSum(const PauliSum<PrecisionT> &hamiltonian,
+                       StateVectorFixedWeightCPU &out) const {
+        PL_ABORT_IF(out.num_qubits_ != num_qubits_ || out.weight_ != weight_,
+                    "The statevectors have different numbers of qubits or "
+                    "weights.");
+        std::fill(out.data_.begin(), out.data_.end(), ComplexPrecisionT{});
+        for (const auto &group : hamiltonian.getGroups(num_qubits_)) {
+            const size_t x_mask = group.x_mask;
+            const auto &terms = group.terms;
+            // Each output index is written by exactly one index for a given
+            // x_mask, so the chunks are free of data races.
+            forEachChunk([&](size_t begin, size_t end) {
+                size_t state = stateOf(begin);
+                for (size_t idx = begin; idx < end; idx++) {
+                    const size_t flipped = state ^ x_mask;
+                    if (static_cast<size_t>(std::popcount(flipped)) ==
+                        weight_) {
+                        ComplexPrecisionT factor{0.0, 0.0};
+                        for (const auto &[z_mask, coeff] : terms) {
+                            factor +=
+                                ((std::popcount(state & z_mask) & 1U) == 0)
+                                    ? coeff
+                                    : -coeff;
+                        }
+                        out.data_[rankOf(flipped)] += factor * data_[idx];
+                    }
+                    if (idx + 1 < end) {
+                        state = nextState(state);
+                    }
+                }
+            });
+        }
+    }
+};
+} // namespace Pennylane
@@ -0,0 +1,364 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file StateVectorIO.hpp
+ * Defines saving and loading statevectors in a binary format.
+ *
+ * A file starts with a StateVectorFileHeader. Uncompressed amplitudes follow
+ * the header directly. Compressed files store the compressed size of each
+ * chunk after the header, followed by the compressed chunks. Chunks are
+ * copied or (de)compressed in parallel through a mapping of the file.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#if __has_include(<zlib.h>) && defined _ENABLE_ZLIB
+#include <zlib.h>
+#define PL_HAS_ZLIB 1
+#endif
+
+#include "Error.hpp"
+#include "MappedMemory.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "Threading.hpp"
+
+namespace Pennylane {
+/**
+ * @brief Compression of a saved statevector.
+ */
+enum class StateVectorCompression : uint32_t {
+    None = 0, /**< Amplitudes are stored as is */
+    Zlib = 1, /**< Chunks are compressed with zlib. Requires ENABLE_ZLIB */
+};
+
+/**
+ * @brief Layout of the amplitudes of a saved statevector.
+ */
+enum class StateVectorLayout : uint32_t {
+    Interleaved = 0, /**< Real and imaginary parts of each amplitude are
+                        adjacent, as in std::complex */
+};
+
+/**
+ * @brief Header at the start of a saved statevector.
+ */
+struct StateVectorFileHeader {
+    static constexpr std::array<char, 8> expected_magic{'P', 'L', 'S', 'V',
+                                                        'B', 'I', 'N', '\0'};
+    static constexpr uint32_t current_version = 1;
+
+    std::array<char, 8> magic{expected_magic};
+    uint32_t version{current_version};
+    uint32_t num_qubits{0};
+    uint32_t precision_bytes{0}; /**< Size of a real number */
+    StateVectorLayout layout{StateVectorLayout::Interleaved};
+    StateVectorCompression compression{StateVectorCompression::None};
+    uint32_t reserved{0};
+    uint64_t chunk_bytes{0}; /**< Uncompressed size of a chunk */
+    uint64_t num_chunks{0};
+    std::array<uint64_t, 2> padding{}; /**< Pads the header to 64 bytes */
+};
+static_assert(sizeof(StateVectorFileHeader) == 64);
+
+/// @cond DEV
+namespace Internal {
+/**
+ * @brief Check whether zlib compression is available.
+ */
+constexpr auto zlibSupported() -> bool {
+#if defined(PL_HAS_ZLIB)
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Compress a chunk with zlib.
+ *
+ * @return Compressed data, or an empty vector on failure.
+ */
+inline auto compressChunk([[maybe_unused]] const std::byte *data,
+                          [[maybe_unused]] size_t bytes)
+    -> std::vector<std::byte> {
+#if defined(PL_HAS_ZLIB)
+    auto compressed_bytes = compressBound(static_cast<uLong>(bytes));
+    std::vector<std::byte> compressed(compressed_bytes);
+    if (compress2(reinterpret_cast<Bytef *>(compressed.data()),
+                  &compressed_bytes, reinterpret_cast<const Bytef *>(data),
+                  static_cast<uLong>(bytes), Z_BEST_SPEED) != Z_OK) {
+        return {};
+    }
+    compressed.resize(compressed_bytes);
+    return compressed;
+#else
+    return {};
+#endif
+}
+
+/**
+ * @brief Decompress a chunk with zlib.
+ *
+ * @return True if the chunk decompresses to exactly `bytes` bytes.
+ */
+inline auto decompressChunk([[maybe_unused]] const std::byte *compressed,
+                            [[maybe_unused]] size_t compressed_bytes,
+                            [[maybe_unused]] std::byte *data,
+                            [[maybe_unused]] size_t bytes) -> bool {
+#if defined(PL_HAS_ZLIB)
+    auto out_bytes = static_cast<uLong>(bytes);
+    return uncompress(reinterpret_cast<Bytef *>(data), &out_bytes,
+                      reinterpret_cast<const Bytef *>(compressed),
+                      static_cast<uLong>(compressed_bytes)) == Z_OK &&
+           out_bytes == bytes;
+#else
+    return false;
+#endif
+}
+} // namespace Internal
+/// @endcond
+
+/**
+ * @brief Default uncompressed size of a chunk of a saved statevector.
+ */
+constexpr size_t default_chunk_bytes = size_t{1} << 24U;
+
+/**
+ * @brief Save a statevector to a file.
+ *
+ * An existing file is replaced. Call canonicalizeWires() first if the
+ * statevector has pending operations or relabelled wires.
+ *
+ * @tparam SVType Statevector type.
+ * @param sv Statevector to save.
+ * @param path Path of the file.
+ * @param compression Compression of the amplitudes.
+ * @param chunk_bytes Uncompressed size of a chunk. Chunks are processed in
+ * parallel.
+ */
+template <class SVType>
+void saveStateVector(
+    const SVType &sv, const std::string &path,
+    StateVectorCompression compression = StateVectorCompression::None,
+    size_t chunk_bytes = default_chunk_bytes) {
+    using PrecisionT = typename SVType::PrecisionT;
+    PL_ABORT_IF(compression == StateVectorCompression::Zlib &&
+                    !Internal::zlibSupported(),
+                "Lightning is compiled without zlib support.");
+    PL_ABORT_IF(chunk_bytes == 0, "The chunk size must be positive.");
+
+    const auto *data = reinterpret_cast<const std::byte *>(sv.getData());
+    const size_t data_bytes =
+        sv.getLength() * sizeof(std::complex<PrecisionT>);
+    const size_t num_chunks = (data_bytes + chunk_bytes - 1) / chunk_bytes;
+    const auto chunk_size = [=](size_t chunk) {
+        return std::min(chunk_bytes, data_bytes - chunk * chunk_bytes);
+    };
+
+    StateVectorFileHeader header;
+    header.num_qubits = static_cast<uint32_t>(sv.getNumQubits());
+    header.precision_bytes = sizeof(PrecisionT);
+    header.compression = compression;
+    header.chunk_bytes = chunk_bytes;
+    header.num_chunks = num_chunks;
+
+    // Compressed chunks are kept in memory until their offsets are known
+    std::vector<std::vector<std::byte>> compressed;
+    std::vector<uint64_t> offsets(num_chunks + 1,
+                                  sizeof(StateVectorFileHeader));
+    if (compression == StateVectorCompression::Zlib) {
+        compressed.resize(num_chunks);
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(dynamic)
+        #endif
+        // clang-format on
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            compressed[chunk] = Internal::compressChunk(
+                data + chunk * chunk_bytes, chunk_size(chunk));
+        }
+        offsets[0] += num_chunks * sizeof(uint64_t);
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            PL_ABORT_IF(compressed[chunk].empty(),
+                        "Cannot compress the statevector.");
+            offsets[chunk + 1] = offsets[chunk] + compressed[chunk].size();
+        }
+    } else {
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            offsets[chunk + 1] = offsets[chunk] + chunk_size(chunk);
+        }
+    }
+
+    std::filesystem::remove(path);
+    const auto file = Util::MappedMemory::mapFile(
+        path, Util::MapAccess::ReadWrite, offsets[num_chunks]);
+    auto *out = static_cast<std::byte *>(file->data());
+    std::memcpy(out, &header, sizeof(header));
+    if (compression == StateVectorCompression::Zlib) {
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            const uint64_t size = compressed[chunk].size();
+            std::memcpy(out + sizeof(header) + chunk * sizeof(uint64_t),
+                        &size, sizeof(size));
+        }
+    }
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(dynamic)
+    #endif
+    // clang-format on
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+        if (compression == StateVectorCompression::Zlib) {
+            std::memcpy(out + offsets[chunk], compressed[chunk].data(),
+                        compressed[chunk].size());
+        } else {
+            std::memcpy(out + offsets[chunk], data + chunk * chunk_bytes,
+                        chunk_size(chunk));
+        }
+    }
+}
+
+/**
+ * @brief Read the header of a saved statevector.
+ *
+ * @param path Path of the file.
+ */
+inline auto readStateVectorHeader(const std::string &path)
+    -> StateVectorFileHeader {
+    const auto file =
+        Util::MappedMemory::mapFile(path, Util::MapAccess::ReadOnly);
+    StateVectorFileHeader header;
+    PL_ABORT_IF(file->size() < sizeof(header),
+                path + " is not a saved statevector.");
+    std::memcpy(&header, file->data(), sizeof(header));
+    PL_ABORT_IF(header.magic != StateVectorFileHeader::expected_magic,
+                path + " is not a saved statevector.");
+    PL_ABORT_IF(header.version != StateVectorFileHeader::current_version,
+                "Unsupported version of the statevector file format.");
+    return header;
+}
+
+/**
+ * @brief Load a saved statevector into a statevector of the same number of
+ * qubits and precision.
+ *
+ * @tparam SVType Statevector type.
+ * @param path Path of the file.
+ * @param sv Statevector receiving the amplitudes.
+ */
+template <class SVType>
+void loadStateVector(const std::string &path, SVType &sv) {
+    using PrecisionT = typename SVType::PrecisionT;
+    const StateVectorFileHeader header = readStateVectorHeader(path);
+    PL_ABORT_IF(header.precision_bytes != sizeof(PrecisionT),
+                "The saved statevector has a different precision.");
+    PL_ABORT_IF(header.num_qubits != sv.getNumQubits(),
+                "The saved statevector has a different number of qubits.");
+    PL_ABORT_IF(header.layout != StateVectorLayout::Interleaved,
+                "Unsupported layout of the saved statevector.");
+    PL_ABORT_IF(header.compression == StateVectorCompression::Zlib &&
+                    !Internal::zlibSupported(),
+                "Lightning is compiled without zlib support.");
+    PL_ABORT_IF(header.compression != StateVectorCompression::None &&
+                    header.compression != StateVectorCompression::Zlib,
+                "Unsupported compression of the saved statevector.");
+
+    const auto file =
+        Util::MappedMemory::mapFile(path, Util::MapAccess::ReadOnly);
+    const auto *in = static_cast<const std::byte *>(file->data());
+    auto *data = reinterpret_cast<std::byte *>(sv.getData());
+    const size_t data_bytes =
+        sv.getLength() * sizeof(std::complex<PrecisionT>);
+    const size_t chunk_bytes = header.chunk_bytes;
+    const size_t num_chunks = header.num_chunks;
+    PL_ABORT_IF(chunk_bytes == 0 ||
+                    num_chunks != (data_bytes + chunk_bytes - 1) / chunk_bytes,
+                "The saved statevector is corrupted.");
+    const auto chunk_size = [=](size_t chunk) {
+        return std::min(chunk_bytes, data_bytes - chunk * chunk_bytes);
+    };
+
+    std::vector<uint64_t> offsets(num_chunks + 1,
+                                  sizeof(StateVectorFileHeader));
+    if (header.compression == StateVectorCompression::Zlib) {
+        offsets[0] += num_chunks * sizeof(uint64_t);
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            uint64_t size = 0;
+            PL_ABORT_IF(sizeof(StateVectorFileHeader) +
+                                (chunk + 1) * sizeof(uint64_t) >
+                            file->size(),
+                        "The saved statevector is corrupted.");
+            std::memcpy(&size,
+                        in + sizeof(StateVectorFileHeader) +
+                            chunk * sizeof(uint64_t),
+                        sizeof(size));
+            offsets[chunk + 1] = offsets[chunk] + size;
+        }
+    } else {
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            offsets[chunk + 1] = offsets[chunk] + chunk_size(chunk);
+        }
+    }
+    PL_ABORT_IF(offsets[num_chunks] > file->size(),
+                "The saved statevector is corrupted.");
+
+    bool valid = true;
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(dynamic) reduction(&&:valid)
+    #endif
+    // clang-format on
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+        if (header.compression == StateVectorCompression::Zlib) {
+            const size_t compressed_bytes = offsets[chunk + 1] - offsets[chunk];
+            valid = Internal::decompressChunk(in + offsets[chunk],
+                                              compressed_bytes,
+                                              data + chunk * chunk_bytes,
+                                              chunk_size(chunk)) &&
+                    valid;
+        } else {
+            std::memcpy(data + chunk * chunk_bytes, in + offsets[chunk],
+                        chunk_size(chunk));
+        }
+    }
+    PL_ABORT_IF_NOT(valid, "The saved statevector is corrupted.");
+}
+
+/**
+ * @brief Load a saved statevector.
+ *
+ * @tparam PrecisionT Floating point precision of the saved statevector.
+ * @param path Path of the file.
+ * @param threading Threading option of the statevector.
+ * @return StateVectorManagedCPU<PrecisionT>
+ */
+template <class PrecisionT>
+auto loadStateVector(const std::string &path,
+                     Threading threading = Threading::SingleThread)
+    -> StateVectorManagedCPU<PrecisionT> {
+    const StateVectorFileHeader header = readStateVectorHeader(path);
+    StateVectorManagedCPU<PrecisionT> sv(header.num_qubits, threading);
+    loadStateVector(path, sv);
+    return sv;
+}
+} // namespace Pennylane
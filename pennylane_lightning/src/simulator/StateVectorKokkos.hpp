@@ -0,0 +1,916 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file StateVectorKokkos.hpp
+ * Defines a statevector held in a Kokkos view, so that gates and
+ * measurements run in the default Kokkos execution space (CUDA, HIP,
+ * OpenMP or Serial). Requires ENABLE_KOKKOS.
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "BitUtil.hpp"
+#include "Error.hpp"
+#include "Gates.hpp"
+#include "Kokkos_Sparse.hpp"
+#include "StateVectorManagedCPU.hpp"
+
+/// @cond DEV
+namespace Pennylane::Internal {
+/**
+ * @brief Maximum number of wires of a matrix applied on the device.
+ */
+constexpr size_t kokkos_max_matrix_wires = 5;
+
+/**
+ * @brief Apply a row-major matrix to the wires of a statevector.
+ *
+ * Each work item updates the @f$2^{k}@f$ amplitudes sharing the values of
+ * the other @f$n-k@f$ qubits.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> struct ApplyMatrixFunctor {
+    using complex_type = Kokkos::complex<PrecisionT>;
+
+    Kokkos::View<complex_type *> data;
+    Kokkos::View<const complex_type *> matrix;
+    /// Bit of the index of each wire, in the order of the wires
+    Kokkos::View<const size_t *> rev_wires;
+    /// Bits of the wires in increasing order
+    Kokkos::View<const size_t *> sorted_rev_wires;
+    size_t num_wires;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const size_t k) const {
+        size_t base = k;
+        for (size_t j = 0; j < num_wires; j++) {
+            const size_t bit = sorted_rev_wires(j);
+            const size_t low = base & ((size_t{1} << bit) - 1);
+            base = ((base >> bit) << (bit + 1)) | low;
+        }
+        const size_t dim = size_t{1} << num_wires;
+        size_t indices[size_t{1} << kokkos_max_matrix_wires];
+        complex_type v[size_t{1} << kokkos_max_matrix_wires];
+        for (size_t inner = 0; inner < dim; inner++) {
+            size_t idx = base;
+            for (size_t j = 0; j < num_wires; j++) {
+                if ((inner >> (num_wires - 1 - j)) & 1U) {
+                    idx |= size_t{1} << rev_wires(j);
+                }
+            }
+            indices[inner] = idx;
+            v[inner] = data(idx);
+        }
+        for (size_t row = 0; row < dim; row++) {
+            complex_type sum{0, 0};
+            for (size_t col = 0; col < dim; col++) {
+                sum += matrix(row * dim + col) * v[col];
+            }
+            data(indices[row]) = sum;
+        }
+    }
+};
+
+/**
+ * @brief Apply a row-major @f$2\times 2@f$ matrix to one wire.
+ *
+ * The matrix is held by value, so no view is needed for it.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> struct ApplyMatrix1QFunctor {
+    using complex_type = Kokkos::complex<PrecisionT>;
+
+    Kokkos::View<complex_type *> data;
+    complex_type matrix[4];
+    size_t rev_wire;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const size_t k) const {
+        const size_t low = k & ((size_t{1} << rev_wire) - 1);
+        const size_t i0 = ((k >> rev_wire) << (rev_wire + 1)) | low;
+        const size_t i1 = i0 | (size_t{1} << rev_wire);
+        const complex_type v0 = data(i0);
+        const complex_type v1 = data(i1);
+        data(i0) = matrix[0] * v0 + matrix[1] * v1;
+        data(i1) = matrix[2] * v0 + matrix[3] * v1;
+    }
+};
+
+/**
+ * @brief Apply a row-major @f$4\times 4@f$ matrix to two wires.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> struct ApplyMatrix2QFunctor {
+    using complex_type = Kokkos::complex<PrecisionT>;
+
+    Kokkos::View<complex_type *> data;
+    complex_type matrix[16];
+    /// Bit of the index of the first and second wire
+    size_t rev_wire0;
+    size_t rev_wire1;
+    /// Bits of the wires in increasing order
+    size_t rev_wire_min;
+    size_t rev_wire_max;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const size_t k) const {
+        const size_t low = k & ((size_t{1} << rev_wire_min) - 1);
+        size_t base = ((k >> rev_wire_min) << (rev_wire_min + 1)) | low;
+        const size_t mid = base & ((size_t{1} << rev_wire_max) - 1);
+        base = ((base >> rev_wire_max) << (rev_wire_max + 1)) | mid;
+        const size_t indices[4] = {
+            base, base | (size_t{1} << rev_wire1),
+            base | (size_t{1} << rev_wire0),
+            base | (size_t{1} << rev_wire0) | (size_t{1} << rev_wire1)};
+        complex_type v[4];
+        for (size_t i = 0; i < 4; i++) {
+            v[i] = data(indices[i]);
+        }
+        for (size_t row = 0; row < 4; row++) {
+            complex_type sum{0, 0};
+            for (size_t col = 0; col < 4; col++) {
+                sum += matrix[row * 4 + col] * v[col];
+            }
+            data(indices[row]) = sum;
+        }
+    }
+};
+
+/**
+ * @brief Multiply each amplitude by the diagonal entry of a diagonal
+ * matrix selected by the values of its wires.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> struct ApplyDiagonalFunctor {
+    using complex_type = Kokkos::complex<PrecisionT>;
+
+    Kokkos::View<complex_type *> data;
+    complex_type diagonal[size_t{1} << kokkos_max_matrix_wires];
+    /// Bit of the index of each wire, in the order of the wires
+    size_t rev_wires[kokkos_max_matrix_wires];
+    size_t num_wires;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const size_t i) const {
+        size_t entry = 0;
+        for (size_t j = 0; j < num_wires; j++) {
+            entry = (entry << 1U) | ((i >> rev_wires[j]) & 1U);
+        }
+        data(i) *= diagonal[entry];
+    }
+};
+
+/**
+ * @brief Compute the probabilities of the outcomes of some wires.
+ *
+ * Each team reduces the @f$2^{n-k}@f$ amplitudes of one outcome and writes
+ * its probability, so that no atomic update is needed.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> struct ProbsFunctor {
+    using member_type = Kokkos::TeamPolicy<>::member_type;
+
+    Kokkos::View<const Kokkos::complex<PrecisionT> *> data;
+    Kokkos::View<PrecisionT *> probs;
+    /// Bit of the index of each wire, in the order of the wires
+    Kokkos::View<const size_t *> rev_wires;
+    /// Bits of the wires in increasing order
+    Kokkos::View<const size_t *> sorted_rev_wires;
+    size_t num_wires;
+    /// Number of amplitudes of each outcome
+    size_t num_inner;
+
+    KOKKOS_INLINE_FUNCTION void operator()(const member_type &team) const {
+        const auto outcome = static_cast<size_t>(team.league_rank());
+        size_t offset = 0;
+        for (size_t j = 0; j < num_wires; j++) {
+            if ((outcome >> (num_wires - 1 - j)) & 1U) {
+                offset |= size_t{1} << rev_wires(j);
+            }
+        }
+        PrecisionT prob{0};
+        Kokkos::parallel_reduce(
+            Kokkos::TeamThreadRange(team, num_inner),
+            [&](const size_t k, PrecisionT &sum) {
+                size_t idx = k;
+                for (size_t j = 0; j < num_wires; j++) {
+                    const size_t bit = sorted_rev_wires(j);
+                    const size_t low = idx & ((size_t{1} << bit) - 1);
+                    idx = ((idx >> bit) << (bit + 1)) | low;
+                }
+                const auto amp = data(idx | offset);
+                sum += amp.real() * amp.real() + amp.imag() * amp.imag();
+            },
+            prob);
+        Kokkos::single(Kokkos::PerTeam(team),
+                       [&]() { probs(outcome) = prob; });
+    }
+};
+} // namespace Pennylane::Internal
+/// @endcond
+
+namespace Pennylane {
+/**
+ * @brief Statevector held in a Kokkos view of the default memory space.
+ *
+ * Gates are applied on the device as matrices. Common gates use their
+ * closed-form matrix from Gates.hpp. The matrix of any other gate, and of
+ * the generator of a parametric gate, is computed on the host by applying
+ * the CPU kernels to the basis states of its wires, so every gate of the
+ * dynamic dispatcher is supported without a device kernel per gate. The
+ * matrices are cached by gate and parameters. One- and two-qubit matrices
+ * and diagonal matrices are passed to their kernels by value; larger
+ * matrices are copied to scratch views held by the statevector. Measurements
+ * are reduced on the device and only the results are copied back.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data.
+ */
+template <class PrecisionT = double> class StateVectorKokkos {
+  public:
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    using KokkosComplex = Kokkos::complex<PrecisionT>;
+    using KokkosVector = Kokkos::View<KokkosComplex *>;
+
+  private:
+    /**
+     * @brief Matrix of a gate or generator, ready to be applied.
+     */
+    struct GateMatrix {
+        /// Row-major matrix, with the inverse already taken
+        std::vector<KokkosComplex> matrix;
+        /// Whether all off-diagonal entries are zero
+        bool diagonal{false};
+        /// Scaling factor of a generator
+        PrecisionT scale{1};
+    };
+
+    /**
+     * @brief Gate matrices by gate name, number of wires, inverse, generator
+     * and parameters. Shared by the copies of a statevector.
+     */
+    struct MatrixCache {
+        using key_type = std::tuple<std::string, size_t, bool, bool,
+                                    std::vector<PrecisionT>>;
+        /// Number of entries above which the cache is cleared
+        constexpr static size_t max_entries = 256;
+
+        std::mutex mutex;
+        std::map<key_type, GateMatrix> entries;
+    };
+
+    /**
+     * @brief Device views, and their host mirrors, holding a matrix of more
+     * than two wires and its wires.
+     */
+    struct Scratch {
+        Kokkos::View<KokkosComplex *> matrix;
+        Kokkos::View<size_t *> rev_wires;
+        Kokkos::View<size_t *> sorted_rev_wires;
+        typename Kokkos::View<KokkosComplex *>::HostMirror matrix_host;
+        typename Kokkos::View<size_t *>::HostMirror rev_wires_host;
+        typename Kokkos::View<size_t *>::HostMirror sorted_rev_wires_host;
+
+        Scratch()
+            : matrix{"matrix_scratch",
+                     Util::exp2(2 * Internal::kokkos_max_matrix_wires)},
+              rev_wires{"rev_wires_scratch",
+                        Internal::kokkos_max_matrix_wires},
+              sorted_rev_wires{"sorted_rev_wires_scratch",
+                               Internal::kokkos_max_matrix_wires},
+              matrix_host{Kokkos::create_mirror_view(matrix)},
+              rev_wires_host{Kokkos::create_mirror_view(rev_wires)},
+              sorted_rev_wires_host{
+                  Kokkos::create_mirror_view(sorted_rev_wires)} {}
+    };
+
+    size_t num_qubits_;
+    KokkosVector data_;
+    std::shared_ptr<MatrixCache> matrix_cache_;
+    /// Allocated on the first matrix of more than two wires
+    std::unique_ptr<Scratch> scratch_;
+
+    /**
+     * @brief Allocate the amplitudes, initializing Kokkos if needed.
+     */
+    static auto allocate(size_t length) -> KokkosVector {
+        Util::ensureKokkosInitialized();
+        return KokkosVector("statevector", length);
+    }
+
+    /**
+     * @brief Copy a host vector to a new device view.
+     */
+    template <class T>
+    static auto toDevice(const std::vector<T> &host, const std::string &label)
+        -> Kokkos::View<T *> {
+        Kokkos::View<T *> device(label, host.size());
+        auto mirror = Kokkos::create_mirror_view(device);
+        for (size_t i = 0; i < host.size(); i++) {
+            mirror(i) = host[i];
+        }
+        Kokkos::deep_copy(device, mirror);
+        return device;
+    }
+
+    /**
+     * @brief Get the bit of the amplitude index of each wire.
+     */
+    [[nodiscard]] auto revWires(const std::vector<size_t> &wires) const
+        -> std::vector<size_t> {
+        std::vector<size_t> rev_wires(wires.size());
+        for (size_t j = 0; j < wires.size(); j++) {
+            PL_ABORT_IF(wires[j] >= num_qubits_, "Invalid wire.");
+            rev_wires[j] = num_qubits_ - 1 - wires[j];
+        }
+        return rev_wires;
+    }
+
+    /**
+     * @brief Compute the matrix of a gate, or of its generator, over its
+     * wires with the CPU kernels.
+     *
+     * @param opName Name of the gate.
+     * @param num_wires Number of wires of the gate.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Parameters of the gate.
+     * @param generator Compute the generator instead of the gate.
+     * @param scale Set to the scaling factor of the generator.
+     */
+    static auto gateMatrix(const std::string &opName, size_t num_wires,
+                           bool inverse, const std::vector<PrecisionT> &params,
+                           bool generator, PrecisionT *scale = nullptr)
+        -> std::vector<ComplexPrecisionT> {
+        const size_t dim = Util::exp2(num_wires);
+        std::vector<size_t> wires(num_wires);
+        for (size_t j = 0; j < num_wires; j++) {
+            wires[j] = j;
+        }
+        std::vector<ComplexPrecisionT> matrix(dim * dim);
+        StateVectorManagedCPU<PrecisionT> column(num_wires);
+        ComplexPrecisionT *col_data = column.getData();
+        for (size_t col = 0; col < dim; col++) {
+            std::fill(col_data, col_data + dim, ComplexPrecisionT{0, 0});
+            col_data[col] = {1, 0};
+            if (generator) {
+                const PrecisionT s =
+                    column.applyGenerator(opName, wires, inverse);
+                if (scale != nullptr) {
+                    *scale = s;
+                }
+            } else {
+                column.applyOperation(opName, wires, inverse, params);
+            }
+            for (size_t row = 0; row < dim; row++) {
+                matrix[row * dim + col] = col_data[row];
+            }
+        }
+        return matrix;
+    }
+
+    /**
+     * @brief Get the closed-form matrix of a common gate.
+     *
+     * @return Row-major matrix, or an empty vector if the gate or its number
+     * of parameters is not known.
+     */
+    static auto namedMatrix(const std::string &opName,
+                            const std::vector<PrecisionT> &params)
+        -> std::vector<ComplexPrecisionT> {
+        using namespace Gates;
+        using T = PrecisionT;
+        if (params.empty()) {
+            if (opName == "PauliX") {
+                return getPauliX<T>();
+            }
+            if (opName == "PauliY") {
+                return getPauliY<T>();
+            }
+            if (opName == "PauliZ") {
+                return getPauliZ<T>();
+            }
+            if (opName == "Hadamard") {
+                return getHadamard<T>();
+            }
+            if (opName == "S") {
+                return getS<T>();
+            }
+            if (opName == "T") {
+                return getT<T>();
+            }
+            if (opName == "CNOT") {
+                return getCNOT<T>();
+            }
+            if (opName == "SWAP") {
+                return getSWAP<T>();
+            }
+            if (opName == "CZ") {
+                return getCZ<T>();
+            }
+            if (opName == "Toffoli") {
+                return getToffoli<T>();
+            }
+            if (opName == "CSWAP") {
+                return getCSWAP<T>();
+            }
+        } else if (params.size() == 1) {
+            const T angle = params[0];
+            if (opName == "PhaseShift") {
+                return getPhaseShift<T>(angle);
+            }
+            if (opName == "RX") {
+                return getRX<T>(angle);
+            }
+            if (opName == "RY") {
+                return getRY<T>(angle);
+            }
+            if (opName == "RZ") {
+                return getRZ<T>(angle);
+            }
+            if (opName == "ControlledPhaseShift") {
+                return getControlledPhaseShift<T>(angle);
+            }
+        } else if (params.size() == 3 && opName == "Rot") {
+            const auto rot = getRot<T>(params[0], params[1], params[2]);
+            return {rot.begin(), rot.end()};
+        }
+        return {};
+    }
+
+    /**
+     * @brief Convert a row-major matrix to be applied on the device.
+     *
+     * @param matrix Row-major matrix of size `2^num_wires`.
+     * @param num_wires Number of wires of the matrix.
+     * @param inverse Take the conjugate transpose of the matrix.
+     */
+    static auto deviceMatrix(const std::vector<ComplexPrecisionT> &matrix,
+                             size_t num_wires, bool inverse) -> GateMatrix {
+        const size_t dim = Util::exp2(num_wires);
+        GateMatrix result;
+        result.matrix.resize(matrix.size());
+        result.diagonal = true;
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                const auto value = inverse ? std::conj(matrix[col * dim + row])
+                                           : matrix[row * dim + col];
+                result.matrix[row * dim + col] = {value.real(), value.imag()};
+                if (row != col && value != ComplexPrecisionT{0, 0}) {
+                    result.diagonal = false;
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Get the matrix of a gate, or of its generator, from the cache,
+     * computing it on a miss.
+     */
+    auto cachedGateMatrix(const std::string &opName, size_t num_wires,
+                          bool inverse, const std::vector<PrecisionT> &params,
+                          bool generator) -> GateMatrix {
+        PL_ABORT_IF(num_wires > Internal::kokkos_max_matrix_wires,
+                    "Gates can act on at most 5 wires.");
+        typename MatrixCache::key_type key{opName, num_wires, inverse,
+                                           generator, params};
+        {
+            std::lock_guard<std::mutex> lock(matrix_cache_->mutex);
+            const auto iter = matrix_cache_->entries.find(key);
+            if (iter != matrix_cache_->entries.end()) {
+                return iter->second;
+            }
+        }
+        GateMatrix result;
+        const auto named =
+            generator ? std::vector<ComplexPrecisionT>{}
+                      : namedMatrix(opName, params);
+        if (named.size() == Util::exp2(2 * num_wires)) {
+            result = deviceMatrix(named, num_wires, inverse);
+        } else {
+            // The CPU kernels apply the inverse and check the gate
+            PrecisionT scale{1};
+            result = deviceMatrix(gateMatrix(opName, num_wires, inverse,
+                                             params, generator, &scale),
+                                  num_wires, false);
+            result.scale = scale;
+        }
+        std::lock_guard<std::mutex> lock(matrix_cache_->mutex);
+        if (matrix_cache_->entries.size() >= MatrixCache::max_entries) {
+            matrix_cache_->entries.clear();
+        }
+        matrix_cache_->entries.emplace(std::move(key), result);
+        return result;
+    }
+
+    /**
+     * @brief Apply a matrix converted by deviceMatrix() to the statevector.
+     */
+    void applyDeviceMatrix(const GateMatrix &gate,
+                           const std::vector<size_t> &wires) {
+        const size_t num_wires = wires.size();
+        const auto rev_wires = revWires(wires);
+        const size_t dim = Util::exp2(num_wires);
+
+        if (gate.diagonal) {
+            Internal::ApplyDiagonalFunctor<PrecisionT> functor{};
+            functor.data = data_;
+            functor.num_wires = num_wires;
+            for (size_t j = 0; j < num_wires; j++) {
+                functor.rev_wires[j] = rev_wires[j];
+            }
+            for (size_t i = 0; i < dim; i++) {
+                functor.diagonal[i] = gate.matrix[i * dim + i];
+            }
+            Kokkos::parallel_for("applyDiagonal",
+                                 Kokkos::RangePolicy<>(0, getLength()),
+                                 functor);
+            return;
+        }
+        if (num_wires == 1) {
+            Internal::ApplyMatrix1QFunctor<PrecisionT> functor{};
+            functor.data = data_;
+            functor.rev_wire = rev_wires[0];
+            for (size_t i = 0; i < 4; i++) {
+                functor.matrix[i] = gate.matrix[i];
+            }
+            Kokkos::parallel_for("applyMatrix1Q",
+                                 Kokkos::RangePolicy<>(0, getLength() / 2),
+                                 functor);
+            return;
+        }
+        if (num_wires == 2) {
+            Internal::ApplyMatrix2QFunctor<PrecisionT> functor{};
+            functor.data = data_;
+            functor.rev_wire0 = rev_wires[0];
+            functor.rev_wire1 = rev_wires[1];
+            functor.rev_wire_min = std::min(rev_wires[0], rev_wires[1]);
+            functor.rev_wire_max = std::max(rev_wires[0], rev_wires[1]);
+            for (size_t i = 0; i < 16; i++) {
+                functor.matrix[i] = gate.matrix[i];
+            }
+            Kokkos::parallel_for("applyMatrix2Q",
+                                 Kokkos::RangePolicy<>(0, getLength() / 4),
+                                 functor);
+            return;
+        }
+
+        auto sorted_rev_wires = rev_wires;
+        std::sort(sorted_rev_wires.begin(), sorted_rev_wires.end());
+        if (!scratch_) {
+            scratch_ = std::make_unique<Scratch>();
+        }
+        for (size_t i = 0; i < dim * dim; i++) {
+            scratch_->matrix_host(i) = gate.matrix[i];
+        }
+        for (size_t j = 0; j < num_wires; j++) {
+            scratch_->rev_wires_host(j) = rev_wires[j];
+            scratch_->sorted_rev_wires_host(j) = sorted_rev_wires[j];
+        }
+        const auto used = std::make_pair(size_t{0}, dim * dim);
+        Kokkos::deep_copy(Kokkos::subview(scratch_->matrix, used),
+                          Kokkos::subview(scratch_->matrix_host, used));
+        Kokkos::deep_copy(scratch_->rev_wires, scratch_->rev_wires_host);
+        Kokkos::deep_copy(scratch_->sorted_rev_wires,
+                          scratch_->sorted_rev_wires_host);
+
+        Internal::ApplyMatrixFunctor<PrecisionT> functor{
+            data_, scratch_->matrix, scratch_->rev_wires,
+            scratch_->sorted_rev_wires, num_wires};
+        Kokkos::parallel_for(
+            "applyMatrix",
+            Kokkos::RangePolicy<>(0, Util::exp2(num_qubits_ - num_wires)),
+            functor);
+    }
+
+  public:
+    /**
+     * @brief Create a statevector in the state @f$|0\cdots 0\rangle@f$.
+     *
+     * Kokkos is initialized on first use.
+     *
+     * @param num_qubits Number of qubits.
+     */
+    explicit StateVectorKokkos(size_t num_qubits)
+        : num_qubits_{num_qubits}, data_{allocate(Util::exp2(num_qubits))},
+          matrix_cache_{std::make_shared<MatrixCache>()} {
+        resetState();
+    }
+
+    /**
+     * @brief Copy a statevector into a new view.
+     *
+     * The copy shares the matrix cache but not the scratch views, so that
+     * copies can apply gates concurrently.
+     */
+    StateVectorKokkos(const StateVectorKokkos &other)
+        : num_qubits_{other.num_qubits_},
+          data_{"statevector", other.data_.extent(0)},
+          matrix_cache_{other.matrix_cache_} {
+        Kokkos::deep_copy(data_, other.data_);
+    }
+
+    StateVectorKokkos(StateVectorKokkos &&) noexcept = default;
+    StateVectorKokkos &operator=(StateVectorKokkos &&) noexcept = default;
+
+    auto operator=(const StateVectorKokkos &other) -> StateVectorKokkos & {
+        if (this != &other) {
+            num_qubits_ = other.num_qubits_;
+            data_ = KokkosVector("statevector", other.data_.extent(0));
+            matrix_cache_ = other.matrix_cache_;
+            Kokkos::deep_copy(data_, other.data_);
+        }
+        return *this;
+    }
+
+    ~StateVectorKokkos() = default;
+
+    /**
+     * @brief Reset the statevector to @f$|0\cdots 0\rangle@f$.
+     */
+    void resetState() {
+        Kokkos::deep_copy(data_, KokkosComplex{0, 0});
+        Kokkos::deep_copy(Kokkos::subview(data_, 0), KokkosComplex{1, 0});
+    }
+
+    /**
+     * @brief Get the number of qubits.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Get the number of amplitudes.
+     */
+    [[nodiscard]] auto getLength() const -> size_t {
+        return data_.extent(0);
+    }
+
+    /**
+     * @brief Get the number of gate matrices in the cache shared with the
+     * copies of this statevector.
+     */
+    [[nodiscard]] auto getNumCachedMatrices() const -> size_t {
+        std::lock_guard<std::mutex> lock(matrix_cache_->mutex);
+        return matrix_cache_->entries.size();
+    }
+
+    /**
+     * @brief Get the view holding the amplitudes.
+     */
+    [[nodiscard]] auto getView() const -> const KokkosVector & {
+        return data_;
+    }
+
+    /**
+     * @brief Copy amplitudes from the host.
+     *
+     * @param data Amplitudes.
+     * @param length Number of amplitudes, i.e. `2^getNumQubits()`.
+     */
+    void setStateVector(const ComplexPrecisionT *data, size_t length) {
+        PL_ABORT_IF(length != getLength(),
+                    "The length of the statevector does not match the "
+                    "number of qubits.");
+        auto mirror = Kokkos::create_mirror_view(data_);
+        for (size_t i = 0; i < length; i++) {
+            mirror(i) = KokkosComplex{data[i].real(), data[i].imag()};
+        }
+        Kokkos::deep_copy(data_, mirror);
+    }
+
+    /**
+     * @brief Copy the amplitudes to the host.
+     */
+    [[nodiscard]] auto getStateVector() const
+        -> std::vector<ComplexPrecisionT> {
+        auto mirror = Kokkos::create_mirror_view(data_);
+        Kokkos::deep_copy(mirror, data_);
+        std::vector<ComplexPrecisionT> state(getLength());
+        for (size_t i = 0; i < state.size(); i++) {
+            state[i] = {mirror(i).real(), mirror(i).imag()};
+        }
+        return state;
+    }
+
+    /**
+     * @brief Apply a matrix to the statevector.
+     *
+     * @param matrix Row-major matrix of size `2^wires.size()`.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyMatrix(const std::vector<ComplexPrecisionT> &matrix,
+                     const std::vector<size_t> &wires, bool inverse = false) {
+        const size_t num_wires = wires.size();
+        PL_ABORT_IF(matrix.size() != Util::exp2(2 * num_wires),
+                    "The size of matrix does not match with the given "
+                    "number of wires");
+        PL_ABORT_IF(num_wires > Internal::kokkos_max_matrix_wires,
+                    "Matrices can act on at most 5 wires.");
+        applyDeviceMatrix(deviceMatrix(matrix, num_wires, inverse), wires);
+    }
+
+    /**
+     * @brief Apply a single gate to the statevector.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        applyDeviceMatrix(
+            cachedGateMatrix(opName, wires.size(), inverse, params, false),
+            wires);
+    }
+
+    /**
+     * @brief Apply multiple gates to the statevector.
+     *
+     * @param ops Vector of gate names to be applied in order.
+     * @param ops_wires Vector of wires on which to apply index-matched gate
+     * name.
+     * @param ops_inverse Indicates whether gate at matched index is to be
+     * inverted.
+     * @param ops_params Parameter data for index matched gates.
+     */
+    void
+    applyOperations(const std::vector<std::string> &ops,
+                    const std::vector<std::vector<size_t>> &ops_wires,
+                    const std::vector<bool> &ops_inverse,
+                    const std::vector<std::vector<PrecisionT>> &ops_params) {
+        PL_ABORT_IF(ops.size() != ops_wires.size() ||
+                        ops.size() != ops_inverse.size() ||
+                        ops.size() != ops_params.size(),
+                    "Invalid arguments: number of operations, wires, "
+                    "inverses, and parameters must all be equal");
+        for (size_t i = 0; i < ops.size(); i++) {
+            applyOperation(ops[i], ops_wires[i], ops_inverse[i], ops_params[i]);
+        }
+    }
+
+    /**
+     * @brief Apply the generator of a gate to the statevector.
+     *
+     * @param opName Name of the gate.
+     * @param wires Wires the gate applies to.
+     * @param adj Indicates whether to use adjoint of operator.
+     * @return Scaling factor of the generator.
+     */
+    [[nodiscard]] auto applyGenerator(const std::string &opName,
+                                      const std::vector<size_t> &wires,
+                                      bool adj = false) -> PrecisionT {
+        const auto generator =
+            cachedGateMatrix(opName, wires.size(), adj, {}, true);
+        applyDeviceMatrix(generator, wires);
+        return generator.scale;
+    }
+
+    /**
+     * @brief Compute @f$\langle \psi | \phi \rangle@f$, where @f$\psi@f$ is
+     * this statevector.
+     *
+     * @param other Statevector @f$\phi@f$.
+     */
+    [[nodiscard]] auto innerProd(const StateVectorKokkos &other) const
+        -> ComplexPrecisionT {
+        PL_ABORT_IF(other.num_qubits_ != num_qubits_,
+                    "The statevectors have different numbers of qubits.");
+        const auto lhs = data_;
+        const auto rhs = other.data_;
+        KokkosComplex result{0, 0};
+        Kokkos::parallel_reduce(
+            "innerProd", Kokkos::RangePolicy<>(0, getLength()),
+            KOKKOS_LAMBDA(const size_t i, KokkosComplex &sum) {
+                sum += Kokkos::conj(lhs(i)) * rhs(i);
+            },
+            result);
+        return {result.real(), result.imag()};
+    }
+
+    /**
+     * @brief Compute the squared norm of the statevector.
+     */
+    [[nodiscard]] auto getNorm2() const -> PrecisionT {
+        const auto data = data_;
+        PrecisionT result{0};
+        Kokkos::parallel_reduce(
+            "getNorm2", Kokkos::RangePolicy<>(0, getLength()),
+            KOKKOS_LAMBDA(const size_t i, PrecisionT &sum) {
+                sum += data(i).real() * data(i).real() +
+                       data(i).imag() * data(i).imag();
+            },
+            result);
+        return result;
+    }
+
+    /**
+     * @brief Expected value of a gate observable.
+     *
+     * @param opName Name of the observable.
+     * @param wires Wires the observable acts on.
+     * @param params Parameters of the observable.
+     */
+    [[nodiscard]] auto expval(const std::string &opName,
+                              const std::vector<size_t> &wires,
+                              const std::vector<PrecisionT> &params = {}) const
+        -> PrecisionT {
+        StateVectorKokkos applied(*this);
+        applied.applyOperation(opName, wires, false, params);
+        return std::real(innerProd(applied));
+    }
+
+    /**
+     * @brief Expected value of a Hermitian matrix observable.
+     *
+     * @param matrix Row-major matrix of size `2^wires.size()`.
+     * @param wires Wires the observable acts on.
+     */
+    [[nodiscard]] auto expval(const std::vector<ComplexPrecisionT> &matrix,
+                              const std::vector<size_t> &wires) const
+        -> PrecisionT {
+        StateVectorKokkos applied(*this);
+        applied.applyMatrix(matrix, wires);
+        return std::real(innerProd(applied));
+    }
+
+    /**
+     * @brief Variance of a gate observable.
+     *
+     * @param opName Name of the observable.
+     * @param wires Wires the observable acts on.
+     * @param params Parameters of the observable.
+     */
+    [[nodiscard]] auto var(const std::string &opName,
+                           const std::vector<size_t> &wires,
+                           const std::vector<PrecisionT> &params = {}) const
+        -> PrecisionT {
+        StateVectorKokkos applied(*this);
+        applied.applyOperation(opName, wires, false, params);
+        const PrecisionT mean = std::real(innerProd(applied));
+        return applied.getNorm2() - mean * mean;
+    }
+
+    /**
+     * @brief Probabilities of the computational basis states of the given
+     * wires, with the first wire as the most significant bit.
+     *
+     * @param wires Wires to measure.
+     */
+    [[nodiscard]] auto probs(const std::vector<size_t> &wires) const
+        -> std::vector<PrecisionT> {
+        const size_t num_outcomes = Util::exp2(wires.size());
+        Kokkos::View<PrecisionT *> probs("probs", num_outcomes);
+        const auto rev_wires = revWires(wires);
+        auto sorted_rev_wires = rev_wires;
+        std::sort(sorted_rev_wires.begin(), sorted_rev_wires.end());
+        PL_ABORT_IF(std::adjacent_find(sorted_rev_wires.begin(),
+                                       sorted_rev_wires.end()) !=
+                        sorted_rev_wires.end(),
+                    "The wires must be distinct.");
+        Internal::ProbsFunctor<PrecisionT> functor{
+            data_,
+            probs,
+            toDevice(rev_wires, "rev_wires"),
+            toDevice(sorted_rev_wires, "sorted_rev_wires"),
+            wires.size(),
+            getLength() / num_outcomes};
+        Kokkos::parallel_for(
+            "probs",
+            Kokkos::TeamPolicy<>(static_cast<int>(num_outcomes), Kokkos::AUTO),
+            functor);
+        auto mirror = Kokkos::create_mirror_view(probs);
+        Kokkos::deep_copy(mirror, probs);
+        std::vector<PrecisionT> result(probs.extent(0));
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = mirror(i);
+        }
+        return result;
+    }
+};
+} // namespace Pennylane
@@ -0,0 +1,553 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file StateVectorMPI.hpp
+ * Defines a statevector distributed over MPI ranks. Requires ENABLE_MPI.
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include "BitUtil.hpp"
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "LinearAlgebra.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "Threading.hpp"
+
+namespace Pennylane {
+/**
+ * @brief Statevector distributed over the ranks of an MPI communicator.
+ *
+ * With @f$2^k@f$ ranks, the statevector of @f$n@f$ qubits is split into
+ * slices of @f$2^{n-k}@f$ amplitudes. Positions @f$0, \cdots, k-1@f$ of the
+ * qubit layout, i.e. the most significant bits of an amplitude index, select
+ * the rank, and the remaining positions index the slice held by the rank as
+ * a StateVectorManagedCPU.
+ *
+ * Gates acting only on local qubits run with the usual kernels on the slice.
+ * Before a gate acts on a global qubit, the qubit is swapped with a local
+ * qubit the gate does not act on. This exchanges half of the slice with one
+ * partner rank and changes the layout, which is tracked so that each wire
+ * keeps its meaning. Only getLocalState() and getLayout() expose the
+ * layout.
+ *
+ * All ranks must call the methods collectively with the same arguments.
+ *
+ * @tparam PrecisionT Floating point precision of underlying statevector data.
+ */
+template <class PrecisionT = double> class StateVectorMPI {
+  public:
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+
+    /**
+     * @brief Maximum number of amplitudes sent in a single message when
+     * swapping qubits.
+     */
+    static constexpr size_t exchange_chunk_size = size_t{1} << 20U;
+
+  private:
+    MPI_Comm comm_;
+    size_t rank_;
+    size_t num_ranks_;
+    size_t num_qubits_;
+    size_t num_global_qubits_;
+    StateVectorManagedCPU<PrecisionT> local_;
+    std::vector<size_t> pos_to_wire_; // Wire at each position of the layout
+    std::vector<size_t> wire_to_pos_;
+
+    static auto complexType() -> MPI_Datatype {
+        if constexpr (std::is_same_v<PrecisionT, float>) {
+            return MPI_C_FLOAT_COMPLEX;
+        } else {
+            return MPI_C_DOUBLE_COMPLEX;
+        }
+    }
+
+    static auto realType() -> MPI_Datatype {
+        if constexpr (std::is_same_v<PrecisionT, float>) {
+            return MPI_FLOAT;
+        } else {
+            return MPI_DOUBLE;
+        }
+    }
+
+    static auto commRank(MPI_Comm comm) -> size_t {
+        int rank = 0;
+        MPI_Comm_rank(comm, &rank);
+        return static_cast<size_t>(rank);
+    }
+
+    static auto commSize(MPI_Comm comm) -> size_t {
+        int size = 0;
+        MPI_Comm_size(comm, &size);
+        return static_cast<size_t>(size);
+    }
+
+    static auto numGlobalQubits(size_t num_ranks, size_t num_qubits)
+        -> size_t {
+        PL_ABORT_IF_NOT(Util::isPerfectPowerOf2(num_ranks),
+                        "The number of ranks must be a power of 2.");
+        const size_t num_global_qubits = Util::log2PerfectPower(num_ranks);
+        PL_ABORT_IF(num_global_qubits >= num_qubits,
+                    "There must be fewer global qubits than qubits.");
+        return num_global_qubits;
+    }
+
+    [[nodiscard]] auto getNumLocalQubitsImpl() const -> size_t {
+        return num_qubits_ - num_global_qubits_;
+    }
+
+    /**
+     * @brief Get the value of the bit at a position of the layout for an
+     * index of the local slice.
+     */
+    [[nodiscard]] auto bitAt(size_t pos, size_t local_idx) const -> size_t {
+        if (pos < num_global_qubits_) {
+            return (rank_ >> (num_global_qubits_ - 1 - pos)) & 1U;
+        }
+        return (local_idx >> (num_qubits_ - 1 - pos)) & 1U;
+    }
+
+    /**
+     * @brief Swap a global and a local position of the layout.
+     *
+     * Amplitudes whose bit at the local position differs from the bit of
+     * the rank at the global position are exchanged with the partner rank,
+     * which differs from this rank only in that bit.
+     */
+    void swapGlobalLocal(size_t global_pos, size_t local_pos) {
+        const size_t rank_bit = num_global_qubits_ - 1 - global_pos;
+        const size_t global_value = (rank_ >> rank_bit) & 1U;
+        const auto partner = static_cast<int>(rank_ ^ (size_t{1} << rank_bit));
+        const size_t local_bit = num_qubits_ - 1 - local_pos;
+        const size_t send_value = 1U - global_value;
+        const size_t low_mask = (size_t{1} << local_bit) - 1;
+        const auto index = [=](size_t j) {
+            return ((j >> local_bit) << (local_bit + 1)) |
+                   (send_value << local_bit) | (j & low_mask);
+        };
+
+        ComplexPrecisionT *data = local_.getData();
+        const size_t half = local_.getLength() / 2;
+        const size_t chunk = std::min(half, exchange_chunk_size);
+        std::vector<ComplexPrecisionT> send(chunk);
+        std::vector<ComplexPrecisionT> recv(chunk);
+        for (size_t begin = 0; begin < half; begin += chunk) {
+            const size_t count = std::min(chunk, half - begin);
+            for (size_t j = 0; j < count; j++) {
+                send[j] = data[index(begin + j)];
+            }
+            MPI_Sendrecv(send.data(), static_cast<int>(count), complexType(),
+                         partner, 0, recv.data(), static_cast<int>(count),
+                         complexType(), partner, 0, comm_, MPI_STATUS_IGNORE);
+            for (size_t j = 0; j < count; j++) {
+                data[index(begin + j)] = recv[j];
+            }
+        }
+        swapPositions(global_pos, local_pos);
+    }
+
+    /**
+     * @brief Swap two local positions of the layout with a SWAP gate.
+     */
+    void swapLocalLocal(size_t pos0, size_t pos1) {
+        local_.applyOperation("SWAP", {pos0 - num_global_qubits_,
+                                       pos1 - num_global_qubits_});
+        swapPositions(pos0, pos1);
+    }
+
+    void swapPositions(size_t pos0, size_t pos1) {
+        std::swap(pos_to_wire_[pos0], pos_to_wire_[pos1]);
+        wire_to_pos_[pos_to_wire_[pos0]] = pos0;
+        wire_to_pos_[pos_to_wire_[pos1]] = pos1;
+    }
+
+    /**
+     * @brief Move the given wires to local positions and get their wires on
+     * the local slice.
+     *
+     * Global wires are swapped with the least significant local positions
+     * not used by the given wires.
+     */
+    auto localizeWires(const std::vector<size_t> &wires)
+        -> std::vector<size_t> {
+        PL_ABORT_IF(wires.size() > getNumLocalQubitsImpl(),
+                    "The operation acts on more wires than there are local "
+                    "qubits.");
+        std::vector<bool> used(num_qubits_, false);
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire.");
+            used[wire_to_pos_[wire]] = true;
+        }
+        size_t candidate = num_qubits_;
+        std::vector<size_t> local_wires;
+        local_wires.reserve(wires.size());
+        for (const size_t wire : wires) {
+            if (wire_to_pos_[wire] < num_global_qubits_) {
+                do {
+                    candidate--;
+                } while (used[candidate]);
+                used[candidate] = true;
+                swapGlobalLocal(wire_to_pos_[wire], candidate);
+            }
+            local_wires.push_back(wire_to_pos_[wire] - num_global_qubits_);
+        }
+        return local_wires;
+    }
+
+  public:
+    /**
+     * @brief Create a distributed statevector in the state
+     * @f$|0\cdots 0\rangle@f$.
+     *
+     * @param num_qubits Number of qubits.
+     * @param comm Communicator of the ranks holding the statevector. Its
+     * size must be a power of 2 smaller than `2^num_qubits`.
+     * @param threading Threading option of the local slices.
+     */
+    explicit StateVectorMPI(size_t num_qubits, MPI_Comm comm = MPI_COMM_WORLD,
+                            Threading threading = Threading::SingleThread)
+        : comm_{comm}, rank_{commRank(comm)}, num_ranks_{commSize(comm)},
+          num_qubits_{num_qubits},
+          num_global_qubits_{numGlobalQubits(num_ranks_, num_qubits)},
+          local_{num_qubits - num_global_qubits_, threading},
+          pos_to_wire_(num_qubits), wire_to_pos_(num_qubits) {
+        resetState();
+    }
+
+    /**
+     * @brief Reset the statevector to @f$|0\cdots 0\rangle@f$ and the layout
+     * to the identity.
+     */
+    void resetState() {
+        ComplexPrecisionT *data = local_.getData();
+        std::fill(data, data + local_.getLength(), ComplexPrecisionT{0, 0});
+        if (rank_ == 0) {
+            data[0] = {1, 0};
+        }
+        std::iota(pos_to_wire_.begin(), pos_to_wire_.end(), size_t{0});
+        std::iota(wire_to_pos_.begin(), wire_to_pos_.end(), size_t{0});
+    }
+
+    /**
+     * @brief Set the amplitudes from the full statevector, which every rank
+     * must provide.
+     *
+     * @param data Amplitudes of the full statevector.
+     * @param length Number of amplitudes, i.e. `2^getNumQubits()`.
+     */
+    void setFullState(const ComplexPrecisionT *data, size_t length) {
+        PL_ABORT_IF(length != Util::exp2(num_qubits_),
+                    "The length of the statevector does not match the "
+                    "number of qubits.");
+        const size_t local_length = local_.getLength();
+        const ComplexPrecisionT *begin = data + rank_ * local_length;
+        std::copy(begin, begin + local_length, local_.getData());
+        std::iota(pos_to_wire_.begin(), pos_to_wire_.end(), size_t{0});
+        std::iota(wire_to_pos_.begin(), wire_to_pos_.end(), size_t{0});
+    }
+
+    /**
+     * @brief Gather the full statevector on every rank.
+     *
+     * Intended for testing and small statevectors, as each rank allocates
+     * the full statevector.
+     */
+    [[nodiscard]] auto getFullState() const -> std::vector<ComplexPrecisionT> {
+        const size_t length = Util::exp2(num_qubits_);
+        const size_t local_length = local_.getLength();
+        std::vector<ComplexPrecisionT> physical(length);
+        MPI_Allgather(local_.getData(), static_cast<int>(local_length),
+                      complexType(), physical.data(),
+                      static_cast<int>(local_length), complexType(), comm_);
+
+        std::vector<ComplexPrecisionT> state(length);
+        for (size_t idx = 0; idx < length; idx++) {
+            size_t logical = 0;
+            for (size_t pos = 0; pos < num_qubits_; pos++) {
+                const size_t bit = (idx >> (num_qubits_ - 1 - pos)) & 1U;
+                logical |= bit << (num_qubits_ - 1 - pos_to_wire_[pos]);
+            }
+            state[logical] = physical[idx];
+        }
+        return state;
+    }
+
+    /**
+     * @brief Get the total number of qubits.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Get the number of qubits selecting the rank.
+     */
+    [[nodiscard]] auto getNumGlobalQubits() const -> size_t {
+        return num_global_qubits_;
+    }
+
+    /**
+     * @brief Get the number of qubits of the local slice.
+     */
+    [[nodiscard]] auto getNumLocalQubits() const -> size_t {
+        return getNumLocalQubitsImpl();
+    }
+
+    /**
+     * @brief Get the rank of this process.
+     */
+    [[nodiscard]] auto getRank() const -> size_t { return rank_; }
+
+    /**
+     * @brief Get the number of ranks.
+     */
+    [[nodiscard]] auto getNumRanks() const -> size_t { return num_ranks_; }
+
+    /**
+     * @brief Get the communicator.
+     */
+    [[nodiscard]] auto getComm() const -> MPI_Comm { return comm_; }
+
+    /**
+     * @brief Get the wire at each position of the current layout.
+     */
+    [[nodiscard]] auto getLayout() const -> const std::vector<size_t> & {
+        return pos_to_wire_;
+    }
+
+    /**
+     * @brief Get the slice held by this rank in the current layout.
+     */
+    [[nodiscard]] auto getLocalState() const
+        -> const StateVectorManagedCPU<PrecisionT> & {
+        return local_;
+    }
+
+    /**
+     * @brief Apply a single gate to the statevector.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        const auto local_wires = localizeWires(wires);
+        local_.applyOperation(opName, local_wires, inverse, params);
+    }
+
+    /**
+     * @brief Apply multiple gates to the statevector.
+     *
+     * @param ops Vector of gate names to be applied in order.
+     * @param ops_wires Vector of wires on which to apply index-matched gate
+     * name.
+     * @param ops_inverse Indicates whether gate at matched index is to be
+     * inverted.
+     * @param ops_params Parameter data for index matched gates.
+     */
+    void
+    applyOperations(const std::vector<std::string> &ops,
+                    const std::vector<std::vector<size_t>> &ops_wires,
+                    const std::vector<bool> &ops_inverse,
+                    const std::vector<std::vector<PrecisionT>> &ops_params) {
+        PL_ABORT_IF(ops.size() != ops_wires.size() ||
+                        ops.size() != ops_inverse.size() ||
+                        ops.size() != ops_params.size(),
+                    "Invalid arguments: number of operations, wires, "
+                    "inverses, and parameters must all be equal");
+        for (size_t i = 0; i < ops.size(); i++) {
+            applyOperation(ops[i], ops_wires[i], ops_inverse[i], ops_params[i]);
+        }
+    }
+
+    /**
+     * @brief Apply a matrix to the statevector.
+     *
+     * @param matrix Row-major matrix of size `2^wires.size()`.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyMatrix(const std::vector<ComplexPrecisionT> &matrix,
+                     const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ABORT_IF(matrix.size() != Util::exp2(2 * wires.size()),
+                    "The size of matrix does not match with the given "
+                    "number of wires");
+        const auto local_wires = localizeWires(wires);
+        local_.applyMatrix(matrix.data(), local_wires, inverse);
+    }
+
+    /**
+     * @brief Apply the generator of a gate to the statevector.
+     *
+     * @param opName Name of the gate.
+     * @param wires Wires the gate applies to.
+     * @param adj Indicates whether to use adjoint of operator.
+     * @return Scaling factor of the generator.
+     */
+    [[nodiscard]] auto applyGenerator(const std::string &opName,
+                                      const std::vector<size_t> &wires,
+                                      bool adj = false) -> PrecisionT {
+        const auto local_wires = localizeWires(wires);
+        return local_.applyGenerator(opName, local_wires, adj);
+    }
+
+    /**
+     * @brief Change the layout to the given one.
+     *
+     * @param layout Wire at each position.
+     */
+    void setLayout(const std::vector<size_t> &layout) {
+        PL_ABORT_IF(layout.size() != num_qubits_, "Invalid layout.");
+        for (size_t pos = 0; pos < num_global_qubits_; pos++) {
+            const size_t current = wire_to_pos_[layout[pos]];
+            if (current == pos) {
+                continue;
+            }
+            if (current < num_global_qubits_) {
+                // Move the wire through a local position
+                swapGlobalLocal(current, num_qubits_ - 1);
+                swapGlobalLocal(pos, num_qubits_ - 1);
+            } else {
+                swapGlobalLocal(pos, current);
+            }
+        }
+        for (size_t pos = num_global_qubits_; pos < num_qubits_; pos++) {
+            const size_t current = wire_to_pos_[layout[pos]];
+            if (current != pos) {
+                swapLocalLocal(pos, current);
+            }
+        }
+    }
+
+    /**
+     * @brief Compute @f$\langle \psi | \phi \rangle@f$ with a reduction over
+     * all ranks, where @f$\psi@f$ is this statevector.
+     *
+     * @param other Statevector @f$\phi@f$. Its layout is changed to the one
+     * of this statevector if they differ.
+     */
+    [[nodiscard]] auto innerProd(StateVectorMPI &other) const
+        -> ComplexPrecisionT {
+        PL_ABORT_IF(other.num_qubits_ != num_qubits_,
+                    "The statevectors have different numbers of qubits.");
+        if (other.pos_to_wire_ != pos_to_wire_) {
+            other.setLayout(pos_to_wire_);
+        }
+        const ComplexPrecisionT local = Util::innerProdC(
+            local_.getDataVector(), other.local_.getDataVector());
+        ComplexPrecisionT result{0, 0};
+        MPI_Allreduce(&local, &result, 1, complexType(), MPI_SUM, comm_);
+        return result;
+    }
+
+    /**
+     * @brief Compute the squared norm of the statevector.
+     */
+    [[nodiscard]] auto getNorm2() const -> PrecisionT {
+        const PrecisionT local = std::real(Util::innerProdC(
+            local_.getDataVector(), local_.getDataVector()));
+        PrecisionT result{0};
+        MPI_Allreduce(&local, &result, 1, realType(), MPI_SUM, comm_);
+        return result;
+    }
+
+    /**
+     * @brief Expected value of a gate observable.
+     *
+     * @param opName Name of the observable.
+     * @param wires Wires the observable acts on.
+     * @param params Parameters of the observable.
+     */
+    [[nodiscard]] auto expval(const std::string &opName,
+                              const std::vector<size_t> &wires,
+                              const std::vector<PrecisionT> &params = {}) const
+        -> PrecisionT {
+        StateVectorMPI applied(*this);
+        applied.applyOperation(opName, wires, false, params);
+        return std::real(innerProd(applied));
+    }
+
+    /**
+     * @brief Expected value of a Hermitian matrix observable.
+     *
+     * @param matrix Row-major matrix of size `2^wires.size()`.
+     * @param wires Wires the observable acts on.
+     */
+    [[nodiscard]] auto expval(const std::vector<ComplexPrecisionT> &matrix,
+                              const std::vector<size_t> &wires) const
+        -> PrecisionT {
+        StateVectorMPI applied(*this);
+        applied.applyMatrix(matrix, wires);
+        return std::real(innerProd(applied));
+    }
+
+    /**
+     * @brief Variance of a gate observable.
+     *
+     * @param opName Name of the observable.
+     * @param wires Wires the observable acts on.
+     * @param params Parameters of the observable.
+     */
+    [[nodiscard]] auto var(const std::string &opName,
+                           const std::vector<size_t> &wires,
+                           const std::vector<PrecisionT> &params = {}) const
+        -> PrecisionT {
+        StateVectorMPI applied(*this);
+        applied.applyOperation(opName, wires, false, params);
+        const PrecisionT mean = std::real(innerProd(applied));
+        return applied.getNorm2() - mean * mean;
+    }
+
+    /**
+     * @brief Probabilities of the computational basis states of the given
+     * wires, with the first wire as the most significant bit.
+     *
+     * @param wires Wires to measure.
+     */
+    [[nodiscard]] auto probs(const std::vector<size_t> &wires) const
+        -> std::vector<PrecisionT> {
+        const size_t num_wires = wires.size();
+        std::vector<size_t> positions(num_wires);
+        for (size_t idx = 0; idx < num_wires; idx++) {
+            PL_ABORT_IF(wires[idx] >= num_qubits_, "Invalid wire.");
+            positions[idx] = wire_to_pos_[wires[idx]];
+        }
+        std::vector<PrecisionT> local(Util::exp2(num_wires), 0);
+        const ComplexPrecisionT *data = local_.getData();
+        for (size_t i = 0; i < local_.getLength(); i++) {
+            size_t outcome = 0;
+            for (size_t idx = 0; idx < num_wires; idx++) {
+                outcome = (outcome << 1U) | bitAt(positions[idx], i);
+            }
+            local[outcome] += std::norm(data[i]);
+        }
+        std::vector<PrecisionT> result(local.size());
+        MPI_Allreduce(local.data(), result.data(),
+                      static_cast<int>(local.size()), realType(), MPI_SUM,
+                      comm_);
+        return result;
+    }
+};
+} // namespace Pennylane
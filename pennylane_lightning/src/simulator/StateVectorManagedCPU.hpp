@@ -47,30 +47,60 @@ class StateVectorManagedCPU
      * @param num_qubits Number of qubits
      * @param threading Threading option the statevector to use
      * @param memory_model Memory model the statevector will use
+     * @param numa_policy Placement of the data on NUMA nodes
+     * @param huge_pages Backing of the data with huge pages
+     * @param pool Pool the data is returned to on destruction, or nullptr
      */
-    explicit StateVectorManagedCPU(
-        size_t num_qubits, Threading threading = Threading::SingleThread,
-        CPUMemoryModel memory_model = bestCPUMemoryModel())
+    StateVectorManagedCPU(
+        size_t num_qubits, Threading threading, CPUMemoryModel memory_model,
+        Util::NUMAPolicy numa_policy,
+        Util::HugePagePolicy huge_pages = Util::HugePagePolicy::Disabled,
+        Util::BufferPool *pool = nullptr)
         : BaseType{num_qubits, threading, memory_model},
-          data_{Util::exp2(num_qubits), ComplexPrecisionT{0.0, 0.0},
-                getAllocator<ComplexPrecisionT>(this->memory_model_)} {
+          data_(Util::exp2(num_qubits),
+                getAllocator<ComplexPrecisionT>(this->memory_model_,
+                                                numa_policy, huge_pages,
+                                                pool)) {
+        // The elements are zero-initialized by the allocator, in parallel
+        // for a NUMA policy other than the default
         data_[0] = {1, 0};
     }
 
+    /**
+     * @brief Create a new statevector. Multi-threaded statevectors are
+     * first touched in parallel.
+     *
+     * @param num_qubits Number of qubits
+     * @param threading Threading option the statevector to use
+     * @param memory_model Memory model the statevector will use
+     */
+    explicit StateVectorManagedCPU(
+        size_t num_qubits, Threading threading = Threading::SingleThread,
+        CPUMemoryModel memory_model = bestCPUMemoryModel())
+        : StateVectorManagedCPU(num_qubits, threading, memory_model,
+                                bestNUMAPolicy(threading)) {}
+
     /**
      * @brief Construct a statevector from another statevector
      *
      * @tparam OtherDerived A derived type of StateVectorCPU to use for
      * construction.
-     * @param other Another statevector to construct the statevector from
+     * @param other Another statevector to construct the statevector from,
+     * with canonical wires (see StateVectorBase::isCanonical())
+     * @param pool Pool the data is returned to on destruction, or nullptr
      */
     template <class OtherDerived>
     explicit StateVectorManagedCPU(
-        const StateVectorCPU<PrecisionT, OtherDerived> &other)
+        const StateVectorCPU<PrecisionT, OtherDerived> &other,
+        Util::BufferPool *pool = nullptr)
         : BaseType(other.getNumQubits(), other.threading(),
                    other.memoryModel()),
           data_{other.getData(), other.getData() + other.getLength(),
-                getAllocator<ComplexPrecisionT>(this->memory_model_)} {}
+                getAllocator<ComplexPrecisionT>(
+                    this->memory_model_, bestNUMAPolicy(other.threading()),
+                    Util::HugePagePolicy::Disabled, pool)} {
+        this->setThreadingConfig(other.getThreadingConfig());
+    }
 
     /**
      * @brief Construct a statevector from data pointer
@@ -84,9 +114,30 @@ class StateVectorManagedCPU
                           size_t other_size,
                           Threading threading = Threading::SingleThread,
                           CPUMemoryModel memory_model = bestCPUMemoryModel())
+        : StateVectorManagedCPU(other_data, other_size, threading,
+                                memory_model, bestNUMAPolicy(threading)) {}
+
+    /**
+     * @brief Construct a statevector from data pointer
+     *
+     * @param other_data Data pointer to construct the statvector from.
+     * @param other_size Size of the data
+     * @param threading Threading option the statevector to use
+     * @param memory_model Memory model the statevector will use
+     * @param numa_policy Placement of the data on NUMA nodes
+     * @param huge_pages Backing of the data with huge pages
+     * @param pool Pool the data is returned to on destruction, or nullptr
+     */
+    StateVectorManagedCPU(
+        const ComplexPrecisionT *other_data, size_t other_size,
+        Threading threading, CPUMemoryModel memory_model,
+        Util::NUMAPolicy numa_policy,
+        Util::HugePagePolicy huge_pages = Util::HugePagePolicy::Disabled,
+        Util::BufferPool *pool = nullptr)
         : BaseType(Util::log2PerfectPower(other_size), threading, memory_model),
           data_{other_data, other_data + other_size,
-                getAllocator<ComplexPrecisionT>(this->memory_model_)} {
+                getAllocator<ComplexPrecisionT>(
+                    this->memory_model_, numa_policy, huge_pages, pool)} {
         PL_ABORT_IF_NOT(Util::isPerfectPowerOf2(other_size),
                         "The size of provided data must be a power of 2.");
     }
@@ -117,24 +168,50 @@ class StateVectorManagedCPU
 
     ~StateVectorManagedCPU() = default;
 
-    [[nodiscard]] auto getData() -> ComplexPrecisionT * { return data_.data(); }
+    [[nodiscard]] auto getData() -> ComplexPrecisionT * {
+        this->flushOperations();
+        this->markModified();
+        return data_.data();
+    }
 
     [[nodiscard]] auto getData() const -> const ComplexPrecisionT * {
+        this->checkCanonical();
+        return data_.data();
+    }
+
+    [[nodiscard]] auto getPhysicalData() const -> const ComplexPrecisionT * {
         return data_.data();
     }
 
+    /**
+     * @brief Get the placement of the data on NUMA nodes
+     */
+    [[nodiscard]] auto numaPolicy() const -> Util::NUMAPolicy {
+        return data_.get_allocator().numaPolicy();
+    }
+
+    /**
+     * @brief Get the backing of the data with huge pages
+     */
+    [[nodiscard]] auto hugePages() const -> Util::HugePagePolicy {
+        return data_.get_allocator().hugePages();
+    }
+
     /**
      * @brief Get underlying data vector
      */
     [[nodiscard]] auto getDataVector()
         -> std::vector<ComplexPrecisionT,
                        Util::AlignedAllocator<ComplexPrecisionT>> & {
+        this->flushOperations();
+        this->markModified();
         return data_;
     }
 
     [[nodiscard]] auto getDataVector() const
         -> const std::vector<ComplexPrecisionT,
                              Util::AlignedAllocator<ComplexPrecisionT>> & {
+        this->checkCanonical();
         return data_;
     }
 
@@ -147,6 +224,8 @@ class StateVectorManagedCPU
     template <class Alloc>
     void updateData(const std::vector<ComplexPrecisionT, Alloc> &new_data) {
         assert(data_.size() == new_data.size());
+        this->markModified();
+        this->discardWireMap();
         std::copy(new_data.data(), new_data.data() + new_data.size(),
                   data_.data());
     }
@@ -0,0 +1,155 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a statevector stored in a memory-mapped file.
+ */
+#pragma once
+
+#include "BitUtil.hpp"
+#include "Error.hpp"
+#include "MappedMemory.hpp"
+#include "StateVectorChunkedBase.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace Pennylane {
+/**
+ * @brief Statevector whose amplitudes are stored in a memory-mapped file,
+ * for qubit counts whose statevector does not fit in RAM but fits on a
+ * local disk.
+ *
+ * The chunks are laid out and updated as described for
+ * StateVectorChunkedBase, and stored one after the other in the file. As
+ * consecutive gates on chunk qubits are applied in a single pass, each
+ * chunk is read and written once per group of gates. While a thread
+ * processes a chunk, the pages of the chunk it processes next are read
+ * ahead by the kernel, and the operating system writes changed pages back
+ * and evicts them as memory is needed. Only the scratch buffers of the
+ * threads, at most two chunks each, are held in RAM.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT = double>
+class StateVectorOutOfCoreCPU
+    : public StateVectorChunkedBase<PrecisionT,
+                                    StateVectorOutOfCoreCPU<PrecisionT>> {
+  public:
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+
+  private:
+    using BaseType =
+        StateVectorChunkedBase<PrecisionT,
+                               StateVectorOutOfCoreCPU<PrecisionT>>;
+    friend BaseType;
+
+    std::string path_;
+    std::shared_ptr<Util::MappedMemory> mapping_;
+
+    [[nodiscard]] auto chunkBytes() const -> size_t {
+        return this->chunkLength() * sizeof(ComplexPrecisionT);
+    }
+
+    [[nodiscard]] auto chunkData(size_t chunk) const -> ComplexPrecisionT * {
+        return static_cast<ComplexPrecisionT *>(mapping_->data()) +
+               chunk * this->chunkLength();
+    }
+
+    void loadChunk(size_t chunk, ComplexPrecisionT *data) const {
+        std::memcpy(data, chunkData(chunk), chunkBytes());
+    }
+
+    void storeChunk(size_t chunk, const ComplexPrecisionT *data) {
+        std::memcpy(chunkData(chunk), data, chunkBytes());
+    }
+
+    [[nodiscard]] static auto isZeroChunk([[maybe_unused]] size_t chunk)
+        -> bool {
+        return false;
+    }
+
+    void prefetchChunk(size_t chunk) const {
+        mapping_->prefetch(chunk * chunkBytes(), chunkBytes());
+    }
+
+    static auto fileBytes(size_t num_qubits) -> size_t {
+        PL_ABORT_IF(num_qubits >= std::numeric_limits<size_t>::digits -
+                                      Util::log2PerfectPower(
+                                          sizeof(ComplexPrecisionT)),
+                    "The statevector is too large to be mapped.");
+        return Util::exp2(num_qubits) * sizeof(ComplexPrecisionT);
+    }
+
+  public:
+    /**
+     * @brief Create a statevector in the state @f$|0\cdots 0\rangle@f$,
+     * stored in the given file.
+     *
+     * The file is created, or extended if smaller than the statevector, and
+     * is left in place on destruction.
+     *
+     * @param num_qubits Number of qubits.
+     * @param num_chunk_qubits Number of qubits of each chunk. Each thread
+     * holds up to two chunks in RAM at once.
+     * @param path Path of the file, preferably on a local SSD.
+     */
+    StateVectorOutOfCoreCPU(size_t num_qubits, size_t num_chunk_qubits,
+                            std::string path)
+        : BaseType(num_qubits, num_chunk_qubits), path_{std::move(path)},
+          mapping_{Util::MappedMemory::mapFile(
+              path_, Util::MapAccess::ReadWrite, fileBytes(num_qubits))} {
+        resetState();
+    }
+
+    /**
+     * @brief Reset the statevector to @f$|0\cdots 0\rangle@f$ and the layout
+     * to the identity.
+     */
+    void resetState() {
+        const size_t num_chunks = this->getNumChunks();
+        const size_t length = this->chunkLength();
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            std::fill(chunkData(chunk), chunkData(chunk) + length,
+                      ComplexPrecisionT{0, 0});
+        }
+        chunkData(0)[0] = {1, 0};
+        this->resetLayout();
+    }
+
+    /**
+     * @brief Write the amplitudes back to the file.
+     *
+     * The amplitudes are stored in the order of the current layout, see
+     * getLayout().
+     */
+    void flush() const { mapping_->flush(); }
+
+    /**
+     * @brief Get the path of the file.
+     */
+    [[nodiscard]] auto getPath() const -> const std::string & { return path_; }
+};
+} // namespace Pennylane
@@ -18,12 +18,14 @@
 
 #pragma once
 #include <complex>
+#include <memory>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
 #include "BitUtil.hpp"
 #include "Error.hpp"
+#include "MappedMemory.hpp"
 #include "StateVectorCPU.hpp"
 
 #include <iostream>
@@ -53,6 +55,8 @@ class StateVectorRawCPU
   private:
     ComplexPrecisionT *data_;
     size_t length_;
+    std::shared_ptr<const Util::MappedMemory> mapping_;
+    std::shared_ptr<void> owner_;
 
   public:
     /**
@@ -78,25 +82,95 @@ class StateVectorRawCPU
         }
     }
 
+    /**
+     * @brief Construct state-vector from a raw data pointer whose memory is
+     * kept alive by an owner.
+     *
+     * The statevector holds the owner until it is destroyed or bound to
+     * other data, e.g. to keep memory imported from another framework alive
+     * without copying it.
+     *
+     * @param data Raw data pointer.
+     * @param length The size of the data, i.e. 2^(number of qubits).
+     * @param owner Owner of the data.
+     * @param threading Threading option the statevector to use
+     */
+    StateVectorRawCPU(ComplexPrecisionT *data, size_t length,
+                      std::shared_ptr<void> owner,
+                      Threading threading = Threading::SingleThread)
+        : StateVectorRawCPU(data, length, threading) {
+        owner_ = std::move(owner);
+    }
+
+    /**
+     * @brief Construct state-vector from a mapped file or shared memory
+     * segment.
+     *
+     * The statevector keeps the mapping alive. Measurements only read the
+     * data, so they work on read-only mappings shared by several processes
+     * without copying it. Operations require a writable mapping.
+     *
+     * @param mapping Mapped region holding the statevector data.
+     * @param threading Threading option the statevector to use
+     */
+    explicit StateVectorRawCPU(
+        std::shared_ptr<const Util::MappedMemory> mapping,
+        Threading threading = Threading::SingleThread)
+        : StateVectorRawCPU(
+              static_cast<ComplexPrecisionT *>(mapping->data()),
+              mapping->size() / sizeof(ComplexPrecisionT), threading) {
+        PL_ABORT_IF(mapping->size() % sizeof(ComplexPrecisionT) != 0,
+                    "The size of the mapping is not a multiple of the size "
+                    "of an amplitude.");
+        mapping_ = std::move(mapping);
+    }
+
+    /**
+     * @brief Check whether the data is mapped read-only.
+     */
+    [[nodiscard]] auto isReadOnly() const -> bool {
+        return mapping_ && mapping_->access() == Util::MapAccess::ReadOnly;
+    }
+
     /**
      * @brief Get the underlying data pointer.
      *
      * @return const ComplexPrecisionT* Pointer to statevector data.
      */
-    [[nodiscard]] auto getData() const -> ComplexPrecisionT * { return data_; }
+    [[nodiscard]] auto getData() const -> ComplexPrecisionT * {
+        this->checkCanonical();
+        return data_;
+    }
+
+    /**
+     * @brief Get the underlying data pointer without applying the deferred
+     * gates, the Clifford prefix or the wire map.
+     *
+     * @return const ComplexPrecisionT* Pointer to statevector data.
+     */
+    [[nodiscard]] auto getPhysicalData() const -> const ComplexPrecisionT * {
+        return data_;
+    }
 
     /**
      * @brief Get the underlying data pointer.
      *
      * @return ComplexPrecisionT* Pointer to statevector data.
      */
-    auto getData() -> ComplexPrecisionT * { return data_; }
+    auto getData() -> ComplexPrecisionT * {
+        PL_ABORT_IF(isReadOnly(), "The statevector is mapped read-only.");
+        this->flushOperations();
+        this->markModified();
+        return data_;
+    }
 
     /**
      * @brief Redefine statevector data pointer.
      *
      * @param data New raw data pointer.
      * @param length The size of the data, i.e. 2^(number of qubits).
+     * Releases the mapping or the owner the statevector was constructed
+     * from, if any.
      */
     void setData(ComplexPrecisionT *data, size_t length) {
         if (!Util::isPerfectPowerOf2(length)) {
@@ -106,6 +180,10 @@ class StateVectorRawCPU
                      " is given."); // TODO: change to std::format in C++20
         }
         data_ = data;
+        mapping_.reset();
+        owner_.reset();
+        this->markModified();
+        this->discardWireMap();
         BaseType::setNumQubits(Util::log2PerfectPower(length));
         length_ = length;
     }
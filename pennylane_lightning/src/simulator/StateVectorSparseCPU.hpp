@@ -0,0 +1,617 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a statevector storing only its nonzero amplitudes.
+ */
+#pragma once
+
+#include "BitUtil.hpp"
+#include "Constant.hpp"
+#include "ConstantUtil.hpp"
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "GateOperation.hpp"
+#include "KernelType.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Pennylane {
+/**
+ * @brief A statevector storing only its nonzero amplitudes in a hash table,
+ * which becomes a dense statevector once too many amplitudes are nonzero.
+ *
+ * Circuits made mostly of classical reversible gates, e.g. arithmetic
+ * oracles, keep the state supported on few basis states. Gates whose
+ * matrix has a single nonzero element per column (X, CNOT, Toffoli, CSWAP,
+ * SWAP and all diagonal gates) map each stored basis state to a single
+ * basis state, so they cost time proportional to the support instead of
+ * @f$2^n@f$. Other gates are applied by scattering every stored amplitude
+ * over the basis states it is mapped to.
+ *
+ * The amplitudes are stored in an open-addressing table with linear
+ * probing, keyed by the index of the basis state. When the support exceeds
+ * a threshold, the state is converted to a StateVectorManagedCPU, which
+ * applies all following gates.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT = double> class StateVectorSparseCPU {
+  public:
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+
+  private:
+    /**
+     * @brief Open-addressing hash table from basis state indices to
+     * amplitudes.
+     */
+    class AmplitudeTable {
+      private:
+        static constexpr size_t empty_key = ~size_t{0};
+
+        std::vector<size_t> keys_;
+        std::vector<ComplexPrecisionT> values_;
+        size_t size_{0};
+        size_t shift_{0};
+
+        [[nodiscard]] auto slot(size_t key) const -> size_t {
+            // Fibonacci hashing spreads the low bits of neighbouring keys
+            return (key * size_t{0x9E3779B97F4A7C15ULL}) >> shift_;
+        }
+
+        void rehash(size_t capacity) {
+            std::vector<size_t> keys(capacity, empty_key);
+            std::vector<ComplexPrecisionT> values(capacity);
+            std::swap(keys, keys_);
+            std::swap(values, values_);
+            shift_ = 64 - Util::log2PerfectPower(capacity);
+            size_ = 0;
+            for (size_t idx = 0; idx < keys.size(); idx++) {
+                if (keys[idx] != empty_key) {
+                    (*this)[keys[idx]] = values[idx];
+                }
+            }
+        }
+
+      public:
+        AmplitudeTable() { rehash(16); }
+
+        /**
+         * @brief Get the number of stored amplitudes.
+         */
+        [[nodiscard]] auto size() const -> size_t { return size_; }
+
+        /**
+         * @brief Make room for a number of amplitudes without rehashing.
+         */
+        void reserve(size_t count) {
+            // Keep the load factor at most 1/2
+            size_t capacity = 16;
+            while (capacity < 2 * count) {
+                capacity *= 2;
+            }
+            if (capacity > keys_.size()) {
+                rehash(capacity);
+            }
+        }
+
+        /**
+         * @brief Get the amplitude of a basis state, inserting a zero
+         * amplitude if it is not stored.
+         */
+        auto operator[](size_t key) -> ComplexPrecisionT & {
+            const size_t mask = keys_.size() - 1;
+            size_t idx = slot(key);
+            while (keys_[idx] != empty_key && keys_[idx] != key) {
+                idx = (idx + 1) & mask;
+            }
+            if (keys_[idx] == key) {
+                return values_[idx];
+            }
+            if (2 * (size_ + 1) > keys_.size()) {
+                rehash(2 * keys_.size());
+                return (*this)[key];
+            }
+            keys_[idx] = key;
+            values_[idx] = ComplexPrecisionT{};
+            size_++;
+            return values_[idx];
+        }
+
+        /**
+         * @brief Get the amplitude of a basis state, or zero if it is not
+         * stored.
+         */
+        [[nodiscard]] auto find(size_t key) const -> ComplexPrecisionT {
+            const size_t mask = keys_.size() - 1;
+            for (size_t idx = slot(key); keys_[idx] != empty_key;
+                 idx = (idx + 1) & mask) {
+                if (keys_[idx] == key) {
+                    return values_[idx];
+                }
+            }
+            return {};
+        }
+
+        /**
+         * @brief Call a function with every stored basis state index and
+         * a reference to its amplitude.
+         */
+        template <class Func> void forEach(Func &&func) {
+            for (size_t idx = 0; idx < keys_.size(); idx++) {
+                if (keys_[idx] != empty_key) {
+                    func(keys_[idx], values_[idx]);
+                }
+            }
+        }
+
+        template <class Func> void forEach(Func &&func) const {
+            for (size_t idx = 0; idx < keys_.size(); idx++) {
+                if (keys_[idx] != empty_key) {
+                    func(keys_[idx], values_[idx]);
+                }
+            }
+        }
+    };
+
+    size_t num_qubits_;
+    size_t max_support_;
+    AmplitudeTable table_;
+    std::unique_ptr<StateVectorManagedCPU<PrecisionT>> dense_;
+
+    /**
+     * @brief Compute the diagonal of a diagonal gate, or the matrix of any
+     * other gate, acting on its own wires.
+     *
+     * @param gate_op Gate operation.
+     * @param num_wires Number of wires of the gate.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Parameters of the gate.
+     * @param diagonal Whether to compute the diagonal only.
+     * @return Diagonal of size dim, or matrix of size dim * dim in
+     * row-major order.
+     */
+    static auto gateMatrix(Gates::GateOperation gate_op, size_t num_wires,
+                           bool inverse, const std::vector<PrecisionT> &params,
+                           bool diagonal) -> std::vector<ComplexPrecisionT> {
+        const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+        const auto kernel =
+            dispatcher.isRegistered(gate_op, Gates::KernelType::LM)
+                ? Gates::KernelType::LM
+                : Gates::KernelType::PI;
+        const size_t dim = Util::exp2(num_wires);
+        std::vector<size_t> local_wires(num_wires);
+        std::iota(local_wires.begin(), local_wires.end(), size_t{0});
+
+        if (diagonal) {
+            std::vector<ComplexPrecisionT> diag(dim, {1.0, 0.0});
+            dispatcher.applyOperation(kernel, diag.data(), num_wires, gate_op,
+                                      local_wires, inverse, params);
+            return diag;
+        }
+        std::vector<ComplexPrecisionT> matrix(dim * dim);
+        std::vector<ComplexPrecisionT> column(dim);
+        for (size_t col = 0; col < dim; col++) {
+            std::fill(column.begin(), column.end(), ComplexPrecisionT{});
+            column[col] = {1.0, 0.0};
+            dispatcher.applyOperation(kernel, column.data(), num_wires,
+                                      gate_op, local_wires, inverse, params);
+            for (size_t row = 0; row < dim; row++) {
+                matrix[row * dim + col] = column[row];
+            }
+        }
+        return matrix;
+    }
+
+    /**
+     * @brief Get the bits of a basis state index holding each local index
+     * of a gate on some wires.
+     */
+    [[nodiscard]] auto scatterBits(const std::vector<size_t> &wires) const
+        -> std::vector<size_t> {
+        const size_t num_wires = wires.size();
+        std::vector<size_t> scatter(Util::exp2(num_wires), 0);
+        for (size_t k = 0; k < num_wires; k++) {
+            const size_t bit = size_t{1U} << (num_qubits_ - 1 - wires[k]);
+            const size_t local_bit = size_t{1U} << (num_wires - 1 - k);
+            for (size_t local = 0; local < scatter.size(); local++) {
+                if ((local & local_bit) != 0) {
+                    scatter[local] |= bit;
+                }
+            }
+        }
+        return scatter;
+    }
+
+    /**
+     * @brief Get the local index of a basis state for a gate on some wires.
+     */
+    [[nodiscard]] auto gatherBits(size_t key,
+                                  const std::vector<size_t> &wires) const
+        -> size_t {
+        size_t local = 0;
+        for (const size_t wire : wires) {
+            local = (local << 1U) | ((key >> (num_qubits_ - 1 - wire)) & 1U);
+        }
+        return local;
+    }
+
+    /**
+     * @brief Apply a diagonal matrix to the stored amplitudes.
+     *
+     * @param diag Diagonal of size dim.
+     * @param wires Wires to apply the matrix to.
+     */
+    void applySparseDiagonal(const std::vector<ComplexPrecisionT> &diag,
+                             const std::vector<size_t> &wires) {
+        table_.forEach([&](size_t key, ComplexPrecisionT &amp) {
+            amp *= diag[gatherBits(key, wires)];
+        });
+    }
+
+    /**
+     * @brief Apply a matrix to the stored amplitudes.
+     *
+     * @param matrix Matrix of size dim * dim in row-major order.
+     * @param wires Wires to apply the matrix to.
+     */
+    void applySparse(const std::vector<ComplexPrecisionT> &matrix,
+                     const std::vector<size_t> &wires) {
+        const size_t dim = Util::exp2(wires.size());
+
+        // Matrices with a single nonzero element per column map each basis
+        // state to a single basis state
+        std::vector<size_t> target(dim);
+        bool monomial = true;
+        bool diagonal = true;
+        for (size_t col = 0; col < dim && monomial; col++) {
+            size_t nonzeros = 0;
+            for (size_t row = 0; row < dim; row++) {
+                if (matrix[row * dim + col] != ComplexPrecisionT{}) {
+                    target[col] = row;
+                    nonzeros++;
+                }
+            }
+            monomial = nonzeros == 1;
+            diagonal = diagonal && monomial && target[col] == col;
+        }
+        if (diagonal) {
+            std::vector<ComplexPrecisionT> diag(dim);
+            for (size_t idx = 0; idx < dim; idx++) {
+                diag[idx] = matrix[idx * dim + idx];
+            }
+            applySparseDiagonal(diag, wires);
+            return;
+        }
+
+        const auto scatter = scatterBits(wires);
+        const size_t wires_mask = scatter[dim - 1];
+        AmplitudeTable result;
+        if (monomial) {
+            result.reserve(table_.size());
+            table_.forEach([&](size_t key, const ComplexPrecisionT &amp) {
+                const size_t local = gatherBits(key, wires);
+                const size_t row = target[local];
+                result[(key & ~wires_mask) | scatter[row]] =
+                    matrix[row * dim + local] * amp;
+            });
+            table_ = std::move(result);
+            return;
+        }
+
+        result.reserve(std::min(table_.size() * dim, getLength()));
+        table_.forEach([&](size_t key, const ComplexPrecisionT &amp) {
+            const size_t local = gatherBits(key, wires);
+            const size_t base = key & ~wires_mask;
+            for (size_t row = 0; row < dim; row++) {
+                const ComplexPrecisionT elt = matrix[row * dim + local];
+                if (elt != ComplexPrecisionT{}) {
+                    result[base | scatter[row]] += elt * amp;
+                }
+            }
+        });
+        // Drop the amplitudes cancelled by interference
+        constexpr PrecisionT tol = std::numeric_limits<PrecisionT>::epsilon() *
+                                   std::numeric_limits<PrecisionT>::epsilon();
+        table_ = AmplitudeTable{};
+        table_.reserve(result.size());
+        result.forEach([&](size_t key, const ComplexPrecisionT &amp) {
+            if (std::norm(amp) > tol) {
+                table_[key] = amp;
+            }
+        });
+        if (table_.size() > max_support_) {
+            convertToDense();
+        }
+    }
+
+  public:
+    /**
+     * @brief Construct a @f$|0\cdots 0\rangle@f$ state.
+     *
+     * @param num_qubits Number of qubits.
+     * @param max_support Number of nonzero amplitudes above which the state
+     * is converted to a dense statevector. Defaults to 1/16 of the length
+     * of the statevector if 0.
+     */
+    explicit StateVectorSparseCPU(size_t num_qubits, size_t max_support = 0)
+        : num_qubits_{num_qubits}, max_support_{max_support} {
+        PL_ABORT_IF(num_qubits >= 64,
+                    "The number of qubits must be smaller than 64.");
+        if (max_support_ == 0) {
+            max_support_ = std::max(size_t{1}, Util::exp2(num_qubits) / 16);
+        }
+        table_[0] = {1.0, 0.0};
+    }
+
+    /**
+     * @brief Get the number of qubits.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Get the length of the statevector.
+     */
+    [[nodiscard]] auto getLength() const -> size_t {
+        return Util::exp2(num_qubits_);
+    }
+
+    /**
+     * @brief Get the number of nonzero amplitudes above which the state is
+     * converted to a dense statevector.
+     */
+    [[nodiscard]] auto getMaxSupport() const -> size_t {
+        return max_support_;
+    }
+
+    /**
+     * @brief Check whether the state was converted to a dense statevector.
+     */
+    [[nodiscard]] auto isDense() const -> bool { return dense_ != nullptr; }
+
+    /**
+     * @brief Get the number of stored amplitudes, i.e. the length of the
+     * statevector once it is dense.
+     */
+    [[nodiscard]] auto getSupportSize() const -> size_t {
+        return dense_ ? getLength() : table_.size();
+    }
+
+    /**
+     * @brief Prepare a computational basis state.
+     *
+     * A dense statevector becomes sparse again.
+     *
+     * @param index Index of the basis state.
+     */
+    void setBasisState(size_t index) {
+        PL_ABORT_IF(index >= getLength(), "Invalid basis state index.");
+        dense_.reset();
+        table_ = AmplitudeTable{};
+        table_[index] = {1.0, 0.0};
+    }
+
+    /**
+     * @brief Get the amplitude of a basis state.
+     *
+     * @param index Index of the basis state.
+     */
+    [[nodiscard]] auto getAmplitude(size_t index) const -> ComplexPrecisionT {
+        PL_ABORT_IF(index >= getLength(), "Invalid basis state index.");
+        if (dense_) {
+            return dense_->getAmplitudes({index})[0];
+        }
+        return table_.find(index);
+    }
+
+    /**
+     * @brief Get the indices and amplitudes of the nonzero amplitudes,
+     * sorted by index.
+     */
+    [[nodiscard]] auto getSparseData() const
+        -> std::pair<std::vector<size_t>, std::vector<ComplexPrecisionT>> {
+        std::vector<std::pair<size_t, ComplexPrecisionT>> entries;
+        if (dense_) {
+            const auto data = getDataVector();
+            for (size_t idx = 0; idx < data.size(); idx++) {
+                if (data[idx] != ComplexPrecisionT{}) {
+                    entries.emplace_back(idx, data[idx]);
+                }
+            }
+        } else {
+            entries.reserve(table_.size());
+            table_.forEach([&](size_t key, const ComplexPrecisionT &amp) {
+                entries.emplace_back(key, amp);
+            });
+            std::sort(entries.begin(), entries.end(),
+                      [](const auto &lhs, const auto &rhs) {
+                          return lhs.first < rhs.first;
+                      });
+        }
+        std::pair<std::vector<size_t>, std::vector<ComplexPrecisionT>> result;
+        result.first.reserve(entries.size());
+        result.second.reserve(entries.size());
+        for (const auto &[key, amp] : entries) {
+            result.first.emplace_back(key);
+            result.second.emplace_back(amp);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Get the statevector as a dense vector.
+     */
+    [[nodiscard]] auto getDataVector() const -> std::vector<ComplexPrecisionT> {
+        if (dense_) {
+            dense_->canonicalizeWires();
+            const auto *data = std::as_const(*dense_).getData();
+            return {data, data + dense_->getLength()};
+        }
+        std::vector<ComplexPrecisionT> data(getLength());
+        table_.forEach([&](size_t key, const ComplexPrecisionT &amp) {
+            data[key] = amp;
+        });
+        return data;
+    }
+
+    /**
+     * @brief Convert the state to a dense statevector, which applies all
+     * following gates.
+     */
+    void convertToDense() {
+        if (dense_) {
+            return;
+        }
+        dense_ = std::make_unique<StateVectorManagedCPU<PrecisionT>>(
+            num_qubits_, Threading::MultiThread);
+        auto *data = dense_->getData();
+        data[0] = ComplexPrecisionT{};
+        table_.forEach([&](size_t key, const ComplexPrecisionT &amp) {
+            data[key] = amp;
+        });
+        table_ = AmplitudeTable{};
+    }
+
+    /**
+     * @brief Get the dense statevector, converting the state first if
+     * needed.
+     */
+    [[nodiscard]] auto getDenseStateVector()
+        -> StateVectorManagedCPU<PrecisionT> & {
+        convertToDense();
+        return *dense_;
+    }
+
+    /**
+     * @brief Apply a given matrix to wires.
+     *
+     * @param matrix Matrix of size dim * dim in row-major order.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyMatrix(const ComplexPrecisionT *matrix,
+                     const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+        }
+        if (dense_) {
+            dense_->applyMatrix(matrix, wires, inverse);
+            return;
+        }
+        const size_t dim = Util::exp2(wires.size());
+        std::vector<ComplexPrecisionT> mat(matrix, matrix + dim * dim);
+        if (inverse) {
+            for (size_t row = 0; row < dim; row++) {
+                for (size_t col = 0; col < dim; col++) {
+                    mat[row * dim + col] = std::conj(matrix[col * dim + row]);
+                }
+            }
+        }
+        applySparse(mat, wires);
+    }
+
+    /**
+     * @brief Apply a given matrix to wires.
+     *
+     * @param matrix Matrix of size dim * dim in row-major order.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyMatrix(const std::vector<ComplexPrecisionT> &matrix,
+                     const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ABORT_IF(matrix.size() != Util::exp2(2 * wires.size()),
+                    "The size of matrix does not match with the given "
+                    "number of wires");
+        applyMatrix(matrix.data(), wires, inverse);
+    }
+
+    /**
+     * @brief Apply a single gate.
+     *
+     * @param gate_op Gate operation to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(Gates::GateOperation gate_op,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+        }
+        if (dense_) {
+            dense_->applyOperation(gate_op, wires, inverse, params);
+            return;
+        }
+        if (Util::array_has_elt(Gates::Constant::diagonal_gates, gate_op)) {
+            applySparseDiagonal(
+                gateMatrix(gate_op, wires.size(), inverse, params, true),
+                wires);
+            return;
+        }
+        applySparse(gateMatrix(gate_op, wires.size(), inverse, params, false),
+                    wires);
+    }
+
+    /**
+     * @brief Apply a single gate.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        applyOperation(
+            DynamicDispatcher<PrecisionT>::getInstance().strToGateOp(opName),
+            wires, inverse, params);
+    }
+
+    /**
+     * @brief Apply multiple gates.
+     *
+     * @param ops Vector of gate names to be applied in order.
+     * @param wires Vector of wires on which to apply index-matched gate name.
+     * @param inverse Indicates whether gate at matched index is to be
+     * inverted.
+     * @param params Optional parameter data for index matched gates.
+     */
+    void applyOperations(const std::vector<std::string> &ops,
+                         const std::vector<std::vector<size_t>> &wires,
+                         const std::vector<bool> &inverse,
+                         const std::vector<std::vector<PrecisionT>> &params) {
+        const size_t num_operations = ops.size();
+        PL_ABORT_IF(num_operations != wires.size() ||
+                        num_operations != inverse.size() ||
+                        num_operations != params.size(),
+                    "Invalid arguments: number of operations, wires, "
+                    "inverses, and parameters must all be equal");
+        for (size_t idx = 0; idx < num_operations; idx++) {
+            applyOperation(ops[idx], wires[idx], inverse[idx], params[idx]);
+        }
+    }
+};
+} // namespace Pennylane
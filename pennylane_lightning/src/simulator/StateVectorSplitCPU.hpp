@@ -0,0 +1,265 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines a statevector stored as separate arrays of the real and imaginary
+ * parts.
+ */
+#pragma once
+
+#include "BitUtil.hpp"
+#include "CPUMemoryModel.hpp"
+#include "Constant.hpp"
+#include "ConstantUtil.hpp"
+#include "DynamicDispatcher.hpp"
+#include "Error.hpp"
+#include "KernelType.hpp"
+#include "Memory.hpp"
+#include "Util.hpp"
+#include "cpu_kernels/SplitComplexKernels.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace Pennylane {
+/**
+ * @brief Statevector whose real and imaginary parts are stored in separate
+ * arrays (structure of arrays).
+ *
+ * With interleaved complex numbers, a SIMD complex multiplication needs
+ * shuffles to pair the real and imaginary parts. With split arrays, the
+ * kernels (see Gates::SplitComplex) are plain real FMAs over contiguous
+ * runs, which the compiler vectorizes for any vector width. Both arrays are
+ * allocated with the alignment of bestCPUMemoryModel().
+ *
+ * The data stays split while gates are applied, and is converted to or from
+ * interleaved complex numbers only on construction and on request, e.g. at
+ * the NumPy boundary.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT = double> class StateVectorSplitCPU {
+  public:
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    using ArrayT = std::vector<PrecisionT, Util::AlignedAllocator<PrecisionT>>;
+
+  private:
+    size_t num_qubits_;
+    ArrayT re_;
+    ArrayT im_;
+
+  public:
+    /**
+     * @brief Construct the state @f$|0\cdots 0\rangle@f$.
+     *
+     * @param num_qubits Number of qubits.
+     */
+    explicit StateVectorSplitCPU(size_t num_qubits)
+        : num_qubits_{num_qubits},
+          re_(Util::exp2(num_qubits), 0,
+              getAllocator<PrecisionT>(bestCPUMemoryModel())),
+          im_(Util::exp2(num_qubits), 0,
+              getAllocator<PrecisionT>(bestCPUMemoryModel())) {
+        re_[0] = 1;
+    }
+
+    /**
+     * @brief Construct a statevector from interleaved complex data.
+     *
+     * @param data Pointer to the data.
+     * @param length Length of the data, a power of 2.
+     */
+    StateVectorSplitCPU(const ComplexPrecisionT *data, size_t length)
+        : StateVectorSplitCPU(Util::log2PerfectPower(length)) {
+        PL_ABORT_IF_NOT(Util::isPerfectPowerOf2(length),
+                        "The size of provided data must be a power of 2.");
+        setData(data);
+    }
+
+    /**
+     * @brief Get the number of qubits.
+     */
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits_; }
+
+    /**
+     * @brief Get the length of the statevector.
+     */
+    [[nodiscard]] auto getLength() const -> size_t { return re_.size(); }
+
+    /**
+     * @brief Get the real parts.
+     */
+    [[nodiscard]] auto getReal() const -> const ArrayT & { return re_; }
+
+    /**
+     * @brief Get the imaginary parts.
+     */
+    [[nodiscard]] auto getImag() const -> const ArrayT & { return im_; }
+
+    /**
+     * @brief Overwrite the state with interleaved complex data of the same
+     * length.
+     *
+     * @param data Pointer to the data.
+     */
+    void setData(const ComplexPrecisionT *data) {
+        for (size_t idx = 0; idx < re_.size(); idx++) {
+            re_[idx] = data[idx].real();
+            im_[idx] = data[idx].imag();
+        }
+    }
+
+    /**
+     * @brief Copy the state to interleaved complex data of the same length.
+     *
+     * @param data Pointer to the output.
+     */
+    void copyTo(ComplexPrecisionT *data) const {
+        for (size_t idx = 0; idx < re_.size(); idx++) {
+            data[idx] = ComplexPrecisionT{re_[idx], im_[idx]};
+        }
+    }
+
+    /**
+     * @brief Get the state as interleaved complex data.
+     */
+    [[nodiscard]] auto getDataVector() const -> std::vector<ComplexPrecisionT> {
+        std::vector<ComplexPrecisionT> data(re_.size());
+        copyTo(data.data());
+        return data;
+    }
+
+    /**
+     * @brief Apply a single gate to the state.
+     *
+     * Diagonal gates are applied as their diagonal, other gates as their
+     * matrix, both computed by applying the interleaved kernel of the gate to
+     * the basis states of its wires.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param inverse Indicates whether to use inverse of gate.
+     * @param params Optional parameter list for parametric gates.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<size_t> &wires, bool inverse = false,
+                        const std::vector<PrecisionT> &params = {}) {
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+        }
+        const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+        const auto gate_op = dispatcher.strToGateOp(opName);
+        const auto kernel =
+            dispatcher.isRegistered(gate_op, Gates::KernelType::LM)
+                ? Gates::KernelType::LM
+                : Gates::KernelType::PI;
+        const size_t num_wires = wires.size();
+        const size_t dim = Util::exp2(num_wires);
+        std::vector<size_t> local_wires(num_wires);
+        std::iota(local_wires.begin(), local_wires.end(), size_t{0});
+
+        if (Util::array_has_elt(Gates::Constant::diagonal_gates, gate_op)) {
+            std::vector<ComplexPrecisionT> diag(dim, {1.0, 0.0});
+            dispatcher.applyOperation(kernel, diag.data(), num_wires, gate_op,
+                                      local_wires, inverse, params);
+            Gates::SplitComplex::applyDiagonal(re_.data(), im_.data(),
+                                               num_qubits_, diag.data(), wires);
+            return;
+        }
+        std::vector<ComplexPrecisionT> matrix(dim * dim);
+        std::vector<ComplexPrecisionT> column(dim);
+        for (size_t col = 0; col < dim; col++) {
+            std::fill(column.begin(), column.end(), ComplexPrecisionT{});
+            column[col] = {1.0, 0.0};
+            dispatcher.applyOperation(kernel, column.data(), num_wires,
+                                      gate_op, local_wires, inverse, params);
+            for (size_t row = 0; row < dim; row++) {
+                matrix[row * dim + col] = column[row];
+            }
+        }
+        Gates::SplitComplex::applyMatrix(re_.data(), im_.data(), num_qubits_,
+                                         matrix.data(), wires);
+    }
+
+    /**
+     * @brief Apply multiple gates to the state.
+     *
+     * @param ops Vector of gate names to be applied in order.
+     * @param ops_wires Vector of wires on which to apply index-matched gate
+     * name.
+     * @param ops_inverse Indicates whether gate at matched index is to be
+     * inverted.
+     * @param ops_params Parameter data for index matched gates.
+     */
+    void
+    applyOperations(const std::vector<std::string> &ops,
+                    const std::vector<std::vector<size_t>> &ops_wires,
+                    const std::vector<bool> &ops_inverse,
+                    const std::vector<std::vector<PrecisionT>> &ops_params) {
+        PL_ABORT_IF(ops.size() != ops_wires.size() ||
+                        ops.size() != ops_inverse.size() ||
+                        ops.size() != ops_params.size(),
+                    "Invalid arguments: number of operations, wires, "
+                    "inverses, and parameters must all be equal");
+        for (size_t i = 0; i < ops.size(); i++) {
+            applyOperation(ops[i], ops_wires[i], ops_inverse[i], ops_params[i]);
+        }
+    }
+
+    /**
+     * @brief Apply a matrix to the state.
+     *
+     * @param matrix Row-major matrix of size `2^wires.size()`.
+     * @param wires Wires to apply the matrix to.
+     * @param inverse Indicate whether inverse should be taken.
+     */
+    void applyMatrix(const std::vector<ComplexPrecisionT> &matrix,
+                     const std::vector<size_t> &wires, bool inverse = false) {
+        PL_ABORT_IF(wires.empty(), "Number of wires must be larger than 0");
+        const size_t dim = Util::exp2(wires.size());
+        PL_ABORT_IF(matrix.size() != dim * dim,
+                    "The size of matrix does not match with the given "
+                    "number of wires");
+        for (const size_t wire : wires) {
+            PL_ABORT_IF(wire >= num_qubits_, "Invalid wire index.");
+        }
+        if (!inverse) {
+            Gates::SplitComplex::applyMatrix(re_.data(), im_.data(),
+                                             num_qubits_, matrix.data(), wires);
+            return;
+        }
+        std::vector<ComplexPrecisionT> adjoint(dim * dim);
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                adjoint[row * dim + col] = std::conj(matrix[col * dim + row]);
+            }
+        }
+        Gates::SplitComplex::applyMatrix(re_.data(), im_.data(), num_qubits_,
+                                         adjoint.data(), wires);
+    }
+
+    /**
+     * @brief Compute the probability of each computational basis state.
+     */
+    [[nodiscard]] auto probs() const -> std::vector<PrecisionT> {
+        std::vector<PrecisionT> result(re_.size());
+        Gates::SplitComplex::probabilities(re_.data(), im_.data(), re_.size(),
+                                           result.data());
+        return result;
+    }
+};
+} // namespace Pennylane
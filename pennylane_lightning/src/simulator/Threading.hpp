@@ -18,14 +18,21 @@
 #pragma once
 
 #include "CPUMemoryModel.hpp"
+#include "Error.hpp"
 #include "Macros.hpp"
 
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 #ifdef PL_USE_OMP
 #include <omp.h>
 #endif
 
+#if defined(PL_USE_OMP) && defined(__linux__)
+#include <sched.h>
+#endif
+
 namespace Pennylane {
 enum class Threading : uint8_t {
     SingleThread,
@@ -34,6 +41,20 @@ enum class Threading : uint8_t {
     BEGIN = SingleThread,
 };
 
+/**
+ * @brief Choose the NUMA policy of statevectors with the given threading.
+ *
+ * Multi-threaded statevectors are first touched in parallel, so that the
+ * pages are spread over the NUMA nodes as the kernels access them.
+ *
+ * @param threading Threading of the statevector.
+ * @return Util::NUMAPolicy
+ */
+inline auto bestNUMAPolicy(Threading threading) -> Util::NUMAPolicy {
+    return (threading == Threading::MultiThread) ? Util::NUMAPolicy::FirstTouch
+                                                 : Util::NUMAPolicy::Default;
+}
+
 /**
  * @brief Compute dispatch key using threading and memory information.
  *
@@ -63,4 +84,141 @@ inline auto bestThreading() -> Threading {
     return Threading::SingleThread;
 }
 
+/**
+ * @brief Threads used by the kernels and reductions run on behalf of a
+ * statevector, a measurement or a gradient computation.
+ *
+ * The default configuration leaves the OpenMP settings of the process
+ * (e.g. `OMP_NUM_THREADS`) untouched.
+ */
+struct ThreadingConfig {
+    /**
+     * @brief Number of threads. 0 uses the OpenMP default, or the size of
+     * cpu_set if it is not empty.
+     */
+    size_t num_threads{0};
+    /**
+     * @brief CPUs the threads are pinned to, thread `i` to
+     * `cpu_set[i % cpu_set.size()]`. Empty leaves the affinity untouched.
+     */
+    std::vector<size_t> cpu_set{};
+    /**
+     * @brief Statevectors with fewer qubits are processed by a single
+     * thread, as spawning a team costs more than the work.
+     */
+    size_t sequential_below_num_qubits{0};
+
+    /**
+     * @brief Check whether the configuration leaves the OpenMP settings
+     * untouched.
+     */
+    [[nodiscard]] auto isDefault() const -> bool {
+        return num_threads == 0 && cpu_set.empty() &&
+               sequential_below_num_qubits == 0;
+    }
+
+    /**
+     * @brief Get the number of threads for a statevector of the given
+     * number of qubits, or 0 for the OpenMP default.
+     *
+     * @param num_qubits Number of qubits.
+     */
+    [[nodiscard]] auto numThreads(size_t num_qubits) const -> size_t {
+        if (num_qubits < sequential_below_num_qubits) {
+            return 1;
+        }
+        return (num_threads == 0) ? cpu_set.size() : num_threads;
+    }
+};
+
+/**
+ * @brief Apply a ThreadingConfig to the parallel regions opened by the
+ * current thread for the lifetime of the object.
+ *
+ * The number of threads is set with `omp_set_num_threads` and restored on
+ * destruction. The threads are pinned to the CPU set once per set and team
+ * size, and stay pinned afterwards, as restoring the affinity of every
+ * thread would cost a parallel region per call. Inside a parallel region,
+ * e.g. when the adjoint method distributes observables over threads, the
+ * enclosing region decides and the scope does nothing. Without OpenMP, the
+ * scope does nothing.
+ */
+class ThreadingScope {
+  private:
+#ifdef PL_USE_OMP
+    int max_threads_{0}; /**< Number of threads to restore, 0 if none */
+
+    /**
+     * @brief Pin the threads of a team of the given size to the CPU set.
+     */
+    static void pinThreads(const std::vector<size_t> &cpu_set,
+                           size_t num_threads) {
+#ifdef __linux__
+        thread_local std::pair<std::vector<size_t>, size_t> pinned{};
+        if (pinned.second == num_threads && pinned.first == cpu_set) {
+            return;
+        }
+        for (const size_t cpu : cpu_set) {
+            PL_ABORT_IF(cpu >= CPU_SETSIZE, "Invalid CPU index.");
+        }
+        int num_failures = 0;
+#pragma omp parallel num_threads(static_cast<int>(num_threads))               \
+    reduction(+ : num_failures)
+        {
+            const auto thread = static_cast<size_t>(omp_get_thread_num());
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            CPU_SET(cpu_set[thread % cpu_set.size()], &mask);
+            if (sched_setaffinity(0, sizeof(mask), &mask) != 0) {
+                num_failures++;
+            }
+        }
+        PL_ABORT_IF(num_failures > 0,
+                    "Failed to set the CPU affinity of the threads.");
+        pinned = {cpu_set, num_threads};
+#else
+        static_cast<void>(cpu_set);
+        static_cast<void>(num_threads);
+        PL_ABORT("CPU affinity is only supported on Linux.");
+#endif
+    }
+#endif
+
+  public:
+    /**
+     * @brief Apply the configuration for a statevector of the given number
+     * of qubits.
+     *
+     * @param config Threading configuration.
+     * @param num_qubits Number of qubits.
+     */
+    ThreadingScope([[maybe_unused]] const ThreadingConfig &config,
+                   [[maybe_unused]] size_t num_qubits) {
+#ifdef PL_USE_OMP
+        if (config.isDefault() || omp_in_parallel() != 0) {
+            return;
+        }
+        const size_t num_threads = config.numThreads(num_qubits);
+        if (num_threads == 0) {
+            return;
+        }
+        if (!config.cpu_set.empty()) {
+            pinThreads(config.cpu_set, num_threads);
+        }
+        max_threads_ = omp_get_max_threads();
+        omp_set_num_threads(static_cast<int>(num_threads));
+#endif
+    }
+    ThreadingScope(const ThreadingScope &) = delete;
+    ThreadingScope(ThreadingScope &&) = delete;
+    ThreadingScope &operator=(const ThreadingScope &) = delete;
+    ThreadingScope &operator=(ThreadingScope &&) = delete;
+    ~ThreadingScope() {
+#ifdef PL_USE_OMP
+        if (max_threads_ > 0) {
+            omp_set_num_threads(max_threads_);
+        }
+#endif
+    }
+};
 } // namespace Pennylane
@@ -0,0 +1,354 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines the Trotterized time evolution under a Hamiltonian given by a
+ * linear combination of Pauli words.
+ */
+#pragma once
+
+#include "CostLayer.hpp"
+#include "Error.hpp"
+#include "PauliRot.hpp"
+#include "PauliSum.hpp"
+#include "StateVectorCPU.hpp"
+#include "Util.hpp"
+#include "cpu_kernels/GateImplementationsLM.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Pennylane {
+/**
+ * @brief Approximate the time evolution @f$e^{-iHt}@f$ under a Hamiltonian
+ * @f$H = \sum_t c_t P_t@f$ by a product formula.
+ *
+ * Each step of length @f$\delta = t/n@f$ is split into the exponentials of
+ * groups of terms which are applied exactly in a single pass each:
+ *
+ * - all diagonal terms (only I and Z) commute, and their exponential is a
+ *   diagonal over the wires they act on, precomputed once per call;
+ * - the other terms are grouped by their bit flip (X/Y) mask. The sum of a
+ *   group only couples the amplitudes of each pair of basis states differing
+ *   by the mask, so its exponential is a @f$2\times 2@f$ rotation of each
+ *   pair. A group of a single term is the Pauli rotation kernel.
+ *
+ * The order 1 formula applies the groups in turn, the order 2 (Strang)
+ * formula symmetrizes it, and higher even orders follow the Suzuki
+ * recursion. The sequence of exponentials and the buffers of the diagonals
+ * are set up on construction, so that steps allocate nothing.
+ *
+ * @tparam T Floating point precision.
+ */
+template <class T> class TrotterEvolution {
+  public:
+    using ComplexT = std::complex<T>;
+
+  private:
+    /**
+     * @brief Non-diagonal terms sharing the same bit flip mask.
+     *
+     * Each term is stored as a pair of its phase mask and its coefficient
+     * multiplied by @f$i^{n_Y}@f$, as in PauliSum::Group.
+     */
+    struct Group {
+        Gates::PauliWordMasks masks; ///< Masks of the first term
+        T coeff;                     ///< Coefficient of the first term
+        std::vector<std::pair<size_t, ComplexT>> terms;
+    };
+
+    /**
+     * @brief Exponential of a group for a fraction of the step length.
+     * The group index equals the number of non-diagonal groups for the
+     * diagonal terms.
+     */
+    struct Stage {
+        size_t group;
+        T fraction;
+        size_t diag_idx; ///< Index of the diagonal buffer, if diagonal
+    };
+
+    size_t num_qubits_;
+    std::vector<Group> groups_;
+    std::vector<size_t> diag_wires_;
+    std::vector<T> diag_cost_;
+    std::vector<T> diag_fractions_;
+    std::vector<std::vector<ComplexT>> diagonals_;
+    std::vector<Stage> stages_;
+    // Replaces the last stage of a step and the first of the next one when
+    // they exponentiate the same group
+    std::optional<Stage> bridge_;
+
+    [[nodiscard]] auto isDiagonal(const Stage &stage) const -> bool {
+        return stage.group == groups_.size();
+    }
+
+    [[nodiscard]] auto numGroups() const -> size_t {
+        return groups_.size() + (diag_wires_.empty() ? 0 : 1);
+    }
+
+    /**
+     * @brief Append the stages of the given order for a fraction of the
+     * step, merging consecutive stages of the same group.
+     */
+    void appendStages(size_t order, T fraction) {
+        const auto push = [this](size_t group, T frac) {
+            if (!stages_.empty() && stages_.back().group == group) {
+                stages_.back().fraction += frac;
+            } else {
+                stages_.push_back({group, frac, 0});
+            }
+        };
+        const size_t num_groups = numGroups();
+        if (order == 1) {
+            for (size_t group = 0; group < num_groups; group++) {
+                push(group, fraction);
+            }
+        } else if (order == 2) {
+            for (size_t group = 0; group + 1 < num_groups; group++) {
+                push(group, fraction / 2);
+            }
+            push(num_groups - 1, fraction);
+            for (size_t group = num_groups - 1; group-- > 0;) {
+                push(group, fraction / 2);
+            }
+        } else {
+            const T p = 1 / (4 - std::pow(T{4}, T{1} / (order - 1)));
+            for (const T frac : {p, p, 1 - 4 * p, p, p}) {
+                appendStages(order - 2, frac * fraction);
+            }
+        }
+    }
+
+    /**
+     * @brief Get the index of the diagonal buffer for the fraction of the
+     * step, adding it if needed.
+     */
+    auto diagonalIndex(T fraction) -> size_t {
+        const auto iter = std::find(diag_fractions_.begin(),
+                                    diag_fractions_.end(), fraction);
+        if (iter != diag_fractions_.end()) {
+            return static_cast<size_t>(iter - diag_fractions_.begin());
+        }
+        diag_fractions_.push_back(fraction);
+        return diag_fractions_.size() - 1;
+    }
+
+    /**
+     * @brief Apply @f$e^{-i\tau H_g}@f$ of a group @f$H_g@f$ of several
+     * terms sharing the bit flip mask in a single pass.
+     *
+     * With @f$H_g|i\rangle = a_i|i \oplus x\rangle@f$ and
+     * @f$a_{i \oplus x} = a_i^*@f$, @f$H_g^2 = |a_i|^2@f$ on each pair, so
+     * that @f$e^{-i\tau H_g} = \cos(\tau|a_i|) - i\sin(\tau|a_i|)H_g/|a_i|@f$.
+     */
+    static void applyGroup(ComplexT *arr, size_t num_qubits, const Group &group,
+                           T tau) {
+        const size_t x_mask = group.masks.x_mask;
+        const size_t pivot = static_cast<size_t>(1U)
+                             << (std::bit_width(x_mask) - 1);
+        const size_t length = Util::exp2(num_qubits);
+        const auto &terms = group.terms;
+
+        // clang-format off
+        #if defined(_OPENMP)
+            #pragma omp parallel for schedule(static)
+        #endif
+        // clang-format on
+        for (size_t i0 = 0; i0 < length; i0++) {
+            if ((i0 & pivot) != 0) {
+                continue;
+            }
+            const size_t i1 = i0 ^ x_mask;
+            ComplexT a0{0.0, 0.0};
+            for (const auto &[z_mask, coeff] : terms) {
+                a0 += ((std::popcount(i0 & z_mask) & 1U) == 0) ? coeff
+                                                                : -coeff;
+            }
+            const T norm = std::abs(a0);
+            const T c = std::cos(tau * norm);
+            const T sinc = (norm == 0) ? tau : std::sin(tau * norm) / norm;
+            const ComplexT v0 = arr[i0];
+            const ComplexT v1 = arr[i1];
+            arr[i0] = c * v0 + ComplexT{0, -sinc} * std::conj(a0) * v1;
+            arr[i1] = c * v1 + ComplexT{0, -sinc} * a0 * v0;
+        }
+    }
+
+    template <class Derived>
+    void applyStage(StateVectorCPU<T, Derived> &sv, const Stage &stage,
+                    T delta) const {
+        if (isDiagonal(stage)) {
+            sv.applyDiagonal(diagonals_[stage.diag_idx].data(), diag_wires_);
+            return;
+        }
+        const Group &group = groups_[stage.group];
+        const T tau = stage.fraction * delta;
+        if (group.terms.size() == 1) {
+            // e^{-i tau c P} is the Pauli rotation by 2 tau c
+            Gates::GateImplementationsLM::applyPauliRot<T, T>(
+                sv.getData(), num_qubits_, group.masks, false,
+                2 * tau * group.coeff);
+        } else {
+            applyGroup(sv.getData(), num_qubits_, group, tau);
+        }
+    }
+
+  public:
+    /**
+     * @brief Construct a TrotterEvolution.
+     *
+     * @param hamiltonian Hamiltonian @f$H@f$.
+     * @param num_qubits Number of qubits of the statevectors to evolve.
+     * @param order Order of the product formula, 1 or a positive even
+     * number.
+     */
+    TrotterEvolution(const PauliSum<T> &hamiltonian, size_t num_qubits,
+                     size_t order = 2)
+        : num_qubits_{num_qubits} {
+        PL_ABORT_IF(order == 0 || (order != 1 && order % 2 != 0),
+                    "The order of the product formula must be 1 or a "
+                    "positive even number.");
+        constexpr std::array<ComplexT, 4> i_pow{
+            ComplexT{1.0, 0.0}, ComplexT{0.0, 1.0}, ComplexT{-1.0, 0.0},
+            ComplexT{0.0, -1.0}};
+
+        std::map<size_t, size_t> group_idx;
+        std::vector<size_t> diag_terms;
+        for (size_t t = 0; t < hamiltonian.getSize(); t++) {
+            const T coeff = hamiltonian.getCoeffs()[t];
+            const auto masks =
+                Gates::pauliWordMasks(num_qubits, hamiltonian.getWires()[t],
+                                      hamiltonian.getWords()[t]);
+            if (masks.x_mask == 0) {
+                diag_terms.push_back(t);
+                continue;
+            }
+            const auto [iter, inserted] =
+                group_idx.emplace(masks.x_mask, groups_.size());
+            if (inserted) {
+                groups_.push_back({masks, coeff, {}});
+            }
+            groups_[iter->second].terms.emplace_back(
+                masks.z_mask, coeff * i_pow[masks.num_y % 4]);
+        }
+
+        if (!diag_terms.empty()) {
+            // Cost of the diagonal terms over the wires they act on
+            std::vector<size_t> wire_pos(num_qubits, num_qubits);
+            std::vector<std::vector<size_t>> z_terms(diag_terms.size());
+            std::vector<T> weights;
+            for (size_t k = 0; k < diag_terms.size(); k++) {
+                const auto &word = hamiltonian.getWords()[diag_terms[k]];
+                const auto &wires = hamiltonian.getWires()[diag_terms[k]];
+                for (size_t w = 0; w < wires.size(); w++) {
+                    if (word[w] != 'Z') {
+                        continue;
+                    }
+                    if (wire_pos[wires[w]] == num_qubits) {
+                        wire_pos[wires[w]] = diag_wires_.size();
+                        diag_wires_.push_back(wires[w]);
+                    }
+                    z_terms[k].push_back(wire_pos[wires[w]]);
+                }
+                weights.push_back(hamiltonian.getCoeffs()[diag_terms[k]]);
+            }
+            // Identity terms only contribute a global phase
+            if (diag_wires_.empty()) {
+                diag_wires_.push_back(0);
+            }
+            diag_cost_ =
+                Gates::pauliZCost<T>(diag_wires_.size(), z_terms, weights);
+        }
+
+        if (numGroups() == 0) {
+            return;
+        }
+        appendStages(order, 1);
+        if (stages_.size() > 1 &&
+            stages_.front().group == stages_.back().group) {
+            bridge_ = Stage{stages_.front().group,
+                            stages_.front().fraction + stages_.back().fraction,
+                            0};
+        }
+        for (auto &stage : stages_) {
+            if (isDiagonal(stage)) {
+                stage.diag_idx = diagonalIndex(stage.fraction);
+            }
+        }
+        if (bridge_ && isDiagonal(*bridge_)) {
+            bridge_->diag_idx = diagonalIndex(bridge_->fraction);
+        }
+        diagonals_.assign(diag_fractions_.size(),
+                          std::vector<ComplexT>(diag_cost_.size()));
+    }
+
+    /**
+     * @brief Get the number of passes over the statevector of a single
+     * step.
+     */
+    [[nodiscard]] auto getNumStages() const -> size_t {
+        return stages_.size();
+    }
+
+    /**
+     * @brief Evolve the statevector for the time @f$t@f$ in the given number
+     * of steps.
+     *
+     * @param sv Statevector to be updated.
+     * @param time Time @f$t@f$.
+     * @param num_steps Number of steps.
+     */
+    template <class Derived>
+    void evolve(StateVectorCPU<T, Derived> &sv, T time, size_t num_steps) {
+        PL_ABORT_IF(sv.getNumQubits() != num_qubits_,
+                    "The number of qubits of the statevector does not match "
+                    "the Hamiltonian.");
+        PL_ABORT_IF(num_steps == 0, "The number of steps must be positive.");
+        if (stages_.empty()) {
+            return;
+        }
+        const T delta = time / static_cast<T>(num_steps);
+        for (size_t idx = 0; idx < diag_fractions_.size(); idx++) {
+            const T gamma = diag_fractions_[idx] * delta;
+            std::transform(diag_cost_.begin(), diag_cost_.end(),
+                           diagonals_[idx].begin(), [gamma](T cost) {
+                               return std::polar(T{1.0}, -gamma * cost);
+                           });
+        }
+
+        // The group kernels index the data by the logical wires
+        sv.canonicalizeWires();
+        const size_t num_stages = stages_.size();
+        for (size_t step = 0; step < num_steps; step++) {
+            const bool bridge_in = bridge_ && step > 0;
+            const bool bridge_out = bridge_ && step + 1 < num_steps;
+            if (bridge_in) {
+                applyStage(sv, *bridge_, delta);
+            }
+            for (size_t idx = bridge_in ? 1 : 0;
+                 idx < num_stages - (bridge_out ? 1 : 0); idx++) {
+                applyStage(sv, stages_[idx], delta);
+            }
+        }
+    }
+};
+} // namespace Pennylane
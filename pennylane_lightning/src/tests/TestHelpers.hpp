@@ -312,6 +312,48 @@ auto createParams(Gates::GateOperation op) -> std::vector<PrecisionT> {
     return {};
 }
 
+/**
+ * @brief Call a function for each gate operation, e.g. to compare the gates
+ * of a statevector with those of StateVectorManagedCPU.
+ *
+ * The function is called with the name of the gate, its wires, and a
+ * function drawing random parameters for the gate. Multi-qubit gates act on
+ * 3 wires. The wires of a gate are taken in turn from all_wires, starting
+ * at an offset which grows by wire_shift with each gate.
+ *
+ * @tparam PrecisionT Floating point precision of the parameters.
+ * @param re Random engine.
+ * @param all_wires Wires the wires of the gates are taken from.
+ * @param func Function to call.
+ * @param wire_shift Growth of the offset of the wires with each gate.
+ */
+template <class PrecisionT, class RandomEngine, class Func>
+void forEachGateOperation(RandomEngine &re,
+                          const std::vector<size_t> &all_wires, Func &&func,
+                          size_t wire_shift = 0) {
+    std::uniform_real_distribution<PrecisionT> param_dist(-M_PI, M_PI);
+    size_t offset = 0;
+    Util::for_each_enum<Gates::GateOperation>(
+        [&](Gates::GateOperation gate_op) {
+            const auto gate_name = std::string(
+                Util::lookup(Gates::Constant::gate_names, gate_op));
+            const size_t num_wires = createWires(gate_op, 3).size();
+            std::vector<size_t> wires(num_wires);
+            for (size_t k = 0; k < num_wires; k++) {
+                wires[k] = all_wires[(offset + k) % all_wires.size()];
+            }
+            offset += wire_shift;
+            const auto draw_params = [&]() {
+                auto params = createParams<PrecisionT>(gate_op);
+                for (auto &param : params) {
+                    param = param_dist(re);
+                }
+                return params;
+            };
+            func(gate_name, wires, draw_params);
+        });
+}
+
 /**
  * @brief Initialize the statevector in a non-trivial configuration.
  *
@@ -8,12 +8,40 @@
 #include "Macros.hpp"
 #include "TypeList.hpp"
 
+#include "cpu_kernels/GateImplementationsAVX2.hpp"
+#include "cpu_kernels/GateImplementationsAVX512.hpp"
 #include "cpu_kernels/GateImplementationsLM.hpp"
+#include "cpu_kernels/GateImplementationsNEON.hpp"
 #include "cpu_kernels/GateImplementationsPI.hpp"
+#include "cpu_kernels/GateImplementationsParallelLM.hpp"
 
+#if defined(PL_USE_AVX512F)
 using TestKernels =
     Pennylane::Util::TypeList<Pennylane::Gates::GateImplementationsLM,
-                              Pennylane::Gates::GateImplementationsPI, void>;
+                              Pennylane::Gates::GateImplementationsPI,
+                              Pennylane::Gates::GateImplementationsParallelLM,
+                              Pennylane::Gates::GateImplementationsAVX2,
+                              Pennylane::Gates::GateImplementationsAVX512,
+                              void>;
+#elif defined(PL_USE_AVX2)
+using TestKernels =
+    Pennylane::Util::TypeList<Pennylane::Gates::GateImplementationsLM,
+                              Pennylane::Gates::GateImplementationsPI,
+                              Pennylane::Gates::GateImplementationsParallelLM,
+                              Pennylane::Gates::GateImplementationsAVX2, void>;
+#elif defined(PL_USE_NEON)
+using TestKernels =
+    Pennylane::Util::TypeList<Pennylane::Gates::GateImplementationsLM,
+                              Pennylane::Gates::GateImplementationsPI,
+                              Pennylane::Gates::GateImplementationsParallelLM,
+                              Pennylane::Gates::GateImplementationsNEON, void>;
+#else
+using TestKernels =
+    Pennylane::Util::TypeList<Pennylane::Gates::GateImplementationsLM,
+                              Pennylane::Gates::GateImplementationsPI,
+                              Pennylane::Gates::GateImplementationsParallelLM,
+                              void>;
+#endif
 
 namespace detail {
 template <size_t... Is>
@@ -3,6 +3,8 @@
 #include <complex>
 #include <iostream>
 #include <limits>
+#include <numeric>
+#include <random>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -11,8 +13,10 @@
 #include <catch2/catch.hpp>
 
 #include "AdjointDiff.hpp"
+#include "Measures.hpp"
 #include "StateVectorRawCPU.hpp"
 #include "Util.hpp"
+#include "WorkerPool.hpp"
 
 #include "TestHelpers.hpp"
 
@@ -37,6 +41,44 @@ TEMPLATE_TEST_CASE("AdjointJacobian::AdjointJacobian", "[AdjointJacobian]",
     }
 }
 
+TEMPLATE_TEST_CASE("CompiledOps::apply", "[AdjointJacobian]", float,
+                   double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 3;
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "CNOT", "Toffoli", "RZ", "SWAP"},
+        {{0.3}, {}, {}, {-0.7}, {}}, {{0}, {0, 1}, {0, 1, 2}, {2}, {1, 2}},
+        {false, false, false, true, false});
+
+    std::mt19937_64 re{1337};
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    StateVectorManagedCPU<PrecisionT> expected(init_state.data(),
+                                               init_state.size());
+    expected.applyOperations(ops.getOpsName(), ops.getOpsWires(),
+                             ops.getOpsInverses(), ops.getOpsParams());
+
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    const CompiledOps<PrecisionT> compiled(ops, sv);
+    REQUIRE(&compiled.getOps() == &ops);
+    for (size_t op_idx = 0; op_idx < ops.getSize(); op_idx++) {
+        compiled.apply(sv, op_idx);
+    }
+    CHECK(sv.getDataVector() == approx(expected.getDataVector()));
+
+    for (size_t op_idx = ops.getSize(); op_idx-- > 0;) {
+        compiled.apply(sv, op_idx, true);
+    }
+    CHECK(sv.getDataVector() == approx(init_state));
+
+    SECTION("Operations which are not gates are applied by name") {
+        const auto unknown =
+            OpsData<PrecisionT>({"QubitStateVector"}, {{}}, {{0}}, {false});
+        const CompiledOps<PrecisionT> compiled_unknown(unknown, sv);
+        REQUIRE_THROWS(compiled_unknown.apply(sv, 0));
+    }
+}
+
 TEST_CASE("AdjointJacobian::adjointJacobian Op=RX, Obs=Z",
           "[AdjointJacobian]") {
     AdjointJacobian<double> adj;
@@ -339,6 +381,147 @@ TEST_CASE("AdjointJacobian::adjointJacobian Decomposed Rot gate, non "
         }
     }
 }
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian Rot and CRot gates",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    AdjointJacobian<PrecisionT> adj;
+    const size_t num_qubits = 2;
+    const std::vector<PrecisionT> rot{0.3, -1.2, 0.7};
+    const std::vector<PrecisionT> crot{-0.4, 0.9, 1.6};
+    const std::vector<ObsDatum<PrecisionT>> obs{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX"}, {{}}, {{1}})};
+
+    const auto jacobian = [&](const OpsData<PrecisionT> &ops,
+                              const std::vector<size_t> &tp) {
+        std::vector<std::complex<PrecisionT>> cdata(Util::exp2(num_qubits));
+        cdata[0] = {1, 0};
+        StateVectorRawCPU<PrecisionT> psi(cdata.data(), cdata.size());
+        const JacobianData<PrecisionT> tape{
+            tp.size(), psi.getLength(), psi.getData(), obs, ops, tp};
+        std::vector<PrecisionT> jac(tp.size() * obs.size(), 0);
+        adj.adjointJacobian(jac, tape, true);
+        return jac;
+    };
+
+    for (const bool inverse : {false, true}) {
+        DYNAMIC_SECTION("inverse = " << inverse) {
+            const auto ops = OpsData<PrecisionT>(
+                {"RX", "Hadamard", "Rot", "CRot", "RY"},
+                {{0.5}, {}, rot, crot, {0.2}}, {{0}, {1}, {0}, {0, 1}, {1}},
+                {false, false, inverse, inverse, false});
+            // The inverse applies the inverse gates in the reverse order, so
+            // the parameters of the decomposition are reversed
+            const auto order = [inverse](const std::vector<PrecisionT> &p) {
+                return inverse ? std::vector<PrecisionT>{p[2], p[1], p[0]}
+                               : p;
+            };
+            const auto rot_params = order(rot);
+            const auto crot_params = order(crot);
+            const auto decomposed = OpsData<PrecisionT>(
+                {"RX", "Hadamard", "RZ", "RY", "RZ", "CRZ", "CRY", "CRZ",
+                 "RY"},
+                {{0.5},
+                 {},
+                 {rot_params[0]},
+                 {rot_params[1]},
+                 {rot_params[2]},
+                 {crot_params[0]},
+                 {crot_params[1]},
+                 {crot_params[2]},
+                 {0.2}},
+                {{0}, {1}, {0}, {0}, {0}, {0, 1}, {0, 1}, {0, 1}, {1}},
+                {false, false, inverse, inverse, inverse, inverse, inverse,
+                 inverse, false});
+            // Parameter of the decomposition for each parameter of ops
+            const std::vector<size_t> param_map =
+                inverse ? std::vector<size_t>{0, 3, 2, 1, 6, 5, 4, 7}
+                        : std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7};
+
+            for (const std::vector<size_t> &tp :
+                 {std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7},
+                  std::vector<size_t>{2, 4, 6}}) {
+                std::vector<size_t> tp_decomposed;
+                for (const size_t param : tp) {
+                    tp_decomposed.push_back(param_map[param]);
+                }
+                std::sort(tp_decomposed.begin(), tp_decomposed.end());
+                const auto jac = jacobian(ops, tp);
+                const auto expected = jacobian(decomposed, tp_decomposed);
+                for (size_t i = 0; i < tp.size(); i++) {
+                    const auto row = static_cast<size_t>(
+                        std::find(tp_decomposed.begin(), tp_decomposed.end(),
+                                  param_map[tp[i]]) -
+                        tp_decomposed.begin());
+                    for (size_t obs_idx = 0; obs_idx < obs.size();
+                         obs_idx++) {
+                        CHECK(jac[obs_idx * tp.size() + i] ==
+                              Approx(expected[obs_idx * tp.size() + row])
+                                  .margin(1e-5));
+                    }
+                }
+            }
+        }
+    }
+}
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian matrix operations",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexT = std::complex<PrecisionT>;
+    AdjointJacobian<PrecisionT> adj;
+    const size_t num_qubits = 2;
+    const PrecisionT theta = 0.7;
+    const std::vector<ObsDatum<PrecisionT>> obs{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliY"}, {{}}, {{1}})};
+
+    const auto jacobian = [&](const OpsData<PrecisionT> &ops) {
+        std::vector<ComplexT> cdata(Util::exp2(num_qubits));
+        cdata[0] = {1, 0};
+        StateVectorRawCPU<PrecisionT> psi(cdata.data(), cdata.size());
+        const std::vector<size_t> tp{0, 1};
+        const JacobianData<PrecisionT> tape{
+            tp.size(), psi.getLength(), psi.getData(), obs, ops, tp};
+        std::vector<PrecisionT> jac(tp.size() * obs.size(), 0);
+        adj.adjointJacobian(jac, tape, true);
+        return jac;
+    };
+
+    const PrecisionT inv_sqrt2 = INVSQRT2<PrecisionT>();
+    const std::vector<ComplexT> hadamard{
+        {inv_sqrt2, 0}, {inv_sqrt2, 0}, {inv_sqrt2, 0}, {-inv_sqrt2, 0}};
+    const PrecisionT c = std::cos(theta / 2);
+    const PrecisionT s = std::sin(theta / 2);
+    // RX(theta) = exp(i theta G) with G = -X / 2
+    const std::vector<ComplexT> rx{{c, 0}, {0, -s}, {0, -s}, {c, 0}};
+    const std::vector<ComplexT> rx_gen{{0, 0}, {-0.5, 0}, {-0.5, 0}, {0, 0}};
+
+    for (const bool inverse : {false, true}) {
+        DYNAMIC_SECTION("inverse = " << inverse) {
+            const auto gates = OpsData<PrecisionT>(
+                {"RY", "Hadamard", "RX", "CNOT"}, {{0.4}, {}, {theta}, {}},
+                {{0}, {1}, {1}, {1, 0}}, {false, false, inverse, false});
+            const auto matrices = OpsData<PrecisionT>(
+                {"RY", "QubitUnitary", "QubitUnitary", "CNOT"},
+                {{0.4}, {}, {theta}, {}}, {{0}, {1}, {1}, {1, 0}},
+                {false, false, inverse, false}, {{}, hadamard, rx, {}},
+                {{}, {}, rx_gen, {}});
+            const auto expected = jacobian(gates);
+            const auto jac = jacobian(matrices);
+            for (size_t i = 0; i < jac.size(); i++) {
+                CHECK(jac[i] == Approx(expected[i]).margin(1e-5));
+            }
+        }
+    }
+
+    SECTION("Invalid generators") {
+        const auto ops = OpsData<PrecisionT>(
+            {"QubitUnitary"}, {{theta}}, {{1}}, {false}, {rx},
+            {std::vector<ComplexT>(rx_gen.begin(), rx_gen.end() - 1)});
+        REQUIRE_THROWS_WITH(jacobian(ops),
+                            Catch::Contains("A generator requires"));
+    }
+}
 TEST_CASE("AdjointJacobian::adjointJacobian Mixed Ops, Obs and TParams",
           "[AdjointJacobian]") {
     AdjointJacobian<double> adj;
@@ -392,6 +575,141 @@ TEST_CASE("AdjointJacobian::adjointJacobian Mixed Ops, Obs and TParams",
     }
 }
 
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian Op=CostLayer",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    const size_t num_qubits = 3;
+    const PrecisionT gamma = 0.43;
+    const PrecisionT beta = -0.71;
+    const std::vector<PrecisionT> weights{0.6, -1.3};
+
+    // Cost of the edges (0, 1) and (1, 2)
+    const auto cost = Gates::pauliZCost<PrecisionT>(num_qubits,
+                                                    {{0, 1}, {1, 2}}, weights);
+    const std::vector<std::vector<ComplexPrecisionT>> no_matrices(6);
+
+    const std::vector<ObsDatum<PrecisionT>> obs{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX"}, {{}}, {{2}})};
+    const size_t num_obs = obs.size();
+
+    std::vector<ComplexPrecisionT> init_state(Util::exp2(num_qubits));
+    init_state[0] = 1.0;
+
+    for (const bool inverse : {false, true}) {
+        const OpsData<PrecisionT> ops(
+            {"Hadamard", "Hadamard", "Hadamard", "CostLayer", "RX", "RX"},
+            {{}, {}, {}, {gamma}, {beta}, {beta}},
+            {{0}, {1}, {2}, {0, 1, 2}, {0}, {2}},
+            {false, false, false, inverse, false, false}, no_matrices,
+            no_matrices, {{}, {}, {}, cost, {}, {}});
+        // exp(-i gamma w ZZ) is IsingZZ(2 gamma w)
+        const OpsData<PrecisionT> ref_ops(
+            {"Hadamard", "Hadamard", "Hadamard", "IsingZZ", "IsingZZ", "RX",
+             "RX"},
+            {{},
+             {},
+             {},
+             {2 * gamma * weights[0]},
+             {2 * gamma * weights[1]},
+             {beta},
+             {beta}},
+            {{0}, {1}, {2}, {0, 1}, {1, 2}, {0}, {2}},
+            {false, false, false, inverse, inverse, false, false});
+
+        AdjointJacobian<PrecisionT> adj;
+        std::vector<PrecisionT> jac(3 * num_obs);
+        adj.adjointJacobian(jac,
+                            JacobianData<PrecisionT>{3, init_state.size(),
+                                                     init_state.data(), obs,
+                                                     ops, {0, 1, 2}},
+                            true);
+        std::vector<PrecisionT> ref_jac(4 * num_obs);
+        adj.adjointJacobian(ref_jac,
+                            JacobianData<PrecisionT>{4, init_state.size(),
+                                                     init_state.data(), obs,
+                                                     ref_ops, {0, 1, 2, 3}},
+                            true);
+
+        // The results are in the observable-major order
+        for (size_t obs_idx = 0; obs_idx < num_obs; obs_idx++) {
+            const auto *row = jac.data() + 3 * obs_idx;
+            const auto *ref_row = ref_jac.data() + 4 * obs_idx;
+            const PrecisionT expected =
+                2 * weights[0] * ref_row[0] + 2 * weights[1] * ref_row[1];
+            CHECK(row[0] == Approx(expected).margin(1e-5));
+            CHECK(row[1] == Approx(ref_row[2]).margin(1e-5));
+            CHECK(row[2] == Approx(ref_row[3]).margin(1e-5));
+        }
+    }
+
+    SECTION("The cost is required") {
+        const OpsData<PrecisionT> ops({"CostLayer"}, {{gamma}}, {{0, 1, 2}},
+                                      {false});
+        StateVectorManagedCPU<PrecisionT> sv(num_qubits);
+        PL_CHECK_THROWS_MATCHES(CompiledOps<PrecisionT>(ops, sv),
+                                Util::LightningException,
+                                "requires the diagonal of the cost operator");
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian Op=PauliRot",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 3;
+    const PrecisionT theta = 0.43;
+    const PrecisionT beta = -0.71;
+    const std::vector<std::vector<std::complex<PrecisionT>>> no_matrices(4);
+
+    const std::vector<ObsDatum<PrecisionT>> obs{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX"}, {{}}, {{2}})};
+    const size_t num_obs = obs.size();
+
+    std::vector<std::complex<PrecisionT>> init_state(Util::exp2(num_qubits));
+    init_state[0] = 1.0;
+
+    for (const bool inverse : {false, true}) {
+        const OpsData<PrecisionT> ops(
+            {"RX", "Hadamard", "PauliRot", "RY"}, {{beta}, {}, {theta}, {beta}},
+            {{0}, {2}, {0, 1, 2}, {1}}, {false, false, inverse, false},
+            no_matrices, no_matrices, {}, {"", "", "XZY", ""});
+        // Rotate X to Z by H, and Y to Z by H S^dagger
+        const OpsData<PrecisionT> ref_ops(
+            {"RX", "Hadamard", "Hadamard", "S", "Hadamard", "MultiRZ",
+             "Hadamard", "S", "Hadamard", "RY"},
+            {{beta}, {}, {}, {}, {}, {theta}, {}, {}, {}, {beta}},
+            {{0}, {2}, {0}, {2}, {2}, {0, 1, 2}, {2}, {2}, {0}, {1}},
+            {false, false, false, true, false, inverse, false, false, false,
+             false});
+
+        AdjointJacobian<PrecisionT> adj;
+        std::vector<PrecisionT> jac(3 * num_obs);
+        adj.adjointJacobian(jac,
+                            JacobianData<PrecisionT>{3, init_state.size(),
+                                                     init_state.data(), obs,
+                                                     ops, {0, 1, 2}},
+                            true);
+        std::vector<PrecisionT> ref_jac(3 * num_obs);
+        adj.adjointJacobian(ref_jac,
+                            JacobianData<PrecisionT>{3, init_state.size(),
+                                                     init_state.data(), obs,
+                                                     ref_ops, {0, 1, 2}},
+                            true);
+        REQUIRE(jac == approx(ref_jac).margin(1e-5));
+    }
+
+    SECTION("The Pauli word is required") {
+        const OpsData<PrecisionT> ops({"PauliRot"}, {{theta}}, {{0, 1, 2}},
+                                      {false});
+        StateVectorManagedCPU<PrecisionT> sv(num_qubits);
+        PL_CHECK_THROWS_MATCHES(CompiledOps<PrecisionT>(ops, sv),
+                                Util::LightningException,
+                                "one letter per wire");
+    }
+}
+
 TEST_CASE("AdjointJacobian::applyObservable visitor checks",
           "[AdjointJacobian]") {
     SECTION("Obs with params 0") {
@@ -477,3 +795,951 @@ TEST_CASE("AdjointJacobian::applyObservable visitor checks",
         }
     }
 }
+
+TEMPLATE_TEST_CASE("AdjointJacobian::applyObservable fused tensor products",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    using ObsT = ObsDatum<PrecisionT>;
+    const size_t num_qubits = 5;
+    std::mt19937 re{1337};
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    const StateVectorManagedCPU<PrecisionT> sv(init_state.data(),
+                                               init_state.size());
+
+    // Hermitian matrices on one and two wires
+    const std::vector<ComplexPrecisionT> herm1{
+        {0.3, 0.0}, {0.1, -0.4}, {0.1, 0.4}, {-0.8, 0.0}};
+    std::vector<ComplexPrecisionT> herm2(16);
+    for (size_t row = 0; row < 4; row++) {
+        herm2[row * 4 + row] = static_cast<PrecisionT>(row) - 1.5F;
+        for (size_t col = row + 1; col < 4; col++) {
+            herm2[row * 4 + col] = {
+                static_cast<PrecisionT>(row + col) * PrecisionT{0.1},
+                static_cast<PrecisionT>(col - row) * PrecisionT{0.2}};
+            herm2[col * 4 + row] = std::conj(herm2[row * 4 + col]);
+        }
+    }
+
+    const std::vector<std::pair<ObsT, bool>> observables{
+        {ObsT({"PauliZ", "PauliX", "PauliY"}, {{}, {}, {}}, {{0}, {3}, {4}}),
+         true},
+        {ObsT({"PauliY", "PauliY", "Identity"}, {}, {{1}, {2}, {0}}), true},
+        {ObsT({"PauliX", "Hadamard", "Hermitian"}, {{}, {}, herm1},
+              {{4}, {0}, {2}}),
+         true},
+        {ObsT({"Hermitian", "PauliZ", "Hermitian"}, {herm2, {}, herm1},
+              {{3, 1}, {0}, {4}}),
+         true},
+        {ObsT({"Hermitian"}, {herm2}, {{2, 0}}), true},
+        // Factors sharing a wire, and parametrised factors, are applied one
+        // after another
+        {ObsT({"PauliX", "PauliZ"}, {}, {{1}, {1}}), false},
+        {ObsT({"RZ", "PauliX"}, {std::vector<PrecisionT>{0.3}, {}},
+              {{0}, {2}}),
+         false},
+    };
+
+    for (const auto &[observable, fusible] : observables) {
+        REQUIRE(fuseObservable(observable, num_qubits).has_value() ==
+                fusible);
+
+        StateVectorManagedCPU<PrecisionT> expected(sv);
+        for (size_t j = 0; j < observable.getSize(); j++) {
+            const auto &name = observable.getObsName()[j];
+            const auto &wires = observable.getObsWires()[j];
+            const auto *matrix =
+                observable.getObsParams().empty()
+                    ? nullptr
+                    : std::get_if<std::vector<ComplexPrecisionT>>(
+                          &observable.getObsParams()[j]);
+            const auto *params =
+                observable.getObsParams().empty()
+                    ? nullptr
+                    : std::get_if<std::vector<PrecisionT>>(
+                          &observable.getObsParams()[j]);
+            if (matrix != nullptr) {
+                expected.applyMatrix(*matrix, wires, false);
+            } else if (params != nullptr) {
+                expected.applyOperation(name, wires, false, *params);
+            } else {
+                expected.applyOperation(name, wires, false);
+            }
+        }
+
+        StateVectorManagedCPU<PrecisionT> out(num_qubits);
+        applyObservable(sv, out, observable);
+        CHECK(out.getDataVector() ==
+              approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    StateVectorManagedCPU<PrecisionT> small(num_qubits - 1);
+    PL_CHECK_THROWS_MATCHES(applyObservable(sv, small, observables[0].first),
+                            Util::LightningException, "incompatible sizes");
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian Obs=PauliSum",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    AdjointJacobian<PrecisionT> adj;
+
+    const size_t num_qubits = 3;
+    const std::vector<PrecisionT> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3,
+                                        M_PI / 3};
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "RY", "CNOT", "RZ", "CRY"},
+        {{param[0]}, {param[1]}, {}, {param[2]}, {param[3]}},
+        {{0}, {1}, {0, 1}, {2}, {1, 2}}, {false, false, false, false, false});
+    const std::vector<size_t> tp{0, 1, 2, 3};
+
+    const std::vector<PrecisionT> coeffs{0.3, -0.7, 1.2, 0.5};
+    const std::vector<std::string> words{"XZ", "Y", "ZZ", "YYX"};
+    const std::vector<std::vector<size_t>> wires{{0, 1}, {2}, {0, 2}, {0, 1, 2}};
+
+    std::vector<std::complex<PrecisionT>> cdata(1U << num_qubits);
+    cdata[0] = std::complex<PrecisionT>{1, 0};
+    StateVectorRawCPU<PrecisionT> psi(cdata.data(), cdata.size());
+
+    // Jacobian of the Hamiltonian
+    std::vector<PrecisionT> jacobian(tp.size(), 0);
+    {
+        const std::vector<ObsDatum<PrecisionT>> obs_ls{
+            ObsDatum<PrecisionT>(PauliSum<PrecisionT>(coeffs, words, wires))};
+        JacobianData<PrecisionT> tape{tp.size(), psi.getLength(),
+                                      psi.getData(), obs_ls, ops, tp};
+        adj.adjointJacobian(jacobian, tape, true);
+    }
+
+    // Jacobian of each term as a tensor product observable
+    std::vector<ObsDatum<PrecisionT>> terms;
+    for (size_t t = 0; t < words.size(); t++) {
+        std::vector<std::string> names;
+        std::vector<typename ObsDatum<PrecisionT>::param_var_t> params;
+        std::vector<std::vector<size_t>> obs_wires;
+        for (size_t k = 0; k < words[t].size(); k++) {
+            names.emplace_back(std::string("Pauli") + words[t][k]);
+            params.emplace_back(std::monostate{});
+            obs_wires.push_back({wires[t][k]});
+        }
+        terms.emplace_back(names, params, obs_wires);
+    }
+    std::vector<PrecisionT> term_jacobian(tp.size() * terms.size(), 0);
+    {
+        JacobianData<PrecisionT> tape{tp.size(), psi.getLength(),
+                                      psi.getData(), terms, ops, tp};
+        adj.adjointJacobian(term_jacobian, tape, true);
+    }
+
+    for (size_t p = 0; p < tp.size(); p++) {
+        PrecisionT expected = 0.0;
+        for (size_t t = 0; t < terms.size(); t++) {
+            expected += coeffs[t] * term_jacobian[t * tp.size() + p];
+        }
+        CHECK(jacobian[p] == Approx(expected).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian Obs=SparseHamiltonian",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexT = std::complex<PrecisionT>;
+    AdjointJacobian<PrecisionT> adj;
+
+    const size_t num_qubits = 3;
+    const size_t length = 1U << num_qubits;
+    const std::vector<PrecisionT> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3,
+                                        M_PI / 3};
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "RY", "CNOT", "RZ", "CRY"},
+        {{param[0]}, {param[1]}, {}, {param[2]}, {param[3]}},
+        {{0}, {1}, {0, 1}, {2}, {1, 2}}, {false, false, false, false, false});
+    const std::vector<size_t> tp{0, 1, 2, 3};
+
+    const PauliSum<PrecisionT> pauli_sum({0.3, -0.7, 1.2, 0.5},
+                                         {"XZ", "Y", "ZZ", "YYX"},
+                                         {{0, 1}, {2}, {0, 2}, {0, 1, 2}});
+
+    // CSR representation of the same Hamiltonian, built column by column
+    std::vector<ComplexT> dense(length * length);
+    for (size_t col = 0; col < length; col++) {
+        std::vector<ComplexT> basis(length, 0.0);
+        std::vector<ComplexT> column(length);
+        basis[col] = 1.0;
+        pauli_sum.apply(basis.data(), column.data(), num_qubits);
+        for (size_t row = 0; row < length; row++) {
+            dense[row * length + col] = column[row];
+        }
+    }
+    std::vector<long> row_map{0};
+    std::vector<long> entries;
+    std::vector<ComplexT> values;
+    for (size_t row = 0; row < length; row++) {
+        for (size_t col = 0; col < length; col++) {
+            if (std::abs(dense[row * length + col]) > 1e-8) {
+                entries.emplace_back(static_cast<long>(col));
+                values.emplace_back(dense[row * length + col]);
+            }
+        }
+        row_map.emplace_back(static_cast<long>(values.size()));
+    }
+
+    std::vector<ComplexT> cdata(length);
+    cdata[0] = ComplexT{1, 0};
+    StateVectorRawCPU<PrecisionT> psi(cdata.data(), cdata.size());
+
+    std::vector<PrecisionT> jacobian(tp.size(), 0);
+    std::vector<PrecisionT> expected(tp.size(), 0);
+    {
+        const std::vector<ObsDatum<PrecisionT>> obs_ls{ObsDatum<PrecisionT>(
+            SparseHamiltonian<PrecisionT>(row_map, entries, values))};
+        REQUIRE(obs_ls[0].getObsWires() ==
+                std::vector<std::vector<size_t>>{{0, 1, 2}});
+        JacobianData<PrecisionT> tape{tp.size(), psi.getLength(),
+                                      psi.getData(), obs_ls, ops, tp};
+        adj.adjointJacobian(jacobian, tape, true);
+    }
+    {
+        const std::vector<ObsDatum<PrecisionT>> obs_ls{
+            ObsDatum<PrecisionT>(pauli_sum)};
+        JacobianData<PrecisionT> tape{tp.size(), psi.getLength(),
+                                      psi.getData(), obs_ls, ops, tp};
+        adj.adjointJacobian(expected, tape, true);
+    }
+    CHECK(jacobian == approx(expected).margin(1e-5));
+
+    SECTION("Invalid arguments") {
+        REQUIRE_THROWS(SparseHamiltonian<PrecisionT>({0, 1, 2}, {0}, {1.0}));
+        REQUIRE_THROWS(
+            SparseHamiltonian<PrecisionT>({0, 1, 2, 3}, {0, 1, 2}, {1, 1, 1}));
+        REQUIRE_THROWS(SparseHamiltonian<PrecisionT>({0, 1, 2}, {0, 2},
+                                                     {1.0, 1.0}));
+
+        // Hamiltonian on 2 qubits measured on 3 qubits
+        const std::vector<ObsDatum<PrecisionT>> obs_ls{
+            ObsDatum<PrecisionT>(SparseHamiltonian<PrecisionT>(
+                {0, 1, 2, 3, 4}, {0, 1, 2, 3}, {1.0, -1.0, 1.0, -1.0}))};
+        JacobianData<PrecisionT> tape{tp.size(), psi.getLength(),
+                                      psi.getData(), obs_ls, ops, tp};
+        REQUIRE_THROWS(adj.adjointJacobian(jacobian, tape, true));
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian with a memory budget",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    AdjointJacobian<PrecisionT> adj;
+
+    const size_t num_qubits = 3;
+    const std::vector<PrecisionT> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "RY", "CNOT", "RZ", "IsingXX"},
+        {{param[0]}, {param[1]}, {}, {param[2]}, {param[0]}},
+        {{0}, {1}, {0, 1}, {2}, {1, 2}}, {false, false, false, true, false});
+    const std::vector<size_t> tp{0, 1, 2, 3};
+
+    const std::vector<ObsDatum<PrecisionT>> obs_ls{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliY"}, {{}, {}}, {{1}, {2}}),
+        ObsDatum<PrecisionT>({"PauliY"}, {{}}, {{2}}),
+        ObsDatum<PrecisionT>(PauliSum<PrecisionT>({0.5, -0.3}, {"XX", "Z"},
+                                                  {{0, 2}, {1}})),
+        ObsDatum<PrecisionT>({"Hadamard"}, {{}}, {{1}})};
+
+    std::vector<std::complex<PrecisionT>> cdata(1U << num_qubits);
+    cdata[0] = std::complex<PrecisionT>{1, 0};
+    StateVectorRawCPU<PrecisionT> psi(cdata.data(), cdata.size());
+    JacobianData<PrecisionT> tape{tp.size(),    psi.getLength(),
+                                  psi.getData(), obs_ls, ops, tp};
+
+    std::vector<PrecisionT> expected(tp.size() * obs_ls.size(), 0);
+    adj.adjointJacobian(expected, tape, true);
+
+    const size_t sv_bytes = psi.getLength() * sizeof(std::complex<PrecisionT>);
+    for (size_t num_sv = 4; num_sv <= obs_ls.size() + 4; num_sv++) {
+        REQUIRE(AdjointJacobian<PrecisionT>::getNumObsPerBatch(
+                    num_qubits, obs_ls.size(), num_sv * sv_bytes) ==
+                std::min(num_sv - 3, obs_ls.size()));
+
+        std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size(), 0);
+        adj.adjointJacobian(jacobian, tape, true, num_sv * sv_bytes);
+        CHECK(jacobian == approx(expected).margin(1e-5));
+    }
+
+    SECTION("Memory budget too small") {
+        std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size(), 0);
+        REQUIRE_THROWS_WITH(
+            adj.adjointJacobian(jacobian, tape, true, 3 * sv_bytes),
+            Catch::Contains("memory budget is too small"));
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian with a forward state",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    AdjointJacobian<PrecisionT> adj;
+
+    const size_t num_qubits = 3;
+    const std::vector<PrecisionT> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "RY", "CNOT", "RZ", "IsingXX"},
+        {{param[0]}, {param[1]}, {}, {param[2]}, {param[0]}},
+        {{0}, {1}, {0, 1}, {2}, {1, 2}}, {false, false, false, true, false});
+    const std::vector<size_t> tp{0, 1, 2, 3};
+
+    const std::vector<ObsDatum<PrecisionT>> obs_ls{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliY"}, {{}, {}}, {{1}, {2}}),
+        ObsDatum<PrecisionT>({"Hadamard"}, {{}}, {{1}})};
+
+    std::vector<std::complex<PrecisionT>> cdata(1U << num_qubits);
+    cdata[0] = std::complex<PrecisionT>{1, 0};
+    JacobianData<PrecisionT> tape{tp.size(), cdata.size(), cdata.data(),
+                                  obs_ls,    ops,          tp};
+
+    std::vector<PrecisionT> expected(tp.size() * obs_ls.size(), 0);
+    adj.adjointJacobian(expected, tape, true);
+
+    // The forward state of the tape
+    StateVectorManagedCPU<PrecisionT> forward(cdata.data(), cdata.size());
+    forward.applyOperations(ops.getOpsName(), ops.getOpsWires(),
+                            ops.getOpsInverses(), ops.getOpsParams());
+
+    SECTION("Caller-owned state") {
+        StateVectorManagedCPU<PrecisionT> sv(forward.getDataVector().data(),
+                                             forward.getLength());
+        JacobianData<PrecisionT> sv_tape{tp.size(), sv, obs_ls, ops, tp};
+        REQUIRE(sv_tape.getStateVec() == &sv);
+        REQUIRE(sv_tape.getPtrStateVec() == sv.getData());
+
+        std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size(), 0);
+        adj.adjointJacobian(jacobian, sv_tape, false);
+        CHECK(jacobian == approx(expected).margin(1e-5));
+        // The state is used as the working state
+        CHECK(sv.getDataVector() != forward.getDataVector());
+    }
+
+    SECTION("Caller-owned initial state") {
+        StateVectorManagedCPU<PrecisionT> sv(cdata.data(), cdata.size());
+        JacobianData<PrecisionT> sv_tape{tp.size(), sv, obs_ls, ops, tp};
+
+        std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size(), 0);
+        adj.adjointJacobian(jacobian, sv_tape, true);
+        CHECK(jacobian == approx(expected).margin(1e-5));
+    }
+
+    SECTION("Moved-in state with a memory budget") {
+        StateVectorManagedCPU<PrecisionT> sv(forward.getDataVector().data(),
+                                             forward.getLength());
+        JacobianData<PrecisionT> sv_tape{tp.size(), std::move(sv), obs_ls,
+                                         ops, tp};
+        REQUIRE(sv_tape.getStateVec() != nullptr);
+        REQUIRE(sv_tape.getPtrStateVec() == sv_tape.getStateVec()->getData());
+
+        const size_t sv_bytes =
+            forward.getLength() * sizeof(std::complex<PrecisionT>);
+        std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size(), 0);
+        adj.adjointJacobian(jacobian, sv_tape, false, 5 * sv_bytes);
+        CHECK(jacobian == approx(expected).margin(1e-5));
+    }
+
+    SECTION("Moved-in state with adjointVJP") {
+        StateVectorManagedCPU<PrecisionT> sv(forward.getDataVector().data(),
+                                             forward.getLength());
+        JacobianData<PrecisionT> sv_tape{tp.size(), std::move(sv), obs_ls,
+                                         ops, tp};
+        const std::vector<PrecisionT> dy{0.5, -1.0, 2.0};
+
+        std::vector<PrecisionT> vjp(tp.size(), 0);
+        adj.adjointVJP(vjp, sv_tape, dy, false);
+        for (size_t param_idx = 0; param_idx < tp.size(); param_idx++) {
+            PrecisionT sum = 0;
+            for (size_t obs_idx = 0; obs_idx < obs_ls.size(); obs_idx++) {
+                sum += dy[obs_idx] * expected[obs_idx * tp.size() + param_idx];
+            }
+            CHECK(vjp[param_idx] == Approx(sum).margin(1e-5));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian with checkpoints",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+
+    SECTION("getNumCheckpointStates") {
+        using AdjT = AdjointJacobian<PrecisionT>;
+        REQUIRE(AdjT::getNumCheckpointStates(10, 0) == 0);
+        REQUIRE(AdjT::getNumCheckpointStates(0, 3) == 0);
+        REQUIRE(AdjT::getNumCheckpointStates(10, 1) == 10);
+        REQUIRE(AdjT::getNumCheckpointStates(10, 3) == 6);
+        REQUIRE(AdjT::getNumCheckpointStates(9, 3) == 5);
+        REQUIRE(AdjT::getNumCheckpointStates(4, 10) == 4);
+    }
+
+    const size_t num_qubits = 3;
+    const size_t num_layers = 4;
+    std::vector<std::string> ops_name;
+    std::vector<std::vector<PrecisionT>> ops_params;
+    std::vector<std::vector<size_t>> ops_wires;
+    std::vector<bool> ops_inverses;
+    for (size_t layer = 0; layer < num_layers; layer++) {
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            const auto angle =
+                static_cast<PrecisionT>(0.3 + 0.7 * layer + 0.2 * wire);
+            ops_name.emplace_back((wire % 2 == 0) ? "RX" : "RY");
+            ops_params.push_back({angle});
+            ops_wires.push_back({wire});
+            ops_inverses.push_back(layer % 2 == 1);
+        }
+        ops_name.emplace_back("CNOT");
+        ops_params.emplace_back();
+        ops_wires.push_back({layer % num_qubits, (layer + 1) % num_qubits});
+        ops_inverses.push_back(false);
+    }
+    const auto ops =
+        OpsData<PrecisionT>(ops_name, ops_params, ops_wires, ops_inverses);
+    std::vector<size_t> tp(ops.getNumParOps());
+    std::iota(tp.begin(), tp.end(), 0);
+
+    const std::vector<ObsDatum<PrecisionT>> obs_ls{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliY"}, {{}, {}}, {{1}, {2}})};
+
+    std::vector<std::complex<PrecisionT>> cdata(1U << num_qubits);
+    cdata[0] = std::complex<PrecisionT>{1, 0};
+    JacobianData<PrecisionT> tape{tp.size(), cdata.size(), cdata.data(),
+                                  obs_ls,    ops,          tp};
+
+    AdjointJacobian<PrecisionT> adj;
+    REQUIRE(adj.getCheckpointInterval() == 0);
+    std::vector<PrecisionT> expected(tp.size() * obs_ls.size(), 0);
+    adj.adjointJacobian(expected, tape, true);
+
+    const size_t num_ops = ops_name.size();
+    for (size_t interval : {size_t{1}, size_t{3}, size_t{4}, num_ops,
+                            num_ops + 5}) {
+        adj.setCheckpointInterval(interval);
+        REQUIRE(adj.getCheckpointInterval() == interval);
+
+        std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size(), 0);
+        adj.adjointJacobian(jacobian, tape, true);
+        CHECK(jacobian == approx(expected).margin(1e-5));
+
+        const size_t sv_bytes = cdata.size() * sizeof(std::complex<PrecisionT>);
+        std::vector<PrecisionT> batched(tp.size() * obs_ls.size(), 0);
+        adj.adjointJacobian(batched, tape, true, 4 * sv_bytes);
+        CHECK(batched == approx(expected).margin(1e-5));
+
+        std::vector<PrecisionT> vjp(tp.size(), 0);
+        adj.adjointVJP(vjp, tape, {1.0, -0.5}, true);
+        for (size_t param_idx = 0; param_idx < tp.size(); param_idx++) {
+            CHECK(vjp[param_idx] ==
+                  Approx(expected[param_idx] -
+                         0.5 * expected[tp.size() + param_idx])
+                      .margin(1e-5));
+        }
+    }
+
+    SECTION("Checkpoints are returned to the buffer pool") {
+        Util::BufferPool pool;
+        adj.setBufferPool(&pool);
+        adj.setCheckpointInterval(3);
+        std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size(), 0);
+        adj.adjointJacobian(jacobian, tape, true);
+        CHECK(jacobian == approx(expected).margin(1e-5));
+
+        const size_t cached_bytes = pool.cachedBytes();
+        const size_t sv_bytes = cdata.size() * sizeof(std::complex<PrecisionT>);
+        using AdjT = AdjointJacobian<PrecisionT>;
+        REQUIRE(cached_bytes >=
+                AdjT::getNumCheckpointStates(num_ops, 3) * sv_bytes);
+        for (size_t iter = 0; iter < 2; iter++) {
+            std::fill(jacobian.begin(), jacobian.end(), PrecisionT{0});
+            adj.adjointJacobian(jacobian, tape, true);
+            CHECK(jacobian == approx(expected).margin(1e-5));
+            REQUIRE(pool.cachedBytes() == cached_bytes);
+        }
+        adj.setBufferPool(&Util::BufferPool::global());
+    }
+
+    SECTION("Checkpoints are not used for a given final state") {
+        std::vector<std::complex<PrecisionT>> final_state(cdata);
+        StateVectorRawCPU<PrecisionT> sv(final_state.data(),
+                                         final_state.size());
+        sv.applyOperations(ops_name, ops_wires, ops_inverses, ops_params);
+        JacobianData<PrecisionT> final_tape{tp.size(), final_state.size(),
+                                            final_state.data(), obs_ls,
+                                            ops, tp};
+        adj.setCheckpointInterval(2);
+        std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size(), 0);
+        adj.adjointJacobian(jacobian, final_tape, false);
+        CHECK(jacobian == approx(expected).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian with a buffer pool",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 3;
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "RY", "CNOT", "RZ"}, {{0.4}, {-0.7}, {}, {1.1}},
+        {{0}, {1}, {0, 1}, {2}}, {false, false, false, true});
+    const std::vector<size_t> tp{0, 1, 2};
+    const std::vector<ObsDatum<PrecisionT>> obs_ls{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX"}, {{}}, {{1}}),
+        ObsDatum<PrecisionT>({"PauliY"}, {{}}, {{2}})};
+
+    std::vector<std::complex<PrecisionT>> cdata(1U << num_qubits);
+    cdata[0] = std::complex<PrecisionT>{1, 0};
+    JacobianData<PrecisionT> tape{tp.size(), cdata.size(), cdata.data(),
+                                  obs_ls,    ops,          tp};
+
+    AdjointJacobian<PrecisionT> adj;
+    REQUIRE(adj.getBufferPool() == &Util::BufferPool::global());
+    adj.setBufferPool(nullptr);
+    std::vector<PrecisionT> expected(tp.size() * obs_ls.size(), 0);
+    adj.adjointJacobian(expected, tape, true);
+
+    Util::BufferPool pool;
+    adj.setBufferPool(&pool);
+    std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size(), 0);
+    adj.adjointJacobian(jacobian, tape, true);
+    CHECK(jacobian == approx(expected));
+
+    // Later calls reuse the buffers of the first one
+    const size_t cached_bytes = pool.cachedBytes();
+    REQUIRE(cached_bytes >= (obs_ls.size() + 2) * cdata.size() *
+                                sizeof(std::complex<PrecisionT>));
+    for (size_t iter = 0; iter < 3; iter++) {
+        std::fill(jacobian.begin(), jacobian.end(), PrecisionT{0});
+        adj.adjointJacobian(jacobian, tape, true);
+        CHECK(jacobian == approx(expected));
+        REQUIRE(pool.cachedBytes() == cached_bytes);
+    }
+    adj.setBufferPool(&Util::BufferPool::global());
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::computeExpvals", "[AdjointJacobian]",
+                   float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 3;
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "RY", "CNOT", "RZ"}, {{0.4}, {-0.7}, {}, {1.1}},
+        {{0}, {1}, {0, 1}, {2}}, {false, false, false, true});
+    const std::vector<size_t> tp{0, 1, 2};
+    const std::vector<ObsDatum<PrecisionT>> obs_ls{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliZ"}, {{}, {}}, {{1}, {2}})};
+
+    std::mt19937_64 re{1337};
+    auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> final_state(init_state.data(),
+                                                  init_state.size());
+    final_state.applyOperations(ops.getOpsName(), ops.getOpsWires(),
+                                ops.getOpsInverses(), ops.getOpsParams());
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> measures(
+        final_state);
+    const std::vector<PrecisionT> expected{
+        measures.expval("PauliZ", {0}),
+        measures.expvalPauliWord("XZ", {1, 2})};
+
+    const JacobianData<PrecisionT> tape{tp.size(), init_state.size(),
+                                        init_state.data(), obs_ls,
+                                        ops, tp};
+    AdjointJacobian<PrecisionT> adj;
+    std::vector<PrecisionT> expvals(obs_ls.size());
+    adj.computeExpvals(expvals, tape, true);
+    CHECK(expvals == approx(expected).margin(1e-5));
+
+    std::vector<PrecisionT> small(1);
+    PL_CHECK_THROWS_MATCHES(adj.computeExpvals(small, tape, true),
+                            Util::LightningException,
+                            "one element per observable");
+
+    SECTION("Run on a worker pool") {
+        std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size());
+        adj.adjointJacobian(jacobian, tape, true);
+
+        auto expval_future =
+            Util::WorkerPool::global().submit([adj, &tape]() mutable {
+                std::vector<PrecisionT> result(tape.getObservables().size());
+                adj.computeExpvals(result, tape, true);
+                return result;
+            });
+        auto jac_future =
+            Util::WorkerPool::global().submit([adj, &tape]() mutable {
+                std::vector<PrecisionT> result(tape.getNumParams() *
+                                               tape.getObservables().size());
+                adj.adjointJacobian(result, tape, true);
+                return result;
+            });
+        CHECK(expval_future.get() == approx(expected).margin(1e-5));
+        CHECK(jac_future.get() == approx(jacobian));
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::execute", "[AdjointJacobian]", float,
+                   double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 3;
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "RY", "CNOT", "RZ"}, {{0.4}, {-0.7}, {}, {1.1}},
+        {{0}, {1}, {0, 1}, {2}}, {false, false, false, true});
+    const std::vector<size_t> tp{0, 2};
+    const std::vector<ObsDatum<PrecisionT>> obs_ls{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliZ"}, {{}, {}}, {{1}, {2}})};
+
+    std::mt19937_64 re{1337};
+    auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> final_state(init_state.data(),
+                                                  init_state.size());
+    final_state.applyOperations(ops.getOpsName(), ops.getOpsWires(),
+                                ops.getOpsInverses(), ops.getOpsParams());
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> measures(
+        final_state);
+    const std::vector<PrecisionT> expvals{
+        measures.expval("PauliZ", {0}),
+        measures.expvalPauliWord("XZ", {1, 2})};
+    // Pauli words square to the identity
+    const std::vector<PrecisionT> variances{1 - expvals[0] * expvals[0],
+                                            1 - expvals[1] * expvals[1]};
+    const std::vector<PrecisionT> probs = measures.probs({2, 0});
+
+    const JacobianData<PrecisionT> tape{tp.size(), init_state.size(),
+                                        init_state.data(), obs_ls,
+                                        ops, tp};
+    AdjointJacobian<PrecisionT> adj;
+    std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size());
+    adj.adjointJacobian(jacobian, tape, true);
+
+    SECTION("Measurements and Jacobian") {
+        const auto results = adj.execute(tape, true, {2, 0}, true);
+        CHECK(results.expvals == approx(expvals).margin(1e-5));
+        CHECK(results.variances == approx(variances).margin(1e-5));
+        CHECK(results.probs == approx(probs).margin(1e-5));
+        CHECK(results.jacobian == approx(jacobian).margin(1e-5));
+    }
+
+    SECTION("With checkpoints") {
+        adj.setCheckpointInterval(2);
+        const auto results = adj.execute(tape, false, {}, true);
+        CHECK(results.expvals == approx(expvals).margin(1e-5));
+        CHECK(results.variances.empty());
+        CHECK(results.probs.empty());
+        CHECK(results.jacobian == approx(jacobian).margin(1e-5));
+    }
+
+    SECTION("Without trainable parameters") {
+        const JacobianData<PrecisionT> no_tp_tape{
+            0, init_state.size(), init_state.data(), obs_ls, ops, {}};
+        const auto results = adj.execute(no_tp_tape, true, {}, true);
+        CHECK(results.expvals == approx(expvals).margin(1e-5));
+        CHECK(results.variances == approx(variances).margin(1e-5));
+        CHECK(results.jacobian.empty());
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointJacobian parallelism",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+
+    SECTION("chooseParallelism") {
+        using Adj = AdjointJacobian<PrecisionT>;
+        REQUIRE(Adj::chooseParallelism(20, 1, 1) ==
+                AdjointParallelism::Observables);
+        REQUIRE(Adj::chooseParallelism(20, 8, 8) ==
+                AdjointParallelism::Observables);
+        REQUIRE(Adj::chooseParallelism(10, 1, 8) ==
+                AdjointParallelism::Observables);
+        REQUIRE(Adj::chooseParallelism(20, 1, 8) ==
+                AdjointParallelism::Elements);
+        REQUIRE(Adj::chooseParallelism(20, 2, 8) ==
+                AdjointParallelism::Nested);
+        REQUIRE(Adj::chooseParallelism(20, 5, 8) ==
+                AdjointParallelism::Observables);
+    }
+
+    // Large enough for multi-threaded gate kernels
+    const size_t num_qubits = KernelMap::parallel_lm_min_num_qubits;
+    const std::vector<PrecisionT> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "RY", "CNOT", "RZ", "IsingXX", "CRY"},
+        {{param[0]}, {param[1]}, {}, {param[2]}, {param[0]}, {param[1]}},
+        {{0}, {13}, {0, 13}, {7}, {13, 2}, {7, 0}},
+        {false, false, false, true, false, false});
+    const std::vector<size_t> tp{0, 1, 2, 3, 4};
+
+    std::vector<std::complex<PrecisionT>> cdata(1U << num_qubits);
+    cdata[0] = std::complex<PrecisionT>{1, 0};
+    StateVectorRawCPU<PrecisionT> psi(cdata.data(), cdata.size());
+
+    const std::vector<ObsDatum<PrecisionT>> all_obs{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliY"}, {{}, {}}, {{13}, {2}}),
+        ObsDatum<PrecisionT>(PauliSum<PrecisionT>({0.5, -0.3}, {"XX", "Z"},
+                                                  {{0, 7}, {13}}))};
+
+    for (size_t num_obs = 1; num_obs <= all_obs.size(); num_obs++) {
+        const std::vector<ObsDatum<PrecisionT>> obs_ls(
+            all_obs.begin(),
+            all_obs.begin() + static_cast<ptrdiff_t>(num_obs));
+        JacobianData<PrecisionT> tape{tp.size(),    psi.getLength(),
+                                      psi.getData(), obs_ls, ops, tp};
+
+        AdjointJacobian<PrecisionT> adj;
+        adj.setParallelism(AdjointParallelism::Observables);
+        std::vector<PrecisionT> expected(tp.size() * num_obs, 0);
+        adj.adjointJacobian(expected, tape, true);
+
+        for (const auto parallelism :
+             {AdjointParallelism::Auto, AdjointParallelism::Elements,
+              AdjointParallelism::Nested}) {
+            adj.setParallelism(parallelism);
+            REQUIRE(adj.getParallelism() == parallelism);
+            std::vector<PrecisionT> jacobian(tp.size() * num_obs, 0);
+            adj.adjointJacobian(jacobian, tape, true);
+            CHECK(jacobian == approx(expected).margin(1e-5));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::adjointVJP", "[AdjointJacobian]", float,
+                   double) {
+    using PrecisionT = TestType;
+    AdjointJacobian<PrecisionT> adj;
+
+    const size_t num_qubits = 3;
+    const std::vector<PrecisionT> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "RY", "CNOT", "RZ", "IsingXX", "CRY"},
+        {{param[0]}, {param[1]}, {}, {param[2]}, {param[0]}, {param[1]}},
+        {{0}, {1}, {0, 1}, {2}, {1, 2}, {2, 0}},
+        {false, false, false, true, false, false});
+    const std::vector<size_t> tp{0, 2, 3, 4};
+
+    const std::vector<ObsDatum<PrecisionT>> obs_ls{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliY"}, {{}, {}}, {{1}, {2}}),
+        ObsDatum<PrecisionT>({"Hadamard"}, {{}}, {{2}}),
+        ObsDatum<PrecisionT>(PauliSum<PrecisionT>({0.5, -0.3}, {"XX", "Z"},
+                                                  {{0, 2}, {1}}))};
+    const size_t num_obs = obs_ls.size();
+
+    std::vector<std::complex<PrecisionT>> cdata(1U << num_qubits);
+    cdata[0] = std::complex<PrecisionT>{1, 0};
+    StateVectorRawCPU<PrecisionT> psi(cdata.data(), cdata.size());
+
+    JacobianData<PrecisionT> tape{tp.size(), psi.getLength(), psi.getData(),
+                                  obs_ls,    ops,             tp};
+    std::vector<PrecisionT> jacobian(tp.size() * num_obs, 0);
+    adj.adjointJacobian(jacobian, tape, true);
+
+    for (const auto &dy : std::vector<std::vector<PrecisionT>>{
+             {1.0, 0.0, 0.0, 0.0},
+             {0.4, -1.2, 0.7, 2.0},
+             {0.0, 0.5, 0.0, -0.25}}) {
+        std::vector<PrecisionT> vjp(tp.size(), 0);
+        adj.adjointVJP(vjp, tape, dy, true);
+
+        std::vector<PrecisionT> expected(tp.size(), 0);
+        for (size_t o = 0; o < num_obs; o++) {
+            for (size_t p = 0; p < tp.size(); p++) {
+                expected[p] += dy[o] * jacobian[o * tp.size() + p];
+            }
+        }
+        CHECK(vjp == approx(expected).margin(1e-5));
+    }
+
+    SECTION("Invalid arguments") {
+        std::vector<PrecisionT> vjp(tp.size(), 0);
+        REQUIRE_THROWS_WITH(
+            adj.adjointVJP(vjp, tape, {1.0, 0.0}, true),
+            Catch::Contains("Invalid size for the gradient-output vector"));
+        std::vector<PrecisionT> short_vjp(1, 0);
+        REQUIRE_THROWS_WITH(
+            adj.adjointVJP(short_vjp, tape, {1.0, 0.0, 0.0, 0.0}, true),
+            Catch::Contains("one element per trainable parameter"));
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::hessianVectorProduct",
+                   "[AdjointJacobian]", float, double) {
+    using PrecisionT = TestType;
+    AdjointJacobian<PrecisionT> adj;
+    const size_t num_qubits = 3;
+    const PrecisionT h = std::is_same_v<PrecisionT, float> ? 1e-2 : 1e-4;
+    const PrecisionT eps = std::is_same_v<PrecisionT, float> ? 2e-2 : 1e-6;
+    std::mt19937 re{1337};
+    auto init = createRandomState<PrecisionT>(re, num_qubits);
+
+    const std::vector<PrecisionT> theta{0.4, -0.7, 1.2, 0.3, -1.1, 0.8};
+    const auto ops = [](const std::vector<PrecisionT> &p) {
+        return OpsData<PrecisionT>(
+            {"RX", "CNOT", "RY", "CRZ", "Rot", "IsingXX", "PhaseShift",
+             "MultiRZ"},
+            {{p[0]}, {}, {p[1]}, {p[2]}, {0.1, 0.2, 0.3}, {p[3]}, {p[4]},
+             {p[5]}},
+            {{0}, {0, 1}, {1}, {1, 2}, {2}, {0, 2}, {1}, {0, 1, 2}},
+            {false, false, true, false, false, false, true, false});
+    };
+    // Rot is not trainable
+    const std::vector<size_t> tp{0, 1, 2, 6, 7, 8};
+    const std::vector<ObsDatum<PrecisionT>> obs{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliY"}, {{}, {}}, {{1}, {2}})};
+    const auto tape = [&](const std::vector<PrecisionT> &p) {
+        return JacobianData<PrecisionT>{tp.size(), init.size(), init.data(),
+                                        obs,       ops(p),      tp};
+    };
+    const auto jacobian = [&](const std::vector<PrecisionT> &p) {
+        auto cdata = init;
+        StateVectorRawCPU<PrecisionT> psi(cdata.data(), cdata.size());
+        const JacobianData<PrecisionT> jd{
+            tp.size(), psi.getLength(), psi.getData(), obs, ops(p), tp};
+        std::vector<PrecisionT> jac(tp.size() * obs.size());
+        adj.adjointJacobian(jac, jd, true);
+        return jac;
+    };
+    // Central finite difference of the Jacobian along v
+    const auto expectedHVP = [&](const std::vector<PrecisionT> &v) {
+        std::vector<PrecisionT> plus = theta;
+        std::vector<PrecisionT> minus = theta;
+        for (size_t i = 0; i < v.size(); i++) {
+            plus[i] += h * v[i];
+            minus[i] -= h * v[i];
+        }
+        const auto jac_plus = jacobian(plus);
+        const auto jac_minus = jacobian(minus);
+        std::vector<PrecisionT> expected(jac_plus.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            expected[i] = (jac_plus[i] - jac_minus[i]) / (2 * h);
+        }
+        return expected;
+    };
+
+    SECTION("Hessian-vector product") {
+        const std::vector<PrecisionT> v{0.5, -1.0, 0.0, 2.0, 0.3, -0.7};
+        std::vector<PrecisionT> hvp(obs.size() * tp.size());
+        adj.hessianVectorProduct(hvp, tape(theta), v);
+        REQUIRE(hvp == approx(expectedHVP(v)).margin(eps));
+    }
+    SECTION("Hessian") {
+        const size_t p = tp.size();
+        std::vector<PrecisionT> hess(obs.size() * p * p);
+        adj.adjointHessian(hess, tape(theta));
+        for (size_t col = 0; col < p; col++) {
+            std::vector<PrecisionT> v(p, 0);
+            v[col] = 1;
+            const auto expected = expectedHVP(v);
+            for (size_t obs_idx = 0; obs_idx < obs.size(); obs_idx++) {
+                for (size_t row = 0; row < p; row++) {
+                    CHECK(hess[(obs_idx * p + row) * p + col] ==
+                          Approx(expected[obs_idx * p + row]).margin(eps));
+                    CHECK(hess[(obs_idx * p + row) * p + col] ==
+                          hess[(obs_idx * p + col) * p + row]);
+                }
+            }
+        }
+    }
+    SECTION("Invalid arguments") {
+        std::vector<PrecisionT> hvp(obs.size() * tp.size());
+        REQUIRE_THROWS_WITH(
+            adj.hessianVectorProduct(hvp, tape(theta), {1.0, 0.0}),
+            Catch::Contains("one element per trainable parameter"));
+        const JacobianData<PrecisionT> rot_tape{
+            1, init.size(), init.data(), obs, ops(theta), {4}};
+        std::vector<PrecisionT> rot_hvp(obs.size());
+        REQUIRE_THROWS_WITH(
+            adj.hessianVectorProduct(rot_hvp, rot_tape, {1.0}),
+            Catch::Contains("multi-parameter"));
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobian::metricTensor", "[AdjointJacobian]",
+                   float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    AdjointJacobian<PrecisionT> adj;
+    const PrecisionT eps = std::is_same_v<PrecisionT, float> ? 1e-3 : 1e-7;
+    const std::vector<ObsDatum<PrecisionT>> obs{};
+
+    SECTION("Single rotation") {
+        std::vector<ComplexPrecisionT> init{1, 0};
+        const JacobianData<PrecisionT> tape{
+            1,   init.size(),
+            init.data(),
+            obs, OpsData<PrecisionT>({"RX"}, {{0.7}}, {{0}}, {false}),
+            {0}};
+        std::vector<PrecisionT> metric(1);
+        adj.metricTensor(metric, tape);
+        REQUIRE(metric[0] == Approx(0.25).margin(eps));
+    }
+
+    SECTION("Circuit") {
+        const size_t num_qubits = 3;
+        const PrecisionT h = std::is_same_v<PrecisionT, float> ? 1e-2 : 1e-4;
+        std::mt19937 re{1337};
+        auto init = createRandomState<PrecisionT>(re, num_qubits);
+        const std::vector<PrecisionT> theta{0.4, -0.7, 1.2, 0.3, -1.1, 0.8};
+        const auto ops = [](const std::vector<PrecisionT> &p) {
+            return OpsData<PrecisionT>(
+                {"RX", "CNOT", "RY", "CRZ", "Rot", "IsingXX", "PhaseShift",
+                 "MultiRZ"},
+                {{p[0]}, {}, {p[1]}, {p[2]}, {0.1, 0.2, 0.3}, {p[3]}, {p[4]},
+                 {p[5]}},
+                {{0}, {0, 1}, {1}, {1, 2}, {2}, {0, 2}, {1}, {0, 1, 2}},
+                {false, false, true, false, false, false, true, false});
+        };
+        const std::vector<size_t> tp{0, 1, 2, 6, 7, 8};
+        const size_t p = tp.size();
+
+        // Derivatives of the state by central finite differences
+        const auto state = [&](const std::vector<PrecisionT> &params) {
+            StateVectorManagedCPU<PrecisionT> sv(init.data(), init.size());
+            const auto param_ops = ops(params);
+            for (size_t op_idx = 0; op_idx < param_ops.getSize(); op_idx++) {
+                sv.applyOperation(param_ops.getOpsName()[op_idx],
+                                  param_ops.getOpsWires()[op_idx],
+                                  param_ops.getOpsInverses()[op_idx],
+                                  param_ops.getOpsParams()[op_idx]);
+            }
+            const ComplexPrecisionT *data = sv.getData();
+            return std::vector<ComplexPrecisionT>(data,
+                                                  data + sv.getLength());
+        };
+        const auto psi = state(theta);
+        std::vector<std::vector<ComplexPrecisionT>> d_psi;
+        for (size_t i = 0; i < p; i++) {
+            auto plus = theta;
+            auto minus = theta;
+            plus[i] += h;
+            minus[i] -= h;
+            const auto psi_plus = state(plus);
+            const auto psi_minus = state(minus);
+            std::vector<ComplexPrecisionT> d(psi.size());
+            for (size_t idx = 0; idx < d.size(); idx++) {
+                d[idx] = (psi_plus[idx] - psi_minus[idx]) / (2 * h);
+            }
+            d_psi.push_back(d);
+        }
+
+        const JacobianData<PrecisionT> tape{p,   init.size(), init.data(),
+                                            obs, ops(theta),  tp};
+        std::vector<PrecisionT> metric(p * p);
+        adj.metricTensor(metric, tape);
+        for (size_t i = 0; i < p; i++) {
+            for (size_t j = 0; j < p; j++) {
+                const auto expected = std::real(
+                    Util::innerProdC(d_psi[i], d_psi[j]) -
+                    Util::innerProdC(d_psi[i], psi) *
+                        Util::innerProdC(psi, d_psi[j]));
+                CHECK(metric[i * p + j] == Approx(expected).margin(eps));
+            }
+        }
+
+        std::vector<PrecisionT> short_metric(p);
+        REQUIRE_THROWS_WITH(adj.metricTensor(short_metric, tape),
+                            Catch::Contains("pair of trainable parameters"));
+    }
+}
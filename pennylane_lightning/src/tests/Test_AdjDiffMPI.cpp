@@ -0,0 +1,58 @@
+#include <complex>
+#include <random>
+#include <vector>
+
+#include "AdjointDiff.hpp"
+#include "AdjointDiffMPI.hpp"
+#include "StateVectorMPI.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+TEMPLATE_TEST_CASE("AdjointJacobianMPI::adjointJacobian",
+                   "[AdjointJacobianMPI]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 4;
+    std::mt19937_64 re{1337};
+    auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "CNOT", "RY", "CRZ", "IsingXX", "RZ"},
+        {{0.4}, {}, {-0.7}, {1.1}, {0.3}, {-0.2}},
+        {{0}, {0, 3}, {1}, {3, 0}, {1, 2}, {0}},
+        {false, false, true, false, false, false});
+    const std::vector<size_t> tp{0, 2, 3, 4};
+    const std::vector<ObsDatum<PrecisionT>> obs_ls{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliY"}, {{}, {}}, {{1}, {3}}),
+        ObsDatum<PrecisionT>(
+            {"Hermitian"},
+            {std::vector<std::complex<PrecisionT>>{
+                {1, 0}, {0, 0.5}, {0, -0.5}, {-1, 0}}},
+            {{2}})};
+
+    const JacobianData<PrecisionT> tape{tp.size(), init_state.size(),
+                                        init_state.data(), obs_ls,
+                                        ops, tp};
+    std::vector<PrecisionT> expected(tp.size() * obs_ls.size());
+    AdjointJacobian<PrecisionT>().adjointJacobian(expected, tape, true);
+
+    StateVectorMPI<PrecisionT> sv(num_qubits);
+    sv.setFullState(init_state.data(), init_state.size());
+    std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size());
+    AdjointJacobianMPI<PrecisionT> adj;
+    adj.adjointJacobian(jacobian, sv, obs_ls, ops, tp, true);
+    CHECK(jacobian == approx(expected).margin(1e-5));
+
+    SECTION("Pauli sums are not supported") {
+        const std::vector<ObsDatum<PrecisionT>> pauli_sum{ObsDatum<PrecisionT>(
+            PauliSum<PrecisionT>({1.0}, {"ZZ"}, {{0, 1}}))};
+        std::vector<PrecisionT> jac(tp.size());
+        PL_CHECK_THROWS_MATCHES(
+            adj.adjointJacobian(jac, sv, pauli_sum, ops, tp, true),
+            Util::LightningException, "not supported");
+    }
+}
@@ -0,0 +1,141 @@
+#include "BatchedCircuit.hpp"
+#include "Measures.hpp"
+#include "StateVectorManagedCPU.hpp"
+
+#include "TestHelpers.hpp"
+#include <catch2/catch.hpp>
+
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+TEMPLATE_TEST_CASE("BatchedCircuit::BatchedCircuit", "[BatchedCircuit]",
+                   float, double) {
+    using PrecisionT = TestType;
+
+    SECTION("Number of parameters") {
+        const BatchedCircuit<PrecisionT> circuit(
+            {"RX", "CNOT", "Rot", "MultiRZ"}, {{0}, {0, 1}, {1}, {0, 1, 2}},
+            {false, false, true, false});
+        REQUIRE(circuit.getNumOps() == 4);
+        REQUIRE(circuit.getNumParams() == 5);
+    }
+    SECTION("Invalid arguments") {
+        REQUIRE_THROWS_WITH(
+            BatchedCircuit<PrecisionT>({"RX", "CNOT"}, {{0}}, {false, false}),
+            Catch::Contains("must all be equal"));
+        REQUIRE_THROWS_WITH(
+            BatchedCircuit<PrecisionT>({"CNOT"}, {{0}}, {false}),
+            Catch::Contains("number of wires"));
+    }
+    SECTION("chooseThreading") {
+        REQUIRE(BatchedCircuit<PrecisionT>::chooseThreading(20, 2, 8) ==
+                Threading::MultiThread);
+        REQUIRE(BatchedCircuit<PrecisionT>::chooseThreading(20, 8, 8) ==
+                Threading::SingleThread);
+        REQUIRE(BatchedCircuit<PrecisionT>::chooseThreading(4, 2, 8) ==
+                Threading::SingleThread);
+    }
+    SECTION("useBatchMajor") {
+        const size_t max_num_qubits =
+            BatchedCircuit<PrecisionT>::batch_major_max_num_qubits;
+        REQUIRE(BatchedCircuit<PrecisionT>::useBatchMajor(max_num_qubits, 2));
+        REQUIRE(
+            !BatchedCircuit<PrecisionT>::useBatchMajor(max_num_qubits + 1, 2));
+        REQUIRE(!BatchedCircuit<PrecisionT>::useBatchMajor(4, 1));
+    }
+}
+
+TEMPLATE_TEST_CASE("BatchedCircuit::execute", "[BatchedCircuit]", float,
+                   double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+
+    const std::vector<std::string> ops_name{"RX",   "RY",      "CNOT",
+                                            "Rot",  "IsingXX", "Hadamard",
+                                            "CRZ"};
+    const std::vector<std::vector<size_t>> ops_wires{
+        {0}, {2}, {0, 1}, {1}, {1, 2}, {0}, {2, 0}};
+    const std::vector<bool> ops_inverse{false, true,  false, false,
+                                        false, false, true};
+    const BatchedCircuit<PrecisionT> circuit(ops_name, ops_wires,
+                                             ops_inverse);
+    const size_t num_params = circuit.getNumParams();
+    REQUIRE(num_params == 7);
+
+    const PauliSum<PrecisionT> ham({0.3, -0.7, 1.1}, {"XZ", "Y", "ZZZ"},
+                                   {{0, 2}, {1}, {0, 1, 2}});
+    const PauliSum<PrecisionT> z0({1.0}, {"Z"}, {{0}});
+
+    auto checkBatch = [&](size_t num_qubits, size_t num_circuits) {
+        const size_t length = size_t{1U} << num_qubits;
+        const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+        std::uniform_real_distribution<PrecisionT> param_dist(-M_PI, M_PI);
+        std::vector<PrecisionT> params(num_circuits * num_params);
+        for (auto &param : params) {
+            param = param_dist(re);
+        }
+
+        std::vector<ComplexPrecisionT> states(num_circuits * length);
+        circuit.executeStates(init_state.data(), num_qubits, params.data(),
+                              num_circuits, states.data());
+        const auto expvals =
+            circuit.executeExpval(init_state.data(), num_qubits,
+                                  params.data(), num_circuits, {ham, z0});
+        REQUIRE(expvals.size() == 2 * num_circuits);
+
+        for (size_t i = 0; i < num_circuits; i++) {
+            StateVectorManagedCPU<PrecisionT> sv(init_state.data(), length);
+            size_t offset = 0;
+            for (size_t op_idx = 0; op_idx < ops_name.size(); op_idx++) {
+                const size_t n = (ops_name[op_idx] == "Rot") ? 3
+                                 : (ops_name[op_idx] == "CNOT" ||
+                                    ops_name[op_idx] == "Hadamard")
+                                     ? 0
+                                     : 1;
+                const std::vector<PrecisionT> op_params(
+                    params.begin() +
+                        static_cast<ptrdiff_t>(i * num_params + offset),
+                    params.begin() +
+                        static_cast<ptrdiff_t>(i * num_params + offset + n));
+                sv.applyOperation(ops_name[op_idx], ops_wires[op_idx],
+                                  ops_inverse[op_idx], op_params);
+                offset += n;
+            }
+            const std::vector<ComplexPrecisionT> state(
+                states.begin() + static_cast<ptrdiff_t>(i * length),
+                states.begin() + static_cast<ptrdiff_t>((i + 1) * length));
+            CHECK(state == approx(sv.getDataVector()).margin(1e-5));
+
+            Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> m(sv);
+            CHECK(expvals[2 * i] ==
+                  Approx(m.expval(ham)).epsilon(1e-5).margin(1e-5));
+            CHECK(expvals[2 * i + 1] ==
+                  Approx(m.expval("PauliZ", {0})).epsilon(1e-5).margin(1e-5));
+        }
+    };
+
+    SECTION("Small statevectors") { checkBatch(3, 9); }
+    SECTION("Batch-major groups") {
+        // Two full groups and a partial one
+        checkBatch(4, 2 * BatchedCircuit<PrecisionT>::batch_major_width + 3);
+    }
+    SECTION("Single circuit") { checkBatch(4, 1); }
+    SECTION("Multi-threaded kernels") {
+        checkBatch(KernelMap::parallel_lm_min_num_qubits, 2);
+    }
+    SECTION("Empty batch") { checkBatch(3, 0); }
+    SECTION("Invalid wires") {
+        const auto init_state = createRandomState<PrecisionT>(re, 2);
+        const std::vector<PrecisionT> params(num_params, 0.0);
+        REQUIRE_THROWS_WITH(circuit.executeExpval(init_state.data(), 2,
+                                                  params.data(), 1, {z0}),
+                            Catch::Contains("Invalid wire"));
+    }
+}
@@ -9,6 +9,7 @@
 
 #include <catch2/catch.hpp>
 
+#include "CPUMemoryModel.hpp"
 #include "DynamicDispatcher.hpp"
 #include "OpToMemberFuncPtr.hpp"
 #include "SelectKernel.hpp"
@@ -121,7 +122,9 @@ void testAllKernelsIter(RandomEngine &re, size_t max_num_qubits) {
 
 template <typename PrecisionT, typename ParamT, class RandomEngine>
 void testAllKernels(RandomEngine &re, size_t max_num_qubits) {
-    testAllKernelsIter<PrecisionT, ParamT, Pennylane::AvailableKernels>(
+    // Kernels compiled for other instruction sets are tested below, as their
+    // functions called directly here would be the LM fallback
+    testAllKernelsIter<PrecisionT, ParamT, Pennylane::BaselineKernels>(
         re, max_num_qubits);
 }
 
@@ -154,6 +157,157 @@ TEMPLATE_TEST_CASE("DynamicDispatcher::applyOperation", "[DynamicDispatcher]",
     }
 }
 
+TEMPLATE_TEST_CASE("DynamicDispatcher::SIMD kernels", "[DynamicDispatcher]",
+                   float, double) {
+    using PrecisionT = TestType;
+    std::mt19937_64 re{1337};
+    const size_t num_qubits = 6;
+    const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+
+    // Registered if compiled for the build target or for runtime dispatch,
+    // and supported by the CPU
+    REQUIRE(dispatcher.isRegistered(GateOperation::PauliX, KernelType::AVX2) ==
+            hasAVX2Kernels());
+    REQUIRE(dispatcher.isRegistered(GateOperation::PauliX,
+                                    KernelType::AVX512) == hasAVX512FKernels());
+    REQUIRE(dispatcher.isRegistered(GateOperation::PauliX, KernelType::NEON) ==
+            hasNEONKernels());
+
+    for (const auto kernel :
+         {KernelType::AVX2, KernelType::AVX512, KernelType::NEON}) {
+        for (const auto &[gate_op, gate_name] : Constant::gate_names) {
+            if (!dispatcher.isRegistered(gate_op, kernel)) {
+                continue;
+            }
+            const auto params = createParams<PrecisionT>(gate_op);
+            const size_t num_wires = Util::lookup(Constant::gate_wires, gate_op);
+            // Wires inside and outside of a register
+            for (const auto &all_wires : std::vector<std::vector<size_t>>{
+                     {num_qubits - 1, 0}, {1, 3}, {num_qubits - 2, 2}}) {
+                const std::vector<size_t> wires(
+                    all_wires.begin(),
+                    all_wires.begin() + static_cast<ptrdiff_t>(num_wires));
+                for (const bool inverse : {false, true}) {
+                    auto expected = createRandomState<PrecisionT>(re, num_qubits);
+                    auto st = expected;
+                    dispatcher.applyOperation(KernelType::LM, expected.data(),
+                                              num_qubits, gate_op, wires,
+                                              inverse, params);
+                    dispatcher.applyOperation(kernel, st.data(), num_qubits,
+                                              gate_op, wires, inverse, params);
+                    INFO(gate_name);
+                    REQUIRE(st == approx(expected).margin(1e-5));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("DynamicDispatcher::applyOperationBatch",
+                   "[DynamicDispatcher]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937_64 re{1337};
+    const size_t num_qubits = 5;
+    const size_t num_states = 3;
+    const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+
+    for (const auto &[gate_op, gate_name] : Constant::gate_names) {
+        const size_t num_wires =
+            Util::array_has_elt(Constant::multi_qubit_gates, gate_op)
+                ? 3
+                : Util::lookup(Constant::gate_wires, gate_op);
+        // Not sorted to test the order of the wires
+        const std::vector<size_t> all_wires{3, 0, 4, 1};
+        const std::vector<size_t> wires(all_wires.begin(),
+                                        all_wires.begin() +
+                                            static_cast<ptrdiff_t>(num_wires));
+        const auto params = createParams<PrecisionT>(gate_op);
+        const auto kernel = dispatcher.isRegistered(gate_op, KernelType::PI)
+                                ? KernelType::PI
+                                : KernelType::LM;
+
+        DYNAMIC_SECTION("Gate " << gate_name) {
+            for (const bool inverse : {false, true}) {
+                std::vector<decltype(createRandomState<PrecisionT>(
+                    re, num_qubits))>
+                    states;
+                std::vector<std::complex<PrecisionT> *> ptrs;
+                for (size_t i = 0; i < num_states; i++) {
+                    states.emplace_back(
+                        createRandomState<PrecisionT>(re, num_qubits));
+                }
+                auto expected = states;
+                for (auto &state : states) {
+                    ptrs.push_back(state.data());
+                }
+                for (auto &state : expected) {
+                    dispatcher.applyOperation(kernel, state.data(),
+                                              num_qubits, gate_op, wires,
+                                              inverse, params);
+                }
+                dispatcher.applyOperationBatch(kernel, ptrs.data(),
+                                               ptrs.size(), num_qubits,
+                                               gate_op, wires, inverse, params,
+                                               2);
+                for (size_t i = 0; i < num_states; i++) {
+                    REQUIRE(states[i] == approx(expected[i]).margin(1e-5));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("DynamicDispatcher::getGateFunc", "[DynamicDispatcher]",
+                   float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 3;
+    auto &dispatcher = DynamicDispatcher<TestType>::getInstance();
+
+    REQUIRE(dispatcher.hasGateOp("CNOT"));
+    REQUIRE(!dispatcher.hasGateOp("QubitStateVector"));
+
+    SECTION("Resolved function applies the gate") {
+        auto expected = createProductState<PrecisionT>("100");
+        auto st = expected;
+        dispatcher.applyOperation(Gates::KernelType::LM, expected.data(),
+                                  num_qubits, "CNOT", {0, 1}, false);
+        const auto &func =
+            dispatcher.getGateFunc(GateOperation::CNOT, Gates::KernelType::LM);
+        func(st.data(), num_qubits, {0, 1}, false, {});
+        REQUIRE(st == expected);
+    }
+
+    SECTION("Throw an exception for a kernel not registered") {
+        REQUIRE_THROWS_WITH(dispatcher.getGateFunc(GateOperation::Toffoli,
+                                                   Gates::KernelType::None),
+                            Catch::Contains("Cannot find"));
+    }
+}
+
+TEMPLATE_TEST_CASE("DynamicDispatcher::strToGateOp", "[DynamicDispatcher]",
+                   float, double) {
+    auto &dispatcher = DynamicDispatcher<TestType>::getInstance();
+
+    SECTION("Names map to their operations") {
+        for (const auto &[gate_op, gate_name] : Constant::gate_names) {
+            REQUIRE(dispatcher.hasGateOp(std::string(gate_name)));
+            REQUIRE(dispatcher.strToGateOp(std::string(gate_name)) == gate_op);
+        }
+        for (const auto &[gntr_op, gntr_name] : Constant::generator_names) {
+            const auto name = std::string(gntr_name.substr(9)); // "Generator"
+            REQUIRE(dispatcher.strToGeneratorOp(name) == gntr_op);
+        }
+    }
+
+    SECTION("Throw an exception for an unknown name") {
+        REQUIRE(!dispatcher.hasGateOp("RXX"));
+        REQUIRE(!dispatcher.hasGateOp(""));
+        REQUIRE_THROWS_AS(dispatcher.strToGateOp("RXX"), std::out_of_range);
+        REQUIRE_THROWS_AS(dispatcher.strToGeneratorOp("GeneratorRX"),
+                          std::out_of_range);
+    }
+}
+
 TEMPLATE_TEST_CASE("DynamicDispatcher::applyGenerator", "[DynamicDispatcher]",
                    float, double) {
     using PrecisionT = TestType;
@@ -201,3 +355,54 @@ TEMPLATE_TEST_CASE("DynamicDispatcher::applyMatrix", "[DynamicDispatcher]",
                                 Catch::Contains("SingleQubitOp"));
     }
 }
+
+TEMPLATE_TEST_CASE("DynamicDispatcher profiling", "[DynamicDispatcher]",
+                   float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 3;
+    auto st = createProductState<PrecisionT>("000");
+    auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+    auto &profiler = DispatchProfiler<PrecisionT>::getInstance();
+    profiler.reset();
+
+    dispatcher.applyOperation(KernelType::LM, st.data(), num_qubits, "PauliX",
+                              {0}, false);
+    dispatcher.applyOperation(KernelType::LM, st.data(), num_qubits,
+                              GateOperation::PauliX, {1}, false);
+    dispatcher.applyOperation(KernelType::PI, st.data(), num_qubits,
+                              GateOperation::RX, {2}, false, {0.3});
+    const std::vector<std::complex<PrecisionT>> matrix{0.0, 1.0, 1.0, 0.0};
+    dispatcher.applyMatrix(KernelType::LM, st.data(), num_qubits, matrix, {0},
+                           false);
+    [[maybe_unused]] const auto scale =
+        dispatcher.applyGenerator(KernelType::LM, st.data(), num_qubits,
+                                  GeneratorOperation::RZ, {0}, false);
+
+    const auto records = profiler.getRecords();
+    if constexpr (Util::Constant::use_dispatch_profiling) {
+        REQUIRE(records.size() == 4);
+        const auto find = [&](std::string_view op_name, KernelType kernel) {
+            return std::find_if(records.begin(), records.end(),
+                                [&](const auto &rec) {
+                                    return rec.first.op_name == op_name &&
+                                           rec.first.kernel == kernel &&
+                                           rec.first.num_qubits == num_qubits;
+                                });
+        };
+        const size_t bytes_per_call =
+            2 * 8 * sizeof(std::complex<PrecisionT>);
+        const auto pauli_x = find("PauliX", KernelType::LM);
+        REQUIRE(pauli_x != records.end());
+        REQUIRE(pauli_x->second.calls == 2);
+        REQUIRE(pauli_x->second.bytes == 2 * bytes_per_call);
+        REQUIRE(pauli_x->second.seconds >= 0.0);
+        REQUIRE(find("RX", KernelType::PI)->second.calls == 1);
+        REQUIRE(find("SingleQubitOp", KernelType::LM)->second.calls == 1);
+        REQUIRE(find("GeneratorRZ", KernelType::LM)->second.calls == 1);
+    } else {
+        REQUIRE(records.empty());
+    }
+
+    profiler.reset();
+    REQUIRE(profiler.getRecords().empty());
+}
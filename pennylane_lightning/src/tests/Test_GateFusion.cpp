@@ -0,0 +1,318 @@
+#include "GateFusion.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <complex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Pennylane;
+using Pennylane::Gates::partitionForFusion;
+using Pennylane::Gates::partitionForProducts;
+using Pennylane::Gates::partitionIntoLayers;
+
+TEST_CASE("partitionForFusion", "[GateFusion]") {
+    SECTION("Consecutive gates on the same wires are merged") {
+        const std::vector<std::vector<size_t>> ops_wires{
+            {0}, {1}, {0, 1}, {1}, {1, 0}, {2}, {2, 3}, {3}};
+        const auto blocks = partitionForFusion(ops_wires, 2);
+        REQUIRE(blocks.size() == 2);
+        REQUIRE(blocks[0].op_indices == std::vector<size_t>{0, 1, 2, 3, 4});
+        REQUIRE(blocks[0].wires == std::vector<size_t>{0, 1});
+        REQUIRE(blocks[1].op_indices == std::vector<size_t>{5, 6, 7});
+        REQUIRE(blocks[1].wires == std::vector<size_t>{2, 3});
+    }
+    SECTION("Single wire fusion") {
+        const std::vector<std::vector<size_t>> ops_wires{{0}, {0}, {1}, {0, 1}};
+        const auto blocks = partitionForFusion(ops_wires, 1);
+        REQUIRE(blocks.size() == 3);
+        REQUIRE(blocks[0].op_indices == std::vector<size_t>{0, 1});
+        REQUIRE(blocks[1].op_indices == std::vector<size_t>{2});
+        REQUIRE(blocks[2].op_indices == std::vector<size_t>{3});
+        REQUIRE(blocks[2].wires == std::vector<size_t>{0, 1});
+    }
+    SECTION("Operations larger than the maximum form their own block") {
+        const std::vector<std::vector<size_t>> ops_wires{
+            {0}, {3, 1, 2}, {1}, {2}};
+        const auto blocks = partitionForFusion(ops_wires, 2);
+        REQUIRE(blocks.size() == 3);
+        REQUIRE(blocks[0].op_indices == std::vector<size_t>{0});
+        REQUIRE(blocks[1].op_indices == std::vector<size_t>{1});
+        REQUIRE(blocks[1].wires == std::vector<size_t>{1, 2, 3});
+        REQUIRE(blocks[2].op_indices == std::vector<size_t>{2, 3});
+    }
+    SECTION("Empty list") {
+        REQUIRE(partitionForFusion({}, 3).empty());
+    }
+    SECTION("Diagonal operations form larger blocks") {
+        const std::vector<std::vector<size_t>> ops_wires{
+            {0, 1}, {2}, {3, 4}, {1, 4}, {0}, {0, 1}, {2, 3}};
+        const std::vector<bool> ops_diagonal{true, true, true, true,
+                                             false, true, true};
+        const auto blocks = partitionForFusion(ops_wires, ops_diagonal, 2, 5);
+        REQUIRE(blocks.size() == 3);
+        REQUIRE(blocks[0].op_indices == std::vector<size_t>{0, 1, 2, 3});
+        REQUIRE(blocks[0].wires == std::vector<size_t>{0, 1, 2, 3, 4});
+        REQUIRE(blocks[0].diagonal);
+        REQUIRE(blocks[1].op_indices == std::vector<size_t>{4, 5});
+        REQUIRE(!blocks[1].diagonal);
+        REQUIRE(blocks[2].op_indices == std::vector<size_t>{6});
+        REQUIRE(blocks[2].diagonal);
+    }
+}
+
+TEST_CASE("partitionIntoLayers", "[GateFusion]") {
+    SECTION("Gates move past gates on disjoint wires") {
+        const std::vector<std::vector<size_t>> ops_wires{
+            {0}, {1}, {2}, {0}, {1, 2}, {3}, {2}, {0, 3}, {1}};
+        const auto layers = partitionIntoLayers(ops_wires);
+        REQUIRE(layers.size() == 3);
+        REQUIRE(layers[0] == std::vector<size_t>{0, 1, 2, 5});
+        REQUIRE(layers[1] == std::vector<size_t>{3, 4});
+        REQUIRE(layers[2] == std::vector<size_t>{6, 7, 8});
+    }
+    SECTION("Empty list") { REQUIRE(partitionIntoLayers({}).empty()); }
+}
+
+TEST_CASE("partitionForProducts", "[GateFusion]") {
+    // RY and RZ on every wire, then a CNOT
+    const std::vector<std::vector<size_t>> ops_wires{
+        {4}, {1}, {0}, {3}, {2}, {0}, {1}, {2}, {3}, {4}, {0, 1}};
+    const auto blocks = partitionForProducts(ops_wires, 2);
+    REQUIRE(blocks.size() == 7);
+    REQUIRE(blocks[0].op_indices == std::vector<size_t>{2, 1});
+    REQUIRE(blocks[0].wires == std::vector<size_t>{0, 1});
+    REQUIRE(blocks[1].op_indices == std::vector<size_t>{4, 3});
+    REQUIRE(blocks[1].wires == std::vector<size_t>{2, 3});
+    REQUIRE(blocks[2].op_indices == std::vector<size_t>{0});
+    REQUIRE(blocks[3].op_indices == std::vector<size_t>{5, 6});
+    REQUIRE(blocks[5].op_indices == std::vector<size_t>{9});
+    REQUIRE(blocks[6].op_indices == std::vector<size_t>{10});
+    REQUIRE(blocks[6].wires == std::vector<size_t>{0, 1});
+
+    PL_CHECK_THROWS_MATCHES(partitionForProducts(ops_wires, 0),
+                            Util::LightningException, "must be positive");
+}
+
+TEST_CASE("getFusedMatrix", "[GateFusion]") {
+    using ComplexPrecisionT = std::complex<double>;
+    const std::vector<std::string> ops{"PauliX", "CNOT"};
+    const std::vector<std::vector<size_t>> ops_wires{{3}, {3, 1}};
+    const std::vector<bool> ops_inverse{false, false};
+    const std::vector<std::vector<double>> ops_params{{}, {}};
+
+    const auto blocks = partitionForFusion(ops_wires, 2);
+    REQUIRE(blocks.size() == 1);
+
+    const auto matrix = Gates::getFusedMatrix<double>(
+        blocks[0], ops, ops_wires, ops_inverse, ops_params);
+
+    // Wires are {1, 3}. CNOT(3, 1) PauliX(3) maps |b1 b3> to
+    // |(b1 ^ !b3) !b3>
+    std::vector<ComplexPrecisionT> expected(16, 0.0);
+    expected[0B11 * 4 + 0B00] = 1.0;
+    expected[0B00 * 4 + 0B01] = 1.0;
+    expected[0B01 * 4 + 0B10] = 1.0;
+    expected[0B10 * 4 + 0B11] = 1.0;
+    REQUIRE(matrix == approx(expected));
+}
+
+TEST_CASE("getFusedDiagonal", "[GateFusion]") {
+    const std::vector<std::string> ops{"RZ", "CZ", "IsingZZ", "PhaseShift"};
+    const std::vector<std::vector<size_t>> ops_wires{
+        {4}, {1, 4}, {2, 1}, {2}};
+    const std::vector<bool> ops_inverse{false, true, false, true};
+    const std::vector<std::vector<double>> ops_params{
+        {0.3}, {}, {-1.2}, {0.7}};
+    const Gates::FusedGateBlock block{{0, 1, 2, 3}, {1, 2, 4}, true};
+
+    const auto diag = Gates::getFusedDiagonal<double>(
+        block, ops, ops_wires, ops_inverse, ops_params);
+    const auto matrix = Gates::getFusedMatrix<double>(
+        block, ops, ops_wires, ops_inverse, ops_params);
+
+    std::vector<std::complex<double>> expected(diag.size());
+    for (size_t i = 0; i < diag.size(); i++) {
+        expected[i] = matrix[i * diag.size() + i];
+    }
+    REQUIRE(diag == approx(expected));
+
+    const std::vector<std::string> dense_ops{"RZ", "CNOT"};
+    const Gates::FusedGateBlock dense_block{{0, 1}, {1, 2, 4}, true};
+    PL_CHECK_THROWS_MATCHES(
+        Gates::getFusedDiagonal<double>(dense_block, dense_ops, ops_wires,
+                                        ops_inverse, ops_params),
+        Util::LightningException, "must be diagonal");
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyOperations with gate fusion",
+                   "[GateFusion]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937_64 re{1337};
+    const size_t num_qubits = 6;
+    const size_t num_ops = 60;
+
+    const std::vector<std::pair<std::string, size_t>> gate_list{
+        {"RX", 1},       {"RY", 1},   {"RZ", 1},      {"Rot", 1},
+        {"Hadamard", 1}, {"CNOT", 2}, {"IsingXX", 2}, {"CRY", 2},
+        {"Toffoli", 3},  {"CZ", 2},   {"MultiRZ", 3}, {"PauliY", 1}};
+    const auto num_params = [](const std::string &name) -> size_t {
+        if (name == "Rot") {
+            return 3;
+        }
+        if (name == "Hadamard" || name == "CNOT" || name == "Toffoli" ||
+            name == "CZ" || name == "PauliY") {
+            return 0;
+        }
+        return 1;
+    };
+
+    std::vector<std::string> ops;
+    std::vector<std::vector<size_t>> ops_wires;
+    std::vector<bool> ops_inverse;
+    std::vector<std::vector<PrecisionT>> ops_params;
+
+    std::uniform_int_distribution<size_t> gate_dist(0, gate_list.size() - 1);
+    std::uniform_real_distribution<PrecisionT> param_dist(-M_PI, M_PI);
+    std::bernoulli_distribution inverse_dist(0.5);
+
+    std::vector<size_t> all_wires(num_qubits);
+    std::iota(all_wires.begin(), all_wires.end(), 0);
+    for (size_t i = 0; i < num_ops; i++) {
+        const auto &[name, n_wires] = gate_list[gate_dist(re)];
+        std::shuffle(all_wires.begin(), all_wires.end(), re);
+        ops.emplace_back(name);
+        ops_wires.emplace_back(all_wires.begin(),
+                               all_wires.begin() + n_wires);
+        ops_inverse.emplace_back(inverse_dist(re));
+        std::vector<PrecisionT> params(num_params(name));
+        for (auto &param : params) {
+            param = param_dist(re);
+        }
+        ops_params.emplace_back(std::move(params));
+    }
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    StateVectorManagedCPU<PrecisionT> expected{init_state.data(),
+                                               init_state.size()};
+    expected.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+
+    for (size_t max_wires = 1; max_wires <= Gates::max_fused_wires;
+         max_wires++) {
+        StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                             init_state.size()};
+        sv.setMaxFusedWires(max_wires);
+        REQUIRE(sv.getMaxFusedWires() == max_wires);
+        sv.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+
+        REQUIRE(sv.getDataVector() ==
+                approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Non-parametric gates") {
+        const std::vector<std::string> np_ops{"Hadamard", "CNOT", "PauliY",
+                                              "S", "CZ", "T"};
+        const std::vector<std::vector<size_t>> np_wires{{0}, {0, 1}, {1},
+                                                        {2}, {1, 2}, {0}};
+        const std::vector<bool> np_inverse{false, false, true,
+                                           true,  false, true};
+        StateVectorManagedCPU<PrecisionT> np_expected{init_state.data(),
+                                                      init_state.size()};
+        np_expected.applyOperations(np_ops, np_wires, np_inverse);
+
+        StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                             init_state.size()};
+        sv.setMaxFusedWires(3);
+        sv.applyOperations(np_ops, np_wires, np_inverse);
+        REQUIRE(sv.getDataVector() ==
+                approx(np_expected.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Diagonal gates on many wires") {
+        const std::vector<std::string> diag_ops{
+            "RZ", "CZ", "MultiRZ", "IsingZZ", "T", "ControlledPhaseShift",
+            "Hadamard", "CRZ", "S"};
+        const std::vector<std::vector<size_t>> diag_wires{
+            {0}, {1, 5}, {2, 3, 4}, {0, 3}, {5}, {4, 1}, {2}, {3, 0}, {1}};
+        const std::vector<bool> diag_inverse{false, true,  false, true, false,
+                                             true,  false, false, true};
+        const std::vector<std::vector<PrecisionT>> diag_params{
+            {0.4}, {}, {-0.8}, {1.1}, {}, {0.3}, {}, {-2.1}, {}};
+        StateVectorManagedCPU<PrecisionT> diag_expected{init_state.data(),
+                                                        init_state.size()};
+        diag_expected.applyOperations(diag_ops, diag_wires, diag_inverse,
+                                      diag_params);
+
+        StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                             init_state.size()};
+        sv.setMaxFusedWires(2);
+        sv.applyOperations(diag_ops, diag_wires, diag_inverse, diag_params);
+        REQUIRE(sv.getDataVector() ==
+                approx(diag_expected.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Maximum number of fused wires is bounded") {
+        StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                             init_state.size()};
+        REQUIRE_THROWS(sv.setMaxFusedWires(Gates::max_fused_wires + 1));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVector::applyOperations with layer scheduling",
+                   "[GateFusion]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937_64 re{1337};
+    const size_t num_qubits = 8;
+
+    // Layers of a hardware-efficient ansatz, with inverses and gates out of
+    // layer order
+    std::vector<std::string> ops;
+    std::vector<std::vector<size_t>> ops_wires;
+    std::vector<bool> ops_inverse;
+    std::vector<std::vector<PrecisionT>> ops_params;
+    std::uniform_real_distribution<PrecisionT> param_dist(-M_PI, M_PI);
+    for (size_t layer = 0; layer < 3; layer++) {
+        for (const auto *name : {"RY", "RZ"}) {
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                ops.emplace_back(name);
+                ops_wires.push_back({(wire * 3 + layer) % num_qubits});
+                ops_inverse.push_back(wire % 3 == 0);
+                ops_params.push_back({param_dist(re)});
+            }
+        }
+        ops.emplace_back("Hadamard");
+        ops_wires.push_back({layer});
+        ops_inverse.push_back(false);
+        ops_params.emplace_back();
+        for (size_t wire = 0; wire + 1 < num_qubits; wire++) {
+            ops.emplace_back(wire % 2 == 0 ? "CNOT" : "CRX");
+            ops_wires.push_back({wire, wire + 1});
+            ops_inverse.push_back(false);
+            ops_params.emplace_back(wire % 2 == 0 ? 0 : 1, param_dist(re));
+        }
+    }
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> expected{init_state.data(),
+                                               init_state.size()};
+    expected.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+
+    for (size_t block_qubits : {0, 4}) {
+        DYNAMIC_SECTION("block_qubits = " << block_qubits) {
+            StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                                 init_state.size()};
+            sv.setLayerScheduling(true);
+            sv.setCacheBlockQubits(block_qubits);
+            REQUIRE(sv.getLayerScheduling());
+            sv.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+            REQUIRE(sv.getDataVector() ==
+                    approx(expected.getDataVector()).margin(1e-5));
+        }
+    }
+}
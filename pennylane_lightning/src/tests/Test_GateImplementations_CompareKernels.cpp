@@ -308,5 +308,7 @@ TEMPLATE_TEST_CASE("Test all kernels give the same results for matrices",
         testMultiQubitOp<TestType>(re, num_qubits, 3, inverse);
         testMultiQubitOp<TestType>(re, num_qubits, 4, inverse);
         testMultiQubitOp<TestType>(re, num_qubits, 5, inverse);
+        // Unsorted wires on fewer qubits, e.g. {3, 1, 2}
+        testMultiQubitOp<TestType>(re, num_qubits - 1, 3, inverse);
     }
 }
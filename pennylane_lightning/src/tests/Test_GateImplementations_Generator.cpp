@@ -1,3 +1,6 @@
+#include "DynamicDispatcher.hpp"
+#include "GeneratorOverlap.hpp"
+#include "LinearAlgebra.hpp"
 #include "OpToMemberFuncPtr.hpp"
 #include "SelectKernel.hpp"
 #include "TestHelpers.hpp"
@@ -176,3 +179,49 @@ TEMPLATE_TEST_CASE("Test all generators of all kernels",
 
     testAllGeneratorsAndKernels<PrecisionT, ParamT, TestKernels>(re);
 }
+
+TEMPLATE_TEST_CASE("pauliGeneratorOverlap matches the generator kernels",
+                   "[GateImplementations_Generator]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 4;
+    const auto phi = createRandomState<PrecisionT>(re, num_qubits);
+    const auto psi = createRandomState<PrecisionT>(re, num_qubits);
+    const auto &dispatcher = DynamicDispatcher<PrecisionT>::getInstance();
+
+    for (const auto &[gntr_op, gntr_name] : Constant::generator_names) {
+        const size_t num_wires =
+            Util::array_has_elt(Constant::multi_qubit_generators, gntr_op)
+                ? 3
+                : Util::lookup(Constant::generator_wires, gntr_op);
+        // Not sorted to test the order of the wires
+        const std::vector<size_t> wires{3, 1, 0};
+        const std::vector<size_t> op_wires(wires.begin(),
+                                           wires.begin() + num_wires);
+
+        const auto term =
+            pauliGeneratorTerm<PrecisionT>(gntr_op, num_qubits, op_wires);
+        if (gntr_name.find("Excitation") != std::string_view::npos) {
+            REQUIRE(!term);
+            continue;
+        }
+        DYNAMIC_SECTION("Generator " << gntr_name) {
+            REQUIRE(term);
+            auto mu = psi;
+            const PrecisionT scale = dispatcher.applyGenerator(
+                KernelType::LM, mu.data(), num_qubits, gntr_op, op_wires,
+                false);
+            const auto expected = scale * Util::innerProdC(phi, mu);
+            for (size_t num_threads : {1, 2}) {
+                const auto overlap =
+                    term->scale *
+                    pauliGeneratorOverlap(phi.data(), psi.data(), num_qubits,
+                                          *term, num_threads);
+                REQUIRE(std::real(overlap) ==
+                        Approx(std::real(expected)).margin(1e-6));
+                REQUIRE(std::imag(overlap) ==
+                        Approx(std::imag(expected)).margin(1e-6));
+            }
+        }
+    }
+}
@@ -5,6 +5,10 @@
 
 #include <catch2/catch.hpp>
 
+#include <random>
+#include <tuple>
+#include <vector>
+
 #if defined(_MSC_VER)
 #pragma warning(disable : 4305)
 #endif
@@ -991,3 +995,156 @@ TEMPLATE_TEST_CASE("GateImplementation::applyMatrix, inverse = true",
 
     testApplyMatrixInverseForKernels<PrecisionT, AvailableKernels>();
 }
+
+TEMPLATE_TEST_CASE("GateImplementationsLM::applyControlledMatrix",
+                   "[GateImplementations_Matrix]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    using Gates::GateImplementationsLM;
+
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+    const auto margin = PrecisionT{1e-5};
+
+    // Reference computed amplitude by amplitude
+    const auto applyReference = [num_qubits](
+                                    const auto &st, const auto &mat,
+                                    const std::vector<size_t> &controlled_wires,
+                                    const std::vector<bool> &controlled_values,
+                                    const std::vector<size_t> &wires) {
+        const auto bit = [num_qubits](size_t idx, size_t wire) {
+            return (idx >> (num_qubits - 1 - wire)) & 1U;
+        };
+        const size_t dim = Util::exp2(wires.size());
+        std::vector<ComplexPrecisionT> res(st.size());
+        for (size_t idx = 0; idx < st.size(); idx++) {
+            bool active = true;
+            for (size_t k = 0; k < controlled_wires.size(); k++) {
+                active = active && (bit(idx, controlled_wires[k]) ==
+                                    static_cast<size_t>(controlled_values[k]));
+            }
+            if (!active) {
+                res[idx] = st[idx];
+                continue;
+            }
+            size_t row = 0;
+            for (const size_t wire : wires) {
+                row = (row << 1U) | bit(idx, wire);
+            }
+            for (size_t col = 0; col < dim; col++) {
+                size_t src = idx;
+                for (size_t k = 0; k < wires.size(); k++) {
+                    const size_t shift = num_qubits - 1 - wires[k];
+                    const size_t value = (col >> (wires.size() - 1 - k)) & 1U;
+                    src = (src & ~(size_t{1U} << shift)) | (value << shift);
+                }
+                res[idx] += mat[row * dim + col] * st[src];
+            }
+        }
+        return res;
+    };
+
+    const std::vector<std::tuple<std::vector<size_t>, std::vector<bool>,
+                                 std::vector<size_t>>>
+        cases{{{0}, {true}, {4}},
+              {{3, 1}, {true, false}, {2}},
+              {{0, 2, 4}, {false, true, true}, {1}},
+              {{4}, {false}, {0, 2}},
+              {{1, 3, 0}, {true, true, false}, {4, 2}}};
+
+    for (const auto &[controlled_wires, controlled_values, wires] : cases) {
+        const auto ini_st = createRandomState<PrecisionT>(re, num_qubits);
+        const auto matrix = randomUnitary<PrecisionT>(re, wires.size());
+        const size_t dim = Util::exp2(wires.size());
+        std::vector<ComplexPrecisionT> matrix_adj(dim * dim);
+        for (size_t i = 0; i < dim; i++) {
+            for (size_t j = 0; j < dim; j++) {
+                matrix_adj[i * dim + j] = std::conj(matrix[j * dim + i]);
+            }
+        }
+
+        for (const bool inverse : {false, true}) {
+            const auto expected =
+                applyReference(ini_st, inverse ? matrix_adj : matrix,
+                               controlled_wires, controlled_values, wires);
+            auto st = ini_st;
+            GateImplementationsLM::applyControlledMatrix(
+                st.data(), num_qubits, matrix.data(), controlled_wires,
+                controlled_values, wires, inverse);
+            REQUIRE(st == approx(expected).margin(margin));
+        }
+    }
+
+    SECTION("Invalid arguments") {
+        auto st = createRandomState<PrecisionT>(re, num_qubits);
+        const auto matrix = randomUnitary<PrecisionT>(re, 1);
+        PL_CHECK_THROWS_MATCHES(GateImplementationsLM::applyControlledMatrix(
+                                    st.data(), num_qubits, matrix.data(),
+                                    {0, 1}, {true}, {2}, false),
+                                Util::LightningException,
+                                "number of control wires and values");
+        PL_CHECK_THROWS_MATCHES(GateImplementationsLM::applyControlledMatrix(
+                                    st.data(), num_qubits, matrix.data(), {1},
+                                    {true}, {1}, false),
+                                Util::LightningException, "must be distinct");
+        PL_CHECK_THROWS_MATCHES(GateImplementationsLM::applyControlledMatrix(
+                                    st.data(), num_qubits, matrix.data(), {5},
+                                    {true}, {1}, false),
+                                Util::LightningException,
+                                "Invalid wire index");
+    }
+}
+
+TEMPLATE_TEST_CASE("GateImplementationsLM::applyDiagonal",
+                   "[GateImplementations_Matrix]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    using Gates::GateImplementationsLM;
+
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+    std::uniform_real_distribution<PrecisionT> phase_dist(-M_PI, M_PI);
+
+    const std::vector<std::vector<size_t>> all_wires{
+        {3}, {0, 4}, {4, 0}, {3, 1, 2}, {2, 0, 4, 1}, {0, 1, 2, 3, 4}};
+
+    for (const auto &wires : all_wires) {
+        const auto ini_st = createRandomState<PrecisionT>(re, num_qubits);
+        const size_t dim = Util::exp2(wires.size());
+        std::vector<ComplexPrecisionT> diag(dim);
+        std::vector<ComplexPrecisionT> matrix(dim * dim);
+        for (size_t i = 0; i < dim; i++) {
+            diag[i] = std::polar(PrecisionT{1.0}, phase_dist(re));
+            matrix[i * dim + i] = diag[i];
+        }
+
+        for (const bool inverse : {false, true}) {
+            auto expected = ini_st;
+            GateImplementationsLM::applyMultiQubitOp(
+                expected.data(), num_qubits, matrix.data(), wires, inverse);
+            auto st = ini_st;
+            GateImplementationsLM::applyDiagonal(st.data(), num_qubits,
+                                                 diag.data(), wires, inverse);
+            REQUIRE(st == approx(expected).margin(1e-5));
+        }
+    }
+
+    SECTION("Invalid arguments") {
+        auto st = createRandomState<PrecisionT>(re, num_qubits);
+        const std::vector<ComplexPrecisionT> diag(4, 1.0);
+        PL_CHECK_THROWS_MATCHES(GateImplementationsLM::applyDiagonal(
+                                    st.data(), num_qubits, diag.data(), {},
+                                    false),
+                                Util::LightningException,
+                                "Number of wires must be larger than 0");
+        PL_CHECK_THROWS_MATCHES(GateImplementationsLM::applyDiagonal(
+                                    st.data(), num_qubits, diag.data(),
+                                    {1, 1}, false),
+                                Util::LightningException, "must be distinct");
+        PL_CHECK_THROWS_MATCHES(GateImplementationsLM::applyDiagonal(
+                                    st.data(), num_qubits, diag.data(),
+                                    {0, 5}, false),
+                                Util::LightningException,
+                                "Invalid wire index");
+    }
+}
@@ -92,6 +92,43 @@ TEST_CASE("getIndicesAfterExclusion", "[GateUtil]") {
     }
 }
 
+TEST_CASE("ExternalIndices", "[GateUtil]") {
+    const size_t num_qubits = 5;
+    for (const auto &wires : std::vector<std::vector<size_t>>{
+             {}, {0}, {4}, {1, 2}, {3, 1, 0}, {0, 1, 2, 3, 4}}) {
+        const ExternalIndices external(wires, num_qubits);
+        const auto expected = generateBitPatterns(
+            getIndicesAfterExclusion(wires, num_qubits), num_qubits);
+        std::vector<size_t> indices(external.begin(), external.end());
+        std::sort(indices.begin(), indices.end());
+        auto sorted_expected = expected;
+        std::sort(sorted_expected.begin(), sorted_expected.end());
+        CHECK(indices == sorted_expected);
+        CHECK(external.size() == expected.size());
+    }
+}
+
+TEST_CASE("cachedGateIndices", "[GateUtil]") {
+    const size_t num_qubits = 4;
+    const std::vector<size_t> wires{2, 0};
+    const auto &indices = cachedGateIndices(wires, num_qubits);
+    CHECK(indices.internal == generateBitPatterns(wires, num_qubits));
+
+    SECTION("Same wires reuse the cached indices") {
+        CHECK(&cachedGateIndices(wires, num_qubits) == &indices);
+        CHECK(&cachedGateIndices(wires, num_qubits + 1) != &indices);
+        CHECK(&cachedGateIndices({0, 2}, num_qubits) != &indices);
+    }
+
+    SECTION("Recently used indices are not evicted") {
+        for (size_t i = 0; i + 1 < gate_indices_cache_size; i++) {
+            [[maybe_unused]] const auto &other =
+                cachedGateIndices({i}, 16);
+        }
+        CHECK(&cachedGateIndices(wires, num_qubits) == &indices);
+    }
+}
+
 template <class GateImplementation> void testKernel() {
     REQUIRE(implementedGatesForKernel(GateImplementation::kernel_id) ==
             std::vector(std::begin(GateImplementation::implemented_gates),
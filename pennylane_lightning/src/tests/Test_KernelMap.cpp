@@ -1,3 +1,4 @@
+#include "CPUMemoryModel.hpp"
 #include "Constant.hpp"
 #include "ConstantUtil.hpp"
 #include "KernelMap.hpp"
@@ -6,6 +7,10 @@
 
 #include <catch2/catch.hpp>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace Pennylane;
 using namespace Pennylane::KernelMap;
 
@@ -95,6 +100,86 @@ TEST_CASE("Test several limiting cases of default kernels", "[KernelMap]") {
                 }
             });
     }
+    SECTION("Multiple threads, large number of qubits") {
+        // With OpenMP, the multi-threaded LM kernel is used for all
+        // operations it implements.
+        auto gate_map = instance.getKernelMap(28, Threading::MultiThread,
+                                              CPUMemoryModel::Unaligned);
+        const auto expected = Util::Constant::use_openmp
+                                  ? Gates::KernelType::ParallelLM
+                                  : Gates::KernelType::LM;
+        REQUIRE(gate_map[Gates::GateOperation::PauliX] == expected);
+        REQUIRE(gate_map[Gates::GateOperation::CNOT] == expected);
+        REQUIRE(gate_map[Gates::GateOperation::MultiRZ] == expected);
+        REQUIRE(gate_map[Gates::GateOperation::Toffoli] ==
+                Gates::KernelType::PI);
+    }
+    SECTION("Multiple threads, small number of qubits") {
+        auto gate_map = instance.getKernelMap(4, Threading::MultiThread,
+                                              CPUMemoryModel::Unaligned);
+        REQUIRE(gate_map[Gates::GateOperation::PauliX] ==
+                Gates::KernelType::LM);
+    }
+}
+
+TEST_CASE("Test default kernels for aligned memory models", "[KernelMap]") {
+    using Gates::GateOperation;
+    using Gates::KernelType;
+    auto &instance = OperationKernelMap<Gates::GateOperation>::getInstance();
+
+    SECTION("Aligned128") {
+        auto gate_map = instance.getKernelMap(20, Threading::SingleThread,
+                                              CPUMemoryModel::Aligned128);
+        if (hasNEONKernels()) {
+            REQUIRE(gate_map[GateOperation::PauliX] == KernelType::NEON);
+            REQUIRE(gate_map[GateOperation::CNOT] == KernelType::NEON);
+        } else {
+            REQUIRE(gate_map[GateOperation::PauliX] == KernelType::LM);
+            REQUIRE(gate_map[GateOperation::CNOT] == KernelType::LM);
+        }
+        REQUIRE(gate_map[GateOperation::Toffoli] == KernelType::PI);
+    }
+
+    SECTION("Aligned256") {
+        auto gate_map = instance.getKernelMap(20, Threading::SingleThread,
+                                              CPUMemoryModel::Aligned256);
+        if (hasAVX2Kernels()) {
+            REQUIRE(gate_map[GateOperation::PauliX] == KernelType::AVX2);
+            REQUIRE(gate_map[GateOperation::CNOT] == KernelType::AVX2);
+        } else if (hasNEONKernels()) {
+            REQUIRE(gate_map[GateOperation::PauliX] == KernelType::NEON);
+            REQUIRE(gate_map[GateOperation::CNOT] == KernelType::NEON);
+        } else {
+            REQUIRE(gate_map[GateOperation::PauliX] == KernelType::LM);
+            REQUIRE(gate_map[GateOperation::CNOT] == KernelType::LM);
+        }
+        REQUIRE(gate_map[GateOperation::Toffoli] == KernelType::PI);
+    }
+
+    SECTION("Aligned512") {
+        auto gate_map = instance.getKernelMap(20, Threading::SingleThread,
+                                              CPUMemoryModel::Aligned512);
+        if (hasAVX512FKernels()) {
+            REQUIRE(gate_map[GateOperation::RX] == KernelType::AVX512);
+        } else if (hasAVX2Kernels()) {
+            REQUIRE(gate_map[GateOperation::RX] == KernelType::AVX2);
+        } else if (hasNEONKernels()) {
+            REQUIRE(gate_map[GateOperation::RX] == KernelType::NEON);
+        } else {
+            REQUIRE(gate_map[GateOperation::RX] == KernelType::LM);
+        }
+        REQUIRE(gate_map[GateOperation::MultiRZ] == KernelType::LM);
+    }
+
+    SECTION("Unaligned memory never uses SIMD kernels") {
+        auto gate_map = instance.getKernelMap(20, Threading::SingleThread,
+                                              CPUMemoryModel::Unaligned);
+        for (const auto &[gate_op, kernel] : gate_map) {
+            REQUIRE(kernel != KernelType::AVX2);
+            REQUIRE(kernel != KernelType::AVX512);
+            REQUIRE(kernel != KernelType::NEON);
+        }
+    }
 }
 
 TEST_CASE("Test KernelMap functionalities", "[KernelMap]") {
@@ -132,3 +217,46 @@ TEST_CASE("Test KernelMap functionalities", "[KernelMap]") {
             Util::LightningException, "does not exist");
     }
 }
+
+TEST_CASE("Test concurrent KernelMap lookups", "[KernelMap]") {
+    using Gates::GateOperation;
+    using Gates::KernelType;
+    auto &instance = OperationKernelMap<Gates::GateOperation>::getInstance();
+    const auto original_kernel = instance.getKernelMap(
+        24, Threading::SingleThread,
+        CPUMemoryModel::Unaligned)[GateOperation::PauliX];
+
+    const size_t num_threads = 4;
+    std::atomic<bool> consistent{true};
+    std::vector<std::thread> readers;
+    for (size_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+        readers.emplace_back([&instance, &consistent, original_kernel] {
+            // Use more qubit numbers than cached to update the cache
+            for (size_t iter = 0; iter < 200; iter++) {
+                const auto kernel = instance.getKernelMap(
+                    24 - iter % 20, Threading::SingleThread,
+                    CPUMemoryModel::Unaligned)[GateOperation::PauliX];
+                if (kernel != original_kernel && kernel != KernelType::PI) {
+                    consistent = false;
+                }
+            }
+        });
+    }
+    for (size_t iter = 0; iter < 50; iter++) {
+        instance.assignKernelForOp(GateOperation::PauliX,
+                                   Threading::SingleThread,
+                                   CPUMemoryModel::Unaligned, 100,
+                                   Util::full_domain<size_t>(), KernelType::PI);
+        instance.removeKernelForOp(GateOperation::PauliX,
+                                   Threading::SingleThread,
+                                   CPUMemoryModel::Unaligned, 100);
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    REQUIRE(consistent);
+    REQUIRE(instance.getKernelMap(
+                24, Threading::SingleThread,
+                CPUMemoryModel::Unaligned)[GateOperation::PauliX] ==
+            original_kernel);
+}
@@ -0,0 +1,149 @@
+#include "KernelMap.hpp"
+#include "KernelProfile.hpp"
+#include "RuntimeInfo.hpp"
+#include "TestHelpers.hpp"
+#include "Util.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+/**
+ * @file
+ * Tests reading and loading kernel profiles.
+ */
+
+using namespace Pennylane;
+using namespace Pennylane::KernelMap;
+
+using Gates::GateOperation;
+using Gates::KernelType;
+
+TEST_CASE("readKernelProfile", "[KernelProfile]") {
+    const std::string profile = "# kernel profile\n"
+                                "PauliX SingleThread Unaligned 1 4 PI\n"
+                                "[ CPU A ]\n"
+                                "PauliY SingleThread Unaligned 1 4 PI\n"
+                                "[CPU B]\n"
+                                "PauliZ SingleThread Unaligned 1 4 PI\n";
+    const auto read = [&](const std::string &brand) {
+        std::istringstream stream(profile);
+        return readKernelProfile(stream, brand);
+    };
+
+    const auto read_text = [](const std::string &text) {
+        std::istringstream stream(text);
+        return readKernelProfile(stream, "CPU A");
+    };
+
+    SECTION("Sections are selected by the CPU brand") {
+        const auto table_a = read("CPU A ");
+        REQUIRE(table_a.gates.size() == 2);
+        REQUIRE(table_a.gates[0].op == GateOperation::PauliX);
+        REQUIRE(table_a.gates[1].op == GateOperation::PauliY);
+
+        const auto table_b = read("CPU B");
+        REQUIRE(table_b.gates.size() == 2);
+        REQUIRE(table_b.gates[1].op == GateOperation::PauliZ);
+
+        const auto table_c = read("CPU C");
+        REQUIRE(table_c.gates.size() == 1);
+        REQUIRE(table_c.gates[0].op == GateOperation::PauliX);
+    }
+
+    SECTION("Round trip") {
+        TunedKernelTable table;
+        table.gates.push_back({GateOperation::Hadamard, Threading::MultiThread,
+                               CPUMemoryModel::Unaligned,
+                               Util::IntegerInterval<size_t>{2, 6},
+                               KernelType::LM});
+        std::stringstream stream;
+        writeKernelProfile(stream, "CPU A", TunedKernelTable{});
+        writeKernelProfile(stream, "CPU B", table);
+        const auto read_table = readKernelProfile(stream, "CPU B");
+        REQUIRE(read_table.gates.size() == 1);
+        REQUIRE(read_table.gates[0].op == GateOperation::Hadamard);
+        REQUIRE(read_table.gates[0].threading == Threading::MultiThread);
+        REQUIRE(read_table.gates[0].interval.max() == 6);
+    }
+
+    SECTION("Invalid section header") {
+        const std::string invalid = "[CPU A\n";
+        PL_CHECK_THROWS_MATCHES(read_text(invalid), Util::LightningException,
+                                "Invalid section header");
+    }
+}
+
+TEST_CASE("filterAvailableKernels", "[KernelProfile]") {
+    const auto interval = Util::full_domain<size_t>();
+    TunedKernelTable table;
+    table.gates.push_back({GateOperation::Toffoli, Threading::MultiThread,
+                           CPUMemoryModel::Unaligned, interval,
+                           KernelType::ParallelLM});
+    table.gates.push_back({GateOperation::Toffoli, Threading::MultiThread,
+                           CPUMemoryModel::Unaligned, interval,
+                           KernelType::PI});
+    table.gates.push_back({GateOperation::PauliX, Threading::SingleThread,
+                           CPUMemoryModel::Aligned512, interval,
+                           KernelType::AVX512});
+
+    const auto filtered = filterAvailableKernels(table);
+    const bool avx512 = hasAVX512FKernels();
+    REQUIRE(filtered.gates.size() == (avx512 ? 2 : 1));
+    REQUIRE(filtered.gates[0].kernel == KernelType::PI);
+}
+
+TEST_CASE("loadKernelProfile", "[KernelProfile]") {
+    const std::string env{kernel_profile_env};
+    const std::string path = "test_kernel_profile.txt";
+    auto &instance = OperationKernelMap<GateOperation>::getInstance();
+    const auto kernelFor = [&](size_t num_qubits) {
+        return instance.getKernelMap(
+            num_qubits, Threading::SingleThread,
+            CPUMemoryModel::Unaligned)[GateOperation::Hadamard];
+    };
+    const auto default_kernel = kernelFor(6);
+    const auto other_kernel =
+        (default_kernel == KernelType::PI) ? KernelType::LM : KernelType::PI;
+
+    SECTION("Without the environment variable") {
+        unsetenv(env.c_str());
+        REQUIRE(!loadKernelProfile());
+    }
+
+    SECTION("Missing file") {
+        setenv(env.c_str(), "no_such_kernel_profile.txt", 1);
+        PL_CHECK_THROWS_MATCHES(loadKernelProfile(), Util::LightningException,
+                                "Cannot open the kernel profile");
+        unsetenv(env.c_str());
+    }
+
+    SECTION("Kernels for this CPU are assigned") {
+        TunedKernelTable table;
+        table.gates.push_back({GateOperation::Hadamard,
+                               Threading::SingleThread,
+                               CPUMemoryModel::Unaligned,
+                               Util::IntegerInterval<size_t>{4, 8},
+                               other_kernel});
+        {
+            std::ofstream file(path);
+            writeKernelProfile(file, Util::RuntimeInfo::brand(), table);
+        }
+        setenv(env.c_str(), path.c_str(), 1);
+        REQUIRE(loadKernelProfile());
+        unsetenv(env.c_str());
+        std::remove(path.c_str());
+
+        REQUIRE(kernelFor(2) == default_kernel);
+        REQUIRE(kernelFor(6) == other_kernel);
+
+        instance.removeKernelForOp(GateOperation::Hadamard,
+                                   Threading::SingleThread,
+                                   CPUMemoryModel::Unaligned, tuned_priority);
+        REQUIRE(kernelFor(6) == default_kernel);
+    }
+}
@@ -0,0 +1,161 @@
+#include "KernelMap.hpp"
+#include "KernelTuner.hpp"
+#include "TestHelpers.hpp"
+#include "Util.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Pennylane;
+using namespace Pennylane::KernelMap;
+
+using Catch::Matchers::Contains;
+
+TEST_CASE("KernelTuner::tune", "[KernelTuner]") {
+    using Gates::GateOperation;
+    using Gates::KernelType;
+    const std::vector<size_t> sample_num_qubits{4, 6};
+
+    const auto tuned = KernelTuner<double>::tune<GateOperation>(
+        Threading::SingleThread, CPUMemoryModel::Unaligned, sample_num_qubits,
+        1);
+
+    // Every gate acting on at most 4 wires has a kernel from 4 qubits on
+    Util::for_each_enum<GateOperation>([&](GateOperation gate_op) {
+        size_t num_covered = 0;
+        for (const auto &elt : tuned) {
+            if (elt.op != gate_op) {
+                continue;
+            }
+            REQUIRE(elt.threading == Threading::SingleThread);
+            REQUIRE(elt.memory_model == CPUMemoryModel::Unaligned);
+            REQUIRE(elt.kernel != KernelType::ParallelLM);
+            REQUIRE(elt.kernel != KernelType::AVX2);
+            REQUIRE(elt.kernel != KernelType::AVX512);
+            num_covered += elt.interval(4) + elt.interval(5) +
+                           elt.interval(6) + elt.interval(30);
+            REQUIRE(!elt.interval(3));
+        }
+        REQUIRE(num_covered == 4);
+    });
+
+    SECTION("Invalid numbers of qubits") {
+        PL_CHECK_THROWS_MATCHES(
+            KernelTuner<double>::tune<GateOperation>(
+                Threading::SingleThread, CPUMemoryModel::Unaligned, {6, 4}, 1),
+            Util::LightningException, "strictly increasing");
+        PL_CHECK_THROWS_MATCHES(
+            KernelTuner<double>::tune<GateOperation>(
+                Threading::SingleThread, CPUMemoryModel::Unaligned, {}, 1),
+            Util::LightningException, "strictly increasing");
+    }
+}
+
+TEST_CASE("KernelTuner::timeKernel", "[KernelTuner]") {
+    using Gates::KernelType;
+    REQUIRE(KernelTuner<float>::timeKernel(Gates::MatrixOperation::TwoQubitOp,
+                                           KernelType::LM, 5,
+                                           CPUMemoryModel::Unaligned,
+                                           2) >= 0.0);
+    PL_CHECK_THROWS_MATCHES(
+        KernelTuner<float>::timeKernel(Gates::GateOperation::Toffoli,
+                                       KernelType::PI, 2,
+                                       CPUMemoryModel::Unaligned, 1),
+        Util::LightningException, "more wires than qubits");
+}
+
+TEST_CASE("Assign, write, and read tuned kernels", "[KernelTuner]") {
+    using Gates::GateOperation;
+    using Gates::GeneratorOperation;
+    using Gates::KernelType;
+    using Gates::MatrixOperation;
+
+    TunedKernelTable table;
+    table.gates.push_back({GateOperation::PauliX, Threading::SingleThread,
+                           CPUMemoryModel::Unaligned,
+                           Util::IntegerInterval<size_t>{8, 12},
+                           KernelType::PI});
+    table.gates.push_back({GateOperation::PauliX, Threading::SingleThread,
+                           CPUMemoryModel::Unaligned,
+                           Util::larger_than_equal_to<size_t>(12),
+                           KernelType::LM});
+    table.generators.push_back(
+        {GeneratorOperation::RX, Threading::MultiThread,
+         CPUMemoryModel::Aligned256, Util::IntegerInterval<size_t>{3, 5},
+         KernelType::PI});
+    table.matrices.push_back({MatrixOperation::TwoQubitOp,
+                              Threading::SingleThread,
+                              CPUMemoryModel::Unaligned,
+                              Util::IntegerInterval<size_t>{2, 20},
+                              KernelType::PI});
+
+    SECTION("Round trip") {
+        std::stringstream stream;
+        writeTunedKernels(stream, table);
+        const auto read = readTunedKernels(stream);
+
+        REQUIRE(read.gates.size() == 2);
+        REQUIRE(read.generators.size() == 1);
+        REQUIRE(read.matrices.size() == 1);
+        REQUIRE(read.gates[1].op == GateOperation::PauliX);
+        REQUIRE(read.gates[1].kernel == KernelType::LM);
+        REQUIRE(read.gates[1].interval.min() == 12);
+        REQUIRE(read.gates[1].interval.max() == table.gates[1].interval.max());
+        REQUIRE(read.generators[0].op == GeneratorOperation::RX);
+        REQUIRE(read.generators[0].threading == Threading::MultiThread);
+        REQUIRE(read.generators[0].memory_model == CPUMemoryModel::Aligned256);
+        REQUIRE(read.matrices[0].op == MatrixOperation::TwoQubitOp);
+        REQUIRE(read.matrices[0].interval.min() == 2);
+        REQUIRE(read.matrices[0].interval.max() == 20);
+    }
+
+    SECTION("Invalid lines") {
+        const auto read = [](const std::string &text) {
+            std::istringstream stream(text);
+            return readTunedKernels(stream);
+        };
+        PL_CHECK_THROWS_MATCHES(read("Unknown SingleThread Unaligned 1 2 LM"),
+                                Util::LightningException, "Unknown operation");
+        PL_CHECK_THROWS_MATCHES(read("PauliX SingleThread Unaligned 1 2 Fast"),
+                                Util::LightningException, "Invalid threading");
+        PL_CHECK_THROWS_MATCHES(read("PauliX SingleThread Unaligned 2 2 LM"),
+                                Util::LightningException, "Invalid line");
+        PL_CHECK_THROWS_MATCHES(read("PauliX SingleThread"),
+                                Util::LightningException, "Invalid line");
+        REQUIRE(read("# comment\n\n").gates.empty());
+    }
+
+    SECTION("Assign") {
+        auto &instance = OperationKernelMap<GateOperation>::getInstance();
+        const auto kernelFor = [&](size_t num_qubits) {
+            return instance.getKernelMap(
+                num_qubits, Threading::SingleThread,
+                CPUMemoryModel::Unaligned)[GateOperation::PauliX];
+        };
+        const auto default_kernel = kernelFor(4);
+
+        assignTunedKernels(table);
+        REQUIRE(kernelFor(4) == default_kernel);
+        REQUIRE(kernelFor(10) == KernelType::PI);
+        REQUIRE(kernelFor(16) == KernelType::LM);
+
+        // Assigning again replaces previously tuned kernels
+        assignTunedKernels(TunedKernelTable{{table.gates[0]}, {}, {}});
+        REQUIRE(kernelFor(10) == KernelType::PI);
+        REQUIRE(kernelFor(16) == default_kernel);
+
+        instance.removeKernelForOp(GateOperation::PauliX,
+                                   Threading::SingleThread,
+                                   CPUMemoryModel::Unaligned, tuned_priority);
+        OperationKernelMap<GeneratorOperation>::getInstance().removeKernelForOp(
+            GeneratorOperation::RX, Threading::MultiThread,
+            CPUMemoryModel::Aligned256, tuned_priority);
+        OperationKernelMap<MatrixOperation>::getInstance().removeKernelForOp(
+            MatrixOperation::TwoQubitOp, Threading::SingleThread,
+            CPUMemoryModel::Unaligned, tuned_priority);
+        REQUIRE(kernelFor(10) == default_kernel);
+    }
+}
@@ -67,6 +67,20 @@ TEMPLATE_TEST_CASE("apply_Sparse_Matrix_Kokkos", "[Kokkos Sparse]", float,
                 REQUIRE(result_refs[vec] == approx(result).margin(1e-6));
             };
         }
+#ifdef _ENABLE_KOKKOS
+        SECTION("Testing a persistent sparse operator:") {
+            KokkosSparseOperator<TestType> op(
+                row_map.data(), static_cast<long>(row_map.size()) - 1,
+                entries.data(), values.data(),
+                static_cast<long>(values.size()));
+            REQUIRE(op.getNumRows() == data_size);
+            std::vector<complex<TestType>> result(data_size);
+            for (size_t vec = 0; vec < vectors.size(); vec++) {
+                op.apply(vectors[vec].data(), result.data());
+                REQUIRE(result_refs[vec] == approx(result).margin(1e-6));
+            }
+        }
+#endif
     } else {
         SECTION(
             "Testing if apply_Sparse_Matrix_Kokkos is throwing an exception:") {
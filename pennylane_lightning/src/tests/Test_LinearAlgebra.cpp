@@ -1,5 +1,7 @@
 #include <algorithm>
 #include <complex>
+#include <random>
+#include <utility>
 #include <vector>
 
 #include <catch2/catch.hpp>
@@ -129,6 +131,69 @@ TEMPLATE_TEST_CASE("Test linear algebra functions", "[Util][LinearAlgebra]",
             CHECK(imag(result) == Approx(imag(expected_result)).margin(1e-7));
         }
     }
+    SECTION("innerProdsC") {
+        std::mt19937 re{1337};
+        // Sizes below, at and above multiples of the tile
+        for (size_t sz : {5, 8, 19}) {
+            const size_t num_vecs = 3;
+            // 64 random elements
+            const auto data = Util::randomUnitary<TestType>(re, 3);
+            std::vector<std::vector<std::complex<TestType>>> vs;
+            std::vector<const std::complex<TestType> *> ptrs;
+            std::vector<std::complex<TestType>> w_data(
+                data.begin(), data.begin() + static_cast<ptrdiff_t>(sz));
+            for (size_t vec = 0; vec < num_vecs; vec++) {
+                vs.emplace_back(data.begin() + static_cast<ptrdiff_t>(vec + 1),
+                                data.begin() +
+                                    static_cast<ptrdiff_t>(vec + 1 + sz));
+            }
+            for (const auto &v : vs) {
+                ptrs.push_back(v.data());
+            }
+            for (size_t num_threads : {1, 2}) {
+                std::vector<std::complex<TestType>> results(num_vecs);
+                Util::innerProdsC<TestType, 4>(ptrs.data(), num_vecs,
+                                               w_data.data(), sz,
+                                               results.data(), num_threads);
+                for (size_t vec = 0; vec < num_vecs; vec++) {
+                    const auto expected = Util::innerProdC<TestType, 1>(
+                        vs[vec].data(), w_data.data(), sz);
+                    CHECK(isApproxEqual(results[vec], expected));
+                }
+            }
+        }
+    }
+    SECTION("innerProdCKahan") {
+        std::mt19937 re{1337};
+        std::normal_distribution<TestType> dist;
+        // Sizes below, at and above multiples of the chunk and of the lanes
+        for (size_t sz : {0, 3, 16, 37}) {
+            std::vector<std::complex<TestType>> data1(sz);
+            std::vector<std::complex<TestType>> data2(sz);
+            for (size_t i = 0; i < sz; i++) {
+                data1[i] = {dist(re), dist(re)};
+                data2[i] = {dist(re), dist(re)};
+            }
+            const auto expected =
+                Util::innerProdC<TestType, 1>(data1.data(), data2.data(), sz);
+            const auto result = Util::innerProdCKahan<TestType, 8>(
+                data1.data(), data2.data(), sz);
+            CAPTURE(sz);
+            CHECK(real(result) == Approx(real(expected)).margin(1e-5));
+            CHECK(imag(result) == Approx(imag(expected)).margin(1e-5));
+        }
+
+        // Small terms are not absorbed by large ones cancelling each other
+        const size_t num_small = 1000;
+        std::vector<std::complex<TestType>> data1(num_small + 2,
+                                                  {TestType{1e-16}, 0.0});
+        std::vector<std::complex<TestType>> data2(num_small + 2, {1.0, 0.0});
+        data1.front() = {1.0, 0.0};
+        data1.back() = {-1.0, 0.0};
+        const auto result = Util::innerProdCKahan<TestType, 64>(
+            data1.data(), data2.data(), data1.size());
+        CHECK(real(result) == Approx(num_small * 1e-16).epsilon(1e-3));
+    }
     SECTION("matrixVecProd") {
         SECTION("Simple Iterative with NoTranspose") {
             for (size_t m = 2; m < 8; m++) {
@@ -421,6 +486,26 @@ TEMPLATE_TEST_CASE("Test linear algebra functions", "[Util][LinearAlgebra]",
 
             CHECK(mat_t == approx(mat_t_exp));
         }
+        SECTION("Large Rectangular Matrix") {
+            // Several tiles, partial ones included, over multiple threads
+            for (const auto &[m, n] :
+                 {std::pair<size_t, size_t>{700, 300}, {300, 700}, {1, 513}}) {
+                std::vector<std::complex<TestType>> mat(m * n);
+                for (size_t idx = 0; idx < mat.size(); idx++) {
+                    mat[idx] = {static_cast<TestType>(idx % 1009),
+                                -static_cast<TestType>(idx / 1009)};
+                }
+                const auto mat_t = Util::Transpose(mat, m, n);
+                size_t num_mismatches = 0;
+                for (size_t row = 0; row < m; row++) {
+                    for (size_t col = 0; col < n; col++) {
+                        num_mismatches += static_cast<size_t>(
+                            mat_t[col * m + row] != mat[row * n + col]);
+                    }
+                }
+                CHECK(num_mismatches == 0);
+            }
+        }
         SECTION("Invalid Arguments") {
             using namespace Catch::Matchers;
             std::vector<std::complex<TestType>> mat(2 * 3, {1.0, 1.0});
@@ -633,3 +718,84 @@ TEMPLATE_TEST_CASE("Test linear algebra functions", "[Util][LinearAlgebra]",
         }
     }
 }
+
+TEMPLATE_TEST_CASE("Util::svd", "[Util][LinearAlgebra]", float, double) {
+    using ComplexT = std::complex<TestType>;
+    std::mt19937 re{1337};
+    std::normal_distribution<TestType> dist;
+
+    for (const auto &[m, n] : std::vector<std::pair<size_t, size_t>>{
+             {6, 4}, {3, 7}, {5, 5}, {1, 3}}) {
+        DYNAMIC_SECTION("m = " << m << ", n = " << n) {
+            std::vector<ComplexT> mat(m * n);
+            for (auto &elt : mat) {
+                elt = ComplexT{dist(re), dist(re)};
+            }
+            const size_t k = std::min(m, n);
+            const auto res = Util::svd(mat.data(), m, n);
+            REQUIRE(res.u.size() == m * k);
+            REQUIRE(res.s.size() == k);
+            REQUIRE(res.vh.size() == k * n);
+            CHECK(std::is_sorted(res.s.rbegin(), res.s.rend()));
+
+            // U diag(S) V^\dagger reproduces the matrix
+            std::vector<ComplexT> us(m * k);
+            for (size_t row = 0; row < m; row++) {
+                for (size_t col = 0; col < k; col++) {
+                    us[row * k + col] = res.u[row * k + col] * res.s[col];
+                }
+            }
+            CHECK(Util::matrixMatProd(us, res.vh, m, n, k) ==
+                  approx(mat).margin(1e-4));
+
+            // U and V have orthonormal columns
+            std::vector<ComplexT> u_h(k * m);
+            for (size_t row = 0; row < m; row++) {
+                for (size_t col = 0; col < k; col++) {
+                    u_h[col * m + row] = std::conj(res.u[row * k + col]);
+                }
+            }
+            std::vector<ComplexT> v(n * k);
+            for (size_t row = 0; row < k; row++) {
+                for (size_t col = 0; col < n; col++) {
+                    v[col * k + row] = std::conj(res.vh[row * n + col]);
+                }
+            }
+            std::vector<ComplexT> identity(k * k);
+            for (size_t idx = 0; idx < k; idx++) {
+                identity[idx * k + idx] = 1.0;
+            }
+            CHECK(Util::matrixMatProd(u_h, res.u, k, k, m) ==
+                  approx(identity).margin(1e-4));
+            CHECK(Util::matrixMatProd(res.vh, v, k, k, n) ==
+                  approx(identity).margin(1e-4));
+        }
+    }
+
+    SECTION("Rank deficient matrix") {
+        // The outer product of (1, i) and (1, 2, 2) has the single singular
+        // value sqrt(2) * 3
+        const std::vector<ComplexT> mat{
+            {1, 0}, {2, 0}, {2, 0}, {0, 1}, {0, 2}, {0, 2}};
+        const auto res = Util::svd(mat.data(), 2, 3);
+        CHECK(res.s[0] == Approx(3 * std::sqrt(2.0)));
+        CHECK(res.s[1] == Approx(0.0).margin(1e-5));
+    }
+}
+
+TEST_CASE("Reductions over single precision data accumulate in double",
+          "[Util][LinearAlgebra]") {
+    // Summing 2^19 terms of 0.1 in single precision loses about three
+    // significant digits
+    constexpr size_t length = size_t{1U} << 19U;
+    const std::complex<float> elt{std::sqrt(0.1F), 0.0F};
+    const std::vector<std::complex<float>> data(length, elt);
+    const double expected =
+        static_cast<double>(std::norm(elt)) * static_cast<double>(length);
+
+    CHECK(std::real(Util::innerProdC(data, data)) ==
+          Approx(expected).epsilon(1e-6));
+    CHECK(std::real(Util::innerProd(data, data)) ==
+          Approx(expected).epsilon(1e-6));
+    CHECK(Util::squaredNorm(data) == Approx(expected).epsilon(1e-6));
+}
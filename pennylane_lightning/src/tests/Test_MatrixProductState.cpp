@@ -0,0 +1,138 @@
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "MatrixProductState.hpp"
+#include "Measures.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+
+namespace {
+template <class PrecisionT> struct TestCircuit {
+    std::vector<std::string> ops{"Hadamard", "CNOT",    "RX", "Toffoli",
+                                 "SWAP",     "CRY",     "IsingXY",
+                                 "RZ",       "PauliY",  "MultiRZ"};
+    std::vector<std::vector<size_t>> wires{
+        {0}, {0, 4}, {1}, {0, 1, 2}, {1, 3}, {2, 0}, {4, 1}, {0}, {1},
+        {0, 1, 3}};
+    std::vector<bool> inverses{false, false, true,  false, false,
+                               false, true,  false, false, false};
+    std::vector<std::vector<PrecisionT>> params{
+        {}, {}, {0.3}, {}, {}, {-0.4}, {1.2}, {0.7}, {}, {0.5}};
+};
+} // namespace
+
+TEMPLATE_TEST_CASE("MatrixProductState::applyOperations",
+                   "[MatrixProductState]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 5;
+    const TestCircuit<PrecisionT> circuit;
+
+    StateVectorManagedCPU<PrecisionT> expected(num_qubits);
+    expected.applyOperations(circuit.ops, circuit.wires, circuit.inverses,
+                             circuit.params);
+
+    MatrixProductState<PrecisionT> mps(num_qubits);
+    mps.applyOperations(circuit.ops, circuit.wires, circuit.inverses,
+                        circuit.params);
+    REQUIRE(mps.getFullState() ==
+            approx(expected.getDataVector()).margin(1e-5));
+    REQUIRE(mps.getTruncationError() == Approx(0.0).margin(1e-6));
+    REQUIRE(mps.getNorm2() == Approx(1.0).margin(1e-5));
+
+    SECTION("Measurements") {
+        Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> measures(
+            expected);
+        for (const auto &wires :
+             std::vector<std::vector<size_t>>{{3}, {4, 1}, {0, 2, 3}}) {
+            REQUIRE(mps.probs(wires) ==
+                    approx(measures.probs(wires)).margin(1e-5));
+        }
+        REQUIRE(mps.expval("PauliX", {2}) ==
+                Approx(measures.expval("PauliX", {2})).margin(1e-5));
+        REQUIRE(mps.expval("PauliY", {4}) ==
+                Approx(measures.expval("PauliY", {4})).margin(1e-5));
+
+        // Z on wire 3 tensor X on wire 0
+        const std::vector<std::complex<PrecisionT>> zx{
+            0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0};
+        REQUIRE(mps.expval(zx, {3, 0}) ==
+                Approx(measures.expval(zx, {3, 0})).margin(1e-5));
+        REQUIRE(mps.var("PauliZ", {1}) ==
+                Approx(measures.var("PauliZ", {1})).margin(1e-5));
+    }
+
+    SECTION("Matrices on unsorted wires") {
+        std::mt19937_64 re{1337};
+        const auto matrix = Util::randomUnitary<PrecisionT>(re, 2);
+        expected.applyMatrix(matrix, {4, 1}, true);
+        mps.applyMatrix(matrix, {4, 1}, true);
+        REQUIRE(mps.getFullState() ==
+                approx(expected.getDataVector()).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("MatrixProductState::truncation", "[MatrixProductState]",
+                   float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 40;
+
+    SECTION("A GHZ state needs bond dimension 2") {
+        MatrixProductState<PrecisionT> mps(num_qubits, 2);
+        mps.applyOperation("Hadamard", {0});
+        for (size_t wire = 0; wire + 1 < num_qubits; wire++) {
+            mps.applyOperation("CNOT", {wire, wire + 1});
+        }
+        REQUIRE(mps.getBondDims() == std::vector<size_t>(num_qubits - 1, 2));
+        REQUIRE(mps.getTruncationError() == Approx(0.0).margin(1e-6));
+        const auto probs = mps.probs({0, num_qubits - 1});
+        REQUIRE(probs == approx(std::vector<PrecisionT>{0.5, 0, 0, 0.5})
+                             .margin(1e-5));
+        REQUIRE(mps.expval("PauliZ", {num_qubits / 2}) ==
+                Approx(0.0).margin(1e-5));
+    }
+
+    SECTION("Bond dimension and cutoff") {
+        const size_t depth = 4;
+        for (const auto &[max_bond_dim, cutoff] :
+             std::vector<std::pair<size_t, PrecisionT>>{{4, 0}, {0, 1e-2}}) {
+            MatrixProductState<PrecisionT> mps(num_qubits, max_bond_dim,
+                                               cutoff);
+            REQUIRE(mps.getMaxBondDim() == max_bond_dim);
+            REQUIRE(mps.getCutoff() == cutoff);
+            for (size_t layer = 0; layer < depth; layer++) {
+                for (size_t wire = 0; wire < num_qubits; wire++) {
+                    mps.applyOperation("RY", {wire}, false,
+                                       {static_cast<PrecisionT>(0.3 + wire)});
+                }
+                for (size_t wire = layer % 2; wire + 1 < num_qubits;
+                     wire += 2) {
+                    mps.applyOperation("CNOT", {wire, wire + 1});
+                }
+            }
+            const auto bond_dims = mps.getBondDims();
+            if (max_bond_dim > 0) {
+                REQUIRE(*std::max_element(bond_dims.begin(),
+                                          bond_dims.end()) <= max_bond_dim);
+            }
+            REQUIRE(mps.getTruncationError() > 0);
+            REQUIRE(mps.getNorm2() == Approx(1.0).margin(1e-4));
+        }
+    }
+
+    SECTION("Invalid arguments") {
+        PL_CHECK_THROWS_MATCHES(MatrixProductState<PrecisionT>(0),
+                                Util::LightningException, "must be positive");
+        MatrixProductState<PrecisionT> mps(3);
+        PL_CHECK_THROWS_MATCHES(mps.setCutoff(-1), Util::LightningException,
+                                "must not be negative");
+        PL_CHECK_THROWS_MATCHES(mps.applyOperation("CNOT", {0, 3}),
+                                Util::LightningException,
+                                "Invalid wire index");
+    }
+}
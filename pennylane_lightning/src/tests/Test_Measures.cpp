@@ -1,7 +1,11 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <complex>
 #include <cstdio>
 #include <vector>
 
+#include "Gates.hpp"
 #include "Kokkos_Sparse.hpp"
 #include "Measures.hpp"
 #include "StateVectorManagedCPU.hpp"
@@ -10,6 +14,10 @@
 #include "TestHelpers.hpp"
 #include <catch2/catch.hpp>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 #if defined(_MSC_VER)
 #pragma warning(disable : 4305)
 #endif
@@ -66,6 +74,50 @@ TEST_CASE("Probabilities", "[Measures]") {
     }
 }
 
+TEMPLATE_TEST_CASE("Probabilities for a subset of wires", "[Measures]", float,
+                   double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 10;
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> Measurer(sv);
+
+    const std::vector<std::vector<size_t>> wires_list{
+        {}, {9}, {0, 9}, {7, 2, 4}, {3, 6, 1, 8, 0}, {9, 8, 7, 6, 5, 4, 3, 2}};
+
+    for (const auto &wires : wires_list) {
+        // Reference obtained by marginalizing over the sorted wires and
+        // transposing the result
+        const auto sorted_ind_wires = Util::sorting_indices(wires);
+        std::vector<size_t> sorted_wires(wires.size());
+        for (size_t pos = 0; pos < wires.size(); pos++) {
+            sorted_wires[pos] = wires[sorted_ind_wires[pos]];
+        }
+        const auto all_indices =
+            Gates::generateBitPatterns(sorted_wires, num_qubits);
+        const auto all_offsets = Gates::generateBitPatterns(
+            Gates::getIndicesAfterExclusion(sorted_wires, num_qubits),
+            num_qubits);
+        std::vector<PrecisionT> expected(all_indices.size(), 0.0);
+        for (size_t k = 0; k < all_indices.size(); k++) {
+            for (const auto offset : all_offsets) {
+                expected[k] += std::norm(init_state[all_indices[k] + offset]);
+            }
+        }
+        if (wires != sorted_wires) {
+            expected = Util::transpose_state_tensor(expected, sorted_ind_wires);
+        }
+        REQUIRE_THAT(Measurer.probs(wires),
+                     Catch::Approx(expected).margin(1e-6));
+    }
+
+    SECTION("Invalid wires") {
+        REQUIRE_THROWS(Measurer.probs({10}));
+    }
+}
+
 TEMPLATE_TEST_CASE("Expected Values", "[Measures]", float, double) {
     // Defining the State Vector that will be measured.
     auto Measured_StateVector = Initializing_StateVector<TestType>();
@@ -139,6 +191,186 @@ TEMPLATE_TEST_CASE("Expected Values", "[Measures]", float, double) {
     }
 }
 
+TEMPLATE_TEST_CASE("Expected Values without copying the statevector",
+                   "[Measures]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 6;
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> Measurer(sv);
+
+    // Reference value obtained by applying the matrix to a copy
+    const auto expval_ref = [&](const std::vector<ComplexPrecisionT> &matrix,
+                                const std::vector<size_t> &wires) {
+        StateVectorManagedCPU<PrecisionT> op_sv(sv);
+        op_sv.applyMatrix(matrix, wires);
+        return std::real(
+            innerProdC(sv.getData(), op_sv.getData(), sv.getLength()));
+    };
+
+    const std::vector<ComplexPrecisionT> PauliX = {0, 1, 1, 0};
+    const std::vector<ComplexPrecisionT> PauliY = {0, {0, -1}, {0, 1}, 0};
+    const std::vector<ComplexPrecisionT> PauliZ = {1, 0, 0, -1};
+    const std::vector<ComplexPrecisionT> Identity = {1, 0, 0, 1};
+
+    SECTION("Pauli words") {
+        const auto kron = [](const std::vector<ComplexPrecisionT> &lhs,
+                             const std::vector<ComplexPrecisionT> &rhs) {
+            const size_t dim_l = static_cast<size_t>(
+                std::sqrt(static_cast<double>(lhs.size())));
+            const size_t dim_r = static_cast<size_t>(
+                std::sqrt(static_cast<double>(rhs.size())));
+            const size_t dim = dim_l * dim_r;
+            std::vector<ComplexPrecisionT> res(dim * dim);
+            for (size_t i = 0; i < dim; i++) {
+                for (size_t j = 0; j < dim; j++) {
+                    res[i * dim + j] =
+                        lhs[(i / dim_r) * dim_l + (j / dim_r)] *
+                        rhs[(i % dim_r) * dim_r + (j % dim_r)];
+                }
+            }
+            return res;
+        };
+        const auto XYZ = kron(kron(PauliX, PauliY), PauliZ);
+        const auto YIY = kron(kron(PauliY, Identity), PauliY);
+        const auto ZZ = kron(PauliZ, PauliZ);
+
+        REQUIRE(Measurer.expvalPauliWord("XYZ", {4, 1, 2}) ==
+                Approx(expval_ref(XYZ, {4, 1, 2})).margin(1e-6));
+        REQUIRE(Measurer.expvalPauliWord("YIY", {0, 3, 5}) ==
+                Approx(expval_ref(YIY, {0, 3, 5})).margin(1e-6));
+        REQUIRE(Measurer.expvalPauliWord("ZZ", {5, 0}) ==
+                Approx(expval_ref(ZZ, {5, 0})).margin(1e-6));
+        REQUIRE(Measurer.expvalPauliWord("", {}) == Approx(1.0));
+        REQUIRE_THROWS(Measurer.expvalPauliWord("XA", {0, 1}));
+        REQUIRE_THROWS(Measurer.expvalPauliWord("XY", {0}));
+    }
+
+    SECTION("Dense matrices on unsorted wires") {
+        std::uniform_real_distribution<PrecisionT> dist(-1.0, 1.0);
+        for (const auto &wires : std::vector<std::vector<size_t>>{
+                 {3}, {4, 1}, {2, 5, 0}, {5, 1, 3, 0}}) {
+            const size_t dim = size_t{1U} << wires.size();
+            std::vector<ComplexPrecisionT> matrix(dim * dim);
+            for (auto &elt : matrix) {
+                elt = {dist(re), dist(re)};
+            }
+            REQUIRE(Measurer.expval(matrix, wires) ==
+                    Approx(expval_ref(matrix, wires)).margin(1e-5));
+        }
+        REQUIRE_THROWS(Measurer.expval(PauliX, {0, 1}));
+    }
+
+    SECTION("Named operations") {
+        REQUIRE(Measurer.expval("PauliY", {3}) ==
+                Approx(expval_ref(PauliY, {3})).margin(1e-6));
+        REQUIRE(Measurer.expval("Identity", {3}) == Approx(1.0));
+
+        const auto hadamard = Gates::getHadamard<PrecisionT>();
+        REQUIRE(Measurer.expval("Hadamard", {2}) ==
+                Approx(expval_ref(hadamard, {2})).margin(1e-6));
+
+        const auto cnot = Gates::getCNOT<PrecisionT>();
+        REQUIRE(Measurer.expval("CNOT", {4, 1}) ==
+                Approx(expval_ref(cnot, {4, 1})).margin(1e-6));
+
+        const auto toffoli = Gates::getToffoli<PrecisionT>();
+        REQUIRE(Measurer.expval("Toffoli", {5, 0, 3}) ==
+                Approx(expval_ref(toffoli, {5, 0, 3})).margin(1e-6));
+    }
+}
+
+TEMPLATE_TEST_CASE("Expected value of a PauliSum", "[Measures]", float,
+                   double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> Measurer(sv);
+
+    // Terms 0, 2, 4 and terms 1, 3 share bit flip masks
+    const std::vector<PrecisionT> coeffs{0.3, -0.7, 1.2, 0.5, -0.25};
+    const std::vector<std::string> words{"XZ", "Y", "YI", "ZZY", "XZZ"};
+    const std::vector<std::vector<size_t>> wires{
+        {1, 3}, {4}, {1, 2}, {0, 2, 4}, {1, 0, 4}};
+    const PauliSum<PrecisionT> hamiltonian(coeffs, words, wires);
+
+    REQUIRE(hamiltonian.getGroups(num_qubits).size() == 2);
+    REQUIRE(hamiltonian.getAllWires() == std::vector<size_t>{0, 1, 2, 3, 4});
+
+    PrecisionT expected = 0.0;
+    for (size_t t = 0; t < coeffs.size(); t++) {
+        expected += coeffs[t] * Measurer.expvalPauliWord(words[t], wires[t]);
+    }
+    REQUIRE(Measurer.expval(hamiltonian) == Approx(expected).margin(1e-5));
+    REQUIRE(Measurer.expvalQubitWise(hamiltonian) ==
+            Approx(expected).margin(1e-5));
+
+    SECTION("Apply to the statevector") {
+        std::vector<std::complex<PrecisionT>> h_psi(sv.getLength());
+        hamiltonian.apply(sv.getData(), h_psi.data(), num_qubits);
+        REQUIRE(std::real(innerProdC(sv.getDataVector(), h_psi)) ==
+                Approx(expected).margin(1e-5));
+    }
+
+    SECTION("Invalid arguments") {
+        REQUIRE_THROWS(PauliSum<PrecisionT>({0.1}, {"XX"}, {{0}}));
+        REQUIRE_THROWS(PauliSum<PrecisionT>({0.1, 0.2}, {"X"}, {{0}}));
+    }
+}
+
+TEMPLATE_TEST_CASE("Qubit-wise commuting groups", "[Measures]", float,
+                   double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 8;
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> Measurer(sv);
+
+    // Transverse-field Ising model with an additional YY coupling
+    std::vector<PrecisionT> coeffs;
+    std::vector<std::string> words;
+    std::vector<std::vector<size_t>> wires;
+    for (size_t wire = 0; wire < num_qubits; wire++) {
+        if (wire + 1 < num_qubits) {
+            coeffs.emplace_back(-1.0 + 0.1 * static_cast<PrecisionT>(wire));
+            words.emplace_back("ZZ");
+            wires.push_back({wire, wire + 1});
+        }
+        coeffs.emplace_back(0.5 - 0.05 * static_cast<PrecisionT>(wire));
+        words.emplace_back("X");
+        wires.push_back({wire});
+    }
+    coeffs.emplace_back(0.3);
+    words.emplace_back("YY");
+    wires.push_back({6, 2});
+    const PauliSum<PrecisionT> hamiltonian(coeffs, words, wires);
+
+    REQUIRE(hamiltonian.getGroups(num_qubits).size() == 10);
+    const auto groups = hamiltonian.getQubitWiseGroups(num_qubits);
+    REQUIRE(groups.size() == 3);
+    size_t num_terms = 0;
+    for (const auto &group : groups) {
+        REQUIRE((group.x_mask & group.y_mask) == 0);
+        REQUIRE((group.x_mask & group.z_mask) == 0);
+        REQUIRE((group.y_mask & group.z_mask) == 0);
+        num_terms += group.terms.size();
+    }
+    REQUIRE(num_terms == coeffs.size());
+
+    REQUIRE(Measurer.expvalQubitWise(hamiltonian) ==
+            Approx(Measurer.expval(hamiltonian)).margin(1e-5));
+    // The statevector is not modified
+    REQUIRE(sv.getDataVector() == approx(init_state));
+}
+
 TEMPLATE_TEST_CASE("Sample", "[Measures]", float, double) {
     constexpr uint32_t twos[] = {
         1U << 0U,  1U << 1U,  1U << 2U,  1U << 3U,  1U << 4U,  1U << 5U,
@@ -191,6 +423,329 @@ TEMPLATE_TEST_CASE("Sample", "[Measures]", float, double) {
     }
 }
 
+TEMPLATE_TEST_CASE("Sample with a seed", "[Measures]", float, double) {
+    std::mt19937 re{1337};
+    const size_t num_qubits = 13; // More than a single block of the CDF
+    const auto init_state = createRandomState<TestType>(re, num_qubits);
+    StateVectorManagedCPU<TestType> sv(init_state.data(), init_state.size());
+    Measures<TestType, StateVectorManagedCPU<TestType>> Measurer(sv);
+
+    const size_t num_samples = 20001;
+    const auto samples = Measurer.generate_samples(num_samples, 42);
+    REQUIRE(samples.size() == num_samples * num_qubits);
+    REQUIRE(Measurer.generate_samples(num_samples, 42) == samples);
+    REQUIRE(Measurer.generate_samples(num_samples, 43) != samples);
+
+#if defined(_OPENMP)
+    const int max_threads = omp_get_max_threads();
+    for (const int num_threads : {1, 3}) {
+        omp_set_num_threads(num_threads);
+        REQUIRE(Measurer.generate_samples(num_samples, 42) == samples);
+    }
+    omp_set_num_threads(max_threads);
+#endif
+
+    // Samples follow the distribution of the most significant qubits
+    const size_t num_top = 3;
+    std::vector<TestType> freqs(size_t{1U} << num_top, 0.0);
+    for (size_t i = 0; i < num_samples; i++) {
+        size_t idx = 0;
+        for (size_t j = 0; j < num_top; j++) {
+            idx = (idx << 1U) | samples[i * num_qubits + j];
+        }
+        freqs[idx] += TestType{1.0} / num_samples;
+    }
+    REQUIRE_THAT(freqs, Catch::Approx(Measurer.probs({0, 1, 2})).margin(.02));
+}
+
+TEMPLATE_TEST_CASE("Sample indices and counts", "[Measures]", float,
+                   double) {
+    std::mt19937 re{1337};
+    const size_t num_qubits = 10;
+    auto init_state = createRandomState<TestType>(re, num_qubits);
+    // Outcomes with zero probability must never be sampled
+    for (size_t idx = 0; idx < init_state.size(); idx += 3) {
+        init_state[idx] = 0.0;
+    }
+    scaleVector(init_state,
+                std::complex<TestType>{1.0, 0.0} /
+                    std::sqrt(squaredNorm(init_state.data(),
+                                          init_state.size())));
+    StateVectorManagedCPU<TestType> sv(init_state.data(), init_state.size());
+    Measures<TestType, StateVectorManagedCPU<TestType>> Measurer(sv);
+    const auto probs = Measurer.probs();
+    const size_t num_samples = 200000;
+
+    SECTION("Indices match the binary samples") {
+        const auto bits = Measurer.generate_samples(1001, 7);
+        const auto indices = Measurer.generate_sample_indices(1001, 7);
+        for (size_t i = 0; i < indices.size(); i++) {
+            size_t idx = 0;
+            for (size_t j = 0; j < num_qubits; j++) {
+                idx = (idx << 1U) | bits[i * num_qubits + j];
+            }
+            REQUIRE(idx == indices[i]);
+        }
+    }
+
+    SECTION("Counts") {
+        const auto counts = Measurer.generate_counts(num_samples, 7);
+        REQUIRE(Measurer.generate_counts(num_samples, 7) == counts);
+
+        size_t total = 0;
+        std::vector<TestType> freqs(probs.size(), 0.0);
+        for (size_t k = 0; k < counts.size(); k++) {
+            const auto [idx, count] = counts[k];
+            if (k > 0) {
+                REQUIRE(counts[k - 1].first < idx);
+            }
+            REQUIRE(count > 0);
+            REQUIRE(idx % 3 != 0);
+            total += count;
+            freqs[idx] = static_cast<TestType>(count) / num_samples;
+        }
+        REQUIRE(total == num_samples);
+        REQUIRE_THAT(freqs, Catch::Approx(probs).margin(.005));
+    }
+
+    SECTION("No samples") {
+        REQUIRE(Measurer.generate_counts(0, 7).empty());
+        REQUIRE(Measurer.generate_sample_indices(0, 7).empty());
+    }
+}
+
+TEMPLATE_TEST_CASE("Packed samples of a subset of wires", "[Measures]", float,
+                   double) {
+    std::mt19937 re{1337};
+
+    // Unpack outcomes of each sample with wires[0] as the most significant
+    const auto unpack = [](const std::vector<uint64_t> &packed,
+                           size_t num_samples, size_t num_wires) {
+        std::vector<size_t> outcomes(num_samples, 0);
+        for (size_t i = 0; i < num_samples; i++) {
+            for (size_t j = 0; j < num_wires; j++) {
+                const size_t pos = i * num_wires + j;
+                outcomes[i] = (outcomes[i] << 1U) |
+                              ((packed[pos / 64] >> (pos % 64)) & 1U);
+            }
+        }
+        return outcomes;
+    };
+
+    SECTION("Wires covering most qubits") {
+        const size_t num_qubits = 5;
+        const auto init_state = createRandomState<TestType>(re, num_qubits);
+        StateVectorManagedCPU<TestType> sv(init_state.data(),
+                                           init_state.size());
+        Measures<TestType, StateVectorManagedCPU<TestType>> Measurer(sv);
+
+        const std::vector<size_t> wires{3, 0, 4};
+        const size_t num_samples = 1003;
+        const auto packed =
+            Measurer.generate_packed_samples(num_samples, wires, 11);
+        REQUIRE(packed.size() == (num_samples * wires.size() + 63) / 64);
+
+        const auto indices = Measurer.generate_sample_indices(num_samples, 11);
+        const auto outcomes = unpack(packed, num_samples, wires.size());
+        for (size_t i = 0; i < num_samples; i++) {
+            size_t expected = 0;
+            for (const size_t wire : wires) {
+                expected = (expected << 1U) |
+                           ((indices[i] >> (num_qubits - 1 - wire)) & 1U);
+            }
+            REQUIRE(outcomes[i] == expected);
+        }
+    }
+
+    SECTION("Marginal distribution") {
+        const size_t num_qubits = 15;
+        const auto init_state = createRandomState<TestType>(re, num_qubits);
+        StateVectorManagedCPU<TestType> sv(init_state.data(),
+                                           init_state.size());
+        Measures<TestType, StateVectorManagedCPU<TestType>> Measurer(sv);
+
+        const std::vector<size_t> wires{9, 2};
+        std::vector<TestType> expected(4, 0.0);
+        const auto probs = Measurer.probs();
+        for (size_t idx = 0; idx < probs.size(); idx++) {
+            const size_t outcome =
+                (((idx >> (num_qubits - 1 - 9)) & 1U) << 1U) |
+                ((idx >> (num_qubits - 1 - 2)) & 1U);
+            expected[outcome] += probs[idx];
+        }
+
+        const size_t num_samples = 100000;
+        const auto packed =
+            Measurer.generate_packed_samples(num_samples, wires, 5);
+        REQUIRE(Measurer.generate_packed_samples(num_samples, wires, 5) ==
+                packed);
+#if defined(_OPENMP)
+        const int max_threads = omp_get_max_threads();
+        omp_set_num_threads(3);
+        REQUIRE(Measurer.generate_packed_samples(num_samples, wires, 5) ==
+                packed);
+        omp_set_num_threads(max_threads);
+#endif
+
+        std::vector<TestType> freqs(4, 0.0);
+        for (const size_t outcome : unpack(packed, num_samples, 2)) {
+            freqs[outcome] += TestType{1.0} / num_samples;
+        }
+        REQUIRE_THAT(freqs, Catch::Approx(expected).margin(.01));
+    }
+
+    SECTION("Invalid wires") {
+        StateVectorManagedCPU<TestType> sv(2);
+        Measures<TestType, StateVectorManagedCPU<TestType>> Measurer(sv);
+        REQUIRE_THROWS_WITH(Measurer.generate_packed_samples(10, {2}, 0),
+                            Catch::Contains("Invalid wire"));
+        REQUIRE_THROWS_WITH(Measurer.generate_packed_samples(10, {}, 0),
+                            Catch::Contains("Invalid number of wires"));
+    }
+}
+
+TEMPLATE_TEST_CASE("Classical shadow samples", "[Measures]", float, double) {
+    std::mt19937 re{1337};
+
+    SECTION("Eigenstates of each basis") {
+        // |0>, |+> and |+i> on wires j % 3 == 0, 1 and 2, i.e. eigenstates
+        // of Z, X and Y, which are measured as 0 in their own basis
+        const size_t num_qubits = 8;
+        StateVectorManagedCPU<TestType> sv(num_qubits);
+        const std::array<uint8_t, 3> eigenbasis{2, 0, 1};
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            if (wire % 3 != 0) {
+                sv.applyOperation("Hadamard", {wire});
+            }
+            if (wire % 3 == 2) {
+                sv.applyOperation("S", {wire});
+            }
+        }
+        Measures<TestType, StateVectorManagedCPU<TestType>> Measurer(sv);
+
+        const size_t num_samples = 3000;
+        const auto [bases, outcomes] =
+            Measurer.generate_shadow_samples(num_samples, 7);
+        REQUIRE(bases.size() == num_samples * num_qubits);
+        REQUIRE(outcomes.size() == num_samples);
+        REQUIRE(std::all_of(bases.begin(), bases.end(),
+                            [](uint8_t basis) { return basis < 3; }));
+        std::array<size_t, 3> basis_counts{0, 0, 0};
+        size_t num_flipped = 0;
+        for (size_t i = 0; i < num_samples; i++) {
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                const uint8_t basis = bases[i * num_qubits + wire];
+                basis_counts[basis]++;
+                if (basis == eigenbasis[wire % 3]) {
+                    num_flipped +=
+                        (outcomes[i] >> (num_qubits - 1 - wire)) & 1U;
+                }
+            }
+        }
+        REQUIRE(num_flipped == 0);
+        for (const size_t count : basis_counts) {
+            REQUIRE(static_cast<double>(count) / (num_samples * num_qubits) ==
+                    Approx(1.0 / 3).margin(0.02));
+        }
+    }
+
+    SECTION("Expected values") {
+        const size_t num_qubits = 4;
+        const auto init_state = createRandomState<TestType>(re, num_qubits);
+        StateVectorManagedCPU<TestType> sv(init_state.data(),
+                                           init_state.size());
+        Measures<TestType, StateVectorManagedCPU<TestType>> Measurer(sv);
+
+        const size_t num_samples = 60000;
+        const auto samples = Measurer.generate_shadow_samples(num_samples, 3);
+        REQUIRE(Measurer.generate_shadow_samples(num_samples, 3) == samples);
+#if defined(_OPENMP)
+        const int max_threads = omp_get_max_threads();
+        omp_set_num_threads(3);
+        REQUIRE(Measurer.generate_shadow_samples(num_samples, 3) == samples);
+        omp_set_num_threads(max_threads);
+#endif
+
+        // Mean of the eigenvalue over the shots measuring the wire in the
+        // basis of the observable
+        const auto &[bases, outcomes] = samples;
+        const auto estimate = [&, &bases = bases, &outcomes = outcomes](
+                                  size_t wire, uint8_t basis) {
+            double sum = 0.0;
+            size_t count = 0;
+            for (size_t i = 0; i < num_samples; i++) {
+                if (bases[i * num_qubits + wire] == basis) {
+                    sum += (((outcomes[i] >> (num_qubits - 1 - wire)) & 1U) ==
+                            0)
+                               ? 1.0
+                               : -1.0;
+                    count++;
+                }
+            }
+            return sum / static_cast<double>(count);
+        };
+        REQUIRE(estimate(1, 0) ==
+                Approx(Measurer.expval("PauliX", {1})).margin(0.03));
+        REQUIRE(estimate(2, 1) ==
+                Approx(Measurer.expval("PauliY", {2})).margin(0.03));
+        REQUIRE(estimate(0, 2) ==
+                Approx(Measurer.expval("PauliZ", {0})).margin(0.03));
+    }
+}
+
+TEMPLATE_TEST_CASE("Cached probabilities", "[Measures]", float, double) {
+    std::mt19937 re{1337};
+    const size_t num_qubits = 4;
+    const auto init_state = createRandomState<TestType>(re, num_qubits);
+    StateVectorManagedCPU<TestType> sv(init_state.data(), init_state.size());
+
+    Measures<TestType, StateVectorManagedCPU<TestType>> cached(sv);
+    Measures<TestType, StateVectorManagedCPU<TestType>> uncached(sv);
+    REQUIRE(!cached.isCacheEnabled());
+    cached.enableCache();
+    REQUIRE(cached.isCacheEnabled());
+
+    const auto check = [&]() {
+        REQUIRE_THAT(cached.probs(), Catch::Approx(uncached.probs()));
+        for (size_t repeat = 0; repeat < 2; repeat++) {
+            REQUIRE_THAT(cached.probs({2, 0}),
+                         Catch::Approx(uncached.probs({2, 0})));
+            for (const std::string obs : {"PauliX", "PauliZ", "Hadamard"}) {
+                REQUIRE(cached.var(obs, {1}) ==
+                        Approx(uncached.var(obs, {1})).margin(1e-6));
+                REQUIRE(cached.expval(obs, {3}) ==
+                        Approx(uncached.expval(obs, {3})).margin(1e-6));
+            }
+            REQUIRE(cached.generate_sample_indices(100, 3) ==
+                    uncached.generate_sample_indices(100, 3));
+            REQUIRE(cached.generate_counts(100, 3) ==
+                    uncached.generate_counts(100, 3));
+            REQUIRE(cached.generate_packed_samples(100, {3, 1}, 3) ==
+                    uncached.generate_packed_samples(100, {3, 1}, 3));
+        }
+    };
+
+    check();
+
+    SECTION("The cache is invalidated when the statevector changes") {
+        const size_t version = sv.getVersion();
+        sv.applyOperation("RX", {1}, false, {0.7});
+        REQUIRE(sv.getVersion() != version);
+        check();
+
+        const size_t version_after = sv.getVersion();
+        sv.updateData(init_state);
+        REQUIRE(sv.getVersion() != version_after);
+        check();
+    }
+
+    SECTION("Disable the cache") {
+        cached.enableCache(false);
+        REQUIRE(!cached.isCacheEnabled());
+        check();
+    }
+}
+
 TEMPLATE_TEST_CASE("Variances", "[Measures]", float, double) {
     // Defining the State Vector that will be measured.
     StateVectorManagedCPU<TestType> Measured_StateVector =
@@ -267,3 +822,399 @@ TEMPLATE_TEST_CASE("Variances", "[Measures]", float, double) {
         REQUIRE_THAT(variances, Catch::Approx(variances_ref).margin(1e-6));
     }
 }
+
+TEMPLATE_TEST_CASE("Fused expected values and variances", "[Measures]", float,
+                   double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> Measurer(sv);
+
+    SECTION("Pauli words") {
+        const std::vector<std::string> words{"ZZ", "XY", "Z",  "YX",
+                                             "I",  "ZX", "XYZ"};
+        const std::vector<std::vector<size_t>> wires{
+            {0, 3}, {1, 2}, {4}, {1, 2}, {2}, {0, 4}, {3, 0, 1}};
+
+        const auto expvals = Measurer.expvalPauliWords(words, wires);
+        const auto variances = Measurer.varPauliWords(words, wires);
+        REQUIRE(expvals.size() == words.size());
+        REQUIRE(variances.size() == words.size());
+        for (size_t w = 0; w < words.size(); w++) {
+            const auto expected = Measurer.expvalPauliWord(words[w], wires[w]);
+            REQUIRE(expvals[w] == Approx(expected).margin(1e-5));
+            REQUIRE(variances[w] ==
+                    Approx(1.0 - expected * expected).margin(1e-5));
+        }
+
+        REQUIRE_THROWS(Measurer.expvalPauliWords({"ZZ"}, {}));
+        REQUIRE_THROWS(Measurer.varPauliWords({"ZA"}, {{0, 1}}));
+    }
+
+    SECTION("Lists of single-qubit Pauli observables") {
+        const std::vector<std::string> ops{"PauliX", "PauliZ", "PauliY",
+                                           "Identity"};
+        const std::vector<std::vector<size_t>> wires{{0}, {1}, {4}, {2}};
+        const auto expvals = Measurer.expval(ops, wires);
+        const auto variances = Measurer.var(ops, wires);
+        for (size_t k = 0; k < ops.size(); k++) {
+            REQUIRE(expvals[k] ==
+                    Approx(Measurer.expval(ops[k], wires[k])).margin(1e-5));
+            REQUIRE(variances[k] ==
+                    Approx(Measurer.var(ops[k], wires[k])).margin(1e-5));
+        }
+    }
+
+    SECTION("Diagonal observables") {
+        const std::vector<std::vector<PrecisionT>> diagonals{
+            {1.0, -1.0}, {0.5, 2.0, -1.0, 3.0}, {0.0, 1.0, 1.0, 2.0}};
+        const std::vector<std::vector<size_t>> wires{{2}, {3, 0}, {1, 4}};
+
+        const auto expvals = Measurer.expvalDiagonal(diagonals, wires);
+        const auto variances = Measurer.varDiagonal(diagonals, wires);
+        for (size_t obs = 0; obs < diagonals.size(); obs++) {
+            const auto marginal = Measurer.probs(wires[obs]);
+            PrecisionT mean = 0.0;
+            PrecisionT mean_square = 0.0;
+            for (size_t k = 0; k < marginal.size(); k++) {
+                mean += marginal[k] * diagonals[obs][k];
+                mean_square +=
+                    marginal[k] * diagonals[obs][k] * diagonals[obs][k];
+            }
+            REQUIRE(expvals[obs] == Approx(mean).margin(1e-5));
+            REQUIRE(variances[obs] ==
+                    Approx(mean_square - mean * mean).margin(1e-5));
+        }
+
+        REQUIRE_THROWS(Measurer.expvalDiagonal({{1.0, -1.0, 0.0}}, {{0}}));
+        REQUIRE_THROWS(Measurer.varDiagonal({{1.0, -1.0}}, {{5}}));
+    }
+}
+
+TEMPLATE_TEST_CASE("Diagonal observables", "[Measures]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> Measurer(sv);
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> Cached(sv);
+    Cached.enableCache();
+
+    // Reference values computed from a copy of the statevector
+    const auto expval_ref = [&sv](const std::vector<ComplexT> &matrix,
+                                  const std::vector<size_t> &wires) {
+        StateVectorManagedCPU<PrecisionT> op_sv(sv);
+        op_sv.applyMatrix(matrix, wires);
+        return std::real(innerProdC(sv.getDataVector(), op_sv.getDataVector()));
+    };
+    const auto var_ref = [&sv](const std::vector<ComplexT> &matrix,
+                               const std::vector<size_t> &wires) {
+        StateVectorManagedCPU<PrecisionT> op_sv(sv);
+        op_sv.applyMatrix(matrix, wires);
+        const auto mean =
+            std::real(innerProdC(sv.getDataVector(), op_sv.getDataVector()));
+        return squaredNorm(op_sv.getDataVector()) - mean * mean;
+    };
+
+    SECTION("Diagonal Hermitian matrix") {
+        const std::vector<ComplexT> matrix{
+            0.5, 0.0, 0.0,  0.0, //
+            0.0, 2.0, 0.0,  0.0, //
+            0.0, 0.0, -1.0, 0.0, //
+            0.0, 0.0, 0.0,  3.0};
+        const std::vector<size_t> wires{3, 1};
+        const auto expected = expval_ref(matrix, wires);
+        const auto variance = var_ref(matrix, wires);
+        REQUIRE(Measurer.expval(matrix, wires) ==
+                Approx(expected).margin(1e-5));
+        REQUIRE(Cached.expval(matrix, wires) == Approx(expected).margin(1e-5));
+        REQUIRE(Measurer.var(matrix, wires) == Approx(variance).margin(1e-5));
+        REQUIRE(Cached.var(matrix, wires) == Approx(variance).margin(1e-5));
+
+        std::vector<ComplexT> matrix3(64, 0.0);
+        for (size_t k = 0; k < 8; k++) {
+            matrix3[k * 8 + k] = 0.25 * static_cast<PrecisionT>(k) - 1.0;
+        }
+        const std::vector<size_t> wires3{2, 0, 4};
+        REQUIRE(Cached.expval(matrix3, wires3) ==
+                Approx(expval_ref(matrix3, wires3)).margin(1e-5));
+        REQUIRE(Cached.var(matrix3, wires3) ==
+                Approx(var_ref(matrix3, wires3)).margin(1e-5));
+    }
+
+    SECTION("Products of Z and I") {
+        for (const auto &[word, wires] :
+             std::vector<std::pair<std::string, std::vector<size_t>>>{
+                 {"ZIZ", {4, 0, 2}}, {"IZ", {1, 3}}, {"II", {0, 1}}}) {
+            REQUIRE(Cached.expvalPauliWord(word, wires) ==
+                    Approx(Measurer.expvalPauliWord(word, wires))
+                        .margin(1e-5));
+        }
+        REQUIRE(Cached.expval("PauliZ", {2}) ==
+                Approx(Measurer.expval("PauliZ", {2})).margin(1e-5));
+        REQUIRE_THROWS(Cached.expvalPauliWord("ZZ", {0}));
+    }
+
+    SECTION("Projectors") {
+        const std::vector<size_t> basis_state{1, 0, 1};
+        const std::vector<size_t> wires{2, 0, 4};
+        // Bits of the sorted wires {0, 2, 4}
+        const PrecisionT expected = Measurer.probs({0, 2, 4})[0b011];
+        REQUIRE(Measurer.expvalProjector(basis_state, wires) ==
+                Approx(expected).margin(1e-5));
+        REQUIRE(Cached.expvalProjector(basis_state, wires) ==
+                Approx(expected).margin(1e-5));
+        REQUIRE(Measurer.varProjector(basis_state, wires) ==
+                Approx(expected - expected * expected).margin(1e-5));
+
+        REQUIRE_THROWS(Measurer.expvalProjector({1, 0}, {0}));
+        REQUIRE_THROWS(Measurer.expvalProjector({2}, {0}));
+        REQUIRE_THROWS(Measurer.expvalProjector({0, 1}, {1, 1}));
+    }
+}
+
+TEMPLATE_TEST_CASE("Z correlators", "[Measures]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 6;
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> Measurer(sv);
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> Cached(sv);
+    Cached.enableCache();
+
+    const auto expected = [&Measurer](
+                              const std::vector<std::vector<size_t>> &wires) {
+        // A wire appearing twice cancels out, which a Pauli word cannot
+        // express
+        std::vector<std::string> words;
+        std::vector<std::vector<size_t>> unique_wires;
+        for (const auto &wires_k : wires) {
+            std::vector<size_t> w(wires_k);
+            std::sort(w.begin(), w.end());
+            std::vector<size_t> odd;
+            for (size_t i = 0; i < w.size(); i++) {
+                if (i + 1 < w.size() && w[i] == w[i + 1]) {
+                    i++;
+                } else {
+                    odd.emplace_back(w[i]);
+                }
+            }
+            words.emplace_back(odd.size(), 'Z');
+            unique_wires.emplace_back(std::move(odd));
+        }
+        return Measurer.expvalPauliWords(words, unique_wires);
+    };
+
+    SECTION("Fewer correlators than wires") {
+        const std::vector<std::vector<size_t>> wires{{0, 3}, {5, 3, 1}, {}};
+        const auto res = Measurer.expvalZCorrelators(wires);
+        REQUIRE_THAT(res, Catch::Approx(expected(wires)).margin(1e-5));
+        REQUIRE(res[2] == Approx(1.0).margin(1e-5));
+        REQUIRE_THAT(Cached.expvalZCorrelators(wires),
+                     Catch::Approx(res).margin(1e-5));
+    }
+
+    SECTION("All pairs and triples") {
+        std::vector<std::vector<size_t>> wires;
+        for (size_t i = 0; i < num_qubits; i++) {
+            for (size_t j = i + 1; j < num_qubits; j++) {
+                wires.push_back({i, j});
+                for (size_t k = j + 1; k < num_qubits; k++) {
+                    wires.push_back({k, i, j});
+                }
+            }
+        }
+        wires.push_back({2, 4, 2});
+        const auto res = Measurer.expvalZCorrelators(wires);
+        REQUIRE_THAT(res, Catch::Approx(expected(wires)).margin(1e-5));
+
+        // Shares the cached probabilities of all wires
+        REQUIRE_THAT(Cached.probs(), Catch::Approx(Measurer.probs()));
+        REQUIRE_THAT(Cached.expvalZCorrelators(wires),
+                     Catch::Approx(res).margin(1e-5));
+        sv.applyOperation("RX", {2}, false, {0.4});
+        REQUIRE_THAT(Cached.expvalZCorrelators(wires),
+                     Catch::Approx(expected(wires)).margin(1e-5));
+    }
+
+    SECTION("Invalid wires") {
+        REQUIRE_THROWS(Measurer.expvalZCorrelators({{0, num_qubits}}));
+    }
+}
+
+TEMPLATE_TEST_CASE("Reduced density matrices", "[Measures]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 8;
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> Measurer(sv);
+
+    const std::vector<std::vector<size_t>> wires_list{
+        {},
+        {3},
+        {5, 1},
+        {0, 7, 2},
+        {7, 6, 5, 4, 3, 2},
+        {2, 0, 4, 6, 1, 3, 7, 5}};
+
+    for (const auto &wires : wires_list) {
+        // Reference obtained by splitting each index into the bits of the
+        // kept wires, in the given order, and the bits of the other wires
+        const size_t dim = Util::exp2(wires.size());
+        const size_t num_env = Util::exp2(num_qubits - wires.size());
+        std::vector<complex<PrecisionT>> psi(dim * num_env);
+        for (size_t idx = 0; idx < init_state.size(); idx++) {
+            size_t row = 0;
+            for (const size_t wire : wires) {
+                row = (row << 1U) | ((idx >> (num_qubits - 1 - wire)) & 1U);
+            }
+            size_t env = 0;
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                if (std::find(wires.begin(), wires.end(), wire) ==
+                    wires.end()) {
+                    env = (env << 1U) |
+                          ((idx >> (num_qubits - 1 - wire)) & 1U);
+                }
+            }
+            psi[row * num_env + env] = init_state[idx];
+        }
+        std::vector<complex<PrecisionT>> expected(dim * dim);
+        PrecisionT expected_purity = 0.0;
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                for (size_t env = 0; env < num_env; env++) {
+                    expected[row * dim + col] +=
+                        psi[row * num_env + env] *
+                        std::conj(psi[col * num_env + env]);
+                }
+                expected_purity += std::norm(expected[row * dim + col]);
+            }
+        }
+
+        CHECK(Measurer.densityMatrix(wires) == approx(expected).margin(1e-5));
+        CHECK(Measurer.purity(wires) ==
+              Approx(expected_purity).epsilon(1e-4));
+        CHECK(Measurer.renyi2Entropy(wires) ==
+              Approx(-std::log(expected_purity)).margin(1e-4));
+    }
+
+    SECTION("Invalid wires") {
+        REQUIRE_THROWS_WITH(Measurer.densityMatrix({8}),
+                            Catch::Contains("Invalid wire index"));
+        REQUIRE_THROWS_WITH(Measurer.densityMatrix({1, 1}),
+                            Catch::Contains("distinct"));
+        REQUIRE_THROWS_WITH(Measurer.purity({0, 1, 2, 3, 4, 4}),
+                            Catch::Contains("distinct"));
+    }
+}
+
+TEMPLATE_TEST_CASE("Measurements on relabelled wires", "[Measures]", float,
+                   double) {
+    using PrecisionT = TestType;
+    using MeasuresT = Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>>;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    // Lazy SWAP gates leave the data of swapped in a permuted order
+    StateVectorManagedCPU<PrecisionT> expected(init_state.data(),
+                                               init_state.size());
+    StateVectorManagedCPU<PrecisionT> swapped(init_state.data(),
+                                              init_state.size());
+    swapped.setLazySwaps(true);
+    for (auto *state : {&expected, &swapped}) {
+        state->applyOperation("SWAP", {0, 3});
+        state->applyOperation("SWAP", {3, 4});
+        state->applyOperation("RX", {1}, false, {0.4});
+    }
+    REQUIRE(swapped.hasWireMap());
+
+    const auto random_matrix = createRandomState<PrecisionT>(re, 4);
+    const std::vector<std::complex<PrecisionT>> matrix(random_matrix.begin(),
+                                                       random_matrix.end());
+    const PauliSum<PrecisionT> hamiltonian({0.3, -0.5, 0.7},
+                                           {"XZ", "YY", "ZIX"},
+                                           {{0, 3}, {4, 1}, {2, 0, 4}});
+    const auto check = [&](MeasuresT &measured, MeasuresT &reference) {
+        REQUIRE_THAT(measured.probs(), Catch::Approx(reference.probs()));
+        REQUIRE_THAT(measured.probs({4, 1}),
+                     Catch::Approx(reference.probs({4, 1})));
+        REQUIRE(measured.expval("PauliX", {3}) ==
+                Approx(reference.expval("PauliX", {3})).margin(1e-5));
+        REQUIRE(measured.expval(matrix, {2, 0}) ==
+                Approx(reference.expval(matrix, {2, 0})).margin(1e-5));
+        REQUIRE(measured.var("Hadamard", {2}) ==
+                Approx(reference.var("Hadamard", {2})).margin(1e-5));
+        REQUIRE(measured.var(matrix, {4, 3}) ==
+                Approx(reference.var(matrix, {4, 3})).margin(1e-5));
+        REQUIRE_THAT(
+            measured.expvalPauliWords({"XZ", "YY"}, {{0, 3}, {4, 1}}),
+            Catch::Approx(
+                reference.expvalPauliWords({"XZ", "YY"}, {{0, 3}, {4, 1}}))
+                .margin(1e-5));
+        REQUIRE(measured.expval(hamiltonian) ==
+                Approx(reference.expval(hamiltonian)).margin(1e-5));
+        REQUIRE(measured.expvalQubitWise(hamiltonian) ==
+                Approx(reference.expvalQubitWise(hamiltonian)).margin(1e-5));
+        REQUIRE_THAT(
+            measured.expvalDiagonal({{1.0, -2.0, 0.5, 3.0}}, {{1, 4}}),
+            Catch::Approx(
+                reference.expvalDiagonal({{1.0, -2.0, 0.5, 3.0}}, {{1, 4}}))
+                .margin(1e-5));
+        REQUIRE(measured.expvalProjector({1, 0}, {4, 2}) ==
+                Approx(reference.expvalProjector({1, 0}, {4, 2}))
+                    .margin(1e-5));
+        REQUIRE(measured.densityMatrix({3, 0}) ==
+                approx(reference.densityMatrix({3, 0})).margin(1e-5));
+        REQUIRE(measured.purity({1, 4}) ==
+                Approx(reference.purity({1, 4})).margin(1e-5));
+        REQUIRE(measured.generate_sample_indices(100, 3) ==
+                reference.generate_sample_indices(100, 3));
+        REQUIRE(measured.generate_packed_samples(100, {3, 1}, 3) ==
+                reference.generate_packed_samples(100, {3, 1}, 3));
+        REQUIRE(measured.generate_shadow_samples(100, 5) ==
+                reference.generate_shadow_samples(100, 5));
+    };
+
+    SECTION("Wires are translated without canonicalizing the data") {
+        MeasuresT measured(swapped);
+        MeasuresT reference(expected);
+        check(measured, reference);
+        REQUIRE(swapped.hasWireMap());
+    }
+
+    SECTION("The cache is invalidated when the wires are relabelled") {
+        MeasuresT measured(swapped);
+        MeasuresT reference(expected);
+        measured.enableCache();
+        check(measured, reference);
+
+        const size_t version = swapped.getVersion();
+        swapped.applyOperation("SWAP", {1, 2});
+        expected.applyOperation("SWAP", {1, 2});
+        REQUIRE(swapped.getVersion() == version);
+        check(measured, reference);
+    }
+
+    SECTION("Pending operations are not measured") {
+        swapped.setDeferredExecution(true);
+        swapped.applyOperation("RY", {2}, false, {0.3});
+        MeasuresT measured(swapped);
+        REQUIRE_THROWS_WITH(measured.probs({0}),
+                            Catch::Contains("flushOperations"));
+        swapped.flushOperations();
+        expected.applyOperation("RY", {2}, false, {0.3});
+        MeasuresT reference(expected);
+        check(measured, reference);
+    }
+}
@@ -4,6 +4,7 @@
 
 #include "Kokkos_Sparse.hpp"
 #include "Measures.hpp"
+#include "SparseHamiltonian.hpp"
 #include "StateVectorManagedCPU.hpp"
 #include "StateVectorRawCPU.hpp"
 #include "Util.hpp"
@@ -25,7 +26,7 @@ using std::string;
 using std::vector;
 }; // namespace
 
-TEMPLATE_TEST_CASE("Expected Values - Sparse Hamiltonian [Kokkos]",
+TEMPLATE_TEST_CASE("Expected Values - Sparse Hamiltonian",
                    "[Measures]", float, double) {
     // Defining the State Vector that will be measured.
     auto Measured_StateVector = Initializing_StateVector<TestType>();
@@ -35,59 +36,68 @@ TEMPLATE_TEST_CASE("Expected Values - Sparse Hamiltonian [Kokkos]",
     Measures<TestType, StateVectorManagedCPU<TestType>> Measurer(
         Measured_StateVector);
 
-    if constexpr (USE_KOKKOS) {
-        SECTION("Testing Sparse Hamiltonian:") {
-            long num_qubits = 3;
-            long data_size = Util::exp2(num_qubits);
-
-            std::vector<long> row_map;
-            std::vector<long> entries;
-            std::vector<complex<TestType>> values;
-            write_CSR_vectors(row_map, entries, values, data_size);
-
-            TestType exp_values = Measurer.expval(
-                row_map.data(), static_cast<long>(row_map.size()),
-                entries.data(), values.data(),
-                static_cast<long>(values.size()));
-            TestType exp_values_ref = 0.5930885;
-            REQUIRE(exp_values == Approx(exp_values_ref).margin(1e-6));
-        }
+    SECTION("Testing Sparse Hamiltonian:") {
+        long num_qubits = 3;
+        long data_size = Util::exp2(num_qubits);
 
-        SECTION("Testing Sparse Hamiltonian (incompatible sizes):") {
-            long num_qubits = 4;
-            long data_size = Util::exp2(num_qubits);
-
-            std::vector<long> row_map;
-            std::vector<long> entries;
-            std::vector<complex<TestType>> values;
-            write_CSR_vectors(row_map, entries, values, data_size);
-
-            PL_CHECK_THROWS_MATCHES(
-                Measurer.expval(row_map.data(),
-                                static_cast<long>(row_map.size()),
-                                entries.data(), values.data(),
-                                static_cast<long>(values.size())),
-                LightningException,
-                "Statevector and Hamiltonian have incompatible sizes.");
-        }
-    } else {
-        SECTION("Testing Sparse Hamiltonian:") {
-            long num_qubits = 3;
-            long data_size = Util::exp2(num_qubits);
-
-            std::vector<long> row_map;
-            std::vector<long> entries;
-            std::vector<complex<TestType>> values;
-            write_CSR_vectors(row_map, entries, values, data_size);
-
-            PL_CHECK_THROWS_MATCHES(
-                Measurer.expval(row_map.data(),
-                                static_cast<long>(row_map.size()),
-                                entries.data(), values.data(),
-                                static_cast<long>(values.size())),
-                LightningException,
-                "Executing the product of a Sparse matrix and a vector needs "
-                "Kokkos and Kokkos Kernels installation.");
+        std::vector<long> row_map;
+        std::vector<long> entries;
+        std::vector<complex<TestType>> values;
+        write_CSR_vectors(row_map, entries, values, data_size);
+
+        TestType exp_values =
+            Measurer.expval(row_map.data(), static_cast<long>(row_map.size()),
+                            entries.data(), values.data(),
+                            static_cast<long>(values.size()));
+        TestType exp_values_ref = 0.5930885;
+        REQUIRE(exp_values == Approx(exp_values_ref).margin(1e-6));
+    }
+
+    SECTION("Testing SparseHamiltonian:") {
+        long num_qubits = 3;
+        long data_size = Util::exp2(num_qubits);
+
+        std::vector<long> row_map;
+        std::vector<long> entries;
+        std::vector<complex<TestType>> values;
+        write_CSR_vectors(row_map, entries, values, data_size);
+
+        const SparseHamiltonian<TestType> hamiltonian(row_map, entries,
+                                                      values);
+        REQUIRE(hamiltonian.getNumQubits() == 3);
+        REQUIRE(Measurer.expval(hamiltonian) ==
+                Approx(0.5930885).margin(1e-6));
+
+        // Repeated measurements and copies reuse the same matrix
+        const SparseHamiltonian<TestType> copy(hamiltonian);
+        for (size_t repeat = 0; repeat < 3; repeat++) {
+            REQUIRE(Measurer.expval(hamiltonian) ==
+                    Approx(0.5930885).margin(1e-6));
+            REQUIRE(Measurer.expval(copy) == Approx(0.5930885).margin(1e-6));
         }
+
+        write_CSR_vectors(row_map, entries, values, 2 * data_size);
+        PL_CHECK_THROWS_MATCHES(
+            Measurer.expval(
+                SparseHamiltonian<TestType>(row_map, entries, values)),
+            LightningException,
+            "Statevector and Hamiltonian have incompatible sizes.");
+    }
+
+    SECTION("Testing Sparse Hamiltonian (incompatible sizes):") {
+        long num_qubits = 4;
+        long data_size = Util::exp2(num_qubits);
+
+        std::vector<long> row_map;
+        std::vector<long> entries;
+        std::vector<complex<TestType>> values;
+        write_CSR_vectors(row_map, entries, values, data_size);
+
+        PL_CHECK_THROWS_MATCHES(
+            Measurer.expval(row_map.data(), static_cast<long>(row_map.size()),
+                            entries.data(), values.data(),
+                            static_cast<long>(values.size())),
+            LightningException,
+            "Statevector and Hamiltonian have incompatible sizes.");
     }
 }
@@ -0,0 +1,176 @@
+#include "AdjointDiff.hpp"
+#include "Measures.hpp"
+#include "ParameterShift.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "StateVectorRawCPU.hpp"
+
+#include "TestHelpers.hpp"
+#include <catch2/catch.hpp>
+
+#include <complex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+TEMPLATE_TEST_CASE("ParameterShift::parameterShift", "[ParameterShift]", float,
+                   double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 4;
+    const PrecisionT eps = std::is_same_v<PrecisionT, float> ? 1e-4 : 1e-10;
+
+    const OpsData<PrecisionT> ops(
+        {"RX", "Hadamard", "CRY", "Rot", "CNOT", "IsingYY", "RZ", "CRot",
+         "SingleExcitation", "PhaseShift", "MultiRZ", "DoubleExcitation",
+         "ControlledPhaseShift", "SingleExcitationPlus"},
+        {{0.4},
+         {},
+         {-0.7},
+         {0.3, -1.2, 0.7},
+         {},
+         {0.9},
+         {1.3},
+         {-0.4, 0.9, 1.6},
+         {0.5},
+         {-0.8},
+         {0.6},
+         {1.1},
+         {-1.4},
+         {0.2}},
+        {{0},
+         {1},
+         {1, 2},
+         {3},
+         {0, 3},
+         {2, 3},
+         {1},
+         {3, 0},
+         {0, 1},
+         {2},
+         {0, 2, 3},
+         {0, 1, 2, 3},
+         {1, 3},
+         {2, 0}},
+        {false, false, true, false, false, false, true, true, false, false,
+         false, false, true, false});
+    const std::vector<ObsDatum<PrecisionT>> obs{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliY"}, {{}, {}}, {{1}, {3}}),
+        ObsDatum<PrecisionT>(PauliSum<PrecisionT>(
+            {0.5, -1.5}, {"XZ", "Y"}, {{0, 2}, {1}}))};
+
+    std::mt19937 re{1337};
+    const auto init = createRandomState<PrecisionT>(re, num_qubits);
+    const auto jacobian = [&](const std::vector<size_t> &tp, bool adjoint,
+                              size_t max_num_forks) {
+        auto cdata = init;
+        StateVectorRawCPU<PrecisionT> psi(cdata.data(), cdata.size());
+        const JacobianData<PrecisionT> tape{
+            tp.size(), psi.getLength(), psi.getData(), obs, ops, tp};
+        std::vector<PrecisionT> jac(tp.size() * obs.size(), 0);
+        if (adjoint) {
+            AdjointJacobian<PrecisionT>().adjointJacobian(jac, tape, true);
+        } else {
+            ParameterShift<PrecisionT> shift;
+            shift.setMaxNumForks(max_num_forks);
+            shift.parameterShift(jac, tape);
+            // The state of the tape is unchanged
+            REQUIRE(cdata == init);
+        }
+        return jac;
+    };
+
+    std::vector<size_t> all_params(ops.getNumParams());
+    std::iota(all_params.begin(), all_params.end(), size_t{0});
+    for (const auto &tp :
+         {all_params, std::vector<size_t>{1, 4, 7, 8, 13}}) {
+        const auto expected = jacobian(tp, true, 0);
+        for (const size_t max_num_forks : {0, 1, 3, 64}) {
+            DYNAMIC_SECTION("num_params = " << tp.size() << ", max_num_forks = "
+                                            << max_num_forks) {
+                REQUIRE(jacobian(tp, false, max_num_forks) ==
+                        approx(expected).margin(eps));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("ParameterShift::parameterShift without adjoint support",
+                   "[ParameterShift]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 2;
+    const PrecisionT theta = 0.7;
+    const PrecisionT h = std::is_same_v<PrecisionT, float> ? 1e-2 : 1e-5;
+    const PrecisionT eps = std::is_same_v<PrecisionT, float> ? 1e-3 : 1e-8;
+    std::mt19937 re{1337};
+    auto init = createRandomState<PrecisionT>(re, num_qubits);
+    const auto ops = [](PrecisionT param) {
+        return OpsData<PrecisionT>({"RX", "IsingXY"}, {{0.3}, {param}},
+                                   {{0}, {0, 1}}, {false, false});
+    };
+    // Central finite difference of <Z_0>
+    const auto expval = [&](PrecisionT param) {
+        StateVectorManagedCPU<PrecisionT> sv(init.data(), init.size());
+        const auto param_ops = ops(param);
+        for (size_t op_idx = 0; op_idx < param_ops.getSize(); op_idx++) {
+            sv.applyOperation(param_ops.getOpsName()[op_idx],
+                              param_ops.getOpsWires()[op_idx], false,
+                              param_ops.getOpsParams()[op_idx]);
+        }
+        return Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>>(sv)
+            .expval("PauliZ", {0});
+    };
+    const PrecisionT expected =
+        (expval(theta + h) - expval(theta - h)) / (2 * h);
+
+    const std::vector<ObsDatum<PrecisionT>> obs{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}})};
+    const JacobianData<PrecisionT> tape{1,   init.size(), init.data(),
+                                        obs, ops(theta),  {1}};
+    std::vector<PrecisionT> jac(1);
+    ParameterShift<PrecisionT>().parameterShift(jac, tape);
+    REQUIRE(jac[0] == Approx(expected).margin(eps));
+}
+
+TEMPLATE_TEST_CASE("ParameterShift::parameterShift errors",
+                   "[ParameterShift]", float, double) {
+    using PrecisionT = TestType;
+    std::vector<std::complex<PrecisionT>> cdata{1, 0, 0, 0};
+    const std::vector<ObsDatum<PrecisionT>> obs{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}})};
+    const auto tape = [&](const OpsData<PrecisionT> &ops,
+                          const std::vector<size_t> &tp) {
+        return JacobianData<PrecisionT>{tp.size(), cdata.size(),
+                                        cdata.data(), obs, ops, tp};
+    };
+    const OpsData<PrecisionT> ops({"RX", "CNOT"}, {{0.4}, {}},
+                                  {{0}, {0, 1}}, {false, false});
+    ParameterShift<PrecisionT> shift;
+
+    SECTION("No trainable parameters") {
+        std::vector<PrecisionT> jac;
+        REQUIRE_THROWS_WITH(shift.parameterShift(jac, tape(ops, {})),
+                            Catch::Contains("No trainable parameters"));
+    }
+    SECTION("Invalid size of the Jacobian") {
+        std::vector<PrecisionT> jac(2);
+        REQUIRE_THROWS_WITH(shift.parameterShift(jac, tape(ops, {0})),
+                            Catch::Contains("preallocated Jacobian"));
+    }
+    SECTION("Invalid trainable parameter") {
+        std::vector<PrecisionT> jac(2);
+        REQUIRE_THROWS_WITH(shift.parameterShift(jac, tape(ops, {0, 1})),
+                            Catch::Contains("Invalid index"));
+    }
+    SECTION("Unsupported operation") {
+        const OpsData<PrecisionT> matrix_ops(
+            {"QubitUnitary"}, {{0.1}}, {{0}}, {false},
+            {{{0, 0}, {1, 0}, {1, 0}, {0, 0}}});
+        std::vector<PrecisionT> jac(1);
+        REQUIRE_THROWS_WITH(shift.parameterShift(jac, tape(matrix_ops, {0})),
+                            Catch::Contains("QubitUnitary is not supported"));
+    }
+}
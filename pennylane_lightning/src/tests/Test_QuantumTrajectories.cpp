@@ -0,0 +1,187 @@
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "MeasuresKernels.hpp"
+#include "QuantumTrajectories.hpp"
+#include "StateVectorManagedCPU.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+TEMPLATE_TEST_CASE("KrausChannel::branchProbs", "[QuantumTrajectories]",
+                   float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 4;
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    // Norm of K_i |psi> computed by applying K_i to a copy of the state
+    auto expectedProbs = [&](const KrausChannel<PrecisionT> &channel) {
+        std::vector<PrecisionT> probs;
+        for (const auto &op : channel.getKrausOps()) {
+            StateVectorManagedCPU<PrecisionT> sv(init_state.data(),
+                                                 init_state.size());
+            sv.applyMatrix(op, channel.getWires());
+            PrecisionT prob = 0.0;
+            for (const auto &amp : sv.getDataVector()) {
+                prob += std::norm(amp);
+            }
+            probs.emplace_back(prob);
+        }
+        return probs;
+    };
+
+    SECTION("Mixture of unitaries") {
+        const auto channel = KrausChannel<PrecisionT>::depolarizing(0.3, 2);
+        REQUIRE(channel.isUnitaryMixture());
+        CHECK(channel.branchProbs(init_state.data(), num_qubits) ==
+              approx(expectedProbs(channel)).margin(1e-5));
+    }
+    SECTION("State-dependent probabilities") {
+        const auto damping =
+            KrausChannel<PrecisionT>::amplitudeDamping(0.4, 1);
+        REQUIRE(!damping.isUnitaryMixture());
+        CHECK(damping.branchProbs(init_state.data(), num_qubits) ==
+              approx(expectedProbs(damping)).margin(1e-5));
+
+        // Two-qubit channel made of a damping on each wire
+        const PrecisionT a = std::sqrt(PrecisionT{0.6});
+        const PrecisionT b = std::sqrt(PrecisionT{0.4});
+        const std::vector<std::vector<ComplexPrecisionT>> single{
+            {1.0, 0.0, 0.0, a}, {0.0, b, 0.0, 0.0}};
+        std::vector<std::vector<ComplexPrecisionT>> kraus_ops;
+        for (const auto &lhs : single) {
+            for (const auto &rhs : single) {
+                std::vector<ComplexPrecisionT> op(16);
+                for (size_t row = 0; row < 4; row++) {
+                    for (size_t col = 0; col < 4; col++) {
+                        op[row * 4 + col] = lhs[(row / 2) * 2 + col / 2] *
+                                            rhs[(row % 2) * 2 + col % 2];
+                    }
+                }
+                kraus_ops.emplace_back(op);
+            }
+        }
+        const KrausChannel<PrecisionT> channel(kraus_ops, {3, 0});
+        CHECK(channel.branchProbs(init_state.data(), num_qubits) ==
+              approx(expectedProbs(channel)).margin(1e-5));
+    }
+    SECTION("Renormalized application") {
+        const auto channel =
+            KrausChannel<PrecisionT>::amplitudeDamping(0.4, 0);
+        const auto probs = channel.branchProbs(init_state.data(), num_qubits);
+        for (const double random : {0.0, 0.999}) {
+            const size_t expected_idx = (random < probs[0]) ? 0 : 1;
+            StateVectorManagedCPU<PrecisionT> expected(init_state.data(),
+                                                       init_state.size());
+            expected.applyMatrix(channel.getKrausOps()[expected_idx], {0});
+            for (auto &amp : expected.getDataVector()) {
+                amp /= std::sqrt(probs[expected_idx]);
+            }
+
+            StateVectorManagedCPU<PrecisionT> sv(init_state.data(),
+                                                 init_state.size());
+            REQUIRE(channel.apply(sv, random) == expected_idx);
+            CHECK(sv.getDataVector() ==
+                  approx(expected.getDataVector()).margin(1e-5));
+        }
+    }
+    SECTION("Invalid arguments") {
+        REQUIRE_THROWS_WITH(KrausChannel<PrecisionT>({{1.0, 0.0, 0.0, 0.5}},
+                                                     {0}),
+                            Catch::Contains("sum_i K_i^dagger K_i = I"));
+        REQUIRE_THROWS_WITH(KrausChannel<PrecisionT>({{1.0, 0.0}}, {0}),
+                            Catch::Contains("does not match"));
+        REQUIRE_THROWS_WITH(KrausChannel<PrecisionT>::depolarizing(1.5, 0),
+                            Catch::Contains("must be in [0, 1]"));
+    }
+}
+
+TEMPLATE_TEST_CASE("QuantumTrajectories::execute", "[QuantumTrajectories]",
+                   float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    const size_t num_qubits = 3;
+    std::vector<ComplexPrecisionT> zero(size_t{1U} << num_qubits);
+    zero[0] = 1.0;
+    const PauliSum<PrecisionT> z0({1.0}, {"Z"}, {{0}});
+    const PauliSum<PrecisionT> x0({1.0}, {"X"}, {{0}});
+    const PauliSum<PrecisionT> z1z2({1.0}, {"ZZ"}, {{1, 2}});
+
+    // Estimates within 5 standard errors of the exact value
+    auto checkEstimate = [](const TrajectoryResults<PrecisionT> &results,
+                            size_t obs_idx, double exact) {
+        CHECK(results.std_errors[obs_idx] > 0);
+        CHECK(std::abs(results.expvals[obs_idx] - exact) <
+              5 * results.std_errors[obs_idx] + 1e-5);
+    };
+
+    SECTION("Noiseless circuit") {
+        QuantumTrajectories<PrecisionT> circuit(num_qubits);
+        circuit.addGate("Hadamard", {0});
+        circuit.addGate("RY", {1}, false, {0.7});
+        circuit.addGate("CNOT", {1, 2});
+        const auto results = circuit.execute(zero.data(), {x0, z1z2}, 17, 42);
+        CHECK(results.expvals[0] == Approx(1.0).margin(1e-5));
+        CHECK(results.expvals[1] == Approx(1.0).margin(1e-5));
+        CHECK(results.std_errors[0] == Approx(0.0).margin(1e-3));
+    }
+    SECTION("Depolarizing channel") {
+        const PrecisionT p = 0.3;
+        QuantumTrajectories<PrecisionT> circuit(num_qubits);
+        circuit.addChannel(KrausChannel<PrecisionT>::depolarizing(p, 0));
+        const auto results = circuit.execute(zero.data(), {z0}, 4000, 1);
+        checkEstimate(results, 0, 1.0 - 4.0 * p / 3.0);
+    }
+    SECTION("Amplitude damping channel") {
+        const PrecisionT gamma = 0.3;
+        QuantumTrajectories<PrecisionT> circuit(num_qubits);
+        circuit.addGate("Hadamard", {0});
+        circuit.addChannel(
+            KrausChannel<PrecisionT>::amplitudeDamping(gamma, 0));
+        const auto results = circuit.execute(zero.data(), {z0, x0}, 4000, 2);
+        checkEstimate(results, 0, gamma);
+        checkEstimate(results, 1, std::sqrt(1.0 - gamma));
+
+        circuit.addGate("PauliX", {0});
+        circuit.addChannel(KrausChannel<PrecisionT>::amplitudeDamping(1.0, 0));
+        const auto decayed = circuit.execute(zero.data(), {z0}, 50, 3);
+        CHECK(decayed.expvals[0] == Approx(1.0).margin(1e-5));
+    }
+    SECTION("Reproducible random streams") {
+        QuantumTrajectories<PrecisionT> circuit(num_qubits);
+        circuit.addGate("Hadamard", {1});
+        circuit.addChannel(KrausChannel<PrecisionT>::amplitudeDamping(0.5, 1));
+        circuit.addGate("CNOT", {1, 2});
+        circuit.addChannel(KrausChannel<PrecisionT>::depolarizing(0.2, 2));
+        REQUIRE(circuit.getNumOps() == 4);
+        const auto first = circuit.execute(zero.data(), {z1z2}, 200, 7);
+        const auto second = circuit.execute(zero.data(), {z1z2}, 200, 7);
+        CHECK(first.expvals[0] == Approx(second.expvals[0]).margin(1e-5));
+        CHECK(first.std_errors[0] ==
+              Approx(second.std_errors[0]).margin(1e-5));
+    }
+    SECTION("No trajectories") {
+        const QuantumTrajectories<PrecisionT> circuit(num_qubits);
+        const auto results = circuit.execute(zero.data(), {z0}, 0, 0);
+        CHECK(results.expvals[0] == 0.0);
+    }
+    SECTION("Invalid wires") {
+        QuantumTrajectories<PrecisionT> circuit(num_qubits);
+        REQUIRE_THROWS_WITH(circuit.addGate("CNOT", {0, num_qubits}),
+                            Catch::Contains("Invalid wire index"));
+        REQUIRE_THROWS_WITH(
+            circuit.addChannel(KrausChannel<PrecisionT>::depolarizing(
+                0.1, num_qubits)),
+            Catch::Contains("Invalid wire index"));
+        REQUIRE_THROWS_WITH(circuit.addGate("CNOT", {1, 1}),
+                            Catch::Contains("distinct"));
+    }
+}
@@ -0,0 +1,172 @@
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Constant.hpp"
+#include "StabilizerTableau.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+using Pennylane::Gates::GateOperation;
+
+TEMPLATE_TEST_CASE("StabilizerTableau::writeState", "[StabilizerTableau]",
+                   float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 6;
+    std::mt19937 re{1337};
+    std::uniform_int_distribution<size_t> gate_dist(
+        0, Gates::Constant::clifford_gates.size() - 1);
+    std::uniform_int_distribution<size_t> wire_dist(0, num_qubits - 1);
+    std::uniform_int_distribution<size_t> basis_dist(
+        0, Util::exp2(num_qubits) - 1);
+
+    for (size_t trial = 0; trial < 20; trial++) {
+        const size_t basis_index = basis_dist(re);
+        const std::complex<PrecisionT> amplitude{0.6, -0.8};
+        StabilizerTableau tableau(num_qubits, basis_index, amplitude);
+
+        std::vector<std::complex<PrecisionT>> init(Util::exp2(num_qubits));
+        init[basis_index] = amplitude;
+        StateVectorManagedCPU<PrecisionT> expected(init.data(), init.size());
+
+        for (size_t k = 0; k < 60; k++) {
+            const auto gate_op =
+                Gates::Constant::clifford_gates[gate_dist(re)];
+            const size_t num_wires =
+                gate_op >= GateOperation::CNOT ? size_t{2} : size_t{1};
+            std::vector<size_t> wires{wire_dist(re)};
+            while (wires.size() < num_wires) {
+                const size_t wire = wire_dist(re);
+                if (wire != wires[0]) {
+                    wires.push_back(wire);
+                }
+            }
+            const bool inverse = (k % 3) == 0;
+            tableau.applyOperation(gate_op, wires, inverse);
+            expected.applyOperation(gate_op, wires, inverse);
+        }
+        REQUIRE(tableau.getNumGates() == 60);
+
+        std::vector<std::complex<PrecisionT>> state(Util::exp2(num_qubits),
+                                                    {1.0, 1.0});
+        tableau.writeState(state.data());
+        REQUIRE(state == approx(expected.getDataVector()).margin(1e-5));
+    }
+}
+
+TEST_CASE("StabilizerTableau::GHZ state of many qubits",
+          "[StabilizerTableau]") {
+    // The support is spanned by a single generator regardless of the width
+    const size_t num_qubits = 100;
+    StabilizerTableau tableau(num_qubits);
+    tableau.applyOperation(GateOperation::Hadamard, {0});
+    for (size_t wire = 1; wire < num_qubits; wire++) {
+        tableau.applyOperation(GateOperation::CNOT, {wire - 1, wire});
+    }
+    tableau.applyOperation(GateOperation::Hadamard, {0});
+    tableau.applyOperation(GateOperation::Hadamard, {0});
+    REQUIRE(tableau.getNumGates() == num_qubits + 2);
+    PL_CHECK_THROWS_MATCHES(tableau.writeState<double>(nullptr),
+                            Util::LightningException, "Too many qubits");
+}
+
+TEST_CASE("StabilizerTableau::invalid arguments", "[StabilizerTableau]") {
+    StabilizerTableau tableau(3);
+    PL_CHECK_THROWS_MATCHES(tableau.applyOperation(GateOperation::T, {0}),
+                            Util::LightningException, "not a Clifford gate");
+    PL_CHECK_THROWS_MATCHES(tableau.applyOperation(GateOperation::CNOT, {0}),
+                            Util::LightningException,
+                            "Invalid number of wires");
+    PL_CHECK_THROWS_MATCHES(
+        tableau.applyOperation(GateOperation::CZ, {1, 1}),
+        Util::LightningException, "Wires must be distinct");
+    PL_CHECK_THROWS_MATCHES(
+        tableau.applyOperation(GateOperation::Hadamard, {3}),
+        Util::LightningException, "Invalid wire index");
+    PL_CHECK_THROWS_MATCHES(StabilizerTableau(3, 8), Util::LightningException,
+                            "Invalid basis state index");
+    REQUIRE(StabilizerTableau::isClifford(GateOperation::CY));
+    REQUIRE(!StabilizerTableau::isClifford(GateOperation::RX));
+}
+
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::Clifford prefix",
+                   "[StabilizerTableau]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 5;
+    const std::vector<std::string> ops{"Hadamard", "CNOT", "S",  "CZ",
+                                       "Hadamard", "CY",   "SWAP", "T",
+                                       "Hadamard", "RX",   "CNOT"};
+    const std::vector<std::vector<size_t>> wires{
+        {0}, {0, 3}, {3}, {3, 1}, {1}, {1, 4}, {4, 2}, {2}, {2}, {0}, {2, 0}};
+    const std::vector<bool> inverses{false, false, true,  false,
+                                     false, false, false, false,
+                                     false, true,  false};
+    const std::vector<std::vector<PrecisionT>> params{
+        {}, {}, {}, {}, {}, {}, {}, {}, {}, {0.3}, {}};
+
+    StateVectorManagedCPU<PrecisionT> expected(num_qubits);
+    expected.applyOperations(ops, wires, inverses, params);
+
+    SECTION("applyOperations") {
+        StateVectorManagedCPU<PrecisionT> sv(num_qubits);
+        REQUIRE(sv.beginCliffordPrefix());
+        REQUIRE(sv.inCliffordPrefix());
+        sv.applyOperations(ops, wires, inverses, params);
+        REQUIRE(!sv.inCliffordPrefix());
+        REQUIRE(sv.getDataVector() ==
+                approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("applyOperation with deferred execution") {
+        StateVectorManagedCPU<PrecisionT> sv(num_qubits);
+        sv.setDeferredExecution(true);
+        REQUIRE(sv.beginCliffordPrefix());
+        for (size_t i = 0; i < 7; i++) {
+            sv.applyOperation(ops[i], wires[i], inverses[i], params[i]);
+        }
+        REQUIRE(sv.inCliffordPrefix());
+        REQUIRE(sv.getNumDeferredOperations() == 0);
+        for (size_t i = 7; i < ops.size(); i++) {
+            sv.applyOperation(ops[i], wires[i], inverses[i], params[i]);
+        }
+        REQUIRE(!sv.inCliffordPrefix());
+        REQUIRE(sv.getNumDeferredOperations() == 4);
+        sv.flushOperations();
+        REQUIRE(sv.getDataVector() ==
+                approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Written by flushOperations") {
+        StateVectorManagedCPU<PrecisionT> sv(num_qubits);
+        REQUIRE(sv.beginCliffordPrefix());
+        sv.applyOperations({ops.begin(), ops.begin() + 7},
+                           {wires.begin(), wires.begin() + 7},
+                           {inverses.begin(), inverses.begin() + 7});
+        REQUIRE(sv.inCliffordPrefix());
+        REQUIRE(sv.hasPendingOperations());
+        const auto &const_sv = sv;
+        PL_CHECK_THROWS_MATCHES(const_sv.getData(), Util::LightningException,
+                                "pending operations");
+        sv.flushOperations();
+        REQUIRE(!sv.inCliffordPrefix());
+        std::vector<std::complex<PrecisionT>> state(
+            const_sv.getData(), const_sv.getData() + const_sv.getLength());
+
+        StateVectorManagedCPU<PrecisionT> dense(num_qubits);
+        dense.applyOperations({ops.begin(), ops.begin() + 7},
+                              {wires.begin(), wires.begin() + 7},
+                              {inverses.begin(), inverses.begin() + 7});
+        REQUIRE(state == approx(dense.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Not a basis state") {
+        StateVectorManagedCPU<PrecisionT> sv(num_qubits);
+        sv.applyOperation("Hadamard", {2});
+        REQUIRE(!sv.beginCliffordPrefix());
+        REQUIRE(!sv.inCliffordPrefix());
+    }
+}
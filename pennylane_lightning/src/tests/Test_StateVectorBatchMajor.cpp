@@ -0,0 +1,94 @@
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "StateVectorBatchMajor.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+
+TEMPLATE_TEST_CASE("StateVectorBatchMajor::applyOperation",
+                   "[StateVectorBatchMajor]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 4;
+    const size_t batch_size = 5;
+
+    std::vector<std::vector<std::complex<PrecisionT>>> init_states;
+    for (size_t b = 0; b < batch_size; b++) {
+        const auto state = createRandomState<PrecisionT>(re, num_qubits);
+        init_states.emplace_back(state.begin(), state.end());
+    }
+
+    // Unsorted wires, so that the matrices are permuted
+    const std::vector<size_t> all_wires{3, 0, 2, 1};
+    forEachGateOperation<PrecisionT>(
+        re, all_wires,
+        [&](const std::string &gate_name, const std::vector<size_t> &wires,
+            const auto &draw_params) {
+            std::vector<std::vector<PrecisionT>> params(batch_size);
+            for (auto &batch_params : params) {
+                batch_params = draw_params();
+            }
+
+            for (const bool inverse : {false, true}) {
+                StateVectorBatchMajor<PrecisionT> batch(num_qubits,
+                                                        batch_size);
+                for (size_t b = 0; b < batch_size; b++) {
+                    batch.setState(b, init_states[b].data());
+                }
+                batch.applyOperation(gate_name, wires, inverse, params);
+                for (size_t b = 0; b < batch_size; b++) {
+                    StateVectorManagedCPU<PrecisionT> expected(
+                        init_states[b].data(), init_states[b].size());
+                    expected.applyOperation(gate_name, wires, inverse,
+                                            params[b]);
+                    INFO(gate_name);
+                    REQUIRE(batch.getState(b) ==
+                            approx(expected.getDataVector()).margin(1e-5));
+                }
+            }
+        });
+}
+
+TEMPLATE_TEST_CASE("StateVectorBatchMajor::Data", "[StateVectorBatchMajor]",
+                   float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 3;
+    const size_t batch_size = 4;
+
+    StateVectorBatchMajor<PrecisionT> batch(num_qubits, batch_size);
+    REQUIRE(batch.getNumQubits() == num_qubits);
+    REQUIRE(batch.getBatchSize() == batch_size);
+    REQUIRE(batch.getLength() == 8);
+
+    std::vector<std::complex<PrecisionT>> zero(8);
+    zero[0] = 1.0;
+    for (size_t b = 0; b < batch_size; b++) {
+        REQUIRE(batch.getState(b) == approx(zero));
+    }
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    const std::vector<std::complex<PrecisionT>> expected(init_state.begin(),
+                                                         init_state.end());
+    batch.setAllStates(init_state.data());
+    for (size_t b = 0; b < batch_size; b++) {
+        REQUIRE(batch.getState(b) == approx(expected));
+    }
+
+    PL_CHECK_THROWS_MATCHES(batch.getState(batch_size),
+                            Util::LightningException, "Invalid batch index");
+    PL_CHECK_THROWS_MATCHES(batch.applyOperation("RX", {0}, false, {{0.1}}),
+                            Util::LightningException,
+                            "must match the batch size");
+    PL_CHECK_THROWS_MATCHES(batch.applyOperation("CNOT", {0, num_qubits}),
+                            Util::LightningException, "Invalid wire index");
+    PL_CHECK_THROWS_MATCHES(StateVectorBatchMajor<PrecisionT>(num_qubits, 0),
+                            Util::LightningException,
+                            "batch size must be positive");
+}
@@ -0,0 +1,142 @@
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "StateVectorCompressedCPU.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+
+TEMPLATE_TEST_CASE("StateVectorCompressedCPU::applyOperations",
+                   "[StateVectorCompressedCPU]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 8;
+
+    // Each gate acts on some chunk selecting wires with 2^3 chunks
+    StateVectorCompressedCPU<PrecisionT> sv(num_qubits, 5);
+    StateVectorManagedCPU<PrecisionT> expected(num_qubits);
+    REQUIRE(sv.getNumChunks() == 8);
+
+    std::vector<std::string> ops;
+    std::vector<std::vector<size_t>> ops_wires;
+    std::vector<bool> ops_inverse;
+    std::vector<std::vector<PrecisionT>> ops_params;
+    for (const size_t wire : {0, 3, 6, 7}) {
+        ops.emplace_back("Hadamard");
+        ops_wires.push_back({wire});
+        ops_inverse.push_back(false);
+        ops_params.emplace_back();
+    }
+    const std::vector<size_t> all_wires{7, 0, 4, 2, 5, 1, 6, 3};
+    forEachGateOperation<PrecisionT>(
+        re, all_wires,
+        [&](const std::string &gate_name, const std::vector<size_t> &wires,
+            const auto &draw_params) {
+            const auto params = draw_params();
+            for (const bool inverse : {false, true}) {
+                ops.push_back(gate_name);
+                ops_wires.push_back(wires);
+                ops_inverse.push_back(inverse);
+                ops_params.push_back(params);
+            }
+        },
+        3);
+
+    sv.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+    expected.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+    REQUIRE(sv.getFullState() ==
+            approx(expected.getDataVector()).margin(1e-5));
+    CHECK(sv.getLayout() != std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7});
+
+    const std::vector<std::complex<PrecisionT>> matrix{
+        {0.0, 0.0}, {0.0, -1.0}, {1.0, 0.0}, {0.0, 0.0}};
+    for (const size_t wire : {0, 7}) {
+        sv.applyMatrix(matrix, {wire}, true);
+        expected.applyMatrix(matrix, {wire}, true);
+    }
+    sv.applyOperation("CRY", {2, 5}, false, {0.3});
+    expected.applyOperation("CRY", {2, 5}, false, {0.3});
+    REQUIRE(sv.getFullState() ==
+            approx(expected.getDataVector()).margin(1e-5));
+
+    const auto probs = sv.probs({6, 1, 3});
+    const auto &dense = expected.getDataVector();
+    std::vector<PrecisionT> expected_probs(8, 0);
+    for (size_t idx = 0; idx < dense.size(); idx++) {
+        const size_t outcome = (((idx >> 1U) & 1U) << 2U) |
+                               (((idx >> 6U) & 1U) << 1U) |
+                               ((idx >> 4U) & 1U);
+        expected_probs[outcome] += std::norm(dense[idx]);
+    }
+    CHECK(probs == approx(expected_probs).margin(1e-5));
+    CHECK(sv.getNorm2() == Approx(1.0).margin(1e-5));
+
+    PL_CHECK_THROWS_MATCHES(sv.applyOperation("CNOT", {0, num_qubits}),
+                            Util::LightningException, "Invalid wire");
+    PL_CHECK_THROWS_MATCHES(sv.applyMatrix(matrix, {0, 1}),
+                            Util::LightningException,
+                            "The size of matrix does not match");
+    PL_CHECK_THROWS_MATCHES(StateVectorCompressedCPU<PrecisionT>(4, 5),
+                            Util::LightningException,
+                            "must be between 1 and the number of qubits");
+}
+
+TEMPLATE_TEST_CASE("StateVectorCompressedCPU compression",
+                   "[StateVectorCompressedCPU]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    const size_t num_qubits = 12;
+    const size_t length = size_t{1U} << num_qubits;
+
+    SECTION("Zero blocks are not stored") {
+        StateVectorCompressedCPU<PrecisionT> sv(num_qubits, 8);
+        // The bitmap and a single block of the first chunk
+        const size_t basis_size = 8 + 32 * sizeof(ComplexPrecisionT);
+        CHECK(sv.getCompressedSize() == basis_size);
+
+        // GHZ state on the first and last wire, which are both moved to the
+        // least significant positions, so the state is held by one block
+        sv.applyOperation("Hadamard", {0});
+        sv.applyOperation("CNOT", {0, num_qubits - 1});
+        CHECK(sv.getCompressedSize() == basis_size);
+        const auto state = sv.getFullState();
+        CHECK(state[0].real() == Approx(M_SQRT1_2));
+        CHECK(state[(length / 2) | 1U].real() == Approx(M_SQRT1_2));
+    }
+
+    SECTION("Fixed16") {
+        std::mt19937 re{42};
+        std::normal_distribution<PrecisionT> dist;
+        std::vector<ComplexPrecisionT> data(length);
+        for (auto &amp : data) {
+            amp = {dist(re), dist(re)};
+        }
+        StateVectorCompressedCPU<PrecisionT> sv(num_qubits, 8,
+                                                ChunkCompression::Fixed16);
+        sv.setFullState(data.data(), data.size());
+        // Bitmap, then an exponent and 64 components per block
+        CHECK(sv.getCompressedSize() == 16 * (8 + 8 * (4 + 64 * 2)));
+        REQUIRE(sv.getCompression() == ChunkCompression::Fixed16);
+
+        const auto decompressed = sv.getFullState();
+        for (size_t block = 0; block < length / 32; block++) {
+            PrecisionT max_abs = 0;
+            for (size_t k = 32 * block; k < 32 * block + 32; k++) {
+                max_abs = std::max({max_abs, std::abs(data[k].real()),
+                                    std::abs(data[k].imag())});
+            }
+            PrecisionT max_err = 0;
+            for (size_t k = 32 * block; k < 32 * block + 32; k++) {
+                max_err = std::max(
+                    {max_err, std::abs(decompressed[k].real() - data[k].real()),
+                     std::abs(decompressed[k].imag() - data[k].imag())});
+            }
+            REQUIRE(max_err <= max_abs / 32767 * PrecisionT{1.001});
+        }
+    }
+}
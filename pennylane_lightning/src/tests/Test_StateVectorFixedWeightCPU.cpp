@@ -0,0 +1,180 @@
+#include <bit>
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AdjointDiff.hpp"
+#include "AdjointDiffFixedWeight.hpp"
+#include "PauliSum.hpp"
+#include "StateVectorFixedWeightCPU.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+TEMPLATE_TEST_CASE("StateVectorFixedWeightCPU indexing",
+                   "[StateVectorFixedWeightCPU]", float, double) {
+    using PrecisionT = TestType;
+
+    const StateVectorFixedWeightCPU<PrecisionT> sv(7, 3);
+    REQUIRE(sv.getLength() == 35);
+    size_t previous = 0;
+    for (size_t rank = 0; rank < sv.getLength(); rank++) {
+        const size_t state = sv.stateOf(rank);
+        REQUIRE(std::popcount(state) == 3);
+        REQUIRE(sv.rankOf(state) == rank);
+        REQUIRE((rank == 0 || state > previous));
+        previous = state;
+    }
+    REQUIRE(sv.stateOf(0) == 0b0000111);
+    REQUIRE(sv.stateOf(34) == 0b1110000);
+
+    REQUIRE(StateVectorFixedWeightCPU<PrecisionT>(6, 0).getLength() == 1);
+    REQUIRE(StateVectorFixedWeightCPU<PrecisionT>(6, 6).getLength() == 1);
+    PL_CHECK_THROWS_MATCHES(StateVectorFixedWeightCPU<PrecisionT>(4, 5),
+                            Util::LightningException,
+                            "must not exceed the number of qubits");
+}
+
+TEMPLATE_TEST_CASE("StateVectorFixedWeightCPU::applyOperation",
+                   "[StateVectorFixedWeightCPU]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+    std::uniform_real_distribution<PrecisionT> param_dist(-M_PI, M_PI);
+    const size_t num_qubits = 6;
+
+    StateVectorFixedWeightCPU<PrecisionT> sv(num_qubits, 3);
+    StateVectorManagedCPU<PrecisionT> expected(num_qubits);
+    // Hartree-Fock state with the first three wires occupied
+    sv.setBasisState(0b111000);
+    expected.applyOperation("PauliX", {0});
+    expected.applyOperation("PauliX", {1});
+    expected.applyOperation("PauliX", {2});
+
+    const std::vector<std::pair<std::string, std::vector<size_t>>> gates{
+        {"SingleExcitation", {2, 4}},
+        {"DoubleExcitation", {0, 1, 3, 5}},
+        {"SingleExcitationMinus", {1, 3}},
+        {"SingleExcitationPlus", {4, 0}},
+        {"DoubleExcitationMinus", {5, 2, 1, 4}},
+        {"DoubleExcitationPlus", {3, 0, 2, 5}},
+        {"IsingXY", {1, 5}},
+        {"SWAP", {0, 3}},
+        {"CSWAP", {2, 1, 5}},
+        {"Identity", {1}},
+        {"PauliZ", {4}},
+        {"S", {0}},
+        {"T", {5}},
+        {"PhaseShift", {2}},
+        {"RZ", {3}},
+        {"CZ", {1, 4}},
+        {"IsingZZ", {0, 5}},
+        {"ControlledPhaseShift", {3, 2}},
+        {"CRZ", {4, 1}},
+        {"MultiRZ", {0, 2, 3, 5}}};
+    for (const auto &[name, wires] : gates) {
+        const auto gate_op =
+            DynamicDispatcher<PrecisionT>::getInstance().strToGateOp(name);
+        std::vector<PrecisionT> params(
+            Util::lookup(Gates::Constant::gate_num_params, gate_op));
+        for (auto &param : params) {
+            param = param_dist(re);
+        }
+        for (const bool inverse : {false, true}) {
+            sv.applyOperation(name, wires, inverse, params);
+            expected.applyOperation(name, wires, inverse, params);
+            INFO(name);
+            REQUIRE(sv.getDataVector() ==
+                    approx(expected.getDataVector()).margin(1e-5));
+        }
+    }
+
+    const auto amp = sv.getAmplitude(0b101010);
+    const auto expected_amp = expected.getDataVector()[0b101010];
+    CHECK(amp.real() == Approx(expected_amp.real()).margin(1e-6));
+    CHECK(amp.imag() == Approx(expected_amp.imag()).margin(1e-6));
+    CHECK(sv.getAmplitude(0b101011) == ComplexPrecisionT{});
+
+    const std::vector<ComplexPrecisionT> givens{
+        {1.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0},
+        {0.0, 0.0}, {0.6, 0.0}, {0.0, 0.8}, {0.0, 0.0},
+        {0.0, 0.0}, {0.0, 0.8}, {0.6, 0.0}, {0.0, 0.0},
+        {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {1.0, 0.0}};
+    for (const bool inverse : {false, true}) {
+        sv.applyMatrix(givens, {3, 1}, inverse);
+        expected.applyMatrix(givens, {3, 1}, inverse);
+        REQUIRE(sv.getDataVector() ==
+                approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    PL_CHECK_THROWS_MATCHES(sv.applyOperation("RX", {0}, false, {0.3}),
+                            Util::LightningException,
+                            "does not conserve the Hamming weight");
+    PL_CHECK_THROWS_MATCHES(sv.setBasisState(0b000011),
+                            Util::LightningException,
+                            "must have the Hamming weight");
+    PL_CHECK_THROWS_MATCHES(sv.applyOperation("CZ", {0, num_qubits}),
+                            Util::LightningException, "Invalid wire index");
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobianFixedWeight::adjointJacobian",
+                   "[StateVectorFixedWeightCPU]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 6;
+
+    const OpsData<PrecisionT> ops(
+        {"DoubleExcitation", "SingleExcitation", "SingleExcitation",
+         "SingleExcitationPlus", "RZ", "DoubleExcitation"},
+        {{0.3}, {-0.7}, {0.4}, {1.1}, {0.5}, {-0.2}},
+        {{0, 1, 3, 4}, {2, 5}, {1, 3}, {0, 4}, {2}, {2, 3, 4, 5}},
+        {false, false, true, false, false, false});
+    const std::vector<size_t> trainable{0, 1, 3, 4, 5};
+
+    // Weight-conserving Hamiltonian, plus a term which never contributes
+    const PauliSum<PrecisionT> hamiltonian(
+        {0.5, 0.25, -0.25, 0.3, -0.4, 0.7},
+        {"ZZ", "XXYY", "XYYX", "Z", "XY", "X"},
+        {{0, 1}, {0, 1, 3, 4}, {2, 3, 4, 5}, {5}, {1, 3}, {2}});
+    const PauliSum<PrecisionT> number(
+        {0.5, 0.5, 0.5}, {"Z", "Z", "Z"}, {{0}, {3}, {4}});
+
+    StateVectorFixedWeightCPU<PrecisionT> sv(num_qubits, 3);
+    sv.setBasisState(0b111000);
+
+    auto init_state = StateVectorManagedCPU<PrecisionT>(num_qubits);
+    for (const size_t wire : {0, 1, 2}) {
+        init_state.applyOperation("PauliX", {wire});
+    }
+    auto dense_state = init_state.getDataVector();
+    const std::vector<ObsDatum<PrecisionT>> obs{
+        ObsDatum<PrecisionT>(hamiltonian), ObsDatum<PrecisionT>(number)};
+    const JacobianData<PrecisionT> tape{trainable.size(), dense_state.size(),
+                                        dense_state.data(), obs, ops,
+                                        trainable};
+    std::vector<PrecisionT> expected(obs.size() * trainable.size());
+    AdjointJacobian<PrecisionT> dense_adj;
+    dense_adj.adjointJacobian(expected, tape, true);
+
+    std::vector<PrecisionT> jac(obs.size() * trainable.size());
+    AdjointJacobianFixedWeight<PrecisionT> adj;
+    adj.adjointJacobian(jac, sv, {hamiltonian, number}, ops, trainable, true);
+    CHECK(jac == approx(expected).margin(1e-5));
+
+    StateVectorFixedWeightCPU<PrecisionT> final_sv(sv);
+    StateVectorManagedCPU<PrecisionT> final_dense(init_state);
+    final_sv.applyOperations(ops.getOpsName(), ops.getOpsWires(),
+                             ops.getOpsInverses(), ops.getOpsParams());
+    final_dense.applyOperations(ops.getOpsName(), ops.getOpsWires(),
+                                ops.getOpsInverses(), ops.getOpsParams());
+    CHECK(final_sv.expval(hamiltonian) ==
+          Approx(hamiltonian.expval(final_dense.getData(), num_qubits))
+              .margin(1e-5));
+    CHECK(final_sv.expval(number) ==
+          Approx(number.expval(final_dense.getData(), num_qubits))
+              .margin(1e-5));
+}
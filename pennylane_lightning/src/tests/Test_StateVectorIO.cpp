@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <complex>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "StateVectorIO.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "StateVectorRawCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+
+namespace {
+auto tempPath(const std::string &name) -> std::string {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("saveStateVector and loadStateVector", "[StateVectorIO]",
+                   float, double) {
+    using PrecisionT = TestType;
+    std::mt19937_64 re{1337};
+    const size_t num_qubits = 6;
+    auto st_data = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorRawCPU<PrecisionT> sv(st_data.data(), st_data.size());
+    const auto path =
+        tempPath("pl_sv_io_" + std::to_string(sizeof(PrecisionT)));
+
+    SECTION("Uncompressed") {
+        // Uneven chunks
+        saveStateVector(sv, path, StateVectorCompression::None, 100);
+        const auto header = readStateVectorHeader(path);
+        CHECK(header.num_qubits == num_qubits);
+        CHECK(header.precision_bytes == sizeof(PrecisionT));
+        CHECK(header.layout == StateVectorLayout::Interleaved);
+        CHECK(header.compression == StateVectorCompression::None);
+        CHECK(std::filesystem::file_size(path) ==
+              sizeof(StateVectorFileHeader) +
+                  st_data.size() * sizeof(st_data[0]));
+
+        const auto loaded = loadStateVector<PrecisionT>(path);
+        CHECK(loaded.getDataVector() == st_data);
+
+        std::vector<std::complex<PrecisionT>> buffer(st_data.size());
+        StateVectorRawCPU<PrecisionT> raw(buffer.data(), buffer.size());
+        loadStateVector(path, raw);
+        CHECK(std::equal(buffer.begin(), buffer.end(), st_data.begin()));
+    }
+
+    SECTION("Save a managed statevector over an existing file") {
+        saveStateVector(sv, path);
+        StateVectorManagedCPU<PrecisionT> managed(2);
+        saveStateVector(managed, path);
+        CHECK(std::filesystem::file_size(path) ==
+              sizeof(StateVectorFileHeader) + 4 * sizeof(st_data[0]));
+        CHECK(loadStateVector<PrecisionT>(path).getDataVector() ==
+              managed.getDataVector());
+    }
+
+    SECTION("Compressed") {
+        if (!Internal::zlibSupported()) {
+            PL_CHECK_THROWS_MATCHES(
+                saveStateVector(sv, path, StateVectorCompression::Zlib),
+                Util::LightningException, "without zlib support");
+        } else {
+            saveStateVector(sv, path, StateVectorCompression::Zlib, 256);
+            CHECK(readStateVectorHeader(path).compression ==
+                  StateVectorCompression::Zlib);
+            CHECK(loadStateVector<PrecisionT>(path).getDataVector() ==
+                  st_data);
+
+            // Sparse states compress well
+            StateVectorManagedCPU<PrecisionT> zero(num_qubits);
+            saveStateVector(zero, path, StateVectorCompression::Zlib);
+            CHECK(std::filesystem::file_size(path) <
+                  st_data.size() * sizeof(st_data[0]) / 4);
+            CHECK(loadStateVector<PrecisionT>(path).getDataVector() ==
+                  zero.getDataVector());
+        }
+    }
+
+    SECTION("Mismatched statevectors") {
+        saveStateVector(sv, path);
+        StateVectorManagedCPU<PrecisionT> small(num_qubits - 1);
+        PL_CHECK_THROWS_MATCHES(loadStateVector(path, small),
+                                Util::LightningException,
+                                "different number of qubits");
+
+        using OtherT = std::conditional_t<std::is_same_v<PrecisionT, float>,
+                                          double, float>;
+        PL_CHECK_THROWS_MATCHES(loadStateVector<OtherT>(path),
+                                Util::LightningException,
+                                "different precision");
+    }
+
+    SECTION("Invalid files") {
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out << std::string(sizeof(StateVectorFileHeader), 'x');
+        }
+        PL_CHECK_THROWS_MATCHES(loadStateVector<PrecisionT>(path),
+                                Util::LightningException,
+                                "not a saved statevector");
+
+        saveStateVector(sv, path);
+        std::filesystem::resize_file(path, sizeof(StateVectorFileHeader) + 8);
+        PL_CHECK_THROWS_MATCHES(loadStateVector<PrecisionT>(path),
+                                Util::LightningException, "corrupted");
+    }
+    std::filesystem::remove(path);
+}
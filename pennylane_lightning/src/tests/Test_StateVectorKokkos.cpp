@@ -0,0 +1,178 @@
+#if defined(_ENABLE_KOKKOS)
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "AdjointDiff.hpp"
+#include "AdjointDiffKokkos.hpp"
+#include "Measures.hpp"
+#include "StateVectorKokkos.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+TEMPLATE_TEST_CASE("StateVectorKokkos::applyOperations",
+                   "[StateVectorKokkos]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 5;
+    std::mt19937_64 re{1337};
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    const std::vector<std::string> ops{"Hadamard", "CNOT",    "RX",
+                                       "Toffoli",  "SWAP",    "CRY",
+                                       "IsingXY",  "PauliY",  "MultiRZ"};
+    const std::vector<std::vector<size_t>> wires{
+        {0}, {0, 4}, {1}, {0, 1, 2}, {1, 3}, {2, 0}, {4, 1}, {1}, {0, 1, 3}};
+    const std::vector<bool> inverses{false, false, true,  false, false,
+                                     false, true,  false, false};
+    const std::vector<std::vector<PrecisionT>> params{
+        {}, {}, {0.3}, {}, {}, {-0.4}, {1.2}, {}, {0.5}};
+
+    StateVectorManagedCPU<PrecisionT> expected(init_state.data(),
+                                               init_state.size());
+    expected.applyOperations(ops, wires, inverses, params);
+
+    StateVectorKokkos<PrecisionT> sv(num_qubits);
+    sv.setStateVector(init_state.data(), init_state.size());
+    sv.applyOperations(ops, wires, inverses, params);
+    CHECK(sv.getStateVector() ==
+          approx(expected.getDataVector()).margin(1e-5));
+
+    SECTION("Matrix") {
+        const std::vector<std::complex<PrecisionT>> matrix{
+            {0.5, 0.5}, {0.5, -0.5}, {0.5, -0.5}, {0.5, 0.5}};
+        sv.applyMatrix(matrix, {3}, true);
+        expected.applyMatrix(matrix, {3}, true);
+        CHECK(sv.getStateVector() ==
+              approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Measurements") {
+        Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> measures(
+            expected);
+        CHECK(sv.probs({0, 3}) ==
+              approx(measures.probs({0, 3})).margin(1e-5));
+        CHECK(sv.expval("PauliX", {0}) ==
+              Approx(measures.expval("PauliX", {0})).margin(1e-5));
+        CHECK(sv.var("PauliZ", {1}) ==
+              Approx(measures.var("PauliZ", {1})).margin(1e-5));
+        CHECK(sv.getNorm2() == Approx(1.0).margin(1e-5));
+    }
+
+    SECTION("Reset") {
+        sv.resetState();
+        std::vector<std::complex<PrecisionT>> zero(init_state.size());
+        zero[0] = {1, 0};
+        CHECK(sv.getStateVector() == approx(zero));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorKokkos::applyOperation kernels",
+                   "[StateVectorKokkos]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 5;
+    std::mt19937_64 re{1337};
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    StateVectorManagedCPU<PrecisionT> expected(init_state.data(),
+                                               init_state.size());
+    StateVectorKokkos<PrecisionT> sv(num_qubits);
+    sv.setStateVector(init_state.data(), init_state.size());
+    const auto apply = [&](const std::string &op,
+                           const std::vector<size_t> &wires, bool inverse,
+                           const std::vector<PrecisionT> &params) {
+        expected.applyOperation(op, wires, inverse, params);
+        sv.applyOperation(op, wires, inverse, params);
+        CHECK(sv.getStateVector() ==
+              approx(expected.getDataVector()).margin(1e-5));
+    };
+
+    SECTION("One-qubit gates") {
+        apply("Hadamard", {3}, false, {});
+        apply("RX", {0}, true, {0.7});
+        apply("Rot", {4}, false, {0.1, -0.5, 1.3});
+        apply("S", {2}, true, {});
+    }
+
+    SECTION("Two-qubit gates") {
+        apply("CNOT", {4, 1}, false, {});
+        apply("CRY", {0, 3}, true, {-0.6});
+        apply("SWAP", {2, 0}, false, {});
+        apply("IsingXY", {3, 4}, false, {1.1}); // Computed by the kernels
+    }
+
+    SECTION("Diagonal gates") {
+        apply("RZ", {1}, false, {0.4});
+        apply("CZ", {3, 0}, false, {});
+        apply("ControlledPhaseShift", {2, 4}, true, {0.9});
+        apply("MultiRZ", {4, 0, 2}, false, {-0.3});
+    }
+
+    SECTION("Gates on more than two wires") {
+        apply("Toffoli", {3, 0, 4}, false, {});
+        apply("CSWAP", {1, 4, 2}, true, {});
+        apply("DoubleExcitation", {0, 2, 1, 4}, false, {0.5});
+    }
+
+    SECTION("Generators") {
+        const auto expected_scale =
+            expected.applyGenerator("CRX", {2, 0}, true);
+        CHECK(sv.applyGenerator("CRX", {2, 0}, true) ==
+              Approx(expected_scale));
+        CHECK(sv.getStateVector() ==
+              approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Matrices are cached by gate and parameters") {
+        apply("RY", {1}, false, {0.3});
+        apply("RY", {2}, false, {0.3});
+        CHECK(sv.getNumCachedMatrices() == 1);
+        apply("RY", {2}, false, {0.4});
+        apply("RY", {2}, true, {0.4});
+        CHECK(sv.getNumCachedMatrices() == 3);
+
+        // Copies share the cache
+        StateVectorKokkos<PrecisionT> copy(sv);
+        copy.applyOperation("RY", {0}, false, {0.3});
+        CHECK(sv.getNumCachedMatrices() == 3);
+        copy.applyOperation("Toffoli", {0, 1, 2});
+        CHECK(sv.getNumCachedMatrices() == 4);
+    }
+}
+
+TEMPLATE_TEST_CASE("AdjointJacobianKokkos::adjointJacobian",
+                   "[AdjointJacobianKokkos]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 4;
+    std::mt19937_64 re{1337};
+    auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    const auto ops = OpsData<PrecisionT>(
+        {"RX", "CNOT", "RY", "CRZ", "IsingXX", "RZ"},
+        {{0.4}, {}, {-0.7}, {1.1}, {0.3}, {-0.2}},
+        {{0}, {0, 3}, {1}, {3, 0}, {1, 2}, {0}},
+        {false, false, true, false, false, false});
+    const std::vector<size_t> tp{0, 2, 3, 4};
+    const std::vector<ObsDatum<PrecisionT>> obs_ls{
+        ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+        ObsDatum<PrecisionT>({"PauliX", "PauliY"}, {{}, {}}, {{1}, {3}})};
+
+    const JacobianData<PrecisionT> tape{tp.size(), init_state.size(),
+                                        init_state.data(), obs_ls,
+                                        ops, tp};
+    std::vector<PrecisionT> expected(tp.size() * obs_ls.size());
+    AdjointJacobian<PrecisionT>().adjointJacobian(expected, tape, true);
+
+    StateVectorKokkos<PrecisionT> sv(num_qubits);
+    sv.setStateVector(init_state.data(), init_state.size());
+    std::vector<PrecisionT> jacobian(tp.size() * obs_ls.size());
+    AdjointJacobianKokkos<PrecisionT>().adjointJacobian(jacobian, sv, obs_ls,
+                                                        ops, tp, true);
+    CHECK(jacobian == approx(expected).margin(1e-5));
+}
+#endif
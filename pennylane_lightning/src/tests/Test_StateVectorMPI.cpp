@@ -0,0 +1,109 @@
+#include <complex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Measures.hpp"
+#include "StateVectorMPI.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+
+namespace {
+template <class PrecisionT> struct TestCircuit {
+    std::vector<std::string> ops{"Hadamard", "CNOT",    "RX", "Toffoli",
+                                 "SWAP",     "CRY",     "IsingXY",
+                                 "RZ",       "PauliY",  "MultiRZ"};
+    std::vector<std::vector<size_t>> wires{
+        {0}, {0, 4}, {1}, {0, 1, 2}, {1, 3}, {2, 0}, {4, 1}, {0}, {1},
+        {0, 1, 3}};
+    std::vector<bool> inverses{false, false, true,  false, false,
+                               false, true,  false, false, false};
+    std::vector<std::vector<PrecisionT>> params{
+        {}, {}, {0.3}, {}, {}, {-0.4}, {1.2}, {0.7}, {}, {0.5}};
+};
+} // namespace
+
+TEMPLATE_TEST_CASE("StateVectorMPI::applyOperations", "[StateVectorMPI]",
+                   float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 5;
+    std::mt19937_64 re{1337};
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    const TestCircuit<PrecisionT> circuit;
+
+    StateVectorManagedCPU<PrecisionT> expected(init_state.data(),
+                                               init_state.size());
+    expected.applyOperations(circuit.ops, circuit.wires, circuit.inverses,
+                             circuit.params);
+
+    StateVectorMPI<PrecisionT> sv(num_qubits);
+    REQUIRE(sv.getNumGlobalQubits() + sv.getNumLocalQubits() == num_qubits);
+    REQUIRE(Util::exp2(sv.getNumGlobalQubits()) == sv.getNumRanks());
+    sv.setFullState(init_state.data(), init_state.size());
+    sv.applyOperations(circuit.ops, circuit.wires, circuit.inverses,
+                       circuit.params);
+
+    const auto full_state = sv.getFullState();
+    CHECK(full_state == approx(expected.getDataVector()).margin(1e-5));
+
+    SECTION("Matrix") {
+        const std::vector<std::complex<PrecisionT>> matrix{
+            {0.5, 0.5}, {0.5, -0.5}, {0.5, -0.5}, {0.5, 0.5}};
+        sv.applyMatrix(matrix, {0});
+        expected.applyMatrix(matrix, {0});
+        CHECK(sv.getFullState() ==
+              approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Layout changes keep the state") {
+        std::vector<size_t> layout(num_qubits);
+        std::iota(layout.rbegin(), layout.rend(), size_t{0});
+        sv.setLayout(layout);
+        CHECK(sv.getLayout() == layout);
+        CHECK(sv.getFullState() == approx(full_state).margin(1e-5));
+    }
+
+    SECTION("Measurements") {
+        Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> measures(
+            expected);
+        CHECK(sv.probs({0, 3}) ==
+              approx(measures.probs({0, 3})).margin(1e-5));
+        CHECK(sv.probs({0, 2, 4}) ==
+              approx(measures.probs({0, 2, 4})).margin(1e-5));
+        CHECK(sv.expval("PauliX", {0}) ==
+              Approx(measures.expval("PauliX", {0})).margin(1e-5));
+        CHECK(sv.var("PauliZ", {1}) ==
+              Approx(measures.var("PauliZ", {1})).margin(1e-5));
+        CHECK(sv.getNorm2() == Approx(1.0).margin(1e-5));
+
+        const std::vector<std::complex<PrecisionT>> pauli_y{
+            {0, 0}, {0, -1}, {0, 1}, {0, 0}};
+        CHECK(sv.expval(pauli_y, {0}) ==
+              Approx(measures.expval("PauliY", {0})).margin(1e-5));
+    }
+
+    SECTION("Inner products of different layouts") {
+        StateVectorMPI<PrecisionT> other(num_qubits);
+        other.setFullState(init_state.data(), init_state.size());
+        const auto overlap = sv.innerProd(other);
+        CHECK(other.getLayout() == sv.getLayout());
+        const auto expected_overlap =
+            Util::innerProdC(expected.getDataVector(), init_state);
+        CHECK(std::real(overlap) ==
+              Approx(std::real(expected_overlap)).margin(1e-5));
+        CHECK(std::imag(overlap) ==
+              Approx(std::imag(expected_overlap)).margin(1e-5));
+    }
+
+    SECTION("Reset") {
+        sv.resetState();
+        std::vector<std::complex<PrecisionT>> zero(init_state.size());
+        zero[0] = {1, 0};
+        CHECK(sv.getFullState() == approx(zero));
+    }
+}
@@ -51,6 +51,14 @@ TEMPLATE_TEST_CASE("StateVectorManagedCPU::StateVectorManagedCPU",
         "StateVectorManagedCPU<TestType> {StateVectorManagedCPU<TestType>&&}") {
         REQUIRE(std::is_move_constructible_v<StateVectorManagedCPU<TestType>>);
     }
+    SECTION("Aligned 128bit statevector") {
+        const auto memory_model = CPUMemoryModel::Aligned128;
+        StateVectorManagedCPU<PrecisionT> sv(4, Threading::SingleThread,
+                                             memory_model);
+        REQUIRE(getMemoryModel(sv.getDataVector().data()) !=
+                CPUMemoryModel::Unaligned);
+    }
+
     SECTION("Aligned 256bit statevector") {
         const auto memory_model = CPUMemoryModel::Aligned256;
         StateVectorManagedCPU<PrecisionT> sv(4, Threading::SingleThread,
@@ -70,6 +78,61 @@ TEMPLATE_TEST_CASE("StateVectorManagedCPU::StateVectorManagedCPU",
         REQUIRE((getMemoryModel(sv.getDataVector().data()) ==
                  CPUMemoryModel::Aligned512));
     }
+
+    SECTION("NUMA policy") {
+        StateVectorManagedCPU<PrecisionT> sv_single(4);
+        REQUIRE(sv_single.numaPolicy() == Util::NUMAPolicy::Default);
+
+        StateVectorManagedCPU<PrecisionT> sv_multi(4, Threading::MultiThread);
+        REQUIRE(sv_multi.numaPolicy() == Util::NUMAPolicy::FirstTouch);
+        REQUIRE(StateVectorManagedCPU<PrecisionT>(sv_multi).numaPolicy() ==
+                Util::NUMAPolicy::FirstTouch);
+
+        StateVectorManagedCPU<PrecisionT> sv_interleave(
+            4, Threading::MultiThread, bestCPUMemoryModel(),
+            Util::NUMAPolicy::Interleave);
+        REQUIRE(sv_interleave.numaPolicy() == Util::NUMAPolicy::Interleave);
+        REQUIRE(sv_interleave.getDataVector() ==
+                approx(sv_single.getDataVector()));
+    }
+
+    SECTION("Reused data holds the initial state") {
+        std::vector<std::complex<PrecisionT>> expected(16);
+        expected[0] = {1, 0};
+        for (const auto threading :
+             {Threading::SingleThread, Threading::MultiThread}) {
+            Util::BufferPool pool;
+            const auto make_sv = [&]() {
+                return StateVectorManagedCPU<PrecisionT>(
+                    4, threading, bestCPUMemoryModel(),
+                    bestNUMAPolicy(threading), Util::HugePagePolicy::Disabled,
+                    &pool);
+            };
+            {
+                auto sv = make_sv();
+                REQUIRE(sv.getDataVector() == approx(expected));
+                std::fill(sv.getData(), sv.getData() + sv.getLength(),
+                          std::complex<PrecisionT>{0.5, -0.5});
+            }
+            REQUIRE(pool.cachedBytes() > 0);
+            auto sv = make_sv();
+            REQUIRE(pool.cachedBytes() == 0);
+            REQUIRE(sv.getDataVector() == approx(expected));
+        }
+    }
+
+    SECTION("Huge pages") {
+        StateVectorManagedCPU<PrecisionT> sv(4);
+        REQUIRE(sv.hugePages() == Util::HugePagePolicy::Disabled);
+
+        StateVectorManagedCPU<PrecisionT> sv_huge(
+            4, Threading::SingleThread, bestCPUMemoryModel(),
+            Util::NUMAPolicy::Default, Util::HugePagePolicy::Transparent);
+        REQUIRE(sv_huge.hugePages() == Util::HugePagePolicy::Transparent);
+        REQUIRE(StateVectorManagedCPU<PrecisionT>(sv_huge).hugePages() ==
+                Util::HugePagePolicy::Transparent);
+        REQUIRE(sv_huge.getDataVector() == approx(sv.getDataVector()));
+    }
 }
 
 TEMPLATE_TEST_CASE("StateVectorManagedCPU::applyMatrix with std::vector",
@@ -127,6 +190,170 @@ TEMPLATE_TEST_CASE("StateVectorManagedCPU::applyMatrix with a pointer",
     }
 }
 
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::applySparseMatrix",
+                   "[StateVectorManagedCPU]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 3;
+    const auto length = static_cast<long>(Util::exp2(num_qubits));
+
+    std::vector<long> row_map;
+    std::vector<long> entries;
+    std::vector<std::complex<PrecisionT>> values;
+    write_CSR_vectors(row_map, entries, values, length);
+
+    // Dense matrix with the same entries
+    std::vector<std::complex<PrecisionT>> dense(length * length, 0.0);
+    for (long row = 0; row < length; row++) {
+        for (long j = row_map[row]; j < row_map[row + 1]; j++) {
+            dense[row * length + entries[j]] = values[j];
+        }
+    }
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    const size_t version = sv.getVersion();
+    sv.applySparseMatrix(row_map.data(), static_cast<long>(row_map.size()),
+                         entries.data(), values.data(),
+                         static_cast<long>(values.size()));
+    REQUIRE(sv.getVersion() != version);
+
+    std::vector<std::complex<PrecisionT>> expected(length);
+    Util::matrixVecProd(dense.data(), init_state.data(), expected.data(),
+                        length, length);
+    REQUIRE(sv.getDataVector() == approx(expected).margin(PrecisionT{1e-5}));
+}
+
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::applyControlledMatrix",
+                   "[StateVectorManagedCPU]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 4;
+    const std::vector<std::complex<PrecisionT>> pauli_x{0.0, 1.0, 1.0, 0.0};
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    StateVectorManagedCPU<PrecisionT> expected(init_state.data(),
+                                               init_state.size());
+
+    const size_t version = sv.getVersion();
+    sv.applyControlledMatrix(pauli_x, {3, 0}, {true, true}, {1});
+    REQUIRE(sv.getVersion() != version);
+    expected.applyOperation("Toffoli", {3, 0, 1});
+    REQUIRE(sv.getDataVector() ==
+            approx(expected.getDataVector()).margin(PrecisionT{1e-5}));
+
+    PL_CHECK_THROWS_MATCHES(
+        sv.applyControlledMatrix(pauli_x, {0}, {true}, {1, 2}),
+        Util::LightningException, "The size of matrix does not match");
+}
+
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::applyCostLayer",
+                   "[StateVectorManagedCPU]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+    const PrecisionT gamma = 0.37;
+
+    // C = 0.5 Z_1 Z_4 - 1.2 Z_0 Z_2 Z_3 + 0.8 Z_3 on wires {4, 0, 1, 2, 3}
+    const std::vector<size_t> wires{4, 0, 1, 2, 3};
+    const auto cost = Gates::pauliZCost<PrecisionT>(
+        wires.size(), {{2, 0}, {1, 3, 4}, {4}}, {0.5, -1.2, 0.8});
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    for (const auto threading :
+         {Threading::SingleThread, Threading::MultiThread}) {
+        for (const bool inverse : {false, true}) {
+            StateVectorManagedCPU<PrecisionT> expected(init_state, threading);
+            // exp(-i gamma w Z...Z) is MultiRZ(2 gamma w)
+            expected.applyOperation("IsingZZ", {1, 4}, inverse,
+                                    {2 * gamma * PrecisionT{0.5}});
+            expected.applyOperation("MultiRZ", {0, 2, 3}, inverse,
+                                    {2 * gamma * PrecisionT{-1.2}});
+            expected.applyOperation("RZ", {3}, inverse,
+                                    {2 * gamma * PrecisionT{0.8}});
+
+            StateVectorManagedCPU<PrecisionT> sv(init_state, threading);
+            sv.applyCostLayer(cost, wires, gamma, inverse);
+            REQUIRE(sv.getDataVector() ==
+                    approx(expected.getDataVector()).margin(1e-5));
+        }
+    }
+
+    StateVectorManagedCPU<PrecisionT> sv(init_state);
+    PL_CHECK_THROWS_MATCHES(sv.applyCostLayer(cost, {0, 1}, gamma),
+                            Util::LightningException,
+                            "The size of cost does not match");
+}
+
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::applyPauliRot",
+                   "[StateVectorManagedCPU]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+    const PrecisionT theta = 0.61;
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    const std::vector<size_t> wires{3, 0, 4, 1};
+    for (const std::string word : {"XYZY", "ZIZZ", "IXII", "YXXZ"}) {
+        for (const bool inverse : {false, true}) {
+            // Rotate each Pauli to Z, as H X H = Z and
+            // RX(pi/2) Y RX(-pi/2) = Z
+            StateVectorManagedCPU<PrecisionT> expected(init_state);
+            std::vector<size_t> z_wires;
+            for (size_t k = 0; k < wires.size(); k++) {
+                if (word[k] == 'X') {
+                    expected.applyOperation("Hadamard", {wires[k]});
+                } else if (word[k] == 'Y') {
+                    expected.applyOperation("RX", {wires[k]}, false,
+                                            {M_PI / 2});
+                }
+                if (word[k] != 'I') {
+                    z_wires.push_back(wires[k]);
+                }
+            }
+            expected.applyOperation("MultiRZ", z_wires, inverse, {theta});
+            for (size_t k = 0; k < wires.size(); k++) {
+                if (word[k] == 'X') {
+                    expected.applyOperation("Hadamard", {wires[k]});
+                } else if (word[k] == 'Y') {
+                    expected.applyOperation("RX", {wires[k]}, true,
+                                            {M_PI / 2});
+                }
+            }
+
+            StateVectorManagedCPU<PrecisionT> sv(init_state);
+            sv.applyPauliRot(wires, inverse, theta, word);
+            REQUIRE(sv.getDataVector() ==
+                    approx(expected.getDataVector()).margin(1e-5));
+        }
+
+        // The generator is -P/2
+        StateVectorManagedCPU<PrecisionT> expected(init_state);
+        for (size_t k = 0; k < wires.size(); k++) {
+            if (word[k] != 'I') {
+                expected.applyOperation(std::string("Pauli") + word[k],
+                                        {wires[k]});
+            }
+        }
+        StateVectorManagedCPU<PrecisionT> sv(init_state);
+        REQUIRE(sv.applyPauliRotGenerator(wires, word) ==
+                Approx(-0.5).margin(1e-7));
+        REQUIRE(sv.getDataVector() ==
+                approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    StateVectorManagedCPU<PrecisionT> sv(init_state);
+    PL_CHECK_THROWS_MATCHES(sv.applyPauliRot({0, 1}, false, theta, "XYZ"),
+                            Util::LightningException,
+                            "one letter per wire");
+    PL_CHECK_THROWS_MATCHES(sv.applyPauliRot({0, 1}, false, theta, "XA"),
+                            Util::LightningException,
+                            "must consist of I, X, Y and Z");
+    PL_CHECK_THROWS_MATCHES(sv.applyPauliRot({2, 2}, false, theta, "XY"),
+                            Util::LightningException, "must be distinct");
+}
+
 TEMPLATE_TEST_CASE("StateVectorManagedCPU::applyOperations",
                    "[StateVectorManagedCPU]", float, double) {
     using PrecisionT = TestType;
@@ -192,4 +419,505 @@ TEMPLATE_TEST_CASE("StateVectorManagedCPU::applyOperations",
 
         REQUIRE(sv1.getDataVector() == approx(sv2.getDataVector()));
     }
+
+    SECTION("applyOperation with a gate operation") {
+        using Gates::GateOperation;
+        const size_t num_qubits = 3;
+        StateVectorManagedCPU<PrecisionT> sv1(num_qubits);
+
+        sv1.updateData(createRandomState<PrecisionT>(re, num_qubits));
+        StateVectorManagedCPU<PrecisionT> sv2 = sv1;
+
+        sv1.applyOperations({"RX", "CNOT"}, {{0}, {0, 2}}, {true, false},
+                            {{0.1}, {}});
+
+        sv2.applyOperation(GateOperation::RX, {0}, true, {0.1});
+        sv2.applyOperation(GateOperation::CNOT, {0, 2});
+
+        REQUIRE(sv1.getDataVector() == approx(sv2.getDataVector()));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::applyOperations with cache blocking",
+                   "[StateVectorManagedCPU]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 7;
+
+    // Mixture of gates on low and high reversed wires
+    const std::vector<std::string> ops{
+        "RX",   "CNOT",    "RY",   "Hadamard", "CRZ",  "IsingXX", "RZ",
+        "CNOT", "Toffoli", "Rot",  "PauliY",   "CZ",   "MultiRZ", "SWAP",
+        "RY",   "RX",      "CNOT", "IsingYY",  "CRot", "RZ"};
+    const std::vector<std::vector<size_t>> ops_wires{
+        {6},    {5, 6}, {4},       {0},    {6, 4}, {3, 5}, {5},
+        {0, 6}, {4, 5, 6}, {6},    {1},    {5, 4}, {3, 4, 6}, {2, 6},
+        {2},    {6},    {6, 5},    {4, 5}, {5, 6}, {4}};
+    std::vector<bool> ops_inverse;
+    std::vector<std::vector<PrecisionT>> ops_params;
+    std::uniform_real_distribution<PrecisionT> param_dist(-M_PI, M_PI);
+    for (const auto &op : ops) {
+        const auto gate_op =
+            DynamicDispatcher<PrecisionT>::getInstance().strToGateOp(op);
+        std::vector<PrecisionT> params(
+            Util::lookup(Gates::Constant::gate_num_params, gate_op));
+        for (auto &param : params) {
+            param = param_dist(re);
+        }
+        ops_params.emplace_back(std::move(params));
+        ops_inverse.emplace_back(ops_inverse.size() % 3 == 0);
+    }
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> expected{init_state.data(),
+                                               init_state.size()};
+    expected.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+
+    for (size_t block_qubits = 1; block_qubits <= num_qubits + 1;
+         block_qubits++) {
+        for (size_t max_fused_wires : {0, 2}) {
+            StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                                 init_state.size()};
+            sv.setCacheBlockQubits(block_qubits);
+            sv.setMaxFusedWires(max_fused_wires);
+            REQUIRE(sv.getCacheBlockQubits() == block_qubits);
+            sv.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+
+            REQUIRE(sv.getDataVector() ==
+                    approx(expected.getDataVector()).margin(1e-5));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::lazy SWAP gates",
+                   "[StateVectorManagedCPU]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 6;
+
+    // Random gates interleaved with SWAP networks
+    std::vector<std::string> ops;
+    std::vector<std::vector<size_t>> ops_wires;
+    std::vector<bool> ops_inverse;
+    std::vector<std::vector<PrecisionT>> ops_params;
+    std::uniform_int_distribution<size_t> wire_dist(0, num_qubits - 1);
+    std::uniform_real_distribution<PrecisionT> param_dist(-M_PI, M_PI);
+    for (size_t layer = 0; layer < 4; layer++) {
+        for (size_t i = 0; i < num_qubits; i++) {
+            ops.emplace_back(i % 2 == 0 ? "RX" : "RY");
+            ops_wires.push_back({i});
+            ops_inverse.push_back(false);
+            ops_params.push_back({param_dist(re)});
+        }
+        ops.emplace_back("CRZ");
+        ops_wires.push_back({layer, num_qubits - 1 - layer});
+        ops_inverse.push_back(layer % 2 == 1);
+        ops_params.push_back({param_dist(re)});
+        for (size_t k = 0; k < 5; k++) {
+            const size_t wire0 = wire_dist(re);
+            const size_t shift = 1 + wire_dist(re) % (num_qubits - 1);
+            const size_t wire1 = (wire0 + shift) % num_qubits;
+            ops.emplace_back("SWAP");
+            ops_wires.push_back({wire0, wire1});
+            ops_inverse.push_back(false);
+            ops_params.emplace_back();
+        }
+    }
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> expected{init_state.data(),
+                                               init_state.size()};
+    expected.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+
+    SECTION("Gate by gate") {
+        StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                             init_state.size()};
+        sv.setLazySwaps(true);
+        REQUIRE(sv.getLazySwaps());
+        for (size_t i = 0; i < ops.size(); i++) {
+            sv.applyOperation(ops[i], ops_wires[i], ops_inverse[i],
+                              ops_params[i]);
+        }
+        sv.canonicalizeWires();
+        REQUIRE(sv.getWireMap() == std::vector<size_t>{0, 1, 2, 3, 4, 5});
+        REQUIRE(sv.getDataVector() ==
+                approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Steps") {
+        for (size_t block_qubits : {0, 3}) {
+            for (size_t max_fused_wires : {0, 2}) {
+                StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                                     init_state.size()};
+                sv.setLazySwaps(true);
+                sv.setCacheBlockQubits(block_qubits);
+                sv.setMaxFusedWires(max_fused_wires);
+                sv.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+                sv.setLazySwaps(false);
+                REQUIRE(!sv.getLazySwaps());
+                REQUIRE(sv.getDataVector() ==
+                        approx(expected.getDataVector()).margin(1e-5));
+            }
+        }
+    }
+
+    SECTION("Matrices and diagonals on relabelled wires") {
+        // Any matrix does, it need not be unitary
+        const auto matrix = createRandomState<PrecisionT>(re, 4);
+        const std::vector<std::complex<PrecisionT>> diag{
+            {1, 0}, {0, 1}, {0, -1}, {-1, 0}};
+        const std::vector<std::vector<size_t>> swaps{{0, 3}, {3, 5}, {1, 2}};
+
+        StateVectorManagedCPU<PrecisionT> eager{init_state.data(),
+                                                init_state.size()};
+        StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                             init_state.size()};
+        sv.setLazySwaps(true);
+        for (auto *state : {&eager, &sv}) {
+            for (const auto &wires : swaps) {
+                state->applyOperation("SWAP", wires);
+            }
+            state->applyMatrix(matrix, {3, 0});
+            state->applyControlledMatrix(matrix.data(), {5}, {true}, {1, 2});
+            state->applyDiagonal(diag.data(), {2, 4});
+            state->applyCostLayer(std::vector<PrecisionT>{0, 1, 1, 0}, {0, 5},
+                                  static_cast<PrecisionT>(0.3));
+            [[maybe_unused]] auto scale = state->applyGenerator("RX", {1});
+        }
+        REQUIRE(sv.getWireMap() != std::vector<size_t>{0, 1, 2, 3, 4, 5});
+        sv.canonicalizeWires();
+        REQUIRE(sv.getDataVector() ==
+                approx(eager.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Read-only access requires canonical wires") {
+        auto data = init_state;
+        StateVectorRawCPU<PrecisionT> sv{data.data(), data.size()};
+        sv.setLazySwaps(true);
+        sv.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+        REQUIRE(sv.getWireMap() != std::vector<size_t>{0, 1, 2, 3, 4, 5});
+        REQUIRE(!sv.isCanonical());
+        const auto &const_sv = sv;
+        PL_CHECK_THROWS_MATCHES(const_sv.getData(), Util::LightningException,
+                                "canonicalizeWires");
+        REQUIRE(sv.getWireMap() != std::vector<size_t>{0, 1, 2, 3, 4, 5});
+
+        sv.canonicalizeWires();
+        REQUIRE(sv.isCanonical());
+        const std::vector<std::complex<PrecisionT>> state(
+            const_sv.getData(), const_sv.getData() + const_sv.getLength());
+        REQUIRE(state == approx(expected.getDataVector()).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::deferred execution",
+                   "[StateVectorManagedCPU]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 6;
+
+    std::vector<std::string> ops;
+    std::vector<std::vector<size_t>> ops_wires;
+    std::vector<bool> ops_inverse;
+    std::vector<std::vector<PrecisionT>> ops_params;
+    std::uniform_real_distribution<PrecisionT> param_dist(-M_PI, M_PI);
+    for (size_t layer = 0; layer < 3; layer++) {
+        for (size_t i = 0; i < num_qubits; i++) {
+            ops.emplace_back(i % 2 == 0 ? "RY" : "RZ");
+            ops_wires.push_back({i});
+            ops_inverse.push_back(i % 3 == 0);
+            ops_params.push_back({param_dist(re)});
+        }
+        ops.emplace_back("IsingZZ");
+        ops_wires.push_back({layer, layer + 2});
+        ops_inverse.push_back(false);
+        ops_params.push_back({param_dist(re)});
+        ops.emplace_back("SWAP");
+        ops_wires.push_back({layer, num_qubits - 1});
+        ops_inverse.push_back(false);
+        ops_params.emplace_back();
+        ops.emplace_back("CNOT");
+        ops_wires.push_back({num_qubits - 1, layer + 1});
+        ops_inverse.push_back(false);
+        ops_params.emplace_back();
+    }
+
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+    StateVectorManagedCPU<PrecisionT> expected{init_state.data(),
+                                               init_state.size()};
+    expected.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+
+    SECTION("Gate by gate, flushed by canonicalizeWires") {
+        for (size_t max_fused_wires : {0, 3}) {
+            for (bool layer_scheduling : {false, true}) {
+                StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                                     init_state.size()};
+                sv.setDeferredExecution(true);
+                sv.setLazySwaps(true);
+                sv.setMaxFusedWires(max_fused_wires);
+                sv.setLayerScheduling(layer_scheduling);
+                REQUIRE(sv.getDeferredExecution());
+                for (size_t i = 0; i < ops.size(); i++) {
+                    sv.applyOperation(ops[i], ops_wires[i], ops_inverse[i],
+                                      ops_params[i]);
+                }
+                REQUIRE(sv.getNumDeferredOperations() == ops.size());
+                REQUIRE(sv.hasPendingOperations());
+
+                // Read-only access does not apply the pending gates
+                const auto &const_sv = sv;
+                PL_CHECK_THROWS_MATCHES(const_sv.getDataVector(),
+                                        Util::LightningException,
+                                        "pending operations");
+                REQUIRE(sv.getNumDeferredOperations() == ops.size());
+
+                sv.canonicalizeWires();
+                REQUIRE(!sv.hasPendingOperations());
+                REQUIRE(sv.getWireMap() ==
+                        std::vector<size_t>{0, 1, 2, 3, 4, 5});
+                REQUIRE(const_sv.getDataVector() ==
+                        approx(expected.getDataVector()).margin(1e-5));
+            }
+        }
+    }
+
+    SECTION("Flushed before other operations") {
+        const std::vector<std::complex<PrecisionT>> diag{
+            {1, 0}, {0, 1}, {0, -1}, {-1, 0}};
+        StateVectorManagedCPU<PrecisionT> eager{init_state.data(),
+                                                init_state.size()};
+        StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                             init_state.size()};
+        sv.setDeferredExecution(true);
+        sv.setMaxFusedWires(2);
+        for (auto *state : {&eager, &sv}) {
+            state->applyOperations(ops, ops_wires, ops_inverse, ops_params);
+            state->applyDiagonal(diag.data(), {2, 4});
+            state->applyOperation("Hadamard", {1});
+        }
+        REQUIRE(sv.getNumDeferredOperations() == 1);
+        sv.setDeferredExecution(false);
+        REQUIRE(!sv.getDeferredExecution());
+        REQUIRE(sv.getNumDeferredOperations() == 0);
+        REQUIRE(sv.getDataVector() ==
+                approx(eager.getDataVector()).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::mid-circuit measurements",
+                   "[StateVectorManagedCPU]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 4;
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    // Statevector projected onto an outcome of a wire and renormalized,
+    // with the amplitudes moved to outcome 0 if reset
+    auto projected = [&](size_t wire, size_t outcome, bool reset) {
+        const size_t bit = size_t{1U} << (num_qubits - 1 - wire);
+        std::vector<ComplexPrecisionT> state(init_state.size());
+        PrecisionT prob = 0.0;
+        for (size_t idx = 0; idx < init_state.size(); idx++) {
+            if (((idx & bit) != 0) == (outcome == 1)) {
+                state[reset ? (idx & ~bit) : idx] = init_state[idx];
+                prob += std::norm(init_state[idx]);
+            }
+        }
+        for (auto &amp : state) {
+            amp /= std::sqrt(prob);
+        }
+        return std::make_pair(state, prob);
+    };
+
+    for (size_t wire = 0; wire < num_qubits; wire++) {
+        const PrecisionT prob0 = projected(wire, 0, false).second;
+        for (const size_t outcome : {size_t{0}, size_t{1}}) {
+            const auto [expected, prob] = projected(wire, outcome, false);
+            const auto [expected_reset, unused] = projected(wire, outcome, true);
+            static_cast<void>(unused);
+            // Random numbers on either side of the probability of 0
+            const double random = (outcome == 0) ? 0.99 * prob0 : prob0 + 0.01;
+
+            StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                                 init_state.size()};
+            REQUIRE(sv.collapse(wire, outcome) == Approx(prob).margin(1e-5));
+            CHECK(sv.getDataVector() == approx(expected).margin(1e-5));
+
+            StateVectorManagedCPU<PrecisionT> measured{init_state.data(),
+                                                       init_state.size()};
+            REQUIRE(measured.measureWire(wire, random) == outcome);
+            CHECK(measured.getDataVector() == approx(expected).margin(1e-5));
+
+            StateVectorManagedCPU<PrecisionT> reset{init_state.data(),
+                                                    init_state.size()};
+            REQUIRE(reset.resetWire(wire, random) == outcome);
+            CHECK(reset.getDataVector() ==
+                  approx(expected_reset).margin(1e-5));
+        }
+    }
+
+    SECTION("Lazy SWAP gates") {
+        StateVectorManagedCPU<PrecisionT> expected{init_state.data(),
+                                                   init_state.size()};
+        expected.applyOperation("SWAP", {0, 2});
+        expected.collapse(2, 1);
+
+        StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                             init_state.size()};
+        sv.setLazySwaps(true);
+        sv.applyOperation("SWAP", {0, 2});
+        sv.collapse(2, 1);
+        sv.canonicalizeWires();
+        CHECK(sv.getDataVector() ==
+              approx(expected.getDataVector()).margin(1e-5));
+    }
+    SECTION("Invalid arguments") {
+        StateVectorManagedCPU<PrecisionT> sv{num_qubits};
+        PL_CHECK_THROWS_MATCHES(sv.collapse(0, 1), Util::LightningException,
+                                "zero probability");
+        PL_CHECK_THROWS_MATCHES(sv.collapse(0, 2), Util::LightningException,
+                                "must be 0 or 1");
+        PL_CHECK_THROWS_MATCHES(sv.measureWire(num_qubits, 0.5),
+                                Util::LightningException,
+                                "Invalid wire index");
+        // Outcomes of zero probability are never drawn
+        REQUIRE(sv.measureWire(0, 0.999) == 0);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::state preparation",
+                   "[StateVectorManagedCPU]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 4;
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    SECTION("setBasisState") {
+        StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                             init_state.size()};
+        const auto *data_before = sv.getData();
+        sv.setBasisState(5);
+        std::vector<ComplexPrecisionT> expected(init_state.size());
+        expected[5] = 1.0;
+        CHECK(sv.getDataVector() == approx(expected));
+        CHECK(sv.getData() == data_before);
+
+        // Pending gates and wire relabelling refer to the overwritten state
+        sv.setLazySwaps(true);
+        sv.setDeferredExecution(true);
+        sv.applyOperation("SWAP", {0, 3});
+        sv.applyOperation("RX", {1}, false, {0.4});
+        sv.setBasisState(2);
+        REQUIRE(sv.getNumDeferredOperations() == 0);
+        REQUIRE(sv.getWireMap() == std::vector<size_t>{0, 1, 2, 3});
+        std::fill(expected.begin(), expected.end(), ComplexPrecisionT{});
+        expected[2] = 1.0;
+        CHECK(sv.getDataVector() == approx(expected));
+
+        PL_CHECK_THROWS_MATCHES(sv.setBasisState(init_state.size()),
+                                Util::LightningException,
+                                "Invalid basis state index");
+    }
+    SECTION("setStateVector") {
+        const auto sub_state = createRandomState<PrecisionT>(re, 2);
+        const std::vector<ComplexPrecisionT> values(sub_state.begin(),
+                                                    sub_state.end());
+        const std::vector<size_t> wires{3, 1};
+
+        // Tensor product of the sub-register state with |0> on the other
+        // wires
+        std::vector<ComplexPrecisionT> expected(init_state.size());
+        for (size_t idx = 0; idx < values.size(); idx++) {
+            const size_t bit3 = (idx >> 1U) & 1U;
+            const size_t bit1 = idx & 1U;
+            expected[(bit1 << 2U) | bit3] = values[idx];
+        }
+
+        StateVectorManagedCPU<PrecisionT> sv{init_state.data(),
+                                             init_state.size()};
+        const auto *data_before = sv.getData();
+        sv.setStateVector(values, wires);
+        CHECK(sv.getDataVector() == approx(expected));
+        CHECK(sv.getData() == data_before);
+
+        // A state of all wires is copied as is
+        sv.setStateVector(init_state.data(), {0, 1, 2, 3});
+        CHECK(sv.getDataVector() == approx(init_state));
+
+        PL_CHECK_THROWS_MATCHES(sv.setStateVector(values, {0, 0}),
+                                Util::LightningException,
+                                "Wires must be distinct");
+        PL_CHECK_THROWS_MATCHES(sv.setStateVector(values, {0, num_qubits}),
+                                Util::LightningException,
+                                "Invalid wire index");
+        PL_CHECK_THROWS_MATCHES(sv.setStateVector(values, {0}),
+                                Util::LightningException,
+                                "does not match");
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorManagedCPU::amplitudes and overlaps",
+                   "[StateVectorManagedCPU]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+    const auto state_a = createRandomState<PrecisionT>(re, num_qubits);
+    const auto state_b = createRandomState<PrecisionT>(re, num_qubits);
+
+    SECTION("getAmplitudes") {
+        const std::vector<size_t> indices{0, 17, 5, 31, 17};
+        std::vector<ComplexPrecisionT> expected;
+        for (const size_t index : indices) {
+            expected.emplace_back(state_a[index]);
+        }
+        StateVectorManagedCPU<PrecisionT> sv{state_a.data(), state_a.size()};
+        CHECK(sv.getAmplitudes(indices) == approx(expected));
+        CHECK(sv.getAmplitudes({}).empty());
+
+        // Indices are mapped to the physical order of the data
+        StateVectorManagedCPU<PrecisionT> swapped{state_a.data(),
+                                                  state_a.size()};
+        swapped.setLazySwaps(true);
+        swapped.applyOperation("SWAP", {0, 3});
+        swapped.applyOperation("SWAP", {3, 4});
+        sv.applyOperation("SWAP", {0, 3});
+        sv.applyOperation("SWAP", {3, 4});
+        REQUIRE(swapped.getWireMap() != std::vector<size_t>{0, 1, 2, 3, 4});
+        CHECK(swapped.getAmplitudes(indices) ==
+              approx(sv.getAmplitudes(indices)));
+
+        PL_CHECK_THROWS_MATCHES(sv.getAmplitudes({32}),
+                                Util::LightningException,
+                                "Invalid basis state index");
+    }
+    SECTION("overlap and fidelity") {
+        StateVectorManagedCPU<PrecisionT> sv_a{state_a.data(), state_a.size()};
+        StateVectorManagedCPU<PrecisionT> sv_b{state_b.data(), state_b.size()};
+        const auto expected = Util::innerProdC(state_a, state_b);
+        const auto checkOverlap = [&]() {
+            const auto result = overlap(sv_a, sv_b);
+            CHECK(std::real(result) ==
+                  Approx(std::real(expected)).margin(1e-6));
+            CHECK(std::imag(result) ==
+                  Approx(std::imag(expected)).margin(1e-6));
+        };
+        checkOverlap();
+        CHECK(fidelity(sv_a, sv_b) ==
+              Approx(std::norm(expected)).margin(1e-6));
+        CHECK(fidelity(sv_a, sv_a) == Approx(1.0).margin(1e-6));
+
+        // Lazy SWAP gates on one of the states are undone first
+        sv_a.setLazySwaps(true);
+        sv_a.applyOperation("SWAP", {1, 2});
+        sv_b.applyOperation("SWAP", {1, 2});
+        checkOverlap();
+
+        StateVectorManagedCPU<PrecisionT> small{num_qubits - 1};
+        PL_CHECK_THROWS_MATCHES(overlap(sv_a, small),
+                                Util::LightningException,
+                                "same number of qubits");
+    }
 }
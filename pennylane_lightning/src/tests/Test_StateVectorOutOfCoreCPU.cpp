@@ -0,0 +1,103 @@
+#include <complex>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "MappedMemory.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "StateVectorOutOfCoreCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+
+#if defined(PL_HAS_MMAP)
+TEMPLATE_TEST_CASE("StateVectorOutOfCoreCPU::applyOperations",
+                   "[StateVectorOutOfCoreCPU]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+    std::uniform_real_distribution<PrecisionT> param_dist(-M_PI, M_PI);
+    const size_t num_qubits = 8;
+    const auto path = (std::filesystem::temp_directory_path() /
+                       ("pl_out_of_core_sv_" + std::to_string(sizeof(
+                                                   PrecisionT))))
+                          .string();
+
+    {
+        // 2^3 chunks of 2^5 amplitudes
+        StateVectorOutOfCoreCPU<PrecisionT> sv(num_qubits, 5, path);
+        StateVectorManagedCPU<PrecisionT> expected(num_qubits);
+        REQUIRE(sv.getNumChunks() == 8);
+        REQUIRE(sv.getPath() == path);
+        REQUIRE(std::filesystem::file_size(path) ==
+                (size_t{1U} << num_qubits) * sizeof(ComplexPrecisionT));
+
+        std::vector<std::string> ops;
+        std::vector<std::vector<size_t>> ops_wires;
+        std::vector<bool> ops_inverse;
+        std::vector<std::vector<PrecisionT>> ops_params;
+        const auto add_op = [&](const std::string &name,
+                                std::vector<size_t> wires,
+                                size_t num_params) {
+            std::vector<PrecisionT> params(num_params);
+            for (auto &param : params) {
+                param = param_dist(re);
+            }
+            ops.push_back(name);
+            ops_wires.push_back(std::move(wires));
+            ops_inverse.push_back(false);
+            ops_params.push_back(std::move(params));
+        };
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            add_op("Hadamard", {wire}, 0);
+        }
+        // Gates on chunk qubits, then on chunk selecting qubits
+        add_op("RX", {7}, 1);
+        add_op("CRY", {4, 6}, 1);
+        add_op("IsingXY", {5, 3}, 1);
+        add_op("CNOT", {0, 7}, 0);
+        add_op("Rot", {1}, 3);
+        add_op("DoubleExcitation", {2, 0, 6, 1}, 1);
+        add_op("MultiRZ", {0, 1, 2}, 1);
+        add_op("Toffoli", {6, 2, 5}, 0);
+
+        sv.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+        expected.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+        REQUIRE(sv.getFullState() ==
+                approx(expected.getDataVector()).margin(1e-5));
+        CHECK(sv.getLayout() != std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7});
+
+        const std::vector<ComplexPrecisionT> matrix{
+            {0.0, 0.0}, {0.0, -1.0}, {1.0, 0.0}, {0.0, 0.0}};
+        sv.applyMatrix(matrix, {2}, true);
+        expected.applyMatrix(matrix, {2}, true);
+        REQUIRE(sv.getFullState() ==
+                approx(expected.getDataVector()).margin(1e-5));
+
+        const auto probs = sv.probs({3, 0});
+        const auto &dense = expected.getDataVector();
+        std::vector<PrecisionT> expected_probs(4, 0);
+        for (size_t idx = 0; idx < dense.size(); idx++) {
+            const size_t outcome =
+                (((idx >> 4U) & 1U) << 1U) | ((idx >> 7U) & 1U);
+            expected_probs[outcome] += std::norm(dense[idx]);
+        }
+        CHECK(probs == approx(expected_probs).margin(1e-5));
+        CHECK(sv.getNorm2() == Approx(1.0).margin(1e-5));
+        sv.flush();
+
+        sv.resetState();
+        const auto state = sv.getFullState();
+        CHECK(state[0] == ComplexPrecisionT{1, 0});
+        CHECK(sv.getNorm2() == Approx(1.0));
+    }
+    std::filesystem::remove(path);
+
+    PL_CHECK_THROWS_MATCHES(
+        StateVectorOutOfCoreCPU<PrecisionT>(num_qubits, 2, "/nonexistent/sv"),
+        Util::LightningException, "Cannot open");
+}
+#endif
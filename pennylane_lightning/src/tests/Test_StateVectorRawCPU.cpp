@@ -1,7 +1,12 @@
 #include <complex>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
 #include <numeric>
+#include <string>
 #include <vector>
 
+#include "Measures.hpp"
 #include "StateVectorRawCPU.hpp"
 #include "TestHelpers.hpp"
 #include "Util.hpp"
@@ -56,4 +61,101 @@ TEMPLATE_TEST_CASE("StateVectorRawCPU::setData", "[StateVectorRawCPU]", float,
 
         REQUIRE_THROWS(sv.setData(new_data.data(), new_data.size()));
     }
+
+    SECTION("The owner of the data is released") {
+        auto makeOwned = [] {
+            const auto state = createRandomState<PrecisionT>(re, 3);
+            return std::make_shared<std::vector<std::complex<PrecisionT>>>(
+                state.begin(), state.end());
+        };
+        auto owned = makeOwned();
+        std::weak_ptr<void> weak = owned;
+        auto *data = owned->data();
+        const size_t length = owned->size();
+        {
+            StateVectorRawCPU<PrecisionT> sv(data, length, std::move(owned));
+            REQUIRE(sv.getData() == data);
+            REQUIRE(!weak.expired());
+        }
+        REQUIRE(weak.expired());
+
+        owned = makeOwned();
+        weak = owned;
+        StateVectorRawCPU<PrecisionT> sv(owned->data(), owned->size(),
+                                         owned);
+        owned.reset();
+        REQUIRE(!weak.expired());
+        auto st_data = createRandomState<PrecisionT>(re, 2);
+        sv.setData(st_data.data(), st_data.size());
+        REQUIRE(weak.expired());
+    }
+}
+
+#if defined(PL_HAS_MMAP)
+TEMPLATE_TEST_CASE("StateVectorRawCPU from a mapped region",
+                   "[StateVectorRawCPU]", float, double) {
+    using PrecisionT = TestType;
+    using Util::MapAccess;
+    using Util::MappedMemory;
+    const size_t num_qubits = 4;
+    const auto st_data = createRandomState<PrecisionT>(re, num_qubits);
+    const size_t bytes = st_data.size() * sizeof(std::complex<PrecisionT>);
+
+    const auto check_shared = [&](const auto &writable, const auto &readonly) {
+        StateVectorRawCPU<PrecisionT> writer(writable);
+        std::copy(st_data.begin(), st_data.end(), writer.getData());
+        writer.applyOperation("Hadamard", {0});
+
+        const StateVectorRawCPU<PrecisionT> reader(readonly);
+        REQUIRE(reader.isReadOnly());
+        REQUIRE(reader.getNumQubits() == num_qubits);
+        REQUIRE(reader.getData() != writer.getData());
+        REQUIRE(std::equal(reader.getData(),
+                           reader.getData() + reader.getLength(),
+                           writer.getData()));
+
+        Measures<PrecisionT, StateVectorRawCPU<PrecisionT>> measures(reader);
+        const auto probs = measures.probs();
+        Measures<PrecisionT, StateVectorRawCPU<PrecisionT>> expected(writer);
+        CHECK(probs == approx(expected.probs()));
+
+        auto modifiable = reader;
+        PL_CHECK_THROWS_MATCHES(modifiable.getData(), Util::LightningException,
+                                "mapped read-only");
+    };
+
+    SECTION("File") {
+        const auto path = (std::filesystem::temp_directory_path() /
+                           ("pl_mapped_sv_" + std::to_string(bytes)))
+                              .string();
+        const auto writable =
+            MappedMemory::mapFile(path, MapAccess::ReadWrite, bytes);
+        check_shared(writable,
+                     MappedMemory::mapFile(path, MapAccess::ReadOnly));
+        std::filesystem::remove(path);
+
+        PL_CHECK_THROWS_MATCHES(
+            MappedMemory::mapFile(path, MapAccess::ReadOnly),
+            Util::LightningException, "Cannot open");
+    }
+
+    SECTION("Shared memory") {
+        const std::string name = "/pl_mapped_sv_" + std::to_string(bytes);
+        const auto writable =
+            MappedMemory::mapSharedMemory(name, MapAccess::ReadWrite, bytes);
+        check_shared(writable,
+                     MappedMemory::mapSharedMemory(name, MapAccess::ReadOnly));
+        MappedMemory::unlinkSharedMemory(name);
+    }
+
+    SECTION("Invalid sizes") {
+        const auto path = (std::filesystem::temp_directory_path() /
+                           ("pl_mapped_sv_invalid_" + std::to_string(bytes)))
+                              .string();
+        const auto mapping =
+            MappedMemory::mapFile(path, MapAccess::ReadWrite, 3 * bytes);
+        std::filesystem::remove(path);
+        REQUIRE_THROWS(StateVectorRawCPU<PrecisionT>(mapping));
+    }
 }
+#endif
@@ -0,0 +1,169 @@
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "StateVectorManagedCPU.hpp"
+#include "StateVectorSparseCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+
+TEMPLATE_TEST_CASE("StateVectorSparseCPU::applyOperation",
+                   "[StateVectorSparseCPU]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+
+    // Never converted to a dense statevector
+    StateVectorSparseCPU<PrecisionT> sv(num_qubits, size_t{1U} << num_qubits);
+    StateVectorManagedCPU<PrecisionT> expected(num_qubits);
+    for (const auto &wires : std::vector<std::vector<size_t>>{{0}, {3}}) {
+        sv.applyOperation("Hadamard", wires);
+        expected.applyOperation("Hadamard", wires);
+    }
+
+    const std::vector<size_t> all_wires{3, 0, 4, 1, 2};
+    forEachGateOperation<PrecisionT>(
+        re, all_wires,
+        [&](const std::string &gate_name, const std::vector<size_t> &wires,
+            const auto &draw_params) {
+            const auto params = draw_params();
+            for (const bool inverse : {false, true}) {
+                sv.applyOperation(gate_name, wires, inverse, params);
+                expected.applyOperation(gate_name, wires, inverse, params);
+                INFO(gate_name);
+                REQUIRE(sv.getDataVector() ==
+                        approx(expected.getDataVector()).margin(1e-5));
+            }
+        });
+    REQUIRE(!sv.isDense());
+}
+
+TEMPLATE_TEST_CASE("StateVectorSparseCPU reversible circuits",
+                   "[StateVectorSparseCPU]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    const size_t num_qubits = 40;
+    const auto bit = [num_qubits](size_t wire) {
+        return size_t{1U} << (num_qubits - 1 - wire);
+    };
+
+    StateVectorSparseCPU<PrecisionT> sv(num_qubits);
+    sv.setBasisState(bit(0) | bit(1) | bit(20));
+    sv.applyOperation("Toffoli", {0, 1, 39});
+    sv.applyOperation("CNOT", {20, 30});
+    sv.applyOperation("CSWAP", {39, 20, 21});
+    sv.applyOperation("SWAP", {0, 5});
+    sv.applyOperation("PauliX", {2});
+    sv.applyOperation("CZ", {1, 2});
+    sv.applyOperation("MultiRZ", {0, 5, 10, 30}, false, {PrecisionT{0.4}});
+    sv.applyOperation("PauliY", {2});
+
+    REQUIRE(!sv.isDense());
+    REQUIRE(sv.getSupportSize() == 1);
+    const size_t index = bit(1) | bit(5) | bit(21) | bit(30) | bit(39);
+    // CZ gives -1, MultiRZ on an even parity gives exp(-0.2i) and
+    // Y|1> = -i|0>
+    const ComplexPrecisionT amp = sv.getAmplitude(index);
+    CHECK(amp.real() == Approx(std::sin(0.2)));
+    CHECK(amp.imag() == Approx(std::cos(0.2)));
+
+    const auto [indices, amplitudes] = sv.getSparseData();
+    REQUIRE(indices == std::vector<size_t>{index});
+    REQUIRE(amplitudes.size() == 1);
+}
+
+TEMPLATE_TEST_CASE("StateVectorSparseCPU::convertToDense",
+                   "[StateVectorSparseCPU]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    const size_t num_qubits = 6;
+
+    StateVectorSparseCPU<PrecisionT> sv(num_qubits, 4);
+    StateVectorManagedCPU<PrecisionT> expected(num_qubits);
+    const std::vector<std::string> ops{"Hadamard", "Hadamard", "CNOT",
+                                       "Hadamard", "RY",       "Toffoli"};
+    const std::vector<std::vector<size_t>> ops_wires{{0}, {1},    {1, 4},
+                                                     {2}, {5},    {0, 2, 3}};
+    const std::vector<bool> ops_inverse(ops.size(), false);
+    const std::vector<std::vector<PrecisionT>> ops_params{
+        {}, {}, {}, {}, {PrecisionT{0.3}}, {}};
+
+    // H H on the same wire cancels out exactly
+    sv.applyOperation("Hadamard", {0});
+    sv.applyOperation("Hadamard", {0});
+    REQUIRE(sv.getSupportSize() == 1);
+
+    sv.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+    expected.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+    REQUIRE(sv.isDense());
+    REQUIRE(sv.getSupportSize() == sv.getLength());
+    REQUIRE(sv.getDataVector() ==
+            approx(expected.getDataVector()).margin(1e-6));
+
+    const std::vector<ComplexPrecisionT> matrix{
+        {0.0, 0.0}, {0.0, -1.0}, {1.0, 0.0}, {0.0, 0.0}};
+    sv.applyMatrix(matrix, {3}, true);
+    expected.applyMatrix(matrix, {3}, true);
+    REQUIRE(sv.getDataVector() ==
+            approx(expected.getDataVector()).margin(1e-6));
+    const auto amp = sv.getAmplitude(5);
+    const auto expected_amp = expected.getDataVector()[5];
+    CHECK(amp.real() == Approx(expected_amp.real()));
+    CHECK(amp.imag() == Approx(expected_amp.imag()));
+
+    sv.setBasisState(3);
+    REQUIRE(!sv.isDense());
+    REQUIRE(sv.getSupportSize() == 1);
+}
+
+TEMPLATE_TEST_CASE("StateVectorSparseCPU::applyMatrix",
+                   "[StateVectorSparseCPU]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    const size_t num_qubits = 4;
+
+    StateVectorSparseCPU<PrecisionT> sv(num_qubits, 16);
+    StateVectorManagedCPU<PrecisionT> expected(num_qubits);
+    sv.applyOperation("Hadamard", {1});
+    expected.applyOperation("Hadamard", {1});
+
+    // A permutation with phases, and a dense matrix
+    const std::vector<ComplexPrecisionT> monomial{
+        {0.0, 0.0}, {0.0, 0.0}, {0.0, 1.0}, {0.0, 0.0},
+        {1.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0},
+        {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {-1.0, 0.0},
+        {0.0, 0.0}, {0.0, -1.0}, {0.0, 0.0}, {0.0, 0.0}};
+    // Quantum Fourier transform of two qubits
+    const std::vector<ComplexPrecisionT> dense{
+        {0.5, 0.0}, {0.5, 0.0},  {0.5, 0.0},  {0.5, 0.0},
+        {0.5, 0.0}, {0.0, 0.5},  {-0.5, 0.0}, {0.0, -0.5},
+        {0.5, 0.0}, {-0.5, 0.0}, {0.5, 0.0},  {-0.5, 0.0},
+        {0.5, 0.0}, {0.0, -0.5}, {-0.5, 0.0}, {0.0, 0.5}};
+    sv.applyMatrix(monomial, {2, 1});
+    expected.applyMatrix(monomial, {2, 1});
+    REQUIRE(sv.getSupportSize() == 2);
+    for (const bool inverse : {false, true}) {
+        sv.applyMatrix(monomial, {2, 1}, inverse);
+        expected.applyMatrix(monomial, {2, 1}, inverse);
+        sv.applyMatrix(dense, {3, 0}, inverse);
+        expected.applyMatrix(dense, {3, 0}, inverse);
+        REQUIRE(sv.getDataVector() ==
+                approx(expected.getDataVector()).margin(1e-5));
+    }
+    REQUIRE(!sv.isDense());
+
+    PL_CHECK_THROWS_MATCHES(sv.applyMatrix(monomial, {1}),
+                            Util::LightningException,
+                            "The size of matrix does not match");
+    PL_CHECK_THROWS_MATCHES(sv.applyOperation("CNOT", {0, num_qubits}),
+                            Util::LightningException, "Invalid wire index");
+    PL_CHECK_THROWS_MATCHES(sv.getAmplitude(16), Util::LightningException,
+                            "Invalid basis state index");
+    PL_CHECK_THROWS_MATCHES(StateVectorSparseCPU<PrecisionT>(64),
+                            Util::LightningException,
+                            "number of qubits must be smaller than 64");
+}
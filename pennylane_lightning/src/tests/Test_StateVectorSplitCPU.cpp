@@ -0,0 +1,101 @@
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "LinearAlgebra.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "StateVectorSplitCPU.hpp"
+#include "TestHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+
+TEMPLATE_TEST_CASE("StateVectorSplitCPU::applyOperation",
+                   "[StateVectorSplitCPU]", float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 5;
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    // Unsorted wires, so that the matrices are permuted
+    const std::vector<size_t> all_wires{3, 0, 4, 1, 2};
+    forEachGateOperation<PrecisionT>(
+        re, all_wires,
+        [&](const std::string &gate_name, const std::vector<size_t> &wires,
+            const auto &draw_params) {
+            const auto params = draw_params();
+            for (const bool inverse : {false, true}) {
+                StateVectorManagedCPU<PrecisionT> expected(init_state);
+                expected.applyOperation(gate_name, wires, inverse, params);
+
+                StateVectorSplitCPU<PrecisionT> sv(init_state.data(),
+                                                   init_state.size());
+                sv.applyOperation(gate_name, wires, inverse, params);
+                INFO(gate_name);
+                REQUIRE(sv.getDataVector() ==
+                        approx(expected.getDataVector()).margin(1e-5));
+            }
+        });
+}
+
+TEMPLATE_TEST_CASE("StateVectorSplitCPU::applyMatrix", "[StateVectorSplitCPU]",
+                   float, double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 4;
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    for (const auto &wires :
+         std::vector<std::vector<size_t>>{{2}, {3, 1}, {0, 2, 1}}) {
+        const auto matrix =
+            Util::randomUnitary<PrecisionT>(re, wires.size());
+        for (const bool inverse : {false, true}) {
+            StateVectorManagedCPU<PrecisionT> expected(init_state);
+            expected.applyMatrix(matrix, wires, inverse);
+
+            StateVectorSplitCPU<PrecisionT> sv(init_state.data(),
+                                               init_state.size());
+            sv.applyMatrix(matrix, wires, inverse);
+            REQUIRE(sv.getDataVector() ==
+                    approx(expected.getDataVector()).margin(1e-5));
+        }
+    }
+
+    StateVectorSplitCPU<PrecisionT> sv(num_qubits);
+    PL_CHECK_THROWS_MATCHES(sv.applyMatrix(std::vector<std::complex<PrecisionT>>(
+                                               8),
+                                           {0, 1}),
+                            Util::LightningException,
+                            "The size of matrix does not match");
+    PL_CHECK_THROWS_MATCHES(sv.applyOperation("CNOT", {0, num_qubits}),
+                            Util::LightningException, "Invalid wire index");
+}
+
+TEMPLATE_TEST_CASE("StateVectorSplitCPU::Data", "[StateVectorSplitCPU]", float,
+                   double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 6;
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    StateVectorSplitCPU<PrecisionT> sv(init_state.data(), init_state.size());
+    REQUIRE(sv.getNumQubits() == num_qubits);
+    REQUIRE(sv.getDataVector() == approx(init_state));
+    for (size_t idx = 0; idx < init_state.size(); idx++) {
+        REQUIRE(sv.getReal()[idx] == init_state[idx].real());
+        REQUIRE(sv.getImag()[idx] == init_state[idx].imag());
+    }
+
+    std::vector<PrecisionT> expected_probs(init_state.size());
+    for (size_t idx = 0; idx < init_state.size(); idx++) {
+        expected_probs[idx] = std::norm(init_state[idx]);
+    }
+    REQUIRE(sv.probs() == approx(expected_probs).margin(1e-6));
+
+    StateVectorSplitCPU<PrecisionT> zero(num_qubits);
+    std::vector<std::complex<PrecisionT>> expected_zero(init_state.size());
+    expected_zero[0] = 1.0;
+    REQUIRE(zero.getDataVector() == approx(expected_zero));
+}
@@ -0,0 +1,104 @@
+#include <complex>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "AdjointDiff.hpp"
+#include "KernelMap.hpp"
+#include "TapeExecutor.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+TEMPLATE_TEST_CASE("TapeExecutor::runConcurrently", "[TapeExecutor]", float,
+                   double) {
+    const size_t large = KernelMap::parallel_lm_min_num_qubits;
+    REQUIRE(TapeExecutor<TestType>::runConcurrently(large - 1, 2, 8));
+    REQUIRE(TapeExecutor<TestType>::runConcurrently(large, 8, 8));
+    REQUIRE(!TapeExecutor<TestType>::runConcurrently(large, 2, 8));
+}
+
+TEMPLATE_TEST_CASE("TapeExecutor::execute", "[TapeExecutor]", float, double) {
+    using PrecisionT = TestType;
+    using ComplexPrecisionT = std::complex<PrecisionT>;
+    std::mt19937 re{1337};
+    std::uniform_real_distribution<PrecisionT> param_dist(-M_PI, M_PI);
+
+    // Tapes of different sizes and structures, as in a batch of gradient
+    // shifts and dataset points
+    auto checkBatch = [&](const std::vector<size_t> &tape_num_qubits) {
+        const size_t num_tapes = tape_num_qubits.size();
+        std::vector<std::vector<ComplexPrecisionT>> states;
+        std::vector<JacobianData<PrecisionT>> tapes;
+        states.reserve(num_tapes);
+        for (size_t t = 0; t < num_tapes; t++) {
+            const size_t num_qubits = tape_num_qubits[t];
+            const auto state = createRandomState<PrecisionT>(re, num_qubits);
+            states.emplace_back(state.begin(), state.end());
+
+            std::vector<std::string> ops_name;
+            std::vector<std::vector<PrecisionT>> ops_params;
+            std::vector<std::vector<size_t>> ops_wires;
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                ops_name.emplace_back((wire + t) % 2 == 0 ? "RX" : "RY");
+                ops_params.push_back({param_dist(re)});
+                ops_wires.push_back({wire});
+            }
+            for (size_t wire = 0; wire + 1 < num_qubits; wire++) {
+                ops_name.emplace_back("CNOT");
+                ops_params.emplace_back();
+                ops_wires.push_back({wire, wire + 1});
+            }
+            const OpsData<PrecisionT> ops(
+                ops_name, ops_params, ops_wires,
+                std::vector<bool>(ops_name.size(), false));
+            std::vector<ObsDatum<PrecisionT>> obs{
+                ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+                ObsDatum<PrecisionT>({"PauliX"}, {{}}, {{num_qubits - 1}})};
+            // Only every other tape is differentiated
+            std::vector<size_t> trainable;
+            if (t % 2 == 0) {
+                trainable.resize(num_qubits);
+                std::iota(trainable.begin(), trainable.end(), size_t{0});
+            }
+            tapes.emplace_back(num_qubits, states.back().size(),
+                               states.back().data(), obs, ops, trainable);
+        }
+
+        TapeExecutor<PrecisionT> executor;
+        const auto results = executor.execute(tapes, true);
+        REQUIRE(results.size() == num_tapes);
+        for (size_t t = 0; t < num_tapes; t++) {
+            AdjointJacobian<PrecisionT> adj;
+            const auto expected = adj.execute(tapes[t], true, {}, true);
+            CHECK(results[t].expvals ==
+                  approx(expected.expvals).margin(1e-5));
+            CHECK(results[t].variances ==
+                  approx(expected.variances).margin(1e-5));
+            REQUIRE(results[t].jacobian.size() == expected.jacobian.size());
+            CHECK(results[t].jacobian ==
+                  approx(expected.jacobian).margin(1e-5));
+        }
+    };
+
+    SECTION("Many small tapes") {
+        checkBatch({3, 5, 2, 4, 6, 3, 5, 4, 2, 6, 3, 4, 5});
+    }
+    SECTION("Small and large tapes") {
+        checkBatch({KernelMap::parallel_lm_min_num_qubits, 4, 3});
+    }
+    SECTION("Single tape") { checkBatch({4}); }
+    SECTION("Empty batch") { checkBatch({}); }
+    SECTION("Invalid tape") {
+        std::vector<ComplexPrecisionT> state(4, {0.5, 0.0});
+        const OpsData<PrecisionT> ops({"Foo"}, {{}}, {{0}}, {false});
+        const std::vector<JacobianData<PrecisionT>> tapes{
+            {0, state.size(), state.data(), {}, ops, {}}};
+        TapeExecutor<PrecisionT> executor;
+        REQUIRE_THROWS(executor.execute(tapes));
+    }
+}
@@ -0,0 +1,167 @@
+#include <complex>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "AdjointDiff.hpp"
+#include "Measures.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "Threading.hpp"
+
+#include "TestHelpers.hpp"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(_OPENMP) && defined(__linux__)
+#include <sched.h>
+#endif
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+
+TEST_CASE("ThreadingConfig::numThreads", "[Threading]") {
+    REQUIRE(ThreadingConfig{}.isDefault());
+    REQUIRE(ThreadingConfig{}.numThreads(20) == 0);
+
+    const ThreadingConfig config{4, {}, 10};
+    REQUIRE(!config.isDefault());
+    REQUIRE(config.numThreads(9) == 1);
+    REQUIRE(config.numThreads(10) == 4);
+
+    const ThreadingConfig pinned{0, {0, 1, 2}, 0};
+    REQUIRE(pinned.numThreads(5) == 3);
+}
+
+#if defined(_OPENMP)
+TEST_CASE("ThreadingScope", "[Threading]") {
+    const int max_threads = omp_get_max_threads();
+
+    SECTION("Default configuration") {
+        {
+            const ThreadingScope scope(ThreadingConfig{}, 20);
+            REQUIRE(omp_get_max_threads() == max_threads);
+        }
+        REQUIRE(omp_get_max_threads() == max_threads);
+    }
+    SECTION("Number of threads") {
+        {
+            const ThreadingScope scope(ThreadingConfig{3, {}, 0}, 20);
+            REQUIRE(omp_get_max_threads() == 3);
+        }
+        REQUIRE(omp_get_max_threads() == max_threads);
+    }
+    SECTION("Sequential below a number of qubits") {
+        const ThreadingConfig config{3, {}, 10};
+        {
+            const ThreadingScope scope(config, 9);
+            REQUIRE(omp_get_max_threads() == 1);
+        }
+        {
+            const ThreadingScope scope(config, 10);
+            REQUIRE(omp_get_max_threads() == 3);
+        }
+        REQUIRE(omp_get_max_threads() == max_threads);
+    }
+    SECTION("Inside a parallel region") {
+        int num_changed = 0;
+#pragma omp parallel num_threads(2) reduction(+ : num_changed)
+        {
+            const int inner = omp_get_max_threads();
+            const ThreadingScope scope(ThreadingConfig{3, {}, 0}, 20);
+            num_changed += static_cast<int>(omp_get_max_threads() != inner);
+        }
+        REQUIRE(num_changed == 0);
+    }
+#if defined(__linux__)
+    SECTION("CPU set") {
+        cpu_set_t original;
+        REQUIRE(sched_getaffinity(0, sizeof(original), &original) == 0);
+        size_t cpu = 0;
+        while (CPU_ISSET(cpu, &original) == 0) {
+            cpu++;
+        }
+        {
+            const ThreadingScope scope(ThreadingConfig{1, {cpu}, 0}, 20);
+            cpu_set_t mask;
+            REQUIRE(sched_getaffinity(0, sizeof(mask), &mask) == 0);
+            REQUIRE(CPU_COUNT(&mask) == 1);
+            REQUIRE(CPU_ISSET(cpu, &mask) != 0);
+        }
+        REQUIRE(sched_setaffinity(0, sizeof(original), &original) == 0);
+
+        REQUIRE_THROWS_WITH(
+            ThreadingScope(ThreadingConfig{1, {CPU_SETSIZE}, 0}, 20),
+            Catch::Contains("Invalid CPU index"));
+        REQUIRE(omp_get_max_threads() == max_threads);
+    }
+#endif
+}
+#endif
+
+TEMPLATE_TEST_CASE("ThreadingConfig::honoured", "[Threading]", float, double) {
+    using PrecisionT = TestType;
+    const size_t num_qubits = 6;
+    std::mt19937 re{1337};
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    const std::vector<std::string> ops{"Hadamard", "RX", "CNOT", "IsingXX",
+                                       "RZ"};
+    const std::vector<std::vector<size_t>> ops_wires{
+        {0}, {5}, {0, 3}, {2, 4}, {1}};
+    const std::vector<bool> ops_inverse{false, false, false, true, false};
+    const std::vector<std::vector<PrecisionT>> ops_params{
+        {}, {0.3}, {}, {-1.2}, {0.7}};
+
+    StateVectorManagedCPU<PrecisionT> expected(
+        init_state.data(), init_state.size(), Threading::MultiThread);
+    expected.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+
+    for (const auto &config :
+         {ThreadingConfig{1, {}, 0}, ThreadingConfig{2, {}, 0},
+          ThreadingConfig{3, {}, num_qubits + 1}}) {
+        StateVectorManagedCPU<PrecisionT> sv(
+            init_state.data(), init_state.size(), Threading::MultiThread);
+        sv.setThreadingConfig(config);
+        REQUIRE(sv.getThreadingConfig().num_threads == config.num_threads);
+        sv.applyOperations(ops, ops_wires, ops_inverse, ops_params);
+        CHECK(sv.getDataVector() == approx(expected.getDataVector()));
+
+        const StateVectorManagedCPU<PrecisionT> copy(sv);
+        REQUIRE(copy.getThreadingConfig().num_threads == config.num_threads);
+
+        Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>> measures(sv);
+        Measures<PrecisionT, StateVectorManagedCPU<PrecisionT>>
+            expected_measures(expected);
+        REQUIRE(measures.getThreadingConfig().num_threads ==
+                config.num_threads);
+        CHECK(measures.probs() == approx(expected_measures.probs()));
+        CHECK(measures.expval("PauliX", {3}) ==
+              Approx(expected_measures.expval("PauliX", {3})));
+        CHECK(measures.var("PauliY", {1}) ==
+              Approx(expected_measures.var("PauliY", {1})));
+
+        AdjointJacobian<PrecisionT> adj;
+        adj.setThreadingConfig(config);
+        REQUIRE(adj.getThreadingConfig().sequential_below_num_qubits ==
+                config.sequential_below_num_qubits);
+        AdjointJacobian<PrecisionT> expected_adj;
+
+        const auto tape_ops = OpsData<PrecisionT>(ops, ops_params, ops_wires,
+                                                  ops_inverse);
+        const std::vector<ObsDatum<PrecisionT>> obs{
+            ObsDatum<PrecisionT>({"PauliZ"}, {{}}, {{0}}),
+            ObsDatum<PrecisionT>({"PauliX"}, {{}}, {{4}})};
+        std::vector<std::complex<PrecisionT>> tape_state(init_state.begin(),
+                                                         init_state.end());
+        const JacobianData<PrecisionT> tape{
+            3, tape_state.size(), tape_state.data(), obs, tape_ops, {0, 1, 2}};
+        std::vector<PrecisionT> jacobian(obs.size() * 3);
+        std::vector<PrecisionT> expected_jacobian(obs.size() * 3);
+        adj.adjointJacobian(jacobian, tape, true);
+        expected_adj.adjointJacobian(expected_jacobian, tape, true);
+        CHECK(jacobian == approx(expected_jacobian).margin(1e-5));
+    }
+}
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "AdjointDiff.hpp"
+#include "Macros.hpp"
+#include "Measures.hpp"
+#include "StateVectorRawCPU.hpp"
+#include "Trace.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::Algorithms;
+using namespace Pennylane::Util;
+
+namespace {
+auto countEvents(const std::vector<TraceEvent> &events, std::string_view name)
+    -> size_t {
+    return static_cast<size_t>(
+        std::count_if(events.begin(), events.end(), [&](const auto &event) {
+            return std::string_view(event.name) == name;
+        }));
+}
+} // namespace
+
+TEST_CASE("TraceRecorder", "[Trace]") {
+    auto &recorder = TraceRecorder::getInstance();
+    const bool was_enabled = recorder.isEnabled();
+    recorder.clear();
+
+    SECTION("Scopes are only recorded while enabled") {
+        recorder.setEnabled(false);
+        { const TraceScope scope("ignored", "test"); }
+        REQUIRE(recorder.getEvents().empty());
+
+        recorder.setEnabled(true);
+        {
+            const TraceScope outer("outer", "test");
+            { const TraceScope inner("inner \"quoted\"", "test"); }
+        }
+        const auto events = recorder.getEvents();
+        REQUIRE(events.size() == 2);
+        // Inner scopes end first
+        REQUIRE(std::string_view(events[0].name) == "inner \"quoted\"");
+        REQUIRE(std::string_view(events[1].name) == "outer");
+        REQUIRE(events[0].thread == events[1].thread);
+        REQUIRE(events[1].begin_us <= events[0].begin_us);
+        REQUIRE(events[0].duration_us <= events[1].duration_us);
+    }
+
+    SECTION("Chrome trace JSON") {
+        recorder.setEnabled(true);
+        recorder.record("phase", "test", 10, 25);
+        std::ostringstream os;
+        recorder.writeChromeTrace(os);
+        const std::string json = os.str();
+        REQUIRE(json.rfind("{\"traceEvents\":[", 0) == 0);
+        REQUIRE(json.find("{\"name\":\"phase\",\"cat\":\"test\",\"ph\":\"X\","
+                          "\"pid\":0,\"tid\":") != std::string::npos);
+        REQUIRE(json.find("\"ts\":10,\"dur\":15}") != std::string::npos);
+
+        recorder.clear();
+        { const TraceScope scope("a\\b", "test"); }
+        os.str("");
+        recorder.writeChromeTrace(os);
+        REQUIRE(os.str().find("\"name\":\"a\\\\b\"") != std::string::npos);
+    }
+
+    SECTION("Simulator phases") {
+        recorder.setEnabled(true);
+
+        const size_t num_qubits = 3;
+        std::vector<std::complex<double>> cdata(1U << num_qubits);
+        cdata[0] = {1.0, 0.0};
+        StateVectorRawCPU<double> psi(cdata.data(), cdata.size());
+        const auto ops = OpsData<double>({"RX", "RY", "CNOT"},
+                                         {{0.3}, {0.4}, {}}, {{0}, {1}, {0, 1}},
+                                         {false, false, false});
+        const std::vector<ObsDatum<double>> obs{
+            ObsDatum<double>({"PauliZ"}, {{}}, {{0}}),
+            ObsDatum<double>({"PauliZ"}, {{}}, {{1}})};
+        const std::vector<size_t> tp{0, 1};
+        const JacobianData<double> tape{2,   psi.getLength(), psi.getData(),
+                                        obs, ops,             tp};
+        std::vector<double> jacobian(obs.size() * tp.size(), 0);
+        AdjointJacobian<double>().adjointJacobian(jacobian, tape, true);
+
+        Measures<double, StateVectorRawCPU<double>> measures(psi);
+        [[maybe_unused]] const auto probs = measures.probs({0, 1});
+        [[maybe_unused]] const auto samples = measures.generate_samples(10, 1);
+
+        const auto events = recorder.getEvents();
+        if constexpr (Util::Constant::use_tracing) {
+            REQUIRE(countEvents(events, "forward") == 1);
+            REQUIRE(countEvents(events, "observables") == 1);
+            REQUIRE(countEvents(events, "observable") == obs.size());
+            REQUIRE(countEvents(events, "backward") == 1);
+            REQUIRE(countEvents(events, "backward step") == 3);
+            REQUIRE(countEvents(events, "probs") == 1);
+            REQUIRE(countEvents(events, "probs (thread)") >= 1);
+            REQUIRE(countEvents(events, "generate_samples") == 1);
+            REQUIRE(countEvents(events, "sample_from_cdf") == 1);
+        } else {
+            REQUIRE(events.empty());
+        }
+    }
+
+    recorder.clear();
+    recorder.setEnabled(was_enabled);
+}
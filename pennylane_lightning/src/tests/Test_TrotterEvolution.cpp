@@ -0,0 +1,153 @@
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "PauliSum.hpp"
+#include "StateVectorManagedCPU.hpp"
+#include "TestHelpers.hpp"
+#include "TrotterEvolution.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace Pennylane;
+
+namespace {
+/**
+ * @brief Compute e^{-iHt}|psi> by its Taylor series.
+ */
+template <class PrecisionT, class Alloc>
+auto exactEvolution(const PauliSum<PrecisionT> &hamiltonian,
+                    const std::vector<std::complex<PrecisionT>, Alloc> &psi,
+                    size_t num_qubits, PrecisionT time)
+    -> std::vector<std::complex<PrecisionT>> {
+    std::vector<std::complex<PrecisionT>> result(psi.begin(), psi.end());
+    std::vector<std::complex<PrecisionT>> term(psi.begin(), psi.end());
+    std::vector<std::complex<PrecisionT>> next(psi.size());
+    for (size_t k = 1; k < 40; k++) {
+        hamiltonian.apply(term.data(), next.data(), num_qubits);
+        const std::complex<PrecisionT> factor{0, -time / k};
+        for (size_t i = 0; i < psi.size(); i++) {
+            term[i] = factor * next[i];
+            result[i] += term[i];
+        }
+    }
+    return result;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("TrotterEvolution::evolve", "[TrotterEvolution]", float,
+                   double) {
+    using PrecisionT = TestType;
+    std::mt19937 re{1337};
+    const size_t num_qubits = 4;
+    const PrecisionT time = 0.8;
+    const auto init_state = createRandomState<PrecisionT>(re, num_qubits);
+
+    SECTION("Commuting terms are exact in a single step") {
+        // XX, YY and ZZ on the same wires commute, as do the diagonal terms
+        const PauliSum<PrecisionT> hamiltonian(
+            {0.3, 0.7, -0.4, 0.2, 0.5},
+            {"ZZ", "XX", "YY", "I", "ZIZ"}, {{0, 2}, {2, 0}, {0, 2}, {1},
+                                             {0, 1, 2}});
+        StateVectorManagedCPU<PrecisionT> expected(init_state);
+        expected.applyPauliRot({0, 2}, false, 2 * 0.3 * time, "ZZ");
+        expected.applyPauliRot({2, 0}, false, 2 * 0.7 * time, "XX");
+        expected.applyPauliRot({0, 2}, false, 2 * -0.4 * time, "YY");
+        expected.applyPauliRot({0, 1, 2}, false, 2 * 0.5 * time, "ZIZ");
+        auto expected_data = expected.getDataVector();
+        for (auto &elt : expected_data) {
+            elt *= std::polar(PrecisionT{1.0}, -PrecisionT{0.2} * time);
+        }
+
+        for (const size_t order : {1, 2, 4}) {
+            TrotterEvolution<PrecisionT> evolution(hamiltonian, num_qubits,
+                                                   order);
+            StateVectorManagedCPU<PrecisionT> sv(init_state);
+            evolution.evolve(sv, time, 1);
+            REQUIRE(sv.getDataVector() ==
+                    approx(expected_data).margin(1e-5));
+        }
+    }
+
+    SECTION("Product formulas converge to the exact evolution") {
+        const PauliSum<PrecisionT> hamiltonian(
+            {0.4, -0.6, 0.3, 0.5, -0.2, 0.7},
+            {"XZ", "ZZ", "Y", "XY", "Z", "ZX"},
+            {{0, 1}, {1, 2}, {3}, {2, 3}, {0}, {1, 2}});
+        const auto exact =
+            exactEvolution(hamiltonian, init_state, num_qubits, time);
+
+        const auto error = [&](size_t order, size_t num_steps) {
+            TrotterEvolution<PrecisionT> evolution(hamiltonian, num_qubits,
+                                                   order);
+            StateVectorManagedCPU<PrecisionT> sv(init_state);
+            evolution.evolve(sv, time, num_steps);
+            PrecisionT norm2 = 0.0;
+            const auto data = sv.getDataVector();
+            for (size_t i = 0; i < data.size(); i++) {
+                norm2 += std::norm(data[i] - exact[i]);
+            }
+            return std::sqrt(norm2);
+        };
+        REQUIRE(error(1, 1) > 1e-2);
+        REQUIRE(error(1, 400) < 5e-3);
+        REQUIRE(error(2, 1) > error(2, 4));
+        REQUIRE(error(2, 40) < 1e-3);
+        REQUIRE(error(4, 8) < 1e-3);
+    }
+
+    SECTION("Lazy SWAP gates") {
+        const PauliSum<PrecisionT> hamiltonian({0.4, -0.6, 0.5},
+                                               {"XZ", "ZZ", "XY"},
+                                               {{0, 1}, {1, 2}, {2, 3}});
+        TrotterEvolution<PrecisionT> evolution(hamiltonian, num_qubits);
+
+        StateVectorManagedCPU<PrecisionT> expected(init_state);
+        expected.applyOperation("SWAP", {0, 3});
+        evolution.evolve(expected, time, 3);
+
+        StateVectorManagedCPU<PrecisionT> sv(init_state);
+        sv.setLazySwaps(true);
+        sv.applyOperation("SWAP", {0, 3});
+        evolution.evolve(sv, time, 3);
+        REQUIRE(sv.getDataVector() ==
+                approx(expected.getDataVector()).margin(1e-5));
+    }
+
+    SECTION("Passes of a step") {
+        // A diagonal group and two groups of bit flips, as XZ and YZ flip
+        // the same wire
+        const PauliSum<PrecisionT> hamiltonian(
+            {0.4, -0.6, 0.3, 0.5}, {"XZ", "ZZ", "YZ", "X"},
+            {{0, 1}, {1, 2}, {0, 1}, {3}});
+        REQUIRE(TrotterEvolution<PrecisionT>(hamiltonian, num_qubits, 1)
+                    .getNumStages() == 3);
+        REQUIRE(TrotterEvolution<PrecisionT>(hamiltonian, num_qubits, 2)
+                    .getNumStages() == 5);
+        // The five order 2 steps of the recursion share their end stages
+        REQUIRE(TrotterEvolution<PrecisionT>(hamiltonian, num_qubits, 4)
+                    .getNumStages() == 21);
+    }
+
+    SECTION("Invalid arguments") {
+        const PauliSum<PrecisionT> hamiltonian({0.4}, {"XZ"}, {{0, 1}});
+        PL_CHECK_THROWS_MATCHES(
+            TrotterEvolution<PrecisionT>(hamiltonian, num_qubits, 3),
+            Util::LightningException, "must be 1 or a positive even number");
+        PL_CHECK_THROWS_MATCHES(
+            TrotterEvolution<PrecisionT>(
+                PauliSum<PrecisionT>({0.4}, {"XA"}, {{0, 1}}), num_qubits),
+            Util::LightningException, "must consist of I, X, Y and Z");
+
+        TrotterEvolution<PrecisionT> evolution(hamiltonian, num_qubits);
+        StateVectorManagedCPU<PrecisionT> sv(num_qubits + 1);
+        PL_CHECK_THROWS_MATCHES(evolution.evolve(sv, time, 1),
+                                Util::LightningException,
+                                "does not match the Hamiltonian");
+        StateVectorManagedCPU<PrecisionT> sv2(num_qubits);
+        PL_CHECK_THROWS_MATCHES(evolution.evolve(sv2, time, 0),
+                                Util::LightningException,
+                                "number of steps must be positive");
+    }
+}
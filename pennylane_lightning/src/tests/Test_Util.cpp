@@ -1,7 +1,11 @@
 #include <algorithm>
+#include <chrono>
 #include <complex>
 
+#include <future>
 #include <limits>
+#include <numeric>
+#include <random>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -13,7 +17,9 @@
 #include "Error.hpp"
 #include "LinearAlgebra.hpp"
 #include "Memory.hpp"
+#include "Philox.hpp"
 #include "Util.hpp"
+#include "WorkerPool.hpp"
 
 #include "TestHelpers.hpp"
 
@@ -190,6 +196,28 @@ TEST_CASE("Utility array and tuples", "[Util]") {
 /**
  * @brief Test randomUnitary is correct
  */
+TEST_CASE("transpose_state_tensor", "[Util]") {
+    // Small tensors fit in a single block, and large ones span several
+    // blocks processed in parallel
+    for (const size_t num_axes : {size_t{1}, size_t{3}, size_t{17}}) {
+        std::vector<size_t> new_axes(num_axes);
+        std::iota(new_axes.begin(), new_axes.end(), size_t{0});
+        std::mt19937 re{1337};
+        std::shuffle(new_axes.begin(), new_axes.end(), re);
+
+        std::vector<size_t> tensor(Util::exp2(num_axes));
+        std::iota(tensor.begin(), tensor.end(), size_t{0});
+        const auto transposed = Util::transpose_state_tensor(tensor, new_axes);
+        size_t num_mismatches = 0;
+        for (size_t ind = 0; ind < tensor.size(); ind++) {
+            num_mismatches += static_cast<size_t>(
+                transposed[Util::transposed_state_index(ind, new_axes)] !=
+                tensor[ind]);
+        }
+        CHECK(num_mismatches == 0);
+    }
+}
+
 TEMPLATE_TEST_CASE("randomUnitary", "[Util]", float, double) {
     using PrecisionT = TestType;
 
@@ -274,4 +302,179 @@ TEST_CASE("Test AlignedAllocator", "[Util][Memory]") {
     REQUIRE_THROWS_AS(std::unique_ptr<double>(allocator.allocate(
                           size_t{1024 * 1024} * size_t{1024 * 1024})),
                       std::bad_alloc);
+
+    SECTION("NUMA policies") {
+        const size_t size = 3 * Util::Internal::first_touch_page_size + 5;
+        for (const auto policy :
+             {NUMAPolicy::FirstTouch, NUMAPolicy::Interleave,
+              NUMAPolicy::Bind}) {
+            AlignedAllocator<std::complex<double>> numa_allocator(16, policy);
+            REQUIRE(numa_allocator.numaPolicy() == policy);
+            REQUIRE(numa_allocator.usesAlignedAlloc());
+            REQUIRE(numa_allocator != AlignedAllocator<double>(16));
+
+            std::vector<std::complex<double>,
+                        AlignedAllocator<std::complex<double>>>
+                data(size, numa_allocator);
+            REQUIRE(reinterpret_cast<uintptr_t>(data.data()) %
+                        Util::Internal::first_touch_page_size ==
+                    0);
+            REQUIRE(std::all_of(data.begin(), data.end(), [](auto elt) {
+                return elt == std::complex<double>{};
+            }));
+        }
+    }
+
+    SECTION("Huge pages") {
+        const size_t size = 3 * Util::Internal::first_touch_page_size + 5;
+        for (const auto huge_pages :
+             {HugePagePolicy::Transparent, HugePagePolicy::Explicit}) {
+            AlignedAllocator<std::complex<double>> huge_allocator(
+                16, NUMAPolicy::FirstTouch, huge_pages);
+            REQUIRE(huge_allocator.hugePages() == huge_pages);
+            REQUIRE(huge_allocator.numaPolicy() == NUMAPolicy::FirstTouch);
+            REQUIRE(huge_allocator !=
+                    AlignedAllocator<double>(16, NUMAPolicy::FirstTouch));
+
+            std::vector<std::complex<double>,
+                        AlignedAllocator<std::complex<double>>>
+                data(size, huge_allocator);
+            REQUIRE(reinterpret_cast<uintptr_t>(data.data()) %
+                        Util::Internal::transparent_huge_page_size ==
+                    0);
+            REQUIRE(std::all_of(data.begin(), data.end(), [](auto elt) {
+                return elt == std::complex<double>{};
+            }));
+            data[size - 1] = {1.0, 2.0};
+            REQUIRE(data[size - 1] == std::complex<double>{1.0, 2.0});
+        }
+    }
+
+    SECTION("Buffer pool") {
+        BufferPool pool;
+        AlignedAllocator<double> pooled(64, NUMAPolicy::Default,
+                                        HugePagePolicy::Disabled, &pool);
+        REQUIRE(pooled.pool() == &pool);
+        REQUIRE(pooled == AlignedAllocator<double>(64));
+
+        double *p = pooled.allocate(100);
+        pooled.deallocate(p, 100);
+        REQUIRE(pool.cachedBytes() == 100 * sizeof(double));
+
+        // Only a buffer of the same size and alignment is reused
+        double *q = AlignedAllocator<double>(32, NUMAPolicy::Default,
+                                             HugePagePolicy::Disabled, &pool)
+                        .allocate(100);
+        REQUIRE(q != p);
+        AlignedAllocator<double>(32).deallocate(q, 100);
+        REQUIRE(pooled.allocate(100) == p);
+        REQUIRE(pool.cachedBytes() == 0);
+        pooled.deallocate(p, 100);
+
+        pool.setMaxBytes(150 * sizeof(double));
+        REQUIRE(pool.maxBytes() == 150 * sizeof(double));
+        REQUIRE(pool.cachedBytes() == 100 * sizeof(double));
+        p = pooled.allocate(80);
+        pooled.deallocate(p, 80);
+        REQUIRE(pool.cachedBytes() == 100 * sizeof(double));
+
+        pool.setMaxBytes(0);
+        REQUIRE(pool.cachedBytes() == 0);
+        pool.setMaxBytes(std::numeric_limits<size_t>::max());
+
+        {
+            std::vector<double, AlignedAllocator<double>> data(100, pooled);
+        }
+        REQUIRE(pool.cachedBytes() == 100 * sizeof(double));
+        pool.clear();
+        REQUIRE(pool.cachedBytes() == 0);
+
+        // A reused buffer with a NUMA policy is zero-filled again
+        AlignedAllocator<double> pooled_numa(64, NUMAPolicy::FirstTouch,
+                                             HugePagePolicy::Disabled, &pool);
+        {
+            std::vector<double, AlignedAllocator<double>> data(100,
+                                                               pooled_numa);
+            std::fill(data.begin(), data.end(), 1.0);
+        }
+        REQUIRE(pool.cachedBytes() > 0);
+        std::vector<double, AlignedAllocator<double>> data(100, pooled_numa);
+        REQUIRE(pool.cachedBytes() == 0);
+        REQUIRE(std::all_of(data.begin(), data.end(),
+                            [](double elt) { return elt == 0.0; }));
+    }
+}
+
+TEST_CASE("WorkerPool", "[Util]") {
+    SECTION("Jobs run in order with a single worker") {
+        WorkerPool pool;
+        REQUIRE(pool.getNumWorkers() == 1);
+        std::vector<size_t> order;
+        std::vector<std::future<size_t>> futures;
+        for (size_t job = 0; job < 10; job++) {
+            futures.emplace_back(pool.submit([&order, job] {
+                order.push_back(job);
+                return job * job;
+            }));
+        }
+        for (size_t job = 0; job < 10; job++) {
+            REQUIRE(futures[job].get() == job * job);
+        }
+        REQUIRE(order == std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+
+    SECTION("Exceptions are rethrown by the future") {
+        auto future = WorkerPool::global().submit(
+            []() -> int { PL_ABORT("Error in a job"); });
+        // A shared future may be queried by both evaluations of the macro
+        auto shared = future.share();
+        PL_CHECK_THROWS_MATCHES(shared.get(), LightningException,
+                                "Error in a job");
+    }
+
+    SECTION("Remaining jobs are run on destruction") {
+        std::vector<std::future<void>> futures;
+        {
+            WorkerPool pool(3);
+            REQUIRE(pool.getNumWorkers() == 3);
+            for (size_t job = 0; job < 20; job++) {
+                futures.emplace_back(pool.submit([] {}));
+            }
+        }
+        for (auto &future : futures) {
+            REQUIRE(future.wait_for(std::chrono::seconds(0)) ==
+                    std::future_status::ready);
+        }
+    }
+
+    PL_CHECK_THROWS_MATCHES(WorkerPool(0), LightningException,
+                            "At least one worker");
+}
+
+TEST_CASE("Philox4x32", "[Util]") {
+    using Util::Philox4x32;
+    SECTION("Known answers") {
+        REQUIRE(Philox4x32(0)({0U, 0U, 0U, 0U}) ==
+                Philox4x32::CounterT{0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU,
+                                     0x9b00dbd8U});
+        REQUIRE(Philox4x32(0xffffffffffffffffULL)(
+                    {0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU}) ==
+                Philox4x32::CounterT{0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U,
+                                     0x6d5451fdU});
+    }
+    SECTION("Uniform numbers") {
+        const Philox4x32 rng(1337);
+        double sum = 0.0;
+        const size_t num_pairs = 10000;
+        for (size_t counter = 0; counter < num_pairs; counter++) {
+            for (const double u : rng.uniform2(counter)) {
+                REQUIRE(u >= 0.0);
+                REQUIRE(u < 1.0);
+                sum += u;
+            }
+        }
+        REQUIRE(sum / (2 * num_pairs) == Approx(0.5).margin(0.01));
+        REQUIRE(rng.uniform2(7) == Philox4x32(1337).uniform2(7));
+        REQUIRE(rng.uniform2(7) != Philox4x32(1338).uniform2(7));
+    }
 }
@@ -5,6 +5,7 @@
 #include <complex>
 #include <iostream>
 #include <limits>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -14,6 +15,8 @@
 
 #include "AdjointDiff.hpp"
 #include "JacobianProd.hpp"
+#include "MeasuresKernels.hpp"
+#include "StateVectorManagedCPU.hpp"
 #include "StateVectorRawCPU.hpp"
 #include "Util.hpp"
 
@@ -684,3 +687,129 @@ TEST_CASE("VectorJacobianProduct::vectorJacobianProduct Mixed Ops, Obs and "
         CHECK(-0.5 * expected[2] == Approx(vjp_res[2]).margin(1e-7));
     }
 }
+
+TEST_CASE("VectorJacobianProduct of probabilities and of the state",
+          "[VectorJacobianProduct]") {
+    const size_t num_qubits = 3;
+    const std::vector<std::string> ops_name{
+        "Hadamard", "RX", "CNOT", "RY", "Rot", "RZ", "CRY", "IsingZZ"};
+    const std::vector<std::vector<size_t>> ops_wires{
+        {0}, {1}, {0, 1}, {2}, {1}, {0}, {2, 0}, {1, 2}};
+    const std::vector<bool> ops_inverses{false, false, false, true,
+                                         false, false, false, false};
+    const std::vector<std::vector<double>> params{
+        {}, {0.4}, {}, {-1.1}, {0.3, -0.6, 0.9}, {0.7}, {1.3}, {-0.5}};
+
+    const auto make_ops = [&](const std::vector<std::vector<double>> &p) {
+        return OpsData<double>(ops_name, p, ops_wires, ops_inverses);
+    };
+    const auto final_state = [&](const std::vector<std::vector<double>> &p) {
+        StateVectorManagedCPU<double> sv(num_qubits);
+        sv.applyOperations(ops_name, ops_wires, ops_inverses, p);
+        return sv;
+    };
+    // Central differences of the parameter with the given flat index
+    const auto shifted = [&](size_t flat_idx, double shift) {
+        auto p = params;
+        size_t idx = 0;
+        for (auto &op_params : p) {
+            for (auto &param : op_params) {
+                if (idx++ == flat_idx) {
+                    param += shift;
+                }
+            }
+        }
+        return final_state(p);
+    };
+    constexpr double eps = 1e-6;
+
+    const auto check_probs = [&](const std::vector<size_t> &t_params,
+                                 const std::vector<size_t> &wires) {
+        auto cdata = StateVectorManagedCPU<double>(num_qubits).getDataVector();
+        const auto ops = make_ops(params);
+        const JacobianData<double> tape{
+            t_params.size(), cdata.size(), cdata.data(), {}, ops, t_params};
+        const size_t num_outcomes = size_t{1U} << wires.size();
+        std::vector<double> jac(num_outcomes * t_params.size());
+        AdjointJacobian<double> adj;
+        adj.adjointProbsJacobian(jac, tape, wires, true);
+
+        for (size_t col = 0; col < t_params.size(); col++) {
+            const auto plus = shifted(t_params[col], eps);
+            const auto minus = shifted(t_params[col], -eps);
+            const auto probs_plus = MeasuresKernels::marginalProbs(
+                plus.getData(), num_qubits, wires);
+            const auto probs_minus = MeasuresKernels::marginalProbs(
+                minus.getData(), num_qubits, wires);
+            for (size_t row = 0; row < num_outcomes; row++) {
+                INFO("outcome " << row << ", parameter " << col);
+                CHECK(jac[row * t_params.size() + col] ==
+                      Approx((probs_plus[row] - probs_minus[row]) / (2 * eps))
+                          .margin(1e-6));
+            }
+        }
+
+        // The VJP is the contraction of the Jacobian
+        std::vector<double> dy(num_outcomes);
+        for (size_t row = 0; row < num_outcomes; row++) {
+            dy[row] = 0.5 - 0.3 * static_cast<double>(row);
+        }
+        std::vector<double> expected(t_params.size(), 0);
+        for (size_t row = 0; row < num_outcomes; row++) {
+            for (size_t col = 0; col < t_params.size(); col++) {
+                expected[col] += dy[row] * jac[row * t_params.size() + col];
+            }
+        }
+        VectorJacobianProduct<double> VJP;
+        auto fn = VJP.probsVectorJacobianProduct(dy, wires, t_params.size());
+        auto final_data = final_state(params).getDataVector();
+        const JacobianData<double> final_tape{
+            t_params.size(), final_data.size(), final_data.data(), {}, ops,
+            t_params};
+        CHECK(fn(final_tape) == approx(expected).margin(1e-10));
+    };
+
+    SECTION("Backward passes over the outcomes") {
+        check_probs({0, 5, 7}, {2});
+    }
+    SECTION("Forward sweeps over the parameters") {
+        check_probs({0, 1, 5, 6}, {0, 1, 2});
+    }
+    SECTION("Trainable multi-parameter operation") {
+        check_probs({0, 3, 5, 6}, {1, 2, 0});
+    }
+
+    SECTION("State") {
+        const std::vector<size_t> t_params{0, 1, 2, 4, 6, 7};
+        std::vector<std::complex<double>> dy(size_t{1U} << num_qubits);
+        for (size_t idx = 0; idx < dy.size(); idx++) {
+            const auto x = static_cast<double>(idx);
+            dy[idx] = {0.1 * x, 0.5 - 0.2 * x};
+        }
+        VectorJacobianProduct<double> VJP;
+        auto fn = VJP.stateVectorJacobianProduct(dy, t_params.size(), true);
+        auto cdata = StateVectorManagedCPU<double>(num_qubits).getDataVector();
+        const auto ops = make_ops(params);
+        const JacobianData<double> tape{
+            t_params.size(), cdata.size(), cdata.data(), {}, ops, t_params};
+        const auto vjp = fn(tape);
+
+        REQUIRE(vjp.size() == t_params.size());
+        for (size_t col = 0; col < t_params.size(); col++) {
+            const auto plus = shifted(t_params[col], eps).getDataVector();
+            const auto minus = shifted(t_params[col], -eps).getDataVector();
+            double expected = 0;
+            for (size_t idx = 0; idx < dy.size(); idx++) {
+                expected += std::real(std::conj(dy[idx]) *
+                                      (plus[idx] - minus[idx])) /
+                            (2 * eps);
+            }
+            CHECK(vjp[col] == Approx(expected).margin(1e-6));
+        }
+
+        PL_CHECK_THROWS_MATCHES(
+            VJP.probsVectorJacobianProduct({0.5, 0.5}, {0, 1}, 2),
+            std::invalid_argument,
+            "Invalid size for the gradient-output vector");
+    }
+}
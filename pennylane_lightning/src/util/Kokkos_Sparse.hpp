@@ -32,9 +32,23 @@ constexpr bool USE_KOKKOS = true;
 
 // Implementing Kokkos Sparse operations.
 #include <complex>
+#include <cstdlib>
+#include <mutex>
+#include <string>
 #include <vector>
 
 namespace Pennylane::Util {
+/**
+ * @brief Initialize Kokkos if needed. It is finalized at exit, so that
+ * views may outlive a single call.
+ */
+inline void ensureKokkosInitialized() {
+    if (!Kokkos::is_initialized()) {
+        Kokkos::initialize();
+        std::atexit(Kokkos::finalize);
+    }
+}
+
 using device_type = typename Kokkos::Device<
     Kokkos::DefaultExecutionSpace,
     typename Kokkos::DefaultExecutionSpace::memory_space>;
@@ -126,7 +140,7 @@ void apply_Sparse_Matrix_Kokkos(
     const index_type *entries_ptr, const std::complex<fp_precision> *values_ptr,
     const index_type numNNZ, std::vector<std::complex<fp_precision>> &result) {
 
-    Kokkos::initialize();
+    ensureKokkosInitialized();
     {
         const_data_view_type<fp_precision> vector_view(
             reinterpret_cast<const Kokkos::complex<fp_precision> *>(vector_ptr),
@@ -147,7 +161,145 @@ void apply_Sparse_Matrix_Kokkos(
             reinterpret_cast<std::complex<fp_precision> *>(result_view.data()) +
                 result_view.size()));
     }
-    Kokkos::finalize();
+};
+
+/**
+ * @brief Sparse matrix in the CSR format copied once to the Kokkos memory
+ * space, with the input and output vectors of its products.
+ *
+ * Repeated products and expected values reuse the matrix and the vectors,
+ * so a Hamiltonian measured many times is built only once. The vectors are
+ * shared, so calls on the same operator are serialized.
+ *
+ * @tparam fp_precision data float point precision.
+ */
+template <class fp_precision> class KokkosSparseOperator {
+  private:
+    using matrix_type = crs_matrix_type<fp_precision>;
+    using vector_type =
+        Kokkos::View<data_type<fp_precision> *, default_layout, device_type>;
+    using host_vector_type =
+        Kokkos::View<data_type<fp_precision> *, default_layout,
+                     Kokkos::HostSpace,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+    using const_host_vector_type =
+        Kokkos::View<const data_type<fp_precision> *, default_layout,
+                     Kokkos::HostSpace,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    matrix_type matrix_;
+    vector_type x_;
+    vector_type y_;
+    mutable std::mutex mutex_;
+
+    /**
+     * @brief Copy host data to a new view of the Kokkos memory space.
+     */
+    template <class view_type, class host_type>
+    static auto toDevice(const std::string &label, const host_type *host,
+                         index_type size) -> view_type {
+        view_type device(label, size);
+        auto mirror = Kokkos::create_mirror_view(device);
+        for (index_type i = 0; i < size; i++) {
+            mirror(i) = host[i];
+        }
+        Kokkos::deep_copy(device, mirror);
+        return device;
+    }
+
+    /**
+     * @brief Compute the product of the matrix and a host vector into y_.
+     */
+    void multiply(const std::complex<fp_precision> *vector_ptr) {
+        const_host_vector_type host(
+            reinterpret_cast<const data_type<fp_precision> *>(vector_ptr),
+            x_.extent(0));
+        Kokkos::deep_copy(x_, host);
+        const data_type<fp_precision> alpha(1.0);
+        const data_type<fp_precision> beta;
+        KokkosSparse::spmv("N", alpha, matrix_, x_, beta, y_);
+    }
+
+  public:
+    /**
+     * @brief Copy a sparse matrix to the Kokkos memory space.
+     *
+     * @param row_map_ptr   Pointer to the row_map array. Elements of this array
+     * return the number of non-zero terms in all rows before it.
+     * @param numRows       Matrix total number or rows.
+     * @param entries_ptr   Pointer to the array with the non-zero elements
+     * column indices.
+     * @param values_ptr    Pointer to the array with the non-zero elements.
+     * @param numNNZ        Number of non-zero elements.
+     */
+    KokkosSparseOperator(const index_type *row_map_ptr,
+                         const index_type numRows,
+                         const index_type *entries_ptr,
+                         const std::complex<fp_precision> *values_ptr,
+                         const index_type numNNZ) {
+        ensureKokkosInitialized();
+        using graph_t = typename matrix_type::staticcrsgraph_type;
+        using row_map_t = typename graph_t::row_map_type::non_const_type;
+        using entries_t = typename graph_t::entries_type::non_const_type;
+        using values_t = typename matrix_type::values_type::non_const_type;
+
+        const graph_t graph(
+            toDevice<entries_t>("entries", entries_ptr, numNNZ),
+            toDevice<row_map_t>("row_map", row_map_ptr, numRows + 1));
+        matrix_ = matrix_type(
+            "matrix", numRows,
+            toDevice<values_t>(
+                "values",
+                reinterpret_cast<const data_type<fp_precision> *>(values_ptr),
+                numNNZ),
+            graph);
+        x_ = vector_type("x", numRows);
+        y_ = vector_type("y", numRows);
+    }
+
+    /**
+     * @brief Get the number of rows of the matrix.
+     */
+    [[nodiscard]] auto getNumRows() const -> index_type {
+        return static_cast<index_type>(x_.extent(0));
+    }
+
+    /**
+     * @brief Compute the product of the matrix and a vector.
+     *
+     * @param vector_ptr Pointer to the vector, with one element per row.
+     * @param result_ptr Pointer to the result, with one element per row.
+     */
+    void apply(const std::complex<fp_precision> *vector_ptr,
+               std::complex<fp_precision> *result_ptr) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        multiply(vector_ptr);
+        host_vector_type result(
+            reinterpret_cast<data_type<fp_precision> *>(result_ptr),
+            y_.extent(0));
+        Kokkos::deep_copy(result, y_);
+    }
+
+    /**
+     * @brief Compute the expected value of the matrix in a state.
+     *
+     * @param vector_ptr Pointer to the state, with one element per row.
+     */
+    [[nodiscard]] auto expval(const std::complex<fp_precision> *vector_ptr)
+        -> fp_precision {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        multiply(vector_ptr);
+        const auto x = x_;
+        const auto y = y_;
+        fp_precision result{0};
+        Kokkos::parallel_reduce(
+            "expval", Kokkos::RangePolicy<>(0, x.extent(0)),
+            KOKKOS_LAMBDA(const size_t i, fp_precision &sum) {
+                sum += x(i).real() * y(i).real() + x(i).imag() * y(i).imag();
+            },
+            result);
+        return result;
+    }
 };
 
 } // namespace Pennylane::Util
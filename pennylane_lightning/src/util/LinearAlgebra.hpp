@@ -21,12 +21,19 @@
 #include "Util.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <complex>
 #include <cstdlib>
+#include <limits>
 #include <numeric>
 #include <random>
 #include <vector>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 /// @cond DEV
 #if __has_include(<cblas.h>) && defined _ENABLE_BLAS
 #include <cblas.h>
@@ -76,14 +83,17 @@ template <class T,
 inline static void
 omp_innerProd(const std::complex<T> *v1, const std::complex<T> *v2,
               std::complex<T> &result, const size_t data_size) {
+    using ComplexAccT = std::complex<accumulator_t<T>>;
 #if defined(_OPENMP)
 #pragma omp declare \
-            reduction (sm:std::complex<T>:omp_out=ConstSum(omp_out, omp_in)) \
-            initializer(omp_priv=std::complex<T> {0, 0})
+            reduction (sm:ComplexAccT:omp_out=ConstSum(omp_out, omp_in)) \
+            initializer(omp_priv=ComplexAccT {0, 0})
 #endif
+    ComplexAccT sum{0, 0};
 
 #if defined(_OPENMP)
-    size_t nthreads = data_size / NTERMS;
+    size_t nthreads = std::min(data_size / NTERMS,
+                               static_cast<size_t>(omp_get_max_threads()));
     if (nthreads < 1) {
         nthreads = 1;
     }
@@ -92,11 +102,13 @@ omp_innerProd(const std::complex<T> *v1, const std::complex<T> *v2,
 #if defined(_OPENMP)
 #pragma omp parallel for num_threads(nthreads) default(none)                   \
     shared(v1, v2, data_size) reduction(sm                                     \
-                                        : result)
+                                        : sum)
 #endif
     for (size_t i = 0; i < data_size; i++) {
-        result = ConstSum(result, ConstMult(*(v1 + i), *(v2 + i)));
+        sum = ConstSum(sum, ConstMult(ComplexAccT{*(v1 + i)},
+                                     ComplexAccT{*(v2 + i)}));
     }
+    result = static_cast<std::complex<T>>(sum);
 }
 
 /**
@@ -116,18 +128,19 @@ inline auto innerProd(const std::complex<T> *v1, const std::complex<T> *v2,
                       const size_t data_size) -> std::complex<T> {
     std::complex<T> result(0, 0);
 
-    if constexpr (USE_CBLAS) {
-        if constexpr (std::is_same_v<T, float>) {
-            cblas_cdotu_sub(data_size, v1, 1, v2, 1, &result);
-        } else if constexpr (std::is_same_v<T, double>) {
-            cblas_zdotu_sub(data_size, v1, 1, v2, 1, &result);
-        }
+    // BLAS accumulates in the precision of the data, so it is only used
+    // when no wider accumulator is required
+    if constexpr (USE_CBLAS && std::is_same_v<T, double>) {
+        cblas_zdotu_sub(data_size, v1, 1, v2, 1, &result);
     } else {
         if (data_size < STD_CROSSOVER) {
-            result = std::inner_product(
-                v1, v1 + data_size, v2, std::complex<T>(), ConstSum<T>,
-                static_cast<std::complex<T> (*)(
-                    std::complex<T>, std::complex<T>)>(&ConstMult<T>));
+            using ComplexAccT = std::complex<accumulator_t<T>>;
+            result = static_cast<std::complex<T>>(std::inner_product(
+                v1, v1 + data_size, v2, ComplexAccT{},
+                [](ComplexAccT a, ComplexAccT b) { return a + b; },
+                [](ComplexAccT a, ComplexAccT b) {
+                    return ConstMult(a, b);
+                }));
         } else {
             omp_innerProd(v1, v2, result, data_size);
         }
@@ -151,14 +164,17 @@ template <class T,
 inline static void
 omp_innerProdC(const std::complex<T> *v1, const std::complex<T> *v2,
                std::complex<T> &result, const size_t data_size) {
+    using ComplexAccT = std::complex<accumulator_t<T>>;
 #if defined(_OPENMP)
 #pragma omp declare \
-            reduction (sm:std::complex<T>:omp_out=ConstSum(omp_out, omp_in)) \
-            initializer(omp_priv=std::complex<T> {0, 0})
+            reduction (sm:ComplexAccT:omp_out=ConstSum(omp_out, omp_in)) \
+            initializer(omp_priv=ComplexAccT {0, 0})
 #endif
+    ComplexAccT sum{0, 0};
 
 #if defined(_OPENMP)
-    size_t nthreads = data_size / NTERMS;
+    size_t nthreads = std::min(data_size / NTERMS,
+                               static_cast<size_t>(omp_get_max_threads()));
     if (nthreads < 1) {
         nthreads = 1;
     }
@@ -167,11 +183,13 @@ omp_innerProdC(const std::complex<T> *v1, const std::complex<T> *v2,
 #if defined(_OPENMP)
 #pragma omp parallel for num_threads(nthreads) default(none)                   \
     shared(v1, v2, data_size) reduction(sm                                     \
-                                        : result)
+                                        : sum)
 #endif
     for (size_t i = 0; i < data_size; i++) {
-        result = ConstSum(result, ConstMultConj(*(v1 + i), *(v2 + i)));
+        sum = ConstSum(sum, ConstMultConj(ComplexAccT{*(v1 + i)},
+                                         ComplexAccT{*(v2 + i)}));
     }
+    result = static_cast<std::complex<T>>(sum);
 }
 
 /**
@@ -192,17 +210,19 @@ inline auto innerProdC(const std::complex<T> *v1, const std::complex<T> *v2,
                        const size_t data_size) -> std::complex<T> {
     std::complex<T> result(0, 0);
 
-    if constexpr (USE_CBLAS) {
-        if constexpr (std::is_same_v<T, float>) {
-            cblas_cdotc_sub(data_size, v1, 1, v2, 1, &result);
-        } else if constexpr (std::is_same_v<T, double>) {
-            cblas_zdotc_sub(data_size, v1, 1, v2, 1, &result);
-        }
+    // BLAS accumulates in the precision of the data, so it is only used
+    // when no wider accumulator is required
+    if constexpr (USE_CBLAS && std::is_same_v<T, double>) {
+        cblas_zdotc_sub(data_size, v1, 1, v2, 1, &result);
     } else {
         if (data_size < STD_CROSSOVER) {
-            result =
-                std::inner_product(v1, v1 + data_size, v2, std::complex<T>(),
-                                   ConstSum<T>, ConstMultConj<T>);
+            using ComplexAccT = std::complex<accumulator_t<T>>;
+            result = static_cast<std::complex<T>>(std::inner_product(
+                v1, v1 + data_size, v2, ComplexAccT{},
+                [](ComplexAccT a, ComplexAccT b) { return a + b; },
+                [](ComplexAccT a, ComplexAccT b) {
+                    return ConstMultConj(a, b);
+                }));
         } else {
             omp_innerProdC(v1, v2, result, data_size);
         }
@@ -210,6 +230,163 @@ inline auto innerProdC(const std::complex<T> *v1, const std::complex<T> *v2,
     return result;
 }
 
+/**
+ * @brief Add a term to a sum with Kahan compensation.
+ *
+ * @param sum Running sum.
+ * @param comp Running compensation, i.e. the low-order bits lost by sum.
+ * @param term Term to add.
+ */
+template <class T> inline void kahanAdd(T &sum, T &comp, T term) {
+    const T y = term - comp;
+    const T t = sum + y;
+    comp = (t - sum) - y;
+    sum = t;
+}
+
+/**
+ * @brief Calculates the inner-product with the first dataset conjugated
+ * using compensated (Kahan) summation.
+ *
+ * The data is split into chunks of `CHUNK` elements, whose number does not
+ * depend on the number of threads, and chunks are distributed over threads.
+ * Within a chunk, `LANES` interleaved partial sums each carry their own
+ * compensation, so that the loop over the lanes vectorizes. The partial
+ * sums of the lanes and of the chunks are combined in a fixed order with
+ * compensation as well, so the result is reproducible for any number of
+ * threads and its error does not grow with the size of the data.
+ *
+ * @tparam T Floating point precision type.
+ * @tparam CHUNK Number of elements of a chunk.
+ * @param v1 Complex data array 1; conjugated before application.
+ * @param v2 Complex data array 2.
+ * @param data_size Size of data arrays.
+ * @return std::complex<T> Result of inner product operation.
+ */
+template <class T,
+          size_t CHUNK = (1U << 14U)> // NOLINT(readability-magic-numbers)
+inline auto innerProdCKahan(const std::complex<T> *v1,
+                            const std::complex<T> *v2, size_t data_size)
+    -> std::complex<T> {
+    using AccT = accumulator_t<T>;
+    constexpr size_t LANES = 4;
+    const size_t num_chunks = (data_size + CHUNK - 1) / CHUNK;
+    // Sum and compensation of the real and imaginary parts of each chunk
+    std::vector<AccT> chunk_sums(4 * num_chunks, 0.0);
+    AccT *chunk_sums_ptr = chunk_sums.data();
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) if (num_chunks > 1)
+#endif
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+        const size_t begin = chunk * CHUNK;
+        const size_t end = std::min(begin + CHUNK, data_size);
+        std::array<AccT, LANES> sum_real{};
+        std::array<AccT, LANES> comp_real{};
+        std::array<AccT, LANES> sum_imag{};
+        std::array<AccT, LANES> comp_imag{};
+        size_t idx = begin;
+        for (; idx + LANES <= end; idx += LANES) {
+            for (size_t lane = 0; lane < LANES; lane++) {
+                const std::complex<AccT> a = v1[idx + lane];
+                const std::complex<AccT> b = v2[idx + lane];
+                kahanAdd(sum_real[lane], comp_real[lane],
+                         a.real() * b.real() + a.imag() * b.imag());
+                kahanAdd(sum_imag[lane], comp_imag[lane],
+                         a.real() * b.imag() - a.imag() * b.real());
+            }
+        }
+        for (; idx < end; idx++) {
+            const std::complex<AccT> a = v1[idx];
+            const std::complex<AccT> b = v2[idx];
+            kahanAdd(sum_real[0], comp_real[0],
+                     a.real() * b.real() + a.imag() * b.imag());
+            kahanAdd(sum_imag[0], comp_imag[0],
+                     a.real() * b.imag() - a.imag() * b.real());
+        }
+        AccT *out = chunk_sums_ptr + 4 * chunk;
+        for (size_t lane = 0; lane < LANES; lane++) {
+            kahanAdd(out[0], out[1], sum_real[lane]);
+            kahanAdd(out[0], out[1], -comp_real[lane]);
+            kahanAdd(out[2], out[3], sum_imag[lane]);
+            kahanAdd(out[2], out[3], -comp_imag[lane]);
+        }
+    }
+
+    AccT sum_real = 0.0;
+    AccT comp_real = 0.0;
+    AccT sum_imag = 0.0;
+    AccT comp_imag = 0.0;
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+        const AccT *out = chunk_sums_ptr + 4 * chunk;
+        kahanAdd(sum_real, comp_real, out[0]);
+        kahanAdd(sum_real, comp_real, -out[1]);
+        kahanAdd(sum_imag, comp_imag, out[2]);
+        kahanAdd(sum_imag, comp_imag, -out[3]);
+    }
+    return {static_cast<T>(sum_real - comp_real),
+            static_cast<T>(sum_imag - comp_imag)};
+}
+
+/**
+ * @brief Calculates the inner-products @f$\langle v_i | w \rangle@f$ of
+ * many vectors with the same vector.
+ *
+ * The data is processed in tiles of `TILE` elements. A tile of `w` is
+ * reused against every `v_i` while it is in cache, so `w` is read once
+ * regardless of the number of vectors. Tiles are distributed over threads.
+ *
+ * @tparam T Floating point precision type.
+ * @tparam TILE Number of elements of a tile.
+ * @param vs Pointers to the complex data arrays @f$v_i@f$; conjugated
+ * before application.
+ * @param num_vecs Number of vectors @f$v_i@f$.
+ * @param w Complex data array.
+ * @param data_size Size of data arrays.
+ * @param results Pre-allocated array of `num_vecs` results.
+ * @param num_threads Number of threads to use.
+ */
+template <class T,
+          size_t TILE = (1U << 10U)> // NOLINT(readability-magic-numbers)
+inline void innerProdsC(const std::complex<T> *const *vs, size_t num_vecs,
+                        const std::complex<T> *w, size_t data_size,
+                        std::complex<T> *results,
+                        [[maybe_unused]] size_t num_threads) {
+    if (num_vecs == 0) {
+        return;
+    }
+    using AccT = accumulator_t<T>;
+    std::vector<AccT> sums(2 * num_vecs, 0.0);
+    AccT *sums_ptr = sums.data();
+    const size_t num_tiles = (data_size + TILE - 1) / TILE;
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) num_threads(num_threads)             \
+    if (num_threads > 1) reduction(+ : sums_ptr[:2 * num_vecs])
+#endif
+    for (size_t tile = 0; tile < num_tiles; tile++) {
+        const size_t begin = tile * TILE;
+        const size_t end = std::min(begin + TILE, data_size);
+        for (size_t vec = 0; vec < num_vecs; vec++) {
+            const std::complex<T> *v = vs[vec];
+            AccT sum_real = 0.0;
+            AccT sum_imag = 0.0;
+            for (size_t idx = begin; idx < end; idx++) {
+                const std::complex<AccT> a = v[idx];
+                const std::complex<AccT> b = w[idx];
+                sum_real += a.real() * b.real() + a.imag() * b.imag();
+                sum_imag += a.real() * b.imag() - a.imag() * b.real();
+            }
+            sums_ptr[2 * vec] += sum_real;
+            sums_ptr[2 * vec + 1] += sum_imag;
+        }
+    }
+    for (size_t vec = 0; vec < num_vecs; vec++) {
+        results[vec] = {static_cast<T>(sums[2 * vec]),
+                        static_cast<T>(sums[2 * vec + 1])};
+    }
+}
+
 /**
  * @brief Calculates the inner-product using the best available method.
  *
@@ -457,6 +634,48 @@ inline static void CFTranspose(const std::complex<T> *mat,
     }
 }
 
+/**
+ * @brief Calculates transpose of a matrix using OpenMP.
+ *
+ * The matrix is split into square tiles, which are distributed over the
+ * threads and transposed by CFTranspose.
+ *
+ * @tparam T Data type of the matrix elements.
+ * @tparam TILESIZE Number of rows and columns of each tile.
+ * @tparam NTERMS Number of elements processed by each thread.
+ * @param mat Data array repr. a flatten (row-wise) matrix m * n.
+ * @param mat_t Pre-allocated data array to store the transpose of `mat`.
+ * @param m Number of rows of `mat`.
+ * @param n Number of columns of `mat`.
+ */
+template <class T, size_t TILESIZE = 256, // NOLINT(readability-magic-numbers)
+          size_t NTERMS = (1U << 16U)>    // NOLINT(readability-magic-numbers)
+inline void omp_Transpose(const T *mat, T *mat_t, size_t m, size_t n) {
+    const size_t num_row_tiles = (m + TILESIZE - 1) / TILESIZE;
+    const size_t num_col_tiles = (n + TILESIZE - 1) / TILESIZE;
+
+#if defined(_OPENMP)
+    size_t nthreads = std::min((m * n) / NTERMS,
+                               static_cast<size_t>(omp_get_max_threads()));
+    if (nthreads < 1) {
+        nthreads = 1;
+    }
+#endif
+
+#if defined(_OPENMP)
+#pragma omp parallel for collapse(2) num_threads(nthreads) default(none)      \
+    shared(mat, mat_t, m, n, num_row_tiles, num_col_tiles)
+#endif
+    for (size_t row_tile = 0; row_tile < num_row_tiles; row_tile++) {
+        for (size_t col_tile = 0; col_tile < num_col_tiles; col_tile++) {
+            CFTranspose(mat, mat_t, m, n, row_tile * TILESIZE,
+                        std::min((row_tile + 1) * TILESIZE, m),
+                        col_tile * TILESIZE,
+                        std::min((col_tile + 1) * TILESIZE, n));
+        }
+    }
+}
+
 /**
  * @brief Transpose a matrix of shape m * n to n * m using the
  * best available method.
@@ -476,7 +695,7 @@ inline auto Transpose(const std::vector<std::complex<T>, Alloc> &mat, size_t m,
     }
 
     std::vector<std::complex<T>, Alloc> mat_t(n * m, mat.get_allocator());
-    CFTranspose(mat.data(), mat_t.data(), m, n, 0, m, 0, n);
+    omp_Transpose(mat.data(), mat_t.data(), m, n);
     return mat_t;
 }
 
@@ -499,7 +718,7 @@ inline auto Transpose(const std::vector<T, Alloc> &mat, size_t m, size_t n)
     }
 
     std::vector<T, Alloc> mat_t(n * m, mat.get_allocator());
-    CFTranspose(mat.data(), mat_t.data(), m, n, 0, m, 0, n);
+    omp_Transpose(mat.data(), mat_t.data(), m, n);
     return mat_t;
 }
 
@@ -766,15 +985,18 @@ auto squaredNorm(const T *data, size_t data_size) -> remove_complex_t<T> {
     if constexpr (is_complex_v<T>) {
         // complex type
         using PrecisionT = remove_complex_t<T>;
-        return std::transform_reduce(
-            data, data + data_size, PrecisionT{}, std::plus<PrecisionT>(),
-            static_cast<PrecisionT (*)(const std::complex<PrecisionT> &)>(
-                &std::norm<PrecisionT>));
+        using AccT = accumulator_t<PrecisionT>;
+        return static_cast<PrecisionT>(std::transform_reduce(
+            data, data + data_size, AccT{}, std::plus<AccT>(),
+            [](const std::complex<PrecisionT> &elt) -> AccT {
+                return std::norm(elt);
+            }));
     } else {
         using PrecisionT = T;
-        return std::transform_reduce(
-            data, data + data_size, PrecisionT{}, std::plus<PrecisionT>(),
-            static_cast<PrecisionT (*)(PrecisionT)>(std::norm));
+        using AccT = accumulator_t<PrecisionT>;
+        return static_cast<PrecisionT>(std::transform_reduce(
+            data, data + data_size, AccT{}, std::plus<AccT>(),
+            [](PrecisionT elt) -> AccT { return elt * elt; }));
     }
 }
 
@@ -790,6 +1012,151 @@ auto squaredNorm(const std::vector<T, Alloc> &vec) -> remove_complex_t<T> {
     return squaredNorm(vec.data(), vec.size());
 }
 
+/**
+ * @brief Singular value decomposition @f$M = U \mathrm{diag}(S) V^\dagger@f$
+ * of an @f$m \times n@f$ matrix, where @f$k = \min(m, n)@f$.
+ */
+template <class T> struct SVDResult {
+    std::vector<std::complex<T>> u;  /**< Row-major m * k matrix whose
+                                        columns for nonzero singular values
+                                        are orthonormal. */
+    std::vector<T> s;                /**< Singular values in descending
+                                        order. */
+    std::vector<std::complex<T>> vh; /**< Row-major k * n matrix with
+                                        orthonormal rows. */
+};
+
+/**
+ * @brief Compute the thin singular value decomposition of a complex matrix.
+ *
+ * The one-sided Jacobi method orthogonalizes pairs of columns of the matrix
+ * by plane rotations until all columns are orthogonal, so singular values
+ * are accurate to the working precision. The cost per sweep is
+ * @f$O(mn^2)@f$ for @f$m \geq n@f$, and a wide matrix is decomposed through
+ * its adjoint.
+ *
+ * @tparam T Floating point precision type.
+ * @param mat Row-wise flatten matrix of shape m * n.
+ * @param m Number of rows.
+ * @param n Number of columns.
+ * @return SVDResult<T>
+ */
+template <class T>
+auto svd(const std::complex<T> *mat, size_t m, size_t n) -> SVDResult<T> {
+    if (m < n) {
+        // M^\dagger = U' S V'^\dagger, so M = V' S U'^\dagger
+        std::vector<std::complex<T>> mat_h(n * m);
+        for (size_t row = 0; row < m; row++) {
+            for (size_t col = 0; col < n; col++) {
+                mat_h[col * m + row] = std::conj(mat[row * n + col]);
+            }
+        }
+        const auto res_h = svd(mat_h.data(), n, m);
+        SVDResult<T> res{std::vector<std::complex<T>>(m * m), res_h.s,
+                         std::vector<std::complex<T>>(m * n)};
+        for (size_t row = 0; row < m; row++) {
+            for (size_t col = 0; col < m; col++) {
+                res.u[row * m + col] = std::conj(res_h.vh[col * m + row]);
+            }
+        }
+        for (size_t row = 0; row < m; row++) {
+            for (size_t col = 0; col < n; col++) {
+                res.vh[row * n + col] = std::conj(res_h.u[col * m + row]);
+            }
+        }
+        return res;
+    }
+
+    constexpr size_t max_sweeps = 64;
+    const T tol = std::numeric_limits<T>::epsilon();
+
+    // Column-major copies of M and V, so rotations act on contiguous columns
+    std::vector<std::complex<T>> cols(m * n);
+    for (size_t row = 0; row < m; row++) {
+        for (size_t col = 0; col < n; col++) {
+            cols[col * m + row] = mat[row * n + col];
+        }
+    }
+    std::vector<std::complex<T>> v(n * n);
+    for (size_t col = 0; col < n; col++) {
+        v[col * n + col] = {1.0, 0.0};
+    }
+
+    const auto rotate = [](std::complex<T> *x, std::complex<T> *y, size_t len,
+                           T c, T s, std::complex<T> phase) {
+        for (size_t idx = 0; idx < len; idx++) {
+            const std::complex<T> xi = x[idx];
+            const std::complex<T> yi = y[idx] * std::conj(phase);
+            x[idx] = c * xi - s * yi;
+            y[idx] = s * xi + c * yi;
+        }
+    };
+
+    for (size_t sweep = 0; sweep < max_sweeps; sweep++) {
+        bool rotated = false;
+        for (size_t i = 0; i + 1 < n; i++) {
+            for (size_t j = i + 1; j < n; j++) {
+                std::complex<T> *col_i = cols.data() + i * m;
+                std::complex<T> *col_j = cols.data() + j * m;
+                T alpha = 0;
+                T beta = 0;
+                std::complex<T> gamma{0, 0};
+                for (size_t row = 0; row < m; row++) {
+                    alpha += std::norm(col_i[row]);
+                    beta += std::norm(col_j[row]);
+                    gamma += std::conj(col_i[row]) * col_j[row];
+                }
+                const T abs_gamma = std::abs(gamma);
+                if (abs_gamma == 0 ||
+                    abs_gamma <= tol * std::sqrt(alpha * beta)) {
+                    continue;
+                }
+                rotated = true;
+                // Rotate col_i and col_j * conj(phase), whose inner product
+                // is real, as in the real Jacobi method
+                const std::complex<T> phase = gamma / abs_gamma;
+                const T zeta = (beta - alpha) / (2 * abs_gamma);
+                const T t = ((zeta >= 0) ? T{1} : T{-1}) /
+                            (std::abs(zeta) + std::sqrt(1 + zeta * zeta));
+                const T c = 1 / std::sqrt(1 + t * t);
+                const T s = c * t;
+                rotate(col_i, col_j, m, c, s, phase);
+                rotate(v.data() + i * n, v.data() + j * n, n, c, s, phase);
+            }
+        }
+        if (!rotated) {
+            break;
+        }
+    }
+
+    // The columns of MV are U scaled by the singular values
+    std::vector<T> norms(n);
+    for (size_t col = 0; col < n; col++) {
+        norms[col] = std::sqrt(squaredNorm(cols.data() + col * m, m));
+    }
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&norms](size_t a, size_t b) {
+        return norms[a] > norms[b];
+    });
+
+    SVDResult<T> res{std::vector<std::complex<T>>(m * n), std::vector<T>(n),
+                     std::vector<std::complex<T>>(n * n)};
+    for (size_t k = 0; k < n; k++) {
+        const size_t col = order[k];
+        res.s[k] = norms[col];
+        if (norms[col] > 0) {
+            for (size_t row = 0; row < m; row++) {
+                res.u[row * n + k] = cols[col * m + row] / norms[col];
+            }
+        }
+        for (size_t row = 0; row < n; row++) {
+            res.vh[k * n + row] = std::conj(v[col * n + row]);
+        }
+    }
+    return res;
+}
+
 /**
  * @brief Generate random unitary matrix
  *
@@ -50,10 +50,30 @@
 #define PL_USE_AVX512VL 1
 #endif
 
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define PL_USE_NEON 1
+#endif
+
 #if defined(_OPENMP)
 #define PL_USE_OMP 1
 #endif
 
+/**
+ * @brief Compile the functions defined between PL_TARGET_PUSH(isa) and
+ * PL_TARGET_POP for the given instruction sets, e.g. "avx2", regardless of
+ * the target of the rest of the translation unit.
+ */
+#if defined(__clang__)
+#define PL_TARGET_PUSH(isa)                                                    \
+    _Pragma(PL_TO_STR(clang attribute push(__attribute__((target(isa))),      \
+                                           apply_to = function)))
+#define PL_TARGET_POP _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+#define PL_TARGET_PUSH(isa)                                                    \
+    _Pragma("GCC push_options") _Pragma(PL_TO_STR(GCC target(isa)))
+#define PL_TARGET_POP _Pragma("GCC pop_options")
+#endif
+
 #if (_OPENMP >= 202011)
 #define PL_UNROLL_LOOP _Pragma("omp unroll(8)")
 #elif defined(__GNUC__)
@@ -64,6 +84,12 @@
 #define PL_UNROLL_LOOP
 #endif
 
+#if defined(_OPENMP)
+#define PL_LOOP_SIMD _Pragma("omp simd")
+#else
+#define PL_LOOP_SIMD
+#endif
+
 // Define force inline
 #if defined(__GNUC__) || defined(__clang__)
 #if NDEBUG
@@ -108,11 +134,31 @@ namespace Pennylane::Util::Constant {
 #else
 [[maybe_unused]] static constexpr bool use_avx512vl = false;
 #endif
+#if defined(PL_USE_NEON)
+[[maybe_unused]] static constexpr bool use_neon = true;
+#else
+[[maybe_unused]] static constexpr bool use_neon = false;
+#endif
 #if defined(PL_USE_OMP)
 [[maybe_unused]] static constexpr bool use_openmp = true;
 #else
 [[maybe_unused]] static constexpr bool use_openmp = false;
 #endif
+#if defined(_ENABLE_DISPATCH_PROFILING)
+[[maybe_unused]] static constexpr bool use_dispatch_profiling = true;
+#else
+[[maybe_unused]] static constexpr bool use_dispatch_profiling = false;
+#endif
+#if defined(_ENABLE_TRACING)
+[[maybe_unused]] static constexpr bool use_tracing = true;
+#else
+[[maybe_unused]] static constexpr bool use_tracing = false;
+#endif
+#if defined(_ENABLE_RUNTIME_DISPATCH)
+[[maybe_unused]] static constexpr bool use_runtime_dispatch = true;
+#else
+[[maybe_unused]] static constexpr bool use_runtime_dispatch = false;
+#endif
 /// @endcond
 
 enum class CPUArch { X86_64, PPC64, ARM, Unknown };
@@ -122,7 +168,7 @@ constexpr auto getCPUArchClangGCC() {
     return CPUArch::X86_64;
 #elif defined(__powerpc64__)
     return CPUArch::PPC64;
-#elif defined(__arm__)
+#elif defined(__arm__) || defined(__aarch64__)
     return CPUArch::ARM;
 #else
     return CPUArch::Unknown;
@@ -134,7 +180,7 @@ constexpr auto getCPUArchMSVC() {
     return CPUArch::X86_64;
 #elif defined(_M_PPC)
     return CPUArch::PPC64;
-#elif defined(_M_ARM)
+#elif defined(_M_ARM) || defined(_M_ARM64)
     return CPUArch::ARM;
 #else
     return CPUArch::Unknown;
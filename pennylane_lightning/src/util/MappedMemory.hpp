@@ -0,0 +1,242 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file MappedMemory.hpp
+ * Defines memory regions mapped from files and POSIX shared memory.
+ */
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PL_HAS_MMAP 1
+#endif
+
+#include "Error.hpp"
+
+namespace Pennylane::Util {
+/**
+ * @brief Access mode of a mapped region.
+ */
+enum class MapAccess : uint8_t {
+    ReadOnly,  /**< Pages are mapped read-only */
+    ReadWrite, /**< Pages are mapped writable and changes are shared */
+};
+
+/**
+ * @brief Memory region mapped from a file or a POSIX shared memory segment.
+ *
+ * The mapping is shared, so all processes mapping the same file or segment
+ * read the same physical pages. The region is unmapped on destruction; the
+ * file or segment itself is left in place.
+ */
+class MappedMemory {
+  private:
+    void *data_;
+    size_t bytes_;
+    MapAccess access_;
+
+    MappedMemory(void *data, size_t bytes, MapAccess access)
+        : data_{data}, bytes_{bytes}, access_{access} {}
+
+#if defined(PL_HAS_MMAP)
+    [[noreturn]] static void abortWithErrno(const std::string &message) {
+        PL_ABORT(message + ": " + std::strerror(errno));
+    }
+
+    /**
+     * @brief Map an open descriptor and close it.
+     *
+     * @param fd File descriptor.
+     * @param access Access mode.
+     * @param bytes Size of the region. The size of the file if zero.
+     * Files opened for writing are extended if smaller.
+     * @param name Name used in error messages.
+     */
+    static auto mapDescriptor(int fd, MapAccess access, size_t bytes,
+                              const std::string &name)
+        -> std::shared_ptr<MappedMemory> {
+        struct stat info {};
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            abortWithErrno("Cannot query " + name);
+        }
+        const auto file_bytes = static_cast<size_t>(info.st_size);
+        if (bytes == 0) {
+            bytes = file_bytes;
+        }
+        if (bytes == 0) {
+            close(fd);
+            PL_ABORT("Cannot map the empty file " + name + ".");
+        }
+        if (bytes > file_bytes) {
+            if (access == MapAccess::ReadOnly ||
+                ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+                close(fd);
+                PL_ABORT(name + " is smaller than the requested size.");
+            }
+        }
+        const int prot = (access == MapAccess::ReadOnly)
+                             ? PROT_READ
+                             : (PROT_READ | PROT_WRITE);
+        void *data = mmap(nullptr, bytes, prot, MAP_SHARED, fd, 0);
+        close(fd); // The mapping keeps the file open
+        if (data == MAP_FAILED) {
+            abortWithErrno("Cannot map " + name);
+        }
+        return std::shared_ptr<MappedMemory>(
+            new MappedMemory(data, bytes, access));
+    }
+
+    static auto openFlags(MapAccess access) -> int {
+        return (access == MapAccess::ReadOnly) ? O_RDONLY : (O_RDWR | O_CREAT);
+    }
+#endif
+
+  public:
+    MappedMemory(const MappedMemory &) = delete;
+    MappedMemory(MappedMemory &&) = delete;
+    MappedMemory &operator=(const MappedMemory &) = delete;
+    MappedMemory &operator=(MappedMemory &&) = delete;
+
+    ~MappedMemory() {
+#if defined(PL_HAS_MMAP)
+        munmap(data_, bytes_);
+#endif
+    }
+
+    /**
+     * @brief Map a file.
+     *
+     * @param path Path of the file. It is created if opened for writing.
+     * @param access Access mode.
+     * @param bytes Size of the region. The size of the file if zero.
+     */
+    static auto mapFile(const std::string &path, MapAccess access,
+                        size_t bytes = 0) -> std::shared_ptr<MappedMemory> {
+#if defined(PL_HAS_MMAP)
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+        const int fd = open(path.c_str(), openFlags(access), 0600);
+        if (fd < 0) {
+            abortWithErrno("Cannot open " + path);
+        }
+        return mapDescriptor(fd, access, bytes, path);
+#else
+        static_cast<void>(path);
+        static_cast<void>(access);
+        static_cast<void>(bytes);
+        PL_ABORT("Memory-mapped files are not supported on this platform.");
+#endif
+    }
+
+    /**
+     * @brief Map a POSIX shared memory segment.
+     *
+     * @param name Name of the segment, e.g. "/lightning_state". It is
+     * created if opened for writing.
+     * @param access Access mode.
+     * @param bytes Size of the region. The size of the segment if zero.
+     */
+    static auto mapSharedMemory(const std::string &name, MapAccess access,
+                                size_t bytes = 0)
+        -> std::shared_ptr<MappedMemory> {
+#if defined(PL_HAS_MMAP)
+        const int fd = shm_open(name.c_str(), openFlags(access), 0600);
+        if (fd < 0) {
+            abortWithErrno("Cannot open the shared memory segment " + name);
+        }
+        return mapDescriptor(fd, access, bytes, name);
+#else
+        static_cast<void>(name);
+        static_cast<void>(access);
+        static_cast<void>(bytes);
+        PL_ABORT("Shared memory is not supported on this platform.");
+#endif
+    }
+
+    /**
+     * @brief Remove a POSIX shared memory segment.
+     *
+     * Existing mappings stay valid until they are unmapped.
+     *
+     * @param name Name of the segment.
+     */
+    static void unlinkSharedMemory(const std::string &name) {
+#if defined(PL_HAS_MMAP)
+        if (shm_unlink(name.c_str()) != 0) {
+            abortWithErrno("Cannot remove the shared memory segment " + name);
+        }
+#else
+        static_cast<void>(name);
+        PL_ABORT("Shared memory is not supported on this platform.");
+#endif
+    }
+
+    /**
+     * @brief Hint that a part of the region is accessed soon, so that its
+     * pages are read ahead while the caller keeps computing.
+     *
+     * @param offset Offset of the part in bytes.
+     * @param bytes Size of the part in bytes.
+     */
+    void prefetch(size_t offset, size_t bytes) const {
+#if defined(PL_HAS_MMAP)
+        const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t begin = offset - offset % page;
+        // Advice is best effort, so errors are ignored
+        madvise(static_cast<char *>(data_) + begin, offset + bytes - begin,
+                MADV_WILLNEED);
+#else
+        static_cast<void>(offset);
+        static_cast<void>(bytes);
+#endif
+    }
+
+    /**
+     * @brief Write the changed pages of the region back to the file.
+     */
+    void flush() const {
+#if defined(PL_HAS_MMAP)
+        if (access_ == MapAccess::ReadWrite &&
+            msync(data_, bytes_, MS_SYNC) != 0) {
+            abortWithErrno("Cannot write back the mapped region");
+        }
+#endif
+    }
+
+    /**
+     * @brief Get the start of the region.
+     */
+    [[nodiscard]] auto data() const -> void * { return data_; }
+
+    /**
+     * @brief Get the size of the region in bytes.
+     */
+    [[nodiscard]] auto size() const -> size_t { return bytes_; }
+
+    /**
+     * @brief Get the access mode of the region.
+     */
+    [[nodiscard]] auto access() const -> MapAccess { return access_; }
+};
+} // namespace Pennylane::Util
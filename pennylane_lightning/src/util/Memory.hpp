@@ -10,19 +10,213 @@
 // limitations under the License.
 #pragma once
 
+#include <algorithm>
 #include <algorithm>
 #include <cassert>
+#include <climits>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <new>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "BitUtil.hpp"
 #include "TypeList.hpp"
+#include "TypeTraits.hpp"
 
 namespace Pennylane::Util {
+/**
+ * @brief Placement of the pages of an allocation on NUMA nodes.
+ *
+ * Linux places a page on the NUMA node of the thread which first writes to
+ * it. With the Default policy, memory is initialised by the allocating
+ * thread, so all pages of a large statevector end up on a single node.
+ * Other policies first touch the pages in parallel using the static OpenMP
+ * schedule of the kernels, so each thread later works on local pages.
+ */
+enum class NUMAPolicy : uint8_t {
+    Default,    /**< Pages are placed by the thread that initialises them */
+    FirstTouch, /**< Pages are touched by the threads of a static schedule */
+    Interleave, /**< Pages are interleaved over all NUMA nodes (Linux) */
+    Bind,       /**< Pages are bound to the NUMA node of the allocating
+                     thread (Linux) */
+};
+
+/**
+ * @brief Backing of an allocation with huge pages.
+ *
+ * Large statevectors spread over many 4 KiB pages, so the kernels miss the
+ * TLB on most strided accesses. Huge pages reduce the number of TLB entries
+ * by a factor of 512 (2 MiB) or 262144 (1 GiB). The allocation falls back
+ * transparently to normal pages when huge pages are unavailable.
+ */
+enum class HugePagePolicy : uint8_t {
+    Disabled,    /**< Normal pages */
+    Transparent, /**< 2 MiB transparent huge pages via madvise (Linux) */
+    Explicit,    /**< 1 GiB pages from the hugetlbfs pool (Linux), falling
+                      back to transparent huge pages */
+};
+
+/// @cond DEV
+namespace Internal {
+/**
+ * @brief Granularity of the parallel first touch.
+ */
+constexpr size_t first_touch_page_size = 4096;
+
+/**
+ * @brief Size of a transparent huge page.
+ */
+constexpr size_t transparent_huge_page_size = size_t{1} << 21U;
+
+/**
+ * @brief Size of an explicit huge page.
+ */
+constexpr size_t explicit_huge_page_size = size_t{1} << 30U;
+
+/**
+ * @brief Round the number of bytes up to a multiple of the page size.
+ */
+constexpr auto roundUpToPage(size_t bytes, size_t page) -> size_t {
+    return (bytes + page - 1) / page * page;
+}
+
+/**
+ * @brief Ask the kernel to back a 2 MiB-aligned memory range with
+ * transparent huge pages.
+ *
+ * This is done on a best-effort basis. The range keeps normal pages if
+ * transparent huge pages are disabled.
+ */
+inline void adviseHugePages([[maybe_unused]] void *ptr,
+                            [[maybe_unused]] size_t bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    [[maybe_unused]] const auto ret = madvise(ptr, bytes, MADV_HUGEPAGE);
+#endif
+}
+
+/**
+ * @brief Whether explicit huge page allocations are mapped by mapHugePages.
+ */
+#if defined(__linux__)
+constexpr bool huge_page_map_supported = true;
+#else
+constexpr bool huge_page_map_supported = false;
+#endif
+
+/**
+ * @brief Map memory for an explicit huge page allocation.
+ *
+ * The memory is mapped from the 1 GiB hugetlbfs pool if possible, and from
+ * anonymous memory advised to use transparent huge pages otherwise. Either
+ * way, it is released by unmapHugePages.
+ *
+ * @param bytes Number of bytes to map.
+ * @return Pointer to the mapped memory, or nullptr on failure.
+ */
+inline auto mapHugePages([[maybe_unused]] size_t bytes) -> void * {
+#if defined(__linux__)
+    const size_t length = roundUpToPage(bytes, explicit_huge_page_size);
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    void *p = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                       (30 << MAP_HUGE_SHIFT), // NOLINT(hicpp-signed-bitwise)
+                   -1, 0);
+    if (p != MAP_FAILED) {
+        return p;
+    }
+#endif
+    void *q = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (q == MAP_FAILED) {
+        return nullptr;
+    }
+    adviseHugePages(q, length);
+    return q;
+#else
+    return nullptr;
+#endif
+}
+
+/**
+ * @brief Unmap memory mapped by mapHugePages.
+ *
+ * @param ptr Pointer returned by mapHugePages.
+ * @param bytes Number of bytes passed to mapHugePages.
+ */
+inline void unmapHugePages([[maybe_unused]] void *ptr,
+                           [[maybe_unused]] size_t bytes) {
+#if defined(__linux__)
+    munmap(ptr, roundUpToPage(bytes, explicit_huge_page_size));
+#endif
+}
+
+/**
+ * @brief Set the NUMA memory policy of a page-aligned memory range.
+ *
+ * This is done on a best-effort basis. The pages keep the default policy
+ * if the policy cannot be set.
+ */
+inline void setNUMAPolicy([[maybe_unused]] void *ptr,
+                          [[maybe_unused]] size_t bytes, NUMAPolicy policy) {
+    if (policy != NUMAPolicy::Interleave && policy != NUMAPolicy::Bind) {
+        return;
+    }
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_getcpu)
+    unsigned long nodemask = ~0UL; // NOLINT(google-runtime-int)
+    int mode = MPOL_INTERLEAVE;
+    if (policy == NUMAPolicy::Bind) {
+        unsigned cpu = 0;
+        unsigned node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 ||
+            node >= sizeof(nodemask) * CHAR_BIT) {
+            return;
+        }
+        nodemask = 1UL << node;
+        mode = MPOL_BIND;
+    }
+    [[maybe_unused]] const auto ret =
+        syscall(SYS_mbind, ptr, bytes, mode, &nodemask,
+                sizeof(nodemask) * CHAR_BIT + 1, 0);
+#endif
+}
+
+/**
+ * @brief Zero-fill memory from all threads with a static schedule, so that
+ * each page is first touched by the thread which later works on it.
+ */
+inline void firstTouch(void *ptr, size_t bytes) {
+    auto *bytes_ptr = static_cast<char *>(ptr);
+    const size_t num_pages =
+        (bytes + first_touch_page_size - 1) / first_touch_page_size;
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static)
+    #endif
+    // clang-format on
+    for (size_t page = 0; page < num_pages; page++) {
+        const size_t offset = page * first_touch_page_size;
+        std::memset(bytes_ptr + offset, 0,
+                    std::min(first_touch_page_size, bytes - offset));
+    }
+}
+} // namespace Internal
+/// @endcond
+
 /**
  * @brief Custom aligned allocate function.
  *
@@ -64,6 +258,137 @@ inline void alignedFree(void *p) {
 #endif
 }
 
+/**
+ * @brief Pool of large buffers which are reused by allocators instead of
+ * being freed.
+ *
+ * Temporary statevectors of the same size are created repeatedly, e.g. by
+ * each call to the adjoint method in a training loop. Allocators with a pool
+ * return their buffers to it on deallocation, and take them back on an
+ * allocation of the same size, alignment and page policies. This avoids the
+ * cost of allocating, page faulting and freeing gigabytes of memory in each
+ * iteration. The pool is thread-safe.
+ */
+class BufferPool {
+  public:
+    /**
+     * @brief Properties of a buffer which must match for it to be reused.
+     */
+    struct Key {
+        size_t bytes;
+        uint32_t alignment;
+        NUMAPolicy numa_policy;
+        HugePagePolicy huge_pages;
+
+        auto operator<=>(const Key &) const = default;
+    };
+
+  private:
+    mutable std::mutex mutex_;
+    std::map<Key, std::vector<void *>> buffers_;
+    size_t cached_bytes_{0};
+    size_t max_bytes_{std::numeric_limits<size_t>::max()};
+
+    /**
+     * @brief Free buffers until at most max_bytes are cached. The mutex must
+     * be held.
+     */
+    void evict(size_t max_bytes);
+
+  public:
+    BufferPool() = default;
+    BufferPool(const BufferPool &) = delete;
+    BufferPool(BufferPool &&) = delete;
+    BufferPool &operator=(const BufferPool &) = delete;
+    BufferPool &operator=(BufferPool &&) = delete;
+
+    ~BufferPool() { clear(); }
+
+    /**
+     * @brief Process-wide pool used by temporary statevectors.
+     */
+    static auto global() -> BufferPool & {
+        static BufferPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Take a buffer out of the pool.
+     *
+     * @param key Properties of the buffer.
+     * @return Pointer to the buffer, or nullptr if none is available.
+     */
+    [[nodiscard]] auto acquire(const Key &key) -> void * {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = buffers_.find(key);
+        if (iter == buffers_.end() || iter->second.empty()) {
+            return nullptr;
+        }
+        void *p = iter->second.back();
+        iter->second.pop_back();
+        cached_bytes_ -= key.bytes;
+        return p;
+    }
+
+    /**
+     * @brief Return a buffer to the pool.
+     *
+     * @param key Properties of the buffer.
+     * @param p Pointer to the buffer.
+     * @return True if the pool took the buffer, and false if the caller must
+     * free it as the pool is full.
+     */
+    [[nodiscard]] auto release(const Key &key, void *p) -> bool {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (key.bytes > max_bytes_ - cached_bytes_) {
+            return false;
+        }
+        try {
+            buffers_[key].push_back(p);
+        } catch (const std::bad_alloc &) {
+            return false;
+        }
+        cached_bytes_ += key.bytes;
+        return true;
+    }
+
+    /**
+     * @brief Set the maximum number of bytes kept in the pool, freeing
+     * buffers exceeding it.
+     *
+     * @param max_bytes Maximum number of bytes. Zero disables the pool.
+     */
+    void setMaxBytes(size_t max_bytes) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        max_bytes_ = max_bytes;
+        evict(max_bytes);
+    }
+
+    /**
+     * @brief Get the maximum number of bytes kept in the pool.
+     */
+    [[nodiscard]] auto maxBytes() const -> size_t {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return max_bytes_;
+    }
+
+    /**
+     * @brief Get the number of bytes currently kept in the pool.
+     */
+    [[nodiscard]] auto cachedBytes() const -> size_t {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return cached_bytes_;
+    }
+
+    /**
+     * @brief Free all buffers of the pool.
+     */
+    void clear() {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        evict(0);
+    }
+};
+
 /**
  * @brief C++ Allocator class for aligned memory.
  *
@@ -72,6 +397,13 @@ inline void alignedFree(void *p) {
 template <class T> class AlignedAllocator {
   private:
     const uint32_t alignment_;
+    const NUMAPolicy numa_policy_;
+    const HugePagePolicy huge_pages_;
+    BufferPool *pool_;
+
+    [[nodiscard]] auto poolKey(std::size_t size) const -> BufferPool::Key {
+        return {sizeof(T) * size, alignment_, numa_policy_, huge_pages_};
+    }
 
   public:
     using value_type = T;
@@ -80,9 +412,17 @@ template <class T> class AlignedAllocator {
      * @brief Constructor of AlignedAllocator class
      *
      * @param alignment Memory alignment we want.
+     * @param numa_policy Placement of the allocated pages on NUMA nodes.
+     * @param huge_pages Backing of the allocation with huge pages.
+     * @param pool Pool the deallocated memory is returned to, or nullptr
+     * to free it.
      */
-    constexpr explicit AlignedAllocator(uint32_t alignment)
-        : alignment_{alignment} {
+    constexpr explicit AlignedAllocator(
+        uint32_t alignment, NUMAPolicy numa_policy = NUMAPolicy::Default,
+        HugePagePolicy huge_pages = HugePagePolicy::Disabled,
+        BufferPool *pool = nullptr)
+        : alignment_{alignment}, numa_policy_{numa_policy},
+          huge_pages_{huge_pages}, pool_{pool} {
         // We do not check input now as it doesn't allow the constructor to be
         // a constexpr.
         // TODO: Using exception is allowed in GCC>=10
@@ -94,12 +434,54 @@ template <class T> class AlignedAllocator {
      */
     [[nodiscard]] inline uint32_t alignment() const { return alignment_; }
 
+    /**
+     * @brief Get NUMA policy of the allocator
+     */
+    [[nodiscard]] inline NUMAPolicy numaPolicy() const { return numa_policy_; }
+
+    /**
+     * @brief Get huge page policy of the allocator
+     */
+    [[nodiscard]] inline HugePagePolicy hugePages() const {
+        return huge_pages_;
+    }
+
+    /**
+     * @brief Get the buffer pool of the allocator
+     */
+    [[nodiscard]] inline BufferPool *pool() const { return pool_; }
+
+    /**
+     * @brief Check if the memory is mapped by Internal::mapHugePages, and
+     * must be unmapped by Internal::unmapHugePages.
+     */
+    [[nodiscard]] inline bool usesHugePageMap() const {
+        return Internal::huge_page_map_supported &&
+               huge_pages_ == HugePagePolicy::Explicit;
+    }
+
+    /**
+     * @brief Check if the memory is allocated by alignedAlloc, and must be
+     * freed by alignedFree.
+     *
+     * Memory with a NUMA policy other than the default is page-aligned, so
+     * the policy applies to whole pages. Memory backed by transparent huge
+     * pages is aligned to the huge page size.
+     */
+    [[nodiscard]] inline bool usesAlignedAlloc() const {
+        return !usesHugePageMap() &&
+               (alignment_ > alignof(std::max_align_t) ||
+                numa_policy_ != NUMAPolicy::Default ||
+                huge_pages_ != HugePagePolicy::Disabled);
+    }
+
     template <class U> struct rebind { using other = AlignedAllocator<U>; };
 
     template <typename U>
     explicit constexpr AlignedAllocator(
         [[maybe_unused]] const AlignedAllocator<U> &rhs) noexcept
-        : alignment_{rhs.alignment()} {}
+        : alignment_{rhs.alignment()}, numa_policy_{rhs.numaPolicy()},
+          huge_pages_{rhs.hugePages()}, pool_{rhs.pool()} {}
 
     /**
      * @brief Allocate memory with for the given number of datatype T
@@ -111,16 +493,46 @@ template <class T> class AlignedAllocator {
         if (size == 0) {
             return nullptr;
         }
+        if (pool_ != nullptr) {
+            // The pages of a reused buffer are already placed
+            if (void *p = pool_->acquire(poolKey(size)); p != nullptr) {
+                if (numa_policy_ != NUMAPolicy::Default) {
+                    Internal::firstTouch(p, sizeof(T) * size);
+                }
+                return static_cast<T *>(p);
+            }
+        }
+        const size_t bytes = sizeof(T) * size;
+        size_t page = 0;
+        if (huge_pages_ != HugePagePolicy::Disabled) {
+            page = Internal::transparent_huge_page_size;
+        } else if (numa_policy_ != NUMAPolicy::Default) {
+            page = Internal::first_touch_page_size;
+        }
         void *p;
-        if (alignment_ > alignof(std::max_align_t)) {
-            p = alignedAlloc(alignment_, sizeof(T) * size);
+        if (usesHugePageMap()) {
+            p = Internal::mapHugePages(bytes);
+        } else if (page != 0) {
+            // aligned_alloc requires a multiple of the alignment
+            p = alignedAlloc(std::max<uint32_t>(alignment_, page),
+                             Internal::roundUpToPage(bytes, page));
+        } else if (alignment_ > alignof(std::max_align_t)) {
+            p = alignedAlloc(alignment_, bytes);
         } else {
             // NOLINTNEXTLINE(hicpp-no-malloc)
-            p = malloc(sizeof(T) * size);
+            p = malloc(bytes);
         }
         if (p == nullptr) {
             throw std::bad_alloc();
         }
+        if (huge_pages_ == HugePagePolicy::Transparent ||
+            (huge_pages_ == HugePagePolicy::Explicit && !usesHugePageMap())) {
+            Internal::adviseHugePages(p, Internal::roundUpToPage(bytes, page));
+        }
+        if (numa_policy_ != NUMAPolicy::Default) {
+            Internal::setNUMAPolicy(p, bytes, numa_policy_);
+            Internal::firstTouch(p, bytes);
+        }
         return static_cast<T *>(p);
     }
 
@@ -128,10 +540,19 @@ template <class T> class AlignedAllocator {
      * @brief Deallocate allocated memory
      *
      * @param p Pointer to the allocated data
-     * @param size Size of the data we allocated (unused).
+     * @param size Size of the data we allocated, i.e. the argument of
+     * allocate.
      */
     void deallocate(T *p, [[maybe_unused]] std::size_t size) noexcept {
-        if (alignment_ > alignof(std::max_align_t)) {
+        if (p == nullptr) {
+            return;
+        }
+        if (pool_ != nullptr && pool_->release(poolKey(size), p)) {
+            return;
+        }
+        if (usesHugePageMap()) {
+            Internal::unmapHugePages(p, sizeof(T) * size);
+        } else if (usesAlignedAlloc()) {
             alignedFree(p);
         } else {
             // NOLINTNEXTLINE(hicpp-no-malloc)
@@ -139,7 +560,24 @@ template <class T> class AlignedAllocator {
         }
     }
 
-    template <class U> void construct(U *ptr) { ::new ((void *)ptr) U(); }
+    /**
+     * @brief Construct an element without a value.
+     *
+     * Memory with a NUMA policy other than the default is zero-filled in
+     * parallel by allocate(), which is already the value of arithmetic and
+     * complex elements. These are left untouched, so that the parallel first
+     * touch is the only write. Other elements are value-initialised.
+     *
+     * @param ptr Pointer to the element.
+     */
+    template <class U> void construct(U *ptr) {
+        if constexpr (std::is_arithmetic_v<U> || Util::is_complex_v<U>) {
+            if (numa_policy_ != NUMAPolicy::Default) {
+                return;
+            }
+        }
+        ::new ((void *)ptr) U();
+    }
 
     template <class U> void destroy(U *ptr) {
         (void)ptr;
@@ -152,12 +590,15 @@ template <class T> class AlignedAllocator {
  *
  * By [the standard](https://en.cppreference.com/w/cpp/named_req/Allocator),
  * two allocators are equal if the memory allocated by one can be deallocated
- * by the other.
+ * by the other. The buffer pool does not matter, as pooled memory is freed
+ * as non-pooled memory when the pool is full.
  */
 template <class T, class U>
 bool operator==([[maybe_unused]] const AlignedAllocator<T> &lhs,
                 [[maybe_unused]] const AlignedAllocator<U> &rhs) {
-    return lhs.alignment() == rhs.alignment();
+    return lhs.alignment() == rhs.alignment() &&
+           lhs.numaPolicy() == rhs.numaPolicy() &&
+           lhs.hugePages() == rhs.hugePages();
 }
 
 /**
@@ -166,7 +607,24 @@ bool operator==([[maybe_unused]] const AlignedAllocator<T> &lhs,
 template <class T, class U, uint32_t alignment>
 bool operator!=([[maybe_unused]] const AlignedAllocator<T> &lhs,
                 [[maybe_unused]] const AlignedAllocator<U> &rhs) {
-    return lhs.alignment() != rhs.alignment();
+    return !(lhs == rhs);
+}
+
+inline void BufferPool::evict(size_t max_bytes) {
+    for (auto iter = buffers_.begin();
+         iter != buffers_.end() && cached_bytes_ > max_bytes;) {
+        const Key &key = iter->first;
+        AlignedAllocator<std::byte> allocator{
+            key.alignment, key.numa_policy, key.huge_pages};
+        auto &buffers = iter->second;
+        while (!buffers.empty() && cached_bytes_ > max_bytes) {
+            allocator.deallocate(static_cast<std::byte *>(buffers.back()),
+                                 key.bytes);
+            buffers.pop_back();
+            cached_bytes_ -= key.bytes;
+        }
+        iter = buffers.empty() ? buffers_.erase(iter) : std::next(iter);
+    }
 }
 
 ///@cond DEV
@@ -0,0 +1,103 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Defines the Philox4x32-10 counter-based random number generator.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Pennylane::Util {
+/**
+ * @brief Philox4x32-10 counter-based random number generator.
+ *
+ * The output is a pure function of the key (seed) and the counter, so
+ * independent streams are obtained by assigning disjoint counters, e.g. one
+ * per sample, without any shared state between threads.
+ * Reference: J. K. Salmon et al., "Parallel random numbers: as easy as 1, 2,
+ * 3", SC '11.
+ */
+class Philox4x32 {
+  public:
+    using CounterT = std::array<uint32_t, 4>;
+
+  private:
+    constexpr static uint32_t mult0 = 0xD2511F53U;
+    constexpr static uint32_t mult1 = 0xCD9E8D57U;
+    constexpr static uint32_t weyl0 = 0x9E3779B9U;
+    constexpr static uint32_t weyl1 = 0xBB67AE85U;
+    constexpr static size_t num_rounds = 10;
+
+    std::array<uint32_t, 2> key_;
+
+    constexpr static auto round(const CounterT &ctr,
+                                const std::array<uint32_t, 2> &key)
+        -> CounterT {
+        const uint64_t prod0 = uint64_t{mult0} * ctr[0];
+        const uint64_t prod1 = uint64_t{mult1} * ctr[2];
+        const auto hi0 = static_cast<uint32_t>(prod0 >> 32U);
+        const auto lo0 = static_cast<uint32_t>(prod0);
+        const auto hi1 = static_cast<uint32_t>(prod1 >> 32U);
+        const auto lo1 = static_cast<uint32_t>(prod1);
+        return {hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0};
+    }
+
+  public:
+    /**
+     * @brief Construct a generator.
+     *
+     * @param seed Key of the generator.
+     */
+    constexpr explicit Philox4x32(uint64_t seed)
+        : key_{static_cast<uint32_t>(seed),
+               static_cast<uint32_t>(seed >> 32U)} {}
+
+    /**
+     * @brief Generate four random 32-bit integers for the given counter.
+     *
+     * @param ctr Counter.
+     */
+    [[nodiscard]] constexpr auto operator()(CounterT ctr) const -> CounterT {
+        auto key = key_;
+        ctr = round(ctr, key);
+        for (size_t r = 1; r < num_rounds; r++) {
+            key[0] += weyl0;
+            key[1] += weyl1;
+            ctr = round(ctr, key);
+        }
+        return ctr;
+    }
+
+    /**
+     * @brief Generate two uniform random numbers in [0, 1) with 53 random
+     * bits each for the given counter.
+     *
+     * @param counter Counter.
+     */
+    [[nodiscard]] constexpr auto uniform2(uint64_t counter) const
+        -> std::array<double, 2> {
+        constexpr double scale = 1.0 / static_cast<double>(uint64_t{1U} << 53U);
+        const auto res = (*this)({static_cast<uint32_t>(counter),
+                                  static_cast<uint32_t>(counter >> 32U), 0U,
+                                  0U});
+        const uint64_t bits0 = (uint64_t{res[1]} << 32U) | res[0];
+        const uint64_t bits1 = (uint64_t{res[3]} << 32U) | res[2];
+        return {static_cast<double>(bits0 >> 11U) * scale,
+                static_cast<double>(bits1 >> 11U) * scale};
+    }
+};
+} // namespace Pennylane::Util
@@ -20,6 +20,9 @@
 #elif defined(_MSC_VER) && defined(_WIN64)
 #include <intrin.h>
 #include <vector>
+#elif defined(__aarch64__) && defined(__linux__)
+#include <fstream>
+#include <sys/auxv.h>
 #endif
 
 namespace Pennylane::Util {
@@ -124,6 +127,29 @@ RuntimeInfo::InternalRuntimeInfo::InternalRuntimeInfo() {
         brand = str;
     }
 }
+#elif defined(__aarch64__) && defined(__linux__)
+RuntimeInfo::InternalRuntimeInfo::InternalRuntimeInfo()
+    : hwcap{getauxval(AT_HWCAP)} {
+    // There is no brand string on ARM. Report the implementer and part
+    // numbers of the first core instead.
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        const auto colon = line.find(':');
+        if (colon == std::string::npos || colon + 2 > line.size()) {
+            continue;
+        }
+        if (vendor.empty() && line.rfind("CPU implementer", 0) == 0) {
+            vendor = line.substr(colon + 2);
+        } else if (brand.empty() && line.rfind("CPU part", 0) == 0) {
+            brand = line.substr(colon + 2);
+        }
+    }
+}
+#elif defined(__aarch64__) && defined(__APPLE__)
+RuntimeInfo::InternalRuntimeInfo::InternalRuntimeInfo() : vendor{"Apple"} {
+    hwcap[1] = true; // Advanced SIMD is mandatory in AArch64
+}
 #else
 RuntimeInfo::InternalRuntimeInfo::InternalRuntimeInfo(){};
 #endif
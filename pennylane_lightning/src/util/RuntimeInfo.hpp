@@ -13,14 +13,20 @@
 // limitations under the License.
 /**
  * @file
- * Runtime information based on cpuid
+ * Runtime information based on cpuid (x86) or the hardware capabilities
+ * reported by the kernel (ARM)
  */
 #pragma once
 #include <bitset>
+#include <string>
 
 namespace Pennylane::Util {
 /**
- * @brief This class is only usable in x86 or x86_64 architecture.
+ * @brief Instruction sets supported by the CPU.
+ *
+ * x86 features are read with cpuid. On AArch64, NEON and SVE are read from
+ * the HWCAP auxiliary vector on Linux; NEON is always available on macOS.
+ * Features of the other architecture are always false.
  */
 class RuntimeInfo {
   private:
@@ -34,6 +40,7 @@ class RuntimeInfo {
         std::bitset<32> f_1_edx{};
         std::bitset<32> f_7_ebx{};
         std::bitset<32> f_7_ecx{};
+        std::bitset<64> hwcap{};
     };
     /// @endcond
 
@@ -52,6 +59,13 @@ class RuntimeInfo {
         // NOLINTNEXTLINE(readability-magic-numbers)
         return internal_runtime_info_.f_7_ebx[16];
     }
+    static inline bool NEON() {
+        return internal_runtime_info_.hwcap[1]; // HWCAP_ASIMD
+    }
+    static inline bool SVE() {
+        // NOLINTNEXTLINE(readability-magic-numbers)
+        return internal_runtime_info_.hwcap[22]; // HWCAP_SVE
+    }
     static const std::string &vendor() { return internal_runtime_info_.vendor; }
     static const std::string &brand() { return internal_runtime_info_.brand; }
 };
@@ -0,0 +1,163 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Contains native kernels for sparse matrices in the compressed sparse row
+ * (CSR) format, which do not require Kokkos.
+ */
+#pragma once
+
+#include "Error.hpp"
+#include "TypeTraits.hpp"
+
+#include <complex>
+#include <vector>
+
+namespace Pennylane::Util {
+/**
+ * @brief Check the CSR arrays are consistent with a vector of the given
+ * size.
+ *
+ * @tparam index_type Integer type used as indices of the sparse matrix.
+ * @param vector_size Size of the vector.
+ * @param row_map_ptr Pointer to the row_map array. Elements of this array
+ * return the number of non-zero terms in all rows before it.
+ * @param row_map_size Number of elements in the row_map.
+ * @param numNNZ Number of non-zero elements.
+ */
+template <class index_type>
+void check_Sparse_Matrix_CSR(const index_type vector_size,
+                             const index_type *row_map_ptr,
+                             const index_type row_map_size,
+                             const index_type numNNZ) {
+    PL_ABORT_IF(vector_size != row_map_size - 1,
+                "Statevector and Hamiltonian have incompatible sizes.");
+    PL_ABORT_IF(row_map_ptr[0] != 0 || row_map_ptr[row_map_size - 1] != numNNZ,
+                "The row_map is inconsistent with the number of non-zero "
+                "elements.");
+}
+
+/**
+ * @brief Apply a sparse matrix in the CSR format to a vector.
+ *
+ * Rows are distributed over threads, and each row is computed independently
+ * without any intermediate allocation.
+ *
+ * @tparam fp_precision Floating point precision.
+ * @tparam index_type Integer type used as indices of the sparse matrix.
+ * @param vector_ptr Pointer to the vector.
+ * @param vector_size Size of the vector.
+ * @param row_map_ptr Pointer to the row_map array. Elements of this array
+ * return the number of non-zero terms in all rows before it.
+ * @param row_map_size Number of elements in the row_map.
+ * @param entries_ptr Pointer to the column indices of the non-zero elements.
+ * @param values_ptr Pointer to the non-zero elements.
+ * @param numNNZ Number of non-zero elements.
+ * @param result_ptr Pointer to the result of size vector_size. Must not alias
+ * vector_ptr.
+ */
+template <class fp_precision, class index_type>
+void apply_Sparse_Matrix_CSR(const std::complex<fp_precision> *vector_ptr,
+                             const index_type vector_size,
+                             const index_type *row_map_ptr,
+                             const index_type row_map_size,
+                             const index_type *entries_ptr,
+                             const std::complex<fp_precision> *values_ptr,
+                             const index_type numNNZ,
+                             std::complex<fp_precision> *result_ptr) {
+    check_Sparse_Matrix_CSR(vector_size, row_map_ptr, row_map_size, numNNZ);
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static)
+    #endif
+    // clang-format on
+    for (index_type row = 0; row < vector_size; row++) {
+        std::complex<fp_precision> sum{0.0, 0.0};
+        for (index_type j = row_map_ptr[row]; j < row_map_ptr[row + 1]; j++) {
+            sum += values_ptr[j] * vector_ptr[entries_ptr[j]];
+        }
+        result_ptr[row] = sum;
+    }
+}
+
+/**
+ * @brief Apply a sparse matrix in the CSR format to a vector.
+ *
+ * @see apply_Sparse_Matrix_CSR(const std::complex<fp_precision> *vector_ptr,
+ * const index_type vector_size, const index_type *row_map_ptr,
+ * const index_type row_map_size, const index_type *entries_ptr,
+ * const std::complex<fp_precision> *values_ptr, const index_type numNNZ,
+ * std::complex<fp_precision> *result_ptr)
+ */
+template <class fp_precision, class index_type>
+auto apply_Sparse_Matrix_CSR(const std::complex<fp_precision> *vector_ptr,
+                             const index_type vector_size,
+                             const index_type *row_map_ptr,
+                             const index_type row_map_size,
+                             const index_type *entries_ptr,
+                             const std::complex<fp_precision> *values_ptr,
+                             const index_type numNNZ)
+    -> std::vector<std::complex<fp_precision>> {
+    std::vector<std::complex<fp_precision>> result(
+        static_cast<size_t>(vector_size));
+    apply_Sparse_Matrix_CSR(vector_ptr, vector_size, row_map_ptr, row_map_size,
+                            entries_ptr, values_ptr, numNNZ, result.data());
+    return result;
+}
+
+/**
+ * @brief Compute the expectation value @f$\langle\psi|H|\psi\rangle@f$ of a
+ * Hermitian sparse matrix in the CSR format.
+ *
+ * Each row contributes @f$\mathrm{Re}(\psi^*_r \sum_j H_{rj} \psi_j)@f$, so
+ * @f$H|\psi\rangle@f$ is never stored.
+ *
+ * @tparam fp_precision Floating point precision.
+ * @tparam index_type Integer type used as indices of the sparse matrix.
+ * @param vector_ptr Pointer to the statevector.
+ * @param vector_size Size of the statevector.
+ * @param row_map_ptr Pointer to the row_map array. Elements of this array
+ * return the number of non-zero terms in all rows before it.
+ * @param row_map_size Number of elements in the row_map.
+ * @param entries_ptr Pointer to the column indices of the non-zero elements.
+ * @param values_ptr Pointer to the non-zero elements.
+ * @param numNNZ Number of non-zero elements.
+ */
+template <class fp_precision, class index_type>
+auto expval_Sparse_Matrix_CSR(const std::complex<fp_precision> *vector_ptr,
+                              const index_type vector_size,
+                              const index_type *row_map_ptr,
+                              const index_type row_map_size,
+                              const index_type *entries_ptr,
+                              const std::complex<fp_precision> *values_ptr,
+                              const index_type numNNZ) -> fp_precision {
+    check_Sparse_Matrix_CSR(vector_size, row_map_ptr, row_map_size, numNNZ);
+    Util::accumulator_t<fp_precision> result = 0.0;
+
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static) reduction(+:result)
+    #endif
+    // clang-format on
+    for (index_type row = 0; row < vector_size; row++) {
+        std::complex<fp_precision> sum{0.0, 0.0};
+        for (index_type j = row_map_ptr[row]; j < row_map_ptr[row + 1]; j++) {
+            sum += values_ptr[j] * vector_ptr[entries_ptr[j]];
+        }
+        result += std::real(std::conj(vector_ptr[row]) * sum);
+    }
+    return static_cast<fp_precision>(result);
+}
+} // namespace Pennylane::Util
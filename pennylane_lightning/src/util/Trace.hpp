@@ -0,0 +1,259 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file
+ * Record timeline events of simulator phases and export them as Chrome trace
+ * JSON, which chrome://tracing and Perfetto display.
+ *
+ * Phases are marked with PL_TRACE_SCOPE, which expands to nothing unless
+ * compiled with `-DENABLE_TRACING=ON`. Events are then recorded while
+ * tracing is enabled, either by TraceRecorder::setEnabled or by setting the
+ * environment variable `PL_TRACE_FILE` to the path the trace is written to
+ * at exit. When the NVTX headers are available, every scope is also an NVTX
+ * range, so that it shows up in Nsight Systems.
+ */
+#pragma once
+#include "Error.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_ENABLE_TRACING) && __has_include(<nvtx3/nvToolsExt.h>)
+#include <nvtx3/nvToolsExt.h>
+#define PL_USE_NVTX 1
+#endif
+
+namespace Pennylane::Util {
+/**
+ * @brief Environment variable holding the path of the Chrome trace written
+ * at exit.
+ */
+constexpr std::string_view trace_file_env = "PL_TRACE_FILE";
+
+/**
+ * @brief Complete event of a Chrome trace.
+ */
+struct TraceEvent {
+    const char *name;     ///< Name of the phase, a string literal
+    const char *category; ///< Category of the phase, a string literal
+    uint32_t thread;      ///< Index of the recording thread
+    int64_t begin_us;     ///< Start from the creation of the recorder
+    int64_t duration_us;
+};
+
+/**
+ * @brief Thread-safe recorder of timeline events.
+ */
+class TraceRecorder {
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint32_t> num_threads_{0};
+    Clock::time_point origin_{Clock::now()};
+    std::mutex mutex_;
+    std::vector<TraceEvent> events_;
+    std::string exit_path_;
+
+    TraceRecorder() {
+        // NOLINTNEXTLINE(concurrency-mt-unsafe)
+        const char *path = std::getenv(trace_file_env.data());
+        if (path != nullptr && *path != '\0') {
+            exit_path_ = path;
+            enabled_ = true;
+        }
+    }
+
+    static void writeEscaped(std::ostream &os, const char *str) {
+        for (; *str != '\0'; str++) {
+            if (*str == '"' || *str == '\\') {
+                os << '\\';
+            }
+            os << *str;
+        }
+    }
+
+  public:
+    TraceRecorder(const TraceRecorder &) = delete;
+    TraceRecorder(TraceRecorder &&) = delete;
+    TraceRecorder &operator=(const TraceRecorder &) = delete;
+    TraceRecorder &operator=(TraceRecorder &&) = delete;
+
+    ~TraceRecorder() {
+        if (!exit_path_.empty()) {
+            std::ofstream file(exit_path_);
+            writeChromeTrace(file);
+        }
+    }
+
+    /**
+     * @brief Get the singleton instance
+     */
+    static TraceRecorder &getInstance() {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+
+    /**
+     * @brief Start or stop recording events.
+     */
+    void setEnabled(bool enabled) {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto isEnabled() const -> bool {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the index of the calling thread, assigned in the order of
+     * the first events of threads.
+     */
+    auto threadIndex() -> uint32_t {
+        thread_local const uint32_t index = num_threads_.fetch_add(1);
+        return index;
+    }
+
+    /**
+     * @brief Get the time from the creation of the recorder in microseconds.
+     */
+    [[nodiscard]] auto now() const -> int64_t {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   Clock::now() - origin_)
+            .count();
+    }
+
+    /**
+     * @brief Record an event of the calling thread.
+     *
+     * @param name Name of the phase. Must outlive the recorder.
+     * @param category Category of the phase. Must outlive the recorder.
+     * @param begin_us Start of the event from now().
+     * @param end_us End of the event from now().
+     */
+    void record(const char *name, const char *category, int64_t begin_us,
+                int64_t end_us) {
+        const uint32_t thread = threadIndex();
+        std::lock_guard<std::mutex> lock(mutex_);
+        events_.push_back(
+            {name, category, thread, begin_us, end_us - begin_us});
+    }
+
+    /**
+     * @brief Get all recorded events.
+     */
+    [[nodiscard]] auto getEvents() -> std::vector<TraceEvent> {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return events_;
+    }
+
+    /**
+     * @brief Remove all recorded events.
+     */
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        events_.clear();
+    }
+
+    /**
+     * @brief Write the recorded events in the Chrome trace event format.
+     */
+    void writeChromeTrace(std::ostream &os) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        os << "{\"traceEvents\":[";
+        for (size_t idx = 0; idx < events_.size(); idx++) {
+            const auto &event = events_[idx];
+            os << (idx == 0 ? "\n" : ",\n") << "{\"name\":\"";
+            writeEscaped(os, event.name);
+            os << "\",\"cat\":\"";
+            writeEscaped(os, event.category);
+            os << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread
+               << ",\"ts\":" << event.begin_us
+               << ",\"dur\":" << event.duration_us << '}';
+        }
+        os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    /**
+     * @brief Write the recorded events to a Chrome trace file.
+     *
+     * @param path Path of the file.
+     */
+    void saveChromeTrace(const std::string &path) {
+        std::ofstream file(path);
+        PL_ABORT_IF_NOT(file.is_open(), "Cannot open the trace file.");
+        writeChromeTrace(file);
+    }
+};
+
+/**
+ * @brief Record the lifetime of the scope as an event when tracing is
+ * enabled.
+ */
+class TraceScope {
+  private:
+    const char *name_;
+    const char *category_;
+    int64_t begin_us_ = -1;
+
+  public:
+    TraceScope(const char *name, const char *category)
+        : name_{name}, category_{category} {
+        auto &recorder = TraceRecorder::getInstance();
+        if (recorder.isEnabled()) {
+            begin_us_ = recorder.now();
+#if defined(PL_USE_NVTX)
+            nvtxRangePushA(name_);
+#endif
+        }
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope(TraceScope &&) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+    TraceScope &operator=(TraceScope &&) = delete;
+
+    ~TraceScope() {
+        if (begin_us_ >= 0) {
+            auto &recorder = TraceRecorder::getInstance();
+            recorder.record(name_, category_, begin_us_, recorder.now());
+#if defined(PL_USE_NVTX)
+            nvtxRangePop();
+#endif
+        }
+    }
+};
+} // namespace Pennylane::Util
+
+/**
+ * @brief Record the enclosing scope as a trace event named `name` in the
+ * category `category`, both string literals.
+ */
+#if defined(_ENABLE_TRACING)
+#define PL_TRACE_SCOPE_CONCAT_INDIR(x, y) x##y
+#define PL_TRACE_SCOPE_CONCAT(x, y) PL_TRACE_SCOPE_CONCAT_INDIR(x, y)
+#define PL_TRACE_SCOPE(name, category)                                         \
+    const Pennylane::Util::TraceScope PL_TRACE_SCOPE_CONCAT(                   \
+        pl_trace_scope_, __LINE__)(name, category)
+#else
+#define PL_TRACE_SCOPE(name, category)
+#endif
@@ -36,4 +36,16 @@ template <typename T> struct is_complex : std::false_type {};
 template <typename T> struct is_complex<std::complex<T>> : std::true_type {};
 
 template <typename T> constexpr bool is_complex_v = is_complex<T>::value;
+
+/**
+ * @brief Floating point type used to accumulate reductions over data of
+ * precision T.
+ *
+ * Sums over single precision statevectors are accumulated in double, so
+ * norms, expectation values, and inner products of 2^30 amplitudes are not
+ * dominated by rounding errors of the accumulator.
+ */
+template <typename T> struct accumulator { using type = T; };
+template <> struct accumulator<float> { using type = double; };
+template <typename T> using accumulator_t = typename accumulator<T>::type;
 } // namespace Pennylane::Util
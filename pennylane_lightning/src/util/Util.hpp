@@ -17,6 +17,7 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <complex>
@@ -323,6 +324,10 @@ inline auto transposed_state_index(size_t ind,
  * @brief Template for the transposition of state tensors,
  * axes are assumed to have a length of 2 (|0>, |1>).
  *
+ * The transposed indices of the low axes are tabulated once, so each block
+ * of consecutive elements is moved with one table lookup per element. Blocks
+ * are distributed over OpenMP threads for large tensors.
+ *
  * @tparam T Tensor data type.
  * @param tensor Tensor to be transposed.
  * @param new_axes new axes distribution.
@@ -332,9 +337,34 @@ template <typename T>
 auto transpose_state_tensor(const std::vector<T> &tensor,
                             const std::vector<size_t> &new_axes)
     -> std::vector<T> {
+    constexpr size_t max_block_axes = 10;
+    constexpr size_t parallel_min_size = size_t{1U} << 16U;
     std::vector<T> transposed_tensor(tensor.size());
-    for (size_t ind = 0; ind < tensor.size(); ind++) {
-        transposed_tensor[transposed_state_index(ind, new_axes)] = tensor[ind];
+
+    const size_t num_block_axes = std::min(new_axes.size(), max_block_axes);
+    const size_t block_size = size_t{1U} << num_block_axes;
+    const std::vector<size_t> block_axes(new_axes.begin(),
+                                         new_axes.begin() + num_block_axes);
+    const std::vector<size_t> outer_axes(new_axes.begin() + num_block_axes,
+                                         new_axes.end());
+    std::vector<size_t> block_offsets(block_size);
+    for (size_t inner = 0; inner < block_size; inner++) {
+        block_offsets[inner] = transposed_state_index(inner, block_axes);
+    }
+
+    const size_t num_blocks = tensor.size() / block_size;
+    [[maybe_unused]] const bool parallel = tensor.size() >= parallel_min_size;
+    // clang-format off
+    #if defined(_OPENMP)
+        #pragma omp parallel for schedule(static) if(parallel)
+    #endif
+    // clang-format on
+    for (size_t outer = 0; outer < num_blocks; outer++) {
+        const size_t base = transposed_state_index(outer, outer_axes);
+        const T *src = tensor.data() + outer * block_size;
+        for (size_t inner = 0; inner < block_size; inner++) {
+            transposed_tensor[base + block_offsets[inner]] = src[inner];
+        }
     }
     return transposed_tensor;
 }
@@ -0,0 +1,137 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file WorkerPool.hpp
+ * Defines a pool of worker threads running jobs asynchronously.
+ */
+#pragma once
+
+#include "Error.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Pennylane::Util {
+/**
+ * @brief Pool of worker threads running submitted jobs in order.
+ *
+ * Jobs are run in the order of submission, each by a single worker. A job
+ * may itself use OpenMP threads, so one worker is enough to overlap a
+ * simulation with the work of the submitting thread.
+ */
+class WorkerPool {
+  private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> jobs_;
+    std::vector<std::thread> workers_;
+    bool stop_{false};
+
+    void run() {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock lock(mutex_);
+                cv_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+                if (jobs_.empty()) {
+                    return; // Stopped and all jobs are done
+                }
+                job = std::move(jobs_.front());
+                jobs_.pop_front();
+            }
+            job();
+        }
+    }
+
+  public:
+    /**
+     * @brief Create a pool and start its workers.
+     *
+     * @param num_workers Number of worker threads.
+     */
+    explicit WorkerPool(size_t num_workers = 1) {
+        PL_ABORT_IF(num_workers == 0, "At least one worker is required.");
+        workers_.reserve(num_workers);
+        for (size_t idx = 0; idx < num_workers; idx++) {
+            workers_.emplace_back([this] { run(); });
+        }
+    }
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool(WorkerPool &&) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+    WorkerPool &operator=(WorkerPool &&) = delete;
+
+    /**
+     * @brief Run the remaining jobs and join the workers.
+     */
+    ~WorkerPool() {
+        {
+            const std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Process-wide pool with a single worker.
+     */
+    static auto global() -> WorkerPool & {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Get the number of worker threads.
+     */
+    [[nodiscard]] auto getNumWorkers() const -> size_t {
+        return workers_.size();
+    }
+
+    /**
+     * @brief Submit a job.
+     *
+     * @param func Function without arguments. Exceptions thrown by it are
+     * rethrown by `get()` of the returned future.
+     * @return Future of the result of the function.
+     */
+    template <class Func>
+    auto submit(Func &&func) -> std::future<std::invoke_result_t<Func>> {
+        using ResultT = std::invoke_result_t<Func>;
+        // std::function requires a copyable callable
+        auto task = std::make_shared<std::packaged_task<ResultT()>>(
+            std::forward<Func>(func));
+        auto future = task->get_future();
+        {
+            const std::lock_guard lock(mutex_);
+            PL_ABORT_IF(stop_, "The worker pool is stopped.");
+            jobs_.emplace_back([task = std::move(task)] { (*task)(); });
+        }
+        cv_.notify_one();
+        return future;
+    }
+};
+} // namespace Pennylane::Util
@@ -84,7 +84,8 @@ class CMakeBuild(build_ext):
                 configure_args += ["-DENABLE_OPENMP=OFF"]
         elif platform.system() == "Linux":
             if platform.machine() == "x86_64":
-                configure_args += ["-DENABLE_AVX=ON"]  # Enable AVX if x64 on Linux
+                # Enable AVX if x64 on Linux, and AVX2/AVX512 kernels selected at runtime
+                configure_args += ["-DENABLE_AVX=ON", "-DENABLE_RUNTIME_DISPATCH=ON"]
         elif platform.system() == "Windows":
             configure_args += ["-DENABLE_OPENMP=OFF", "-DENABLE_BLAS=OFF"]
         else:
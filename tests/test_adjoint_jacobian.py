@@ -98,17 +98,55 @@ class TestAdjointJacobian:
     @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
     def test_unsupported_op(self, dev):
         """Test if a QuantumFunctionError is raised for an unsupported operation, i.e.,
-        multi-parameter operations that are not qml.Rot"""
+        multi-parameter operations that are not qml.Rot or qml.CRot"""
 
         with qml.tape.QuantumTape() as tape:
-            qml.CRot(0.1, 0.2, 0.3, wires=[0, 1])
+            qml.U3(0.1, 0.2, 0.3, wires=[0])
             qml.expval(qml.PauliZ(0))
 
         with pytest.raises(
-            qml.QuantumFunctionError, match="The CRot operation is not supported using the"
+            qml.QuantumFunctionError, match="The U3 operation is not supported using the"
         ):
             dev.adjoint_jacobian(tape)
 
+    @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
+    def test_trainable_matrix_unsupported(self, dev):
+        """Test if a QuantumFunctionError is raised for a trainable matrix operation without a
+        generator"""
+        with qml.tape.QuantumTape() as tape:
+            qml.QubitUnitary(np.eye(2), wires=[0])
+            qml.expval(qml.PauliZ(0))
+
+        tape.trainable_params = {0}
+
+        with pytest.raises(
+            qml.QuantumFunctionError,
+            match="The trainable QubitUnitary operation is not supported using the",
+        ):
+            dev.adjoint_jacobian(tape)
+
+    @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
+    def test_matrix_operations(self, dev):
+        """Test that the gradient of a circuit with a non-trainable matrix operation and an
+        operation differentiated through its generator matrix matches finite differences"""
+        with qml.tape.QuantumTape() as tape:
+            qml.RX(0.4, wires=0)
+            qml.QubitUnitary(qml.matrix(qml.Hadamard(wires=1)), wires=[1])
+            qml.PauliRot(0.3, "XY", wires=[0, 1])
+            qml.RY(-0.2, wires=1)
+            qml.expval(qml.PauliZ(0) @ qml.PauliX(1))
+
+        tape.trainable_params = {0, 2, 3}
+
+        calculated_val = dev.adjoint_jacobian(tape)
+
+        h = 2e-3 if dev.R_DTYPE == np.float32 else 1e-7
+        tol = 1e-3 if dev.R_DTYPE == np.float32 else 1e-7
+
+        tapes, fn = qml.gradients.finite_diff(tape, h=h)
+        numeric_val = fn(qml.execute(tapes, dev, None))
+        assert np.allclose(calculated_val, numeric_val, atol=tol, rtol=0)
+
     @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
     def test_proj_unsupported(self, dev):
         """Test if a QuantumFunctionError is raised for a Projector observable"""
@@ -247,7 +285,7 @@ class TestAdjointJacobian:
         assert np.allclose(dev_jacobian, expected_jacobian, atol=tol, rtol=0)
 
     qubit_ops = [getattr(qml, name) for name in qml.ops._qubit__ops__]
-    ops = {qml.RX, qml.RY, qml.RZ, qml.PhaseShift, qml.CRX, qml.CRY, qml.CRZ, qml.Rot}
+    ops = {qml.RX, qml.RY, qml.RZ, qml.PhaseShift, qml.CRX, qml.CRY, qml.CRZ, qml.Rot, qml.CRot}
 
     @pytest.mark.parametrize("obs", [qml.PauliX, qml.PauliY])
     @pytest.mark.parametrize(
@@ -260,6 +298,7 @@ class TestAdjointJacobian:
             qml.CRY(2.0, wires=[0, 1]),
             qml.CRZ(3.0, wires=[0, 1]),
             qml.Rot(0.2, -0.1, 0.2, wires=0),
+            qml.CRot(0.3, 1.2, -0.5, wires=[0, 1]),
         ],
     )
     def test_gradients(self, op, obs, dev):
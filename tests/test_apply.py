@@ -501,6 +501,29 @@ class TestApply:
 
         assert pointer_before == pointer_after
 
+    @pytest.mark.skipif(not lq._CPP_BINARY_AVAILABLE, reason="Lightning binary required")
+    @pytest.mark.parametrize("C", [np.complex64, np.complex128])
+    def test_state_preparation_preserve_pointer(self, C):
+        """Tests that state preparation overwrites the state in place, including for a
+        sub-register."""
+        dev = qml.device("lightning.qubit", wires=3, c_dtype=C)
+        dev.apply([qml.BasisState(np.array([1, 0]), wires=[2, 0])])
+        expected = np.zeros(8)
+        expected[1] = 1
+        assert np.allclose(dev.state, expected)
+
+        dev.reset()
+        pointer_before, _ = dev._state.__array_interface__["data"]
+        state = np.array([0.6, 0.0, 0.0, 0.8j])
+        dev.apply([qml.QubitStateVector(state, wires=[2, 1])])
+        expected = np.zeros(8, dtype=C)
+        expected[0] = 0.6
+        expected[3] = 0.8j
+        assert np.allclose(dev.state, expected)
+        pointer_after, _ = dev._state.__array_interface__["data"]
+
+        assert pointer_before == pointer_after
+
     def test_apply_errors_qubit_state_vector(self, qubit_device_2_wires):
         """Test that apply fails for incorrect state preparation, and > 2 qubit gates"""
         with pytest.raises(ValueError, match="Sum of amplitudes-squared does not equal one."):
@@ -24,11 +24,19 @@ except (ImportError, ModuleNotFoundError):
 
 def test_runtime_info():
     m = runtime_info()
-    for key in ["AVX", "AVX2", "AVX512F"]:
+    for key in ["AVX", "AVX2", "AVX512F", "NEON", "SVE"]:
         assert key in m
 
 
 def test_compile_info():
     m = compile_info()
-    for key in ["cpu.arch", "compiler.name", "compiler.version", "AVX2", "AVX512F"]:
+    for key in [
+        "cpu.arch",
+        "compiler.name",
+        "compiler.version",
+        "AVX2",
+        "AVX512F",
+        "NEON",
+        "runtime_dispatch",
+    ]:
         assert key in m
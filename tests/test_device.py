@@ -39,3 +39,29 @@ def test_create_device_with_dtype(C):
 def test_create_device_with_unsupported_dtype():
     with pytest.raises(TypeError, match="Unsupported complex Type:"):
         dev = qml.device("lightning.qubit", wires=1, c_dtype=np.complex256)
+
+
+@pytest.mark.parametrize(
+    "kwargs",
+    [
+        {"num_threads": 1},
+        {"num_threads": 2, "sequential_below_num_qubits": 4},
+        {"cpu_set": [0]},
+    ],
+)
+def test_create_device_with_threading(kwargs):
+    """Test that the threading configuration does not change the results."""
+    dev = qml.device("lightning.qubit", wires=3, **kwargs)
+    dev_default = qml.device("lightning.qubit", wires=3)
+
+    def circuit(x):
+        qml.RX(x, wires=0)
+        qml.CNOT(wires=[0, 1])
+        qml.RY(0.4, wires=2)
+        return qml.expval(qml.PauliZ(1) @ qml.PauliX(2))
+
+    x = qml.numpy.array(0.3, requires_grad=True)
+    qnode = qml.QNode(circuit, dev, diff_method="adjoint")
+    qnode_default = qml.QNode(circuit, dev_default, diff_method="adjoint")
+    assert np.allclose(qnode(x), qnode_default(x))
+    assert np.allclose(qml.grad(qnode)(x), qml.grad(qnode_default)(x))
@@ -0,0 +1,130 @@
+# Copyright 2022 Xanadu Quantum Technologies Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Unit tests for the DLPack export and import of statevectors.
+"""
+import gc
+
+import numpy as np
+import pytest
+
+try:
+    from pennylane_lightning.lightning_qubit_ops import (
+        StateVectorC64,
+        StateVectorC128,
+        StateVectorManagedC64,
+        StateVectorManagedC128,
+    )
+except (ImportError, ModuleNotFoundError):
+    pytest.skip("No binary module found. Skipping.", allow_module_level=True)
+
+if not hasattr(np, "from_dlpack"):
+    pytest.skip("NumPy does not support DLPack. Skipping.", allow_module_level=True)
+
+sv_classes = [(np.complex64, StateVectorC64), (np.complex128, StateVectorC128)]
+managed_classes = [
+    (np.complex64, StateVectorManagedC64),
+    (np.complex128, StateVectorManagedC128),
+]
+
+
+@pytest.mark.parametrize("dtype,cls", sv_classes)
+def test_export_is_a_view(dtype, cls):
+    """Test that a statevector is exported without copying its data"""
+    state = np.zeros(8, dtype=dtype)
+    state[0] = 1
+    sv = cls(state)
+    assert sv.__dlpack_device__() == (1, 0)
+
+    view = np.from_dlpack(sv)
+    assert view.dtype == dtype
+    assert view.shape == (8,)
+    assert view.__array_interface__["data"][0] == state.__array_interface__["data"][0]
+
+    sv.Hadamard([0], False, [])
+    expected = np.zeros(8, dtype=dtype)
+    expected[[0, 4]] = 1 / np.sqrt(2)
+    assert np.allclose(np.from_dlpack(sv), expected)
+
+
+@pytest.mark.parametrize("dtype,cls", sv_classes)
+def test_export_copy(dtype, cls):
+    """Test that a copy is exported on request"""
+    state = np.zeros(4, dtype=dtype)
+    state[0] = 1
+    sv = cls(state)
+    copy = np.from_dlpack(sv.__dlpack__(copy=True))
+    copy[0] = 0
+    assert state[0] == 1
+
+    with pytest.raises(Exception, match="Streams are not supported"):
+        sv.__dlpack__(stream=1)
+
+
+@pytest.mark.parametrize("dtype,cls", sv_classes)
+def test_export_keeps_array_alive(dtype, cls):
+    """Test that the exported tensor keeps alive the array the statevector shares"""
+    state = np.zeros(8, dtype=dtype)
+    state[0] = 1
+    sv = cls(state)
+    sv.PauliX([2], False, [])
+    view = np.from_dlpack(sv)
+    del sv, state
+    gc.collect()
+    expected = np.zeros(8, dtype=dtype)
+    expected[1] = 1
+    assert np.allclose(view, expected)
+
+
+@pytest.mark.parametrize("dtype,cls", managed_classes)
+def test_export_keeps_managed_alive(dtype, cls):
+    """Test that the exported tensor keeps the statevector alive"""
+    sv = cls(3)
+    view = np.from_dlpack(sv)
+    del sv
+    gc.collect()
+    expected = np.zeros(8, dtype=dtype)
+    expected[0] = 1
+    assert np.allclose(view, expected)
+
+
+@pytest.mark.parametrize("dtype,cls", sv_classes)
+def test_import(dtype, cls):
+    """Test that a statevector shares the data of an imported tensor"""
+    state = np.zeros(8, dtype=dtype)
+    state[0] = 1
+    sv = cls.from_dlpack(state)
+    sv.PauliX([2], False, [])
+    assert state[1] == 1
+    assert state[0] == 0
+
+    del state
+    gc.collect()
+    assert np.from_dlpack(sv)[1] == 1
+
+
+@pytest.mark.parametrize("dtype,cls", sv_classes)
+def test_import_errors(dtype, cls):
+    """Test that invalid tensors are rejected"""
+    other = np.complex128 if dtype == np.complex64 else np.complex64
+    with pytest.raises(Exception, match="complex64 or complex128"):
+        cls.from_dlpack(np.zeros(4, dtype=other))
+    with pytest.raises(Exception, match="1-dimensional"):
+        cls.from_dlpack(np.zeros((2, 2), dtype=dtype))
+    with pytest.raises(Exception, match="contiguous"):
+        cls.from_dlpack(np.zeros(8, dtype=dtype)[::2])
+    with pytest.raises(Exception, match="perfect power of 2"):
+        cls.from_dlpack(np.zeros(3, dtype=dtype))
+    with pytest.raises(Exception, match="__dlpack__"):
+        cls.from_dlpack(1)
@@ -165,6 +165,37 @@ class TestProbs:
         assert np.allclose(circuit(), cases[1], atol=tol, rtol=0)
 
 
+class TestDensityMatrix:
+    """Test reduced density matrices in Lightning"""
+
+    @pytest.fixture(params=[np.complex64, np.complex128])
+    def dev(self, request):
+        return qml.device("lightning.qubit", wires=3, c_dtype=request.param)
+
+    @pytest.mark.parametrize("wires", [[0], [2, 0], [1, 2], [0, 1, 2]])
+    def test_density_matrix(self, wires, dev, tol):
+        """Test that the reduced density matrix, its purity and its Renyi-2
+        entropy match a partial trace of the state"""
+        rng = np.random.default_rng(1337)
+        state = rng.normal(size=8) + 1j * rng.normal(size=8)
+        state /= np.linalg.norm(state)
+        dev._state = dev._asarray(state.astype(dev.C_DTYPE))
+
+        traced = [w for w in range(3) if w not in wires]
+        psi = np.transpose(state.reshape([2] * 3), wires + traced)
+        psi = psi.reshape(2 ** len(wires), -1)
+        expected = psi @ psi.conj().T
+
+        assert np.allclose(dev.density_matrix(wires), expected, atol=tol, rtol=0)
+
+        M = (MeasuresC64 if dev.use_csingle else MeasuresC128)(
+            dev._state_vector(np.ravel(dev._state))
+        )
+        purity = np.real(np.trace(expected @ expected))
+        assert np.isclose(M.purity(wires), purity, atol=tol, rtol=0)
+        assert np.isclose(M.renyi2_entropy(wires), -np.log(purity), atol=tol, rtol=0)
+
+
 class TestExpval:
     """Tests for the expval function"""
 
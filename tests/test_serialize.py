@@ -390,6 +390,8 @@ class TestSerializeOps:
                 [[0], [1], [0, 1]],
                 [False, False, False],
                 [[], [], []],
+                [[], [], []],
+                ["", "", ""],
             ),
             False,
         )
@@ -413,6 +415,8 @@ class TestSerializeOps:
                 [[0], [1], [0, 1]],
                 [False, False, False],
                 [[], [], []],
+                [[], [], []],
+                ["", "", ""],
             ),
             True,
         )
@@ -433,6 +437,8 @@ class TestSerializeOps:
                 [[0], [1], [0, 1]],
                 [False, True, False],
                 [[], [], []],
+                [[], [], []],
+                ["", "", ""],
             ),
             False,
         )
@@ -458,6 +464,39 @@ class TestSerializeOps:
         assert s[0][0] == s_expected[0][0]
         assert s[0][1] == s_expected[0][1]
 
+    def test_generator_circuit(self):
+        """Test expected serialization for a circuit including a single-parameter gate without a
+        dedicated kernel, which is serialized with its generator"""
+        with qml.tape.QuantumTape() as tape:
+            qml.RX(0.4, wires=0)
+            qml.U1(0.3, wires=1).inv()
+
+        s = _serialize_ops(tape, self.wires_dict)
+        assert s[0][0] == ["RX", "U1"]
+        assert s[0][1] == [[0.4], [0.3]]
+        assert s[0][3] == [False, True]
+        assert np.allclose(s[0][4][1], qml.matrix(qml.U1(0.3, wires=1)))
+        generator = qml.U1(0.3, wires=1).generator()
+        assert np.allclose(s[0][5][1], qml.matrix(generator, wire_order=[1]))
+        assert s[0][5][0] == []
+        assert s[0][6] == ["", ""]
+
+    def test_pauli_rot_circuit(self):
+        """Test expected serialization for a circuit including a Pauli rotation, whose Pauli word
+        is serialized separately from the matrices"""
+        with qml.tape.QuantumTape() as tape:
+            qml.RX(0.4, wires=0)
+            qml.PauliRot(0.3, "XIYZ", wires=[0, 1, 2, 3]).inv()
+
+        s = _serialize_ops(tape, self.wires_dict)
+        assert s[0][0] == ["RX", "PauliRot"]
+        assert s[0][1] == [[0.4], [0.3]]
+        assert s[0][2] == [[0], [0, 1, 2, 3]]
+        assert s[0][3] == [False, True]
+        assert s[0][4] == [[], []]
+        assert s[0][5] == [[], []]
+        assert s[0][6] == ["", "XIYZ"]
+
     def test_custom_wires_circuit(self):
         """Test expected serialization for a simple circuit with custom wire labels"""
         wires_dict = {"a": 0, 3.2: 1}
@@ -486,6 +525,8 @@ class TestSerializeOps:
                 [[0], [1], [0, 1], [0, 1], [0, 1], [0, 1]],
                 [False, False, False, False, False, True],
                 [[], [], [], [], [], []],
+                [[], [], [], [], [], []],
+                ["", "", "", "", "", ""],
             ),
             False,
         )
@@ -532,6 +573,8 @@ class TestSerializeOps:
                     [],
                     [],
                 ],
+                [[], [], [], [], [], [], [], []],
+                ["", "", "", "", "", "", "", ""],
             ),
             False,
         )
@@ -542,3 +585,5 @@ class TestSerializeOps:
         assert s[1] == s_expected[1]
 
         assert all(np.allclose(s1, s2) for s1, s2 in zip(s[0][4], s_expected[0][4]))
+        assert s[0][5] == s_expected[0][5]
+        assert s[0][6] == s_expected[0][6]